@@ -43,6 +43,12 @@ AC_DEFUN([AX_LIBEWF_CHECK_LOCAL],
   dnl Headers included in libewf/libewf_date_time.h
   AC_HEADER_TIME
 
+  dnl Headers included in libewf/libewf_file_descriptor_pool.c and libewf/libewf_persistent_cache.c
+  AC_CHECK_HEADERS([errno.h fcntl.h unistd.h])
+
+  dnl Headers included in libewf/libewf_support.c
+  AC_CHECK_HEADERS([dirent.h])
+
   dnl Check for functions
   dnl Date and time functions used in libewf/libewf_date_time.h
   AC_CHECK_FUNCS([localtime localtime_r mktime])
@@ -61,6 +67,15 @@ AC_DEFUN([AX_LIBEWF_CHECK_LOCAL],
       [1])
   ])
 
+  dnl File input/output functions used in libewf/libewf_file_descriptor_pool.c
+  AC_CHECK_FUNCS([close open posix_fadvise pread])
+
+  dnl File input/output functions used in libewf/libewf_persistent_cache.c
+  AC_CHECK_FUNCS([ftruncate pwrite])
+
+  dnl Directory functions used in libewf/libewf_support.c
+  AC_CHECK_FUNCS([closedir opendir readdir])
+
   dnl Check for internationalization functions in libewf/libewf_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
 ])
@@ -73,6 +88,10 @@ AC_DEFUN([AX_EWFTOOLS_CHECK_LOCAL],
   dnl Functions used in ewftools
   AC_CHECK_FUNCS([close getopt setvbuf])
 
+  dnl Headers and functions included in ewftools/export_handle.c
+  AC_CHECK_HEADERS([errno.h fcntl.h])
+  AC_CHECK_FUNCS([open pwrite])
+
   AS_IF(
    [test "x$ac_cv_func_close" != xyes],
    [AC_MSG_FAILURE(
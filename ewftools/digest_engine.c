@@ -0,0 +1,3752 @@
+/*
+ * Digest engine with hardware accelerated digest hash functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "digest_engine.h"
+#include "ewftools_libcerror.h"
+
+#if defined( HAVE_DIGEST_ENGINE_X86_SHA_EXTENSIONS )
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+#if defined( HAVE_DIGEST_ENGINE_ARM_SHA_EXTENSIONS )
+#include <arm_neon.h>
+
+#if defined( __linux__ )
+#include <sys/auxv.h>
+
+/* The AArch64 hardware capabilities of the SHA1 and SHA2 instructions
+ */
+#if !defined( HWCAP_SHA1 )
+#define HWCAP_SHA1	( 1 << 5 )
+#endif
+
+#if !defined( HWCAP_SHA2 )
+#define HWCAP_SHA2	( 1 << 6 )
+#endif
+
+#endif /* defined( __linux__ ) */
+
+#if defined( __clang__ )
+#define DIGEST_ENGINE_ARM_SHA_TARGET
+#else
+#define DIGEST_ENGINE_ARM_SHA_TARGET	__attribute__((target("+crypto")))
+#endif
+
+#endif /* defined( HAVE_DIGEST_ENGINE_ARM_SHA_EXTENSIONS ) */
+
+/* The SHA256 round constants
+ */
+static const uint32_t digest_engine_sha256_constants[ 64 ] = {
+	0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL, 0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
+	0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL, 0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL, 0xc19bf174UL,
+	0xe49b69c1UL, 0xefbe4786UL, 0x0fc19dc6UL, 0x240ca1ccUL, 0x2de92c6fUL, 0x4a7484aaUL, 0x5cb0a9dcUL, 0x76f988daUL,
+	0x983e5152UL, 0xa831c66dUL, 0xb00327c8UL, 0xbf597fc7UL, 0xc6e00bf3UL, 0xd5a79147UL, 0x06ca6351UL, 0x14292967UL,
+	0x27b70a85UL, 0x2e1b2138UL, 0x4d2c6dfcUL, 0x53380d13UL, 0x650a7354UL, 0x766a0abbUL, 0x81c2c92eUL, 0x92722c85UL,
+	0xa2bfe8a1UL, 0xa81a664bUL, 0xc24b8b70UL, 0xc76c51a3UL, 0xd192e819UL, 0xd6990624UL, 0xf40e3585UL, 0x106aa070UL,
+	0x19a4c116UL, 0x1e376c08UL, 0x2748774cUL, 0x34b0bcb5UL, 0x391c0cb3UL, 0x4ed8aa4aUL, 0x5b9cca4fUL, 0x682e6ff3UL,
+	0x748f82eeUL, 0x78a5636fUL, 0x84c87814UL, 0x8cc70208UL, 0x90befffaUL, 0xa4506cebUL, 0xbef9a3f7UL, 0xc67178f2UL };
+
+#if defined( HAVE_DIGEST_ENGINE_X86_SHA_EXTENSIONS )
+
+/* Calculates a SHA1 round group of 4 rounds using the x86 SHA extensions
+ * The message of the round group is replaced by the message of round group + 4
+ * The round function must be a constant
+ */
+#define DIGEST_ENGINE_SHA1_ROUND_GROUP_X86( round_function ) \
+	if( round_group > 0 ) \
+	{ \
+		e1 = _mm_sha1nexte_epu32( e0, messages[ round_group & 3 ] ); \
+	} \
+	e0   = abcd; \
+	abcd = _mm_sha1rnds4_epu32( abcd, e1, round_function ); \
+\
+	if( round_group < 16 ) \
+	{ \
+		messages[ round_group & 3 ] = _mm_sha1msg2_epu32( \
+		                               _mm_xor_si128( \
+		                                _mm_sha1msg1_epu32( \
+		                                 messages[ round_group & 3 ], \
+		                                 messages[ ( round_group + 1 ) & 3 ] ), \
+		                                messages[ ( round_group + 2 ) & 3 ] ), \
+		                               messages[ ( round_group + 3 ) & 3 ] ); \
+	}
+
+/* Calculates the SHA1 of 64 byte blocks using the x86 SHA extensions
+ */
+__attribute__((target("sha,sse4.1,ssse3")))
+static void digest_engine_sha1_process_blocks_x86(
+             uint32_t *hash_values,
+             const uint8_t *blocks,
+             size_t number_of_blocks )
+{
+	__m128i messages[ 4 ];
+
+	const __m128i byte_order_mask = _mm_set_epi64x( 0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL );
+	__m128i abcd                  = _mm_loadu_si128( (const __m128i *) hash_values );
+	__m128i abcd_save             = abcd;
+	__m128i e0                    = _mm_set_epi32( (int) hash_values[ 4 ], 0, 0, 0 );
+	__m128i e0_save               = e0;
+	__m128i e1                    = e0;
+	int message_index             = 0;
+	int round_group               = 0;
+
+	abcd = _mm_shuffle_epi32(
+	        abcd,
+	        0x1b );
+
+	while( number_of_blocks > 0 )
+	{
+		abcd_save = abcd;
+		e0_save   = e0;
+
+		for( message_index = 0;
+		     message_index < 4;
+		     message_index++ )
+		{
+			messages[ message_index ] = _mm_shuffle_epi8(
+			                             _mm_loadu_si128( (const __m128i *) &( blocks[ message_index * 16 ] ) ),
+			                             byte_order_mask );
+		}
+		e1 = _mm_add_epi32(
+		      e0,
+		      messages[ 0 ] );
+
+		/* Every round group calculates 4 rounds, the round function changes every 5 round groups
+		 */
+		for( round_group = 0;
+		     round_group < 5;
+		     round_group++ )
+		{
+			DIGEST_ENGINE_SHA1_ROUND_GROUP_X86( 0 )
+		}
+		for( round_group = 5;
+		     round_group < 10;
+		     round_group++ )
+		{
+			DIGEST_ENGINE_SHA1_ROUND_GROUP_X86( 1 )
+		}
+		for( round_group = 10;
+		     round_group < 15;
+		     round_group++ )
+		{
+			DIGEST_ENGINE_SHA1_ROUND_GROUP_X86( 2 )
+		}
+		for( round_group = 15;
+		     round_group < 20;
+		     round_group++ )
+		{
+			DIGEST_ENGINE_SHA1_ROUND_GROUP_X86( 3 )
+		}
+		e0   = _mm_sha1nexte_epu32( e0, e0_save );
+		abcd = _mm_add_epi32( abcd, abcd_save );
+
+		blocks           += DIGEST_ENGINE_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+	abcd = _mm_shuffle_epi32(
+	        abcd,
+	        0x1b );
+
+	_mm_storeu_si128(
+	 (__m128i *) hash_values,
+	 abcd );
+
+	hash_values[ 4 ] = (uint32_t) _mm_extract_epi32( e0, 3 );
+}
+
+/* Calculates the SHA256 of 64 byte blocks using the x86 SHA extensions
+ */
+__attribute__((target("sha,sse4.1,ssse3")))
+static void digest_engine_sha256_process_blocks_x86(
+             uint32_t *hash_values,
+             const uint8_t *blocks,
+             size_t number_of_blocks )
+{
+	__m128i messages[ 4 ];
+
+	const __m128i byte_order_mask = _mm_set_epi64x( 0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL );
+	__m128i message               = _mm_setzero_si128();
+	__m128i state0                = _mm_setzero_si128();
+	__m128i state0_save           = state0;
+	__m128i state1                = _mm_loadu_si128( (const __m128i *) &( hash_values[ 4 ] ) );
+	__m128i state1_save           = state1;
+	__m128i value_128bit          = _mm_loadu_si128( (const __m128i *) hash_values );
+	int message_index             = 0;
+	int round_group               = 0;
+
+	/* Convert the hash values from ABCD EFGH into ABEF CDGH
+	 */
+	value_128bit = _mm_shuffle_epi32( value_128bit, 0xb1 );
+	state1       = _mm_shuffle_epi32( state1, 0x1b );
+	state0       = _mm_alignr_epi8( value_128bit, state1, 8 );
+	state1       = _mm_blend_epi16( state1, value_128bit, 0xf0 );
+
+	while( number_of_blocks > 0 )
+	{
+		state0_save = state0;
+		state1_save = state1;
+
+		for( message_index = 0;
+		     message_index < 4;
+		     message_index++ )
+		{
+			messages[ message_index ] = _mm_shuffle_epi8(
+			                             _mm_loadu_si128( (const __m128i *) &( blocks[ message_index * 16 ] ) ),
+			                             byte_order_mask );
+		}
+		/* Every round group calculates 4 rounds
+		 */
+		for( round_group = 0;
+		     round_group < 16;
+		     round_group++ )
+		{
+			if( round_group >= 4 )
+			{
+				messages[ round_group & 3 ] = _mm_sha256msg2_epu32(
+				                               _mm_add_epi32(
+				                                _mm_sha256msg1_epu32(
+				                                 messages[ round_group & 3 ],
+				                                 messages[ ( round_group + 1 ) & 3 ] ),
+				                                _mm_alignr_epi8(
+				                                 messages[ ( round_group + 3 ) & 3 ],
+				                                 messages[ ( round_group + 2 ) & 3 ],
+				                                 4 ) ),
+				                               messages[ ( round_group + 3 ) & 3 ] );
+			}
+			message = _mm_add_epi32(
+			           messages[ round_group & 3 ],
+			           _mm_loadu_si128( (const __m128i *) &( digest_engine_sha256_constants[ round_group * 4 ] ) ) );
+
+			state1  = _mm_sha256rnds2_epu32( state1, state0, message );
+			message = _mm_shuffle_epi32( message, 0x0e );
+			state0  = _mm_sha256rnds2_epu32( state0, state1, message );
+		}
+		state0 = _mm_add_epi32( state0, state0_save );
+		state1 = _mm_add_epi32( state1, state1_save );
+
+		blocks           += DIGEST_ENGINE_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+	/* Convert the hash values from ABEF CDGH into ABCD EFGH
+	 */
+	value_128bit = _mm_shuffle_epi32( state0, 0x1b );
+	state1       = _mm_shuffle_epi32( state1, 0xb1 );
+	state0       = _mm_blend_epi16( value_128bit, state1, 0xf0 );
+	state1       = _mm_alignr_epi8( state1, value_128bit, 8 );
+
+	_mm_storeu_si128(
+	 (__m128i *) hash_values,
+	 state0 );
+
+	_mm_storeu_si128(
+	 (__m128i *) &( hash_values[ 4 ] ),
+	 state1 );
+}
+
+#endif /* defined( HAVE_DIGEST_ENGINE_X86_SHA_EXTENSIONS ) */
+
+#if defined( HAVE_DIGEST_ENGINE_ARM_SHA_EXTENSIONS )
+
+/* Calculates a SHA1 round group of 4 rounds using the ARMv8 cryptographic extensions
+ * The message of the round group is replaced by the message of round group + 4
+ * The round function must be vsha1cq_u32, vsha1pq_u32 or vsha1mq_u32
+ */
+#define DIGEST_ENGINE_SHA1_ROUND_GROUP_ARM( round_function, round_constant ) \
+	message = vaddq_u32( \
+	           messages[ round_group & 3 ], \
+	           vdupq_n_u32( round_constant ) ); \
+\
+	e1   = vsha1h_u32( vgetq_lane_u32( abcd, 0 ) ); \
+	abcd = round_function( abcd, e0, message ); \
+	e0   = e1; \
+\
+	if( round_group < 16 ) \
+	{ \
+		messages[ round_group & 3 ] = vsha1su1q_u32( \
+		                               vsha1su0q_u32( \
+		                                messages[ round_group & 3 ], \
+		                                messages[ ( round_group + 1 ) & 3 ], \
+		                                messages[ ( round_group + 2 ) & 3 ] ), \
+		                               messages[ ( round_group + 3 ) & 3 ] ); \
+	}
+
+/* Calculates the SHA1 of 64 byte blocks using the ARMv8 cryptographic extensions
+ */
+DIGEST_ENGINE_ARM_SHA_TARGET
+static void digest_engine_sha1_process_blocks_arm(
+             uint32_t *hash_values,
+             const uint8_t *blocks,
+             size_t number_of_blocks )
+{
+	uint32x4_t messages[ 4 ];
+
+	uint32x4_t abcd      = vld1q_u32( hash_values );
+	uint32x4_t abcd_save = abcd;
+	uint32x4_t message   = abcd;
+	uint32_t e0          = hash_values[ 4 ];
+	uint32_t e0_save     = e0;
+	uint32_t e1          = 0;
+	int message_index    = 0;
+	int round_group      = 0;
+
+	while( number_of_blocks > 0 )
+	{
+		abcd_save = abcd;
+		e0_save   = e0;
+
+		for( message_index = 0;
+		     message_index < 4;
+		     message_index++ )
+		{
+			messages[ message_index ] = vreinterpretq_u32_u8(
+			                             vrev32q_u8(
+			                              vld1q_u8( &( blocks[ message_index * 16 ] ) ) ) );
+		}
+		/* Every round group calculates 4 rounds, the round function changes every 5 round groups
+		 */
+		for( round_group = 0;
+		     round_group < 5;
+		     round_group++ )
+		{
+			DIGEST_ENGINE_SHA1_ROUND_GROUP_ARM( vsha1cq_u32, 0x5a827999UL )
+		}
+		for( round_group = 5;
+		     round_group < 10;
+		     round_group++ )
+		{
+			DIGEST_ENGINE_SHA1_ROUND_GROUP_ARM( vsha1pq_u32, 0x6ed9eba1UL )
+		}
+		for( round_group = 10;
+		     round_group < 15;
+		     round_group++ )
+		{
+			DIGEST_ENGINE_SHA1_ROUND_GROUP_ARM( vsha1mq_u32, 0x8f1bbcdcUL )
+		}
+		for( round_group = 15;
+		     round_group < 20;
+		     round_group++ )
+		{
+			DIGEST_ENGINE_SHA1_ROUND_GROUP_ARM( vsha1pq_u32, 0xca62c1d6UL )
+		}
+		abcd = vaddq_u32( abcd, abcd_save );
+		e0  += e0_save;
+
+		blocks           += DIGEST_ENGINE_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+	vst1q_u32(
+	 hash_values,
+	 abcd );
+
+	hash_values[ 4 ] = e0;
+}
+
+/* Calculates the SHA256 of 64 byte blocks using the ARMv8 cryptographic extensions
+ */
+DIGEST_ENGINE_ARM_SHA_TARGET
+static void digest_engine_sha256_process_blocks_arm(
+             uint32_t *hash_values,
+             const uint8_t *blocks,
+             size_t number_of_blocks )
+{
+	uint32x4_t messages[ 4 ];
+
+	uint32x4_t state0          = vld1q_u32( hash_values );
+	uint32x4_t state0_save     = state0;
+	uint32x4_t state1          = vld1q_u32( &( hash_values[ 4 ] ) );
+	uint32x4_t state1_save     = state1;
+	uint32x4_t previous_state0 = state0;
+	uint32x4_t message         = state0;
+	int message_index          = 0;
+	int round_group            = 0;
+
+	while( number_of_blocks > 0 )
+	{
+		state0_save = state0;
+		state1_save = state1;
+
+		for( message_index = 0;
+		     message_index < 4;
+		     message_index++ )
+		{
+			messages[ message_index ] = vreinterpretq_u32_u8(
+			                             vrev32q_u8(
+			                              vld1q_u8( &( blocks[ message_index * 16 ] ) ) ) );
+		}
+		/* Every round group calculates 4 rounds
+		 */
+		for( round_group = 0;
+		     round_group < 16;
+		     round_group++ )
+		{
+			message = vaddq_u32(
+			           messages[ round_group & 3 ],
+			           vld1q_u32( &( digest_engine_sha256_constants[ round_group * 4 ] ) ) );
+
+			if( round_group < 12 )
+			{
+				messages[ round_group & 3 ] = vsha256su1q_u32(
+				                               vsha256su0q_u32(
+				                                messages[ round_group & 3 ],
+				                                messages[ ( round_group + 1 ) & 3 ] ),
+				                               messages[ ( round_group + 2 ) & 3 ],
+				                               messages[ ( round_group + 3 ) & 3 ] );
+			}
+			previous_state0 = state0;
+			state0          = vsha256hq_u32( state0, state1, message );
+			state1          = vsha256h2q_u32( state1, previous_state0, message );
+		}
+		state0 = vaddq_u32( state0, state0_save );
+		state1 = vaddq_u32( state1, state1_save );
+
+		blocks           += DIGEST_ENGINE_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+	vst1q_u32(
+	 hash_values,
+	 state0 );
+
+	vst1q_u32(
+	 &( hash_values[ 4 ] ),
+	 state1 );
+}
+
+#endif /* defined( HAVE_DIGEST_ENGINE_ARM_SHA_EXTENSIONS ) */
+
+/* The MD5 round constants
+ */
+static const uint32_t digest_engine_md5_constants[ 64 ] = {
+	0xd76aa478UL, 0xe8c7b756UL, 0x242070dbUL, 0xc1bdceeeUL, 0xf57c0fafUL, 0x4787c62aUL, 0xa8304613UL, 0xfd469501UL,
+	0x698098d8UL, 0x8b44f7afUL, 0xffff5bb1UL, 0x895cd7beUL, 0x6b901122UL, 0xfd987193UL, 0xa679438eUL, 0x49b40821UL,
+	0xf61e2562UL, 0xc040b340UL, 0x265e5a51UL, 0xe9b6c7aaUL, 0xd62f105dUL, 0x02441453UL, 0xd8a1e681UL, 0xe7d3fbc8UL,
+	0x21e1cde6UL, 0xc33707d6UL, 0xf4d50d87UL, 0x455a14edUL, 0xa9e3e905UL, 0xfcefa3f8UL, 0x676f02d9UL, 0x8d2a4c8aUL,
+	0xfffa3942UL, 0x8771f681UL, 0x6d9d6122UL, 0xfde5380cUL, 0xa4beea44UL, 0x4bdecfa9UL, 0xf6bb4b60UL, 0xbebfbc70UL,
+	0x289b7ec6UL, 0xeaa127faUL, 0xd4ef3085UL, 0x04881d05UL, 0xd9d4d039UL, 0xe6db99e5UL, 0x1fa27cf8UL, 0xc4ac5665UL,
+	0xf4292244UL, 0x432aff97UL, 0xab9423a7UL, 0xfc93a039UL, 0x655b59c3UL, 0x8f0ccc92UL, 0xffeff47dUL, 0x85845dd1UL,
+	0x6fa87e4fUL, 0xfe2ce6e0UL, 0xa3014314UL, 0x4e0811a1UL, 0xf7537e82UL, 0xbd3af235UL, 0x2ad7d2bbUL, 0xeb86d391UL };
+
+/* The MD5 number of bits to rotate of every round
+ */
+static const uint8_t digest_engine_md5_rotations[ 64 ] = {
+	7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+	5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+	4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+	6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21 };
+
+#define digest_engine_rotate_left( value, number_of_bits ) \
+	( ( (value) << (number_of_bits) ) | ( (value) >> ( 32 - (number_of_bits) ) ) )
+
+#define digest_engine_rotate_right( value, number_of_bits ) \
+	( ( (value) >> (number_of_bits) ) | ( (value) << ( 32 - (number_of_bits) ) ) )
+
+/* Calculates a MD5 round
+ */
+#define digest_engine_md5_round( round_function, message_index ) \
+	round_value = a + ( round_function ) + digest_engine_md5_constants[ round_index ] + block_words[ message_index ]; \
+	a           = d; \
+	d           = c; \
+	c           = b; \
+	b          += digest_engine_rotate_left( round_value, digest_engine_md5_rotations[ round_index ] );
+
+/* Calculates the MD5 of 64 byte blocks
+ */
+static void digest_engine_md5_process_blocks(
+             uint32_t *hash_values,
+             const uint8_t *blocks,
+             size_t number_of_blocks )
+{
+	uint32_t block_words[ 16 ];
+
+	uint32_t a           = 0;
+	uint32_t b           = 0;
+	uint32_t c           = 0;
+	uint32_t d           = 0;
+	uint32_t round_value = 0;
+	int round_index      = 0;
+	int word_index       = 0;
+
+	while( number_of_blocks > 0 )
+	{
+		for( word_index = 0;
+		     word_index < 16;
+		     word_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( blocks[ word_index * 4 ] ),
+			 block_words[ word_index ] );
+		}
+		a = hash_values[ 0 ];
+		b = hash_values[ 1 ];
+		c = hash_values[ 2 ];
+		d = hash_values[ 3 ];
+
+		for( round_index = 0;
+		     round_index < 16;
+		     round_index++ )
+		{
+			digest_engine_md5_round(
+			 ( b & c ) | ( ~b & d ),
+			 round_index );
+		}
+		for( round_index = 16;
+		     round_index < 32;
+		     round_index++ )
+		{
+			digest_engine_md5_round(
+			 ( d & b ) | ( ~d & c ),
+			 ( ( 5 * round_index ) + 1 ) & 0x0f );
+		}
+		for( round_index = 32;
+		     round_index < 48;
+		     round_index++ )
+		{
+			digest_engine_md5_round(
+			 b ^ c ^ d,
+			 ( ( 3 * round_index ) + 5 ) & 0x0f );
+		}
+		for( round_index = 48;
+		     round_index < 64;
+		     round_index++ )
+		{
+			digest_engine_md5_round(
+			 c ^ ( b | ~d ),
+			 ( 7 * round_index ) & 0x0f );
+		}
+		hash_values[ 0 ] += a;
+		hash_values[ 1 ] += b;
+		hash_values[ 2 ] += c;
+		hash_values[ 3 ] += d;
+
+		blocks           += DIGEST_ENGINE_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+}
+
+/* Calculates a SHA1 round
+ */
+#define digest_engine_sha1_round( round_function, round_constant ) \
+	round_value = digest_engine_rotate_left( a, 5 ) + ( round_function ) + e + round_constant + schedule[ round_index ]; \
+	e           = d; \
+	d           = c; \
+	c           = digest_engine_rotate_left( b, 30 ); \
+	b           = a; \
+	a           = round_value;
+
+/* Calculates the SHA1 of 64 byte blocks
+ */
+static void digest_engine_sha1_process_blocks(
+             uint32_t *hash_values,
+             const uint8_t *blocks,
+             size_t number_of_blocks )
+{
+	uint32_t schedule[ 80 ];
+
+	uint32_t a           = 0;
+	uint32_t b           = 0;
+	uint32_t c           = 0;
+	uint32_t d           = 0;
+	uint32_t e           = 0;
+	uint32_t round_value = 0;
+	int round_index      = 0;
+
+	while( number_of_blocks > 0 )
+	{
+		for( round_index = 0;
+		     round_index < 16;
+		     round_index++ )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( blocks[ round_index * 4 ] ),
+			 schedule[ round_index ] );
+		}
+		for( round_index = 16;
+		     round_index < 80;
+		     round_index++ )
+		{
+			round_value = schedule[ round_index - 3 ]
+			            ^ schedule[ round_index - 8 ]
+			            ^ schedule[ round_index - 14 ]
+			            ^ schedule[ round_index - 16 ];
+
+			schedule[ round_index ] = digest_engine_rotate_left( round_value, 1 );
+		}
+		a = hash_values[ 0 ];
+		b = hash_values[ 1 ];
+		c = hash_values[ 2 ];
+		d = hash_values[ 3 ];
+		e = hash_values[ 4 ];
+
+		for( round_index = 0;
+		     round_index < 20;
+		     round_index++ )
+		{
+			digest_engine_sha1_round(
+			 ( b & c ) | ( ~b & d ),
+			 0x5a827999UL );
+		}
+		for( round_index = 20;
+		     round_index < 40;
+		     round_index++ )
+		{
+			digest_engine_sha1_round(
+			 b ^ c ^ d,
+			 0x6ed9eba1UL );
+		}
+		for( round_index = 40;
+		     round_index < 60;
+		     round_index++ )
+		{
+			digest_engine_sha1_round(
+			 ( b & c ) | ( b & d ) | ( c & d ),
+			 0x8f1bbcdcUL );
+		}
+		for( round_index = 60;
+		     round_index < 80;
+		     round_index++ )
+		{
+			digest_engine_sha1_round(
+			 b ^ c ^ d,
+			 0xca62c1d6UL );
+		}
+		hash_values[ 0 ] += a;
+		hash_values[ 1 ] += b;
+		hash_values[ 2 ] += c;
+		hash_values[ 3 ] += d;
+		hash_values[ 4 ] += e;
+
+		blocks           += DIGEST_ENGINE_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+}
+
+/* Calculates the SHA256 of 64 byte blocks
+ */
+static void digest_engine_sha256_process_blocks(
+             uint32_t *hash_values,
+             const uint8_t *blocks,
+             size_t number_of_blocks )
+{
+	uint32_t schedule[ 64 ];
+	uint32_t state[ 8 ];
+
+	uint32_t sigma0      = 0;
+	uint32_t sigma1      = 0;
+	uint32_t round_value = 0;
+	int round_index      = 0;
+	int value_index      = 0;
+
+	while( number_of_blocks > 0 )
+	{
+		for( round_index = 0;
+		     round_index < 16;
+		     round_index++ )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( blocks[ round_index * 4 ] ),
+			 schedule[ round_index ] );
+		}
+		for( round_index = 16;
+		     round_index < 64;
+		     round_index++ )
+		{
+			sigma0 = digest_engine_rotate_right( schedule[ round_index - 15 ], 7 )
+			       ^ digest_engine_rotate_right( schedule[ round_index - 15 ], 18 )
+			       ^ ( schedule[ round_index - 15 ] >> 3 );
+
+			sigma1 = digest_engine_rotate_right( schedule[ round_index - 2 ], 17 )
+			       ^ digest_engine_rotate_right( schedule[ round_index - 2 ], 19 )
+			       ^ ( schedule[ round_index - 2 ] >> 10 );
+
+			schedule[ round_index ] = schedule[ round_index - 16 ] + sigma0 + schedule[ round_index - 7 ] + sigma1;
+		}
+		for( value_index = 0;
+		     value_index < 8;
+		     value_index++ )
+		{
+			state[ value_index ] = hash_values[ value_index ];
+		}
+		for( round_index = 0;
+		     round_index < 64;
+		     round_index++ )
+		{
+			sigma1 = digest_engine_rotate_right( state[ 4 ], 6 )
+			       ^ digest_engine_rotate_right( state[ 4 ], 11 )
+			       ^ digest_engine_rotate_right( state[ 4 ], 25 );
+
+			round_value = state[ 7 ]
+			            + sigma1
+			            + ( ( state[ 4 ] & state[ 5 ] ) ^ ( ~state[ 4 ] & state[ 6 ] ) )
+			            + digest_engine_sha256_constants[ round_index ]
+			            + schedule[ round_index ];
+
+			sigma0 = digest_engine_rotate_right( state[ 0 ], 2 )
+			       ^ digest_engine_rotate_right( state[ 0 ], 13 )
+			       ^ digest_engine_rotate_right( state[ 0 ], 22 );
+
+			sigma0 += ( state[ 0 ] & state[ 1 ] ) ^ ( state[ 0 ] & state[ 2 ] ) ^ ( state[ 1 ] & state[ 2 ] );
+
+			state[ 7 ] = state[ 6 ];
+			state[ 6 ] = state[ 5 ];
+			state[ 5 ] = state[ 4 ];
+			state[ 4 ] = state[ 3 ] + round_value;
+			state[ 3 ] = state[ 2 ];
+			state[ 2 ] = state[ 1 ];
+			state[ 1 ] = state[ 0 ];
+			state[ 0 ] = round_value + sigma0;
+		}
+		for( value_index = 0;
+		     value_index < 8;
+		     value_index++ )
+		{
+			hash_values[ value_index ] += state[ value_index ];
+		}
+		blocks           += DIGEST_ENGINE_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+}
+
+/* The BLAKE3 initialization vector, which is the same as the initial SHA256 hash values
+ */
+static const uint32_t digest_engine_blake3_initialization_vector[ 8 ] = {
+	0x6a09e667UL, 0xbb67ae85UL, 0x3c6ef372UL, 0xa54ff53aUL, 0x510e527fUL, 0x9b05688cUL, 0x1f83d9abUL, 0x5be0cd19UL };
+
+/* The BLAKE3 message word schedule of every round
+ */
+static const uint8_t digest_engine_blake3_message_schedule[ 7 ][ 16 ] = {
+	{  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+	{  2,  6,  3, 10,  7,  0,  4, 13,  1, 11, 12,  5,  9, 14, 15,  8 },
+	{  3,  4, 10, 12, 13,  2,  7, 14,  6,  5,  9,  0, 11, 15,  8,  1 },
+	{ 10,  7, 12,  9, 14,  3, 13, 15,  4,  0, 11,  2,  5,  8,  1,  6 },
+	{ 12, 13,  9, 11, 15, 10, 14,  8,  7,  2,  5,  3,  0,  1,  6,  4 },
+	{  9, 14, 11,  5,  8, 12, 15,  1, 13,  3,  0, 10,  2,  6,  4,  7 },
+	{ 11, 15,  5,  0,  1,  9,  8,  6, 14, 10,  2, 12,  3,  4,  7, 13 } };
+
+#define digest_engine_blake3_rotate_right( value, number_of_bits ) \
+	( ( (value) >> (number_of_bits) ) | ( (value) << ( 32 - (number_of_bits) ) ) )
+
+/* The BLAKE3 quarter-round mixing function
+ */
+#define digest_engine_blake3_mix( state, index_a, index_b, index_c, index_d, message_word1, message_word2 ) \
+	state[ index_a ] = state[ index_a ] + state[ index_b ] + message_word1; \
+	state[ index_d ] = digest_engine_blake3_rotate_right( state[ index_d ] ^ state[ index_a ], 16 ); \
+	state[ index_c ] = state[ index_c ] + state[ index_d ]; \
+	state[ index_b ] = digest_engine_blake3_rotate_right( state[ index_b ] ^ state[ index_c ], 12 ); \
+	state[ index_a ] = state[ index_a ] + state[ index_b ] + message_word2; \
+	state[ index_d ] = digest_engine_blake3_rotate_right( state[ index_d ] ^ state[ index_a ], 8 ); \
+	state[ index_c ] = state[ index_c ] + state[ index_d ]; \
+	state[ index_b ] = digest_engine_blake3_rotate_right( state[ index_b ] ^ state[ index_c ], 7 );
+
+/* Calculates the BLAKE3 compression function
+ */
+static void digest_engine_blake3_compress(
+             const uint32_t *chaining_value,
+             const uint32_t *block_words,
+             uint64_t counter,
+             uint32_t block_size,
+             uint32_t flags,
+             uint32_t *output_words )
+{
+	uint32_t state[ 16 ];
+
+	const uint8_t *schedule = NULL;
+	int round_index         = 0;
+	int word_index          = 0;
+
+	for( word_index = 0;
+	     word_index < 8;
+	     word_index++ )
+	{
+		state[ word_index ] = chaining_value[ word_index ];
+	}
+	state[ 8 ]  = digest_engine_blake3_initialization_vector[ 0 ];
+	state[ 9 ]  = digest_engine_blake3_initialization_vector[ 1 ];
+	state[ 10 ] = digest_engine_blake3_initialization_vector[ 2 ];
+	state[ 11 ] = digest_engine_blake3_initialization_vector[ 3 ];
+	state[ 12 ] = (uint32_t) ( counter & 0xffffffffUL );
+	state[ 13 ] = (uint32_t) ( counter >> 32 );
+	state[ 14 ] = block_size;
+	state[ 15 ] = flags;
+
+	for( round_index = 0;
+	     round_index < 7;
+	     round_index++ )
+	{
+		schedule = digest_engine_blake3_message_schedule[ round_index ];
+
+		digest_engine_blake3_mix( state, 0, 4, 8, 12, block_words[ schedule[ 0 ] ], block_words[ schedule[ 1 ] ] )
+		digest_engine_blake3_mix( state, 1, 5, 9, 13, block_words[ schedule[ 2 ] ], block_words[ schedule[ 3 ] ] )
+		digest_engine_blake3_mix( state, 2, 6, 10, 14, block_words[ schedule[ 4 ] ], block_words[ schedule[ 5 ] ] )
+		digest_engine_blake3_mix( state, 3, 7, 11, 15, block_words[ schedule[ 6 ] ], block_words[ schedule[ 7 ] ] )
+
+		digest_engine_blake3_mix( state, 0, 5, 10, 15, block_words[ schedule[ 8 ] ], block_words[ schedule[ 9 ] ] )
+		digest_engine_blake3_mix( state, 1, 6, 11, 12, block_words[ schedule[ 10 ] ], block_words[ schedule[ 11 ] ] )
+		digest_engine_blake3_mix( state, 2, 7, 8, 13, block_words[ schedule[ 12 ] ], block_words[ schedule[ 13 ] ] )
+		digest_engine_blake3_mix( state, 3, 4, 9, 14, block_words[ schedule[ 14 ] ], block_words[ schedule[ 15 ] ] )
+	}
+	for( word_index = 0;
+	     word_index < 8;
+	     word_index++ )
+	{
+		output_words[ word_index ]     = state[ word_index ] ^ state[ word_index + 8 ];
+		output_words[ word_index + 8 ] = state[ word_index + 8 ] ^ chaining_value[ word_index ];
+	}
+}
+
+/* Copies a 64 byte block to little-endian words
+ */
+static void digest_engine_blake3_copy_block_to_words(
+             const uint8_t *block,
+             uint32_t *block_words )
+{
+	int word_index = 0;
+
+	for( word_index = 0;
+	     word_index < 16;
+	     word_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( block[ word_index * 4 ] ),
+		 block_words[ word_index ] );
+	}
+}
+
+/* Retrieves the (non-root) chaining value of a BLAKE3 output
+ */
+static void digest_engine_blake3_output_get_chaining_value(
+             digest_engine_blake3_output_t *output,
+             uint32_t *chaining_value )
+{
+	uint32_t output_words[ 16 ];
+
+	digest_engine_blake3_compress(
+	 output->chaining_value,
+	 output->block_words,
+	 output->counter,
+	 output->block_size,
+	 output->flags,
+	 output_words );
+
+	memory_copy(
+	 chaining_value,
+	 output_words,
+	 sizeof( uint32_t ) * 8 );
+}
+
+/* Sets a BLAKE3 output to the parent node of two chaining values
+ */
+static void digest_engine_blake3_output_set_parent_node(
+             digest_engine_blake3_output_t *output,
+             const uint32_t *left_chaining_value,
+             const uint32_t *right_chaining_value )
+{
+	memory_copy(
+	 output->chaining_value,
+	 digest_engine_blake3_initialization_vector,
+	 sizeof( uint32_t ) * 8 );
+
+	memory_copy(
+	 output->block_words,
+	 left_chaining_value,
+	 sizeof( uint32_t ) * 8 );
+
+	memory_copy(
+	 &( output->block_words[ 8 ] ),
+	 right_chaining_value,
+	 sizeof( uint32_t ) * 8 );
+
+	output->counter    = 0;
+	output->block_size = DIGEST_ENGINE_BLOCK_SIZE;
+	output->flags      = DIGEST_ENGINE_BLAKE3_FLAG_PARENT;
+}
+
+/* Initializes a BLAKE3 chunk state
+ */
+static void digest_engine_blake3_chunk_state_initialize(
+             digest_engine_blake3_chunk_state_t *chunk_state,
+             uint64_t chunk_counter )
+{
+	memory_copy(
+	 chunk_state->chaining_value,
+	 digest_engine_blake3_initialization_vector,
+	 sizeof( uint32_t ) * 8 );
+
+	chunk_state->chunk_counter               = chunk_counter;
+	chunk_state->block_size                  = 0;
+	chunk_state->number_of_compressed_blocks = 0;
+}
+
+/* Retrieves the number of bytes in a BLAKE3 chunk state
+ */
+static size_t digest_engine_blake3_chunk_state_get_size(
+               digest_engine_blake3_chunk_state_t *chunk_state )
+{
+	return( ( (size_t) chunk_state->number_of_compressed_blocks * DIGEST_ENGINE_BLOCK_SIZE ) + chunk_state->block_size );
+}
+
+/* Updates a BLAKE3 chunk state
+ * The size should not exceed the remaining size of the chunk
+ */
+static void digest_engine_blake3_chunk_state_update(
+             digest_engine_blake3_chunk_state_t *chunk_state,
+             const uint8_t *buffer,
+             size_t size )
+{
+	uint32_t block_words[ 16 ];
+	uint32_t output_words[ 16 ];
+
+	size_t read_size = 0;
+	uint32_t flags   = 0;
+
+	while( size > 0 )
+	{
+		/* A full block is only compressed when more data follows
+		 * since the last block of the chunk requires the chunk end flag
+		 */
+		if( chunk_state->block_size == DIGEST_ENGINE_BLOCK_SIZE )
+		{
+			flags = 0;
+
+			if( chunk_state->number_of_compressed_blocks == 0 )
+			{
+				flags = DIGEST_ENGINE_BLAKE3_FLAG_CHUNK_START;
+			}
+			digest_engine_blake3_copy_block_to_words(
+			 chunk_state->block,
+			 block_words );
+
+			digest_engine_blake3_compress(
+			 chunk_state->chaining_value,
+			 block_words,
+			 chunk_state->chunk_counter,
+			 DIGEST_ENGINE_BLOCK_SIZE,
+			 flags,
+			 output_words );
+
+			memory_copy(
+			 chunk_state->chaining_value,
+			 output_words,
+			 sizeof( uint32_t ) * 8 );
+
+			chunk_state->number_of_compressed_blocks += 1;
+			chunk_state->block_size                   = 0;
+		}
+		read_size = DIGEST_ENGINE_BLOCK_SIZE - chunk_state->block_size;
+
+		if( read_size > size )
+		{
+			read_size = size;
+		}
+		memory_copy(
+		 &( chunk_state->block[ chunk_state->block_size ] ),
+		 buffer,
+		 read_size );
+
+		chunk_state->block_size += read_size;
+		buffer                  += read_size;
+		size                    -= read_size;
+	}
+}
+
+/* Retrieves the output of a BLAKE3 chunk state
+ */
+static void digest_engine_blake3_chunk_state_get_output(
+             digest_engine_blake3_chunk_state_t *chunk_state,
+             digest_engine_blake3_output_t *output )
+{
+	/* The remainder of the last block is padded with zero bytes
+	 */
+	memory_set(
+	 &( chunk_state->block[ chunk_state->block_size ] ),
+	 0,
+	 DIGEST_ENGINE_BLOCK_SIZE - chunk_state->block_size );
+
+	memory_copy(
+	 output->chaining_value,
+	 chunk_state->chaining_value,
+	 sizeof( uint32_t ) * 8 );
+
+	digest_engine_blake3_copy_block_to_words(
+	 chunk_state->block,
+	 output->block_words );
+
+	output->counter    = chunk_state->chunk_counter;
+	output->block_size = (uint32_t) chunk_state->block_size;
+	output->flags      = DIGEST_ENGINE_BLAKE3_FLAG_CHUNK_END;
+
+	if( chunk_state->number_of_compressed_blocks == 0 )
+	{
+		output->flags |= DIGEST_ENGINE_BLAKE3_FLAG_CHUNK_START;
+	}
+}
+
+/* Merges the chaining values on the BLAKE3 stack
+ * The chaining values are merged lazily, only when more data follows,
+ * since the last merge of the tree requires the root flag
+ */
+static void digest_engine_blake3_merge_stack(
+             digest_engine_blake3_context_t *context,
+             uint64_t number_of_chunks )
+{
+	digest_engine_blake3_output_t output;
+
+	int stack_depth = 0;
+
+	/* After merging the stack contains a subtree for every bit set in the number of chunks
+	 */
+	while( number_of_chunks > 0 )
+	{
+		stack_depth      += (int) ( number_of_chunks & 1 );
+		number_of_chunks >>= 1;
+	}
+	while( context->stack_depth > stack_depth )
+	{
+		digest_engine_blake3_output_set_parent_node(
+		 &output,
+		 context->stack[ context->stack_depth - 2 ],
+		 context->stack[ context->stack_depth - 1 ] );
+
+		digest_engine_blake3_output_get_chaining_value(
+		 &output,
+		 context->stack[ context->stack_depth - 2 ] );
+
+		context->stack_depth -= 1;
+	}
+}
+
+/* Pushes a chaining value onto the BLAKE3 stack
+ */
+static void digest_engine_blake3_push_chaining_value(
+             digest_engine_blake3_context_t *context,
+             const uint32_t *chaining_value,
+             uint64_t number_of_chunks )
+{
+	digest_engine_blake3_merge_stack(
+	 context,
+	 number_of_chunks );
+
+	memory_copy(
+	 context->stack[ context->stack_depth ],
+	 chaining_value,
+	 sizeof( uint32_t ) * 8 );
+
+	context->stack_depth += 1;
+}
+
+/* Determines the digest hashes that can be calculated by the hardware
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_get_hardware_flags(
+     uint8_t *hardware_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_get_hardware_flags";
+
+#if defined( HAVE_DIGEST_ENGINE_X86_SHA_EXTENSIONS )
+	unsigned int eax      = 0;
+	unsigned int ebx      = 0;
+	unsigned int ecx      = 0;
+	unsigned int edx      = 0;
+#endif
+#if defined( HAVE_DIGEST_ENGINE_ARM_SHA_EXTENSIONS ) && defined( __linux__ ) \
+ && !defined( __ARM_FEATURE_CRYPTO ) && !defined( __ARM_FEATURE_SHA2 )
+	unsigned long hwcap   = 0;
+#endif
+
+	if( hardware_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hardware flags.",
+		 function );
+
+		return( -1 );
+	}
+	*hardware_flags = 0;
+
+#if defined( HAVE_DIGEST_ENGINE_X86_SHA_EXTENSIONS )
+	/* The SHA extensions are reported by CPUID leaf 7 EBX bit 29
+	 * the kernels also require SSSE3 (leaf 1 ECX bit 9) and SSE4.1 (leaf 1 ECX bit 19)
+	 */
+	if( __get_cpuid_max( 0, NULL ) >= 7 )
+	{
+		__cpuid( 1, eax, ebx, ecx, edx );
+
+		if( ( ( ecx & 0x00000200UL ) != 0 )
+		 && ( ( ecx & 0x00080000UL ) != 0 ) )
+		{
+			__cpuid_count( 7, 0, eax, ebx, ecx, edx );
+
+			if( ( ebx & 0x20000000UL ) != 0 )
+			{
+				*hardware_flags = DIGEST_ENGINE_HARDWARE_FLAG_SHA1 | DIGEST_ENGINE_HARDWARE_FLAG_SHA256;
+			}
+		}
+	}
+#endif
+#if defined( HAVE_DIGEST_ENGINE_ARM_SHA_EXTENSIONS )
+#if defined( __ARM_FEATURE_CRYPTO ) || defined( __ARM_FEATURE_SHA2 )
+	/* The build already requires the cryptographic extensions
+	 */
+	*hardware_flags = DIGEST_ENGINE_HARDWARE_FLAG_SHA1 | DIGEST_ENGINE_HARDWARE_FLAG_SHA256;
+
+#elif defined( __linux__ )
+	hwcap = getauxval(
+	         AT_HWCAP );
+
+	if( ( hwcap & HWCAP_SHA1 ) != 0 )
+	{
+		*hardware_flags |= DIGEST_ENGINE_HARDWARE_FLAG_SHA1;
+	}
+	if( ( hwcap & HWCAP_SHA2 ) != 0 )
+	{
+		*hardware_flags |= DIGEST_ENGINE_HARDWARE_FLAG_SHA256;
+	}
+#endif
+#endif /* defined( HAVE_DIGEST_ENGINE_ARM_SHA_EXTENSIONS ) */
+
+	return( 1 );
+}
+
+/* Calculates the hash of the 64 byte blocks in the buffer
+ * Remaining data is stored in the block until it is filled
+ */
+static void digest_engine_update_blocks(
+             uint32_t *hash_values,
+             uint8_t *block,
+             size_t *block_offset,
+             uint64_t *number_of_bytes,
+             const uint8_t *buffer,
+             size_t size,
+             void (*process_blocks)(
+                    uint32_t *hash_values,
+                    const uint8_t *blocks,
+                    size_t number_of_blocks ) )
+{
+	size_t number_of_blocks = 0;
+	size_t read_size        = 0;
+
+	*number_of_bytes += size;
+
+	if( *block_offset > 0 )
+	{
+		read_size = DIGEST_ENGINE_BLOCK_SIZE - *block_offset;
+
+		if( read_size > size )
+		{
+			read_size = size;
+		}
+		memory_copy(
+		 &( block[ *block_offset ] ),
+		 buffer,
+		 read_size );
+
+		*block_offset += read_size;
+		buffer        += read_size;
+		size          -= read_size;
+
+		if( *block_offset < DIGEST_ENGINE_BLOCK_SIZE )
+		{
+			return;
+		}
+		process_blocks(
+		 hash_values,
+		 block,
+		 1 );
+
+		*block_offset = 0;
+	}
+	number_of_blocks = size / DIGEST_ENGINE_BLOCK_SIZE;
+
+	if( number_of_blocks > 0 )
+	{
+		process_blocks(
+		 hash_values,
+		 buffer,
+		 number_of_blocks );
+
+		buffer += number_of_blocks * DIGEST_ENGINE_BLOCK_SIZE;
+		size   -= number_of_blocks * DIGEST_ENGINE_BLOCK_SIZE;
+	}
+	if( size > 0 )
+	{
+		memory_copy(
+		 block,
+		 buffer,
+		 size );
+
+		*block_offset = size;
+	}
+}
+
+/* Pads the remaining data in the block and calculates the final hash values
+ */
+static void digest_engine_finalize_blocks(
+             uint32_t *hash_values,
+             uint8_t *block,
+             size_t block_offset,
+             uint64_t number_of_bytes,
+             uint8_t byte_order,
+             void (*process_blocks)(
+                    uint32_t *hash_values,
+                    const uint8_t *blocks,
+                    size_t number_of_blocks ) )
+{
+	block[ block_offset++ ] = 0x80;
+
+	/* The bit size is stored in the last 8 bytes of the last block
+	 * in big-endian for SHA1 and SHA256 and in little-endian for MD5
+	 */
+	if( block_offset > ( DIGEST_ENGINE_BLOCK_SIZE - 8 ) )
+	{
+		memory_set(
+		 &( block[ block_offset ] ),
+		 0,
+		 DIGEST_ENGINE_BLOCK_SIZE - block_offset );
+
+		process_blocks(
+		 hash_values,
+		 block,
+		 1 );
+
+		block_offset = 0;
+	}
+	memory_set(
+	 &( block[ block_offset ] ),
+	 0,
+	 ( DIGEST_ENGINE_BLOCK_SIZE - 8 ) - block_offset );
+
+	if( byte_order == _BYTE_STREAM_ENDIAN_BIG )
+	{
+		byte_stream_copy_from_uint64_big_endian(
+		 &( block[ DIGEST_ENGINE_BLOCK_SIZE - 8 ] ),
+		 number_of_bytes * 8 );
+	}
+	else
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( block[ DIGEST_ENGINE_BLOCK_SIZE - 8 ] ),
+		 number_of_bytes * 8 );
+	}
+
+	process_blocks(
+	 hash_values,
+	 block,
+	 1 );
+}
+
+/* Copies the state of a 64 byte block based hash to a byte stream
+ * The state consists of the number of bytes hashed, the hash values and the block
+ */
+static void digest_engine_export_blocks_state(
+             const uint32_t *hash_values,
+             int number_of_hash_values,
+             const uint8_t *block,
+             size_t block_offset,
+             uint64_t number_of_bytes,
+             uint8_t *state )
+{
+	int value_index = 0;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 state,
+	 number_of_bytes );
+
+	state += 8;
+
+	for( value_index = 0;
+	     value_index < number_of_hash_values;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 state,
+		 hash_values[ value_index ] );
+
+		state += 4;
+	}
+	memory_set(
+	 state,
+	 0,
+	 DIGEST_ENGINE_BLOCK_SIZE );
+
+	if( block_offset > 0 )
+	{
+		memory_copy(
+		 state,
+		 block,
+		 block_offset );
+	}
+}
+
+/* Copies the state of a 64 byte block based hash from a byte stream
+ */
+static void digest_engine_import_blocks_state(
+             uint32_t *hash_values,
+             int number_of_hash_values,
+             uint8_t *block,
+             size_t *block_offset,
+             uint64_t *number_of_bytes,
+             const uint8_t *state )
+{
+	int value_index = 0;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 state,
+	 *number_of_bytes );
+
+	state += 8;
+
+	for( value_index = 0;
+	     value_index < number_of_hash_values;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 state,
+		 hash_values[ value_index ] );
+
+		state += 4;
+	}
+	memory_copy(
+	 block,
+	 state,
+	 DIGEST_ENGINE_BLOCK_SIZE );
+
+	/* The block offset is implied by the number of bytes hashed
+	 */
+	*block_offset = (size_t) ( *number_of_bytes % DIGEST_ENGINE_BLOCK_SIZE );
+}
+
+/* Creates a MD5 context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_md5_initialize(
+     digest_engine_md5_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_md5_initialize";
+
+	if( digest_engine_md5_initialize_with_flags(
+	     context,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a MD5 context with flags
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+
+int digest_engine_md5_initialize_with_flags(
+     digest_engine_md5_context_t **context,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_md5_initialize_with_flags";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( DIGEST_ENGINE_FLAG_EXPORTABLE_STATE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            digest_engine_md5_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( digest_engine_md5_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		goto on_error;
+	}
+	( *context )->hash_values[ 0 ] = 0x67452301UL;
+	( *context )->hash_values[ 1 ] = 0xefcdab89UL;
+	( *context )->hash_values[ 2 ] = 0x98badcfeUL;
+	( *context )->hash_values[ 3 ] = 0x10325476UL;
+
+	/* There is no hardware support for MD5, libhmac is used unless
+	 * the state of the context needs to be exportable
+	 */
+	if( ( flags & DIGEST_ENGINE_FLAG_EXPORTABLE_STATE ) == 0 )
+	{
+		if( libhmac_md5_initialize(
+		     &( ( *context )->libhmac_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create libhmac MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a MD5 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_md5_free(
+     digest_engine_md5_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_md5_free";
+	int result            = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		if( ( *context )->libhmac_context != NULL )
+		{
+			if( libhmac_md5_free(
+			     &( ( *context )->libhmac_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free libhmac MD5 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The context can contain hashed data
+		 */
+		memory_set(
+		 *context,
+		 0,
+		 sizeof( digest_engine_md5_context_t ) );
+
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( result );
+}
+
+/* Updates the MD5 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_md5_update(
+     digest_engine_md5_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_md5_update";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->libhmac_context != NULL )
+	{
+		if( libhmac_md5_update(
+		     context->libhmac_context,
+		     buffer,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update libhmac MD5 context.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	digest_engine_update_blocks(
+	 context->hash_values,
+	 context->block,
+	 &( context->block_offset ),
+	 &( context->number_of_bytes ),
+	 buffer,
+	 size,
+	 &digest_engine_md5_process_blocks );
+
+	return( 1 );
+}
+
+/* Finalizes the MD5 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_md5_finalize(
+     digest_engine_md5_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_md5_finalize";
+	int value_index       = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_size < (size_t) DIGEST_ENGINE_MD5_HASH_SIZE )
+	 || ( hash_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->libhmac_context != NULL )
+	{
+		if( libhmac_md5_finalize(
+		     context->libhmac_context,
+		     hash,
+		     hash_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to finalize libhmac MD5 context.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	digest_engine_finalize_blocks(
+	 context->hash_values,
+	 context->block,
+	 context->block_offset,
+	 context->number_of_bytes,
+	 _BYTE_STREAM_ENDIAN_LITTLE,
+	 &digest_engine_md5_process_blocks );
+
+	for( value_index = 0;
+	     value_index < 4;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( hash[ value_index * 4 ] ),
+		 context->hash_values[ value_index ] );
+	}
+	return( 1 );
+}
+
+/* Exports the state of the MD5 context
+ * The state can be imported by digest_engine_md5_import_state to continue hashing
+ * The context must be created with the DIGEST_ENGINE_FLAG_EXPORTABLE_STATE flag
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_md5_export_state(
+     digest_engine_md5_context_t *context,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_md5_export_state";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->libhmac_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid context - state is not exportable.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( state_size < (size_t) DIGEST_ENGINE_MD5_STATE_SIZE )
+	 || ( state_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	digest_engine_export_blocks_state(
+	 context->hash_values,
+	 4,
+	 context->block,
+	 context->block_offset,
+	 context->number_of_bytes,
+	 state );
+
+	return( 1 );
+}
+
+/* Imports the state of the MD5 context
+ * The context must be created with the DIGEST_ENGINE_FLAG_EXPORTABLE_STATE flag
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_md5_import_state(
+     digest_engine_md5_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_md5_import_state";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->libhmac_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid context - state is not exportable.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( state_size < (size_t) DIGEST_ENGINE_MD5_STATE_SIZE )
+	 || ( state_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	digest_engine_import_blocks_state(
+	 context->hash_values,
+	 4,
+	 context->block,
+	 &( context->block_offset ),
+	 &( context->number_of_bytes ),
+	 state );
+
+	return( 1 );
+}
+
+/* Creates a SHA1 context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_sha1_initialize(
+     digest_engine_sha1_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_sha1_initialize";
+
+	if( digest_engine_sha1_initialize_with_flags(
+	     context,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a SHA1 context with flags
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+
+int digest_engine_sha1_initialize_with_flags(
+     digest_engine_sha1_context_t **context,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function  = "digest_engine_sha1_initialize_with_flags";
+	uint8_t hardware_flags = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( DIGEST_ENGINE_FLAG_EXPORTABLE_STATE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( digest_engine_get_hardware_flags(
+	     &hardware_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hardware flags.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            digest_engine_sha1_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( digest_engine_sha1_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		goto on_error;
+	}
+	( *context )->hash_values[ 0 ] = 0x67452301UL;
+	( *context )->hash_values[ 1 ] = 0xefcdab89UL;
+	( *context )->hash_values[ 2 ] = 0x98badcfeUL;
+	( *context )->hash_values[ 3 ] = 0x10325476UL;
+	( *context )->hash_values[ 4 ] = 0xc3d2e1f0UL;
+
+#if defined( HAVE_DIGEST_ENGINE_X86_SHA_EXTENSIONS )
+	if( ( hardware_flags & DIGEST_ENGINE_HARDWARE_FLAG_SHA1 ) != 0 )
+	{
+		( *context )->process_blocks = &digest_engine_sha1_process_blocks_x86;
+	}
+	else
+#endif
+#if defined( HAVE_DIGEST_ENGINE_ARM_SHA_EXTENSIONS )
+	if( ( hardware_flags & DIGEST_ENGINE_HARDWARE_FLAG_SHA1 ) != 0 )
+	{
+		( *context )->process_blocks = &digest_engine_sha1_process_blocks_arm;
+	}
+	else
+#endif
+	{
+		( *context )->process_blocks = &digest_engine_sha1_process_blocks;
+	}
+	/* Without hardware support libhmac is used unless
+	 * the state of the context needs to be exportable
+	 */
+	if( ( ( *context )->process_blocks == &digest_engine_sha1_process_blocks )
+	 && ( ( flags & DIGEST_ENGINE_FLAG_EXPORTABLE_STATE ) == 0 ) )
+	{
+		if( libhmac_sha1_initialize(
+		     &( ( *context )->libhmac_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create libhmac SHA1 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a SHA1 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_sha1_free(
+     digest_engine_sha1_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_sha1_free";
+	int result            = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		if( ( *context )->libhmac_context != NULL )
+		{
+			if( libhmac_sha1_free(
+			     &( ( *context )->libhmac_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free libhmac SHA1 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The context can contain hashed data
+		 */
+		memory_set(
+		 *context,
+		 0,
+		 sizeof( digest_engine_sha1_context_t ) );
+
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( result );
+}
+
+/* Updates the SHA1 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_sha1_update(
+     digest_engine_sha1_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_sha1_update";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->libhmac_context != NULL )
+	{
+		if( libhmac_sha1_update(
+		     context->libhmac_context,
+		     buffer,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update libhmac SHA1 context.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	digest_engine_update_blocks(
+	 context->hash_values,
+	 context->block,
+	 &( context->block_offset ),
+	 &( context->number_of_bytes ),
+	 buffer,
+	 size,
+	 context->process_blocks );
+
+	return( 1 );
+}
+
+/* Finalizes the SHA1 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_sha1_finalize(
+     digest_engine_sha1_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_sha1_finalize";
+	int value_index       = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_size < (size_t) DIGEST_ENGINE_SHA1_HASH_SIZE )
+	 || ( hash_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->libhmac_context != NULL )
+	{
+		if( libhmac_sha1_finalize(
+		     context->libhmac_context,
+		     hash,
+		     hash_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to finalize libhmac SHA1 context.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	digest_engine_finalize_blocks(
+	 context->hash_values,
+	 context->block,
+	 context->block_offset,
+	 context->number_of_bytes,
+	 _BYTE_STREAM_ENDIAN_BIG,
+	 context->process_blocks );
+
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ value_index * 4 ] ),
+		 context->hash_values[ value_index ] );
+	}
+	return( 1 );
+}
+
+/* Exports the state of the SHA1 context
+ * The state can be imported by digest_engine_sha1_import_state to continue hashing
+ * The context must be created with the DIGEST_ENGINE_FLAG_EXPORTABLE_STATE flag
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_sha1_export_state(
+     digest_engine_sha1_context_t *context,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_sha1_export_state";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->libhmac_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid context - state is not exportable.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( state_size < (size_t) DIGEST_ENGINE_SHA1_STATE_SIZE )
+	 || ( state_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	digest_engine_export_blocks_state(
+	 context->hash_values,
+	 5,
+	 context->block,
+	 context->block_offset,
+	 context->number_of_bytes,
+	 state );
+
+	return( 1 );
+}
+
+/* Imports the state of the SHA1 context
+ * The context must be created with the DIGEST_ENGINE_FLAG_EXPORTABLE_STATE flag
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_sha1_import_state(
+     digest_engine_sha1_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_sha1_import_state";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->libhmac_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid context - state is not exportable.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( state_size < (size_t) DIGEST_ENGINE_SHA1_STATE_SIZE )
+	 || ( state_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	digest_engine_import_blocks_state(
+	 context->hash_values,
+	 5,
+	 context->block,
+	 &( context->block_offset ),
+	 &( context->number_of_bytes ),
+	 state );
+
+	return( 1 );
+}
+
+/* Creates a SHA256 context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_sha256_initialize(
+     digest_engine_sha256_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_sha256_initialize";
+
+	if( digest_engine_sha256_initialize_with_flags(
+	     context,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a SHA256 context with flags
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+
+int digest_engine_sha256_initialize_with_flags(
+     digest_engine_sha256_context_t **context,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function  = "digest_engine_sha256_initialize_with_flags";
+	uint8_t hardware_flags = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( DIGEST_ENGINE_FLAG_EXPORTABLE_STATE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( digest_engine_get_hardware_flags(
+	     &hardware_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hardware flags.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            digest_engine_sha256_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( digest_engine_sha256_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		goto on_error;
+	}
+	( *context )->hash_values[ 0 ] = 0x6a09e667UL;
+	( *context )->hash_values[ 1 ] = 0xbb67ae85UL;
+	( *context )->hash_values[ 2 ] = 0x3c6ef372UL;
+	( *context )->hash_values[ 3 ] = 0xa54ff53aUL;
+	( *context )->hash_values[ 4 ] = 0x510e527fUL;
+	( *context )->hash_values[ 5 ] = 0x9b05688cUL;
+	( *context )->hash_values[ 6 ] = 0x1f83d9abUL;
+	( *context )->hash_values[ 7 ] = 0x5be0cd19UL;
+
+#if defined( HAVE_DIGEST_ENGINE_X86_SHA_EXTENSIONS )
+	if( ( hardware_flags & DIGEST_ENGINE_HARDWARE_FLAG_SHA256 ) != 0 )
+	{
+		( *context )->process_blocks = &digest_engine_sha256_process_blocks_x86;
+	}
+	else
+#endif
+#if defined( HAVE_DIGEST_ENGINE_ARM_SHA_EXTENSIONS )
+	if( ( hardware_flags & DIGEST_ENGINE_HARDWARE_FLAG_SHA256 ) != 0 )
+	{
+		( *context )->process_blocks = &digest_engine_sha256_process_blocks_arm;
+	}
+	else
+#endif
+	{
+		( *context )->process_blocks = &digest_engine_sha256_process_blocks;
+	}
+	/* Without hardware support libhmac is used unless
+	 * the state of the context needs to be exportable
+	 */
+	if( ( ( *context )->process_blocks == &digest_engine_sha256_process_blocks )
+	 && ( ( flags & DIGEST_ENGINE_FLAG_EXPORTABLE_STATE ) == 0 ) )
+	{
+		if( libhmac_sha256_initialize(
+		     &( ( *context )->libhmac_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create libhmac SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a SHA256 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_sha256_free(
+     digest_engine_sha256_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_sha256_free";
+	int result            = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		if( ( *context )->libhmac_context != NULL )
+		{
+			if( libhmac_sha256_free(
+			     &( ( *context )->libhmac_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free libhmac SHA256 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The context can contain hashed data
+		 */
+		memory_set(
+		 *context,
+		 0,
+		 sizeof( digest_engine_sha256_context_t ) );
+
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( result );
+}
+
+/* Updates the SHA256 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_sha256_update(
+     digest_engine_sha256_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_sha256_update";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->libhmac_context != NULL )
+	{
+		if( libhmac_sha256_update(
+		     context->libhmac_context,
+		     buffer,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update libhmac SHA256 context.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	digest_engine_update_blocks(
+	 context->hash_values,
+	 context->block,
+	 &( context->block_offset ),
+	 &( context->number_of_bytes ),
+	 buffer,
+	 size,
+	 context->process_blocks );
+
+	return( 1 );
+}
+
+/* Finalizes the SHA256 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_sha256_finalize(
+     digest_engine_sha256_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_sha256_finalize";
+	int value_index       = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_size < (size_t) DIGEST_ENGINE_SHA256_HASH_SIZE )
+	 || ( hash_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->libhmac_context != NULL )
+	{
+		if( libhmac_sha256_finalize(
+		     context->libhmac_context,
+		     hash,
+		     hash_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to finalize libhmac SHA256 context.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	digest_engine_finalize_blocks(
+	 context->hash_values,
+	 context->block,
+	 context->block_offset,
+	 context->number_of_bytes,
+	 _BYTE_STREAM_ENDIAN_BIG,
+	 context->process_blocks );
+
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ value_index * 4 ] ),
+		 context->hash_values[ value_index ] );
+	}
+	return( 1 );
+}
+
+/* Exports the state of the SHA256 context
+ * The state can be imported by digest_engine_sha256_import_state to continue hashing
+ * The context must be created with the DIGEST_ENGINE_FLAG_EXPORTABLE_STATE flag
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_sha256_export_state(
+     digest_engine_sha256_context_t *context,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_sha256_export_state";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->libhmac_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid context - state is not exportable.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( state_size < (size_t) DIGEST_ENGINE_SHA256_STATE_SIZE )
+	 || ( state_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	digest_engine_export_blocks_state(
+	 context->hash_values,
+	 8,
+	 context->block,
+	 context->block_offset,
+	 context->number_of_bytes,
+	 state );
+
+	return( 1 );
+}
+
+/* Imports the state of the SHA256 context
+ * The context must be created with the DIGEST_ENGINE_FLAG_EXPORTABLE_STATE flag
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_sha256_import_state(
+     digest_engine_sha256_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_sha256_import_state";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->libhmac_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid context - state is not exportable.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( state_size < (size_t) DIGEST_ENGINE_SHA256_STATE_SIZE )
+	 || ( state_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	digest_engine_import_blocks_state(
+	 context->hash_values,
+	 8,
+	 context->block,
+	 &( context->block_offset ),
+	 &( context->number_of_bytes ),
+	 state );
+
+	return( 1 );
+}
+
+/* Creates a BLAKE3 context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_blake3_initialize(
+     digest_engine_blake3_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_blake3_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            digest_engine_blake3_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( digest_engine_blake3_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		goto on_error;
+	}
+	digest_engine_blake3_chunk_state_initialize(
+	 &( ( *context )->chunk_state ),
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a BLAKE3 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_blake3_free(
+     digest_engine_blake3_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_blake3_free";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		/* The context can contain hashed data
+		 */
+		memory_set(
+		 *context,
+		 0,
+		 sizeof( digest_engine_blake3_context_t ) );
+
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( 1 );
+}
+
+/* Updates the BLAKE3 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_blake3_update(
+     digest_engine_blake3_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	digest_engine_blake3_output_t output;
+
+	uint32_t chaining_value[ 8 ];
+
+	static char *function = "digest_engine_blake3_update";
+	size_t chunk_size     = 0;
+	size_t read_size      = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size > (size_t) SSIZE_MAX )
+	 || ( (uint64_t) size > ( (uint64_t) INT64_MAX - context->number_of_bytes ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	context->number_of_bytes += size;
+
+	while( size > 0 )
+	{
+		chunk_size = digest_engine_blake3_chunk_state_get_size(
+		              &( context->chunk_state ) );
+
+		/* A full chunk is only pushed onto the stack when more data follows
+		 * since the last chunk can be the root of the tree
+		 */
+		if( chunk_size == DIGEST_ENGINE_BLAKE3_CHUNK_SIZE )
+		{
+			digest_engine_blake3_chunk_state_get_output(
+			 &( context->chunk_state ),
+			 &output );
+
+			digest_engine_blake3_output_get_chaining_value(
+			 &output,
+			 chaining_value );
+
+			digest_engine_blake3_push_chaining_value(
+			 context,
+			 chaining_value,
+			 context->chunk_state.chunk_counter );
+
+			digest_engine_blake3_chunk_state_initialize(
+			 &( context->chunk_state ),
+			 context->chunk_state.chunk_counter + 1 );
+
+			chunk_size = 0;
+		}
+		/* Since data is added to the chunk state the subtrees before it cannot be the root
+		 */
+		if( chunk_size == 0 )
+		{
+			digest_engine_blake3_merge_stack(
+			 context,
+			 context->chunk_state.chunk_counter );
+		}
+		read_size = DIGEST_ENGINE_BLAKE3_CHUNK_SIZE - chunk_size;
+
+		if( read_size > size )
+		{
+			read_size = size;
+		}
+		digest_engine_blake3_chunk_state_update(
+		 &( context->chunk_state ),
+		 buffer,
+		 read_size );
+
+		buffer += read_size;
+		size   -= read_size;
+	}
+	return( 1 );
+}
+
+/* Updates the BLAKE3 context with the chaining value of a subtree
+ * The chaining value must be calculated by digest_engine_blake3_calculate_subtree_chaining_value
+ * with the number of bytes hashed by the context as offset
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_blake3_update_subtree(
+     digest_engine_blake3_context_t *context,
+     const uint8_t *chaining_value,
+     size_t chaining_value_size,
+     size_t size,
+     libcerror_error_t **error )
+{
+	digest_engine_blake3_output_t output;
+
+	uint32_t chaining_value_words[ 8 ];
+
+	static char *function     = "digest_engine_blake3_update_subtree";
+	uint64_t number_of_chunks = 0;
+	size_t chunk_size         = 0;
+	int word_index            = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( chaining_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chaining value.",
+		 function );
+
+		return( -1 );
+	}
+	if( chaining_value_size != 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chaining value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size > (size_t) SSIZE_MAX )
+	 || ( (uint64_t) size > ( (uint64_t) INT64_MAX - context->number_of_bytes ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_chunks = (uint64_t) size / DIGEST_ENGINE_BLAKE3_CHUNK_SIZE;
+
+	/* The subtree must consist of a power of 2 number of chunks and cannot be the first subtree
+	 * otherwise it could be the root of the tree
+	 */
+	if( ( number_of_chunks == 0 )
+	 || ( ( size % DIGEST_ENGINE_BLAKE3_CHUNK_SIZE ) != 0 )
+	 || ( ( number_of_chunks & ( number_of_chunks - 1 ) ) != 0 )
+	 || ( context->number_of_bytes == 0 )
+	 || ( ( context->number_of_bytes % size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported subtree size and offset.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_size = digest_engine_blake3_chunk_state_get_size(
+	              &( context->chunk_state ) );
+
+	if( chunk_size == DIGEST_ENGINE_BLAKE3_CHUNK_SIZE )
+	{
+		digest_engine_blake3_chunk_state_get_output(
+		 &( context->chunk_state ),
+		 &output );
+
+		digest_engine_blake3_output_get_chaining_value(
+		 &output,
+		 chaining_value_words );
+
+		digest_engine_blake3_push_chaining_value(
+		 context,
+		 chaining_value_words,
+		 context->chunk_state.chunk_counter );
+	}
+	else if( chunk_size != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid context - chunk state value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( word_index = 0;
+	     word_index < 8;
+	     word_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( chaining_value[ word_index * 4 ] ),
+		 chaining_value_words[ word_index ] );
+	}
+	digest_engine_blake3_push_chaining_value(
+	 context,
+	 chaining_value_words,
+	 context->number_of_bytes / DIGEST_ENGINE_BLAKE3_CHUNK_SIZE );
+
+	context->number_of_bytes += size;
+
+	digest_engine_blake3_chunk_state_initialize(
+	 &( context->chunk_state ),
+	 context->number_of_bytes / DIGEST_ENGINE_BLAKE3_CHUNK_SIZE );
+
+	return( 1 );
+}
+
+/* Finalizes the BLAKE3 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_blake3_finalize(
+     digest_engine_blake3_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	digest_engine_blake3_output_t output;
+
+	uint32_t chaining_value[ 8 ];
+	uint32_t output_words[ 16 ];
+
+	static char *function = "digest_engine_blake3_finalize";
+	int stack_depth       = 0;
+	int word_index        = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_size < (size_t) DIGEST_ENGINE_BLAKE3_HASH_SIZE )
+	 || ( hash_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	stack_depth = context->stack_depth;
+
+	/* If the data ends with a subtree the chunk state is empty
+	 * and the last 2 subtrees on the stack are merged instead
+	 */
+	if( ( stack_depth >= 2 )
+	 && ( digest_engine_blake3_chunk_state_get_size( &( context->chunk_state ) ) == 0 ) )
+	{
+		digest_engine_blake3_output_set_parent_node(
+		 &output,
+		 context->stack[ stack_depth - 2 ],
+		 context->stack[ stack_depth - 1 ] );
+
+		stack_depth -= 2;
+	}
+	else
+	{
+		digest_engine_blake3_chunk_state_get_output(
+		 &( context->chunk_state ),
+		 &output );
+	}
+	while( stack_depth > 0 )
+	{
+		digest_engine_blake3_output_get_chaining_value(
+		 &output,
+		 chaining_value );
+
+		stack_depth -= 1;
+
+		digest_engine_blake3_output_set_parent_node(
+		 &output,
+		 context->stack[ stack_depth ],
+		 chaining_value );
+	}
+	digest_engine_blake3_compress(
+	 output.chaining_value,
+	 output.block_words,
+	 0,
+	 output.block_size,
+	 output.flags | DIGEST_ENGINE_BLAKE3_FLAG_ROOT,
+	 output_words );
+
+	for( word_index = 0;
+	     word_index < 8;
+	     word_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( hash[ word_index * 4 ] ),
+		 output_words[ word_index ] );
+	}
+	return( 1 );
+}
+
+/* Calculates the BLAKE3 chaining value of a subtree
+ * The subtree can be calculated independently of the other data, e.g. on a thread pool
+ * and is added to the context with digest_engine_blake3_update_subtree
+ * Returns 1 if successful, 0 if the buffer cannot be hashed as a subtree or -1 on error
+ */
+int digest_engine_blake3_calculate_subtree_chaining_value(
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t offset,
+     uint8_t *chaining_value,
+     size_t chaining_value_size,
+     libcerror_error_t **error )
+{
+	digest_engine_blake3_chunk_state_t chunk_state;
+	digest_engine_blake3_output_t output;
+
+	uint32_t stack[ DIGEST_ENGINE_BLAKE3_MAXIMUM_STACK_DEPTH ][ 8 ];
+	uint32_t chunk_chaining_value[ 8 ];
+
+	static char *function     = "digest_engine_blake3_calculate_subtree_chaining_value";
+	uint64_t chunk_index      = 0;
+	uint64_t number_of_chunks = 0;
+	uint64_t merge_counter    = 0;
+	int stack_depth           = 0;
+	int word_index            = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid offset value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( chaining_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chaining value.",
+		 function );
+
+		return( -1 );
+	}
+	if( chaining_value_size != 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chaining value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_chunks = (uint64_t) size / DIGEST_ENGINE_BLAKE3_CHUNK_SIZE;
+
+	if( ( number_of_chunks == 0 )
+	 || ( ( size % DIGEST_ENGINE_BLAKE3_CHUNK_SIZE ) != 0 )
+	 || ( ( number_of_chunks & ( number_of_chunks - 1 ) ) != 0 )
+	 || ( offset == 0 )
+	 || ( ( offset % size ) != 0 ) )
+	{
+		return( 0 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		digest_engine_blake3_chunk_state_initialize(
+		 &chunk_state,
+		 ( offset / DIGEST_ENGINE_BLAKE3_CHUNK_SIZE ) + chunk_index );
+
+		digest_engine_blake3_chunk_state_update(
+		 &chunk_state,
+		 &( buffer[ chunk_index * DIGEST_ENGINE_BLAKE3_CHUNK_SIZE ] ),
+		 DIGEST_ENGINE_BLAKE3_CHUNK_SIZE );
+
+		digest_engine_blake3_chunk_state_get_output(
+		 &chunk_state,
+		 &output );
+
+		digest_engine_blake3_output_get_chaining_value(
+		 &output,
+		 chunk_chaining_value );
+
+		/* Since all the chunks of the subtree are available the chaining values
+		 * can be merged as soon as the corresponding subtrees are complete
+		 */
+		for( merge_counter = chunk_index + 1;
+		     ( merge_counter & 1 ) == 0;
+		     merge_counter >>= 1 )
+		{
+			stack_depth -= 1;
+
+			digest_engine_blake3_output_set_parent_node(
+			 &output,
+			 stack[ stack_depth ],
+			 chunk_chaining_value );
+
+			digest_engine_blake3_output_get_chaining_value(
+			 &output,
+			 chunk_chaining_value );
+		}
+		memory_copy(
+		 stack[ stack_depth ],
+		 chunk_chaining_value,
+		 sizeof( uint32_t ) * 8 );
+
+		stack_depth += 1;
+	}
+	for( word_index = 0;
+	     word_index < 8;
+	     word_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( chaining_value[ word_index * 4 ] ),
+		 stack[ 0 ][ word_index ] );
+	}
+	return( 1 );
+}
+
+/* Exports the state of the BLAKE3 context
+ * The state can be imported by digest_engine_blake3_import_state to continue hashing
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_blake3_export_state(
+     digest_engine_blake3_context_t *context,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_engine_blake3_export_state";
+	int stack_index       = 0;
+	int word_index        = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( state_size < (size_t) DIGEST_ENGINE_BLAKE3_STATE_SIZE )
+	 || ( state_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     state,
+	     0,
+	     DIGEST_ENGINE_BLAKE3_STATE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear state.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 &( state[ 0 ] ),
+	 context->number_of_bytes );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( state[ 8 ] ),
+	 context->chunk_state.chunk_counter );
+
+	for( word_index = 0;
+	     word_index < 8;
+	     word_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( state[ 16 + ( word_index * 4 ) ] ),
+		 context->chunk_state.chaining_value[ word_index ] );
+	}
+	if( memory_copy(
+	     &( state[ 48 ] ),
+	     context->chunk_state.block,
+	     context->chunk_state.block_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy chunk state block.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( state[ 112 ] ),
+	 (uint32_t) context->chunk_state.block_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( state[ 116 ] ),
+	 (uint32_t) context->chunk_state.number_of_compressed_blocks );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( state[ 120 ] ),
+	 (uint32_t) context->stack_depth );
+
+	for( stack_index = 0;
+	     stack_index < context->stack_depth;
+	     stack_index++ )
+	{
+		for( word_index = 0;
+		     word_index < 8;
+		     word_index++ )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( state[ 124 + ( stack_index * 32 ) + ( word_index * 4 ) ] ),
+			 context->stack[ stack_index ][ word_index ] );
+		}
+	}
+	return( 1 );
+}
+
+/* Imports the state of the BLAKE3 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_engine_blake3_import_state(
+     digest_engine_blake3_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error )
+{
+	static char *function                = "digest_engine_blake3_import_state";
+	uint32_t block_size                  = 0;
+	uint32_t number_of_compressed_blocks = 0;
+	uint32_t stack_depth                 = 0;
+	int stack_index                      = 0;
+	int word_index                       = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( state_size < (size_t) DIGEST_ENGINE_BLAKE3_STATE_SIZE )
+	 || ( state_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( state[ 112 ] ),
+	 block_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( state[ 116 ] ),
+	 number_of_compressed_blocks );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( state[ 120 ] ),
+	 stack_depth );
+
+	if( block_size > DIGEST_ENGINE_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk state block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_compressed_blocks > ( DIGEST_ENGINE_BLAKE3_CHUNK_SIZE / DIGEST_ENGINE_BLOCK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk state number of compressed blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( stack_depth > DIGEST_ENGINE_BLAKE3_MAXIMUM_STACK_DEPTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stack depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( state[ 0 ] ),
+	 context->number_of_bytes );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( state[ 8 ] ),
+	 context->chunk_state.chunk_counter );
+
+	for( word_index = 0;
+	     word_index < 8;
+	     word_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( state[ 16 + ( word_index * 4 ) ] ),
+		 context->chunk_state.chaining_value[ word_index ] );
+	}
+	if( memory_copy(
+	     context->chunk_state.block,
+	     &( state[ 48 ] ),
+	     DIGEST_ENGINE_BLOCK_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy chunk state block.",
+		 function );
+
+		return( -1 );
+	}
+	context->chunk_state.block_size                  = (size_t) block_size;
+	context->chunk_state.number_of_compressed_blocks = (uint8_t) number_of_compressed_blocks;
+	context->stack_depth                             = (int) stack_depth;
+
+	for( stack_index = 0;
+	     stack_index < context->stack_depth;
+	     stack_index++ )
+	{
+		for( word_index = 0;
+		     word_index < 8;
+		     word_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( state[ 124 + ( stack_index * 32 ) + ( word_index * 4 ) ] ),
+			 context->stack[ stack_index ][ word_index ] );
+		}
+	}
+	return( 1 );
+}
+
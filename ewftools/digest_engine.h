@@ -0,0 +1,447 @@
+/*
+ * Digest engine with hardware accelerated digest hash functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DIGEST_ENGINE_H )
+#define _DIGEST_ENGINE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libhmac.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Use the x86 SHA extensions (SHA-NI) if supported by the compiler
+ */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define HAVE_DIGEST_ENGINE_X86_SHA_EXTENSIONS	1
+#endif
+
+/* Use the ARMv8 cryptographic extensions if supported by the compiler
+ * GCC can build the kernels with a target attribute, clang needs the extensions
+ * to be enabled for the whole build, e.g. -march=armv8-a+crypto or on Apple silicon
+ */
+#if defined( __GNUC__ ) && defined( __aarch64__ ) \
+ && ( !defined( __clang__ ) || defined( __ARM_FEATURE_CRYPTO ) || defined( __ARM_FEATURE_SHA2 ) )
+#define HAVE_DIGEST_ENGINE_ARM_SHA_EXTENSIONS	1
+#endif
+
+/* The digest engine block size
+ */
+#define DIGEST_ENGINE_BLOCK_SIZE		64
+
+/* The MD5, SHA1 and SHA256 hash sizes
+ */
+#define DIGEST_ENGINE_MD5_HASH_SIZE		16
+#define DIGEST_ENGINE_SHA1_HASH_SIZE		20
+#define DIGEST_ENGINE_SHA256_HASH_SIZE		32
+
+/* The size of the exported MD5, SHA1 and SHA256 states
+ * which consist of the number of bytes hashed, the hash values and the block
+ */
+#define DIGEST_ENGINE_MD5_STATE_SIZE		( 8 + 16 + DIGEST_ENGINE_BLOCK_SIZE )
+#define DIGEST_ENGINE_SHA1_STATE_SIZE		( 8 + 20 + DIGEST_ENGINE_BLOCK_SIZE )
+#define DIGEST_ENGINE_SHA256_STATE_SIZE		( 8 + 32 + DIGEST_ENGINE_BLOCK_SIZE )
+
+/* The BLAKE3 chunk size
+ */
+#define DIGEST_ENGINE_BLAKE3_CHUNK_SIZE		1024
+
+/* The BLAKE3 hash size
+ */
+#define DIGEST_ENGINE_BLAKE3_HASH_SIZE		32
+
+/* The maximum number of chaining values on the BLAKE3 stack
+ * this allows for 2^54 chunks, which is the maximum input size of BLAKE3
+ */
+#define DIGEST_ENGINE_BLAKE3_MAXIMUM_STACK_DEPTH	54
+
+/* The size of the exported BLAKE3 state
+ * which consist of the number of bytes hashed, the chunk state and the chaining value stack
+ */
+#define DIGEST_ENGINE_BLAKE3_STATE_SIZE		( 8 + 8 + 32 + DIGEST_ENGINE_BLOCK_SIZE + 12 + ( DIGEST_ENGINE_BLAKE3_MAXIMUM_STACK_DEPTH * 32 ) )
+
+/* The BLAKE3 flags
+ */
+enum DIGEST_ENGINE_BLAKE3_FLAGS
+{
+	DIGEST_ENGINE_BLAKE3_FLAG_CHUNK_START	= 0x00000001UL,
+	DIGEST_ENGINE_BLAKE3_FLAG_CHUNK_END	= 0x00000002UL,
+	DIGEST_ENGINE_BLAKE3_FLAG_PARENT	= 0x00000004UL,
+	DIGEST_ENGINE_BLAKE3_FLAG_ROOT		= 0x00000008UL
+};
+
+/* The digest engine hardware flags
+ */
+enum DIGEST_ENGINE_HARDWARE_FLAGS
+{
+	DIGEST_ENGINE_HARDWARE_FLAG_SHA1	= 0x01,
+	DIGEST_ENGINE_HARDWARE_FLAG_SHA256	= 0x02
+};
+
+/* The digest engine context flags
+ */
+enum DIGEST_ENGINE_FLAGS
+{
+	/* The context supports exporting and importing its state
+	 * this requires the digest engine block implementation,
+	 * which is used instead of libhmac if no hardware support is available
+	 */
+	DIGEST_ENGINE_FLAG_EXPORTABLE_STATE	= 0x01
+};
+
+typedef struct digest_engine_md5_context digest_engine_md5_context_t;
+
+struct digest_engine_md5_context
+{
+	/* The libhmac MD5 context
+	 * Used if the state of the context does not need to be exportable
+	 */
+	libhmac_md5_context_t *libhmac_context;
+
+	/* The hash values
+	 */
+	uint32_t hash_values[ 4 ];
+
+	/* The block
+	 */
+	uint8_t block[ DIGEST_ENGINE_BLOCK_SIZE ];
+
+	/* The block offset
+	 */
+	size_t block_offset;
+
+	/* The number of bytes hashed
+	 */
+	uint64_t number_of_bytes;
+};
+
+typedef struct digest_engine_sha1_context digest_engine_sha1_context_t;
+
+struct digest_engine_sha1_context
+{
+	/* The libhmac SHA1 context
+	 * Used if the hardware does not support SHA1 and the state of the context does not need to be exportable
+	 */
+	libhmac_sha1_context_t *libhmac_context;
+
+	/* The function to calculate the hash of 64 byte blocks
+	 * Uses the hardware if it supports SHA1
+	 */
+	void (*process_blocks)(
+	       uint32_t *hash_values,
+	       const uint8_t *blocks,
+	       size_t number_of_blocks );
+
+	/* The hash values
+	 */
+	uint32_t hash_values[ 5 ];
+
+	/* The block
+	 */
+	uint8_t block[ DIGEST_ENGINE_BLOCK_SIZE ];
+
+	/* The block offset
+	 */
+	size_t block_offset;
+
+	/* The number of bytes hashed
+	 */
+	uint64_t number_of_bytes;
+};
+
+typedef struct digest_engine_sha256_context digest_engine_sha256_context_t;
+
+struct digest_engine_sha256_context
+{
+	/* The libhmac SHA256 context
+	 * Used if the hardware does not support SHA256 and the state of the context does not need to be exportable
+	 */
+	libhmac_sha256_context_t *libhmac_context;
+
+	/* The function to calculate the hash of 64 byte blocks
+	 * Uses the hardware if it supports SHA256
+	 */
+	void (*process_blocks)(
+	       uint32_t *hash_values,
+	       const uint8_t *blocks,
+	       size_t number_of_blocks );
+
+	/* The hash values
+	 */
+	uint32_t hash_values[ 8 ];
+
+	/* The block
+	 */
+	uint8_t block[ DIGEST_ENGINE_BLOCK_SIZE ];
+
+	/* The block offset
+	 */
+	size_t block_offset;
+
+	/* The number of bytes hashed
+	 */
+	uint64_t number_of_bytes;
+};
+
+typedef struct digest_engine_blake3_output digest_engine_blake3_output_t;
+
+struct digest_engine_blake3_output
+{
+	/* The input chaining value
+	 */
+	uint32_t chaining_value[ 8 ];
+
+	/* The block words
+	 */
+	uint32_t block_words[ 16 ];
+
+	/* The counter
+	 */
+	uint64_t counter;
+
+	/* The block size
+	 */
+	uint32_t block_size;
+
+	/* The flags
+	 */
+	uint32_t flags;
+};
+
+typedef struct digest_engine_blake3_chunk_state digest_engine_blake3_chunk_state_t;
+
+struct digest_engine_blake3_chunk_state
+{
+	/* The chaining value
+	 */
+	uint32_t chaining_value[ 8 ];
+
+	/* The chunk counter
+	 */
+	uint64_t chunk_counter;
+
+	/* The block
+	 */
+	uint8_t block[ DIGEST_ENGINE_BLOCK_SIZE ];
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The number of compressed blocks
+	 */
+	uint8_t number_of_compressed_blocks;
+};
+
+typedef struct digest_engine_blake3_context digest_engine_blake3_context_t;
+
+struct digest_engine_blake3_context
+{
+	/* The chunk state
+	 */
+	digest_engine_blake3_chunk_state_t chunk_state;
+
+	/* The chaining value stack
+	 * Contains the chaining values of the subtrees that have not been merged
+	 */
+	uint32_t stack[ DIGEST_ENGINE_BLAKE3_MAXIMUM_STACK_DEPTH ][ 8 ];
+
+	/* The stack depth
+	 */
+	int stack_depth;
+
+	/* The number of bytes hashed
+	 */
+	uint64_t number_of_bytes;
+};
+
+int digest_engine_get_hardware_flags(
+     uint8_t *hardware_flags,
+     libcerror_error_t **error );
+
+int digest_engine_md5_initialize(
+     digest_engine_md5_context_t **context,
+     libcerror_error_t **error );
+
+int digest_engine_md5_initialize_with_flags(
+     digest_engine_md5_context_t **context,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int digest_engine_md5_free(
+     digest_engine_md5_context_t **context,
+     libcerror_error_t **error );
+
+int digest_engine_md5_update(
+     digest_engine_md5_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int digest_engine_md5_finalize(
+     digest_engine_md5_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int digest_engine_md5_export_state(
+     digest_engine_md5_context_t *context,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+int digest_engine_md5_import_state(
+     digest_engine_md5_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+int digest_engine_sha1_initialize(
+     digest_engine_sha1_context_t **context,
+     libcerror_error_t **error );
+
+int digest_engine_sha1_initialize_with_flags(
+     digest_engine_sha1_context_t **context,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int digest_engine_sha1_free(
+     digest_engine_sha1_context_t **context,
+     libcerror_error_t **error );
+
+int digest_engine_sha1_update(
+     digest_engine_sha1_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int digest_engine_sha1_finalize(
+     digest_engine_sha1_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int digest_engine_sha1_export_state(
+     digest_engine_sha1_context_t *context,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+int digest_engine_sha1_import_state(
+     digest_engine_sha1_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+int digest_engine_sha256_initialize(
+     digest_engine_sha256_context_t **context,
+     libcerror_error_t **error );
+
+int digest_engine_sha256_initialize_with_flags(
+     digest_engine_sha256_context_t **context,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int digest_engine_sha256_free(
+     digest_engine_sha256_context_t **context,
+     libcerror_error_t **error );
+
+int digest_engine_sha256_update(
+     digest_engine_sha256_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int digest_engine_sha256_finalize(
+     digest_engine_sha256_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int digest_engine_sha256_export_state(
+     digest_engine_sha256_context_t *context,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+int digest_engine_sha256_import_state(
+     digest_engine_sha256_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+int digest_engine_blake3_initialize(
+     digest_engine_blake3_context_t **context,
+     libcerror_error_t **error );
+
+int digest_engine_blake3_free(
+     digest_engine_blake3_context_t **context,
+     libcerror_error_t **error );
+
+int digest_engine_blake3_update(
+     digest_engine_blake3_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int digest_engine_blake3_update_subtree(
+     digest_engine_blake3_context_t *context,
+     const uint8_t *chaining_value,
+     size_t chaining_value_size,
+     size_t size,
+     libcerror_error_t **error );
+
+int digest_engine_blake3_finalize(
+     digest_engine_blake3_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int digest_engine_blake3_calculate_subtree_chaining_value(
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t offset,
+     uint8_t *chaining_value,
+     size_t chaining_value_size,
+     libcerror_error_t **error );
+
+int digest_engine_blake3_export_state(
+     digest_engine_blake3_context_t *context,
+     uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+int digest_engine_blake3_import_state(
+     digest_engine_blake3_context_t *context,
+     const uint8_t *state,
+     size_t state_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DIGEST_ENGINE_H ) */
+
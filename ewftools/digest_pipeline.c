@@ -0,0 +1,1354 @@
+/*
+ * Digest pipeline
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "digest_pipeline.h"
+#include "ewftools_libcerror.h"
+#include "ewftools_libcnotify.h"
+#include "ewftools_libcthreads.h"
+
+/* Creates a digest pipeline
+ * Make sure the value digest_pipeline is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_initialize(
+     digest_pipeline_t **digest_pipeline,
+     uint8_t use_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_initialize";
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_pipeline != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest pipeline value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*digest_pipeline = memory_allocate_structure(
+	                    digest_pipeline_t );
+
+	if( *digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create digest pipeline.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *digest_pipeline,
+	     0,
+	     sizeof( digest_pipeline_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digest pipeline.",
+		 function );
+
+		memory_free(
+		 *digest_pipeline );
+
+		*digest_pipeline = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *digest_pipeline )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *digest_pipeline )->use_threads = use_threads;
+
+	return( 1 );
+
+on_error:
+	if( *digest_pipeline != NULL )
+	{
+		memory_free(
+		 *digest_pipeline );
+
+		*digest_pipeline = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a digest pipeline
+ * The stages are stopped if running after they digested the remaining buffers,
+ * the digest contexts are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_free(
+     digest_pipeline_t **digest_pipeline,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_free";
+	int buffer_index      = 0;
+	int result            = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int stage_index       = 0;
+#endif
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_pipeline != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		for( stage_index = 1;
+		     stage_index < ( *digest_pipeline )->number_of_stages;
+		     stage_index++ )
+		{
+			if( ( *digest_pipeline )->stages[ stage_index ].thread_pool == NULL )
+			{
+				continue;
+			}
+			if( libcthreads_thread_pool_join(
+			     &( ( *digest_pipeline )->stages[ stage_index ].thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join stage: %d thread pool.",
+				 function,
+				 stage_index );
+
+				result = -1;
+			}
+		}
+		if( ( *digest_pipeline )->free_buffer_queue != NULL )
+		{
+			if( libcthreads_queue_free(
+			     &( ( *digest_pipeline )->free_buffer_queue ),
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free free buffer queue.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *digest_pipeline )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		/* A stage that failed to digest one of the remaining buffers
+		 * leaves its digest incomplete
+		 */
+		if( ( result == 1 )
+		 && ( ( *digest_pipeline )->stage_failed != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update stage.",
+			 function );
+
+			result = -1;
+		}
+		for( buffer_index = 0;
+		     buffer_index < DIGEST_PIPELINE_NUMBER_OF_BUFFERS;
+		     buffer_index++ )
+		{
+			if( ( *digest_pipeline )->buffers[ buffer_index ].allocated_data != NULL )
+			{
+				memory_free(
+				 ( *digest_pipeline )->buffers[ buffer_index ].allocated_data );
+			}
+		}
+		memory_free(
+		 *digest_pipeline );
+
+		*digest_pipeline = NULL;
+	}
+	return( result );
+}
+
+/* Appends a stage to the digest pipeline
+ * The update function is called with the context and every buffer that is digested
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_append_stage(
+     digest_pipeline_t *digest_pipeline,
+     int (*update)(
+            intptr_t *context,
+            const uint8_t *buffer,
+            size_t size,
+            libcerror_error_t **error ),
+     intptr_t *context,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_append_stage";
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( digest_pipeline->free_buffer_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest pipeline - free buffer queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( digest_pipeline->number_of_stages >= DIGEST_PIPELINE_MAXIMUM_NUMBER_OF_STAGES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid digest pipeline - number of stages value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( update == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid update function.",
+		 function );
+
+		return( -1 );
+	}
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	digest_pipeline->stages[ digest_pipeline->number_of_stages ].update          = update;
+	digest_pipeline->stages[ digest_pipeline->number_of_stages ].context         = context;
+	digest_pipeline->stages[ digest_pipeline->number_of_stages ].digest_pipeline = digest_pipeline;
+
+	digest_pipeline->number_of_stages += 1;
+
+	return( 1 );
+}
+
+/* Sets the function that releases the value of a buffer passed by reference
+ * The release function is called with the context and the value once all the stages digested the buffer,
+ * this can be on the thread of the last stage that digested it
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_set_release_function(
+     digest_pipeline_t *digest_pipeline,
+     int (*release)(
+            intptr_t *context,
+            intptr_t *value,
+            libcerror_error_t **error ),
+     intptr_t *context,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_set_release_function";
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( release == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid release function.",
+		 function );
+
+		return( -1 );
+	}
+	digest_pipeline->release         = release;
+	digest_pipeline->release_context = context;
+
+	return( 1 );
+}
+
+/* Starts the digest pipeline
+ * If threads are used every stage, except the first, runs on its own thread
+ * and has its own queue of buffers to digest
+ * The first stage runs on the thread that updates the digest pipeline
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_start(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_start";
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int buffer_index      = 0;
+	int stage_index       = 0;
+#endif
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( digest_pipeline->free_buffer_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest pipeline - free buffer queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( digest_pipeline->use_threads != 0 )
+	 && ( digest_pipeline->number_of_stages > 1 ) )
+	{
+		if( libcthreads_queue_initialize(
+		     &( digest_pipeline->free_buffer_queue ),
+		     DIGEST_PIPELINE_NUMBER_OF_BUFFERS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create free buffer queue.",
+			 function );
+
+			goto on_error;
+		}
+		for( buffer_index = 0;
+		     buffer_index < DIGEST_PIPELINE_NUMBER_OF_BUFFERS;
+		     buffer_index++ )
+		{
+			if( libcthreads_queue_push(
+			     digest_pipeline->free_buffer_queue,
+			     (intptr_t *) &( digest_pipeline->buffers[ buffer_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push buffer: %d onto free buffer queue.",
+				 function,
+				 buffer_index );
+
+				goto on_error;
+			}
+		}
+		/* A single thread per stage makes sure the stage digests
+		 * the buffers in the order they were passed
+		 */
+		for( stage_index = 1;
+		     stage_index < digest_pipeline->number_of_stages;
+		     stage_index++ )
+		{
+			if( libcthreads_thread_pool_create(
+			     &( digest_pipeline->stages[ stage_index ].thread_pool ),
+			     NULL,
+			     1,
+			     DIGEST_PIPELINE_NUMBER_OF_BUFFERS,
+			     (int (*)(intptr_t *, void *)) &digest_pipeline_stage_callback,
+			     (void *) &( digest_pipeline->stages[ stage_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create stage: %d thread pool.",
+				 function,
+				 stage_index );
+
+				goto on_error;
+			}
+		}
+	}
+#endif
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	for( stage_index = 1;
+	     stage_index < digest_pipeline->number_of_stages;
+	     stage_index++ )
+	{
+		if( digest_pipeline->stages[ stage_index ].thread_pool != NULL )
+		{
+			libcthreads_thread_pool_join(
+			 &( digest_pipeline->stages[ stage_index ].thread_pool ),
+			 NULL );
+		}
+	}
+	if( digest_pipeline->free_buffer_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( digest_pipeline->free_buffer_queue ),
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Retrieves and clears the stage failed value of the digest pipeline
+ * Returns 1 if no stage failed, 0 if a stage failed or -1 on error
+ */
+int digest_pipeline_get_stage_failed(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_get_stage_failed";
+	uint8_t stage_failed  = 0;
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     digest_pipeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	stage_failed = digest_pipeline->stage_failed;
+
+	digest_pipeline->stage_failed = 0;
+
+	if( libcthreads_mutex_release(
+	     digest_pipeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( stage_failed != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Releases a buffer onto the free buffer queue once all the stages it was passed to digested it
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_release_buffer(
+     digest_pipeline_t *digest_pipeline,
+     digest_pipeline_buffer_t *buffer,
+     int number_of_stages,
+     uint8_t stage_failed,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_release_buffer";
+	intptr_t *value       = NULL;
+	int release_buffer    = 0;
+	int result            = 1;
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     digest_pipeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( stage_failed != 0 )
+	{
+		digest_pipeline->stage_failed = 1;
+	}
+	buffer->number_of_pending_stages -= number_of_stages;
+
+	if( buffer->number_of_pending_stages <= 0 )
+	{
+		release_buffer = 1;
+	}
+	if( libcthreads_mutex_release(
+	     digest_pipeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* The value is released before the buffer is pushed onto the free buffer queue
+	 * hence once all buffers are free all the values have been released
+	 */
+	if( release_buffer != 0 )
+	{
+		value         = buffer->value;
+		buffer->value = NULL;
+
+		if( value != NULL )
+		{
+			if( digest_pipeline_release_value(
+			     digest_pipeline,
+			     value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release value.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The free buffer queue can hold every buffer hence this does not block
+		 */
+		if( libcthreads_queue_push(
+		     digest_pipeline->free_buffer_queue,
+		     (intptr_t *) buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push buffer onto free buffer queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Releases the value of a buffer passed by reference
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_release_value(
+     digest_pipeline_t *digest_pipeline,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_release_value";
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_pipeline->release == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid digest pipeline - missing release function.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_pipeline->release(
+	     digest_pipeline->release_context,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Updates the digest pipeline with a buffer
+ * If value is NULL the buffer is copied if needed and can be reused after the function returns,
+ * otherwise the stages digest the buffer without a copy and the value is released, using
+ * the release function, once all the stages digested it or when the function fails
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_update_buffer(
+     digest_pipeline_t *digest_pipeline,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_update_buffer";
+	int stage_index       = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	digest_pipeline_buffer_t *pipeline_buffer = NULL;
+	void *reallocation                        = NULL;
+	int number_of_pushed_stages               = 0;
+	int result                                = 0;
+#endif
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( digest_pipeline->free_buffer_queue != NULL )
+	{
+		result = digest_pipeline_get_stage_failed(
+		          digest_pipeline,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if a stage failed.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update stage.",
+			 function );
+
+			goto on_error;
+		}
+		/* An empty buffer does not change the digests
+		 */
+		if( buffer_size == 0 )
+		{
+			goto on_empty_buffer;
+		}
+		/* This blocks while the stages lag behind by all the buffers
+		 */
+		if( libcthreads_queue_pop(
+		     digest_pipeline->free_buffer_queue,
+		     (intptr_t **) &pipeline_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to pop buffer from free buffer queue.",
+			 function );
+
+			goto on_error;
+		}
+		if( pipeline_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing buffer.",
+			 function );
+
+			goto on_error;
+		}
+		/* Every stage, including the first, holds a reference to the buffer
+		 * until it digested the buffer
+		 */
+		pipeline_buffer->number_of_pending_stages = digest_pipeline->number_of_stages;
+
+		if( value != NULL )
+		{
+			pipeline_buffer->data  = (uint8_t *) buffer;
+			pipeline_buffer->value = value;
+			value                  = NULL;
+		}
+		else
+		{
+			if( buffer_size > pipeline_buffer->allocated_data_size )
+			{
+				reallocation = memory_reallocate(
+				                pipeline_buffer->allocated_data,
+				                sizeof( uint8_t ) * buffer_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize buffer data.",
+					 function );
+
+					goto on_error;
+				}
+				pipeline_buffer->allocated_data      = (uint8_t *) reallocation;
+				pipeline_buffer->allocated_data_size = buffer_size;
+			}
+			if( memory_copy(
+			     pipeline_buffer->allocated_data,
+			     buffer,
+			     buffer_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy buffer data.",
+				 function );
+
+				goto on_error;
+			}
+			pipeline_buffer->data = pipeline_buffer->allocated_data;
+		}
+		pipeline_buffer->data_size = buffer_size;
+
+		for( stage_index = 1;
+		     stage_index < digest_pipeline->number_of_stages;
+		     stage_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     digest_pipeline->stages[ stage_index ].thread_pool,
+			     (intptr_t *) pipeline_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push buffer onto stage: %d thread pool queue.",
+				 function,
+				 stage_index );
+
+				goto on_error;
+			}
+			number_of_pushed_stages++;
+		}
+		/* The first stage runs on this thread while the other stages
+		 * digest the buffer on their own thread
+		 */
+		result = digest_pipeline->stages[ 0 ].update(
+		          digest_pipeline->stages[ 0 ].context,
+		          pipeline_buffer->data,
+		          buffer_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update stage: 0.",
+			 function );
+		}
+		/* The buffer can be reused, or its value released, by another thread
+		 * once the first stage released its reference
+		 */
+		if( digest_pipeline_release_buffer(
+		     digest_pipeline,
+		     pipeline_buffer,
+		     1,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release buffer.",
+			 function );
+
+			result = -1;
+		}
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
+	for( stage_index = 0;
+	     stage_index < digest_pipeline->number_of_stages;
+	     stage_index++ )
+	{
+		if( digest_pipeline->stages[ stage_index ].update(
+		     digest_pipeline->stages[ stage_index ].context,
+		     buffer,
+		     buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update stage: %d.",
+			 function,
+			 stage_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_empty_buffer:
+#endif
+	if( value != NULL )
+	{
+		if( digest_pipeline_release_value(
+		     digest_pipeline,
+		     value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Account for the first stage and the stages the buffer was not pushed to,
+	 * this releases the value if no stage holds a reference to the buffer
+	 */
+	if( pipeline_buffer != NULL )
+	{
+		digest_pipeline_release_buffer(
+		 digest_pipeline,
+		 pipeline_buffer,
+		 digest_pipeline->number_of_stages - number_of_pushed_stages,
+		 0,
+		 NULL );
+	}
+#endif
+	if( value != NULL )
+	{
+		digest_pipeline_release_value(
+		 digest_pipeline,
+		 value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Updates the digest pipeline
+ * If threads are used the buffer is copied once and the copy is queued for every stage,
+ * except the first, hence the buffer can be reused after the function returns
+ * The stages digest the buffers in the order they were passed and can lag behind
+ * by at most DIGEST_PIPELINE_NUMBER_OF_BUFFERS buffers, use digest_pipeline_flush
+ * to wait for the stages to digest all the buffers
+ * A stage that failed to digest a previous buffer is reported by the next update
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_update(
+     digest_pipeline_t *digest_pipeline,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_update";
+
+	if( digest_pipeline_update_buffer(
+	     digest_pipeline,
+	     buffer,
+	     buffer_size,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Updates the digest pipeline with a buffer that is owned by a value
+ * The stages digest the buffer without it being copied, the digest pipeline takes over
+ * the value and releases it, using the release function, once all the stages digested
+ * the buffer hence the buffer must not be changed until the value is released
+ * The value is also released when the function fails
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_update_reference(
+     digest_pipeline_t *digest_pipeline,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_update_reference";
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_pipeline->release == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid digest pipeline - missing release function.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_pipeline_update_buffer(
+	     digest_pipeline,
+	     buffer,
+	     buffer_size,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Flushes the digest pipeline
+ * The function returns after all stages digested all the buffers passed to the digest pipeline
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_flush(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_flush";
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	digest_pipeline_buffer_t *pipeline_buffers[ DIGEST_PIPELINE_NUMBER_OF_BUFFERS ];
+
+	int buffer_index      = 0;
+	int number_of_buffers = 0;
+	int result            = 1;
+#endif
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( digest_pipeline->free_buffer_queue == NULL )
+	{
+		return( 1 );
+	}
+	/* A buffer is only released after all stages digested it
+	 * hence once all buffers are free the stages are idle
+	 */
+	for( buffer_index = 0;
+	     buffer_index < DIGEST_PIPELINE_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( libcthreads_queue_pop(
+		     digest_pipeline->free_buffer_queue,
+		     (intptr_t **) &( pipeline_buffers[ buffer_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to pop buffer: %d from free buffer queue.",
+			 function,
+			 buffer_index );
+
+			result = -1;
+
+			break;
+		}
+		number_of_buffers++;
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( libcthreads_queue_push(
+		     digest_pipeline->free_buffer_queue,
+		     (intptr_t *) pipeline_buffers[ buffer_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push buffer: %d onto free buffer queue.",
+			 function,
+			 buffer_index );
+
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	result = digest_pipeline_get_stage_failed(
+	          digest_pipeline,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if a stage failed.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update stage.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Digests a buffer of the digest pipeline in a stage
+ * Callback function for the stage thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_stage_callback(
+     digest_pipeline_buffer_t *buffer,
+     digest_pipeline_stage_t *stage )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "digest_pipeline_stage_callback";
+	uint8_t stage_failed     = 0;
+	int result               = 1;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( stage == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stage.",
+		 function );
+
+		goto on_error;
+	}
+	if( stage->update(
+	     stage->context,
+	     buffer->data,
+	     buffer->data_size,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update stage.",
+		 function );
+
+		stage_failed = 1;
+		result       = -1;
+	}
+	/* Always account for the stage, otherwise the buffer would never be released
+	 */
+	if( digest_pipeline_release_buffer(
+	     stage->digest_pipeline,
+	     buffer,
+	     1,
+	     stage_failed,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+
+on_error:
+	if( error != NULL )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
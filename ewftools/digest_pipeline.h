@@ -0,0 +1,238 @@
+/*
+ * Digest pipeline
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DIGEST_PIPELINE_H )
+#define _DIGEST_PIPELINE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "ewftools_libcerror.h"
+#include "ewftools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of stages in a digest pipeline
+ */
+#define DIGEST_PIPELINE_MAXIMUM_NUMBER_OF_STAGES	8
+
+/* The number of buffers the stages that run on their own thread
+ * can lag behind the thread that updates the digest pipeline
+ */
+#define DIGEST_PIPELINE_NUMBER_OF_BUFFERS		4
+
+typedef struct digest_pipeline digest_pipeline_t;
+
+typedef struct digest_pipeline_buffer digest_pipeline_buffer_t;
+
+typedef struct digest_pipeline_stage digest_pipeline_stage_t;
+
+struct digest_pipeline_buffer
+{
+	/* The data
+	 * Either the allocated data or the buffer of the value
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The allocated data
+	 * Contains the copy of a buffer that can be reused after the update returned
+	 */
+	uint8_t *allocated_data;
+
+	/* The allocated data size
+	 */
+	size_t allocated_data_size;
+
+	/* The value that owns the data
+	 * The value is released after the last stage digested the data
+	 */
+	intptr_t *value;
+
+	/* The number of stages that have not yet digested the buffer
+	 * The first stage holds a reference as well while it runs on the thread that updates the digest pipeline
+	 */
+	int number_of_pending_stages;
+};
+
+struct digest_pipeline_stage
+{
+	/* The digest context
+	 */
+	intptr_t *context;
+
+	/* The update function
+	 */
+	int (*update)(
+	       intptr_t *context,
+	       const uint8_t *buffer,
+	       size_t size,
+	       libcerror_error_t **error );
+
+	/* The digest pipeline
+	 */
+	digest_pipeline_t *digest_pipeline;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The stage thread pool
+	 * The stage runs on a single thread and its queue contains the buffers
+	 * the stage has not yet digested in the order they were passed
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+#endif
+};
+
+struct digest_pipeline
+{
+	/* The stages
+	 */
+	digest_pipeline_stage_t stages[ DIGEST_PIPELINE_MAXIMUM_NUMBER_OF_STAGES ];
+
+	/* The number of stages
+	 */
+	int number_of_stages;
+
+	/* Value to indicate the stages should run on their own thread
+	 */
+	uint8_t use_threads;
+
+	/* The buffers
+	 */
+	digest_pipeline_buffer_t buffers[ DIGEST_PIPELINE_NUMBER_OF_BUFFERS ];
+
+	/* Value to indicate a stage failed to digest a buffer
+	 */
+	uint8_t stage_failed;
+
+	/* The release function
+	 * Called with the release context and the value of a buffer once all the stages digested it
+	 */
+	int (*release)(
+	       intptr_t *context,
+	       intptr_t *value,
+	       libcerror_error_t **error );
+
+	/* The release context
+	 */
+	intptr_t *release_context;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The queue of buffers that are not being digested
+	 */
+	libcthreads_queue_t *free_buffer_queue;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int digest_pipeline_initialize(
+     digest_pipeline_t **digest_pipeline,
+     uint8_t use_threads,
+     libcerror_error_t **error );
+
+int digest_pipeline_free(
+     digest_pipeline_t **digest_pipeline,
+     libcerror_error_t **error );
+
+int digest_pipeline_append_stage(
+     digest_pipeline_t *digest_pipeline,
+     int (*update)(
+            intptr_t *context,
+            const uint8_t *buffer,
+            size_t size,
+            libcerror_error_t **error ),
+     intptr_t *context,
+     libcerror_error_t **error );
+
+int digest_pipeline_set_release_function(
+     digest_pipeline_t *digest_pipeline,
+     int (*release)(
+            intptr_t *context,
+            intptr_t *value,
+            libcerror_error_t **error ),
+     intptr_t *context,
+     libcerror_error_t **error );
+
+int digest_pipeline_start(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error );
+
+int digest_pipeline_release_value(
+     digest_pipeline_t *digest_pipeline,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int digest_pipeline_update_buffer(
+     digest_pipeline_t *digest_pipeline,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int digest_pipeline_update(
+     digest_pipeline_t *digest_pipeline,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int digest_pipeline_update_reference(
+     digest_pipeline_t *digest_pipeline,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int digest_pipeline_flush(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int digest_pipeline_get_stage_failed(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error );
+
+int digest_pipeline_release_buffer(
+     digest_pipeline_t *digest_pipeline,
+     digest_pipeline_buffer_t *buffer,
+     int number_of_stages,
+     uint8_t stage_failed,
+     libcerror_error_t **error );
+
+int digest_pipeline_stage_callback(
+     digest_pipeline_buffer_t *buffer,
+     digest_pipeline_stage_t *stage );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DIGEST_PIPELINE_H ) */
+
@@ -341,7 +341,7 @@ int main( int argc, char * const argv[] )
 		                         source_filenames[ 0 ] );
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libewf_glob_wide(
+		if( libewf_glob_scan_directory_wide(
 		     source_filenames[ 0 ],
 		     first_filename_length,
 		     LIBEWF_FORMAT_UNKNOWN,
@@ -349,7 +349,7 @@ int main( int argc, char * const argv[] )
 		     &number_of_filenames,
 		     &error ) != 1 )
 #else
-		if( libewf_glob(
+		if( libewf_glob_scan_directory(
 		     source_filenames[ 0 ],
 		     first_filename_length,
 		     LIBEWF_FORMAT_UNKNOWN,
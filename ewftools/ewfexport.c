@@ -123,7 +123,7 @@ void usage_fprint(
 	                 "                 [ -B number_of_bytes ] [ -c compression_values ]\n"
 	                 "                 [ -d digest_type ] [ -f format ] [ -j jobs ] [ -l log_filename ]\n"
 	                 "                 [ -o offset ] [ -p process_buffer_size ]\n"
-	                 "                 [ -S segment_file_size ] [ -t target ] [ -hqsuvVwx ] ewf_files\n\n" );
+	                 "                 [ -S segment_file_size ] [ -t target ] [ -hPqsuvVwxz ] ewf_files\n\n" );
 
 	fprintf( stream, "\tewf_files: the first or the entire set of EWF segment files\n\n" );
 
@@ -159,6 +159,12 @@ void usage_fprint(
 	fprintf( stream, "\t-l:        logs export errors and the digest (hash) to the log_filename\n" );
 	fprintf( stream, "\t-o:        specify the offset to start the export (default is 0)\n" );
 	fprintf( stream, "\t-p:        specify the process buffer size (default is the chunk size)\n" );
+	fprintf( stream, "\t-P:        pass the chunks through to the EWF output without decompressing\n"
+	                 "\t           and compressing them again, only the checksum of uncompressed\n"
+	                 "\t           chunks is verified and the digests (hashes) stored in the input\n"
+	                 "\t           are copied instead of calculated (only supported when exporting\n"
+	                 "\t           all bytes to a similar EWF format with the same chunk size and\n"
+	                 "\t           compression method) (cannot be combined with -d or -j)\n" );
 	fprintf( stream, "\t-q:        quiet shows minimal status information\n" );
 	fprintf( stream, "\t-s:        swap byte pairs of the media data (from AB to BA)\n"
 	                 "\t           (use this for big to little endian conversion and vice\n"
@@ -196,6 +202,9 @@ void usage_fprint(
 	fprintf( stream, "\t-w:        zero sectors on checksum error (mimic EnCase like behavior)\n" );
 	fprintf( stream, "\t-x:        use the data chunk functions instead of the buffered read and\n"
 	                 "\t           write functions.\n" );
+	fprintf( stream, "\t-z:        write the raw output as a sparse file, ranges that contain\n"
+	                 "\t           only 0-byte values are not written (only supported for raw\n"
+	                 "\t           format written to a single segment file)\n" );
 }
 
 /* Signal handler for ewfexport
@@ -278,7 +287,9 @@ int main( int argc, char * const argv[] )
 	uint8_t calculate_md5                              = 1;
 	uint8_t print_status_information                   = 1;
 	uint8_t swap_byte_pairs                            = 0;
+	uint8_t use_chunk_passthrough                      = 0;
 	uint8_t use_data_chunk_functions                   = 0;
+	uint8_t use_sparse_output                          = 0;
 	uint8_t verbose                                    = 0;
 	uint8_t zero_chunk_on_error                        = 0;
 	int interactive_mode                               = 1;
@@ -346,7 +357,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = ewftools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "A:b:B:c:d:f:hj:l:o:p:qsS:t:uvVwx" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "A:b:B:c:d:f:hj:l:o:p:PqsS:t:uvVwxz" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -426,6 +437,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'P':
+				use_chunk_passthrough = 1;
+
+				break;
+
 			case (system_integer_t) 'q':
 				print_status_information = 0;
 
@@ -474,6 +490,11 @@ int main( int argc, char * const argv[] )
 			case (system_integer_t) 'x':
 				use_data_chunk_functions = 1;
 
+				break;
+
+			case (system_integer_t) 'z':
+				use_sparse_output = 1;
+
 				break;
 		}
 	}
@@ -492,6 +513,26 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	/* Chunk passthrough does not decompress the chunks hence it cannot
+	 * calculate additional digest hashes or use concurrent processing jobs
+	 */
+	if( ( use_chunk_passthrough != 0 )
+	 && ( ( option_additional_digest_types != NULL )
+	  ||  ( option_number_of_jobs != NULL ) ) )
+	{
+		ewftools_output_version_fprint(
+		 stderr,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Chunk passthrough (-P) cannot be combined with additional digest types (-d) or jobs (-j).\n" );
+
+		usage_fprint(
+		 stderr );
+
+		goto on_error;
+	}
 	ewftools_output_version_fprint(
 	 stderr,
 	 program );
@@ -1308,6 +1349,67 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+		if( use_sparse_output != 0 )
+		{
+			result = export_handle_has_single_raw_output(
+			          ewfexport_export_handle,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to determine if sparse output is supported.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Sparse output is only supported for raw format written to a single segment file, writing all data.\n" );
+			}
+			else
+			{
+				ewfexport_export_handle->use_sparse_output = 1;
+			}
+		}
+		if( use_chunk_passthrough != 0 )
+		{
+			result = export_handle_supports_chunk_passthrough(
+			          ewfexport_export_handle,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to determine if chunk passthrough is supported.\n" );
+
+				goto on_error;
+			}
+			else if( ( result == 0 )
+			      || ( swap_byte_pairs != 0 ) )
+			{
+				fprintf(
+				 stderr,
+				 "Chunk passthrough is only supported when exporting all bytes without swapping byte pairs to a similar EWF format with the same chunk size and compression method, decompressing and compressing all chunks.\n" );
+			}
+			else
+			{
+				fprintf(
+				 stderr,
+				 "Chunk passthrough does not decompress the chunks, the digest hashes are copied from the input and are not calculated.\n" );
+
+				/* The default number of jobs (threads) is not used since -j cannot be combined with -P
+				 */
+				ewfexport_export_handle->number_of_threads     = 0;
+				ewfexport_export_handle->calculate_md5         = 0;
+				ewfexport_export_handle->calculate_sha1        = 0;
+				ewfexport_export_handle->calculate_sha256      = 0;
+				ewfexport_export_handle->use_chunk_passthrough = 1;
+			}
+		}
 		result = export_handle_export_input(
 		          ewfexport_export_handle,
 		          swap_byte_pairs,
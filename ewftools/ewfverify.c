@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <file_stream.h>
 #include <memory.h>
 #include <system_string.h>
 #include <types.h>
@@ -54,9 +55,11 @@
 #include "ewftools_signal.h"
 #include "ewftools_unused.h"
 #include "log_handle.h"
+#include "verification_batch.h"
 #include "verification_handle.h"
 
 verification_handle_t *ewfverify_verification_handle = NULL;
+verification_batch_t *ewfverify_verification_batch   = NULL;
 int ewfverify_abort                                  = 0;
 
 /* Prints the executable usage information to the stream
@@ -71,19 +74,32 @@ void usage_fprint(
 	fprintf( stream, "Use ewfverify to verify data stored in the EWF format (Expert Witness\n"
 	                 "Compression Format).\n\n" );
 
-	fprintf( stream, "Usage: ewfverify [ -A codepage ] [ -d digest_type ] [ -f format ]\n"
-	                 "                 [ -j jobs ] [ -l log_filename ] [ -p process_buffer_size ]\n"
-	                 "                 [ -hqvVwx ] ewf_files\n\n" );
+	fprintf( stream, "Usage: ewfverify [ -A codepage ] [ -C checkpoint_filename ] [ -d digest_type ]\n"
+	                 "                 [ -D jobs_per_device ] [ -f format ] [ -j jobs ]\n"
+	                 "                 [ -l log_filename ] [ -M manifest_filename ]\n"
+	                 "                 [ -p process_buffer_size ] [ -R results_filename ]\n"
+	                 "                 [ -chqrvVwx ] ewf_files\n\n" );
 
-	fprintf( stream, "\tewf_files: the first or the entire set of EWF segment files\n\n" );
+	fprintf( stream, "\tewf_files: the first or the entire set of EWF segment files, or\n"
+	                 "\t           the first segment file of every image to verify in\n"
+	                 "\t           batch mode\n\n" );
 
 	fprintf( stream, "\t-A:        codepage of header section, options: ascii (default),\n"
 	                 "\t           windows-874, windows-932, windows-936, windows-949,\n"
 	                 "\t           windows-950, windows-1250, windows-1251, windows-1252,\n"
 	                 "\t           windows-1253, windows-1254, windows-1255, windows-1256,\n"
 	                 "\t           windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-c:        checksum only mode, verifies the chunk checksums out of order\n"
+	                 "\t           using all processing jobs (threads) without calculating\n"
+	                 "\t           the digest (hash) of the media data, cannot be combined\n"
+	                 "\t           with -d\n" );
+	fprintf( stream, "\t-C:        periodically writes the progress of the verification to\n"
+	                 "\t           the checkpoint_filename, the checkpoint is removed when\n"
+	                 "\t           the verification completes\n" );
 	fprintf( stream, "\t-d:        calculate additional digest (hash) types besides md5,\n"
-	                 "\t           options: sha1, sha256\n" );
+	                 "\t           options: sha1, sha256, blake3\n" );
+	fprintf( stream, "\t-D:        the number of images on the same device that are verified\n"
+	                 "\t           concurrently in batch mode (default is 1)\n" );
 	fprintf( stream, "\t-f:        specify the input format, options: raw (default),\n"
 	                 "\t           files (restricted to logical volume files)\n" );
 	fprintf( stream, "\t-h:        shows this help\n" );
@@ -92,8 +108,16 @@ void usage_fprint(
 	                 "\t           if multi-threaded mode is supported)\n" );
 	fprintf( stream, "\t-l:        logs verification errors and the digest (hash) to the\n"
 	                 "\t           log_filename\n" );
+	fprintf( stream, "\t-M:        batch mode, verifies every image listed in the\n"
+	                 "\t           manifest_filename (one first segment file per line)\n"
+	                 "\t           and every image specified by ewf_files using a shared\n"
+	                 "\t           pool of processing jobs\n" );
 	fprintf( stream, "\t-p:        specify the process buffer size (default is the chunk size)\n" );
 	fprintf( stream, "\t-q:        quiet shows minimal status information\n" );
+	fprintf( stream, "\t-r:        resume the verification from the checkpoint_filename\n"
+	                 "\t           specified by -C\n" );
+	fprintf( stream, "\t-R:        writes the tab separated results per image of batch mode\n"
+	                 "\t           to the results_filename (default is stdout)\n" );
 	fprintf( stream, "\t-v:        verbose output to stderr\n" );
 	fprintf( stream, "\t-V:        print version\n" );
 	fprintf( stream, "\t-w:        zero sectors on checksum error (mimic EnCase like behavior)\n" );
@@ -113,6 +137,22 @@ void ewfverify_signal_handler(
 
 	ewfverify_abort = 1;
 
+	if( ewfverify_verification_batch != NULL )
+	{
+		if( verification_batch_signal_abort(
+		     ewfverify_verification_batch,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal verification batch to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
 	if( ewfverify_verification_handle != NULL )
 	{
 		if( verification_handle_signal_abort(
@@ -157,24 +197,33 @@ int main( int argc, char * const argv[] )
 	struct rlimit limit_data;
 #endif
 
-	system_character_t * const *source_filenames       = NULL;
-	libcerror_error_t *error                           = NULL;
-	log_handle_t *log_handle                           = NULL;
-	system_character_t *log_filename                   = NULL;
-	system_character_t *option_additional_digest_types = NULL;
-	system_character_t *option_format                  = NULL;
-	system_character_t *option_header_codepage         = NULL;
-	system_character_t *option_number_of_jobs          = NULL;
-	system_character_t *option_process_buffer_size     = NULL;
-	system_character_t *program                        = _SYSTEM_STRING( "ewfverify" );
-	system_integer_t option                            = 0;
-	uint8_t calculate_md5                              = 1;
-	uint8_t print_status_information                   = 1;
-	uint8_t use_data_chunk_functions                   = 0;
-	uint8_t verbose                                    = 0;
-	uint8_t zero_chunk_on_error                        = 0;
-	int number_of_filenames                            = 0;
-	int result                                         = 0;
+	system_character_t * const *source_filenames         = NULL;
+	libcerror_error_t *error                             = NULL;
+	log_handle_t *log_handle                             = NULL;
+	FILE *results_stream                                 = NULL;
+	system_character_t *checkpoint_filename              = NULL;
+	system_character_t *log_filename                     = NULL;
+	system_character_t *manifest_filename                = NULL;
+	system_character_t *option_additional_digest_types   = NULL;
+	system_character_t *option_format                    = NULL;
+	system_character_t *option_header_codepage           = NULL;
+	system_character_t *option_number_of_jobs            = NULL;
+	system_character_t *option_number_of_jobs_per_device = NULL;
+	system_character_t *option_process_buffer_size       = NULL;
+	system_character_t *program                          = _SYSTEM_STRING( "ewfverify" );
+	system_character_t *results_filename                 = NULL;
+	system_integer_t option                              = 0;
+	uint8_t calculate_md5                                = 1;
+	uint8_t checksum_only                                = 0;
+	uint8_t print_status_information                     = 1;
+	uint8_t resume_from_checkpoint                       = 0;
+	uint8_t use_data_chunk_functions                     = 0;
+	uint8_t verbose                                      = 0;
+	uint8_t zero_chunk_on_error                          = 0;
+	int filename_index                                   = 0;
+	int number_of_filenames                              = 0;
+	int number_of_images                                 = 0;
+	int result                                           = 0;
 
 #if !defined( HAVE_GLOB_H )
 	ewftools_glob_t *glob                            = NULL;
@@ -213,7 +262,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = ewftools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "A:d:f:j:hl:p:qvVwx" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "A:cC:d:D:f:j:hl:M:p:qrR:vVwx" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -234,11 +283,26 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'c':
+				checksum_only = 1;
+
+				break;
+
+			case (system_integer_t) 'C':
+				checkpoint_filename = optarg;
+
+				break;
+
 			case (system_integer_t) 'd':
 				option_additional_digest_types = optarg;
 
 				break;
 
+			case (system_integer_t) 'D':
+				option_number_of_jobs_per_device = optarg;
+
+				break;
+
 			case (system_integer_t) 'f':
 				option_format = optarg;
 
@@ -260,6 +324,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'M':
+				manifest_filename = optarg;
+
+				break;
+
 			case (system_integer_t) 'p':
 				option_process_buffer_size = optarg;
 
@@ -270,6 +339,16 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'r':
+				resume_from_checkpoint = 1;
+
+				break;
+
+			case (system_integer_t) 'R':
+				results_filename = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -292,7 +371,8 @@ int main( int argc, char * const argv[] )
 				break;
 		}
 	}
-	if( optind == argc )
+	if( ( optind == argc )
+	 && ( manifest_filename == NULL ) )
 	{
 		fprintf(
 		 stderr,
@@ -313,6 +393,23 @@ int main( int argc, char * const argv[] )
 	 stderr,
 	 NULL );
 #endif
+	if( checksum_only != 0 )
+	{
+		/* No digest hashes are calculated in checksum only mode
+		 */
+		if( option_additional_digest_types != NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Additional digest types are not supported in checksum only mode.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			goto on_error;
+		}
+		calculate_md5 = 0;
+	}
 	if( verification_handle_initialize(
 	     &ewfverify_verification_handle,
 	     calculate_md5,
@@ -325,6 +422,10 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	ewfverify_verification_handle->checksum_only          = checksum_only;
+	ewfverify_verification_handle->checkpoint_filename    = checkpoint_filename;
+	ewfverify_verification_handle->resume_from_checkpoint = resume_from_checkpoint;
+
 	if( option_header_codepage != NULL )
 	{
 		result = verification_handle_set_header_codepage(
@@ -369,6 +470,36 @@ int main( int argc, char * const argv[] )
 			 "Unsupported input format defaulting to: raw.\n" );
 		}
 	}
+	if( ( checksum_only != 0 )
+	 && ( ewfverify_verification_handle->input_format == VERIFICATION_HANDLE_INPUT_FORMAT_FILES ) )
+	{
+		fprintf(
+		 stderr,
+		 "Checksum only mode is not supported for input format: files.\n" );
+
+		goto on_error;
+	}
+	if( checkpoint_filename != NULL )
+	{
+		if( ( checksum_only != 0 )
+		 || ( manifest_filename != NULL )
+		 || ( ewfverify_verification_handle->input_format == VERIFICATION_HANDLE_INPUT_FORMAT_FILES ) )
+		{
+			fprintf(
+			 stderr,
+			 "Checkpoints are not supported in checksum only mode, batch mode or for input format: files.\n" );
+
+			goto on_error;
+		}
+	}
+	else if( resume_from_checkpoint != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Resuming the verification requires a checkpoint filename.\n" );
+
+		goto on_error;
+	}
 	if( option_process_buffer_size != NULL )
 	{
 		result = verification_handle_set_process_buffer_size(
@@ -484,6 +615,105 @@ int main( int argc, char * const argv[] )
 	source_filenames    = &( argv[ optind ] );
 	number_of_filenames = argc - optind;
 #endif
+	if( manifest_filename != NULL )
+	{
+		if( ewfverify_verification_handle->input_format == VERIFICATION_HANDLE_INPUT_FORMAT_FILES )
+		{
+			fprintf(
+			 stderr,
+			 "Batch mode is not supported for input format: files.\n" );
+
+			goto on_error;
+		}
+		if( verification_batch_initialize(
+		     &ewfverify_verification_batch,
+		     ewfverify_verification_handle,
+		     option_additional_digest_types,
+		     zero_chunk_on_error,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create verification batch.\n" );
+
+			goto on_error;
+		}
+		if( option_number_of_jobs_per_device != NULL )
+		{
+			result = verification_batch_set_maximum_number_of_jobs_per_device(
+				  ewfverify_verification_batch,
+				  option_number_of_jobs_per_device,
+				  &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set number of jobs per device.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported number of jobs per device defaulting to: %d.\n",
+				 ewfverify_verification_batch->maximum_number_of_jobs_per_device );
+			}
+		}
+		if( verification_batch_read_manifest(
+		     ewfverify_verification_batch,
+		     manifest_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read manifest: %" PRIs_SYSTEM ".\n",
+			 manifest_filename );
+
+			goto on_error;
+		}
+		/* In batch mode every filename is considered to be a separate image
+		 */
+		for( filename_index = 0;
+		     filename_index < number_of_filenames;
+		     filename_index++ )
+		{
+			if( verification_batch_append_image(
+			     ewfverify_verification_batch,
+			     source_filenames[ filename_index ],
+			     system_string_length(
+			      source_filenames[ filename_index ] ),
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to append image: %" PRIs_SYSTEM ".\n",
+				 source_filenames[ filename_index ] );
+
+				goto on_error;
+			}
+		}
+		if( verification_batch_get_number_of_images(
+		     ewfverify_verification_batch,
+		     &number_of_images,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve number of images.\n" );
+
+			goto on_error;
+		}
+		if( number_of_images == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Missing EWF image file(s).\n" );
+
+			goto on_error;
+		}
+	}
 
 #if defined( HAVE_GETRLIMIT )
 	if( getrlimit(
@@ -513,6 +743,18 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( ( ewfverify_verification_batch != NULL )
+	 && ( verification_batch_set_maximum_number_of_open_handles(
+	       ewfverify_verification_batch,
+	       (int) limit_data.rlim_max,
+	       &error ) != 1 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set maximum number of open file handles of batch.\n" );
+
+		goto on_error;
+	}
 #endif /* defined( HAVE_GETRLIMIT ) */
 
 	if( ewftools_signal_attach(
@@ -528,23 +770,28 @@ int main( int argc, char * const argv[] )
 		libcerror_error_free(
 		 &error );
 	}
-	result = verification_handle_open_input(
-	          ewfverify_verification_handle,
-	          source_filenames,
-	          number_of_filenames,
-	          &error );
-
-	if( ewfverify_abort != 0 )
-	{
-		goto on_abort;
-	}
-	if( result != 1 )
+	/* In batch mode the images are opened when they are verified
+	 */
+	if( ewfverify_verification_batch == NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to open EWF image file(s).\n" );
+		result = verification_handle_open_input(
+		          ewfverify_verification_handle,
+		          source_filenames,
+		          number_of_filenames,
+		          &error );
 
-		goto on_error;
+		if( ewfverify_abort != 0 )
+		{
+			goto on_abort;
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open EWF image file(s).\n" );
+
+			goto on_error;
+		}
 	}
 #if !defined( HAVE_GLOB_H )
 	if( ewftools_glob_free(
@@ -558,10 +805,11 @@ int main( int argc, char * const argv[] )
 		goto on_error;
 	}
 #endif
-	if( verification_handle_set_zero_chunk_on_error(
-	     ewfverify_verification_handle,
-	     zero_chunk_on_error,
-	     &error ) != 1 )
+	if( ( ewfverify_verification_batch == NULL )
+	 && ( verification_handle_set_zero_chunk_on_error(
+	       ewfverify_verification_handle,
+	       zero_chunk_on_error,
+	       &error ) != 1 ) )
 	{
 		fprintf(
 		 stderr,
@@ -594,7 +842,76 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
-	if( ewfverify_verification_handle->input_format == VERIFICATION_HANDLE_INPUT_FORMAT_FILES )
+	if( ewfverify_verification_batch != NULL )
+	{
+		result = verification_batch_verify(
+		          ewfverify_verification_batch,
+		          log_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to verify batch.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		else
+		{
+			if( results_filename != NULL )
+			{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				results_stream = file_stream_open_wide(
+				                  results_filename,
+				                  _SYSTEM_STRING( FILE_STREAM_OPEN_WRITE ) );
+#else
+				results_stream = file_stream_open(
+				                  results_filename,
+				                  FILE_STREAM_OPEN_WRITE );
+#endif
+				if( results_stream == NULL )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to open results file: %" PRIs_SYSTEM ".\n",
+					 results_filename );
+
+					goto on_error;
+				}
+			}
+			if( verification_batch_results_fprint(
+			     ewfverify_verification_batch,
+			     ( results_stream != NULL ) ? results_stream : stdout,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print results.\n" );
+
+				goto on_error;
+			}
+			if( results_stream != NULL )
+			{
+				if( file_stream_close(
+				     results_stream ) != 0 )
+				{
+					results_stream = NULL;
+
+					fprintf(
+					 stderr,
+					 "Unable to close results file.\n" );
+
+					goto on_error;
+				}
+				results_stream = NULL;
+			}
+		}
+	}
+	else if( ewfverify_verification_handle->input_format == VERIFICATION_HANDLE_INPUT_FORMAT_FILES )
 	{
 		result = verification_handle_verify_single_files(
 		          ewfverify_verification_handle,
@@ -614,6 +931,26 @@ int main( int argc, char * const argv[] )
 			 &error );
 		}
 	}
+	else if( checksum_only != 0 )
+	{
+		result = verification_handle_verify_chunk_integrity(
+		          ewfverify_verification_handle,
+		          print_status_information,
+		          log_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to verify chunk integrity.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
 	else
 	{
 		result = verification_handle_verify_input(
@@ -670,9 +1007,10 @@ on_abort:
 		libcerror_error_free(
 		 &error );
 	}
-	if( verification_handle_close(
-	     ewfverify_verification_handle,
-	     &error ) != 0 )
+	if( ( ewfverify_verification_batch == NULL )
+	 && ( verification_handle_close(
+	       ewfverify_verification_handle,
+	       &error ) != 0 ) )
 	{
 		fprintf(
 		 stderr,
@@ -681,6 +1019,19 @@ on_abort:
 		goto on_error;
 
 	}
+	if( ewfverify_verification_batch != NULL )
+	{
+		if( verification_batch_free(
+		     &ewfverify_verification_batch,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free verification batch.\n" );
+
+			goto on_error;
+		}
+	}
 	if( verification_handle_free(
 	     &ewfverify_verification_handle,
 	     &error ) != 1 )
@@ -724,6 +1075,11 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( results_stream != NULL )
+	{
+		file_stream_close(
+		 results_stream );
+	}
 	if( log_handle != NULL )
 	{
 		log_handle_close(
@@ -733,6 +1089,12 @@ on_error:
 		 &log_handle,
 		 NULL );
 	}
+	if( ewfverify_verification_batch != NULL )
+	{
+		verification_batch_free(
+		 &ewfverify_verification_batch,
+		 NULL );
+	}
 	if( ewfverify_verification_handle != NULL )
 	{
 		verification_handle_close(
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "digest_engine.h"
 #include "digest_hash.h"
 #include "ewftools_libcdata.h"
 #include "ewftools_libcerror.h"
@@ -40,6 +41,10 @@
 extern "C" {
 #endif
 
+#if defined( HAVE_OPEN ) && defined( HAVE_CLOSE ) && defined( HAVE_PWRITE ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && !defined( WINAPI )
+#define HAVE_EXPORT_HANDLE_RAW_OUTPUT_FILE_DESCRIPTOR
+#endif
+
 enum EXPORT_HANDLE_OUTPUT_FORMATS
 {
 	EXPORT_HANDLE_OUTPUT_FORMAT_EWF		= (int) 'e',
@@ -49,6 +54,31 @@ enum EXPORT_HANDLE_OUTPUT_FORMATS
 
 typedef struct export_handle export_handle_t;
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct export_handle_single_file export_handle_single_file_t;
+
+struct export_handle_single_file
+{
+	/* The (single) file entry
+	 */
+	libewf_file_entry_t *file_entry;
+
+	/* The target path
+	 */
+	system_character_t *target_path;
+
+	/* The index of the file entry path in the target path
+	 */
+	size_t file_entry_path_index;
+
+	/* The log handle
+	 */
+	log_handle_t *log_handle;
+};
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 struct export_handle
 {
 	/* The user input buffer
@@ -113,7 +143,7 @@ struct export_handle
 
 	/* The MD5 digest context
 	 */
-	libhmac_md5_context_t *md5_context;
+	digest_engine_md5_context_t *md5_context;
 
 	/* Value to indicate the MD5 digest context was initialized
 	 */
@@ -129,7 +159,7 @@ struct export_handle
 
 	/* The SHA1 digest context
 	 */
-	libhmac_sha1_context_t *sha1_context;
+	digest_engine_sha1_context_t *sha1_context;
 
 	/* Value to indicate the SHA1 digest context was initialized
 	 */
@@ -145,7 +175,7 @@ struct export_handle
 
 	/* The SHA256 digest context
 	 */
-	libhmac_sha256_context_t *sha256_context;
+	digest_engine_sha256_context_t *sha256_context;
 
 	/* Value to indicate the SHA256 digest context was initialized
 	 */
@@ -159,6 +189,11 @@ struct export_handle
 	 */
 	uint8_t use_data_chunk_functions;
 
+	/* Value to indicate if the chunks of the input should be written to the EWF output
+	 * as stored in the input segment files, without being unpacked and packed again
+	 */
+	uint8_t use_chunk_passthrough;
+
 	/* The process buffer size
 	 */
 	size_t process_buffer_size;
@@ -185,6 +220,29 @@ struct export_handle
 	 */
 	libcthreads_queue_t *storage_media_buffer_queue;
 
+	/* The single file thread pool
+	 */
+	libcthreads_thread_pool_t *single_file_thread_pool;
+
+	/* The single file input handle queue
+	 * Contains the lightweight clones of the input handle used by the single file threads
+	 */
+	libcthreads_queue_t *single_file_input_handle_queue;
+
+	/* The single file output mutex
+	 * Serializes the notifications and the error of the single file threads
+	 */
+	libcthreads_mutex_t *single_file_output_mutex;
+
+	/* The error of the first single file thread that failed
+	 */
+	libcerror_error_t *single_file_error;
+
+	/* Value to indicate a single file thread failed
+	 * The remaining single files are skipped
+	 */
+	int single_file_failed;
+
 #endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 	/* The libewf input handle
@@ -195,10 +253,34 @@ struct export_handle
 	 */
 	libsmraw_handle_t *raw_output_handle;
 
+	/* The raw output file descriptor
+	 * Used to write a raw output that consists of a single segment file with pwrite,
+	 * which allows the process threads to write concurrently, or -1 if not set
+	 */
+	int raw_output_file_descriptor;
+
 	/* Value to indicate if stdout should be used
 	 */
 	uint8_t use_stdout;
 
+	/* Value to indicate if the raw output is written at the offset of
+	 * the storage media buffer instead of sequentially by the output thread
+	 */
+	uint8_t use_positional_write;
+
+	/* Value to indicate if ranges of the input that contain only 0-byte values
+	 * should be skipped in the raw output, resulting in a sparse file
+	 */
+	uint8_t use_sparse_output;
+
+	/* The offset of the cached input data range
+	 */
+	off64_t data_range_offset;
+
+	/* The size of the cached input data range
+	 */
+	size64_t data_range_size;
+
 	/* The libewf output handle
 	 */
 	libewf_handle_t *ewf_output_handle;
@@ -287,6 +369,11 @@ int export_handle_open_output(
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int export_handle_open_raw_output_file_descriptor(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 int export_handle_close(
      export_handle_t *export_handle,
      libcerror_error_t **error );
@@ -309,11 +396,36 @@ ssize_t export_handle_write_storage_media_buffer(
          size_t write_size,
          libcerror_error_t **error );
 
+int export_handle_has_single_raw_output(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_supports_chunk_passthrough(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+ssize_t export_handle_write_packed_storage_media_buffer(
+         export_handle_t *export_handle,
+         storage_media_buffer_t *storage_media_buffer,
+         libcerror_error_t **error );
+
+ssize_t export_handle_write_storage_media_buffer_at_offset(
+         export_handle_t *export_handle,
+         storage_media_buffer_t *storage_media_buffer,
+         libcerror_error_t **error );
+
 off64_t export_handle_seek_offset(
          export_handle_t *export_handle,
          off64_t offset,
          libcerror_error_t **error );
 
+int export_handle_get_sparse_size(
+     export_handle_t *export_handle,
+     off64_t offset,
+     size64_t maximum_size,
+     size64_t *sparse_size,
+     libcerror_error_t **error );
+
 int export_handle_swap_byte_pairs(
      export_handle_t *export_handle,
      uint8_t *buffer,
@@ -330,6 +442,11 @@ int export_handle_update_integrity_hash(
      size_t buffer_size,
      libcerror_error_t **error );
 
+int export_handle_update_integrity_hash_with_zeros(
+     export_handle_t *export_handle,
+     size64_t size,
+     libcerror_error_t **error );
+
 int export_handle_finalize_integrity_hash(
      export_handle_t *export_handle,
      libcerror_error_t **error );
@@ -472,6 +589,10 @@ ssize_t export_handle_write(
          size_t input_size,
          libcerror_error_t **error );
 
+int export_handle_copy_input_hashes(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
 ssize_t export_handle_finalize(
          export_handle_t *export_handle,
          libcerror_error_t **error );
@@ -521,6 +642,13 @@ int export_handle_export_file_entry_data(
      const system_character_t *export_path,
      libcerror_error_t **error );
 
+int export_handle_verify_file_entry_md5_hash(
+     export_handle_t *export_handle,
+     libewf_file_entry_t *file_entry,
+     const uint8_t *calculated_md5_hash,
+     size_t calculated_md5_hash_size,
+     libcerror_error_t **error );
+
 int export_handle_export_file_entry_sub_file_entries(
      export_handle_t *export_handle,
      libewf_file_entry_t *file_entry,
@@ -530,11 +658,37 @@ int export_handle_export_file_entry_sub_file_entries(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_single_file_free(
+     export_handle_single_file_t **single_file,
+     libcerror_error_t **error );
+
+int export_handle_push_single_file(
+     export_handle_t *export_handle,
+     libewf_file_entry_t *file_entry,
+     const system_character_t *target_path,
+     size_t target_path_size,
+     size_t file_entry_path_index,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_single_file_callback(
+     export_handle_single_file_t *single_file,
+     export_handle_t *export_handle );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int export_handle_hash_values_fprint(
      export_handle_t *export_handle,
      FILE *stream,
      libcerror_error_t **error );
 
+int export_handle_input_hash_values_fprint(
+     export_handle_t *export_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
 int export_handle_checksum_errors_fprint(
      export_handle_t *export_handle,
      FILE *stream,
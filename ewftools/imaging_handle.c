@@ -34,7 +34,9 @@
 #endif
 
 #include "byte_size_string.h"
+#include "digest_engine.h"
 #include "digest_hash.h"
+#include "digest_pipeline.h"
 #include "ewfcommon.h"
 #include "ewfinput.h"
 #include "ewftools_libcerror.h"
@@ -294,9 +296,25 @@ int imaging_handle_free(
 			memory_free(
 			 ( *imaging_handle )->notes );
 		}
+		if( ( *imaging_handle )->digest_pipeline != NULL )
+		{
+			if( digest_pipeline_free(
+			     &( ( *imaging_handle )->digest_pipeline ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free digest pipeline.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *imaging_handle )->md5_context != NULL )
 		{
-			if( libhmac_md5_free(
+			if( digest_engine_md5_free(
 			     &( ( *imaging_handle )->md5_context ),
 			     error ) != 1 )
 			{
@@ -317,7 +335,7 @@ int imaging_handle_free(
 		}
 		if( ( *imaging_handle )->sha1_context != NULL )
 		{
-			if( libhmac_sha1_free(
+			if( digest_engine_sha1_free(
 			     &( ( *imaging_handle )->sha1_context ),
 			     error ) != 1 )
 			{
@@ -338,7 +356,7 @@ int imaging_handle_free(
 		}
 		if( ( *imaging_handle )->sha256_context != NULL )
 		{
-			if( libhmac_sha256_free(
+			if( digest_engine_sha256_free(
 			     &( ( *imaging_handle )->sha256_context ),
 			     error ) != 1 )
 			{
@@ -357,6 +375,27 @@ int imaging_handle_free(
 			memory_free(
 			 ( *imaging_handle )->calculated_sha256_hash_string );
 		}
+		if( ( *imaging_handle )->blake3_context != NULL )
+		{
+			if( digest_engine_blake3_free(
+			     &( ( *imaging_handle )->blake3_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free BLAKE3 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *imaging_handle )->calculated_blake3_hash_string != NULL )
+		{
+			memory_free(
+			 ( *imaging_handle )->calculated_blake3_hash_string );
+		}
 		if( libewf_handle_free(
 		     &( ( *imaging_handle )->output_handle ),
 		     error ) != 1 )
@@ -613,7 +652,7 @@ int imaging_handle_open_output(
 		                         filenames[ 0 ] );
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libewf_glob_wide(
+		if( libewf_glob_scan_directory_wide(
 		     filenames[ 0 ],
 		     first_filename_length,
 		     LIBEWF_FORMAT_UNKNOWN,
@@ -621,7 +660,7 @@ int imaging_handle_open_output(
 		     &number_of_filenames,
 		     error ) != 1 )
 #else
-		if( libewf_glob(
+		if( libewf_glob_scan_directory(
 		     filenames[ 0 ],
 		     first_filename_length,
 		     LIBEWF_FORMAT_UNKNOWN,
@@ -773,7 +812,7 @@ int imaging_handle_open_secondary_output(
 		                         filenames[ 0 ] );
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libewf_glob_wide(
+		if( libewf_glob_scan_directory_wide(
 		     filenames[ 0 ],
 		     first_filename_length,
 		     LIBEWF_FORMAT_UNKNOWN,
@@ -781,7 +820,7 @@ int imaging_handle_open_secondary_output(
 		     &number_of_filenames,
 		     error ) != 1 )
 #else
-		if( libewf_glob(
+		if( libewf_glob_scan_directory(
 		     filenames[ 0 ],
 		     first_filename_length,
 		     LIBEWF_FORMAT_UNKNOWN,
@@ -1307,7 +1346,7 @@ int imaging_handle_initialize_integrity_hash(
 	}
 	if( imaging_handle->calculate_md5 != 0 )
 	{
-		if( libhmac_md5_initialize(
+		if( digest_engine_md5_initialize(
 		     &( imaging_handle->md5_context ),
 		     error ) != 1 )
 		{
@@ -1324,7 +1363,7 @@ int imaging_handle_initialize_integrity_hash(
 	}
 	if( imaging_handle->calculate_sha1 != 0 )
 	{
-		if( libhmac_sha1_initialize(
+		if( digest_engine_sha1_initialize(
 		     &( imaging_handle->sha1_context ),
 		     error ) != 1 )
 		{
@@ -1341,7 +1380,7 @@ int imaging_handle_initialize_integrity_hash(
 	}
 	if( imaging_handle->calculate_sha256 != 0 )
 	{
-		if( libhmac_sha256_initialize(
+		if( digest_engine_sha256_initialize(
 		     &( imaging_handle->sha256_context ),
 		     error ) != 1 )
 		{
@@ -1356,18 +1395,139 @@ int imaging_handle_initialize_integrity_hash(
 		}
 		imaging_handle->sha256_context_initialized = 1;
 	}
+	/* The BLAKE3 digest hash is not part of the digest pipeline since its leaf
+	 * hashes are calculated on the process thread pool
+	 */
+	if( imaging_handle->calculate_blake3 != 0 )
+	{
+		if( digest_engine_blake3_initialize(
+		     &( imaging_handle->blake3_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize BLAKE3 context.",
+			 function );
+
+			goto on_error;
+		}
+		imaging_handle->blake3_context_initialized = 1;
+	}
+	/* Every digest hash is calculated on its own thread when threads are used
+	 */
+	if( digest_pipeline_initialize(
+	     &( imaging_handle->digest_pipeline ),
+	     (uint8_t) ( imaging_handle->number_of_threads > 0 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create digest pipeline.",
+		 function );
+
+		goto on_error;
+	}
+	if( imaging_handle->calculate_md5 != 0 )
+	{
+		if( digest_pipeline_append_stage(
+		     imaging_handle->digest_pipeline,
+		     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_engine_md5_update,
+		     (intptr_t *) imaging_handle->md5_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append MD5 stage to digest pipeline.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( imaging_handle->calculate_sha1 != 0 )
+	{
+		if( digest_pipeline_append_stage(
+		     imaging_handle->digest_pipeline,
+		     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_engine_sha1_update,
+		     (intptr_t *) imaging_handle->sha1_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append SHA1 stage to digest pipeline.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( imaging_handle->calculate_sha256 != 0 )
+	{
+		if( digest_pipeline_append_stage(
+		     imaging_handle->digest_pipeline,
+		     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_engine_sha256_update,
+		     (intptr_t *) imaging_handle->sha256_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append SHA256 stage to digest pipeline.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( digest_pipeline_start(
+	     imaging_handle->digest_pipeline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start digest pipeline.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
+	if( imaging_handle->digest_pipeline != NULL )
+	{
+		digest_pipeline_free(
+		 &( imaging_handle->digest_pipeline ),
+		 NULL );
+	}
+	if( imaging_handle->blake3_context != NULL )
+	{
+		digest_engine_blake3_free(
+		 &( imaging_handle->blake3_context ),
+		 NULL );
+	}
+	if( imaging_handle->sha256_context != NULL )
+	{
+		digest_engine_sha256_free(
+		 &( imaging_handle->sha256_context ),
+		 NULL );
+	}
 	if( imaging_handle->sha1_context != NULL )
 	{
-		libhmac_sha1_free(
+		digest_engine_sha1_free(
 		 &( imaging_handle->sha1_context ),
 		 NULL );
 	}
 	if( imaging_handle->md5_context != NULL )
 	{
-		libhmac_md5_free(
+		digest_engine_md5_free(
 		 &( imaging_handle->md5_context ),
 		 NULL );
 	}
@@ -1419,59 +1579,20 @@ int imaging_handle_update_integrity_hash(
 
 		return( -1 );
 	}
-	if( imaging_handle->calculate_md5 != 0 )
-	{
-		if( libhmac_md5_update(
-		     imaging_handle->md5_context,
-		     buffer,
-		     buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update MD5 digest hash.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( imaging_handle->calculate_sha1 != 0 )
-	{
-		if( libhmac_sha1_update(
-		     imaging_handle->sha1_context,
-		     buffer,
-		     buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update SHA1 digest hash.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( imaging_handle->calculate_sha256 != 0 )
+	if( digest_pipeline_update(
+	     imaging_handle->digest_pipeline,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
 	{
-		if( libhmac_sha256_update(
-		     imaging_handle->sha256_context,
-		     buffer,
-		     buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update SHA256 digest hash.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest hashes.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
 	return( 1 );
 }
@@ -1486,6 +1607,7 @@ int imaging_handle_finalize_integrity_hash(
 	uint8_t calculated_md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
 	uint8_t calculated_sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
 	uint8_t calculated_sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+	uint8_t calculated_blake3_hash[ DIGEST_ENGINE_BLAKE3_HASH_SIZE ];
 
 	static char *function = "imaging_handle_finalize_integrity_hash";
 
@@ -1500,6 +1622,22 @@ int imaging_handle_finalize_integrity_hash(
 
 		return( -1 );
 	}
+	if( imaging_handle->digest_pipeline != NULL )
+	{
+		if( digest_pipeline_free(
+		     &( imaging_handle->digest_pipeline ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free digest pipeline.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( imaging_handle->calculate_md5 != 0 )
 	{
 		if( imaging_handle->calculated_md5_hash_string == NULL )
@@ -1513,7 +1651,7 @@ int imaging_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_md5_finalize(
+		if( digest_engine_md5_finalize(
 		     imaging_handle->md5_context,
 		     calculated_md5_hash,
 		     LIBHMAC_MD5_HASH_SIZE,
@@ -1558,7 +1696,7 @@ int imaging_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_sha1_finalize(
+		if( digest_engine_sha1_finalize(
 		     imaging_handle->sha1_context,
 		     calculated_sha1_hash,
 		     LIBHMAC_SHA1_HASH_SIZE,
@@ -1603,7 +1741,7 @@ int imaging_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_sha256_finalize(
+		if( digest_engine_sha256_finalize(
 		     imaging_handle->sha256_context,
 		     calculated_sha256_hash,
 		     LIBHMAC_SHA256_HASH_SIZE,
@@ -1635,6 +1773,51 @@ int imaging_handle_finalize_integrity_hash(
 			return( -1 );
 		}
 	}
+	if( imaging_handle->calculate_blake3 != 0 )
+	{
+		if( imaging_handle->calculated_blake3_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid imaging handle - missing calculated BLAKE3 hash string.",
+			 function );
+
+			return( -1 );
+		}
+		if( digest_engine_blake3_finalize(
+		     imaging_handle->blake3_context,
+		     calculated_blake3_hash,
+		     DIGEST_ENGINE_BLAKE3_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize BLAKE3 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( digest_hash_copy_to_string(
+		     calculated_blake3_hash,
+		     DIGEST_ENGINE_BLAKE3_HASH_SIZE,
+		     imaging_handle->calculated_blake3_hash_string,
+		     65,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create calculated BLAKE3 hash string.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -1878,6 +2061,7 @@ int imaging_handle_process_storage_media_buffer_callback(
         libcerror_error_t *error = NULL;
         static char *function    = "imaging_handle_process_storage_media_buffer_callback";
 	ssize_t process_count    = 0;
+	int result               = 0;
 
 	if( storage_media_buffer == NULL )
 	{
@@ -1894,6 +2078,34 @@ int imaging_handle_process_storage_media_buffer_callback(
 	{
 		return( 1 );
 	}
+	/* The BLAKE3 leaf hashes are calculated here so that the output callback
+	 * only needs to merge the chaining value of the buffer
+	 */
+	storage_media_buffer->blake3_chaining_value_is_set = 0;
+
+	if( imaging_handle->calculate_blake3 != 0 )
+	{
+		result = digest_engine_blake3_calculate_subtree_chaining_value(
+		          storage_media_buffer->raw_buffer,
+		          storage_media_buffer->raw_buffer_data_size,
+		          (uint64_t) storage_media_buffer->storage_media_offset,
+		          storage_media_buffer->blake3_chaining_value,
+		          32,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate BLAKE3 chaining value.",
+			 function );
+
+			goto on_error;
+		}
+		storage_media_buffer->blake3_chaining_value_is_set = (uint8_t) result;
+	}
 	process_count = storage_media_buffer_write_process(
 			 storage_media_buffer,
 			 &error );
@@ -2078,6 +2290,39 @@ int imaging_handle_output_storage_media_buffer_callback(
 		{
 			break;
 		}
+		if( imaging_handle->calculate_blake3 != 0 )
+		{
+			if( storage_media_buffer->blake3_chaining_value_is_set != 0 )
+			{
+				result = digest_engine_blake3_update_subtree(
+				          imaging_handle->blake3_context,
+				          storage_media_buffer->blake3_chaining_value,
+				          32,
+				          storage_media_buffer->raw_buffer_data_size,
+				          &error );
+			}
+			else
+			{
+				result = digest_engine_blake3_update(
+				          imaging_handle->blake3_context,
+				          storage_media_buffer->raw_buffer,
+				          storage_media_buffer->raw_buffer_data_size,
+				          &error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update BLAKE3 hash.",
+				 function );
+
+				storage_media_buffer = NULL;
+
+				goto on_error;
+			}
+		}
 		write_count = imaging_handle_write_storage_media_buffer(
 			       imaging_handle,
 			       storage_media_buffer,
@@ -4537,6 +4782,7 @@ int imaging_handle_set_additional_digest_types(
 	size_t string_length                             = 0;
 	size_t string_segment_size                       = 0;
 	uint8_t calculate_sha1                           = 0;
+	uint8_t calculate_blake3                         = 0;
 	uint8_t calculate_sha256                         = 0;
 	int number_of_segments                           = 0;
 	int result                                       = 0;
@@ -4714,6 +4960,20 @@ int imaging_handle_set_additional_digest_types(
 			{
 				calculate_sha256 = 1;
 			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "blake3" ),
+			          6 ) == 0 )
+			{
+				calculate_blake3 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "BLAKE3" ),
+			          6 ) == 0 )
+			{
+				calculate_blake3 = 1;
+			}
 		}
 		else if( string_segment_size == 8 )
 		{
@@ -4785,6 +5045,25 @@ int imaging_handle_set_additional_digest_types(
 		}
 		imaging_handle->calculate_sha256 = 1;
 	}
+	if( ( calculate_blake3 != 0 )
+	 && ( imaging_handle->calculate_blake3 == 0 ) )
+	{
+		imaging_handle->calculated_blake3_hash_string = system_string_allocate(
+		                                                 65 );
+
+		if( imaging_handle->calculated_blake3_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create calculated BLAKE3 digest hash string.",
+			 function );
+
+			goto on_error;
+		}
+		imaging_handle->calculate_blake3 = 1;
+	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( libcsplit_wide_split_string_free(
 	     &string_elements,
@@ -6113,13 +6392,13 @@ int imaging_handle_start(
 on_error:
 	if( imaging_handle->sha1_context != NULL )
 	{
-		libhmac_sha1_free(
+		digest_engine_sha1_free(
 		 &( imaging_handle->sha1_context ),
 		 NULL );
 	}
 	if( imaging_handle->md5_context != NULL )
 	{
-		libhmac_md5_free(
+		digest_engine_md5_free(
 		 &( imaging_handle->md5_context ),
 		 NULL );
 	}
@@ -6225,6 +6504,28 @@ int imaging_handle_update(
 
 		return( -1 );
 	}
+	/* When threads are used the BLAKE3 digest hash is updated by the output callback
+	 */
+	if( ( imaging_handle->calculate_blake3 != 0 )
+	 && ( ( imaging_handle->last_offset_written < resume_acquiry_offset )
+	  || ( imaging_handle->number_of_threads == 0 ) ) )
+	{
+		if( digest_engine_blake3_update(
+		     imaging_handle->blake3_context,
+		     data,
+		     (size_t) read_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update BLAKE3 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( imaging_handle->last_offset_written < resume_acquiry_offset )
 	{
 		imaging_handle->last_offset_written += (off64_t) read_count;
@@ -6397,6 +6698,26 @@ int imaging_handle_stop(
 				return( -1 );
 			}
 		}
+		if( imaging_handle->calculate_blake3 != 0 )
+		{
+			if( imaging_handle_set_hash_value(
+			     imaging_handle,
+			     "BLAKE3",
+			     6,
+			     imaging_handle->calculated_blake3_hash_string,
+			     64,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set hash value: BLAKE3.",
+				 function );
+
+				return( -1 );
+			}
+		}
 		write_count = libewf_handle_write_finalize(
 		               imaging_handle->output_handle,
 		               error );
@@ -7085,6 +7406,13 @@ int imaging_handle_print_hashes(
 		 "SHA256 hash calculated over data:\t%" PRIs_SYSTEM "\n",
 		 imaging_handle->calculated_sha256_hash_string );
 	}
+	if( imaging_handle->calculate_blake3 != 0 )
+	{
+		fprintf(
+		 stream,
+		 "BLAKE3 hash calculated over data:\t%" PRIs_SYSTEM "\n",
+		 imaging_handle->calculated_blake3_hash_string );
+	}
 	return( 1 );
 }
 
@@ -26,6 +26,8 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "digest_engine.h"
+#include "digest_pipeline.h"
 #include "ewftools_libcdata.h"
 #include "ewftools_libcerror.h"
 #include "ewftools_libcthreads.h"
@@ -160,7 +162,7 @@ struct imaging_handle
 
 	/* The MD5 digest context
 	 */
-	libhmac_md5_context_t *md5_context;
+	digest_engine_md5_context_t *md5_context;
 
 	/* Value to indicate the MD5 digest context was initialized
 	 */
@@ -176,7 +178,7 @@ struct imaging_handle
 
 	/* The SHA1 digest context
 	 */
-	libhmac_sha1_context_t *sha1_context;
+	digest_engine_sha1_context_t *sha1_context;
 
 	/* Value to indicate the SHA1 digest context was initialized
 	 */
@@ -192,16 +194,37 @@ struct imaging_handle
 
 	/* The SHA256 digest context
 	 */
-	libhmac_sha256_context_t *sha256_context;
+	digest_engine_sha256_context_t *sha256_context;
 
 	/* Value to indicate the SHA256 digest context was initialized
 	 */
 	uint8_t sha256_context_initialized;
 
+	/* The digest pipeline
+	 * Used to calculate the digest hashes in parallel
+	 */
+	digest_pipeline_t *digest_pipeline;
+
 	/* The calculated SHA256 digest hash string
 	 */
 	system_character_t *calculated_sha256_hash_string;
 
+	/* Value to indicate if the BLAKE3 digest hash should be calculated
+	 */
+	uint8_t calculate_blake3;
+
+	/* The BLAKE3 digest context
+	 */
+	digest_engine_blake3_context_t *blake3_context;
+
+	/* Value to indicate the BLAKE3 digest context was initialized
+	 */
+	uint8_t blake3_context_initialized;
+
+	/* The calculated BLAKE3 digest hash string
+	 */
+	system_character_t *calculated_blake3_hash_string;
+
 	/* Value to indicate if the data chunk functions instead of the buffered read and write functions should be used
 	 */
 	uint8_t use_data_chunk_functions;
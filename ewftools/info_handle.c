@@ -401,7 +401,7 @@ int info_handle_open_input(
 		                         filenames[ 0 ] );
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libewf_glob_wide(
+		if( libewf_glob_scan_directory_wide(
 		     filenames[ 0 ],
 		     first_filename_length,
 		     LIBEWF_FORMAT_UNKNOWN,
@@ -409,7 +409,7 @@ int info_handle_open_input(
 		     &number_of_filenames,
 		     error ) != 1 )
 #else
-		if( libewf_glob(
+		if( libewf_glob_scan_directory(
 		     filenames[ 0 ],
 		     first_filename_length,
 		     LIBEWF_FORMAT_UNKNOWN,
@@ -371,7 +371,7 @@ int mount_handle_open(
 		                   filenames[ 0 ] );
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libewf_glob_wide(
+		if( libewf_glob_scan_directory_wide(
 		     filenames[ 0 ],
 		     filename_length,
 		     LIBEWF_FORMAT_UNKNOWN,
@@ -379,7 +379,7 @@ int mount_handle_open(
 		     &number_of_filenames,
 		     error ) != 1 )
 #else
-		if( libewf_glob(
+		if( libewf_glob_scan_directory(
 		     filenames[ 0 ],
 		     filename_length,
 		     LIBEWF_FORMAT_UNKNOWN,
@@ -427,6 +427,7 @@ ssize_t storage_media_buffer_read_from_handle(
 		storage_media_buffer->raw_buffer_data_size = (size_t) read_count;
 	}
 	storage_media_buffer->requested_size = read_size;
+	storage_media_buffer->is_sparse      = 0;
 
 	return( read_count );
 }
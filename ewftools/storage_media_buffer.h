@@ -77,6 +77,24 @@ struct storage_media_buffer
 	/* Value to indicate the data is corrupted
 	 */
 	uint8_t is_corrupted;
+
+	/* Value to indicate the buffer represents a range that contains only 0-byte values
+	 * The data of a sparse buffer is not read and the processed size contains the size of the range
+	 */
+	uint8_t is_sparse;
+
+	/* The BLAKE3 subtree chaining value of the data
+	 */
+	uint8_t blake3_chaining_value[ 32 ];
+
+	/* Value to indicate the BLAKE3 subtree chaining value was calculated
+	 */
+	uint8_t blake3_chaining_value_is_set;
+
+	/* The owner of the buffer
+	 * Used when the buffer is processed by a thread pool that is shared by multiple handles
+	 */
+	intptr_t *owner;
 };
 
 int storage_media_buffer_initialize(
@@ -0,0 +1,2648 @@
+/*
+ * Batch verification of multiple images
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#include "ewftools_libcdata.h"
+#include "ewftools_libcerror.h"
+#include "ewftools_libcnotify.h"
+#include "ewftools_libcthreads.h"
+#include "ewftools_libewf.h"
+#include "ewftools_system_string.h"
+#include "log_handle.h"
+#include "verification_batch.h"
+#include "verification_handle.h"
+
+#define VERIFICATION_BATCH_NOTIFY_STREAM	stdout
+
+/* Retrieves a string representation of a job status
+ */
+const char *verification_batch_get_job_status_string(
+             int status )
+{
+	switch( status )
+	{
+		case VERIFICATION_BATCH_JOB_STATUS_PENDING:
+			return( "PENDING" );
+
+		case VERIFICATION_BATCH_JOB_STATUS_RUNNING:
+			return( "RUNNING" );
+
+		case VERIFICATION_BATCH_JOB_STATUS_SUCCESS:
+			return( "SUCCESS" );
+
+		case VERIFICATION_BATCH_JOB_STATUS_FAILURE:
+			return( "FAILURE" );
+
+		case VERIFICATION_BATCH_JOB_STATUS_ABORTED:
+			return( "ABORTED" );
+
+		default:
+			break;
+	}
+	return( "ERROR" );
+}
+
+/* Creates a verification batch job
+ * Make sure the value job is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_job_initialize(
+     verification_batch_job_t **job,
+     verification_batch_t *batch,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_batch_job_initialize";
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *job != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid job value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*job = memory_allocate_structure(
+	        verification_batch_job_t );
+
+	if( *job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create job.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *job,
+	     0,
+	     sizeof( verification_batch_job_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear job.",
+		 function );
+
+		memory_free(
+		 *job );
+
+		*job = NULL;
+
+		return( -1 );
+	}
+	( *job )->filename = system_string_allocate(
+	                      filename_length + 1 );
+
+	if( ( *job )->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *job )->filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	( *job )->filename[ filename_length ] = 0;
+
+	( *job )->batch  = batch;
+	( *job )->status = VERIFICATION_BATCH_JOB_STATUS_PENDING;
+
+	return( 1 );
+
+on_error:
+	if( *job != NULL )
+	{
+		if( ( *job )->filename != NULL )
+		{
+			memory_free(
+			 ( *job )->filename );
+		}
+		memory_free(
+		 *job );
+
+		*job = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a verification batch job
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_job_free(
+     verification_batch_job_t **job,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_batch_job_free";
+	int result            = 1;
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *job != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *job )->thread != NULL )
+		{
+			if( libcthreads_thread_join(
+			     &( ( *job )->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( verification_batch_job_close_streams(
+		     *job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to close streams.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *job )->verification_handle != NULL )
+		{
+			if( verification_handle_free(
+			     &( ( *job )->verification_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free verification handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *job )->filename != NULL )
+		{
+			memory_free(
+			 ( *job )->filename );
+		}
+		memory_free(
+		 *job );
+
+		*job = NULL;
+	}
+	return( result );
+}
+
+/* Determines the identifier of the device the image is stored on
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int verification_batch_job_get_device_identifier(
+     verification_batch_job_t *job,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	struct stat file_statistics;
+#endif
+
+	static char *function = "verification_batch_job_get_device_identifier";
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	job->device_identifier = 0;
+
+#if defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* A missing image is reported when it is opened
+	 */
+	if( stat(
+	     job->filename,
+	     &file_statistics ) != 0 )
+	{
+		return( 0 );
+	}
+	job->device_identifier = (uint64_t) file_statistics.st_dev;
+
+	return( 1 );
+#else
+	/* All images are considered to be stored on the same device
+	 */
+	return( 0 );
+#endif
+}
+
+/* Verifies the image of a verification batch job
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_job_run(
+     verification_batch_job_t *job,
+     libcerror_error_t **error )
+{
+	verification_batch_t *batch                = NULL;
+	verification_handle_t *settings_handle     = NULL;
+	verification_handle_t *verification_handle = NULL;
+	static char *function                      = "verification_batch_job_run";
+	int maximum_number_of_open_handles         = 0;
+	int result                                 = 0;
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( job->batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid job - missing batch.",
+		 function );
+
+		return( -1 );
+	}
+	batch = job->batch;
+
+	if( batch->settings_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid job - missing settings handle.",
+		 function );
+
+		return( -1 );
+	}
+	settings_handle = batch->settings_handle;
+
+	if( job->verification_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid job - verification handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	job->status = VERIFICATION_BATCH_JOB_STATUS_ERROR;
+
+	/* The output of the verification is kept until the job has finished
+	 * so that the output of concurrent jobs is not interleaved
+	 */
+	job->report_stream = tmpfile();
+
+	if( job->report_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create report stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( batch->log_handle != NULL )
+	{
+		if( log_handle_initialize(
+		     &( job->log_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create log handle.",
+			 function );
+
+			goto on_error;
+		}
+		job->log_handle->log_stream = tmpfile();
+
+		if( job->log_handle->log_stream == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to create log stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle_initialize(
+	     &verification_handle,
+	     settings_handle->calculate_md5,
+	     settings_handle->use_data_chunk_functions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create verification handle.",
+		 function );
+
+		goto on_error;
+	}
+	verification_handle->header_codepage     = settings_handle->header_codepage;
+	verification_handle->process_buffer_size = settings_handle->process_buffer_size;
+	verification_handle->number_of_threads   = settings_handle->number_of_threads;
+	verification_handle->checksum_only       = settings_handle->checksum_only;
+	verification_handle->notify_stream       = job->report_stream;
+
+	if( batch->additional_digest_types != NULL )
+	{
+		if( verification_handle_set_additional_digest_types(
+		     verification_handle,
+		     batch->additional_digest_types,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set additional digest types.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch->process_thread_pool != NULL )
+	{
+		if( verification_handle_set_shared_process_thread_pool(
+		     verification_handle,
+		     batch->process_thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set shared process thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( batch->maximum_number_of_open_handles > 0 )
+	{
+		/* The open file handles are divided over the concurrent jobs
+		 */
+		maximum_number_of_open_handles = batch->maximum_number_of_open_handles;
+
+		if( batch->maximum_number_of_concurrent_jobs > 1 )
+		{
+			maximum_number_of_open_handles /= batch->maximum_number_of_concurrent_jobs;
+		}
+		if( maximum_number_of_open_handles == 0 )
+		{
+			maximum_number_of_open_handles = 1;
+		}
+		if( verification_handle_set_maximum_number_of_open_handles(
+		     verification_handle,
+		     maximum_number_of_open_handles,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum number of open handles.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The verification handle is kept until the batch is freed
+	 * so that it can be signalled to abort
+	 */
+	job->verification_handle = verification_handle;
+
+	if( batch->abort != 0 )
+	{
+		job->status = VERIFICATION_BATCH_JOB_STATUS_ABORTED;
+
+		return( 1 );
+	}
+	/* A single filename is expanded to the segment files of the image
+	 */
+	if( verification_handle_open_input(
+	     verification_handle,
+	     &( job->filename ),
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open image: %" PRIs_SYSTEM ".",
+		 function,
+		 job->filename );
+
+		goto on_error;
+	}
+	if( verification_handle_set_zero_chunk_on_error(
+	     verification_handle,
+	     batch->zero_chunk_on_error,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set zero on chunk error.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->checksum_only != 0 )
+	{
+		result = verification_handle_verify_chunk_integrity(
+		          verification_handle,
+		          0,
+		          job->log_handle,
+		          error );
+	}
+	else
+	{
+		result = verification_handle_verify_input(
+		          verification_handle,
+		          0,
+		          job->log_handle,
+		          error );
+	}
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify input.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_get_number_of_checksum_errors(
+	     verification_handle->input_handle,
+	     &( job->number_of_checksum_errors ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the number of checksum errors.",
+		 function );
+
+		goto on_error;
+	}
+	job->media_size = verification_handle->media_size;
+
+	if( verification_handle->calculate_md5 != 0 )
+	{
+		if( system_string_copy(
+		     job->md5_hash_string,
+		     verification_handle->calculated_md5_hash_string,
+		     33 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy MD5 hash string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->calculate_sha1 != 0 )
+	{
+		if( system_string_copy(
+		     job->sha1_hash_string,
+		     verification_handle->calculated_sha1_hash_string,
+		     41 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy SHA1 hash string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->calculate_sha256 != 0 )
+	{
+		if( system_string_copy(
+		     job->sha256_hash_string,
+		     verification_handle->calculated_sha256_hash_string,
+		     65 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy SHA256 hash string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->calculate_blake3 != 0 )
+	{
+		if( system_string_copy(
+		     job->blake3_hash_string,
+		     verification_handle->calculated_blake3_hash_string,
+		     65 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy BLAKE3 hash string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle_close(
+	     verification_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close verification handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->abort != 0 )
+	{
+		job->status = VERIFICATION_BATCH_JOB_STATUS_ABORTED;
+	}
+	else if( result == 1 )
+	{
+		job->status = VERIFICATION_BATCH_JOB_STATUS_SUCCESS;
+	}
+	else
+	{
+		job->status = VERIFICATION_BATCH_JOB_STATUS_FAILURE;
+	}
+	return( 1 );
+
+on_error:
+	if( verification_handle != NULL )
+	{
+		verification_handle_close(
+		 verification_handle,
+		 NULL );
+
+		if( verification_handle->abort != 0 )
+		{
+			job->status = VERIFICATION_BATCH_JOB_STATUS_ABORTED;
+		}
+		if( job->verification_handle == NULL )
+		{
+			verification_handle_free(
+			 &verification_handle,
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Verifies the image of a verification batch job and reports the result
+ * Callback function for the job thread
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_job_thread_callback(
+     verification_batch_job_t *job )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "verification_batch_job_thread_callback";
+	int result               = 0;
+
+	if( job == NULL )
+	{
+		return( -1 );
+	}
+	result = verification_batch_job_run(
+	          job,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify image: %" PRIs_SYSTEM ".",
+		 function,
+		 job->filename );
+
+		if( job->report_stream != NULL )
+		{
+			libcerror_error_backtrace_fprint(
+			 error,
+			 job->report_stream );
+		}
+		libcerror_error_free(
+		 &error );
+	}
+	/* Always account for the job, otherwise the batch would wait indefinitely
+	 */
+	if( libcthreads_mutex_grab(
+	     job->batch->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_batch_job_report_fprint(
+	     job,
+	     job->batch->notify_stream,
+	     job->batch->log_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print report.",
+		 function );
+
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+
+		result = -1;
+	}
+	job->is_finished = 1;
+
+	job->batch->number_of_finished_jobs += 1;
+
+	if( libcthreads_condition_broadcast(
+	     job->batch->job_finished_condition,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast job finished condition.",
+		 function );
+
+		libcthreads_mutex_release(
+		 job->batch->mutex,
+		 NULL );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_release(
+	     job->batch->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Copies the remaining data of a (temporary) stream to another stream
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_copy_stream(
+     FILE *source_stream,
+     FILE *destination_stream,
+     libcerror_error_t **error )
+{
+	uint8_t buffer[ 1024 ];
+
+	static char *function = "verification_batch_copy_stream";
+	size_t read_count     = 0;
+
+	if( source_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination stream.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		read_count = file_stream_read(
+		              source_stream,
+		              buffer,
+		              1024 );
+
+		if( read_count > 0 )
+		{
+			if( file_stream_write(
+			     destination_stream,
+			     buffer,
+			     read_count ) != read_count )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write to destination stream.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	while( read_count == 1024 );
+
+	if( ferror(
+	     source_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from source stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the report of a finished verification batch job
+ * The report and log streams of the job are closed afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_job_report_fprint(
+     verification_batch_job_t *job,
+     FILE *stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_batch_job_report_fprint";
+	int result            = 1;
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "Image: %" PRIs_SYSTEM "\n",
+	 job->filename );
+
+	if( job->report_stream != NULL )
+	{
+		rewind(
+		 job->report_stream );
+
+		if( verification_batch_copy_stream(
+		     job->report_stream,
+		     stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print report.",
+			 function );
+
+			result = -1;
+		}
+	}
+	fprintf(
+	 stream,
+	 "Image: %" PRIs_SYSTEM ": %s\n\n",
+	 job->filename,
+	 verification_batch_get_job_status_string(
+	  job->status ) );
+
+	if( ( log_handle != NULL )
+	 && ( log_handle->log_stream != NULL ) )
+	{
+		fprintf(
+		 log_handle->log_stream,
+		 "Image: %" PRIs_SYSTEM "\n",
+		 job->filename );
+
+		if( ( job->log_handle != NULL )
+		 && ( job->log_handle->log_stream != NULL ) )
+		{
+			rewind(
+			 job->log_handle->log_stream );
+
+			if( verification_batch_copy_stream(
+			     job->log_handle->log_stream,
+			     log_handle->log_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print log.",
+				 function );
+
+				result = -1;
+			}
+		}
+		fprintf(
+		 log_handle->log_stream,
+		 "Status: %s\n\n",
+		 verification_batch_get_job_status_string(
+		  job->status ) );
+	}
+	if( verification_batch_job_close_streams(
+	     job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to close streams.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Closes the report and log streams of a verification batch job
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_job_close_streams(
+     verification_batch_job_t *job,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_batch_job_close_streams";
+	int result            = 1;
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( job->verification_handle != NULL )
+	{
+		job->verification_handle->notify_stream = NULL;
+	}
+	if( job->report_stream != NULL )
+	{
+		if( file_stream_close(
+		     job->report_stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close report stream.",
+			 function );
+
+			result = -1;
+		}
+		job->report_stream = NULL;
+	}
+	if( job->log_handle != NULL )
+	{
+		if( log_handle_close(
+		     job->log_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close log handle.",
+			 function );
+
+			result = -1;
+		}
+		if( log_handle_free(
+		     &( job->log_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free log handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Creates a verification batch
+ * Make sure the value batch is referencing, is set to NULL
+ * The settings of the verification handle are used for every image
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_initialize(
+     verification_batch_t **batch,
+     verification_handle_t *settings_handle,
+     const system_character_t *additional_digest_types,
+     uint8_t zero_chunk_on_error,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_batch_initialize";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( settings_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid settings handle.",
+		 function );
+
+		return( -1 );
+	}
+	*batch = memory_allocate_structure(
+	          verification_batch_t );
+
+	if( *batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *batch,
+	     0,
+	     sizeof( verification_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch.",
+		 function );
+
+		memory_free(
+		 *batch );
+
+		*batch = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *batch )->jobs ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create jobs array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *batch )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *batch )->job_finished_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create job finished condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *batch )->settings_handle                   = settings_handle;
+	( *batch )->additional_digest_types           = additional_digest_types;
+	( *batch )->zero_chunk_on_error               = zero_chunk_on_error;
+	( *batch )->maximum_number_of_jobs_per_device = 1;
+	( *batch )->maximum_number_of_concurrent_jobs = 1;
+	( *batch )->notify_stream                     = VERIFICATION_BATCH_NOTIFY_STREAM;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Small images do not use all the process threads hence
+	 * as many images as there are process threads are verified concurrently
+	 */
+	if( settings_handle->number_of_threads > 1 )
+	{
+		( *batch )->maximum_number_of_concurrent_jobs = settings_handle->number_of_threads;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *batch != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *batch )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *batch )->mutex ),
+			 NULL );
+		}
+#endif
+		if( ( *batch )->jobs != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *batch )->jobs ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 *batch );
+
+		*batch = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a verification batch
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_free(
+     verification_batch_t **batch,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_batch_free";
+	int result            = 1;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch != NULL )
+	{
+		/* The jobs are freed first since they join their threads
+		 */
+		if( libcdata_array_free(
+		     &( ( *batch )->jobs ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &verification_batch_job_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free jobs array.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *batch )->process_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *batch )->process_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join process thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_condition_free(
+		     &( ( *batch )->job_finished_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free job finished condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *batch )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *batch );
+
+		*batch = NULL;
+	}
+	return( result );
+}
+
+/* Signals the verification batch to abort
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_signal_abort(
+     verification_batch_t *batch,
+     libcerror_error_t **error )
+{
+	verification_batch_job_t *job = NULL;
+	static char *function         = "verification_batch_signal_abort";
+	int job_index                 = 0;
+	int number_of_jobs            = 0;
+	int result                    = 1;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	batch->abort = 1;
+
+	/* The jobs are not added or removed while the images are verified
+	 * hence the jobs array can be accessed without grabbing the mutex
+	 */
+	if( libcdata_array_get_number_of_entries(
+	     batch->jobs,
+	     &number_of_jobs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of jobs.",
+		 function );
+
+		return( -1 );
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     batch->jobs,
+		     job_index,
+		     (intptr_t **) &job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve job: %d.",
+			 function,
+			 job_index );
+
+			return( -1 );
+		}
+		if( ( job != NULL )
+		 && ( job->verification_handle != NULL ) )
+		{
+			if( verification_handle_signal_abort(
+			     job->verification_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to signal verification handle of job: %d to abort.",
+				 function,
+				 job_index );
+
+				result = -1;
+			}
+		}
+	}
+	return( result );
+}
+
+/* Sets the maximum number of open handles
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_set_maximum_number_of_open_handles(
+     verification_batch_t *batch,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_batch_set_maximum_number_of_open_handles";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_handles < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open handles value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	batch->maximum_number_of_open_handles = maximum_number_of_open_handles;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of images that are verified concurrently per device
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int verification_batch_set_maximum_number_of_jobs_per_device(
+     verification_batch_t *batch,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function   = "verification_batch_set_maximum_number_of_jobs_per_device";
+	size_t string_length    = 0;
+	uint64_t number_of_jobs = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == (system_character_t) '-' )
+	{
+		return( 0 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ewftools_system_string_decimal_copy_to_64_bit(
+	     string,
+	     string_length + 1,
+	     &number_of_jobs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of jobs per device.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_jobs == 0 )
+	 || ( number_of_jobs > 32 ) )
+	{
+		return( 0 );
+	}
+	batch->maximum_number_of_jobs_per_device = (int) number_of_jobs;
+
+	return( 1 );
+}
+
+/* Retrieves the number of images
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_get_number_of_images(
+     verification_batch_t *batch,
+     int *number_of_images,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_batch_get_number_of_images";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     batch->jobs,
+	     number_of_images,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of jobs.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an image to the verification batch
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_append_image(
+     verification_batch_t *batch,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	verification_batch_job_t *job = NULL;
+	static char *function         = "verification_batch_append_image";
+	int entry_index               = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_batch_job_initialize(
+	     &job,
+	     batch,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create job.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_batch_job_get_device_identifier(
+	     job,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine device identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     batch->jobs,
+	     &entry_index,
+	     (intptr_t *) job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append job to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( job != NULL )
+	{
+		verification_batch_job_free(
+		 &job,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a manifest and appends the images it contains
+ * The manifest contains the filename of the (first segment file of the) image per line,
+ * empty lines and lines starting with # are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_read_manifest(
+     verification_batch_t *batch,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t line[ VERIFICATION_BATCH_MAXIMUM_MANIFEST_LINE_SIZE ];
+
+	FILE *manifest_stream             = NULL;
+	system_character_t *result_string = NULL;
+	static char *function             = "verification_batch_read_manifest";
+	size_t line_index                 = 0;
+	size_t line_length                = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	manifest_stream = file_stream_open_wide(
+	                   filename,
+	                   _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	manifest_stream = file_stream_open(
+	                   filename,
+	                   FILE_STREAM_OPEN_READ );
+#endif
+	if( manifest_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open manifest: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	while( file_stream_at_end(
+	        manifest_stream ) == 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result_string = file_stream_get_string_wide(
+		                 manifest_stream,
+		                 line,
+		                 VERIFICATION_BATCH_MAXIMUM_MANIFEST_LINE_SIZE );
+#else
+		result_string = file_stream_get_string(
+		                 manifest_stream,
+		                 line,
+		                 VERIFICATION_BATCH_MAXIMUM_MANIFEST_LINE_SIZE );
+#endif
+		if( result_string == NULL )
+		{
+			break;
+		}
+		line_length = system_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] != (system_character_t) '\n' )
+		 && ( file_stream_at_end(
+		       manifest_stream ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: line in manifest exceeds maximum size.",
+			 function );
+
+			goto on_error;
+		}
+		/* Strip the end-of-line and trailing white space
+		 */
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == (system_character_t) '\n' )
+		     ||  ( line[ line_length - 1 ] == (system_character_t) '\r' )
+		     ||  ( line[ line_length - 1 ] == (system_character_t) '\t' )
+		     ||  ( line[ line_length - 1 ] == (system_character_t) ' ' ) ) )
+		{
+			line_length--;
+		}
+		/* Strip leading white space
+		 */
+		for( line_index = 0;
+		     line_index < line_length;
+		     line_index++ )
+		{
+			if( ( line[ line_index ] != (system_character_t) '\t' )
+			 && ( line[ line_index ] != (system_character_t) ' ' ) )
+			{
+				break;
+			}
+		}
+		if( ( line_index >= line_length )
+		 || ( line[ line_index ] == (system_character_t) '#' ) )
+		{
+			continue;
+		}
+		if( verification_batch_append_image(
+		     batch,
+		     &( line[ line_index ] ),
+		     line_length - line_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append image.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     manifest_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close manifest.",
+		 function );
+
+		manifest_stream = NULL;
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( manifest_stream != NULL )
+	{
+		file_stream_close(
+		 manifest_stream );
+	}
+	return( -1 );
+}
+
+/* Retrieves the next job that can be started
+ * A job can be started when the maximum number of concurrent jobs and
+ * the maximum number of jobs of the device the image is stored on have not been reached
+ * Returns 1 if successful, 0 if no job can be started or -1 on error
+ */
+int verification_batch_get_next_job(
+     verification_batch_t *batch,
+     verification_batch_job_t **job,
+     libcerror_error_t **error )
+{
+	verification_batch_job_t *active_job = NULL;
+	verification_batch_job_t *safe_job   = NULL;
+	static char *function                = "verification_batch_get_next_job";
+	int active_job_index                 = 0;
+	int job_index                        = 0;
+	int number_of_device_jobs            = 0;
+	int number_of_jobs                   = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	*job = NULL;
+
+	if( batch->number_of_active_jobs >= batch->maximum_number_of_concurrent_jobs )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     batch->jobs,
+	     &number_of_jobs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of jobs.",
+		 function );
+
+		return( -1 );
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     batch->jobs,
+		     job_index,
+		     (intptr_t **) &safe_job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve job: %d.",
+			 function,
+			 job_index );
+
+			return( -1 );
+		}
+		if( safe_job == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing job: %d.",
+			 function,
+			 job_index );
+
+			return( -1 );
+		}
+		if( ( safe_job->is_active != 0 )
+		 || ( safe_job->is_finished != 0 ) )
+		{
+			continue;
+		}
+		/* Limit the number of images that are read concurrently from the same device
+		 * since concurrent reads from a single (rotational) device degrade its throughput
+		 */
+		number_of_device_jobs = 0;
+
+		for( active_job_index = 0;
+		     active_job_index < number_of_jobs;
+		     active_job_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     batch->jobs,
+			     active_job_index,
+			     (intptr_t **) &active_job,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve job: %d.",
+				 function,
+				 active_job_index );
+
+				return( -1 );
+			}
+			if( ( active_job != NULL )
+			 && ( active_job->is_active != 0 )
+			 && ( active_job->device_identifier == safe_job->device_identifier ) )
+			{
+				number_of_device_jobs++;
+			}
+		}
+		if( number_of_device_jobs < batch->maximum_number_of_jobs_per_device )
+		{
+			*job = safe_job;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Starts a job
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_start_job(
+     verification_batch_t *batch,
+     verification_batch_job_t *job,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_batch_start_job";
+
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *job_error = NULL;
+	int result                   = 0;
+#endif
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( job->is_active != 0 )
+	 || ( job->is_finished != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid job - already started.",
+		 function );
+
+		return( -1 );
+	}
+	job->status    = VERIFICATION_BATCH_JOB_STATUS_RUNNING;
+	job->is_active = 1;
+
+	batch->number_of_active_jobs += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_thread_create(
+	     &( job->thread ),
+	     NULL,
+	     (int (*)(void *)) &verification_batch_job_thread_callback,
+	     (void *) job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create job thread.",
+		 function );
+
+		job->status      = VERIFICATION_BATCH_JOB_STATUS_ERROR;
+		job->is_active   = 0;
+		job->is_finished = 1;
+
+		batch->number_of_active_jobs -= 1;
+
+		return( -1 );
+	}
+#else
+	result = verification_batch_job_run(
+	          job,
+	          &job_error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &job_error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify image: %" PRIs_SYSTEM ".",
+		 function,
+		 job->filename );
+
+		if( job->report_stream != NULL )
+		{
+			libcerror_error_backtrace_fprint(
+			 job_error,
+			 job->report_stream );
+		}
+		libcerror_error_free(
+		 &job_error );
+	}
+	job->is_active   = 0;
+	job->is_finished = 1;
+
+	batch->number_of_active_jobs -= 1;
+
+	if( verification_batch_job_report_fprint(
+	     job,
+	     batch->notify_stream,
+	     batch->log_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print report.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+}
+
+/* Joins the threads of the jobs that have finished
+ * The mutex must be grabbed when calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_join_jobs(
+     verification_batch_t *batch,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	verification_batch_job_t *job = NULL;
+	int job_index                 = 0;
+	int number_of_jobs            = 0;
+#endif
+
+	static char *function         = "verification_batch_join_jobs";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch->number_of_finished_jobs == 0 )
+	{
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     batch->jobs,
+	     &number_of_jobs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of jobs.",
+		 function );
+
+		return( -1 );
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     batch->jobs,
+		     job_index,
+		     (intptr_t **) &job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve job: %d.",
+			 function,
+			 job_index );
+
+			return( -1 );
+		}
+		if( ( job == NULL )
+		 || ( job->is_active == 0 )
+		 || ( job->is_finished == 0 ) )
+		{
+			continue;
+		}
+		/* The job thread no longer needs the mutex once it has flagged itself finished
+		 */
+		if( libcthreads_thread_join(
+		     &( job->thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread of job: %d.",
+			 function,
+			 job_index );
+
+			return( -1 );
+		}
+		job->is_active = 0;
+
+		batch->number_of_active_jobs   -= 1;
+		batch->number_of_finished_jobs -= 1;
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+}
+
+/* Verifies the images in the batch
+ * The images are verified concurrently where the storage media buffers of all the images
+ * are processed by a single shared process thread pool
+ * Returns 1 if all images verified successfully, 0 if not or -1 on error
+ */
+int verification_batch_verify(
+     verification_batch_t *batch,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	verification_batch_job_t *job = NULL;
+	static char *function         = "verification_batch_verify";
+	int job_index                 = 0;
+	int number_of_jobs            = 0;
+	int result                    = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int mutex_is_grabbed          = 0;
+#endif
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch->settings_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch - missing settings handle.",
+		 function );
+
+		return( -1 );
+	}
+	batch->log_handle = log_handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( batch->settings_handle->number_of_threads != 0 )
+	 && ( batch->process_thread_pool == NULL ) )
+	{
+		if( libcthreads_thread_pool_create(
+		     &( batch->process_thread_pool ),
+		     NULL,
+		     batch->settings_handle->number_of_threads,
+		     VERIFICATION_BATCH_MAXIMUM_NUMBER_OF_QUEUED_BUFFERS,
+		     (int (*)(intptr_t *, void *)) &verification_handle_process_shared_storage_media_buffer_callback,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize shared process thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     batch->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	mutex_is_grabbed = 1;
+
+	do
+	{
+		if( verification_batch_join_jobs(
+		     batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join finished jobs.",
+			 function );
+
+			goto on_error;
+		}
+		while( batch->abort == 0 )
+		{
+			result = verification_batch_get_next_job(
+			          batch,
+			          &job,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next job.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( verification_batch_start_job(
+			     batch,
+			     job,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to start job.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		while( ( batch->number_of_active_jobs > 0 )
+		    && ( batch->number_of_finished_jobs == 0 ) )
+		{
+			if( libcthreads_condition_wait(
+			     batch->job_finished_condition,
+			     batch->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for job finished condition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	while( batch->number_of_active_jobs > 0 );
+
+	mutex_is_grabbed = 0;
+
+	if( libcthreads_mutex_release(
+	     batch->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( batch->process_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( batch->process_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join shared process thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#else
+	while( batch->abort == 0 )
+	{
+		result = verification_batch_get_next_job(
+		          batch,
+		          &job,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next job.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( verification_batch_start_job(
+		     batch,
+		     job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to start job.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( libcdata_array_get_number_of_entries(
+	     batch->jobs,
+	     &number_of_jobs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of jobs.",
+		 function );
+
+		goto on_error;
+	}
+	result = 1;
+
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     batch->jobs,
+		     job_index,
+		     (intptr_t **) &job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve job: %d.",
+			 function,
+			 job_index );
+
+			goto on_error;
+		}
+		if( job == NULL )
+		{
+			continue;
+		}
+		/* Images that were not started before the abort are reported as aborted
+		 */
+		if( job->status == VERIFICATION_BATCH_JOB_STATUS_PENDING )
+		{
+			job->status = VERIFICATION_BATCH_JOB_STATUS_ABORTED;
+		}
+		if( job->status != VERIFICATION_BATCH_JOB_STATUS_SUCCESS )
+		{
+			result = 0;
+		}
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( mutex_is_grabbed != 0 )
+	{
+		libcthreads_mutex_release(
+		 batch->mutex,
+		 NULL );
+	}
+#endif
+	/* The jobs that are still running are joined when the batch is freed
+	 */
+	verification_batch_signal_abort(
+	 batch,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Prints a machine-readable summary of the results per image
+ * The summary contains a tab separated line per image
+ * Returns 1 if successful or -1 on error
+ */
+int verification_batch_results_fprint(
+     verification_batch_t *batch,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	verification_batch_job_t *job = NULL;
+	static char *function         = "verification_batch_results_fprint";
+	int job_index                 = 0;
+	int number_of_jobs            = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     batch->jobs,
+	     &number_of_jobs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of jobs.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "image\tstatus\tmedia_size\tchecksum_errors\tmd5\tsha1\tsha256\tblake3\n" );
+
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     batch->jobs,
+		     job_index,
+		     (intptr_t **) &job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve job: %d.",
+			 function,
+			 job_index );
+
+			return( -1 );
+		}
+		if( job == NULL )
+		{
+			continue;
+		}
+		fprintf(
+		 stream,
+		 "%" PRIs_SYSTEM "\t%s\t%" PRIu64 "\t%" PRIu32 "",
+		 job->filename,
+		 verification_batch_get_job_status_string(
+		  job->status ),
+		 job->media_size,
+		 job->number_of_checksum_errors );
+
+		/* Digest hashes that were not calculated are represented by -
+		 */
+		fprintf(
+		 stream,
+		 "\t%" PRIs_SYSTEM "",
+		 ( job->md5_hash_string[ 0 ] != 0 ) ? job->md5_hash_string : _SYSTEM_STRING( "-" ) );
+
+		fprintf(
+		 stream,
+		 "\t%" PRIs_SYSTEM "",
+		 ( job->sha1_hash_string[ 0 ] != 0 ) ? job->sha1_hash_string : _SYSTEM_STRING( "-" ) );
+
+		fprintf(
+		 stream,
+		 "\t%" PRIs_SYSTEM "",
+		 ( job->sha256_hash_string[ 0 ] != 0 ) ? job->sha256_hash_string : _SYSTEM_STRING( "-" ) );
+
+		fprintf(
+		 stream,
+		 "\t%" PRIs_SYSTEM "\n",
+		 ( job->blake3_hash_string[ 0 ] != 0 ) ? job->blake3_hash_string : _SYSTEM_STRING( "-" ) );
+	}
+	return( 1 );
+}
+
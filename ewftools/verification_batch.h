@@ -0,0 +1,312 @@
+/*
+ * Batch verification of multiple images
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VERIFICATION_BATCH_H )
+#define _VERIFICATION_BATCH_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "ewftools_libcdata.h"
+#include "ewftools_libcerror.h"
+#include "ewftools_libcthreads.h"
+#include "log_handle.h"
+#include "verification_handle.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of storage media buffers queued on the shared process thread pool
+ */
+#define VERIFICATION_BATCH_MAXIMUM_NUMBER_OF_QUEUED_BUFFERS	1024
+
+/* The maximum size of a line in a manifest
+ */
+#define VERIFICATION_BATCH_MAXIMUM_MANIFEST_LINE_SIZE		4096
+
+enum VERIFICATION_BATCH_JOB_STATUSES
+{
+	VERIFICATION_BATCH_JOB_STATUS_PENDING	= 0,
+	VERIFICATION_BATCH_JOB_STATUS_RUNNING	= 1,
+	VERIFICATION_BATCH_JOB_STATUS_SUCCESS	= 2,
+	VERIFICATION_BATCH_JOB_STATUS_FAILURE	= 3,
+	VERIFICATION_BATCH_JOB_STATUS_ABORTED	= 4,
+	VERIFICATION_BATCH_JOB_STATUS_ERROR	= 5
+};
+
+typedef struct verification_batch verification_batch_t;
+
+typedef struct verification_batch_job verification_batch_job_t;
+
+struct verification_batch_job
+{
+	/* The filename of the (first segment file of the) image
+	 */
+	system_character_t *filename;
+
+	/* The device identifier
+	 * Images with the same identifier are stored on the same underlying device
+	 */
+	uint64_t device_identifier;
+
+	/* The status
+	 */
+	int status;
+
+	/* Value to indicate the job has been started and not yet been joined
+	 */
+	uint8_t is_active;
+
+	/* Value to indicate the job has finished running
+	 */
+	uint8_t is_finished;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The number of checksum errors
+	 */
+	uint32_t number_of_checksum_errors;
+
+	/* The calculated MD5 hash string
+	 */
+	system_character_t md5_hash_string[ 33 ];
+
+	/* The calculated SHA1 hash string
+	 */
+	system_character_t sha1_hash_string[ 41 ];
+
+	/* The calculated SHA256 hash string
+	 */
+	system_character_t sha256_hash_string[ 65 ];
+
+	/* The calculated BLAKE3 hash string
+	 */
+	system_character_t blake3_hash_string[ 65 ];
+
+	/* The verification handle
+	 */
+	verification_handle_t *verification_handle;
+
+	/* The report stream
+	 * Contains the output of the verification until it is printed
+	 */
+	FILE *report_stream;
+
+	/* The log handle
+	 * Contains the log of the verification until it is appended to the batch log
+	 */
+	log_handle_t *log_handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The batch
+	 */
+	verification_batch_t *batch;
+};
+
+struct verification_batch
+{
+	/* The jobs
+	 */
+	libcdata_array_t *jobs;
+
+	/* The verification handle the settings are copied from
+	 */
+	verification_handle_t *settings_handle;
+
+	/* The additional digest types
+	 */
+	const system_character_t *additional_digest_types;
+
+	/* Value to indicate if the sectors should be zeroed on checksum error
+	 */
+	uint8_t zero_chunk_on_error;
+
+	/* The maximum number of open handles
+	 */
+	int maximum_number_of_open_handles;
+
+	/* The maximum number of images that are verified concurrently per device
+	 */
+	int maximum_number_of_jobs_per_device;
+
+	/* The maximum number of images that are verified concurrently
+	 */
+	int maximum_number_of_concurrent_jobs;
+
+	/* The number of active jobs
+	 */
+	int number_of_active_jobs;
+
+	/* The number of finished jobs that have not yet been joined
+	 */
+	int number_of_finished_jobs;
+
+	/* The log handle
+	 */
+	log_handle_t *log_handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The shared process thread pool
+	 */
+	libcthreads_thread_pool_t *process_thread_pool;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The job finished condition
+	 */
+	libcthreads_condition_t *job_finished_condition;
+#endif
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+const char *verification_batch_get_job_status_string(
+             int status );
+
+int verification_batch_job_initialize(
+     verification_batch_job_t **job,
+     verification_batch_t *batch,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int verification_batch_job_free(
+     verification_batch_job_t **job,
+     libcerror_error_t **error );
+
+int verification_batch_job_get_device_identifier(
+     verification_batch_job_t *job,
+     libcerror_error_t **error );
+
+int verification_batch_job_run(
+     verification_batch_job_t *job,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int verification_batch_job_thread_callback(
+     verification_batch_job_t *job );
+
+#endif
+
+int verification_batch_initialize(
+     verification_batch_t **batch,
+     verification_handle_t *settings_handle,
+     const system_character_t *additional_digest_types,
+     uint8_t zero_chunk_on_error,
+     libcerror_error_t **error );
+
+int verification_batch_free(
+     verification_batch_t **batch,
+     libcerror_error_t **error );
+
+int verification_batch_signal_abort(
+     verification_batch_t *batch,
+     libcerror_error_t **error );
+
+int verification_batch_set_maximum_number_of_open_handles(
+     verification_batch_t *batch,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+int verification_batch_set_maximum_number_of_jobs_per_device(
+     verification_batch_t *batch,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int verification_batch_get_number_of_images(
+     verification_batch_t *batch,
+     int *number_of_images,
+     libcerror_error_t **error );
+
+int verification_batch_append_image(
+     verification_batch_t *batch,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int verification_batch_read_manifest(
+     verification_batch_t *batch,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int verification_batch_get_next_job(
+     verification_batch_t *batch,
+     verification_batch_job_t **job,
+     libcerror_error_t **error );
+
+int verification_batch_start_job(
+     verification_batch_t *batch,
+     verification_batch_job_t *job,
+     libcerror_error_t **error );
+
+int verification_batch_join_jobs(
+     verification_batch_t *batch,
+     libcerror_error_t **error );
+
+int verification_batch_verify(
+     verification_batch_t *batch,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int verification_batch_copy_stream(
+     FILE *source_stream,
+     FILE *destination_stream,
+     libcerror_error_t **error );
+
+int verification_batch_job_report_fprint(
+     verification_batch_job_t *job,
+     FILE *stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int verification_batch_job_close_streams(
+     verification_batch_job_t *job,
+     libcerror_error_t **error );
+
+int verification_batch_results_fprint(
+     verification_batch_t *batch,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VERIFICATION_BATCH_H ) */
+
@@ -0,0 +1,1303 @@
+/*
+ * Verification checkpoint functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "digest_engine.h"
+#include "ewftools_libcerror.h"
+#include "ewftools_libcfile.h"
+#include "verification_checkpoint.h"
+
+/* Creates a checkpoint
+ * Make sure the value checkpoint is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int verification_checkpoint_initialize(
+     verification_checkpoint_t **checkpoint,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_checkpoint_initialize";
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *checkpoint != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid checkpoint value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*checkpoint = memory_allocate_structure(
+	               verification_checkpoint_t );
+
+	if( *checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *checkpoint,
+	     0,
+	     sizeof( verification_checkpoint_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *checkpoint != NULL )
+	{
+		memory_free(
+		 *checkpoint );
+
+		*checkpoint = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int verification_checkpoint_free(
+     verification_checkpoint_t **checkpoint,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_checkpoint_free";
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *checkpoint != NULL )
+	{
+		if( ( *checkpoint )->checksum_errors != NULL )
+		{
+			memory_free(
+			 ( *checkpoint )->checksum_errors );
+		}
+		/* The checkpoint contains the state of the digest contexts
+		 */
+		memory_set(
+		 *checkpoint,
+		 0,
+		 sizeof( verification_checkpoint_t ) );
+
+		memory_free(
+		 *checkpoint );
+
+		*checkpoint = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a checksum error
+ * Returns 1 if successful or -1 on error
+ */
+int verification_checkpoint_append_checksum_error(
+     verification_checkpoint_t *checkpoint,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	uint64_t *checksum_errors               = NULL;
+	static char *function                   = "verification_checkpoint_append_checksum_error";
+	size_t checksum_errors_size             = 0;
+	int number_of_allocated_checksum_errors = 0;
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint->number_of_checksum_errors >= VERIFICATION_CHECKPOINT_MAXIMUM_NUMBER_OF_CHECKSUM_ERRORS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid checkpoint - number of checksum errors value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint->number_of_checksum_errors >= checkpoint->number_of_allocated_checksum_errors )
+	{
+		number_of_allocated_checksum_errors = checkpoint->number_of_allocated_checksum_errors * 2;
+
+		if( number_of_allocated_checksum_errors == 0 )
+		{
+			number_of_allocated_checksum_errors = 16;
+		}
+		checksum_errors_size = sizeof( uint64_t ) * 2 * (size_t) number_of_allocated_checksum_errors;
+
+		checksum_errors = (uint64_t *) memory_reallocate(
+		                                checkpoint->checksum_errors,
+		                                checksum_errors_size );
+
+		if( checksum_errors == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize checksum errors.",
+			 function );
+
+			return( -1 );
+		}
+		checkpoint->checksum_errors                     = checksum_errors;
+		checkpoint->number_of_allocated_checksum_errors = number_of_allocated_checksum_errors;
+	}
+	checkpoint->checksum_errors[ checkpoint->number_of_checksum_errors * 2 ]         = start_sector;
+	checkpoint->checksum_errors[ ( checkpoint->number_of_checksum_errors * 2 ) + 1 ] = number_of_sectors;
+
+	checkpoint->number_of_checksum_errors += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of checksum errors
+ * Returns 1 if successful or -1 on error
+ */
+int verification_checkpoint_get_number_of_checksum_errors(
+     verification_checkpoint_t *checkpoint,
+     int *number_of_checksum_errors,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_checkpoint_get_number_of_checksum_errors";
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_checksum_errors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of checksum errors.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_checksum_errors = checkpoint->number_of_checksum_errors;
+
+	return( 1 );
+}
+
+/* Retrieves a specific checksum error
+ * Returns 1 if successful or -1 on error
+ */
+int verification_checkpoint_get_checksum_error(
+     verification_checkpoint_t *checkpoint,
+     int checksum_error_index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_checkpoint_get_checksum_error";
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( checksum_error_index < 0 )
+	 || ( checksum_error_index >= checkpoint->number_of_checksum_errors ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid checksum error index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_sector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid start sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sectors.",
+		 function );
+
+		return( -1 );
+	}
+	*start_sector      = checkpoint->checksum_errors[ checksum_error_index * 2 ];
+	*number_of_sectors = checkpoint->checksum_errors[ ( checksum_error_index * 2 ) + 1 ];
+
+	return( 1 );
+}
+
+/* Retrieves the size of the checkpoint data
+ * Returns 1 if successful or -1 on error
+ */
+int verification_checkpoint_get_data_size(
+     verification_checkpoint_t *checkpoint,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_checkpoint_get_data_size";
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = VERIFICATION_CHECKPOINT_HEADER_SIZE
+	           + ( (size_t) checkpoint->number_of_checksum_errors * VERIFICATION_CHECKPOINT_CHECKSUM_ERROR_SIZE )
+	           + VERIFICATION_CHECKPOINT_FOOTER_SIZE;
+
+	return( 1 );
+}
+
+/* Calculates the MD5 of the checkpoint data
+ * Returns 1 if successful or -1 on error
+ */
+int verification_checkpoint_calculate_data_hash(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	digest_engine_md5_context_t *md5_context = NULL;
+	static char *function                    = "verification_checkpoint_calculate_data_hash";
+
+	if( digest_engine_md5_initialize(
+	     &md5_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create MD5 context.",
+		 function );
+
+		goto on_error;
+	}
+	if( digest_engine_md5_update(
+	     md5_context,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update MD5 hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( digest_engine_md5_finalize(
+	     md5_context,
+	     hash,
+	     hash_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize MD5 hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( digest_engine_md5_free(
+	     &md5_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free MD5 context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( md5_context != NULL )
+	{
+		digest_engine_md5_free(
+		 &md5_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the checkpoint data
+ * Returns 1 if successful or -1 on error
+ */
+int verification_checkpoint_read_data(
+     verification_checkpoint_t *checkpoint,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t calculated_hash[ VERIFICATION_CHECKPOINT_FOOTER_SIZE ];
+
+	const uint8_t *checksum_error_data = NULL;
+	static char *function              = "verification_checkpoint_read_data";
+	uint64_t number_of_sectors         = 0;
+	uint64_t start_sector              = 0;
+	uint64_t value_64bit               = 0;
+	uint32_t format_version            = 0;
+	uint32_t number_of_checksum_errors = 0;
+	uint32_t checksum_error_index      = 0;
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint->number_of_checksum_errors != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid checkpoint - checksum errors value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < (size_t) ( VERIFICATION_CHECKPOINT_HEADER_SIZE + VERIFICATION_CHECKPOINT_FOOTER_SIZE ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     VERIFICATION_CHECKPOINT_SIGNATURE,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checkpoint signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 8 ] ),
+	 format_version );
+
+	if( format_version != VERIFICATION_CHECKPOINT_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checkpoint format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 36 ] ),
+	 number_of_checksum_errors );
+
+	if( number_of_checksum_errors > (uint32_t) VERIFICATION_CHECKPOINT_MAXIMUM_NUMBER_OF_CHECKSUM_ERRORS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of checksum errors value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != ( VERIFICATION_CHECKPOINT_HEADER_SIZE + ( (size_t) number_of_checksum_errors * VERIFICATION_CHECKPOINT_CHECKSUM_ERROR_SIZE ) + VERIFICATION_CHECKPOINT_FOOTER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value does not match number of checksum errors.",
+		 function );
+
+		return( -1 );
+	}
+	/* The checkpoint data is stored with an MD5 at the end
+	 * to detect a checkpoint that was only partially written
+	 */
+	if( verification_checkpoint_calculate_data_hash(
+	     data,
+	     data_size - VERIFICATION_CHECKPOINT_FOOTER_SIZE,
+	     calculated_hash,
+	     VERIFICATION_CHECKPOINT_FOOTER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate checkpoint data hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     &( data[ data_size - VERIFICATION_CHECKPOINT_FOOTER_SIZE ] ),
+	     calculated_hash,
+	     VERIFICATION_CHECKPOINT_FOOTER_SIZE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in checkpoint data hash.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 checkpoint->digest_flags );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 checkpoint->media_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 24 ] ),
+	 checkpoint->chunk_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 28 ] ),
+	 value_64bit );
+
+	if( value_64bit > (uint64_t) checkpoint->media_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint->offset = (off64_t) value_64bit;
+
+	data += 40;
+
+	if( memory_copy(
+	     checkpoint->md5_state,
+	     data,
+	     DIGEST_ENGINE_MD5_STATE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy MD5 state.",
+		 function );
+
+		return( -1 );
+	}
+	data += DIGEST_ENGINE_MD5_STATE_SIZE;
+
+	if( memory_copy(
+	     checkpoint->sha1_state,
+	     data,
+	     DIGEST_ENGINE_SHA1_STATE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy SHA1 state.",
+		 function );
+
+		return( -1 );
+	}
+	data += DIGEST_ENGINE_SHA1_STATE_SIZE;
+
+	if( memory_copy(
+	     checkpoint->sha256_state,
+	     data,
+	     DIGEST_ENGINE_SHA256_STATE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy SHA256 state.",
+		 function );
+
+		return( -1 );
+	}
+	data += DIGEST_ENGINE_SHA256_STATE_SIZE;
+
+	if( memory_copy(
+	     checkpoint->blake3_state,
+	     data,
+	     DIGEST_ENGINE_BLAKE3_STATE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy BLAKE3 state.",
+		 function );
+
+		return( -1 );
+	}
+	checksum_error_data = data + DIGEST_ENGINE_BLAKE3_STATE_SIZE;
+
+	for( checksum_error_index = 0;
+	     checksum_error_index < number_of_checksum_errors;
+	     checksum_error_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( checksum_error_data[ 0 ] ),
+		 start_sector );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( checksum_error_data[ 8 ] ),
+		 number_of_sectors );
+
+		checksum_error_data += VERIFICATION_CHECKPOINT_CHECKSUM_ERROR_SIZE;
+
+		if( verification_checkpoint_append_checksum_error(
+		     checkpoint,
+		     start_sector,
+		     number_of_sectors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append checksum error: %" PRIu32 ".",
+			 function,
+			 checksum_error_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the checkpoint data
+ * Returns 1 if successful or -1 on error
+ */
+int verification_checkpoint_write_data(
+     verification_checkpoint_t *checkpoint,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *checkpoint_data  = NULL;
+	static char *function     = "verification_checkpoint_write_data";
+	size_t required_data_size = 0;
+	int checksum_error_index  = 0;
+
+	if( verification_checkpoint_get_data_size(
+	     checkpoint,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checkpoint data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < required_data_size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint->offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid checkpoint - offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint_data = data;
+
+	if( memory_copy(
+	     checkpoint_data,
+	     VERIFICATION_CHECKPOINT_SIGNATURE,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( checkpoint_data[ 8 ] ),
+	 VERIFICATION_CHECKPOINT_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( checkpoint_data[ 12 ] ),
+	 checkpoint->digest_flags );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( checkpoint_data[ 16 ] ),
+	 checkpoint->media_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( checkpoint_data[ 24 ] ),
+	 checkpoint->chunk_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( checkpoint_data[ 28 ] ),
+	 (uint64_t) checkpoint->offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( checkpoint_data[ 36 ] ),
+	 (uint32_t) checkpoint->number_of_checksum_errors );
+
+	checkpoint_data += 40;
+
+	if( memory_copy(
+	     checkpoint_data,
+	     checkpoint->md5_state,
+	     DIGEST_ENGINE_MD5_STATE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy MD5 state.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint_data += DIGEST_ENGINE_MD5_STATE_SIZE;
+
+	if( memory_copy(
+	     checkpoint_data,
+	     checkpoint->sha1_state,
+	     DIGEST_ENGINE_SHA1_STATE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy SHA1 state.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint_data += DIGEST_ENGINE_SHA1_STATE_SIZE;
+
+	if( memory_copy(
+	     checkpoint_data,
+	     checkpoint->sha256_state,
+	     DIGEST_ENGINE_SHA256_STATE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy SHA256 state.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint_data += DIGEST_ENGINE_SHA256_STATE_SIZE;
+
+	if( memory_copy(
+	     checkpoint_data,
+	     checkpoint->blake3_state,
+	     DIGEST_ENGINE_BLAKE3_STATE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy BLAKE3 state.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint_data += DIGEST_ENGINE_BLAKE3_STATE_SIZE;
+
+	for( checksum_error_index = 0;
+	     checksum_error_index < checkpoint->number_of_checksum_errors;
+	     checksum_error_index++ )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( checkpoint_data[ 0 ] ),
+		 checkpoint->checksum_errors[ checksum_error_index * 2 ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( checkpoint_data[ 8 ] ),
+		 checkpoint->checksum_errors[ ( checksum_error_index * 2 ) + 1 ] );
+
+		checkpoint_data += VERIFICATION_CHECKPOINT_CHECKSUM_ERROR_SIZE;
+	}
+	if( verification_checkpoint_calculate_data_hash(
+	     data,
+	     required_data_size - VERIFICATION_CHECKPOINT_FOOTER_SIZE,
+	     checkpoint_data,
+	     VERIFICATION_CHECKPOINT_FOOTER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate checkpoint data hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the checkpoint from a file
+ * Returns 1 if successful or -1 on error
+ */
+int verification_checkpoint_read_file(
+     verification_checkpoint_t *checkpoint,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *file = NULL;
+	uint8_t *data         = NULL;
+	static char *function = "verification_checkpoint_read_file";
+	size64_t file_size    = 0;
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+		  file,
+		  filename,
+		  LIBCFILE_OPEN_READ,
+		  error );
+#else
+	result = libcfile_file_open(
+		  file,
+		  filename,
+		  LIBCFILE_OPEN_READ,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libcfile_file_get_size(
+	     file,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size < (size64_t) ( VERIFICATION_CHECKPOINT_HEADER_SIZE + VERIFICATION_CHECKPOINT_FOOTER_SIZE ) )
+	 || ( file_size > (size64_t) ( VERIFICATION_CHECKPOINT_HEADER_SIZE + ( VERIFICATION_CHECKPOINT_MAXIMUM_NUMBER_OF_CHECKSUM_ERRORS * VERIFICATION_CHECKPOINT_CHECKSUM_ERROR_SIZE ) + VERIFICATION_CHECKPOINT_FOOTER_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * (size_t) file_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libcfile_file_read_buffer(
+	              file,
+	              data,
+	              (size_t) file_size,
+	              error );
+
+	if( read_count != (ssize_t) file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_checkpoint_read_data(
+	     checkpoint,
+	     data,
+	     (size_t) file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read checkpoint data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the checkpoint to a file
+ * An existing file is overwritten, a partially written file is detected
+ * by the MD5 of the checkpoint data when it is read
+ * Returns 1 if successful or -1 on error
+ */
+int verification_checkpoint_write_file(
+     verification_checkpoint_t *checkpoint,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *file = NULL;
+	uint8_t *data         = NULL;
+	static char *function = "verification_checkpoint_write_file";
+	size_t data_size      = 0;
+	ssize_t write_count   = 0;
+	int result            = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_checkpoint_get_data_size(
+	     checkpoint,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checkpoint data size.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_checkpoint_write_data(
+	     checkpoint,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+		  file,
+		  filename,
+		  LIBCFILE_OPEN_WRITE,
+		  error );
+#else
+	result = libcfile_file_open(
+		  file,
+		  filename,
+		  LIBCFILE_OPEN_WRITE,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	write_count = libcfile_file_write_buffer(
+	               file,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data.",
+		 function );
+
+		goto on_error;
+	}
+	/* Remove any remaining data of a previous larger checkpoint
+	 */
+	if( libcfile_file_resize(
+	     file,
+	     (size64_t) data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to resize file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
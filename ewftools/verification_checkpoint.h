@@ -0,0 +1,185 @@
+/*
+ * Verification checkpoint functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VERIFICATION_CHECKPOINT_H )
+#define _VERIFICATION_CHECKPOINT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "digest_engine.h"
+#include "ewftools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The checkpoint file signature
+ */
+#define VERIFICATION_CHECKPOINT_SIGNATURE		"ewfvchk\x1a"
+
+/* The checkpoint file format version
+ */
+#define VERIFICATION_CHECKPOINT_FORMAT_VERSION		1
+
+/* The size of the checkpoint file header
+ * which consists of the signature, format version, digest flags, media size, chunk size,
+ * offset and number of checksum errors followed by the MD5, SHA1, SHA256 and BLAKE3 states
+ */
+#define VERIFICATION_CHECKPOINT_HEADER_SIZE		( 40 + DIGEST_ENGINE_MD5_STATE_SIZE + DIGEST_ENGINE_SHA1_STATE_SIZE + DIGEST_ENGINE_SHA256_STATE_SIZE + DIGEST_ENGINE_BLAKE3_STATE_SIZE )
+
+/* The size of a checksum error in the checkpoint file
+ */
+#define VERIFICATION_CHECKPOINT_CHECKSUM_ERROR_SIZE	16
+
+/* The size of the MD5 of the checkpoint data that is stored at the end of the checkpoint file
+ */
+#define VERIFICATION_CHECKPOINT_FOOTER_SIZE		16
+
+/* The maximum number of checksum errors in the checkpoint file
+ */
+#define VERIFICATION_CHECKPOINT_MAXIMUM_NUMBER_OF_CHECKSUM_ERRORS	( 16 * 1024 * 1024 )
+
+enum VERIFICATION_CHECKPOINT_DIGEST_FLAGS
+{
+	VERIFICATION_CHECKPOINT_DIGEST_FLAG_MD5		= 0x00000001UL,
+	VERIFICATION_CHECKPOINT_DIGEST_FLAG_SHA1	= 0x00000002UL,
+	VERIFICATION_CHECKPOINT_DIGEST_FLAG_SHA256	= 0x00000004UL,
+	VERIFICATION_CHECKPOINT_DIGEST_FLAG_BLAKE3	= 0x00000008UL
+};
+
+typedef struct verification_checkpoint verification_checkpoint_t;
+
+struct verification_checkpoint
+{
+	/* The digest flags
+	 * Contains the digest hashes that were being calculated
+	 */
+	uint32_t digest_flags;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The chunk size
+	 */
+	size32_t chunk_size;
+
+	/* The offset of the media data up to which the digest hashes were calculated
+	 */
+	off64_t offset;
+
+	/* The MD5 digest context state
+	 */
+	uint8_t md5_state[ DIGEST_ENGINE_MD5_STATE_SIZE ];
+
+	/* The SHA1 digest context state
+	 */
+	uint8_t sha1_state[ DIGEST_ENGINE_SHA1_STATE_SIZE ];
+
+	/* The SHA256 digest context state
+	 */
+	uint8_t sha256_state[ DIGEST_ENGINE_SHA256_STATE_SIZE ];
+
+	/* The BLAKE3 digest context state
+	 */
+	uint8_t blake3_state[ DIGEST_ENGINE_BLAKE3_STATE_SIZE ];
+
+	/* The checksum errors
+	 * Contains pairs of the start sector and number of sectors
+	 */
+	uint64_t *checksum_errors;
+
+	/* The number of checksum errors
+	 */
+	int number_of_checksum_errors;
+
+	/* The number of allocated checksum errors
+	 */
+	int number_of_allocated_checksum_errors;
+};
+
+int verification_checkpoint_initialize(
+     verification_checkpoint_t **checkpoint,
+     libcerror_error_t **error );
+
+int verification_checkpoint_free(
+     verification_checkpoint_t **checkpoint,
+     libcerror_error_t **error );
+
+int verification_checkpoint_append_checksum_error(
+     verification_checkpoint_t *checkpoint,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error );
+
+int verification_checkpoint_get_number_of_checksum_errors(
+     verification_checkpoint_t *checkpoint,
+     int *number_of_checksum_errors,
+     libcerror_error_t **error );
+
+int verification_checkpoint_get_checksum_error(
+     verification_checkpoint_t *checkpoint,
+     int checksum_error_index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error );
+
+int verification_checkpoint_get_data_size(
+     verification_checkpoint_t *checkpoint,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int verification_checkpoint_calculate_data_hash(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int verification_checkpoint_read_data(
+     verification_checkpoint_t *checkpoint,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int verification_checkpoint_write_data(
+     verification_checkpoint_t *checkpoint,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int verification_checkpoint_read_file(
+     verification_checkpoint_t *checkpoint,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int verification_checkpoint_write_file(
+     verification_checkpoint_t *checkpoint,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VERIFICATION_CHECKPOINT_H ) */
+
@@ -27,11 +27,14 @@
 #include <wide_string.h>
 
 #include "byte_size_string.h"
+#include "digest_engine.h"
 #include "digest_hash.h"
+#include "digest_pipeline.h"
 #include "ewfcommon.h"
 #include "ewfinput.h"
 #include "ewftools_libcdata.h"
 #include "ewftools_libcerror.h"
+#include "ewftools_libcfile.h"
 #include "ewftools_libcnotify.h"
 #include "ewftools_libcpath.h"
 #include "ewftools_libcsplit.h"
@@ -39,16 +42,19 @@
 #include "ewftools_libewf.h"
 #include "ewftools_libhmac.h"
 #include "ewftools_system_string.h"
+#include "ewftools_unused.h"
 #include "log_handle.h"
 #include "process_status.h"
 #include "storage_media_buffer.h"
 #include "storage_media_buffer_queue.h"
+#include "verification_checkpoint.h"
 #include "verification_handle.h"
 
 #define VERIFICATION_HANDLE_VALUE_SIZE				64
 #define VERIFICATION_HANDLE_VALUE_IDENTIFIER_SIZE		32
 #define VERIFICATION_HANDLE_NOTIFY_STREAM			stdout
 #define VERIFICATION_HANDLE_MAXIMUM_PROCESS_BUFFERS_SIZE	64 * 1024 * 1024
+#define VERIFICATION_HANDLE_CHECKPOINT_INTERVAL			1024 * 1024 * 1024
 
 /* Creates a verification handle
  * Make sure the value verification_handle is referencing, is set to NULL
@@ -206,11 +212,26 @@ int verification_handle_initialize(
 
 		goto on_error;
 	}
+	( *verification_handle )->stored_blake3_hash_string = system_string_allocate(
+							       65 );
+
+	if( ( *verification_handle )->stored_blake3_hash_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stored BLAKE3 digest hash string.",
+		 function );
+
+		goto on_error;
+	}
 	( *verification_handle )->input_format             = VERIFICATION_HANDLE_INPUT_FORMAT_RAW;
 	( *verification_handle )->calculate_md5            = calculate_md5;
 	( *verification_handle )->use_data_chunk_functions = use_data_chunk_functions;
 	( *verification_handle )->header_codepage          = LIBEWF_CODEPAGE_ASCII;
 	( *verification_handle )->process_buffer_size      = EWFCOMMON_PROCESS_BUFFER_SIZE;
+	( *verification_handle )->checkpoint_interval      = VERIFICATION_HANDLE_CHECKPOINT_INTERVAL;
 	( *verification_handle )->notify_stream            = VERIFICATION_HANDLE_NOTIFY_STREAM;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
@@ -221,6 +242,11 @@ int verification_handle_initialize(
 on_error:
 	if( *verification_handle != NULL )
 	{
+		if( ( *verification_handle )->stored_sha256_hash_string != NULL )
+		{
+			memory_free(
+			 ( *verification_handle )->stored_sha256_hash_string );
+		}
 		if( ( *verification_handle )->stored_sha1_hash_string != NULL )
 		{
 			memory_free(
@@ -292,9 +318,25 @@ int verification_handle_free(
 
 			result = -1;
 		}
+		if( ( *verification_handle )->digest_pipeline != NULL )
+		{
+			if( digest_pipeline_free(
+			     &( ( *verification_handle )->digest_pipeline ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free digest pipeline.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *verification_handle )->md5_context != NULL )
 		{
-			if( libhmac_md5_free(
+			if( digest_engine_md5_free(
 			     &( ( *verification_handle )->md5_context ),
 			     error ) != 1 )
 			{
@@ -320,7 +362,7 @@ int verification_handle_free(
 		}
 		if( ( *verification_handle )->sha1_context != NULL )
 		{
-			if( libhmac_sha1_free(
+			if( digest_engine_sha1_free(
 			     &( ( *verification_handle )->sha1_context ),
 			     error ) != 1 )
 			{
@@ -346,7 +388,7 @@ int verification_handle_free(
 		}
 		if( ( *verification_handle )->sha256_context != NULL )
 		{
-			if( libhmac_sha256_free(
+			if( digest_engine_sha256_free(
 			     &( ( *verification_handle )->sha256_context ),
 			     error ) != 1 )
 			{
@@ -370,6 +412,66 @@ int verification_handle_free(
 			memory_free(
 			 ( *verification_handle )->stored_sha256_hash_string );
 		}
+		if( ( *verification_handle )->blake3_context != NULL )
+		{
+			if( digest_engine_blake3_free(
+			     &( ( *verification_handle )->blake3_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free BLAKE3 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *verification_handle )->calculated_blake3_hash_string != NULL )
+		{
+			memory_free(
+			 ( *verification_handle )->calculated_blake3_hash_string );
+		}
+		if( ( *verification_handle )->stored_blake3_hash_string != NULL )
+		{
+			memory_free(
+			 ( *verification_handle )->stored_blake3_hash_string );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *verification_handle )->pending_buffers_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *verification_handle )->pending_buffers_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free pending buffers condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *verification_handle )->pending_buffers_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *verification_handle )->pending_buffers_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free pending buffers mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		memory_free(
 		 *verification_handle );
 
@@ -509,7 +611,7 @@ int verification_handle_open_input(
 		                         filenames[ 0 ] );
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		if( libewf_glob_wide(
+		if( libewf_glob_scan_directory_wide(
 		     filenames[ 0 ],
 		     first_filename_length,
 		     LIBEWF_FORMAT_UNKNOWN,
@@ -517,7 +619,7 @@ int verification_handle_open_input(
 		     &number_of_filenames,
 		     error ) != 1 )
 #else
-		if( libewf_glob(
+		if( libewf_glob_scan_directory(
 		     filenames[ 0 ],
 		     first_filename_length,
 		     LIBEWF_FORMAT_UNKNOWN,
@@ -697,6 +799,7 @@ int verification_handle_initialize_integrity_hash(
      libcerror_error_t **error )
 {
 	static char *function = "verification_handle_initialize_integrity_hash";
+	uint8_t digest_flags  = 0;
 
 	if( verification_handle == NULL )
 	{
@@ -709,10 +812,17 @@ int verification_handle_initialize_integrity_hash(
 
 		return( -1 );
 	}
+	/* The checkpoint contains the state of the digest contexts
+	 */
+	if( verification_handle->checkpoint_filename != NULL )
+	{
+		digest_flags = DIGEST_ENGINE_FLAG_EXPORTABLE_STATE;
+	}
 	if( verification_handle->calculate_md5 != 0 )
 	{
-		if( libhmac_md5_initialize(
+		if( digest_engine_md5_initialize_with_flags(
 		     &( verification_handle->md5_context ),
+		     digest_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -728,8 +838,9 @@ int verification_handle_initialize_integrity_hash(
 	}
 	if( verification_handle->calculate_sha1 != 0 )
 	{
-		if( libhmac_sha1_initialize(
+		if( digest_engine_sha1_initialize_with_flags(
 		     &( verification_handle->sha1_context ),
+		     digest_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -745,8 +856,9 @@ int verification_handle_initialize_integrity_hash(
 	}
 	if( verification_handle->calculate_sha256 != 0 )
 	{
-		if( libhmac_sha256_initialize(
+		if( digest_engine_sha256_initialize_with_flags(
 		     &( verification_handle->sha256_context ),
+		     digest_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -760,18 +872,139 @@ int verification_handle_initialize_integrity_hash(
 		}
 		verification_handle->sha256_context_initialized = 1;
 	}
+	/* The BLAKE3 digest hash is not part of the digest pipeline since its leaf
+	 * hashes are calculated on the process thread pool
+	 */
+	if( verification_handle->calculate_blake3 != 0 )
+	{
+		if( digest_engine_blake3_initialize(
+		     &( verification_handle->blake3_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize BLAKE3 context.",
+			 function );
+
+			goto on_error;
+		}
+		verification_handle->blake3_context_initialized = 1;
+	}
+	/* Every digest hash is calculated on its own thread when threads are used
+	 */
+	if( digest_pipeline_initialize(
+	     &( verification_handle->digest_pipeline ),
+	     (uint8_t) ( verification_handle->number_of_threads > 0 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create digest pipeline.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->calculate_md5 != 0 )
+	{
+		if( digest_pipeline_append_stage(
+		     verification_handle->digest_pipeline,
+		     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_engine_md5_update,
+		     (intptr_t *) verification_handle->md5_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append MD5 stage to digest pipeline.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->calculate_sha1 != 0 )
+	{
+		if( digest_pipeline_append_stage(
+		     verification_handle->digest_pipeline,
+		     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_engine_sha1_update,
+		     (intptr_t *) verification_handle->sha1_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append SHA1 stage to digest pipeline.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->calculate_sha256 != 0 )
+	{
+		if( digest_pipeline_append_stage(
+		     verification_handle->digest_pipeline,
+		     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_engine_sha256_update,
+		     (intptr_t *) verification_handle->sha256_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append SHA256 stage to digest pipeline.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( digest_pipeline_start(
+	     verification_handle->digest_pipeline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start digest pipeline.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
+	if( verification_handle->digest_pipeline != NULL )
+	{
+		digest_pipeline_free(
+		 &( verification_handle->digest_pipeline ),
+		 NULL );
+	}
+	if( verification_handle->blake3_context != NULL )
+	{
+		digest_engine_blake3_free(
+		 &( verification_handle->blake3_context ),
+		 NULL );
+	}
+	if( verification_handle->sha256_context != NULL )
+	{
+		digest_engine_sha256_free(
+		 &( verification_handle->sha256_context ),
+		 NULL );
+	}
 	if( verification_handle->sha1_context != NULL )
 	{
-		libhmac_sha1_free(
+		digest_engine_sha1_free(
 		 &( verification_handle->sha1_context ),
 		 NULL );
 	}
 	if( verification_handle->md5_context != NULL )
 	{
-		libhmac_md5_free(
+		digest_engine_md5_free(
 		 &( verification_handle->md5_context ),
 		 NULL );
 	}
@@ -823,59 +1056,20 @@ int verification_handle_update_integrity_hash(
 
 		return( -1 );
 	}
-	if( verification_handle->calculate_md5 != 0 )
-	{
-		if( libhmac_md5_update(
-		     verification_handle->md5_context,
-		     buffer,
-		     buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update MD5 digest hash.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( verification_handle->calculate_sha1 != 0 )
-	{
-		if( libhmac_sha1_update(
-		     verification_handle->sha1_context,
-		     buffer,
-		     buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update SHA1 digest hash.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( verification_handle->calculate_sha256 != 0 )
+	if( digest_pipeline_update(
+	     verification_handle->digest_pipeline,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
 	{
-		if( libhmac_sha256_update(
-		     verification_handle->sha256_context,
-		     buffer,
-		     buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update SHA256 digest hash.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest hashes.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
 	return( 1 );
 }
@@ -890,6 +1084,7 @@ int verification_handle_finalize_integrity_hash(
 	uint8_t calculated_md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
 	uint8_t calculated_sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
 	uint8_t calculated_sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+	uint8_t calculated_blake3_hash[ DIGEST_ENGINE_BLAKE3_HASH_SIZE ];
 
 	static char *function = "verification_handle_finalize_integrity_hash";
 
@@ -904,6 +1099,22 @@ int verification_handle_finalize_integrity_hash(
 
 		return( -1 );
 	}
+	if( verification_handle->digest_pipeline != NULL )
+	{
+		if( digest_pipeline_free(
+		     &( verification_handle->digest_pipeline ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free digest pipeline.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( verification_handle->calculate_md5 != 0 )
 	{
 		if( verification_handle->calculated_md5_hash_string == NULL )
@@ -917,7 +1128,7 @@ int verification_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_md5_finalize(
+		if( digest_engine_md5_finalize(
 		     verification_handle->md5_context,
 		     calculated_md5_hash,
 		     LIBHMAC_MD5_HASH_SIZE,
@@ -932,7 +1143,7 @@ int verification_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_md5_free(
+		if( digest_engine_md5_free(
 		     &( verification_handle->md5_context ),
 		     error ) != 1 )
 		{
@@ -975,7 +1186,7 @@ int verification_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_sha1_finalize(
+		if( digest_engine_sha1_finalize(
 		     verification_handle->sha1_context,
 		     calculated_sha1_hash,
 		     LIBHMAC_SHA1_HASH_SIZE,
@@ -990,7 +1201,7 @@ int verification_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_sha1_free(
+		if( digest_engine_sha1_free(
 		     &( verification_handle->sha1_context ),
 		     error ) != 1 )
 		{
@@ -1033,7 +1244,7 @@ int verification_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_sha256_finalize(
+		if( digest_engine_sha256_finalize(
 		     verification_handle->sha256_context,
 		     calculated_sha256_hash,
 		     LIBHMAC_SHA256_HASH_SIZE,
@@ -1048,7 +1259,7 @@ int verification_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_sha256_free(
+		if( digest_engine_sha256_free(
 		     &( verification_handle->sha256_context ),
 		     error ) != 1 )
 		{
@@ -1078,25 +1289,84 @@ int verification_handle_finalize_integrity_hash(
 			return( -1 );
 		}
 	}
-	return( 1 );
-}
+	if( verification_handle->calculate_blake3 != 0 )
+	{
+		if( verification_handle->calculated_blake3_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid verification handle - missing calculated BLAKE3 hash string.",
+			 function );
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			return( -1 );
+		}
+		if( digest_engine_blake3_finalize(
+		     verification_handle->blake3_context,
+		     calculated_blake3_hash,
+		     DIGEST_ENGINE_BLAKE3_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize BLAKE3 hash.",
+			 function );
 
-/* Prepares a storage media buffer for verification
- * Callback function for the process thread pool
- * Returns 1 if successful or -1 on error
- */
-int verification_handle_process_storage_media_buffer_callback(
-     storage_media_buffer_t *storage_media_buffer,
-     verification_handle_t *verification_handle )
-{
-        libcerror_error_t *error = NULL;
-        static char *function    = "verification_handle_process_storage_media_buffer_callback";
-	ssize_t process_count    = 0;
+			return( -1 );
+		}
+		if( digest_engine_blake3_free(
+		     &( verification_handle->blake3_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free BLAKE3 context.",
+			 function );
 
-	if( storage_media_buffer == NULL )
-	{
+			return( -1 );
+		}
+		if( digest_hash_copy_to_string(
+		     calculated_blake3_hash,
+		     DIGEST_ENGINE_BLAKE3_HASH_SIZE,
+		     verification_handle->calculated_blake3_hash_string,
+		     65,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create calculated BLAKE3 hash string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Prepares a storage media buffer for verification
+ * Callback function for the process thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_process_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     verification_handle_t *verification_handle )
+{
+        libcerror_error_t *error = NULL;
+        static char *function    = "verification_handle_process_storage_media_buffer_callback";
+	ssize_t process_count    = 0;
+	int result               = 0;
+
+	if( storage_media_buffer == NULL )
+	{
 		libcerror_error_set(
 		 &error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
@@ -1110,6 +1380,8 @@ int verification_handle_process_storage_media_buffer_callback(
 	{
 		return( 1 );
 	}
+	storage_media_buffer->blake3_chaining_value_is_set = 0;
+
 	process_count = storage_media_buffer_read_process(
 			 storage_media_buffer,
 			 &error );
@@ -1131,6 +1403,32 @@ int verification_handle_process_storage_media_buffer_callback(
 
 		storage_media_buffer->is_corrupted = 1;
 	}
+	else if( verification_handle->calculate_blake3 != 0 )
+	{
+		/* The BLAKE3 leaf hashes are calculated here so that the output callback
+		 * only needs to merge the chaining value of the buffer
+		 */
+		result = digest_engine_blake3_calculate_subtree_chaining_value(
+		          storage_media_buffer->raw_buffer,
+		          storage_media_buffer->processed_size,
+		          (uint64_t) storage_media_buffer->storage_media_offset,
+		          storage_media_buffer->blake3_chaining_value,
+		          32,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate BLAKE3 chaining value.",
+			 function );
+
+			goto on_error;
+		}
+		storage_media_buffer->blake3_chaining_value_is_set = (uint8_t) result;
+	}
 	if( libcthreads_thread_pool_push(
 	     verification_handle->output_thread_pool,
 	     (intptr_t *) storage_media_buffer,
@@ -1357,22 +1655,38 @@ int verification_handle_output_storage_media_buffer_callback(
 
 			goto on_error;
 		}
-		if( verification_handle_update_integrity_hash(
-		     verification_handle,
-		     data,
-		     storage_media_buffer->processed_size,
-		     &error ) != 1 )
+		if( verification_handle->calculate_blake3 != 0 )
 		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to update integrity hash(es).",
-			 function );
+			if( storage_media_buffer->blake3_chaining_value_is_set != 0 )
+			{
+				result = digest_engine_blake3_update_subtree(
+				          verification_handle->blake3_context,
+				          storage_media_buffer->blake3_chaining_value,
+				          32,
+				          storage_media_buffer->processed_size,
+				          &error );
+			}
+			else
+			{
+				result = digest_engine_blake3_update(
+				          verification_handle->blake3_context,
+				          data,
+				          storage_media_buffer->processed_size,
+				          &error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update BLAKE3 hash.",
+				 function );
 
-			storage_media_buffer = NULL;
+				storage_media_buffer = NULL;
 
-			goto on_error;
+				goto on_error;
+			}
 		}
 		verification_handle->last_offset_hashed = storage_media_buffer->storage_media_offset + storage_media_buffer->processed_size;
 
@@ -1426,22 +1740,30 @@ int verification_handle_output_storage_media_buffer_callback(
 		}
 		element = next_element;
 
-		if( storage_media_buffer_queue_release_buffer(
-		     verification_handle->storage_media_buffer_queue,
-		     storage_media_buffer,
-		     &error ) != 1 )
+		/* The digest stages digest the data of the storage media buffer without a copy,
+		 * the digest pipeline releases the storage media buffer onto the queue
+		 * after the last stage digested it, also on error
+		 */
+		result = digest_pipeline_update_reference(
+		          verification_handle->digest_pipeline,
+		          data,
+		          storage_media_buffer->processed_size,
+		          (intptr_t *) storage_media_buffer,
+		          &error );
+
+		storage_media_buffer = NULL;
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to release storage media buffer onto queue.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to update integrity hash(es).",
 			 function );
 
 			goto on_error;
 		}
-		storage_media_buffer = NULL;
-
 		if( process_status_update(
 		     verification_handle->process_status,
 		     verification_handle->last_offset_hashed,
@@ -1457,6 +1779,23 @@ int verification_handle_output_storage_media_buffer_callback(
 
 			goto on_error;
 		}
+		if( ( verification_handle->checkpoint_filename != NULL )
+		 && ( (size64_t) ( verification_handle->last_offset_hashed - verification_handle->last_checkpoint_offset ) >= verification_handle->checkpoint_interval ) )
+		{
+			if( verification_handle_write_checkpoint(
+			     verification_handle,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write checkpoint.",
+				 function );
+
+				goto on_error;
+			}
+		}
 	}
 	return( 1 );
 
@@ -1501,165 +1840,145 @@ on_error:
 	return( -1 );
 }
 
-/* Empties the output list
+/* Prepares a storage media buffer for verification of the handle that owns it
+ * Callback function for a process thread pool that is shared by multiple verification handles
  * Returns 1 if successful or -1 on error
  */
-int verification_handle_empty_output_list(
-     verification_handle_t *verification_handle,
-     libcerror_error_t **error )
+int verification_handle_process_shared_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     void *arguments EWFTOOLS_ATTRIBUTE_UNUSED )
 {
-	libcdata_list_element_t *element             = NULL;
-	libcdata_list_element_t *next_element        = NULL;
-	storage_media_buffer_t *storage_media_buffer = NULL;
-        static char *function                        = "verification_handle_empty_output_list";
+	libcerror_error_t *error                   = NULL;
+	verification_handle_t *verification_handle = NULL;
+	static char *function                      = "verification_handle_process_shared_storage_media_buffer_callback";
+	int result                                 = 0;
 
-	if( verification_handle == NULL )
+	EWFTOOLS_UNREFERENCED_PARAMETER( arguments )
+
+	if( storage_media_buffer == NULL )
 	{
 		libcerror_error_set(
-		 error,
+		 &error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid verification handle.",
+		 "%s: invalid storage media buffer.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcdata_list_get_first_element(
-	     verification_handle->output_list,
-	     &element,
-	     error ) != 1 )
+	verification_handle = (verification_handle_t *) storage_media_buffer->owner;
+
+	if( verification_handle == NULL )
 	{
 		libcerror_error_set(
-		 error,
+		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first element.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid storage media buffer - missing owner.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	while( element != NULL )
+	/* The storage media buffer can be released by the callback
+	 * hence the owner is retrieved before
+	 */
+	result = verification_handle_process_storage_media_buffer_callback(
+	          storage_media_buffer,
+	          verification_handle );
+
+	/* Always account for the buffer, otherwise the owner would wait indefinitely
+	 */
+	if( libcthreads_mutex_grab(
+	     verification_handle->pending_buffers_mutex,
+	     &error ) != 1 )
 	{
-		if( libcdata_list_element_get_value(
-		     element,
-		     (intptr_t **) &storage_media_buffer,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from list element.",
-			 function );
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab pending buffers mutex.",
+		 function );
 
-			return( -1 );
-		}
-		if( storage_media_buffer == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing storage media buffer.",
-			 function );
+		goto on_error;
+	}
+	verification_handle->number_of_pending_buffers -= 1;
 
-			return( -1 );
-		}
-		if( storage_media_buffer_queue_release_buffer(
-		     verification_handle->storage_media_buffer_queue,
-		     storage_media_buffer,
-		     error ) != 1 )
+	if( verification_handle->number_of_pending_buffers <= 0 )
+	{
+		if( libcthreads_condition_broadcast(
+		     verification_handle->pending_buffers_condition,
+		     &error ) != 1 )
 		{
 			libcerror_error_set(
-			 error,
+			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to release storage media buffer onto queue.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast pending buffers condition.",
 			 function );
 
-			return( -1 );
+			result = -1;
 		}
-		storage_media_buffer = NULL;
+	}
+	if( libcthreads_mutex_release(
+	     verification_handle->pending_buffers_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release pending buffers mutex.",
+		 function );
 
-		if( libcdata_list_element_get_next_element(
-		     element,
-		     &next_element,
-		     error ) != 1 )
+		goto on_error;
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			return( -1 );
+			libcnotify_print_error_backtrace(
+			 error );
 		}
-		if( libcdata_list_remove_element(
-		     verification_handle->output_list,
-		     element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove list element from output list.",
-			 function );
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
 
-			return( -1 );
-		}
-		/* The output list no longer manages the list element and the storage media buffer it contains
-		 */
-		if( libcdata_list_element_free(
-		     &element,
-		     NULL,
-		     error ) != 1 )
+on_error:
+	if( error != NULL )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free list element.",
-			 function );
-
-			return( -1 );
+			libcnotify_print_error_backtrace(
+			 error );
 		}
-		element = next_element;
+#endif
+		libcerror_error_free(
+		 &error );
 	}
-	return( 1 );
-}
-
-#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	if( ( verification_handle != NULL )
+	 && ( verification_handle->abort == 0 ) )
+	{
+		verification_handle_signal_abort(
+		 verification_handle,
+		 NULL );
+	}
+	return( -1 );
+}
 
-/* Verifies the input
- * Returns 1 if successful, 0 if not or -1 on error
+/* Pushes a storage media buffer onto the shared process thread pool
+ * Returns 1 if successful or -1 on error
  */
-int verification_handle_verify_input(
+int verification_handle_push_shared_storage_media_buffer(
      verification_handle_t *verification_handle,
-     uint8_t print_status_information,
-     log_handle_t *log_handle,
+     storage_media_buffer_t *storage_media_buffer,
      libcerror_error_t **error )
 {
-	storage_media_buffer_t *storage_media_buffer = NULL;
-	uint8_t *data                                = NULL;
-	static char *function                        = "verification_handle_verify_input";
-	size64_t remaining_media_size                = 0;
-	size_t data_size                             = 0;
-	size_t process_buffer_size                   = 0;
-	size_t read_size                             = 0;
-	ssize_t process_count                        = 0;
-	ssize_t read_count                           = 0;
-	off64_t storage_media_offset                 = 0;
-	uint32_t number_of_checksum_errors           = 0;
-	uint8_t storage_media_buffer_mode            = 0;
-	int is_corrupted                             = 0;
-	int maximum_number_of_queued_items           = 0;
-	int md5_hash_compare                         = 0;
-	int result                                   = 0;
-	int sha1_hash_compare                        = 0;
-	int sha256_hash_compare                      = 0;
-	int status                                   = PROCESS_STATUS_COMPLETED;
+	static char *function = "verification_handle_push_shared_storage_media_buffer";
+	int result            = 0;
 
 	if( verification_handle == NULL )
 	{
@@ -1672,228 +1991,1299 @@ int verification_handle_verify_input(
 
 		return( -1 );
 	}
-	if( verification_handle->chunk_size == 0 )
+	if( verification_handle->shared_process_thread_pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing chunk size.",
+		 "%s: invalid verification handle - missing shared process thread pool.",
 		 function );
 
 		return( -1 );
 	}
-	if( verification_handle->chunk_size > (size32_t) INT32_MAX )
+	if( storage_media_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid chunk size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( verification_handle->process_buffer_size > (size_t) SSIZE_MAX )
+	storage_media_buffer->owner = (intptr_t *) verification_handle;
+
+	/* The buffer is accounted for before the push since it can be processed
+	 * before the push returns
+	 */
+	if( libcthreads_mutex_grab(
+	     verification_handle->pending_buffers_mutex,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid process buffer size value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab pending buffers mutex.",
 		 function );
 
 		return( -1 );
 	}
-#if !defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( verification_handle->number_of_threads != 0 )
+	verification_handle->number_of_pending_buffers += 1;
+
+	if( libcthreads_mutex_release(
+	     verification_handle->pending_buffers_mutex,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: multi-threading not supported.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release pending buffers mutex.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libewf_handle_get_media_size(
-	     verification_handle->input_handle,
-	     &( verification_handle->media_size ),
-	     error ) != 1 )
+	result = libcthreads_thread_pool_push(
+	          verification_handle->shared_process_thread_pool,
+	          (intptr_t *) storage_media_buffer,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve media size.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push storage media buffer onto shared process thread pool queue.",
 		 function );
 
-		goto on_error;
+		if( libcthreads_mutex_grab(
+		     verification_handle->pending_buffers_mutex,
+		     NULL ) == 1 )
+		{
+			verification_handle->number_of_pending_buffers -= 1;
+
+			libcthreads_mutex_release(
+			 verification_handle->pending_buffers_mutex,
+			 NULL );
+		}
+		return( -1 );
 	}
-	if( verification_handle->use_data_chunk_functions != 0 )
+	return( 1 );
+}
+
+/* Waits until the storage media buffers pushed onto the shared process thread pool have been processed
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_wait_for_pending_buffers(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_wait_for_pending_buffers";
+
+	if( verification_handle == NULL )
 	{
-		process_buffer_size       = verification_handle->chunk_size;
-		storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( verification_handle->pending_buffers_mutex == NULL )
 	{
-		if( verification_handle->process_buffer_size == 0 )
-		{
-			process_buffer_size = verification_handle->chunk_size;
-		}
-		else
-		{
-			process_buffer_size = verification_handle->process_buffer_size;
-		}
-		storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_BUFFERED;
+		return( 1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( verification_handle->number_of_threads != 0 )
+	if( libcthreads_mutex_grab(
+	     verification_handle->pending_buffers_mutex,
+	     error ) != 1 )
 	{
-		maximum_number_of_queued_items = 1 + (int) ( VERIFICATION_HANDLE_MAXIMUM_PROCESS_BUFFERS_SIZE / process_buffer_size );
-
-		if( libcthreads_thread_pool_create(
-		     &( verification_handle->process_thread_pool ),
-		     NULL,
-		     verification_handle->number_of_threads,
-		     maximum_number_of_queued_items,
-		     (int (*)(intptr_t *, void *)) &verification_handle_process_storage_media_buffer_callback,
-		     (void *) verification_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to initialize process thread pool.",
-			 function );
-
-			goto on_error;
-		}
-		if( libcthreads_thread_pool_create(
-		     &( verification_handle->output_thread_pool ),
-		     NULL,
-		     1,
-		     maximum_number_of_queued_items,
-		     (int (*)(intptr_t *, void *)) &verification_handle_output_storage_media_buffer_callback,
-		     (void *) verification_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to initialize output thread pool.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab pending buffers mutex.",
+		 function );
 
-			goto on_error;
-		}
-		if( libcdata_list_initialize(
-		     &( verification_handle->output_list ),
+		return( -1 );
+	}
+	while( verification_handle->number_of_pending_buffers > 0 )
+	{
+		if( libcthreads_condition_wait(
+		     verification_handle->pending_buffers_condition,
+		     verification_handle->pending_buffers_mutex,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create output list.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for pending buffers condition.",
 			 function );
 
-			goto on_error;
-		}
-		if( storage_media_buffer_queue_initialize(
-		     &( verification_handle->storage_media_buffer_queue ),
-		     verification_handle->input_handle,
-		     maximum_number_of_queued_items,
-		     storage_media_buffer_mode,
-		     process_buffer_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create storage media buffer queue.",
-			 function );
+			libcthreads_mutex_release(
+			 verification_handle->pending_buffers_mutex,
+			 NULL );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
-
-	if( verification_handle_initialize_integrity_hash(
-	     verification_handle,
+	if( libcthreads_mutex_release(
+	     verification_handle->pending_buffers_mutex,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize integrity hash(es).",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release pending buffers mutex.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( process_status_initialize(
-	     &( verification_handle->process_status ),
-	     _SYSTEM_STRING( "Verify" ),
-	     _SYSTEM_STRING( "verified" ),
-	     _SYSTEM_STRING( "Read" ),
-	     verification_handle->notify_stream,
-	     print_status_information,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Empties the output list
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_empty_output_list(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *element             = NULL;
+	libcdata_list_element_t *next_element        = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+        static char *function                        = "verification_handle_empty_output_list";
+
+	if( verification_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create process status.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( process_status_start(
-	     verification_handle->process_status,
+	if( libcdata_list_get_first_element(
+	     verification_handle->output_list,
+	     &element,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to start process status.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first element.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( verification_handle->number_of_threads == 0 )
+	while( element != NULL )
 	{
-		if( storage_media_buffer_initialize(
-		     &storage_media_buffer,
-		     verification_handle->input_handle,
-		     storage_media_buffer_mode,
-		     process_buffer_size,
+		if( libcdata_list_element_get_value(
+		     element,
+		     (intptr_t **) &storage_media_buffer,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create storage media buffer.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from list element.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-	}
-	remaining_media_size = verification_handle->media_size;
-
-	while( remaining_media_size > 0 )
-	{
-		if( verification_handle->abort != 0 )
+		if( storage_media_buffer == NULL )
 		{
-			break;
-		}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing storage media buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( storage_media_buffer_queue_release_buffer(
+		     verification_handle->storage_media_buffer_queue,
+		     storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to release storage media buffer onto queue.",
+			 function );
+
+			return( -1 );
+		}
+		storage_media_buffer = NULL;
+
+		if( libcdata_list_element_get_next_element(
+		     element,
+		     &next_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next list element.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_list_remove_element(
+		     verification_handle->output_list,
+		     element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove list element from output list.",
+			 function );
+
+			return( -1 );
+		}
+		/* The output list no longer manages the list element and the storage media buffer it contains
+		 */
+		if( libcdata_list_element_free(
+		     &element,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free list element.",
+			 function );
+
+			return( -1 );
+		}
+		element = next_element;
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Writes a checkpoint of the verification
+ * The checkpoint contains the state of the digest contexts up to the last offset hashed
+ * and the checksum errors before that offset
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_write_checkpoint(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	verification_checkpoint_t *checkpoint = NULL;
+	static char *function                 = "verification_handle_write_checkpoint";
+	uint64_t checkpoint_sector            = 0;
+	uint64_t number_of_sectors            = 0;
+	uint64_t start_sector                 = 0;
+	uint32_t error_index                  = 0;
+	uint32_t number_of_checksum_errors    = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verification handle - missing checkpoint filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verification handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	/* The digest stages can lag behind, make sure they digested
+	 * all the data up to the checkpoint before exporting their state
+	 */
+	if( verification_handle->digest_pipeline != NULL )
+	{
+		if( digest_pipeline_flush(
+		     verification_handle->digest_pipeline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to flush digest pipeline.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( verification_checkpoint_initialize(
+	     &checkpoint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	checkpoint->media_size = verification_handle->media_size;
+	checkpoint->chunk_size = verification_handle->chunk_size;
+	checkpoint->offset     = verification_handle->last_offset_hashed;
+
+	if( verification_handle->md5_context_initialized != 0 )
+	{
+		if( digest_engine_md5_export_state(
+		     verification_handle->md5_context,
+		     checkpoint->md5_state,
+		     DIGEST_ENGINE_MD5_STATE_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to export MD5 context state.",
+			 function );
+
+			goto on_error;
+		}
+		checkpoint->digest_flags |= VERIFICATION_CHECKPOINT_DIGEST_FLAG_MD5;
+	}
+	if( verification_handle->sha1_context_initialized != 0 )
+	{
+		if( digest_engine_sha1_export_state(
+		     verification_handle->sha1_context,
+		     checkpoint->sha1_state,
+		     DIGEST_ENGINE_SHA1_STATE_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to export SHA1 context state.",
+			 function );
+
+			goto on_error;
+		}
+		checkpoint->digest_flags |= VERIFICATION_CHECKPOINT_DIGEST_FLAG_SHA1;
+	}
+	if( verification_handle->sha256_context_initialized != 0 )
+	{
+		if( digest_engine_sha256_export_state(
+		     verification_handle->sha256_context,
+		     checkpoint->sha256_state,
+		     DIGEST_ENGINE_SHA256_STATE_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to export SHA256 context state.",
+			 function );
+
+			goto on_error;
+		}
+		checkpoint->digest_flags |= VERIFICATION_CHECKPOINT_DIGEST_FLAG_SHA256;
+	}
+	if( verification_handle->blake3_context_initialized != 0 )
+	{
+		if( digest_engine_blake3_export_state(
+		     verification_handle->blake3_context,
+		     checkpoint->blake3_state,
+		     DIGEST_ENGINE_BLAKE3_STATE_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to export BLAKE3 context state.",
+			 function );
+
+			goto on_error;
+		}
+		checkpoint->digest_flags |= VERIFICATION_CHECKPOINT_DIGEST_FLAG_BLAKE3;
+	}
+	if( libewf_handle_get_number_of_checksum_errors(
+	     verification_handle->input_handle,
+	     &number_of_checksum_errors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the number of checksum errors.",
+		 function );
+
+		goto on_error;
+	}
+	/* Checksum errors after the last offset hashed can have been found by the read ahead
+	 * of the process threads, these are found again when the verification is resumed
+	 * A checksum error that straddles the last offset hashed is stored up to that offset
+	 */
+	checkpoint_sector = (uint64_t) checkpoint->offset / verification_handle->bytes_per_sector;
+
+	for( error_index = 0;
+	     error_index < number_of_checksum_errors;
+	     error_index++ )
+	{
+		if( libewf_handle_get_checksum_error(
+		     verification_handle->input_handle,
+		     error_index,
+		     &start_sector,
+		     &number_of_sectors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve checksum error: %" PRIu32 ".",
+			 function,
+			 error_index );
+
+			goto on_error;
+		}
+		if( start_sector >= checkpoint_sector )
+		{
+			continue;
+		}
+		if( number_of_sectors > ( checkpoint_sector - start_sector ) )
+		{
+			number_of_sectors = checkpoint_sector - start_sector;
+		}
+		if( verification_checkpoint_append_checksum_error(
+		     checkpoint,
+		     start_sector,
+		     number_of_sectors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append checksum error: %" PRIu32 " to checkpoint.",
+			 function,
+			 error_index );
+
+			goto on_error;
+		}
+	}
+	if( verification_checkpoint_write_file(
+	     checkpoint,
+	     verification_handle->checkpoint_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint file: %" PRIs_SYSTEM ".",
+		 function,
+		 verification_handle->checkpoint_filename );
+
+		goto on_error;
+	}
+	verification_handle->last_checkpoint_offset = checkpoint->offset;
+
+	if( verification_checkpoint_free(
+	     &checkpoint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( checkpoint != NULL )
+	{
+		verification_checkpoint_free(
+		 &checkpoint,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Resumes the verification from the checkpoint
+ * The digest contexts must be initialized and the input opened
+ * Returns 1 if successful, 0 if no checkpoint is available or -1 on error
+ */
+int verification_handle_resume_from_checkpoint(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	verification_checkpoint_t *checkpoint = NULL;
+	static char *function                 = "verification_handle_resume_from_checkpoint";
+	uint64_t checkpoint_sector            = 0;
+	uint64_t number_of_sectors            = 0;
+	uint64_t start_sector                 = 0;
+	uint32_t digest_flags                 = 0;
+	int checksum_error_index              = 0;
+	int number_of_checksum_errors         = 0;
+	int result                            = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verification handle - missing checkpoint filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verification handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+		  verification_handle->checkpoint_filename,
+		  error );
+#else
+	result = libcfile_file_exists(
+		  verification_handle->checkpoint_filename,
+		  error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if checkpoint file: %" PRIs_SYSTEM " exists.",
+		 function,
+		 verification_handle->checkpoint_filename );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( verification_checkpoint_initialize(
+	     &checkpoint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_checkpoint_read_file(
+	     checkpoint,
+	     verification_handle->checkpoint_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read checkpoint file: %" PRIs_SYSTEM ".",
+		 function,
+		 verification_handle->checkpoint_filename );
+
+		goto on_error;
+	}
+	if( ( checkpoint->media_size != verification_handle->media_size )
+	 || ( checkpoint->chunk_size != verification_handle->chunk_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: media size and chunk size of checkpoint do not match input.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->md5_context_initialized != 0 )
+	{
+		digest_flags |= VERIFICATION_CHECKPOINT_DIGEST_FLAG_MD5;
+	}
+	if( verification_handle->sha1_context_initialized != 0 )
+	{
+		digest_flags |= VERIFICATION_CHECKPOINT_DIGEST_FLAG_SHA1;
+	}
+	if( verification_handle->sha256_context_initialized != 0 )
+	{
+		digest_flags |= VERIFICATION_CHECKPOINT_DIGEST_FLAG_SHA256;
+	}
+	if( verification_handle->blake3_context_initialized != 0 )
+	{
+		digest_flags |= VERIFICATION_CHECKPOINT_DIGEST_FLAG_BLAKE3;
+	}
+	if( checkpoint->digest_flags != digest_flags )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: digest types of checkpoint do not match the digest types to calculate.",
+		 function );
+
+		goto on_error;
+	}
+	/* The data chunk functions can only continue at the start of a chunk
+	 */
+	if( ( verification_handle->use_data_chunk_functions != 0 )
+	 && ( ( checkpoint->offset % verification_handle->chunk_size ) != 0 )
+	 && ( (size64_t) checkpoint->offset != checkpoint->media_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checkpoint offset: %" PRIi64 " not aligned with chunk size.",
+		 function,
+		 checkpoint->offset );
+
+		goto on_error;
+	}
+	if( ( ( checkpoint->digest_flags & VERIFICATION_CHECKPOINT_DIGEST_FLAG_MD5 ) != 0 )
+	 && ( digest_engine_md5_import_state(
+	       verification_handle->md5_context,
+	       checkpoint->md5_state,
+	       DIGEST_ENGINE_MD5_STATE_SIZE,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to import MD5 context state.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( ( checkpoint->digest_flags & VERIFICATION_CHECKPOINT_DIGEST_FLAG_SHA1 ) != 0 )
+	 && ( digest_engine_sha1_import_state(
+	       verification_handle->sha1_context,
+	       checkpoint->sha1_state,
+	       DIGEST_ENGINE_SHA1_STATE_SIZE,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to import SHA1 context state.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( ( checkpoint->digest_flags & VERIFICATION_CHECKPOINT_DIGEST_FLAG_SHA256 ) != 0 )
+	 && ( digest_engine_sha256_import_state(
+	       verification_handle->sha256_context,
+	       checkpoint->sha256_state,
+	       DIGEST_ENGINE_SHA256_STATE_SIZE,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to import SHA256 context state.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( ( checkpoint->digest_flags & VERIFICATION_CHECKPOINT_DIGEST_FLAG_BLAKE3 ) != 0 )
+	 && ( digest_engine_blake3_import_state(
+	       verification_handle->blake3_context,
+	       checkpoint->blake3_state,
+	       DIGEST_ENGINE_BLAKE3_STATE_SIZE,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to import BLAKE3 context state.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_checkpoint_get_number_of_checksum_errors(
+	     checkpoint,
+	     &number_of_checksum_errors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of checksum errors from checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	/* The verification continues exactly at the checkpoint offset, the checksum errors
+	 * at or after the checkpoint offset are found again and are therefore not restored
+	 */
+	checkpoint_sector = (uint64_t) checkpoint->offset / verification_handle->bytes_per_sector;
+
+	for( checksum_error_index = 0;
+	     checksum_error_index < number_of_checksum_errors;
+	     checksum_error_index++ )
+	{
+		if( verification_checkpoint_get_checksum_error(
+		     checkpoint,
+		     checksum_error_index,
+		     &start_sector,
+		     &number_of_sectors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve checksum error: %d from checkpoint.",
+			 function,
+			 checksum_error_index );
+
+			goto on_error;
+		}
+		if( start_sector >= checkpoint_sector )
+		{
+			continue;
+		}
+		if( number_of_sectors > ( checkpoint_sector - start_sector ) )
+		{
+			number_of_sectors = checkpoint_sector - start_sector;
+		}
+		if( libewf_handle_append_checksum_error(
+		     verification_handle->input_handle,
+		     start_sector,
+		     number_of_sectors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append checksum error: %d.",
+			 function,
+			 checksum_error_index );
+
+			goto on_error;
+		}
+	}
+	if( libewf_handle_seek_offset(
+	     verification_handle->input_handle,
+	     checkpoint->offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 ".",
+		 function,
+		 checkpoint->offset );
+
+		goto on_error;
+	}
+	verification_handle->last_offset_hashed     = checkpoint->offset;
+	verification_handle->last_checkpoint_offset = checkpoint->offset;
+
+	if( verification_checkpoint_free(
+	     &checkpoint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( checkpoint != NULL )
+	{
+		verification_checkpoint_free(
+		 &checkpoint,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Removes the checkpoint file
+ * Returns 1 if successful, 0 if no checkpoint file exists or -1 on error
+ */
+int verification_handle_remove_checkpoint(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_remove_checkpoint";
+	int result            = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verification handle - missing checkpoint filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+		  verification_handle->checkpoint_filename,
+		  error );
+#else
+	result = libcfile_file_exists(
+		  verification_handle->checkpoint_filename,
+		  error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if checkpoint file: %" PRIs_SYSTEM " exists.",
+		 function,
+		 verification_handle->checkpoint_filename );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_remove_wide(
+		  verification_handle->checkpoint_filename,
+		  error );
+#else
+	result = libcfile_file_remove(
+		  verification_handle->checkpoint_filename,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+		 "%s: unable to remove checkpoint file: %" PRIs_SYSTEM ".",
+		 function,
+		 verification_handle->checkpoint_filename );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Verifies the input
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int verification_handle_verify_input(
+     verification_handle_t *verification_handle,
+     uint8_t print_status_information,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	uint8_t *data                                = NULL;
+	static char *function                        = "verification_handle_verify_input";
+	size64_t remaining_media_size                = 0;
+	size_t data_size                             = 0;
+	size_t process_buffer_size                   = 0;
+	size_t read_size                             = 0;
+	ssize_t process_count                        = 0;
+	ssize_t read_count                           = 0;
+	off64_t storage_media_offset                 = 0;
+	uint32_t number_of_checksum_errors           = 0;
+	uint8_t storage_media_buffer_mode            = 0;
+	int is_corrupted                             = 0;
+	int maximum_number_of_queued_items           = 0;
+	int md5_hash_compare                         = 0;
+	int result                                   = 0;
+	int sha1_hash_compare                        = 0;
+	int sha256_hash_compare                      = 0;
+	int blake3_hash_compare                      = 0;
+	int status                                   = PROCESS_STATUS_COMPLETED;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->chunk_size > (size32_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->process_buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid process buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->number_of_threads != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: multi-threading not supported.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libewf_handle_get_media_size(
+	     verification_handle->input_handle,
+	     &( verification_handle->media_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->use_data_chunk_functions != 0 )
+	{
+		process_buffer_size       = verification_handle->chunk_size;
+		storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_CHUNK_DATA;
+	}
+	else
+	{
+		if( verification_handle->process_buffer_size == 0 )
+		{
+			process_buffer_size = verification_handle->chunk_size;
+		}
+		else
+		{
+			process_buffer_size = verification_handle->process_buffer_size;
+		}
+		storage_media_buffer_mode = STORAGE_MEDIA_BUFFER_MODE_BUFFERED;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->number_of_threads != 0 )
+	{
+		maximum_number_of_queued_items = 1 + (int) ( VERIFICATION_HANDLE_MAXIMUM_PROCESS_BUFFERS_SIZE / process_buffer_size );
+
+		/* When a shared process thread pool is used the storage media buffers
+		 * are processed by it instead
+		 */
+		if( ( verification_handle->shared_process_thread_pool == NULL )
+		 && ( libcthreads_thread_pool_create(
+		       &( verification_handle->process_thread_pool ),
+		       NULL,
+		       verification_handle->number_of_threads,
+		       maximum_number_of_queued_items,
+		       (int (*)(intptr_t *, void *)) &verification_handle_process_storage_media_buffer_callback,
+		       (void *) verification_handle,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize process thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &( verification_handle->output_thread_pool ),
+		     NULL,
+		     1,
+		     maximum_number_of_queued_items,
+		     (int (*)(intptr_t *, void *)) &verification_handle_output_storage_media_buffer_callback,
+		     (void *) verification_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize output thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_list_initialize(
+		     &( verification_handle->output_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create output list.",
+			 function );
+
+			goto on_error;
+		}
+		if( storage_media_buffer_queue_initialize(
+		     &( verification_handle->storage_media_buffer_queue ),
+		     verification_handle->input_handle,
+		     maximum_number_of_queued_items,
+		     storage_media_buffer_mode,
+		     process_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create storage media buffer queue.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( verification_handle_initialize_integrity_hash(
+	     verification_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize integrity hash(es).",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->storage_media_buffer_queue != NULL )
+	{
+		if( digest_pipeline_set_release_function(
+		     verification_handle->digest_pipeline,
+		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &storage_media_buffer_queue_release_buffer,
+		     (intptr_t *) verification_handle->storage_media_buffer_queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set digest pipeline release function.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( ( verification_handle->checkpoint_filename != NULL )
+	 && ( verification_handle->resume_from_checkpoint != 0 ) )
+	{
+		result = verification_handle_resume_from_checkpoint(
+		          verification_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to resume from checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 verification_handle->notify_stream,
+			 "No checkpoint found, verification starts at the beginning of the media.\n\n" );
+		}
+		else
+		{
+			fprintf(
+			 verification_handle->notify_stream,
+			 "Resuming verification from checkpoint at offset: %" PRIi64 ".\n\n",
+			 verification_handle->last_offset_hashed );
+
+			storage_media_offset = verification_handle->last_offset_hashed;
+		}
+	}
+	if( process_status_initialize(
+	     &( verification_handle->process_status ),
+	     _SYSTEM_STRING( "Verify" ),
+	     _SYSTEM_STRING( "verified" ),
+	     _SYSTEM_STRING( "Read" ),
+	     verification_handle->notify_stream,
+	     print_status_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_start(
+	     verification_handle->process_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->number_of_threads == 0 )
+	{
+		if( storage_media_buffer_initialize(
+		     &storage_media_buffer,
+		     verification_handle->input_handle,
+		     storage_media_buffer_mode,
+		     process_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create storage media buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	remaining_media_size = verification_handle->media_size - (size64_t) storage_media_offset;
+
+	while( remaining_media_size > 0 )
+	{
+		if( verification_handle->abort != 0 )
+		{
+			break;
+		}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 		if( verification_handle->number_of_threads != 0 )
 		{
@@ -1906,314 +3296,844 @@ int verification_handle_verify_input(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to grab storage media buffer from queue.",
+				 "%s: unable to grab storage media buffer from queue.",
+				 function );
+
+				goto on_error;
+			}
+			if( storage_media_buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing storage media buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		read_size = process_buffer_size;
+
+		if( remaining_media_size < read_size )
+		{
+			read_size = (size_t) remaining_media_size;
+		}
+		read_count = storage_media_buffer_read_from_handle(
+		              storage_media_buffer,
+		              verification_handle->input_handle,
+		              read_size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data.",
+			 function );
+
+			goto on_error;
+		}
+		if( read_count == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of data.",
+			 function );
+
+			goto on_error;
+		}
+		storage_media_buffer->storage_media_offset = storage_media_offset;
+
+		storage_media_offset += read_count;
+		remaining_media_size -= read_count;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( verification_handle->number_of_threads != 0 )
+		{
+			if( verification_handle->shared_process_thread_pool != NULL )
+			{
+				result = verification_handle_push_shared_storage_media_buffer(
+				          verification_handle,
+				          storage_media_buffer,
+				          error );
+			}
+			else
+			{
+				result = libcthreads_thread_pool_push(
+				          verification_handle->process_thread_pool,
+				          (intptr_t *) storage_media_buffer,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push storage media buffer onto process thread pool queue.",
+				 function );
+
+				goto on_error;
+			}
+			storage_media_buffer = NULL;
+		}
+		else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+		{
+			process_count = storage_media_buffer_read_process(
+			                 storage_media_buffer,
+		        	         error );
+
+			if( process_count < 0 )
+			{
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( ( libcnotify_verbose != 0 )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+#endif
+				libcerror_error_free(
+				 error );
+
+				process_count = verification_handle->chunk_size;
+
+				storage_media_buffer->is_corrupted = 1;
+			}
+			result = storage_media_buffer_is_corrupted(
+			          storage_media_buffer,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if storage media buffer is corrupted.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				/* Append a read error
+				 */
+				if( verification_handle_append_read_error(
+				     verification_handle,
+				     storage_media_buffer->storage_media_offset,
+				     (size_t) verification_handle->chunk_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append read error.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( storage_media_buffer_get_data(
+			     storage_media_buffer,
+			     &data,
+			     &data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine storage media buffer data.",
 				 function );
 
 				goto on_error;
 			}
-			if( storage_media_buffer == NULL )
+			if( verification_handle_update_integrity_hash(
+			     verification_handle,
+			     data,
+			     storage_media_buffer->processed_size,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing storage media buffer.",
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to update integrity hash(es).",
+				 function );
+
+				goto on_error;
+			}
+			if( verification_handle->calculate_blake3 != 0 )
+			{
+				if( digest_engine_blake3_update(
+				     verification_handle->blake3_context,
+				     data,
+				     storage_media_buffer->processed_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to update BLAKE3 hash.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			verification_handle->last_offset_hashed += (off64_t) process_count;
+
+			if( process_status_update(
+			     verification_handle->process_status,
+			     verification_handle->last_offset_hashed,
+			     verification_handle->media_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update process status.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( verification_handle->checkpoint_filename != NULL )
+			 && ( (size64_t) ( verification_handle->last_offset_hashed - verification_handle->last_checkpoint_offset ) >= verification_handle->checkpoint_interval ) )
+			{
+				if( verification_handle_write_checkpoint(
+				     verification_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write checkpoint.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+  	}
+	if( verification_handle->number_of_threads == 0 )
+	{
+		if( storage_media_buffer_free(
+		     &storage_media_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free storage media buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->shared_process_thread_pool != NULL )
+	{
+		if( verification_handle_wait_for_pending_buffers(
+		     verification_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to wait for pending buffers.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->process_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( verification_handle->process_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join process thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->output_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( verification_handle->output_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join output thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->output_list != NULL )
+	{
+		if( verification_handle_empty_output_list(
+		     verification_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty output list.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_list_free(
+		     &( verification_handle->output_list ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output list.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle->storage_media_buffer_queue != NULL )
+	{
+		/* The digest stages can still reference storage media buffers
+		 */
+		if( verification_handle->digest_pipeline != NULL )
+		{
+			if( digest_pipeline_flush(
+			     verification_handle->digest_pipeline,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to flush digest pipeline.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( storage_media_buffer_queue_free(
+		     &( verification_handle->storage_media_buffer_queue ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free storage media buffer queue.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* The checkpoint is written before the integrity hashes are finalized
+	 * since finalizing changes the state of the digest contexts
+	 */
+	if( verification_handle->checkpoint_filename != NULL )
+	{
+		if( verification_handle->abort != 0 )
+		{
+			if( verification_handle_write_checkpoint(
+			     verification_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write checkpoint.",
 				 function );
 
-				goto on_error;
-			}
-		}
-#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+				goto on_error;
+			}
+		}
+		else if( verification_handle_remove_checkpoint(
+		          verification_handle,
+		          error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+			 "%s: unable to remove checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( verification_handle_finalize_integrity_hash(
+	     verification_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize integrity hash(es).",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle_get_integrity_hash_from_input(
+	     verification_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to retrieve integrity hash(es) from input.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->abort != 0 )
+	{
+		status = PROCESS_STATUS_ABORTED;
+	}
+	if( process_status_stop(
+	     verification_handle->process_status,
+	     verification_handle->last_offset_hashed,
+	     status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop process status.",
+		 function );
 
-		read_size = process_buffer_size;
+		goto on_error;
+	}
+	if( process_status_free(
+	     &( verification_handle->process_status ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free process status.",
+		 function );
 
-		if( remaining_media_size < read_size )
-		{
-			read_size = (size_t) remaining_media_size;
-		}
-		read_count = storage_media_buffer_read_from_handle(
-		              storage_media_buffer,
-		              verification_handle->input_handle,
-		              read_size,
-		              error );
+		goto on_error;
+	}
+	if( verification_handle->abort == 0 )
+	{
+		fprintf(
+		 verification_handle->notify_stream,
+		 "\n" );
 
-		if( read_count < 0 )
+		if( verification_handle_checksum_errors_fprint(
+		     verification_handle,
+		     verification_handle->notify_stream,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print checksum errors.",
 			 function );
 
 			goto on_error;
 		}
-		if( read_count == 0 )
+		if( verification_handle_hash_values_fprint(
+		     verification_handle,
+		     verification_handle->notify_stream,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unexpected end of data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print hash values.",
 			 function );
 
 			goto on_error;
 		}
-		storage_media_buffer->storage_media_offset = storage_media_offset;
-
-		storage_media_offset += read_count;
-		remaining_media_size -= read_count;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-		if( verification_handle->number_of_threads != 0 )
+		if( verification_handle_additional_hash_values_fprint(
+		     verification_handle,
+		     verification_handle->notify_stream,
+		     error ) != 1 )
 		{
-			if( libcthreads_thread_pool_push(
-			     verification_handle->process_thread_pool,
-			     (intptr_t *) storage_media_buffer,
-			     error ) == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to push storage media buffer onto process thread pool queue.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print additional hash values.",
+			 function );
 
-				goto on_error;
-			}
-			storage_media_buffer = NULL;
+			goto on_error;
 		}
-		else
-#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
-		{
-			process_count = storage_media_buffer_read_process(
-			                 storage_media_buffer,
-		        	         error );
-
-			if( process_count < 0 )
-			{
-#if defined( HAVE_VERBOSE_OUTPUT )
-				if( ( libcnotify_verbose != 0 )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-#endif
-				libcerror_error_free(
-				 error );
-
-				process_count = verification_handle->chunk_size;
-
-				storage_media_buffer->is_corrupted = 1;
-			}
-			result = storage_media_buffer_is_corrupted(
-			          storage_media_buffer,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine if storage media buffer is corrupted.",
-				 function );
-
-				goto on_error;
-			}
-			else if( result != 0 )
-			{
-				/* Append a read error
-				 */
-				if( verification_handle_append_read_error(
-				     verification_handle,
-				     storage_media_buffer->storage_media_offset,
-				     (size_t) verification_handle->chunk_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append read error.",
-					 function );
+		fprintf(
+		 verification_handle->notify_stream,
+		 "\n" );
 
-					goto on_error;
-				}
-			}
-			if( storage_media_buffer_get_data(
-			     storage_media_buffer,
-			     &data,
-			     &data_size,
+		if( log_handle != NULL )
+		{
+			if( verification_handle_checksum_errors_fprint(
+			     verification_handle,
+			     log_handle->log_stream,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine storage media buffer data.",
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print checksum errors in log handle.",
 				 function );
 
 				goto on_error;
 			}
-			if( verification_handle_update_integrity_hash(
+			if( verification_handle_hash_values_fprint(
 			     verification_handle,
-			     data,
-			     storage_media_buffer->processed_size,
+			     log_handle->log_stream,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to update integrity hash(es).",
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print hash values in log handle.",
 				 function );
 
 				goto on_error;
 			}
-			verification_handle->last_offset_hashed += (off64_t) process_count;
-
-			if( process_status_update(
-			     verification_handle->process_status,
-			     verification_handle->last_offset_hashed,
-			     verification_handle->media_size,
+			if( verification_handle_additional_hash_values_fprint(
+			     verification_handle,
+			     log_handle->log_stream,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to update process status.",
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print additional hash values in log handle.",
 				 function );
 
 				goto on_error;
 			}
 		}
-  	}
-	if( verification_handle->number_of_threads == 0 )
+	}
+	is_corrupted = libewf_handle_segment_files_corrupted(
+	                verification_handle->input_handle,
+	                error );
+
+	if( is_corrupted == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if segment files are corrupted.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_handle_get_number_of_checksum_errors(
+	     verification_handle->input_handle,
+	     &number_of_checksum_errors,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the number of checksum errors.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( verification_handle->calculate_md5 != 0 )
+	 && ( verification_handle->stored_md5_hash_available != 0 ) )
+	{
+		md5_hash_compare = system_string_compare(
+		                    verification_handle->stored_md5_hash_string,
+		                    verification_handle->calculated_md5_hash_string,
+		                    33 );
+	}
+	if( ( verification_handle->calculate_sha1 != 0 )
+	 && ( verification_handle->stored_sha1_hash_available != 0 ) )
+	{
+		sha1_hash_compare = system_string_compare(
+		                     verification_handle->stored_sha1_hash_string,
+		                     verification_handle->calculated_sha1_hash_string,
+		                     41 );
+	}
+	if( ( verification_handle->calculate_sha256 != 0 )
+	 && ( verification_handle->stored_sha256_hash_available != 0 ) )
+	{
+		sha256_hash_compare = system_string_compare(
+		                       verification_handle->stored_sha256_hash_string,
+		                       verification_handle->calculated_sha256_hash_string,
+		                       65 );
+	}
+	if( ( verification_handle->calculate_blake3 != 0 )
+	 && ( verification_handle->stored_blake3_hash_available != 0 ) )
 	{
-		if( storage_media_buffer_free(
-		     &storage_media_buffer,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free storage media buffer.",
-			 function );
+		blake3_hash_compare = system_string_compare(
+		                       verification_handle->stored_blake3_hash_string,
+		                       verification_handle->calculated_blake3_hash_string,
+		                       65 );
+	}
+	/* Note that a set of EWF files can be verified without an integrity hash
+	 */
+	if( ( is_corrupted == 0 )
+	 && ( number_of_checksum_errors == 0 )
+	 && ( md5_hash_compare == 0 )
+	 && ( sha1_hash_compare == 0 )
+	 && ( sha256_hash_compare == 0 )
+	 && ( blake3_hash_compare == 0 ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
 
-			goto on_error;
-		}
+on_error:
+	if( ( verification_handle->number_of_threads == 0 )
+	 && ( storage_media_buffer != NULL ) )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+	if( verification_handle->process_status != NULL )
+	{
+		process_status_stop(
+		 verification_handle->process_status,
+		 verification_handle->last_offset_hashed,
+		 PROCESS_STATUS_FAILED,
+		 NULL );
+		process_status_free(
+		 &( verification_handle->process_status ),
+		 NULL );
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->shared_process_thread_pool != NULL )
+	{
+		verification_handle_wait_for_pending_buffers(
+		 verification_handle,
+		 NULL );
+	}
 	if( verification_handle->process_thread_pool != NULL )
 	{
-		if( libcthreads_thread_pool_join(
-		     &( verification_handle->process_thread_pool ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to join process thread pool.",
-			 function );
-
-			goto on_error;
-		}
+		libcthreads_thread_pool_join(
+		 &( verification_handle->process_thread_pool ),
+		 NULL );
 	}
 	if( verification_handle->output_thread_pool != NULL )
 	{
-		if( libcthreads_thread_pool_join(
-		     &( verification_handle->output_thread_pool ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to join output thread pool.",
-			 function );
-
-			goto on_error;
-		}
+		libcthreads_thread_pool_join(
+		 &( verification_handle->output_thread_pool ),
+		 NULL );
 	}
 	if( verification_handle->output_list != NULL )
 	{
-		if( verification_handle_empty_output_list(
-		     verification_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to empty output list.",
-			 function );
-
-			goto on_error;
-		}
-		if( libcdata_list_free(
-		     &( verification_handle->output_list ),
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free output list.",
-			 function );
-
-			goto on_error;
-		}
+		verification_handle_empty_output_list(
+		 verification_handle,
+		 NULL );
+		libcdata_list_free(
+		 &( verification_handle->output_list ),
+		 NULL,
+		 NULL );
 	}
 	if( verification_handle->storage_media_buffer_queue != NULL )
 	{
-		if( storage_media_buffer_queue_free(
-		     &( verification_handle->storage_media_buffer_queue ),
-		     error ) != 1 )
+		/* Freeing the digest pipeline waits for the digest stages
+		 * to release the storage media buffers they reference
+		 */
+		if( verification_handle->digest_pipeline != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free storage media buffer queue.",
-			 function );
-
-			goto on_error;
+			digest_pipeline_free(
+			 &( verification_handle->digest_pipeline ),
+			 NULL );
 		}
+		storage_media_buffer_queue_free(
+		 &( verification_handle->storage_media_buffer_queue ),
+		 NULL );
 	}
 #endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
-	if( verification_handle_finalize_integrity_hash(
-	     verification_handle,
+	return( -1 );
+}
+
+/* Updates the process status while the chunk integrity is scanned
+ * Returns 1 to continue, 0 to abort or -1 on error
+ */
+int verification_handle_scan_chunk_integrity_progress_callback(
+     size64_t bytes_scanned,
+     size64_t media_size,
+     void *callback_data )
+{
+	verification_handle_t *verification_handle = NULL;
+
+	if( callback_data == NULL )
+	{
+		return( -1 );
+	}
+	verification_handle = (verification_handle_t *) callback_data;
+
+	if( verification_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	verification_handle->last_offset_hashed = (off64_t) bytes_scanned;
+
+	if( process_status_update(
+	     verification_handle->process_status,
+	     bytes_scanned,
+	     media_size,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Verifies the chunk checksums of the input
+ * The stored chunk data is verified out of order by the integrity scan threads
+ * of the input handle and no digest hashes are calculated
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int verification_handle_verify_chunk_integrity(
+     verification_handle_t *verification_handle,
+     uint8_t print_status_information,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function              = "verification_handle_verify_chunk_integrity";
+	uint32_t number_of_checksum_errors = 0;
+	int is_corrupted                   = 0;
+	int result                         = 0;
+	int status                         = PROCESS_STATUS_COMPLETED;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( verification_handle->calculate_md5 != 0 )
+	 || ( verification_handle->calculate_sha1 != 0 )
+	 || ( verification_handle->calculate_sha256 != 0 )
+	 || ( verification_handle->calculate_blake3 != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid verification handle - digest hashes are not supported in checksum only mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_handle_set_number_of_integrity_scan_threads(
+	     verification_handle->input_handle,
+	     verification_handle->number_of_threads,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to finalize integrity hash(es).",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of integrity scan threads.",
 		 function );
 
 		goto on_error;
 	}
-	if( verification_handle_get_integrity_hash_from_input(
-	     verification_handle,
+	verification_handle->last_offset_hashed = 0;
+
+	if( process_status_initialize(
+	     &( verification_handle->process_status ),
+	     _SYSTEM_STRING( "Verify" ),
+	     _SYSTEM_STRING( "verified" ),
+	     _SYSTEM_STRING( "Read" ),
+	     verification_handle->notify_stream,
+	     print_status_information,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to retrieve integrity hash(es) from input.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_start(
+	     verification_handle->process_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start process status.",
+		 function );
+
+		goto on_error;
+	}
+	result = libewf_handle_scan_chunk_integrity(
+	          verification_handle->input_handle,
+	          &verification_handle_scan_chunk_integrity_progress_callback,
+	          (void *) verification_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan chunk integrity.",
 		 function );
 
 		goto on_error;
 	}
+	else if( result == 0 )
+	{
+		verification_handle->abort = 1;
+	}
 	if( verification_handle->abort != 0 )
 	{
 		status = PROCESS_STATUS_ABORTED;
@@ -2250,37 +4170,9 @@ int verification_handle_verify_input(
 	{
 		fprintf(
 		 verification_handle->notify_stream,
-		 "\n" );
-
-		if( verification_handle_checksum_errors_fprint(
-		     verification_handle,
-		     verification_handle->notify_stream,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print checksum errors.",
-			 function );
-
-			goto on_error;
-		}
-		if( verification_handle_hash_values_fprint(
-		     verification_handle,
-		     verification_handle->notify_stream,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print hash values.",
-			 function );
+		 "\n" );
 
-			goto on_error;
-		}
-		if( verification_handle_additional_hash_values_fprint(
+		if( verification_handle_checksum_errors_fprint(
 		     verification_handle,
 		     verification_handle->notify_stream,
 		     error ) != 1 )
@@ -2289,7 +4181,7 @@ int verification_handle_verify_input(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print additional hash values.",
+			 "%s: unable to print checksum errors.",
 			 function );
 
 			goto on_error;
@@ -2314,34 +4206,6 @@ int verification_handle_verify_input(
 
 				goto on_error;
 			}
-			if( verification_handle_hash_values_fprint(
-			     verification_handle,
-			     log_handle->log_stream,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print hash values in log handle.",
-				 function );
-
-				goto on_error;
-			}
-			if( verification_handle_additional_hash_values_fprint(
-			     verification_handle,
-			     log_handle->log_stream,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print additional hash values in log handle.",
-				 function );
-
-				goto on_error;
-			}
 		}
 	}
 	is_corrupted = libewf_handle_segment_files_corrupted(
@@ -2373,50 +4237,14 @@ int verification_handle_verify_input(
 
 		return( -1 );
 	}
-	if( ( verification_handle->calculate_md5 != 0 )
-	 && ( verification_handle->stored_md5_hash_available != 0 ) )
-	{
-		md5_hash_compare = system_string_compare(
-		                    verification_handle->stored_md5_hash_string,
-		                    verification_handle->calculated_md5_hash_string,
-		                    33 );
-	}
-	if( ( verification_handle->calculate_sha1 != 0 )
-	 && ( verification_handle->stored_sha1_hash_available != 0 ) )
-	{
-		sha1_hash_compare = system_string_compare(
-		                     verification_handle->stored_sha1_hash_string,
-		                     verification_handle->calculated_sha1_hash_string,
-		                     41 );
-	}
-	if( ( verification_handle->calculate_sha256 != 0 )
-	 && ( verification_handle->stored_sha256_hash_available != 0 ) )
-	{
-		sha256_hash_compare = system_string_compare(
-		                       verification_handle->stored_sha256_hash_string,
-		                       verification_handle->calculated_sha256_hash_string,
-		                       65 );
-	}
-	/* Note that a set of EWF files can be verified without an integrity hash
-	 */
 	if( ( is_corrupted == 0 )
-	 && ( number_of_checksum_errors == 0 )
-	 && ( md5_hash_compare == 0 )
-	 && ( sha1_hash_compare == 0 )
-	 && ( sha256_hash_compare == 0 ) )
+	 && ( number_of_checksum_errors == 0 ) )
 	{
 		return( 1 );
 	}
 	return( 0 );
 
 on_error:
-	if( ( verification_handle->number_of_threads == 0 )
-	 && ( storage_media_buffer != NULL ) )
-	{
-		storage_media_buffer_free(
-		 &storage_media_buffer,
-		 NULL );
-	}
 	if( verification_handle->process_status != NULL )
 	{
 		process_status_stop(
@@ -2428,37 +4256,6 @@ on_error:
 		 &( verification_handle->process_status ),
 		 NULL );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT )
-	if( verification_handle->process_thread_pool != NULL )
-	{
-		libcthreads_thread_pool_join(
-		 &( verification_handle->process_thread_pool ),
-		 NULL );
-	}
-	if( verification_handle->output_thread_pool != NULL )
-	{
-		libcthreads_thread_pool_join(
-		 &( verification_handle->output_thread_pool ),
-		 NULL );
-	}
-	if( verification_handle->output_list != NULL )
-	{
-		verification_handle_empty_output_list(
-		 verification_handle,
-		 NULL );
-		libcdata_list_free(
-		 &( verification_handle->output_list ),
-		 NULL,
-		 NULL );
-	}
-	if( verification_handle->storage_media_buffer_queue != NULL )
-	{
-		storage_media_buffer_queue_free(
-		 &( verification_handle->storage_media_buffer_queue ),
-		 NULL );
-	}
-#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
-
 	return( -1 );
 }
 
@@ -2661,6 +4458,7 @@ int verification_handle_verify_file_entry(
 	int return_value                = 0;
 	int sha1_hash_compare           = 0;
 	int sha256_hash_compare         = 0;
+	int blake3_hash_compare         = 0;
 
 	if( verification_handle == NULL )
 	{
@@ -2962,6 +4760,24 @@ int verification_handle_verify_file_entry(
 
 					goto on_error;
 				}
+				if( verification_handle->calculate_blake3 != 0 )
+				{
+					if( digest_engine_blake3_update(
+					     verification_handle->blake3_context,
+					     file_entry_data,
+					     read_count,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to update BLAKE3 hash.",
+						 function );
+
+						goto on_error;
+					}
+				}
 			}
 			memory_free(
 			 file_entry_data );
@@ -3052,11 +4868,20 @@ int verification_handle_verify_file_entry(
 						       verification_handle->calculated_sha256_hash_string,
 						       65 );
 			}
+			if( ( verification_handle->calculate_blake3 != 0 )
+			 && ( verification_handle->stored_blake3_hash_available != 0 ) )
+			{
+				blake3_hash_compare = system_string_compare(
+						       verification_handle->stored_blake3_hash_string,
+						       verification_handle->calculated_blake3_hash_string,
+						       65 );
+			}
 		}
 		if( ( result != 0 )
 		 && ( md5_hash_compare == 0 )
 		 && ( sha1_hash_compare == 0 )
-		 && ( sha256_hash_compare == 0 ) )
+		 && ( sha256_hash_compare == 0 )
+		 && ( blake3_hash_compare == 0 ) )
 		{
 			return_value = 1;
 		}
@@ -3294,6 +5119,17 @@ int verification_handle_get_integrity_hash_from_input(
 
 		return( -1 );
 	}
+	if( verification_handle->stored_blake3_hash_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verification handle - missing stored BLAKE3 hash string.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( USE_LIBEWF_GET_MD5_HASH )
 	result = libewf_handle_get_md5_hash(
 		  verification_handle->input_handle,
@@ -3422,6 +5258,36 @@ int verification_handle_get_integrity_hash_from_input(
 	}
 	verification_handle->stored_sha256_hash_available = result;
 
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libewf_handle_get_utf16_hash_value(
+		  verification_handle->input_handle,
+		  (uint8_t *) "BLAKE3",
+		  6,
+		  (uint16_t *) verification_handle->stored_blake3_hash_string,
+		  65,
+		  error );
+#else
+	result = libewf_handle_get_utf8_hash_value(
+		  verification_handle->input_handle,
+		  (uint8_t *) "BLAKE3",
+		  6,
+		  (uint8_t *) verification_handle->stored_blake3_hash_string,
+		  65,
+		  error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine stored BLAKE3 hash string.",
+		 function );
+
+		return( -1 );
+	}
+	verification_handle->stored_blake3_hash_available = result;
+
 	return( 1 );
 }
 
@@ -3488,6 +5354,8 @@ int verification_handle_get_integrity_hash_from_file_entry(
 
 	verification_handle->stored_sha256_hash_available = 0;
 
+	verification_handle->stored_blake3_hash_available = 0;
+
 	return( 1 );
 }
 
@@ -3722,6 +5590,82 @@ int verification_handle_set_number_of_threads(
 	return( result );
 }
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Sets a process thread pool that is shared with other verification handles
+ * The thread pool must use verification_handle_process_shared_storage_media_buffer_callback
+ * and is not freed by the verification handle
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_set_shared_process_thread_pool(
+     verification_handle_t *verification_handle,
+     libcthreads_thread_pool_t *thread_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_set_shared_process_thread_pool";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->pending_buffers_mutex == NULL )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( verification_handle->pending_buffers_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create pending buffers mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( verification_handle->pending_buffers_condition == NULL )
+	{
+		if( libcthreads_condition_initialize(
+		     &( verification_handle->pending_buffers_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create pending buffers condition.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	verification_handle->shared_process_thread_pool = thread_pool;
+	verification_handle->number_of_pending_buffers  = 0;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* Sets the additional digest types
  * Returns 1 if successful or -1 on error
  */
@@ -3735,6 +5679,7 @@ int verification_handle_set_additional_digest_types(
 	size_t string_length                             = 0;
 	size_t string_segment_size                       = 0;
 	uint8_t calculate_sha1                           = 0;
+	uint8_t calculate_blake3                         = 0;
 	uint8_t calculate_sha256                         = 0;
 	int number_of_segments                           = 0;
 	int result                                       = 0;
@@ -3912,6 +5857,20 @@ int verification_handle_set_additional_digest_types(
 			{
 				calculate_sha256 = 1;
 			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "blake3" ),
+			          6 ) == 0 )
+			{
+				calculate_blake3 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "BLAKE3" ),
+			          6 ) == 0 )
+			{
+				calculate_blake3 = 1;
+			}
 		}
 		else if( string_segment_size == 8 )
 		{
@@ -3983,6 +5942,25 @@ int verification_handle_set_additional_digest_types(
 		}
 		verification_handle->calculate_sha256 = 1;
 	}
+	if( ( calculate_blake3 != 0 )
+	 && ( verification_handle->calculate_blake3 == 0 ) )
+	{
+		verification_handle->calculated_blake3_hash_string = system_string_allocate(
+		                                                      65 );
+
+		if( verification_handle->calculated_blake3_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create calculated BLAKE3 digest hash string.",
+			 function );
+
+			goto on_error;
+		}
+		verification_handle->calculate_blake3 = 1;
+	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( libcsplit_wide_split_string_free(
 	     &string_elements,
@@ -4213,6 +6191,26 @@ int verification_handle_hash_values_fprint(
 		 "SHA256 hash calculated over data:\t%" PRIs_SYSTEM "\n",
 		 verification_handle->calculated_sha256_hash_string );
 	}
+	if( verification_handle->calculate_blake3 != 0 )
+	{
+		if( verification_handle->stored_blake3_hash_available == 0 )
+		{
+			fprintf(
+			 stream,
+			 "BLAKE3 hash stored in file:\t\tN/A\n" );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "BLAKE3 hash stored in file:\t\t%" PRIs_SYSTEM "\n",
+			 verification_handle->stored_blake3_hash_string );
+		}
+		fprintf(
+		 stream,
+		 "BLAKE3 hash calculated over data:\t%" PRIs_SYSTEM "\n",
+		 verification_handle->calculated_blake3_hash_string );
+	}
 	return( 1 );
 }
 
@@ -4365,6 +6363,19 @@ int verification_handle_additional_hash_values_fprint(
 				}
 			}
 		}
+		if( verification_handle->calculate_blake3 != 0 )
+		{
+			if( hash_value_identifier_size == 7 )
+			{
+				if( narrow_string_compare(
+				     hash_value_identifier,
+				     "BLAKE3",
+				     6 ) == 0 )
+				{
+					continue;
+				}
+			}
+		}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 		if( libewf_handle_get_utf16_hash_value(
 		     verification_handle->input_handle,
@@ -25,7 +25,9 @@
 #include <common.h>
 #include <types.h>
 
+#include "digest_engine.h"
 #include "digest_hash.h"
+#include "digest_pipeline.h"
 #include "ewftools_libcdata.h"
 #include "ewftools_libcerror.h"
 #include "ewftools_libcthreads.h"
@@ -63,7 +65,7 @@ struct verification_handle
 
 	/* The MD5 digest context
 	 */
-	libhmac_md5_context_t *md5_context;
+	digest_engine_md5_context_t *md5_context;
 
 	/* Value to indicate the MD5 digest context was initialized
 	 */
@@ -87,7 +89,7 @@ struct verification_handle
 
 	/* The SHA1 digest context
 	 */
-	libhmac_sha1_context_t *sha1_context;
+	digest_engine_sha1_context_t *sha1_context;
 
 	/* Value to indicate the SHA1 digest context was initialized
 	 */
@@ -111,12 +113,17 @@ struct verification_handle
 
 	/* The SHA256 digest context
 	 */
-	libhmac_sha256_context_t *sha256_context;
+	digest_engine_sha256_context_t *sha256_context;
 
 	/* Value to indicate the SHA256 digest context was initialized
 	 */
 	uint8_t sha256_context_initialized;
 
+	/* The digest pipeline
+	 * Used to calculate the digest hashes in parallel
+	 */
+	digest_pipeline_t *digest_pipeline;
+
 	/* The calculated SHA256 digest hash string
 	 */
 	system_character_t *calculated_sha256_hash_string;
@@ -129,10 +136,39 @@ struct verification_handle
 	 */
 	system_character_t *stored_sha256_hash_string;
 
+	/* Value to indicate if the BLAKE3 digest hash should be calculated
+	 */
+	uint8_t calculate_blake3;
+
+	/* The BLAKE3 digest context
+	 */
+	digest_engine_blake3_context_t *blake3_context;
+
+	/* Value to indicate the BLAKE3 digest context was initialized
+	 */
+	uint8_t blake3_context_initialized;
+
+	/* The calculated BLAKE3 digest hash string
+	 */
+	system_character_t *calculated_blake3_hash_string;
+
+	/* Value to indicate a stored BLAKE3 digest hash is available
+	 */
+	int stored_blake3_hash_available;
+
+	/* The stored BLAKE3 digest hash string
+	 */
+	system_character_t *stored_blake3_hash_string;
+
 	/* Value to indicate if the data chunk functions instead of the buffered read and write functions should be used
 	 */
 	uint8_t use_data_chunk_functions;
 
+	/* Value to indicate if only the chunk checksums should be verified
+	 * instead of calculating the digest hashes of the media data
+	 */
+	uint8_t checksum_only;
+
 	/* The process buffer size
 	 */
 	size_t process_buffer_size;
@@ -159,6 +195,24 @@ struct verification_handle
 	 */
 	libcthreads_queue_t *storage_media_buffer_queue;
 
+	/* The shared process thread pool
+	 * The thread pool is not owned by the verification handle
+	 */
+	libcthreads_thread_pool_t *shared_process_thread_pool;
+
+	/* The number of storage media buffers pushed onto the shared process thread pool
+	 * that have not been processed yet
+	 */
+	int number_of_pending_buffers;
+
+	/* The pending buffers mutex
+	 */
+	libcthreads_mutex_t *pending_buffers_mutex;
+
+	/* The pending buffers condition
+	 */
+	libcthreads_condition_t *pending_buffers_condition;
+
 #endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 	/* The libewf input handle
@@ -181,6 +235,23 @@ struct verification_handle
 	 */
 	off64_t last_offset_hashed;
 
+	/* The checkpoint filename
+	 */
+	const system_character_t *checkpoint_filename;
+
+	/* Value to indicate the verification should resume from the checkpoint
+	 */
+	uint8_t resume_from_checkpoint;
+
+	/* The checkpoint interval
+	 * Contains the number of bytes hashed between checkpoints
+	 */
+	size64_t checkpoint_interval;
+
+	/* The offset of the last checkpoint
+	 */
+	off64_t last_checkpoint_offset;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -252,18 +323,54 @@ int verification_handle_output_storage_media_buffer_callback(
      storage_media_buffer_t *storage_media_buffer,
      verification_handle_t *verification_handle );
 
+int verification_handle_process_shared_storage_media_buffer_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     void *arguments );
+
+int verification_handle_push_shared_storage_media_buffer(
+     verification_handle_t *verification_handle,
+     storage_media_buffer_t *storage_media_buffer,
+     libcerror_error_t **error );
+
+int verification_handle_wait_for_pending_buffers(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
 int verification_handle_empty_output_list(
      verification_handle_t *verification_handle,
      libcerror_error_t **error );
 
 #endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
+int verification_handle_write_checkpoint(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_resume_from_checkpoint(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_remove_checkpoint(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
 int verification_handle_verify_input(
      verification_handle_t *verification_handle,
      uint8_t print_status_information,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int verification_handle_scan_chunk_integrity_progress_callback(
+     size64_t bytes_scanned,
+     size64_t media_size,
+     void *callback_data );
+
+int verification_handle_verify_chunk_integrity(
+     verification_handle_t *verification_handle,
+     uint8_t print_status_information,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
 int verification_handle_verify_single_files(
      verification_handle_t *verification_handle,
      uint8_t print_status_information,
@@ -315,6 +422,15 @@ int verification_handle_set_number_of_threads(
      const system_character_t *string,
      libcerror_error_t **error );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int verification_handle_set_shared_process_thread_pool(
+     verification_handle_t *verification_handle,
+     libcthreads_thread_pool_t *thread_pool,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int verification_handle_set_additional_digest_types(
      verification_handle_t *verification_handle,
      const system_character_t *string,
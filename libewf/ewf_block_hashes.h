@@ -0,0 +1,100 @@
+/*
+ * EWF block hashes sidecar file
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EWF_BLOCK_HASHES_H )
+#define _EWF_BLOCK_HASHES_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The block hashes file header
+ */
+typedef struct ewf_block_hashes_header ewf_block_hashes_header_t;
+
+struct ewf_block_hashes_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "EWFBHASH"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The hash method
+	 * Consists of 4 bytes
+	 */
+	uint8_t hash_method[ 4 ];
+
+	/* The chunk size
+	 * Consists of 4 bytes
+	 */
+	uint8_t chunk_size[ 4 ];
+
+	/* The number of chunks per block
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_chunks_per_block[ 4 ];
+
+	/* The media size
+	 * Consists of 8 bytes
+	 */
+	uint8_t media_size[ 8 ];
+
+	/* The number of hashes
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_hashes[ 8 ];
+
+	/* The set identifier
+	 * Consists of 16 bytes
+	 * Contains a GUID
+	 */
+	uint8_t set_identifier[ 16 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding[ 4 ];
+
+	/* The checksum of all previous data
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+/* The hashes are stored directly after the header
+ * followed by a 4-byte checksum of the hashes
+ */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EWF_BLOCK_HASHES_H ) */
+
@@ -0,0 +1,1147 @@
+/*
+ * Asynchronous reader functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_async_reader.h"
+#include "libewf_handle.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcnotify.h"
+#include "libewf_libcthreads.h"
+#include "libewf_types.h"
+
+/* Creates an asynchronous reader
+ * Make sure the value async_reader is referencing, is set to NULL
+ * Without threads the requests are read when they are pushed
+ * The requests are read using shared clones of the handle, which are created on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_async_reader_initialize(
+     libewf_async_reader_t **async_reader,
+     libewf_handle_t *handle,
+     int number_of_threads,
+     int maximum_number_of_requests,
+     libcerror_error_t **error )
+{
+	static char *function                = "libewf_async_reader_initialize";
+	int maximum_number_of_worker_handles = 0;
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *async_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid asynchronous reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_requests <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of requests value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*async_reader = memory_allocate_structure(
+	                 libewf_async_reader_t );
+
+	if( *async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create asynchronous reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *async_reader,
+	     0,
+	     sizeof( libewf_async_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear asynchronous reader.",
+		 function );
+
+		memory_free(
+		 *async_reader );
+
+		*async_reader = NULL;
+
+		return( -1 );
+	}
+	/* Every thread uses its own worker handle so that the reads are not
+	 * serialized by the lock of the handle and do not change its current offset
+	 */
+	maximum_number_of_worker_handles = number_of_threads;
+
+	if( maximum_number_of_worker_handles == 0 )
+	{
+		maximum_number_of_worker_handles = 1;
+	}
+	( *async_reader )->worker_handles = (libewf_handle_t **) memory_allocate(
+	                                                         sizeof( libewf_handle_t * ) * maximum_number_of_worker_handles );
+
+	if( ( *async_reader )->worker_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create worker handles.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *async_reader )->worker_handles,
+	     0,
+	     sizeof( libewf_handle_t * ) * maximum_number_of_worker_handles ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear worker handles.",
+		 function );
+
+		goto on_error;
+	}
+	( *async_reader )->available_worker_handles = (libewf_handle_t **) memory_allocate(
+	                                                                   sizeof( libewf_handle_t * ) * maximum_number_of_worker_handles );
+
+	if( ( *async_reader )->available_worker_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create available worker handles.",
+		 function );
+
+		goto on_error;
+	}
+	( *async_reader )->maximum_number_of_worker_handles = maximum_number_of_worker_handles;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *async_reader )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_threads > 0 )
+	{
+		/* The thread pool queue can hold all requests in flight
+		 * so pushing a request does not block
+		 */
+		if( libcthreads_thread_pool_create(
+		     &( ( *async_reader )->thread_pool ),
+		     NULL,
+		     number_of_threads,
+		     maximum_number_of_requests,
+		     (int (*)(intptr_t *, void *)) &libewf_async_reader_read_callback,
+		     (void *) *async_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	( *async_reader )->handle                     = handle;
+	( *async_reader )->maximum_number_of_requests = maximum_number_of_requests;
+
+	return( 1 );
+
+on_error:
+	if( *async_reader != NULL )
+	{
+		if( ( *async_reader )->available_worker_handles != NULL )
+		{
+			memory_free(
+			 ( *async_reader )->available_worker_handles );
+		}
+		if( ( *async_reader )->worker_handles != NULL )
+		{
+			memory_free(
+			 ( *async_reader )->worker_handles );
+		}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( ( *async_reader )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *async_reader )->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *async_reader );
+
+		*async_reader = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an asynchronous reader
+ * Waits for the requests in flight to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_async_reader_free(
+     libewf_async_reader_t **async_reader,
+     libcerror_error_t **error )
+{
+	static char *function   = "libewf_async_reader_free";
+	int result              = 1;
+	int worker_handle_index = 0;
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *async_reader != NULL )
+	{
+		/* The handle reference is freed elsewhere
+		 */
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( ( *async_reader )->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *async_reader )->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		for( worker_handle_index = 0;
+		     worker_handle_index < ( *async_reader )->number_of_worker_handles;
+		     worker_handle_index++ )
+		{
+			if( ( *async_reader )->worker_handles[ worker_handle_index ] == NULL )
+			{
+				continue;
+			}
+			if( libewf_handle_close(
+			     ( *async_reader )->worker_handles[ worker_handle_index ],
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close worker handle: %d.",
+				 function,
+				 worker_handle_index );
+
+				result = -1;
+			}
+			if( libewf_handle_free(
+			     &( ( *async_reader )->worker_handles[ worker_handle_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free worker handle: %d.",
+				 function,
+				 worker_handle_index );
+
+				result = -1;
+			}
+		}
+		if( ( *async_reader )->available_worker_handles != NULL )
+		{
+			memory_free(
+			 ( *async_reader )->available_worker_handles );
+		}
+		if( ( *async_reader )->worker_handles != NULL )
+		{
+			memory_free(
+			 ( *async_reader )->worker_handles );
+		}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *async_reader )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *async_reader );
+
+		*async_reader = NULL;
+	}
+	return( result );
+}
+
+/* Grabs a worker handle that is not in use by another thread
+ * The worker handles are created on demand as shared clones of the handle
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_async_reader_grab_worker_handle(
+     libewf_async_reader_t *async_reader,
+     libewf_handle_t **worker_handle,
+     libcerror_error_t **error )
+{
+	static char *function   = "libewf_async_reader_grab_worker_handle";
+	int worker_handle_index = -1;
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( async_reader->number_of_available_worker_handles > 0 )
+	{
+		async_reader->number_of_available_worker_handles -= 1;
+
+		*worker_handle = async_reader->available_worker_handles[ async_reader->number_of_available_worker_handles ];
+	}
+	else if( async_reader->number_of_worker_handles < async_reader->maximum_number_of_worker_handles )
+	{
+		worker_handle_index = async_reader->number_of_worker_handles;
+
+		async_reader->number_of_worker_handles += 1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( worker_handle_index == -1 )
+	{
+		if( *worker_handle == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: no worker handle available.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* The worker handle is created outside the mutex since creating
+	 * the shared clone requires the lock of the handle
+	 */
+	if( libewf_handle_clone_shared(
+	     &( async_reader->worker_handles[ worker_handle_index ] ),
+	     async_reader->handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create worker handle: %d.",
+		 function,
+		 worker_handle_index );
+
+		return( -1 );
+	}
+	*worker_handle = async_reader->worker_handles[ worker_handle_index ];
+
+	return( 1 );
+}
+
+/* Releases a worker handle so that it can be used by another thread
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_async_reader_release_worker_handle(
+     libewf_async_reader_t *async_reader,
+     libewf_handle_t *worker_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_async_reader_release_worker_handle";
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( async_reader->available_worker_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid asynchronous reader - missing available worker handles.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( async_reader->number_of_available_worker_handles >= async_reader->number_of_worker_handles )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid asynchronous reader - number of available worker handles value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	async_reader->available_worker_handles[ async_reader->number_of_available_worker_handles ] = worker_handle;
+
+	async_reader->number_of_available_worker_handles += 1;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 async_reader->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Processes an asynchronous read request
+ * Reads the media data unless the request was cancelled and calls the completion callback
+ * The completion callback is called with a result of 1 if the media data was read,
+ * 0 if the request was cancelled or -1 if the media data could not be read
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_async_reader_process_request(
+     libewf_async_reader_t *async_reader,
+     libewf_async_read_request_t *request,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error  = NULL;
+	libewf_handle_t *worker_handle = NULL;
+	static char *function          = "libewf_async_reader_process_request";
+	ssize_t read_count             = 0;
+	int read_result                = 0;
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( request->abort_generation == async_reader->abort_generation )
+	{
+		read_result = 1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( read_result == 1 )
+	{
+		if( libewf_async_reader_grab_worker_handle(
+		     async_reader,
+		     &worker_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to grab worker handle.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libewf_handle_read_buffer_at_offset(
+		              worker_handle,
+		              request->buffer,
+		              request->buffer_size,
+		              request->offset,
+		              &read_error );
+
+		if( read_count < 0 )
+		{
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 read_error );
+			}
+#endif
+			libcerror_error_free(
+			 &read_error );
+
+			read_result = -1;
+		}
+		if( libewf_async_reader_release_worker_handle(
+		     async_reader,
+		     worker_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release worker handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The request is no longer in flight before the completion callback is called
+	 * so that the completion callback can push a new request
+	 */
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	async_reader->number_of_requests -= 1;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	request->callback(
+	 async_reader->handle,
+	 request->offset,
+	 request->buffer,
+	 read_count,
+	 read_result,
+	 request->callback_data );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	async_reader->number_of_requests -= 1;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	request->callback(
+	 async_reader->handle,
+	 request->offset,
+	 request->buffer,
+	 -1,
+	 -1,
+	 request->callback_data );
+
+	return( -1 );
+}
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+
+/* Callback function to process an asynchronous read request from a read thread
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_async_reader_read_callback(
+     libewf_async_read_request_t *request,
+     libewf_async_reader_t *async_reader )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libewf_async_reader_read_callback";
+	int result               = 1;
+
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request.",
+		 function );
+
+		result = -1;
+	}
+	else if( libewf_async_reader_process_request(
+	          async_reader,
+	          request,
+	          &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process request.",
+		 function );
+
+		result = -1;
+	}
+	if( request != NULL )
+	{
+		memory_free(
+		 request );
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
+/* Pushes an asynchronous read request
+ * The completion callback is called exactly once for every request that was pushed
+ * Returns 1 if successful, 0 if the maximum number of requests in flight was reached or -1 on error
+ */
+int libewf_async_reader_push_request(
+     libewf_async_reader_t *async_reader,
+     off64_t offset,
+     void *buffer,
+     size_t buffer_size,
+     void (*callback)(
+            libewf_handle_t *handle,
+            off64_t offset,
+            void *buffer,
+            ssize_t read_count,
+            int result,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libewf_async_read_request_t *request = NULL;
+	static char *function                = "libewf_async_reader_push_request";
+	uint32_t abort_generation            = 0;
+	int result                           = 0;
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( async_reader->number_of_requests < async_reader->maximum_number_of_requests )
+	{
+		async_reader->number_of_requests += 1;
+
+		abort_generation = async_reader->abort_generation;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	request = memory_allocate_structure(
+	           libewf_async_read_request_t );
+
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create request.",
+		 function );
+
+		goto on_error;
+	}
+	request->offset           = offset;
+	request->buffer           = buffer;
+	request->buffer_size      = buffer_size;
+	request->callback         = callback;
+	request->callback_data    = callback_data;
+	request->abort_generation = abort_generation;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( async_reader->thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_push(
+		     async_reader->thread_pool,
+		     (intptr_t *) request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push request onto thread pool queue.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
+	/* Without threads the request is processed and completed before returning
+	 */
+	result = libewf_async_reader_process_request(
+	          async_reader,
+	          request,
+	          error );
+
+	memory_free(
+	 request );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process request.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( request != NULL )
+	{
+		memory_free(
+		 request );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	async_reader->number_of_requests -= 1;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( -1 );
+}
+
+/* Signals the asynchronous reader to cancel the requests in flight
+ * Requests that are already being read complete normally
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_async_reader_signal_abort(
+     libewf_async_reader_t *async_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_async_reader_signal_abort";
+
+	if( async_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid asynchronous reader.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	async_reader->abort_generation += 1;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     async_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,195 @@
+/*
+ * Asynchronous reader functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_ASYNC_READER_H )
+#define _LIBEWF_ASYNC_READER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+#include "libewf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of threads used to serve the asynchronous read requests
+ */
+#define LIBEWF_ASYNC_READER_NUMBER_OF_THREADS			4
+
+/* The maximum number of asynchronous read requests in flight
+ */
+#define LIBEWF_ASYNC_READER_MAXIMUM_NUMBER_OF_REQUESTS		64
+
+/* The maximum number of prefetch requests pushed per will need access advice
+ * Half of the requests in flight are left for asynchronous reads
+ */
+#define LIBEWF_ASYNC_READER_MAXIMUM_NUMBER_OF_PREFETCH_REQUESTS	32
+
+typedef struct libewf_async_read_request libewf_async_read_request_t;
+
+struct libewf_async_read_request
+{
+	/* The media data offset
+	 */
+	off64_t offset;
+
+	/* The buffer
+	 */
+	void *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The completion callback
+	 */
+	void (*callback)(
+	       libewf_handle_t *handle,
+	       off64_t offset,
+	       void *buffer,
+	       ssize_t read_count,
+	       int result,
+	       void *callback_data );
+
+	/* The completion callback data
+	 */
+	void *callback_data;
+
+	/* The abort generation at the time the request was queued
+	 */
+	uint32_t abort_generation;
+};
+
+typedef struct libewf_async_reader libewf_async_reader_t;
+
+struct libewf_async_reader
+{
+	/* The handle
+	 * The handle is not managed by the asynchronous reader
+	 */
+	libewf_handle_t *handle;
+
+	/* The maximum number of requests in flight
+	 */
+	int maximum_number_of_requests;
+
+	/* The number of requests in flight
+	 */
+	int number_of_requests;
+
+	/* The abort generation
+	 * Requests queued before the last abort are cancelled
+	 */
+	uint32_t abort_generation;
+
+	/* The worker handles
+	 * Contains the shared clones of the handle used by the threads
+	 */
+	libewf_handle_t **worker_handles;
+
+	/* The number of worker handles
+	 */
+	int number_of_worker_handles;
+
+	/* The available worker handles
+	 * Contains the worker handles that are not in use by a thread
+	 */
+	libewf_handle_t **available_worker_handles;
+
+	/* The number of available worker handles
+	 */
+	int number_of_available_worker_handles;
+
+	/* The maximum number of worker handles
+	 */
+	int maximum_number_of_worker_handles;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The read thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libewf_async_reader_initialize(
+     libewf_async_reader_t **async_reader,
+     libewf_handle_t *handle,
+     int number_of_threads,
+     int maximum_number_of_requests,
+     libcerror_error_t **error );
+
+int libewf_async_reader_free(
+     libewf_async_reader_t **async_reader,
+     libcerror_error_t **error );
+
+int libewf_async_reader_grab_worker_handle(
+     libewf_async_reader_t *async_reader,
+     libewf_handle_t **worker_handle,
+     libcerror_error_t **error );
+
+int libewf_async_reader_release_worker_handle(
+     libewf_async_reader_t *async_reader,
+     libewf_handle_t *worker_handle,
+     libcerror_error_t **error );
+
+int libewf_async_reader_process_request(
+     libewf_async_reader_t *async_reader,
+     libewf_async_read_request_t *request,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+int libewf_async_reader_read_callback(
+     libewf_async_read_request_t *request,
+     libewf_async_reader_t *async_reader );
+#endif
+
+int libewf_async_reader_push_request(
+     libewf_async_reader_t *async_reader,
+     off64_t offset,
+     void *buffer,
+     size_t buffer_size,
+     void (*callback)(
+            libewf_handle_t *handle,
+            off64_t offset,
+            void *buffer,
+            ssize_t read_count,
+            int result,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libewf_async_reader_signal_abort(
+     libewf_async_reader_t *async_reader,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_ASYNC_READER_H ) */
+
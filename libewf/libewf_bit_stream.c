@@ -34,6 +34,7 @@ int libewf_bit_stream_initialize(
      libewf_bit_stream_t **bit_stream,
      const uint8_t *byte_stream,
      size_t byte_stream_size,
+     uint8_t storage_type,
      libcerror_error_t **error )
 {
 	static char *function = "libewf_bit_stream_initialize";
@@ -82,6 +83,18 @@ int libewf_bit_stream_initialize(
 
 		return( -1 );
 	}
+	if( ( storage_type != LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	 && ( storage_type != LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported storage type.",
+		 function );
+
+		return( -1 );
+	}
 	*bit_stream = memory_allocate_structure(
 	               libewf_bit_stream_t );
 
@@ -112,6 +125,7 @@ int libewf_bit_stream_initialize(
 	}
 	( *bit_stream )->byte_stream      = byte_stream;
 	( *bit_stream )->byte_stream_size = byte_stream_size;
+	( *bit_stream )->storage_type     = storage_type;
 
 	return( 1 );
 
@@ -195,7 +209,21 @@ int libewf_bit_stream_read(
 		{
 			break;
 		}
-		bit_stream->bit_buffer      |= (uint32_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
+		if( bit_stream->storage_type == LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+		{
+			bit_stream->bit_buffer |= (uint32_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
+		}
+		else
+		{
+			/* The bit buffer cannot contain more than 32 bits
+			 */
+			if( bit_stream->bit_buffer_size > 24 )
+			{
+				break;
+			}
+			bit_stream->bit_buffer <<= 8;
+			bit_stream->bit_buffer  |= bit_stream->byte_stream[ bit_stream->byte_stream_offset ];
+		}
 		bit_stream->bit_buffer_size += 8;
 
 		bit_stream->byte_stream_offset += 1;
@@ -214,6 +242,7 @@ int libewf_bit_stream_get_value(
 {
 	static char *function     = "libewf_bit_stream_get_value";
 	uint32_t safe_value_32bit = 0;
+	uint32_t value_16bit      = 0;
 
 	if( bit_stream == NULL )
 	{
@@ -254,6 +283,46 @@ int libewf_bit_stream_get_value(
 
 		return( 1 );
 	}
+	if( ( bit_stream->storage_type == LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
+	 && ( number_of_bits > 24 ) )
+	{
+		/* The bit buffer cannot contain more than 24 bits and a byte
+		 * hence the value is retrieved in 2 parts
+		 */
+		if( libewf_bit_stream_get_value(
+		     bit_stream,
+		     number_of_bits - 16,
+		     &safe_value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve upper part of value.",
+			 function );
+
+			return( -1 );
+		}
+		if( libewf_bit_stream_get_value(
+		     bit_stream,
+		     16,
+		     &value_16bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve lower part of value.",
+			 function );
+
+			return( -1 );
+		}
+		*value_32bit = ( safe_value_32bit << 16 ) | value_16bit;
+
+		return( 1 );
+	}
 	if( bit_stream->bit_buffer_size < number_of_bits )
 	{
 		if( libewf_bit_stream_read(
@@ -271,23 +340,52 @@ int libewf_bit_stream_get_value(
 			return( -1 );
 		}
 	}
-	safe_value_32bit = bit_stream->bit_buffer;
-
-	if( number_of_bits < 32 )
+	if( bit_stream->storage_type == LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
 	{
-		/* On VS 2008 32-bit "~( 0xfffffffUL << 32 )" does not behave as expected
-		 */
-		safe_value_32bit &= ~( 0xffffffffUL << number_of_bits );
-	}
-	bit_stream->bit_buffer_size -= number_of_bits;
+		safe_value_32bit = bit_stream->bit_buffer;
 
-	if( bit_stream->bit_buffer_size == 0 )
-	{
-		bit_stream->bit_buffer = 0;
+		if( number_of_bits < 32 )
+		{
+			/* On VS 2008 32-bit "~( 0xfffffffUL << 32 )" does not behave as expected
+			 */
+			safe_value_32bit &= ~( 0xffffffffUL << number_of_bits );
+		}
+		bit_stream->bit_buffer_size -= number_of_bits;
+
+		if( bit_stream->bit_buffer_size == 0 )
+		{
+			bit_stream->bit_buffer = 0;
+		}
+		else
+		{
+			bit_stream->bit_buffer >>= number_of_bits;
+		}
 	}
 	else
 	{
-		bit_stream->bit_buffer >>= number_of_bits;
+		if( bit_stream->bit_buffer_size < number_of_bits )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid bit buffer size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		bit_stream->bit_buffer_size -= number_of_bits;
+
+		safe_value_32bit = bit_stream->bit_buffer >> bit_stream->bit_buffer_size;
+
+		if( bit_stream->bit_buffer_size == 0 )
+		{
+			bit_stream->bit_buffer = 0;
+		}
+		else
+		{
+			bit_stream->bit_buffer &= ~( 0xffffffffUL << bit_stream->bit_buffer_size );
+		}
 	}
 	*value_32bit = safe_value_32bit;
 
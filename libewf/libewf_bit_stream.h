@@ -31,6 +31,19 @@
 extern "C" {
 #endif
 
+/* The bit stream storage types
+ */
+enum LIBEWF_BIT_STREAM_STORAGE_TYPES
+{
+	/* The bits are stored from the least to the most significant bit of a byte, such as in deflate
+	 */
+	LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT	= 1,
+
+	/* The bits are stored from the most to the least significant bit of a byte, such as in bzip2
+	 */
+	LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK	= 2
+};
+
 typedef struct libewf_bit_stream libewf_bit_stream_t;
 
 struct libewf_bit_stream
@@ -47,6 +60,10 @@ struct libewf_bit_stream
 	 */
 	size_t byte_stream_offset;
 
+	/* The storage type
+	 */
+	uint8_t storage_type;
+
 	/* The bit buffer
 	 */
 	uint32_t bit_buffer;
@@ -60,6 +77,7 @@ int libewf_bit_stream_initialize(
      libewf_bit_stream_t **bit_stream,
      const uint8_t *byte_stream,
      size_t byte_stream_size,
+     uint8_t storage_type,
      libcerror_error_t **error );
 
 int libewf_bit_stream_free(
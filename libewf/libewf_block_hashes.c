@@ -0,0 +1,1349 @@
+/*
+ * Block hashes functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_block_hashes.h"
+#include "libewf_checksum.h"
+#include "libewf_libbfio.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcnotify.h"
+#include "libewf_libhmac.h"
+
+#include "ewf_block_hashes.h"
+
+const uint8_t ewf_block_hashes_signature[ 8 ] = { 'E', 'W', 'F', 'B', 'H', 'A', 'S', 'H' };
+
+/* Creates block hashes
+ * Make sure the value block_hashes is referencing, is set to NULL
+ * The number of chunks per block can be 0 if the block hashes are read from a file
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_block_hashes_initialize(
+     libewf_block_hashes_t **block_hashes,
+     uint32_t number_of_chunks_per_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_block_hashes_initialize";
+
+	if( block_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_hashes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block hashes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*block_hashes = memory_allocate_structure(
+	                 libewf_block_hashes_t );
+
+	if( *block_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block hashes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_hashes,
+	     0,
+	     sizeof( libewf_block_hashes_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block hashes.",
+		 function );
+
+		goto on_error;
+	}
+	( *block_hashes )->number_of_chunks_per_block = number_of_chunks_per_block;
+
+	return( 1 );
+
+on_error:
+	if( *block_hashes != NULL )
+	{
+		memory_free(
+		 *block_hashes );
+
+		*block_hashes = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees block hashes
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_block_hashes_free(
+     libewf_block_hashes_t **block_hashes,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_block_hashes_free";
+	int result            = 1;
+
+	if( block_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_hashes != NULL )
+	{
+		if( ( *block_hashes )->md5_context != NULL )
+		{
+			if( libhmac_md5_free(
+			     &( ( *block_hashes )->md5_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free MD5 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *block_hashes )->hashes != NULL )
+		{
+			memory_free(
+			 ( *block_hashes )->hashes );
+		}
+		memory_free(
+		 *block_hashes );
+
+		*block_hashes = NULL;
+	}
+	return( result );
+}
+
+/* Clones the block hashes
+ * Only finalized block hashes can be cloned
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_block_hashes_clone(
+     libewf_block_hashes_t **destination_block_hashes,
+     libewf_block_hashes_t *source_block_hashes,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_block_hashes_clone";
+	size_t hashes_size    = 0;
+
+	if( destination_block_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination block hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_block_hashes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination block hashes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_block_hashes == NULL )
+	{
+		*destination_block_hashes = NULL;
+
+		return( 1 );
+	}
+	if( source_block_hashes->is_finalized == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source block hashes - not finalized.",
+		 function );
+
+		return( -1 );
+	}
+	*destination_block_hashes = memory_allocate_structure(
+	                             libewf_block_hashes_t );
+
+	if( *destination_block_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination block hashes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     *destination_block_hashes,
+	     source_block_hashes,
+	     sizeof( libewf_block_hashes_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination block hashes.",
+		 function );
+
+		memory_free(
+		 *destination_block_hashes );
+
+		*destination_block_hashes = NULL;
+
+		return( -1 );
+	}
+	( *destination_block_hashes )->hashes                     = NULL;
+	( *destination_block_hashes )->number_of_allocated_hashes = 0;
+	( *destination_block_hashes )->md5_context                = NULL;
+
+	if( source_block_hashes->number_of_hashes > 0 )
+	{
+		hashes_size = (size_t) source_block_hashes->number_of_hashes * LIBEWF_BLOCK_HASH_SIZE;
+
+		( *destination_block_hashes )->hashes = (uint8_t *) memory_allocate(
+		                                                     hashes_size );
+
+		if( ( *destination_block_hashes )->hashes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination hashes.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_block_hashes )->hashes,
+		     source_block_hashes->hashes,
+		     hashes_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source to destination hashes.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_block_hashes )->number_of_allocated_hashes = source_block_hashes->number_of_hashes;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_block_hashes != NULL )
+	{
+		libewf_block_hashes_free(
+		 destination_block_hashes,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends the hash of the current block
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_block_hashes_append_hash(
+     libewf_block_hashes_t *block_hashes,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation               = NULL;
+	static char *function               = "libewf_block_hashes_append_hash";
+	uint64_t number_of_allocated_hashes = 0;
+
+	if( block_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_hashes->md5_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block hashes - missing MD5 context.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_hashes->number_of_hashes >= block_hashes->number_of_allocated_hashes )
+	{
+		/* Allocate the hashes in steps of 1024 to limit the number of reallocations
+		 */
+		number_of_allocated_hashes = block_hashes->number_of_allocated_hashes + 1024;
+
+		if( number_of_allocated_hashes > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / LIBEWF_BLOCK_HASH_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated hashes value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (uint8_t *) memory_reallocate(
+		                            block_hashes->hashes,
+		                            (size_t) number_of_allocated_hashes * LIBEWF_BLOCK_HASH_SIZE );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize hashes.",
+			 function );
+
+			return( -1 );
+		}
+		block_hashes->hashes                     = reallocation;
+		block_hashes->number_of_allocated_hashes = number_of_allocated_hashes;
+	}
+	if( libhmac_md5_finalize(
+	     block_hashes->md5_context,
+	     &( block_hashes->hashes[ block_hashes->number_of_hashes * LIBEWF_BLOCK_HASH_SIZE ] ),
+	     LIBEWF_BLOCK_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to finalize MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_md5_free(
+	     &( block_hashes->md5_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free MD5 context.",
+		 function );
+
+		return( -1 );
+	}
+	block_hashes->number_of_hashes         += 1;
+	block_hashes->number_of_chunks_in_block = 0;
+
+	return( 1 );
+}
+
+/* Appends the data of a chunk to the block hashes
+ * The chunks must be provided in media order
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_block_hashes_append_chunk(
+     libewf_block_hashes_t *block_hashes,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_block_hashes_append_chunk";
+
+	if( block_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_hashes->number_of_chunks_per_block == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block hashes - missing number of chunks per block.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_hashes->is_finalized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block hashes - already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_hashes->md5_context == NULL )
+	{
+		if( libhmac_md5_initialize(
+		     &( block_hashes->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create MD5 context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libhmac_md5_update(
+	     block_hashes->md5_context,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	block_hashes->media_size                += data_size;
+	block_hashes->number_of_chunks_in_block += 1;
+
+	if( block_hashes->number_of_chunks_in_block >= block_hashes->number_of_chunks_per_block )
+	{
+		if( libewf_block_hashes_append_hash(
+		     block_hashes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append block hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Finalizes the block hashes
+ * The hash of the last block is appended if it contains less than the number of chunks per block
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_block_hashes_finalize(
+     libewf_block_hashes_t *block_hashes,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_block_hashes_finalize";
+
+	if( block_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_hashes->is_finalized != 0 )
+	{
+		return( 1 );
+	}
+	if( block_hashes->md5_context != NULL )
+	{
+		if( libewf_block_hashes_append_hash(
+		     block_hashes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append block hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	block_hashes->is_finalized = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of hashes
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_block_hashes_get_number_of_hashes(
+     libewf_block_hashes_t *block_hashes,
+     uint64_t *number_of_hashes,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_block_hashes_get_number_of_hashes";
+
+	if( block_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hashes.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_hashes = block_hashes->number_of_hashes;
+
+	return( 1 );
+}
+
+/* Retrieves a specific hash
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_block_hashes_get_hash(
+     libewf_block_hashes_t *block_hashes,
+     uint64_t hash_index,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_block_hashes_get_hash";
+
+	if( block_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_index >= block_hashes->number_of_hashes )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < LIBEWF_BLOCK_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     hash,
+	     &( block_hashes->hashes[ hash_index * LIBEWF_BLOCK_HASH_SIZE ] ),
+	     LIBEWF_BLOCK_HASH_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the block hashes from a file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_block_hashes_read_file_io_handle(
+     libewf_block_hashes_t *block_hashes,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	ewf_block_hashes_header_t header;
+	uint8_t checksum_data[ 4 ];
+
+	static char *function        = "libewf_block_hashes_read_file_io_handle";
+	size_t hashes_size           = 0;
+	ssize_t read_count           = 0;
+	uint64_t number_of_hashes    = 0;
+	uint32_t calculated_checksum = 0;
+	uint32_t format_version      = 0;
+	uint32_t hash_method         = 0;
+	uint32_t stored_checksum     = 0;
+	int file_io_handle_is_open   = 0;
+
+	if( block_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_hashes->hashes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block hashes - hashes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &header,
+	              sizeof( ewf_block_hashes_header_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( ewf_block_hashes_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header at offset: 0 (0x00000000).",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: header data:\n",
+		 function );
+		libcnotify_print_data(
+		 (uint8_t *) &header,
+		 sizeof( ewf_block_hashes_header_t ),
+		 0 );
+	}
+#endif
+	if( memory_compare(
+	     header.signature,
+	     ewf_block_hashes_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header.checksum,
+	 stored_checksum );
+
+	if( libewf_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     (uint8_t *) &header,
+	     sizeof( ewf_block_hashes_header_t ) - 4,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate header checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: header checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header.format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 header.hash_method,
+	 hash_method );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 header.chunk_size,
+	 block_hashes->chunk_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 header.number_of_chunks_per_block,
+	 block_hashes->number_of_chunks_per_block );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 header.media_size,
+	 block_hashes->media_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 header.number_of_hashes,
+	 number_of_hashes );
+
+	if( memory_copy(
+	     block_hashes->set_identifier,
+	     header.set_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy set identifier.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: hash method\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 hash_method );
+
+		libcnotify_printf(
+		 "%s: chunk size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 block_hashes->chunk_size );
+
+		libcnotify_printf(
+		 "%s: number of chunks per block\t\t: %" PRIu32 "\n",
+		 function,
+		 block_hashes->number_of_chunks_per_block );
+
+		libcnotify_printf(
+		 "%s: media size\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 block_hashes->media_size );
+
+		libcnotify_printf(
+		 "%s: number of hashes\t\t\t: %" PRIu64 "\n",
+		 function,
+		 number_of_hashes );
+
+		libcnotify_printf(
+		 "%s: checksum\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 stored_checksum );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( format_version != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		goto on_error;
+	}
+	if( hash_method != LIBEWF_BLOCK_HASH_METHOD_MD5 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported hash method: %" PRIu32 ".",
+		 function,
+		 hash_method );
+
+		goto on_error;
+	}
+	if( block_hashes->number_of_chunks_per_block == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunks per block value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_hashes == 0 )
+	 || ( number_of_hashes > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / LIBEWF_BLOCK_HASH_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of hashes value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	hashes_size = (size_t) number_of_hashes * LIBEWF_BLOCK_HASH_SIZE;
+
+	block_hashes->hashes = (uint8_t *) memory_allocate(
+	                                    hashes_size );
+
+	if( block_hashes->hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hashes.",
+		 function );
+
+		goto on_error;
+	}
+	block_hashes->number_of_allocated_hashes = number_of_hashes;
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              block_hashes->hashes,
+	              hashes_size,
+	              (off64_t) sizeof( ewf_block_hashes_header_t ),
+	              error );
+
+	if( read_count != (ssize_t) hashes_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hashes.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              checksum_data,
+	              4,
+	              (off64_t) ( sizeof( ewf_block_hashes_header_t ) + hashes_size ),
+	              error );
+
+	if( read_count != 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hashes checksum.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 checksum_data,
+	 stored_checksum );
+
+	if( libewf_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     block_hashes->hashes,
+	     hashes_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate hashes checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: hashes checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		goto on_error;
+	}
+	if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			file_io_handle_is_open = 1;
+
+			goto on_error;
+		}
+	}
+	block_hashes->number_of_hashes = number_of_hashes;
+	block_hashes->is_finalized     = 1;
+
+	return( 1 );
+
+on_error:
+	if( block_hashes->hashes != NULL )
+	{
+		memory_free(
+		 block_hashes->hashes );
+
+		block_hashes->hashes = NULL;
+	}
+	block_hashes->number_of_allocated_hashes = 0;
+
+	if( file_io_handle_is_open == 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the block hashes to a file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_block_hashes_write_file_io_handle(
+     libewf_block_hashes_t *block_hashes,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	ewf_block_hashes_header_t header;
+	uint8_t checksum_data[ 4 ];
+
+	static char *function        = "libewf_block_hashes_write_file_io_handle";
+	size_t hashes_size           = 0;
+	ssize_t write_count          = 0;
+	uint32_t calculated_checksum = 0;
+	int file_io_handle_is_open   = 0;
+
+	if( block_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_hashes->is_finalized == 0 )
+	 || ( block_hashes->number_of_hashes == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block hashes - missing hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &header,
+	     0,
+	     sizeof( ewf_block_hashes_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     header.signature,
+	     ewf_block_hashes_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 header.format_version,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header.hash_method,
+	 LIBEWF_BLOCK_HASH_METHOD_MD5 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header.chunk_size,
+	 block_hashes->chunk_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header.number_of_chunks_per_block,
+	 block_hashes->number_of_chunks_per_block );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header.media_size,
+	 block_hashes->media_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header.number_of_hashes,
+	 block_hashes->number_of_hashes );
+
+	if( memory_copy(
+	     header.set_identifier,
+	     block_hashes->set_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy set identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     (uint8_t *) &header,
+	     sizeof( ewf_block_hashes_header_t ) - 4,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate header checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 header.checksum,
+	 calculated_checksum );
+
+	hashes_size = (size_t) block_hashes->number_of_hashes * LIBEWF_BLOCK_HASH_SIZE;
+
+	if( libewf_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     block_hashes->hashes,
+	     hashes_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate hashes checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 checksum_data,
+	 calculated_checksum );
+
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_WRITE_TRUNCATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               (uint8_t *) &header,
+	               sizeof( ewf_block_hashes_header_t ),
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) sizeof( ewf_block_hashes_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               block_hashes->hashes,
+	               hashes_size,
+	               (off64_t) sizeof( ewf_block_hashes_header_t ),
+	               error );
+
+	if( write_count != (ssize_t) hashes_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write hashes.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               checksum_data,
+	               4,
+	               (off64_t) ( sizeof( ewf_block_hashes_header_t ) + hashes_size ),
+	               error );
+
+	if( write_count != 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write hashes checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle_is_open == 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,144 @@
+/*
+ * Block hashes functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_BLOCK_HASHES_H )
+#define _LIBEWF_BLOCK_HASHES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libbfio.h"
+#include "libewf_libcerror.h"
+#include "libewf_libhmac.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a block hash, a MD5 hash
+ */
+#define LIBEWF_BLOCK_HASH_SIZE				16
+
+/* The block hash method
+ */
+#define LIBEWF_BLOCK_HASH_METHOD_MD5			1
+
+typedef struct libewf_block_hashes libewf_block_hashes_t;
+
+struct libewf_block_hashes
+{
+	/* The number of chunks per block
+	 */
+	uint32_t number_of_chunks_per_block;
+
+	/* The chunk size
+	 */
+	uint32_t chunk_size;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The set identifier
+	 */
+	uint8_t set_identifier[ 16 ];
+
+	/* The hashes
+	 */
+	uint8_t *hashes;
+
+	/* The number of hashes
+	 */
+	uint64_t number_of_hashes;
+
+	/* The number of allocated hashes
+	 */
+	uint64_t number_of_allocated_hashes;
+
+	/* The MD5 context of the current block
+	 */
+	libhmac_md5_context_t *md5_context;
+
+	/* The number of chunks in the current block
+	 */
+	uint32_t number_of_chunks_in_block;
+
+	/* Value to indicate the block hashes were finalized
+	 */
+	uint8_t is_finalized;
+};
+
+int libewf_block_hashes_initialize(
+     libewf_block_hashes_t **block_hashes,
+     uint32_t number_of_chunks_per_block,
+     libcerror_error_t **error );
+
+int libewf_block_hashes_free(
+     libewf_block_hashes_t **block_hashes,
+     libcerror_error_t **error );
+
+int libewf_block_hashes_clone(
+     libewf_block_hashes_t **destination_block_hashes,
+     libewf_block_hashes_t *source_block_hashes,
+     libcerror_error_t **error );
+
+int libewf_block_hashes_append_hash(
+     libewf_block_hashes_t *block_hashes,
+     libcerror_error_t **error );
+
+int libewf_block_hashes_append_chunk(
+     libewf_block_hashes_t *block_hashes,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libewf_block_hashes_finalize(
+     libewf_block_hashes_t *block_hashes,
+     libcerror_error_t **error );
+
+int libewf_block_hashes_get_number_of_hashes(
+     libewf_block_hashes_t *block_hashes,
+     uint64_t *number_of_hashes,
+     libcerror_error_t **error );
+
+int libewf_block_hashes_get_hash(
+     libewf_block_hashes_t *block_hashes,
+     uint64_t hash_index,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int libewf_block_hashes_read_file_io_handle(
+     libewf_block_hashes_t *block_hashes,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libewf_block_hashes_write_file_io_handle(
+     libewf_block_hashes_t *block_hashes,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_BLOCK_HASHES_H ) */
+
@@ -0,0 +1,1818 @@
+/*
+ * BZip2 (un)compression functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_bit_stream.h"
+#include "libewf_bzip2.h"
+#include "libewf_huffman_tree.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcnotify.h"
+
+/* Table of the CRC-32 of all 8-bit values
+ */
+uint32_t libewf_bzip2_crc32_table[ 256 ];
+
+/* Value to indicate the CRC-32 table been computed
+ */
+int libewf_bzip2_crc32_table_computed = 0;
+
+/* Initializes the internal CRC-32 table
+ * The table speeds up the CRC-32 calculation
+ * BZip2 uses the CRC-32 with the polynomial 0x04c11db7 in the most significant bit first order
+ */
+void libewf_bzip2_initialize_crc32_table(
+     void )
+{
+	uint32_t crc32             = 0;
+	uint16_t crc32_table_index = 0;
+	uint8_t bit_iterator       = 0;
+
+	for( crc32_table_index = 0;
+	     crc32_table_index < 256;
+	     crc32_table_index++ )
+	{
+		crc32 = (uint32_t) crc32_table_index << 24;
+
+		for( bit_iterator = 0;
+		     bit_iterator < 8;
+		     bit_iterator++ )
+		{
+			if( ( crc32 & 0x80000000UL ) != 0 )
+			{
+				crc32 = 0x04c11db7UL ^ ( crc32 << 1 );
+			}
+			else
+			{
+				crc32 <<= 1;
+			}
+		}
+		libewf_bzip2_crc32_table[ crc32_table_index ] = crc32;
+	}
+	libewf_bzip2_crc32_table_computed = 1;
+}
+
+/* Calculates the CRC-32 of the data
+ * It uses the initial value to calculate a new CRC-32
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_bzip2_calculate_crc32(
+     uint32_t *crc32,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function      = "libewf_bzip2_calculate_crc32";
+	size_t data_offset         = 0;
+	uint32_t crc32_table_index = 0;
+	uint32_t safe_crc32        = 0;
+
+	if( crc32 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_bzip2_crc32_table_computed == 0 )
+	{
+		libewf_bzip2_initialize_crc32_table();
+	}
+	safe_crc32 = initial_value ^ (uint32_t) 0xffffffffUL;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		crc32_table_index = ( ( safe_crc32 >> 24 ) ^ data[ data_offset ] ) & 0x000000ffUL;
+
+		safe_crc32 = libewf_bzip2_crc32_table[ crc32_table_index ] ^ ( safe_crc32 << 8 );
+	}
+	*crc32 = safe_crc32 ^ (uint32_t) 0xffffffffUL;
+
+	return( 1 );
+}
+
+/* Reads the stream header
+ * Returns 1 on success or -1 on error
+ */
+int libewf_bzip2_read_stream_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint32_t *block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_bzip2_read_stream_header";
+	size_t safe_offset    = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 4 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_offset = *compressed_data_offset;
+
+	if( safe_offset > ( compressed_data_size - 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data[ safe_offset ] != (uint8_t) 'B' )
+	 || ( compressed_data[ safe_offset + 1 ] != (uint8_t) 'Z' )
+	 || ( compressed_data[ safe_offset + 2 ] != (uint8_t) 'h' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data[ safe_offset + 3 ] < (uint8_t) '1' )
+	 || ( compressed_data[ safe_offset + 3 ] > (uint8_t) '9' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	*block_size = (uint32_t) ( compressed_data[ safe_offset + 3 ] - (uint8_t) '0' ) * 100000;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: block size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 *block_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	*compressed_data_offset = safe_offset + 4;
+
+	return( 1 );
+}
+
+/* Reads a block or end of stream signature
+ * Returns 1 on success or -1 on error
+ */
+int libewf_bzip2_read_signature(
+     libewf_bit_stream_t *bit_stream,
+     uint64_t *signature,
+     libcerror_error_t **error )
+{
+	static char *function   = "libewf_bzip2_read_signature";
+	uint64_t safe_signature = 0;
+	uint32_t value_32bit    = 0;
+
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	/* The 48-bit signature is read in 2 parts
+	 */
+	if( libewf_bit_stream_get_value(
+	     bit_stream,
+	     24,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	safe_signature = value_32bit;
+
+	if( libewf_bit_stream_get_value(
+	     bit_stream,
+	     24,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	safe_signature <<= 24;
+	safe_signature  |= value_32bit;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: signature\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 safe_signature );
+	}
+#endif
+	*signature = safe_signature;
+
+	return( 1 );
+}
+
+/* Reads a block header
+ * The block header is stored after the block signature
+ * Returns 1 on success or -1 on error
+ */
+int libewf_bzip2_read_block_header(
+     libewf_bit_stream_t *bit_stream,
+     uint32_t *block_checksum,
+     uint32_t *origin_pointer,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_bzip2_read_block_header";
+	uint32_t value_32bit  = 0;
+
+	if( block_checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( origin_pointer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid origin pointer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_bit_stream_get_value(
+	     bit_stream,
+	     32,
+	     block_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block checksum from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_bit_stream_get_value(
+	     bit_stream,
+	     1,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve is randomized flag from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	/* Randomized blocks are no longer created by bzip2 since version 0.9.5
+	 */
+	if( value_32bit != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported randomized block.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_bit_stream_get_value(
+	     bit_stream,
+	     24,
+	     origin_pointer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve origin pointer from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: block checksum\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 *block_checksum );
+
+		libcnotify_printf(
+		 "%s: origin pointer\t\t: %" PRIu32 "\n",
+		 function,
+		 *origin_pointer );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads the symbol stack
+ * The symbol stack contains the byte values that are used in the block
+ * Returns 1 on success or -1 on error
+ */
+int libewf_bzip2_read_symbol_stack(
+     libewf_bit_stream_t *bit_stream,
+     uint8_t *symbol_stack,
+     uint16_t *number_of_symbols,
+     libcerror_error_t **error )
+{
+	static char *function           = "libewf_bzip2_read_symbol_stack";
+	uint32_t level1_bitmask         = 0;
+	uint32_t level2_bitmask         = 0;
+	uint16_t byte_value             = 0;
+	uint16_t safe_number_of_symbols = 0;
+	uint8_t level1_bit_index        = 0;
+	uint8_t level2_bit_index        = 0;
+
+	if( symbol_stack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol stack.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_symbols == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of symbols.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every bit in the level 1 bitmask indicates if a level 2 bitmask
+	 * is stored for the corresponding 16 byte values
+	 */
+	if( libewf_bit_stream_get_value(
+	     bit_stream,
+	     16,
+	     &level1_bitmask,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve level 1 bitmask from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	for( level1_bit_index = 0;
+	     level1_bit_index < 16;
+	     level1_bit_index++ )
+	{
+		if( ( level1_bitmask & ( 0x00008000UL >> level1_bit_index ) ) == 0 )
+		{
+			continue;
+		}
+		if( libewf_bit_stream_get_value(
+		     bit_stream,
+		     16,
+		     &level2_bitmask,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve level 2 bitmask from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+		for( level2_bit_index = 0;
+		     level2_bit_index < 16;
+		     level2_bit_index++ )
+		{
+			if( ( level2_bitmask & ( 0x00008000UL >> level2_bit_index ) ) != 0 )
+			{
+				byte_value = ( (uint16_t) level1_bit_index * 16 ) + level2_bit_index;
+
+				symbol_stack[ safe_number_of_symbols++ ] = (uint8_t) byte_value;
+			}
+		}
+	}
+	if( safe_number_of_symbols == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of symbols\t\t: %" PRIu16 "\n",
+		 function,
+		 safe_number_of_symbols );
+	}
+#endif
+	*number_of_symbols = safe_number_of_symbols;
+
+	return( 1 );
+}
+
+/* Reads the selectors
+ * The selectors are stored move-to-front encoded as unary values
+ * Returns 1 on success or -1 on error
+ */
+int libewf_bzip2_read_selectors(
+     libewf_bit_stream_t *bit_stream,
+     uint8_t *selectors,
+     uint8_t number_of_trees,
+     uint16_t number_of_selectors,
+     libcerror_error_t **error )
+{
+	uint8_t stack[ LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_TREES ];
+
+	static char *function   = "libewf_bzip2_read_selectors";
+	uint32_t value_32bit    = 0;
+	uint16_t selector_index = 0;
+	uint8_t stack_index     = 0;
+	uint8_t tree_index      = 0;
+
+	if( selectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid selectors.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_trees < 2 )
+	 || ( number_of_trees > LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_TREES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of trees value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( stack_index = 0;
+	     stack_index < number_of_trees;
+	     stack_index++ )
+	{
+		stack[ stack_index ] = stack_index;
+	}
+	for( selector_index = 0;
+	     selector_index < number_of_selectors;
+	     selector_index++ )
+	{
+		stack_index = 0;
+
+		for( ;; )
+		{
+			if( libewf_bit_stream_get_value(
+			     bit_stream,
+			     1,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			if( value_32bit == 0 )
+			{
+				break;
+			}
+			stack_index++;
+
+			if( stack_index >= number_of_trees )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid selector: %" PRIu16 " value out of bounds.",
+				 function,
+				 selector_index );
+
+				return( -1 );
+			}
+		}
+		tree_index = stack[ stack_index ];
+
+		while( stack_index > 0 )
+		{
+			stack[ stack_index ] = stack[ stack_index - 1 ];
+
+			stack_index--;
+		}
+		stack[ 0 ] = tree_index;
+
+		if( selector_index < LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_SELECTORS )
+		{
+			selectors[ selector_index ] = tree_index;
+		}
+	}
+	return( 1 );
+}
+
+/* Reads a Huffman tree
+ * The code sizes are stored delta encoded
+ * Returns 1 on success or -1 on error
+ */
+int libewf_bzip2_read_huffman_tree(
+     libewf_bit_stream_t *bit_stream,
+     libewf_huffman_tree_t *huffman_tree,
+     uint16_t number_of_symbols,
+     libcerror_error_t **error )
+{
+	uint8_t code_size_array[ LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_SYMBOLS ];
+
+	static char *function = "libewf_bzip2_read_huffman_tree";
+	uint32_t code_size    = 0;
+	uint32_t value_32bit  = 0;
+	uint16_t symbol_index = 0;
+
+	if( ( number_of_symbols < 3 )
+	 || ( number_of_symbols > LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_SYMBOLS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_bit_stream_get_value(
+	     bit_stream,
+	     5,
+	     &code_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve initial code size from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol_index = 0;
+	     symbol_index < number_of_symbols;
+	     symbol_index++ )
+	{
+		for( ;; )
+		{
+			if( ( code_size == 0 )
+			 || ( code_size > LIBEWF_BZIP2_MAXIMUM_CODE_SIZE ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid symbol: %" PRIu16 " code size value out of bounds.",
+				 function,
+				 symbol_index );
+
+				return( -1 );
+			}
+			if( libewf_bit_stream_get_value(
+			     bit_stream,
+			     1,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			if( value_32bit == 0 )
+			{
+				break;
+			}
+			/* A value of 0 indicates to increment and 1 to decrement the code size
+			 */
+			if( libewf_bit_stream_get_value(
+			     bit_stream,
+			     1,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			if( value_32bit == 0 )
+			{
+				code_size += 1;
+			}
+			else
+			{
+				code_size -= 1;
+			}
+		}
+		code_size_array[ symbol_index ] = (uint8_t) code_size;
+	}
+	if( libewf_huffman_tree_build(
+	     huffman_tree,
+	     code_size_array,
+	     (int) number_of_symbols,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the block data
+ * The block data is stored Huffman, run-length and move-to-front encoded
+ * Returns 1 on success or -1 on error
+ */
+int libewf_bzip2_read_block_data(
+     libewf_bit_stream_t *bit_stream,
+     libewf_huffman_tree_t **huffman_trees,
+     uint8_t number_of_trees,
+     const uint8_t *selectors,
+     uint16_t number_of_selectors,
+     uint8_t *symbol_stack,
+     uint16_t number_of_symbols,
+     uint8_t *block_data,
+     size_t *block_data_size,
+     libcerror_error_t **error )
+{
+	libewf_huffman_tree_t *huffman_tree = NULL;
+	static char *function               = "libewf_bzip2_read_block_data";
+	size_t block_data_offset            = 0;
+	size_t run_length                   = 0;
+	size_t run_length_weight            = 1;
+	size_t safe_block_data_size         = 0;
+	uint32_t symbol                     = 0;
+	uint16_t end_of_block_symbol        = 0;
+	uint16_t number_of_group_symbols    = 0;
+	uint16_t selector_index             = 0;
+	uint16_t stack_index                = 0;
+	uint8_t byte_value                  = 0;
+
+	if( huffman_trees == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman trees.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_trees < 2 )
+	 || ( number_of_trees > LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_TREES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of trees value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( selectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid selectors.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_selectors > LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_SELECTORS )
+	{
+		number_of_selectors = LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_SELECTORS;
+	}
+	if( symbol_stack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol stack.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_symbols == 0 )
+	 || ( number_of_symbols > 256 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_block_data_size = *block_data_size;
+
+	if( safe_block_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid block data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Symbol 0 (RUNA) and 1 (RUNB) encode a run of the first value on the stack
+	 * symbols 2 to number of symbols encode the index of a value on the stack + 1
+	 * and the last symbol indicates the end of the block
+	 */
+	end_of_block_symbol = number_of_symbols + 1;
+
+	for( ;; )
+	{
+		if( number_of_group_symbols == 0 )
+		{
+			if( selector_index >= number_of_selectors )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid selector index value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( selectors[ selector_index ] >= number_of_trees )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid selector: %" PRIu16 " value out of bounds.",
+				 function,
+				 selector_index );
+
+				return( -1 );
+			}
+			huffman_tree = huffman_trees[ selectors[ selector_index ] ];
+
+			selector_index         += 1;
+			number_of_group_symbols = LIBEWF_BZIP2_NUMBER_OF_SYMBOLS_PER_SELECTOR;
+		}
+		number_of_group_symbols -= 1;
+
+		if( libewf_huffman_tree_get_symbol_from_bit_stream(
+		     huffman_tree,
+		     bit_stream,
+		     &symbol,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve symbol from Huffman tree.",
+			 function );
+
+			return( -1 );
+		}
+		if( symbol > (uint32_t) end_of_block_symbol )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid symbol: %" PRIu32 " value out of bounds.",
+			 function,
+			 symbol );
+
+			return( -1 );
+		}
+		if( symbol <= 1 )
+		{
+			/* The run length is stored as a bijective base-2 number
+			 */
+			run_length        += ( symbol + 1 ) * run_length_weight;
+			run_length_weight <<= 1;
+
+			if( run_length > ( safe_block_data_size - block_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid run length value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+		if( run_length > 0 )
+		{
+			if( memory_set(
+			     &( block_data[ block_data_offset ] ),
+			     symbol_stack[ 0 ],
+			     run_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to set run in block data.",
+				 function );
+
+				return( -1 );
+			}
+			block_data_offset += run_length;
+
+			run_length        = 0;
+			run_length_weight = 1;
+		}
+		if( symbol == (uint32_t) end_of_block_symbol )
+		{
+			break;
+		}
+		stack_index = (uint16_t) symbol - 1;
+
+		if( stack_index >= number_of_symbols )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid stack index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( block_data_offset >= safe_block_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid block data offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* Move the value to the front of the stack
+		 */
+		byte_value = symbol_stack[ stack_index ];
+
+		while( stack_index > 0 )
+		{
+			symbol_stack[ stack_index ] = symbol_stack[ stack_index - 1 ];
+
+			stack_index--;
+		}
+		symbol_stack[ 0 ] = byte_value;
+
+		block_data[ block_data_offset++ ] = byte_value;
+	}
+	*block_data_size = block_data_offset;
+
+	return( 1 );
+}
+
+/* Reverses the Burrows-Wheeler transform of the block data and the initial run-length encoding
+ * The permutations must be of the same size as the block data and are used to store
+ * the byte value in the lower 8 bits and the index of the next value in the upper 24 bits
+ * so that the transform can be reversed using a single lookup per value
+ * Returns 1 on success or -1 on error
+ */
+int libewf_bzip2_reverse_burrows_wheeler_transform(
+     const uint8_t *block_data,
+     size_t block_data_size,
+     uint32_t *permutations,
+     uint32_t origin_pointer,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	size_t distributions[ 256 ];
+
+	static char *function                = "libewf_bzip2_reverse_burrows_wheeler_transform";
+	size_t block_data_offset             = 0;
+	size_t distribution_value            = 0;
+	size_t number_of_values              = 0;
+	size_t safe_uncompressed_data_offset = 0;
+	uint32_t permutation_value           = 0;
+	uint16_t byte_value                  = 0;
+	uint8_t last_byte_value              = 0;
+	uint8_t number_of_last_byte_values   = 0;
+
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The index of the next value is stored in 24 bits
+	 */
+	if( block_data_size > (size_t) 0x00ffffffUL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( permutations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid permutations.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_data_size > 0 )
+	 && ( (size_t) origin_pointer >= block_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid origin pointer value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+	if( safe_uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_set(
+	     distributions,
+	     0,
+	     sizeof( size_t ) * 256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear distributions.",
+		 function );
+
+		return( -1 );
+	}
+	for( block_data_offset = 0;
+	     block_data_offset < block_data_size;
+	     block_data_offset++ )
+	{
+		byte_value = block_data[ block_data_offset ];
+
+		distributions[ byte_value ] += 1;
+
+		permutations[ block_data_offset ] = byte_value;
+	}
+	/* Determine the offset of the first occurrence of every byte value in the sorted block data
+	 */
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		number_of_values = distributions[ byte_value ];
+
+		distributions[ byte_value ] = distribution_value;
+
+		distribution_value += number_of_values;
+	}
+	for( block_data_offset = 0;
+	     block_data_offset < block_data_size;
+	     block_data_offset++ )
+	{
+		byte_value = block_data[ block_data_offset ];
+
+		permutations[ distributions[ byte_value ] ] |= (uint32_t) block_data_offset << 8;
+
+		distributions[ byte_value ] += 1;
+	}
+	permutation_value = permutations[ origin_pointer ] >> 8;
+
+	for( block_data_offset = 0;
+	     block_data_offset < block_data_size;
+	     block_data_offset++ )
+	{
+		permutation_value = permutations[ permutation_value ];
+		byte_value        = (uint16_t) ( permutation_value & 0x000000ffUL );
+		permutation_value = permutation_value >> 8;
+
+		/* A sequence of 4 identical byte values is followed by the number of additional byte values
+		 */
+		if( number_of_last_byte_values == 4 )
+		{
+			if( (size_t) byte_value > ( uncompressed_data_size - safe_uncompressed_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid uncompressed data value too small.",
+				 function );
+
+				return( -1 );
+			}
+			while( byte_value > 0 )
+			{
+				uncompressed_data[ safe_uncompressed_data_offset++ ] = last_byte_value;
+
+				byte_value--;
+			}
+			number_of_last_byte_values = 0;
+
+			continue;
+		}
+		if( ( number_of_last_byte_values == 0 )
+		 || ( (uint8_t) byte_value != last_byte_value ) )
+		{
+			last_byte_value            = (uint8_t) byte_value;
+			number_of_last_byte_values = 1;
+		}
+		else
+		{
+			number_of_last_byte_values += 1;
+		}
+		if( safe_uncompressed_data_offset >= uncompressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid uncompressed data value too small.",
+			 function );
+
+			return( -1 );
+		}
+		uncompressed_data[ safe_uncompressed_data_offset++ ] = (uint8_t) byte_value;
+	}
+	*uncompressed_data_offset = safe_uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Decompresses data using bzip2 compression
+ * Returns 1 on success or -1 on error
+ */
+int libewf_bzip2_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	libewf_huffman_tree_t *huffman_trees[ LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_TREES ];
+	uint8_t selectors[ LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_SELECTORS ];
+	uint8_t symbol_stack[ 256 ];
+
+	libewf_bit_stream_t *bit_stream     = NULL;
+	uint8_t *block_data                 = NULL;
+	uint32_t *permutations              = NULL;
+	static char *function               = "libewf_bzip2_decompress";
+	size_t block_data_size              = 0;
+	size_t compressed_data_offset       = 0;
+	size_t maximum_block_data_size      = 0;
+	size_t uncompressed_block_offset    = 0;
+	size_t uncompressed_data_offset     = 0;
+	uint64_t signature                  = 0;
+	uint32_t block_size                 = 0;
+	uint32_t calculated_block_checksum  = 0;
+	uint32_t calculated_stream_checksum = 0;
+	uint32_t origin_pointer             = 0;
+	uint32_t stored_block_checksum      = 0;
+	uint32_t stored_stream_checksum     = 0;
+	uint32_t value_32bit                = 0;
+	uint16_t number_of_selectors        = 0;
+	uint16_t number_of_symbols          = 0;
+	uint8_t number_of_trees             = 0;
+	uint8_t tree_index                  = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( tree_index = 0;
+	     tree_index < LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_TREES;
+	     tree_index++ )
+	{
+		huffman_trees[ tree_index ] = NULL;
+	}
+	if( libewf_bzip2_read_stream_header(
+	     compressed_data,
+	     compressed_data_size,
+	     &compressed_data_offset,
+	     &block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stream header.",
+		 function );
+
+		goto on_error;
+	}
+	/* The initial run-length encoding can expand the uncompressed data by at most 5/4
+	 * hence the block data does not need to be larger than that, which for chunk sized
+	 * data is considerably smaller than the block size
+	 */
+	maximum_block_data_size = ( *uncompressed_data_size / 4 ) * 5 + 5;
+
+	if( maximum_block_data_size > (size_t) block_size )
+	{
+		maximum_block_data_size = (size_t) block_size;
+	}
+	block_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * maximum_block_data_size );
+
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
+
+		goto on_error;
+	}
+	permutations = (uint32_t *) memory_allocate(
+	                             sizeof( uint32_t ) * maximum_block_data_size );
+
+	if( permutations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create permutations.",
+		 function );
+
+		goto on_error;
+	}
+	for( tree_index = 0;
+	     tree_index < LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_TREES;
+	     tree_index++ )
+	{
+		if( libewf_huffman_tree_initialize(
+		     &( huffman_trees[ tree_index ] ),
+		     LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_SYMBOLS,
+		     LIBEWF_BZIP2_MAXIMUM_CODE_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create Huffman tree: %" PRIu8 ".",
+			 function,
+			 tree_index );
+
+			goto on_error;
+		}
+	}
+	if( libewf_bit_stream_initialize(
+	     &bit_stream,
+	     &( compressed_data[ compressed_data_offset ] ),
+	     compressed_data_size - compressed_data_offset,
+	     LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	for( ;; )
+	{
+		if( libewf_bzip2_read_signature(
+		     bit_stream,
+		     &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read signature.",
+			 function );
+
+			goto on_error;
+		}
+		if( signature == LIBEWF_BZIP2_END_OF_STREAM_SIGNATURE )
+		{
+			break;
+		}
+		if( signature != LIBEWF_BZIP2_BLOCK_SIGNATURE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported signature: 0x%08" PRIx64 ".",
+			 function,
+			 signature );
+
+			goto on_error;
+		}
+		if( libewf_bzip2_read_block_header(
+		     bit_stream,
+		     &stored_block_checksum,
+		     &origin_pointer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block header.",
+			 function );
+
+			goto on_error;
+		}
+		if( libewf_bzip2_read_symbol_stack(
+		     bit_stream,
+		     symbol_stack,
+		     &number_of_symbols,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read symbol stack.",
+			 function );
+
+			goto on_error;
+		}
+		if( libewf_bit_stream_get_value(
+		     bit_stream,
+		     3,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of trees from bit stream.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_trees = (uint8_t) value_32bit;
+
+		if( libewf_bit_stream_get_value(
+		     bit_stream,
+		     15,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of selectors from bit stream.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_selectors = (uint16_t) value_32bit;
+
+		if( number_of_selectors == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of selectors value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libewf_bzip2_read_selectors(
+		     bit_stream,
+		     selectors,
+		     number_of_trees,
+		     number_of_selectors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read selectors.",
+			 function );
+
+			goto on_error;
+		}
+		for( tree_index = 0;
+		     tree_index < number_of_trees;
+		     tree_index++ )
+		{
+			if( libewf_bzip2_read_huffman_tree(
+			     bit_stream,
+			     huffman_trees[ tree_index ],
+			     number_of_symbols + 2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read Huffman tree: %" PRIu8 ".",
+				 function,
+				 tree_index );
+
+				goto on_error;
+			}
+		}
+		block_data_size = maximum_block_data_size;
+
+		if( libewf_bzip2_read_block_data(
+		     bit_stream,
+		     huffman_trees,
+		     number_of_trees,
+		     selectors,
+		     number_of_selectors,
+		     symbol_stack,
+		     number_of_symbols,
+		     block_data,
+		     &block_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block data.",
+			 function );
+
+			goto on_error;
+		}
+		uncompressed_block_offset = uncompressed_data_offset;
+
+		if( libewf_bzip2_reverse_burrows_wheeler_transform(
+		     block_data,
+		     block_data_size,
+		     permutations,
+		     origin_pointer,
+		     uncompressed_data,
+		     *uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reverse Burrows-Wheeler transform.",
+			 function );
+
+			goto on_error;
+		}
+		if( libewf_bzip2_calculate_crc32(
+		     &calculated_block_checksum,
+		     &( uncompressed_data[ uncompressed_block_offset ] ),
+		     uncompressed_data_offset - uncompressed_block_offset,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate block checksum.",
+			 function );
+
+			goto on_error;
+		}
+		if( stored_block_checksum != calculated_block_checksum )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: block checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+			 function,
+			 stored_block_checksum,
+			 calculated_block_checksum );
+
+			goto on_error;
+		}
+		calculated_stream_checksum = ( calculated_stream_checksum << 1 ) | ( calculated_stream_checksum >> 31 );
+		calculated_stream_checksum ^= calculated_block_checksum;
+	}
+	if( libewf_bit_stream_get_value(
+	     bit_stream,
+	     32,
+	     &stored_stream_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream checksum from bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_stream_checksum != calculated_stream_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: stream checksum does not match (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ").",
+		 function,
+		 stored_stream_checksum,
+		 calculated_stream_checksum );
+
+		goto on_error;
+	}
+	if( libewf_bit_stream_free(
+	     &bit_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	for( tree_index = 0;
+	     tree_index < LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_TREES;
+	     tree_index++ )
+	{
+		if( libewf_huffman_tree_free(
+		     &( huffman_trees[ tree_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free Huffman tree: %" PRIu8 ".",
+			 function,
+			 tree_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 permutations );
+
+	memory_free(
+	 block_data );
+
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( bit_stream != NULL )
+	{
+		libewf_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	for( tree_index = 0;
+	     tree_index < LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_TREES;
+	     tree_index++ )
+	{
+		if( huffman_trees[ tree_index ] != NULL )
+		{
+			libewf_huffman_tree_free(
+			 &( huffman_trees[ tree_index ] ),
+			 NULL );
+		}
+	}
+	if( permutations != NULL )
+	{
+		memory_free(
+		 permutations );
+	}
+	if( block_data != NULL )
+	{
+		memory_free(
+		 block_data );
+	}
+	return( -1 );
+}
+
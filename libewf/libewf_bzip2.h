@@ -0,0 +1,144 @@
+/*
+ * BZip2 (un)compression functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_BZIP2_H )
+#define _LIBEWF_BZIP2_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_bit_stream.h"
+#include "libewf_huffman_tree.h"
+#include "libewf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The block and end of stream signatures
+ */
+#define LIBEWF_BZIP2_BLOCK_SIGNATURE			0x314159265359UL
+#define LIBEWF_BZIP2_END_OF_STREAM_SIGNATURE		0x177245385090UL
+
+/* The maximum number of symbols in a Huffman tree
+ * 256 byte values, RUNA, RUNB and end of block
+ */
+#define LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_SYMBOLS		258
+
+/* The maximum code size of a Huffman code
+ */
+#define LIBEWF_BZIP2_MAXIMUM_CODE_SIZE			20
+
+/* The maximum number of Huffman trees
+ */
+#define LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_TREES		6
+
+/* The maximum number of selectors that are used
+ * Additional selectors can be stored but are ignored
+ */
+#define LIBEWF_BZIP2_MAXIMUM_NUMBER_OF_SELECTORS	18002
+
+/* The number of symbols encoded with the same Huffman tree
+ */
+#define LIBEWF_BZIP2_NUMBER_OF_SYMBOLS_PER_SELECTOR	50
+
+void libewf_bzip2_initialize_crc32_table(
+     void );
+
+int libewf_bzip2_calculate_crc32(
+     uint32_t *crc32,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+int libewf_bzip2_read_stream_header(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint32_t *block_size,
+     libcerror_error_t **error );
+
+int libewf_bzip2_read_signature(
+     libewf_bit_stream_t *bit_stream,
+     uint64_t *signature,
+     libcerror_error_t **error );
+
+int libewf_bzip2_read_block_header(
+     libewf_bit_stream_t *bit_stream,
+     uint32_t *block_checksum,
+     uint32_t *origin_pointer,
+     libcerror_error_t **error );
+
+int libewf_bzip2_read_symbol_stack(
+     libewf_bit_stream_t *bit_stream,
+     uint8_t *symbol_stack,
+     uint16_t *number_of_symbols,
+     libcerror_error_t **error );
+
+int libewf_bzip2_read_selectors(
+     libewf_bit_stream_t *bit_stream,
+     uint8_t *selectors,
+     uint8_t number_of_trees,
+     uint16_t number_of_selectors,
+     libcerror_error_t **error );
+
+int libewf_bzip2_read_huffman_tree(
+     libewf_bit_stream_t *bit_stream,
+     libewf_huffman_tree_t *huffman_tree,
+     uint16_t number_of_symbols,
+     libcerror_error_t **error );
+
+int libewf_bzip2_read_block_data(
+     libewf_bit_stream_t *bit_stream,
+     libewf_huffman_tree_t **huffman_trees,
+     uint8_t number_of_trees,
+     const uint8_t *selectors,
+     uint16_t number_of_selectors,
+     uint8_t *symbol_stack,
+     uint16_t number_of_symbols,
+     uint8_t *block_data,
+     size_t *block_data_size,
+     libcerror_error_t **error );
+
+int libewf_bzip2_reverse_burrows_wheeler_transform(
+     const uint8_t *block_data,
+     size_t block_data_size,
+     uint32_t *permutations,
+     uint32_t origin_pointer,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int libewf_bzip2_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_BZIP2_H ) */
+
@@ -28,6 +28,8 @@
 #include "libewf_chunk_data.h"
 #include "libewf_compression.h"
 #include "libewf_definitions.h"
+#include "libewf_encryption_context.h"
+#include "libewf_file_descriptor_pool.h"
 #include "libewf_libbfio.h"
 #include "libewf_libcerror.h"
 #include "libewf_libcnotify.h"
@@ -898,6 +900,72 @@ on_error:
 	return( -1 );
 }
 
+/* Adds the 16-byte alignment padding as part of packing the chunk data
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_data_pack_add_alignment_padding(
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_data_pack_add_alignment_padding";
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk data - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_data->padding_size = chunk_data->data_size % 16;
+
+	if( chunk_data->padding_size != 0 )
+	{
+		chunk_data->padding_size = 16 - chunk_data->padding_size;
+	}
+	if( ( chunk_data->padding_size > chunk_data->allocated_data_size )
+	 || ( chunk_data->data_size > ( chunk_data->allocated_data_size - chunk_data->padding_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data - allocated data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &( ( chunk_data->data )[ chunk_data->data_size ] ),
+	     0,
+	     chunk_data->padding_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear alignment padding.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Packs the chunk data
  * This function either adds the checksum or compresses the chunk data
  * Returns 1 if successful or -1 on error
@@ -1097,53 +1165,208 @@ int libewf_chunk_data_pack(
 	}
 	if( ( pack_flags & LIBEWF_PACK_FLAG_ADD_ALIGNMENT_PADDING ) != 0 )
 	{
-		chunk_data->padding_size = chunk_data->data_size % 16;
-
-		if( chunk_data->padding_size != 0 )
-		{
-			chunk_data->padding_size = 16 - chunk_data->padding_size;
-		}
-		if( ( chunk_data->padding_size > chunk_data->allocated_data_size )
-		 || ( chunk_data->data_size > ( chunk_data->allocated_data_size - chunk_data->padding_size ) ) )
+		if( libewf_chunk_data_pack_add_alignment_padding(
+		     chunk_data,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid chunk data - allocated data size value too small.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add alignment padding.",
 			 function );
 
 			goto on_error;
 		}
-		if( memory_set(
-		     &( ( chunk_data->data )[ chunk_data->data_size ] ),
-		     0,
-		     chunk_data->padding_size ) == NULL )
+	}
+	chunk_data->range_flags |= LIBEWF_RANGE_FLAG_IS_PACKED;
+
+	return( 1 );
+
+on_error:
+	if( chunk_data->compressed_data != NULL )
+	{
+		memory_free(
+		 chunk_data->compressed_data );
+
+		chunk_data->compressed_data = NULL;
+	}
+	chunk_data->compressed_data_size = 0;
+
+	return( -1 );
+}
+
+/* Decrypts the chunk data
+ * Returns 1 if successful, 0 if the chunk data cannot be decrypted or -1 on error
+ */
+int libewf_chunk_data_decrypt(
+     libewf_chunk_data_t *chunk_data,
+     libewf_encryption_context_t *encryption_context,
+     libcerror_error_t **error )
+{
+	uint8_t *decrypted_data = NULL;
+	static char *function   = "libewf_chunk_data_decrypt";
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk data - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_ENCRYPTED ) == 0 )
+	{
+		return( 1 );
+	}
+	if( encryption_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption context.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data->data_size > chunk_data->allocated_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The encrypted chunk data is padded to a multiple of 16 bytes
+	 */
+	if( ( chunk_data->data_size == 0 )
+	 || ( ( chunk_data->data_size % 16 ) != 0 ) )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported encrypted chunk data size: %" PRIzd ".\n",
+			 function,
+			 chunk_data->data_size );
+		}
+#endif
+		return( 0 );
+	}
+	decrypted_data = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * chunk_data->allocated_data_size );
+
+	if( decrypted_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decrypted data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_encryption_context_decrypt(
+	     encryption_context,
+	     chunk_data->data,
+	     chunk_data->data_size,
+	     decrypted_data,
+	     chunk_data->allocated_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+		 "%s: unable to decrypt chunk data.",
+		 function );
+
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		memory_set(
+		 decrypted_data,
+		 0,
+		 chunk_data->allocated_data_size );
+
+		memory_free(
+		 decrypted_data );
+
+		return( 0 );
+	}
+	/* Managed data is replaced by the decrypted data otherwise the decrypted data is copied
+	 */
+	if( ( chunk_data->flags & LIBEWF_CHUNK_DATA_ITEM_FLAG_MANAGED_DATA ) != 0 )
+	{
+		memory_free(
+		 chunk_data->data );
+
+		chunk_data->data = decrypted_data;
+	}
+	else
+	{
+		if( memory_copy(
+		     chunk_data->data,
+		     decrypted_data,
+		     chunk_data->data_size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear alignment padding.",
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy decrypted data.",
 			 function );
 
 			goto on_error;
 		}
+		memory_free(
+		 decrypted_data );
 	}
-	chunk_data->range_flags |= LIBEWF_RANGE_FLAG_IS_PACKED;
+	chunk_data->range_flags &= ~( LIBEWF_RANGE_FLAG_IS_ENCRYPTED );
 
 	return( 1 );
 
 on_error:
-	if( chunk_data->compressed_data != NULL )
+	if( decrypted_data != NULL )
 	{
-		memory_free(
-		 chunk_data->compressed_data );
+		memory_set(
+		 decrypted_data,
+		 0,
+		 chunk_data->allocated_data_size );
 
-		chunk_data->compressed_data = NULL;
+		memory_free(
+		 decrypted_data );
 	}
-	chunk_data->compressed_data_size = 0;
-
 	return( -1 );
 }
 
@@ -1159,6 +1382,7 @@ int libewf_chunk_data_unpack(
 	static char *function        = "libewf_chunk_data_unpack";
 	size_t remaining_chunk_size  = 0;
 	uint32_t calculated_checksum = 0;
+	int result                   = 1;
 
 	if( chunk_data == NULL )
 	{
@@ -1209,6 +1433,32 @@ int libewf_chunk_data_unpack(
 	{
 		return( 1 );
 	}
+	/* The chunk data is decrypted before it is decompressed or its checksum is validated
+	 * Chunk data that cannot be decrypted is handled as corrupted
+	 */
+	if( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_ENCRYPTED ) != 0 )
+	{
+		result = libewf_chunk_data_decrypt(
+		          chunk_data,
+		          io_handle->encryption_context,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt chunk data.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			chunk_data->range_flags |= LIBEWF_RANGE_FLAG_IS_CORRUPTED;
+		}
+	}
 	if( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_COMPRESSED ) != 0 )
 	{
 		if( chunk_data->compressed_data != NULL )
@@ -1267,7 +1517,12 @@ int libewf_chunk_data_unpack(
 		}
 		chunk_data->data_size = (size_t) chunk_data->chunk_size;
 
-		if( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_USES_PATTERN_FILL ) != 0 )
+		if( result == 0 )
+		{
+			/* The data of chunk data that cannot be decrypted consists of 0-byte values
+			 */
+		}
+		else if( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_USES_PATTERN_FILL ) != 0 )
 		{
 /* TODO move into libewf_chunk_data_unpack_with_64_bit_pattern_fill */
 			if( chunk_data->compressed_data_size < (size_t) 8 )
@@ -1361,6 +1616,41 @@ int libewf_chunk_data_unpack(
 			}
 		}
 	}
+	else if( result == 0 )
+	{
+		/* The encrypted data of chunk data that cannot be decrypted is kept
+		 * and is at least chunk size bytes of size
+		 */
+		if( chunk_data->allocated_data_size < (size_t) chunk_data->chunk_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk data - allocated data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( chunk_data->data_size < (size_t) chunk_data->chunk_size )
+		{
+			if( memory_set(
+			     &( ( chunk_data->data )[ chunk_data->data_size ] ),
+			     0,
+			     (size_t) chunk_data->chunk_size - chunk_data->data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		chunk_data->data_size = (size_t) chunk_data->chunk_size;
+	}
 	else if( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_HAS_CHECKSUM ) != 0 )
 	{
 		if( chunk_data->data_size < 4 )
@@ -1931,6 +2221,97 @@ int libewf_chunk_data_get_checksum(
 	return( result );
 }
 
+/* Checks the checksum of packed chunk data without unpacking it
+ * Only the Adler-32 checksum of uncompressed chunk data can be checked
+ * since the checksum of compressed chunk data is calculated over the uncompressed data
+ * Returns 1 if the checksum matches or cannot be checked, 0 if not or -1 on error
+ */
+int libewf_chunk_data_check_packed_checksum(
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error )
+{
+	static char *function        = "libewf_chunk_data_check_packed_checksum";
+	size_t data_size             = 0;
+	uint32_t calculated_checksum = 0;
+	uint32_t stored_checksum     = 0;
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk data - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_PACKED ) == 0 )
+	 || ( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_COMPRESSED ) != 0 )
+	 || ( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_HAS_CHECKSUM ) == 0 ) )
+	{
+		return( 1 );
+	}
+	data_size = chunk_data->data_size;
+
+	if( ( chunk_data->chunk_io_flags & LIBEWF_CHUNK_IO_FLAG_CHECKSUM_SET ) != 0 )
+	{
+		stored_checksum = chunk_data->checksum;
+	}
+	else
+	{
+		if( ( data_size < 4 )
+		 || ( data_size > chunk_data->allocated_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk data - data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		data_size -= 4;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( ( chunk_data->data )[ data_size ] ),
+		 stored_checksum );
+	}
+	if( libewf_checksum_calculate_adler32(
+	     &calculated_checksum,
+	     chunk_data->data,
+	     data_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
 /* Reads chunk data from the file IO pool
  * Returns the number of bytes read, 0 when no longer data can be read or -1 on error
  */
@@ -1999,6 +2380,74 @@ ssize_t libewf_chunk_data_read_from_file_io_pool(
 	return( read_count );
 }
 
+/* Reads chunk data using a file descriptor pool
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libewf_chunk_data_read_from_file_descriptor_pool(
+         libewf_chunk_data_t *chunk_data,
+         libewf_file_descriptor_pool_t *file_descriptor_pool,
+         int file_descriptor_pool_entry,
+         off64_t chunk_data_offset,
+         size64_t chunk_data_size,
+         uint32_t chunk_data_flags,
+         libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_data_read_from_file_descriptor_pool";
+	ssize_t read_count    = 0;
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_data_size == (size64_t) 0 )
+	 || ( chunk_data_size > (size64_t) chunk_data->allocated_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libewf_file_descriptor_pool_read_buffer_at_offset(
+		      file_descriptor_pool,
+		      file_descriptor_pool_entry,
+		      chunk_data->data,
+		      (size_t) chunk_data_size,
+	              chunk_data_offset,
+		      error );
+
+	if( read_count != (ssize_t) chunk_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk data at offset: %" PRIi64 " (0x%08" PRIx64 ") in file descriptor pool entry: %d.",
+		 function,
+		 chunk_data_offset,
+		 chunk_data_offset,
+		 file_descriptor_pool_entry );
+
+		return( -1 );
+	}
+	chunk_data->data_size = (size_t) read_count;
+
+	chunk_data->range_flags = ( chunk_data_flags | LIBEWF_RANGE_FLAG_IS_PACKED )
+	                        & ~( LIBEWF_RANGE_FLAG_IS_TAINTED | LIBEWF_RANGE_FLAG_IS_CORRUPTED );
+
+	return( read_count );
+}
+
 /* Reads chunk data
  * Callback function for the chunks list
  * Returns 1 if successful or -1 on error
@@ -25,6 +25,8 @@
 #include <common.h>
 #include <types.h>
 
+#include "libewf_encryption_context.h"
+#include "libewf_file_descriptor_pool.h"
 #include "libewf_io_handle.h"
 #include "libewf_libbfio.h"
 #include "libewf_libcerror.h"
@@ -142,6 +144,10 @@ int libewf_chunk_data_pack_with_compression(
      libewf_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libewf_chunk_data_pack_add_alignment_padding(
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error );
+
 int libewf_chunk_data_pack(
      libewf_chunk_data_t *chunk_data,
      libewf_io_handle_t *io_handle,
@@ -150,6 +156,11 @@ int libewf_chunk_data_pack(
      uint8_t pack_flags,
      libcerror_error_t **error );
 
+int libewf_chunk_data_decrypt(
+     libewf_chunk_data_t *chunk_data,
+     libewf_encryption_context_t *encryption_context,
+     libcerror_error_t **error );
+
 int libewf_chunk_data_unpack(
      libewf_chunk_data_t *chunk_data,
      libewf_io_handle_t *io_handle,
@@ -183,6 +194,10 @@ int libewf_chunk_data_get_checksum(
      uint32_t *checksum,
      libcerror_error_t **error );
 
+int libewf_chunk_data_check_packed_checksum(
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error );
+
 ssize_t libewf_chunk_data_read_from_file_io_pool(
          libewf_chunk_data_t *chunk_data,
          libbfio_pool_t *file_io_pool,
@@ -192,6 +207,15 @@ ssize_t libewf_chunk_data_read_from_file_io_pool(
          uint32_t chunk_data_flags,
          libcerror_error_t **error );
 
+ssize_t libewf_chunk_data_read_from_file_descriptor_pool(
+         libewf_chunk_data_t *chunk_data,
+         libewf_file_descriptor_pool_t *file_descriptor_pool,
+         int file_descriptor_pool_entry,
+         off64_t chunk_data_offset,
+         size64_t chunk_data_size,
+         uint32_t chunk_data_flags,
+         libcerror_error_t **error );
+
 int libewf_chunk_data_read_element_data(
      libewf_io_handle_t *io_handle,
      libbfio_pool_t *file_io_pool,
@@ -182,6 +182,11 @@ int libewf_chunk_group_free(
 
 			result = -1;
 		}
+		if( ( *chunk_group )->chunk_fill_states != NULL )
+		{
+			memory_free(
+			 ( *chunk_group )->chunk_fill_states );
+		}
 		memory_free(
 		 *chunk_group );
 
@@ -261,7 +266,9 @@ int libewf_chunk_group_clone(
 
 		return( -1 );
 	}
-	( *destination_chunk_group )->chunks_list = NULL;
+	( *destination_chunk_group )->chunks_list                 = NULL;
+	( *destination_chunk_group )->chunk_fill_states           = NULL;
+	( *destination_chunk_group )->number_of_chunk_fill_states = 0;
 
 /* TODO clone chunks_list */
 
@@ -311,6 +318,15 @@ int libewf_chunk_group_empty(
 
 		return( -1 );
 	}
+	if( chunk_group->chunk_fill_states != NULL )
+	{
+		memory_free(
+		 chunk_group->chunk_fill_states );
+
+		chunk_group->chunk_fill_states = NULL;
+	}
+	chunk_group->number_of_chunk_fill_states = 0;
+
 	return( 1 );
 }
 
@@ -966,12 +982,27 @@ int libewf_chunk_group_fill_v2(
 			if( ( chunk_data_flags & LIBEWF_CHUNK_DATA_FLAG_USES_PATTERN_FILL ) != 0 )
 			{
 				range_flags |= LIBEWF_RANGE_FLAG_USES_PATTERN_FILL;
+
+				/* For a pattern fill the chunk data offset contains the 64-bit pattern
+				 */
+				if( chunk_data_offset == 0 )
+				{
+					range_flags |= LIBEWF_RANGE_FLAG_IS_EMPTY;
+				}
 			}
 		}
 		if( ( chunk_data_flags & LIBEWF_CHUNK_DATA_FLAG_HAS_CHECKSUM ) != 0 )
 		{
 			range_flags |= LIBEWF_RANGE_FLAG_HAS_CHECKSUM;
 		}
+		/* If the sector table is encrypted the sector data is encrypted as well
+		 * except for a pattern fill which is stored in the sector table
+		 */
+		if( ( ( table_section->data_flags & LIBEWF_SECTION_DATA_FLAGS_IS_ENCRYPTED ) != 0 )
+		 && ( ( range_flags & LIBEWF_RANGE_FLAG_USES_PATTERN_FILL ) == 0 ) )
+		{
+			range_flags |= LIBEWF_RANGE_FLAG_IS_ENCRYPTED;
+		}
 /* TODO handle corruption e.g. check for zero data
 		if( ( ( chunk_data_flags & 0x00000007UL ) != 1 )
 		 || ( ( chunk_data_flags & 0x00000007UL ) != 2 )
@@ -1676,3 +1707,274 @@ int libewf_chunk_group_correct_v1(
 	return( 1 );
 }
 
+/* Determines if a chunk contains only 0-byte values
+ * The fill state is determined from the table entry metadata where possible,
+ * for small compressed chunks the chunk data is decompressed. The result is
+ * cached in the chunk group
+ * Returns 1 if the chunk is empty, 0 if not or -1 on error
+ */
+int libewf_chunk_group_chunk_is_empty(
+     libewf_chunk_group_t *chunk_group,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     int chunks_list_index,
+     libcerror_error_t **error )
+{
+	libewf_chunk_data_t *chunk_data = NULL;
+	static char *function           = "libewf_chunk_group_chunk_is_empty";
+	size64_t chunk_data_size        = 0;
+	size64_t maximum_empty_size     = 0;
+	off64_t chunk_data_offset       = 0;
+	uint32_t range_flags            = 0;
+	uint8_t fill_state              = LIBEWF_CHUNK_FILL_STATE_DATA;
+	int file_io_pool_entry          = 0;
+	int number_of_elements          = 0;
+	int result                      = 0;
+
+	if( chunk_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk group.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_group->chunk_fill_states == NULL )
+	{
+		if( libfdata_list_get_number_of_elements(
+		     chunk_group->chunks_list,
+		     &number_of_elements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of elements from chunks list.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( number_of_elements <= 0 )
+		 || ( (size_t) number_of_elements > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of elements value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		chunk_group->chunk_fill_states = (uint8_t *) memory_allocate(
+		                                              sizeof( uint8_t ) * number_of_elements );
+
+		if( chunk_group->chunk_fill_states == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk fill states.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     chunk_group->chunk_fill_states,
+		     LIBEWF_CHUNK_FILL_STATE_UNKNOWN,
+		     sizeof( uint8_t ) * number_of_elements ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear chunk fill states.",
+			 function );
+
+			goto on_error;
+		}
+		chunk_group->number_of_chunk_fill_states = number_of_elements;
+	}
+	if( ( chunks_list_index < 0 )
+	 || ( chunks_list_index >= chunk_group->number_of_chunk_fill_states ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunks list index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_group->chunk_fill_states[ chunks_list_index ] != LIBEWF_CHUNK_FILL_STATE_UNKNOWN )
+	{
+		return( (int) ( chunk_group->chunk_fill_states[ chunks_list_index ] == LIBEWF_CHUNK_FILL_STATE_EMPTY ) );
+	}
+	if( libfdata_list_get_element_by_index(
+	     chunk_group->chunks_list,
+	     chunks_list_index,
+	     &file_io_pool_entry,
+	     &chunk_data_offset,
+	     &chunk_data_size,
+	     &range_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve element: %d from chunks list.",
+		 function,
+		 chunks_list_index );
+
+		return( -1 );
+	}
+	/* A chunk of 0-byte values compresses to roughly 1/1000th of the chunk size
+	 */
+	maximum_empty_size = ( (size64_t) io_handle->chunk_size / 1024 ) + 64;
+
+	if( ( range_flags & LIBEWF_RANGE_FLAG_IS_EMPTY ) != 0 )
+	{
+		fill_state = LIBEWF_CHUNK_FILL_STATE_EMPTY;
+	}
+	else if( ( ( range_flags & ( LIBEWF_RANGE_FLAG_IS_SPARSE | LIBEWF_RANGE_FLAG_IS_COMPRESSED | LIBEWF_RANGE_FLAG_USES_PATTERN_FILL ) ) == LIBEWF_RANGE_FLAG_IS_COMPRESSED )
+	      && ( chunk_data_size <= maximum_empty_size ) )
+	{
+		if( libewf_chunk_data_initialize(
+		     &chunk_data,
+		     io_handle->chunk_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libewf_chunk_data_read_from_file_io_pool(
+		     chunk_data,
+		     file_io_pool,
+		     file_io_pool_entry,
+		     chunk_data_offset,
+		     chunk_data_size,
+		     range_flags,
+		     error ) < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libewf_chunk_data_unpack(
+		     chunk_data,
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to unpack chunk data.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) == 0 )
+		 && ( chunk_data->data_size > 0 )
+		 && ( chunk_data->data[ 0 ] == 0 ) )
+		{
+			result = libewf_chunk_data_check_for_empty_block(
+			          chunk_data->data,
+			          chunk_data->data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to determine if chunk data is an empty block.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				fill_state = LIBEWF_CHUNK_FILL_STATE_EMPTY;
+			}
+		}
+		if( libewf_chunk_data_free(
+		     &chunk_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	chunk_group->chunk_fill_states[ chunks_list_index ] = fill_state;
+
+	return( (int) ( fill_state == LIBEWF_CHUNK_FILL_STATE_EMPTY ) );
+
+on_error:
+	if( chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &chunk_data,
+		 NULL );
+	}
+	if( chunk_group->number_of_chunk_fill_states == 0 )
+	{
+		if( chunk_group->chunk_fill_states != NULL )
+		{
+			memory_free(
+			 chunk_group->chunk_fill_states );
+
+			chunk_group->chunk_fill_states = NULL;
+		}
+	}
+	return( -1 );
+}
+
@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libewf_io_handle.h"
+#include "libewf_libbfio.h"
 #include "libewf_libcerror.h"
 #include "libewf_libfdata.h"
 #include "libewf_section_descriptor.h"
@@ -49,6 +50,14 @@ struct libewf_chunk_group
 	/* The range end offset
 	 */
 	off64_t range_end_offset;
+
+	/* The chunk fill states, a value per chunk that is determined on demand
+	 */
+	uint8_t *chunk_fill_states;
+
+	/* The number of chunk fill states
+	 */
+	int number_of_chunk_fill_states;
 };
 
 int libewf_chunk_group_initialize(
@@ -107,6 +116,13 @@ int libewf_chunk_group_correct_v1(
      uint8_t tainted,
      libcerror_error_t **error );
 
+int libewf_chunk_group_chunk_is_empty(
+     libewf_chunk_group_t *chunk_group,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     int chunks_list_index,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
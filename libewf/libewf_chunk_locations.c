@@ -0,0 +1,571 @@
+/*
+ * Chunk locations functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_chunk_locations.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+#include "libewf_libfcache.h"
+#include "libewf_libfdata.h"
+
+/* Creates chunk locations
+ * Make sure the value chunk_locations is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_locations_initialize(
+     libewf_chunk_locations_t **chunk_locations,
+     uint64_t number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function     = "libewf_chunk_locations_initialize";
+	uint64_t number_of_blocks = 0;
+
+	if( chunk_locations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk locations.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_locations != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk locations value already set.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = number_of_chunks / LIBEWF_CHUNK_LOCATIONS_BLOCK_SIZE;
+
+	if( ( number_of_chunks % LIBEWF_CHUNK_LOCATIONS_BLOCK_SIZE ) != 0 )
+	{
+		number_of_blocks += 1;
+	}
+	if( ( number_of_blocks == 0 )
+	 || ( number_of_blocks > (uint64_t) INT_MAX )
+	 || ( number_of_blocks > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libewf_chunk_location_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_locations = memory_allocate_structure(
+	                    libewf_chunk_locations_t );
+
+	if( *chunk_locations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk locations.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_locations,
+	     0,
+	     sizeof( libewf_chunk_locations_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk locations.",
+		 function );
+
+		memory_free(
+		 *chunk_locations );
+
+		*chunk_locations = NULL;
+
+		return( -1 );
+	}
+	( *chunk_locations )->blocks = (libewf_chunk_location_t **) memory_allocate(
+	                                                             sizeof( libewf_chunk_location_t * ) * (size_t) number_of_blocks );
+
+	if( ( *chunk_locations )->blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create blocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *chunk_locations )->blocks,
+	     0,
+	     sizeof( libewf_chunk_location_t * ) * (size_t) number_of_blocks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear blocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_date_time_get_timestamp(
+	     &( ( *chunk_locations )->timestamp ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve timestamp.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *chunk_locations )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *chunk_locations )->number_of_chunks = number_of_chunks;
+	( *chunk_locations )->number_of_blocks = (int) number_of_blocks;
+
+	return( 1 );
+
+on_error:
+	if( *chunk_locations != NULL )
+	{
+		if( ( *chunk_locations )->blocks != NULL )
+		{
+			memory_free(
+			 ( *chunk_locations )->blocks );
+		}
+		memory_free(
+		 *chunk_locations );
+
+		*chunk_locations = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees chunk locations
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_locations_free(
+     libewf_chunk_locations_t **chunk_locations,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_chunk_locations_free";
+	int block_index       = 0;
+	int result            = 1;
+
+	if( chunk_locations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk locations.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_locations != NULL )
+	{
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *chunk_locations )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		for( block_index = 0;
+		     block_index < ( *chunk_locations )->number_of_blocks;
+		     block_index++ )
+		{
+			if( ( *chunk_locations )->blocks[ block_index ] != NULL )
+			{
+				memory_free(
+				 ( *chunk_locations )->blocks[ block_index ] );
+			}
+		}
+		memory_free(
+		 ( *chunk_locations )->blocks );
+
+		memory_free(
+		 *chunk_locations );
+
+		*chunk_locations = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the location of a specific chunk
+ * Returns 1 if successful, 0 if the location is not set or -1 on error
+ */
+int libewf_chunk_locations_get_location(
+     libewf_chunk_locations_t *chunk_locations,
+     uint64_t chunk_index,
+     int *file_io_pool_entry,
+     off64_t *data_offset,
+     size64_t *data_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error )
+{
+	libewf_chunk_location_t *block    = NULL;
+	libewf_chunk_location_t *location = NULL;
+	static char *function             = "libewf_chunk_locations_get_location";
+	int result                        = 0;
+
+	if( chunk_locations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk locations.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index >= chunk_locations->number_of_chunks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     chunk_locations->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	block = chunk_locations->blocks[ chunk_index / LIBEWF_CHUNK_LOCATIONS_BLOCK_SIZE ];
+
+	if( block != NULL )
+	{
+		location = &( block[ chunk_index % LIBEWF_CHUNK_LOCATIONS_BLOCK_SIZE ] );
+
+		if( location->data_size != 0 )
+		{
+			*file_io_pool_entry = location->file_io_pool_entry;
+			*data_offset        = location->data_offset;
+			*data_size          = (size64_t) location->data_size;
+			*range_flags        = location->range_flags;
+
+			result = 1;
+		}
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     chunk_locations->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the locations of the chunks in a chunks list
+ * The chunks list contains the chunks starting at first_chunk_index
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_locations_set_locations_from_chunks_list(
+     libewf_chunk_locations_t *chunk_locations,
+     uint64_t first_chunk_index,
+     libfdata_list_t *chunks_list,
+     libcerror_error_t **error )
+{
+	libewf_chunk_location_t *location = NULL;
+	static char *function             = "libewf_chunk_locations_set_locations_from_chunks_list";
+	size64_t chunk_data_size          = 0;
+	uint64_t block_index              = 0;
+	uint64_t chunk_index              = 0;
+	off64_t chunk_data_offset         = 0;
+	uint32_t range_flags              = 0;
+	int chunks_list_index             = 0;
+	int file_io_pool_entry            = 0;
+	int number_of_chunks              = 0;
+
+	if( chunk_locations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk locations.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_chunk_index >= chunk_locations->number_of_chunks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     chunks_list,
+	     &number_of_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from chunks list.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     chunk_locations->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( chunks_list_index = 0;
+	     chunks_list_index < number_of_chunks;
+	     chunks_list_index++ )
+	{
+		chunk_index = first_chunk_index + chunks_list_index;
+
+		if( chunk_index >= chunk_locations->number_of_chunks )
+		{
+			break;
+		}
+		block_index = chunk_index / LIBEWF_CHUNK_LOCATIONS_BLOCK_SIZE;
+
+		if( chunk_locations->blocks[ block_index ] == NULL )
+		{
+			chunk_locations->blocks[ block_index ] = (libewf_chunk_location_t *) memory_allocate(
+			                                                                      sizeof( libewf_chunk_location_t ) * LIBEWF_CHUNK_LOCATIONS_BLOCK_SIZE );
+
+			if( chunk_locations->blocks[ block_index ] == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create block: %" PRIu64 ".",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+			if( memory_set(
+			     chunk_locations->blocks[ block_index ],
+			     0,
+			     sizeof( libewf_chunk_location_t ) * LIBEWF_CHUNK_LOCATIONS_BLOCK_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear block: %" PRIu64 ".",
+				 function,
+				 block_index );
+
+				memory_free(
+				 chunk_locations->blocks[ block_index ] );
+
+				chunk_locations->blocks[ block_index ] = NULL;
+
+				goto on_error;
+			}
+		}
+		location = &( ( chunk_locations->blocks[ block_index ] )[ chunk_index % LIBEWF_CHUNK_LOCATIONS_BLOCK_SIZE ] );
+
+		if( location->data_size != 0 )
+		{
+			continue;
+		}
+		if( libfdata_list_get_element_by_index(
+		     chunks_list,
+		     chunks_list_index,
+		     &file_io_pool_entry,
+		     &chunk_data_offset,
+		     &chunk_data_size,
+		     &range_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %" PRIu64 " from chunks list.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		/* Chunks that cannot be represented are left unset and are resolved by the chunks list
+		 */
+		if( ( chunk_data_size == 0 )
+		 || ( chunk_data_size > (size64_t) UINT32_MAX ) )
+		{
+			continue;
+		}
+		location->data_offset        = chunk_data_offset;
+		location->data_size          = (uint32_t) chunk_data_size;
+		location->file_io_pool_entry = file_io_pool_entry;
+		location->range_flags        = range_flags;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     chunk_locations->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 chunk_locations->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,122 @@
+/*
+ * Chunk locations functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_CHUNK_LOCATIONS_H )
+#define _LIBEWF_CHUNK_LOCATIONS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+#include "libewf_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of chunk locations per block
+ */
+#define LIBEWF_CHUNK_LOCATIONS_BLOCK_SIZE	4096
+
+typedef struct libewf_chunk_location libewf_chunk_location_t;
+
+struct libewf_chunk_location
+{
+	/* The data offset
+	 */
+	off64_t data_offset;
+
+	/* The data size
+	 * A data size of 0 indicates the location was not set
+	 */
+	uint32_t data_size;
+
+	/* The file IO pool entry
+	 */
+	int file_io_pool_entry;
+
+	/* The range flags
+	 */
+	uint32_t range_flags;
+};
+
+typedef struct libewf_chunk_locations libewf_chunk_locations_t;
+
+struct libewf_chunk_locations
+{
+	/* The number of chunks
+	 */
+	uint64_t number_of_chunks;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* The blocks
+	 * Every block contains LIBEWF_CHUNK_LOCATIONS_BLOCK_SIZE chunk locations
+	 * and is allocated on demand
+	 */
+	libewf_chunk_location_t **blocks;
+
+	/* The timestamp
+	 * Used to identify chunk data cached by chunk location
+	 */
+	int64_t timestamp;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 * The chunk locations can be shared by multiple handles
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libewf_chunk_locations_initialize(
+     libewf_chunk_locations_t **chunk_locations,
+     uint64_t number_of_chunks,
+     libcerror_error_t **error );
+
+int libewf_chunk_locations_free(
+     libewf_chunk_locations_t **chunk_locations,
+     libcerror_error_t **error );
+
+int libewf_chunk_locations_get_location(
+     libewf_chunk_locations_t *chunk_locations,
+     uint64_t chunk_index,
+     int *file_io_pool_entry,
+     off64_t *data_offset,
+     size64_t *data_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error );
+
+int libewf_chunk_locations_set_locations_from_chunks_list(
+     libewf_chunk_locations_t *chunk_locations,
+     uint64_t first_chunk_index,
+     libfdata_list_t *chunks_list,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_CHUNK_LOCATIONS_H ) */
+
@@ -26,6 +26,7 @@
 
 #include "libewf_chunk_data.h"
 #include "libewf_chunk_group.h"
+#include "libewf_chunk_locations.h"
 #include "libewf_chunk_table.h"
 #include "libewf_definitions.h"
 #include "libewf_io_handle.h"
@@ -238,6 +239,23 @@ int libewf_chunk_table_free(
 
 			result = -1;
 		}
+		if( ( ( *chunk_table )->chunk_locations != NULL )
+		 && ( ( *chunk_table )->chunk_locations_is_shared == 0 ) )
+		{
+			if( libewf_chunk_locations_free(
+			     &( ( *chunk_table )->chunk_locations ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk locations.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *chunk_table );
 
@@ -317,11 +335,17 @@ int libewf_chunk_table_clone(
 
 		return( -1 );
 	}
-	( *destination_chunk_table )->current_chunk_group     = NULL;
-	( *destination_chunk_table )->current_chunk_data      = NULL;
-	( *destination_chunk_table )->checksum_errors         = NULL;
-	( *destination_chunk_table )->chunk_data_cache        = NULL;
-	( *destination_chunk_table )->single_chunk_data_cache = NULL;
+	( *destination_chunk_table )->current_chunk_group       = NULL;
+	( *destination_chunk_table )->current_chunk_data        = NULL;
+	( *destination_chunk_table )->checksum_errors           = NULL;
+	( *destination_chunk_table )->chunk_data_cache          = NULL;
+	( *destination_chunk_table )->single_chunk_data_cache   = NULL;
+	( *destination_chunk_table )->chunk_locations           = NULL;
+	( *destination_chunk_table )->chunk_locations_is_shared = 0;
+	( *destination_chunk_table )->file_descriptor_pool      = NULL;
+	( *destination_chunk_table )->persistent_cache          = NULL;
+	( *destination_chunk_table )->compressed_chunk_cache    = NULL;
+	( *destination_chunk_table )->shared_chunk_cache        = NULL;
 
 	if( libcdata_range_list_clone(
 	     &( ( *destination_chunk_table )->checksum_errors ),
@@ -698,31 +722,43 @@ int libewf_chunk_table_get_segment_file_chunk_group_by_offset(
 	return( result );
 }
 
-/* Retrieves the chunk data of a chunk at a specific offset
- * Returns 1 if successful or -1 on error
+/* Retrieves the chunk data of a specific chunk using the chunk locations
+ * This bypasses the segment file and chunk group lookups once the location
+ * of the chunk was determined by a previous lookup
+ * If the chunk table has a file descriptor pool the chunk data is read using
+ * positional reads instead of the file IO pool
+ * If the chunk table has a compressed chunk cache the compressed chunk data is retrieved
+ * from or added to the compressed chunk cache
+ * If the chunk table has a shared chunk cache the unpacked chunk data is retrieved
+ * from or added to the shared chunk cache by its compressed data
+ * If the chunk table has a persistent cache the unpacked chunk data is retrieved
+ * from or added to the persistent cache
+ * Returns 1 if successful, 0 if the location of the chunk is not known or -1 on error
  */
-int libewf_chunk_table_get_segment_file_chunk_data_by_offset(
+int libewf_chunk_table_get_chunk_data_by_location(
      libewf_chunk_table_t *chunk_table,
      libewf_io_handle_t *io_handle,
      libbfio_pool_t *file_io_pool,
      libfcache_cache_t *chunk_data_cache,
      libewf_media_values_t *media_values,
-     libewf_segment_table_t *segment_table,
-     off64_t offset,
-     off64_t *chunk_data_offset,
-     libewf_chunk_data_t **chunk_data,
+     uint64_t chunk_index,
      uint8_t read_flags,
      libcerror_error_t **error )
 {
-	libewf_chunk_group_t *chunk_group = NULL;
-	static char *function             = "libewf_chunk_table_get_segment_file_chunk_data_by_offset";
-	off64_t chunk_group_data_offset   = 0;
-	off64_t safe_chunk_data_offset    = 0;
-	uint64_t chunk_index              = 0;
-	uint32_t segment_number           = 0;
-	int chunk_groups_list_index       = 0;
-	int chunks_list_index             = 0;
-	int result                        = 0;
+	libewf_chunk_data_t *chunk_data      = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libewf_chunk_table_get_chunk_data_by_location";
+	size64_t chunk_data_size             = 0;
+	ssize_t read_count                   = 0;
+	off64_t cache_value_offset           = 0;
+	off64_t chunk_data_offset            = 0;
+	int64_t cache_value_timestamp        = 0;
+	uint32_t range_flags                 = 0;
+	int cache_entry_index                = 0;
+	int cache_value_file_index           = -1;
+	int file_io_pool_entry               = 0;
+	int number_of_cache_entries          = 0;
+	int result                           = 0;
 
 	if( chunk_table == NULL )
 	{
@@ -768,178 +804,768 @@ int libewf_chunk_table_get_segment_file_chunk_data_by_offset(
 
 		return( -1 );
 	}
-	if( chunk_data_offset == NULL )
+	/* The chunk locations are only used in read-only mode since writing
+	 * can change the location of a chunk
+	 */
+	if( ( chunk_table->chunk_locations == NULL )
+	 || ( ( io_handle->access_flags & LIBEWF_ACCESS_FLAG_WRITE ) != 0 )
+	 || ( chunk_index >= chunk_table->chunk_locations->number_of_chunks ) )
+	{
+		return( 0 );
+	}
+	result = libewf_chunk_locations_get_location(
+	          chunk_table->chunk_locations,
+	          chunk_index,
+	          &file_io_pool_entry,
+	          &chunk_data_offset,
+	          &chunk_data_size,
+	          &range_flags,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid chunk data offset.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve location of chunk: %" PRIu64 ".",
+		 function,
+		 chunk_index );
 
 		return( -1 );
 	}
-	if( chunk_data == NULL )
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( ( range_flags & LIBEWF_RANGE_FLAG_IS_SPARSE ) != 0 )
+	{
+		return( 0 );
+	}
+	if( libfcache_cache_get_number_of_entries(
+	     chunk_data_cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid chunk data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( chunk_table->current_chunk_data != NULL )
-	 && ( chunk_table->current_chunk_data->range_end_offset > 0 ) )
+	if( number_of_cache_entries <= 0 )
 	{
-		if( ( offset >= chunk_table->current_chunk_data->range_start_offset )
-		 && ( offset < chunk_table->current_chunk_data->range_end_offset ) )
-		{
-			safe_chunk_data_offset = offset - chunk_table->current_chunk_data->range_start_offset;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of cache entries value out of bounds.",
+		 function );
 
-			result = 1;
-		}
+		return( -1 );
 	}
-	if( result == 0 )
-	{
-		result = libewf_chunk_table_get_segment_file_chunk_group_by_offset(
-			  chunk_table,
-			  file_io_pool,
-			  segment_table,
-			  offset,
-			  &segment_number,
-			  &chunk_groups_list_index,
-			  &chunk_group_data_offset,
-			  &chunk_group,
-			  error );
+	cache_entry_index = (int) ( chunk_index % number_of_cache_entries );
 
-		if( result == -1 )
+	if( ( read_flags & LIBFDATA_READ_FLAG_IGNORE_CACHE ) == 0 )
+	{
+		if( libfcache_cache_get_value_by_index(
+		     chunk_data_cache,
+		     cache_entry_index,
+		     &cache_value,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve segment file chunk group for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 "%s: unable to retrieve cache entry: %d from chunk data cache.",
 			 function,
-			 offset,
-			 offset );
+			 cache_entry_index );
 
 			return( -1 );
 		}
-		if( result != 0 )
+		if( cache_value != NULL )
 		{
-			if( chunk_group == NULL )
+			if( libfcache_cache_value_get_identifier(
+			     cache_value,
+			     &cache_value_file_index,
+			     &cache_value_offset,
+			     &cache_value_timestamp,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing chunk group: %d.",
-				 function,
-				 chunk_groups_list_index );
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cache value identifier.",
+				 function );
 
 				return( -1 );
 			}
-			chunk_index            = (uint64_t) offset / media_values->chunk_size;
-			chunks_list_index      = (int) ( chunk_group_data_offset / media_values->chunk_size );
-			safe_chunk_data_offset = chunk_group_data_offset - ( (off64_t) chunks_list_index * media_values->chunk_size );
-
-			if( libfdata_list_get_element_value_by_index(
-			     chunk_group->chunks_list,
-			     (intptr_t *) file_io_pool,
-			     (libfdata_cache_t *) chunk_data_cache,
-			     chunks_list_index,
-			     (intptr_t **) &( chunk_table->current_chunk_data ),
-			     read_flags,
+		}
+		if( ( cache_value_file_index == file_io_pool_entry )
+		 && ( cache_value_offset == chunk_data_offset )
+		 && ( cache_value_timestamp == chunk_table->chunk_locations->timestamp ) )
+		{
+			if( libfcache_cache_value_get_value(
+			     cache_value,
+			     (intptr_t **) &chunk_data,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve chunk: %" PRIu64 " data from chunk group: %d in segment file: %" PRIu32 " for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 "%s: unable to retrieve chunk: %" PRIu64 " data from cache value.",
 				 function,
-				 chunk_index,
-				 chunk_groups_list_index,
-				 segment_number,
-				 offset,
-				 offset );
+				 chunk_index );
 
 				return( -1 );
 			}
-			if( chunk_table->current_chunk_data == NULL )
+		}
+	}
+	if( chunk_data == NULL )
+	{
+		if( libewf_chunk_data_initialize(
+		     &chunk_data,
+		     io_handle->chunk_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk data.",
+			 function );
+
+			goto on_error;
+		}
+		result = 0;
+
+		if( ( chunk_table->compressed_chunk_cache != NULL )
+		 && ( ( range_flags & LIBEWF_RANGE_FLAG_IS_COMPRESSED ) != 0 ) )
+		{
+			result = libewf_compressed_chunk_cache_get_chunk_data(
+			          chunk_table->compressed_chunk_cache,
+			          chunk_index,
+			          chunk_data->data,
+			          chunk_data->allocated_data_size,
+			          &( chunk_data->data_size ),
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing chunk data: %" PRIu64 ".",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu64 " data from compressed chunk cache.",
 				 function,
 				 chunk_index );
 
-				return( -1 );
+				goto on_error;
 			}
-			chunk_table->current_chunk_data->chunk_index = chunk_index;
+			else if( result != 0 )
+			{
+				/* The compressed chunk cache contains the chunk data as stored
+				 * in the segment file, which still needs to be unpacked
+				 */
+				chunk_data->range_flags = ( range_flags | LIBEWF_RANGE_FLAG_IS_PACKED )
+				                        & ~( LIBEWF_RANGE_FLAG_IS_TAINTED | LIBEWF_RANGE_FLAG_IS_CORRUPTED );
+			}
+		}
+		if( ( result == 0 )
+		 && ( chunk_table->persistent_cache != NULL ) )
+		{
+			result = libewf_persistent_cache_get_chunk_data(
+			          chunk_table->persistent_cache,
+			          chunk_index,
+			          chunk_data->data,
+			          chunk_data->allocated_data_size,
+			          &( chunk_data->data_size ),
+			          error );
 
-			if( libfdata_list_get_element_mapped_range(
-			     chunk_group->chunks_list,
-			     chunks_list_index,
-			     &( chunk_table->current_chunk_data->range_start_offset ),
-			     (size64_t *) &( chunk_table->current_chunk_data->range_end_offset ),
-			     error ) != 1 )
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve list element: %d mapped range for chunk group: %d in segment file: %" PRIu32 ".",
+				 "%s: unable to retrieve chunk: %" PRIu64 " data from persistent cache.",
 				 function,
-				 chunks_list_index,
-				 chunk_groups_list_index,
-				 segment_number );
+				 chunk_index );
 
-				return( -1 );
+				goto on_error;
 			}
-			chunk_table->current_chunk_data->range_start_offset += chunk_table->current_chunk_group->range_start_offset;
-			chunk_table->current_chunk_data->range_end_offset   += chunk_table->current_chunk_data->range_start_offset;
+			else if( result != 0 )
+			{
+				/* The persistent cache contains the unpacked chunk data
+				 */
+				chunk_data->range_flags = range_flags
+				                        & ~( LIBEWF_RANGE_FLAG_IS_PACKED | LIBEWF_RANGE_FLAG_IS_TAINTED | LIBEWF_RANGE_FLAG_IS_CORRUPTED );
+			}
+		}
+		if( result != 0 )
+		{
+			read_count = (ssize_t) chunk_data->data_size;
+		}
+		else if( chunk_table->file_descriptor_pool != NULL )
+		{
+			read_count = libewf_chunk_data_read_from_file_descriptor_pool(
+			              chunk_data,
+			              chunk_table->file_descriptor_pool,
+			              file_io_pool_entry,
+			              chunk_data_offset,
+			              chunk_data_size,
+			              range_flags,
+			              error );
+		}
+		else
+		{
+			read_count = libewf_chunk_data_read_from_file_io_pool(
+			              chunk_data,
+			              file_io_pool,
+			              file_io_pool_entry,
+			              chunk_data_offset,
+			              chunk_data_size,
+			              range_flags,
+			              error );
+		}
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %" PRIu64 " data.",
+			 function,
+			 chunk_index );
 
-			if( (size64_t) chunk_table->current_chunk_data->range_end_offset > media_values->media_size )
+			goto on_error;
+		}
+		if( ( result == 0 )
+		 && ( chunk_table->compressed_chunk_cache != NULL )
+		 && ( chunk_table->access_advice != LIBEWF_ACCESS_ADVICE_SEQUENTIAL )
+		 && ( ( range_flags & LIBEWF_RANGE_FLAG_IS_COMPRESSED ) != 0 ) )
+		{
+			/* The compressed chunk data is added before it is unpacked so that
+			 * a chunk that is no longer in the chunk data cache can be unpacked
+			 * again without reading it from the segment file
+			 * Chunk data of a sequential read is not expected to be read again
+			 * and is not added to the compressed chunk cache
+			 */
+			if( libewf_compressed_chunk_cache_set_chunk_data(
+			     chunk_table->compressed_chunk_cache,
+			     chunk_index,
+			     chunk_data->data,
+			     chunk_data->data_size,
+			     error ) == -1 )
 			{
-				chunk_table->current_chunk_data->range_end_offset = (off64_t) media_values->media_size;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set chunk: %" PRIu64 " data in compressed chunk cache.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		if( ( chunk_table->shared_chunk_cache != NULL )
+		 && ( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_PACKED ) != 0 )
+		 && ( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_COMPRESSED ) != 0 )
+		 && ( ( chunk_data->range_flags & ( LIBEWF_RANGE_FLAG_IS_ENCRYPTED | LIBEWF_RANGE_FLAG_USES_PATTERN_FILL ) ) == 0 ) )
+		{
+			/* The unpacked data is copied over the compressed data
+			 * after the compressed data was matched
+			 */
+			result = libewf_shared_chunk_cache_get_chunk_data(
+			          chunk_table->shared_chunk_cache,
+			          io_handle->compression_method,
+			          chunk_data->data,
+			          chunk_data->data_size,
+			          chunk_data->data,
+			          chunk_data->allocated_data_size,
+			          &( chunk_data->data_size ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu64 " data from shared chunk cache.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				chunk_data->range_flags &= ~( LIBEWF_RANGE_FLAG_IS_PACKED );
+			}
+			else if( chunk_table->access_advice != LIBEWF_ACCESS_ADVICE_SEQUENTIAL )
+			{
+				/* Only chunk data that passed the decompression validation
+				 * is added to the shared chunk cache
+				 */
+				if( libewf_chunk_data_unpack(
+				     chunk_data,
+				     io_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to unpack chunk: %" PRIu64 " data.",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+				if( ( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) == 0 )
+				 && ( chunk_data->compressed_data != NULL )
+				 && ( chunk_data->data_size > 0 ) )
+				{
+					if( libewf_shared_chunk_cache_set_chunk_data(
+					     chunk_table->shared_chunk_cache,
+					     io_handle->compression_method,
+					     chunk_data->compressed_data,
+					     chunk_data->compressed_data_size,
+					     chunk_data->data,
+					     chunk_data->data_size,
+					     error ) == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to set chunk: %" PRIu64 " data in shared chunk cache.",
+						 function,
+						 chunk_index );
+
+						goto on_error;
+					}
+				}
+			}
+		}
+		if( ( result == 0 )
+		 && ( chunk_table->persistent_cache != NULL )
+		 && ( chunk_table->access_advice != LIBEWF_ACCESS_ADVICE_SEQUENTIAL )
+		 && ( ( range_flags & LIBEWF_RANGE_FLAG_USES_PATTERN_FILL ) == 0 ) )
+		{
+			/* Only chunk data that passed the checksum or decompression
+			 * validation is added to the persistent cache
+			 * Chunk data of a sequential read is not expected to be read again
+			 * and is not added to the persistent cache
+			 */
+			if( libewf_chunk_data_unpack(
+			     chunk_data,
+			     io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to unpack chunk: %" PRIu64 " data.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
 			}
+			if( ( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) == 0 )
+			 && ( chunk_data->data_size > 0 ) )
+			{
+				if( libewf_persistent_cache_set_chunk_data(
+				     chunk_table->persistent_cache,
+				     chunk_index,
+				     chunk_data->data,
+				     chunk_data->data_size,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set chunk: %" PRIu64 " data in persistent cache.",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+			}
+		}
+		if( libfcache_cache_set_value_by_index(
+		     chunk_data_cache,
+		     cache_entry_index,
+		     file_io_pool_entry,
+		     chunk_data_offset,
+		     chunk_table->chunk_locations->timestamp,
+		     (intptr_t *) chunk_data,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_chunk_data_free,
+		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set chunk: %" PRIu64 " data in cache entry: %d.",
+			 function,
+			 chunk_index,
+			 cache_entry_index );
+
+			goto on_error;
 		}
 	}
-	if( result != 0 )
+	chunk_data->chunk_index        = chunk_index;
+	chunk_data->range_start_offset = (off64_t) ( chunk_index * media_values->chunk_size );
+	chunk_data->range_end_offset   = chunk_data->range_start_offset + media_values->chunk_size;
+
+	if( (size64_t) chunk_data->range_end_offset > media_values->media_size )
 	{
-		*chunk_data_offset = safe_chunk_data_offset;
-		*chunk_data        = chunk_table->current_chunk_data;
+		chunk_data->range_end_offset = (off64_t) media_values->media_size;
 	}
-	return( result );
+	chunk_table->current_chunk_data = chunk_data;
+
+	return( 1 );
+
+on_error:
+	if( chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &chunk_data,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves the chunk data of a chunk at a specific offset
- * Adds a checksum error if the data is corrupted
  * Returns 1 if successful or -1 on error
  */
-int libewf_chunk_table_get_chunk_data_by_offset(
+int libewf_chunk_table_get_segment_file_chunk_data_by_offset(
      libewf_chunk_table_t *chunk_table,
      libewf_io_handle_t *io_handle,
      libbfio_pool_t *file_io_pool,
+     libfcache_cache_t *chunk_data_cache,
      libewf_media_values_t *media_values,
      libewf_segment_table_t *segment_table,
      off64_t offset,
      off64_t *chunk_data_offset,
      libewf_chunk_data_t **chunk_data,
+     uint8_t read_flags,
      libcerror_error_t **error )
 {
-	libewf_chunk_data_t *safe_chunk_data = NULL;
-	static char *function                = "libewf_chunk_table_get_chunk_data_by_offset";
-	off64_t safe_chunk_data_offset       = 0;
-	uint64_t chunk_index                 = 0;
-	uint64_t number_of_sectors           = 0;
-	uint64_t start_sector                = 0;
-	int result                           = 0;
+	libewf_chunk_group_t *chunk_group = NULL;
+	static char *function             = "libewf_chunk_table_get_segment_file_chunk_data_by_offset";
+	off64_t chunk_group_data_offset   = 0;
+	off64_t safe_chunk_data_offset    = 0;
+	uint64_t chunk_index              = 0;
+	uint64_t first_chunk_index        = 0;
+	uint32_t segment_number           = 0;
+	int chunk_groups_list_index       = 0;
+	int chunks_list_index             = 0;
+	int result                        = 0;
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid media values - chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_table->current_chunk_data != NULL )
+	 && ( chunk_table->current_chunk_data->range_end_offset > 0 ) )
+	{
+		if( ( offset >= chunk_table->current_chunk_data->range_start_offset )
+		 && ( offset < chunk_table->current_chunk_data->range_end_offset ) )
+		{
+			safe_chunk_data_offset = offset - chunk_table->current_chunk_data->range_start_offset;
+
+			result = 1;
+		}
+	}
+	if( result == 0 )
+	{
+		chunk_index = (uint64_t) offset / media_values->chunk_size;
+
+		result = libewf_chunk_table_get_chunk_data_by_location(
+		          chunk_table,
+		          io_handle,
+		          file_io_pool,
+		          chunk_data_cache,
+		          media_values,
+		          chunk_index,
+		          read_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %" PRIu64 " data by location.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			safe_chunk_data_offset = offset - chunk_table->current_chunk_data->range_start_offset;
+		}
+	}
+	if( result == 0 )
+	{
+		result = libewf_chunk_table_get_segment_file_chunk_group_by_offset(
+			  chunk_table,
+			  file_io_pool,
+			  segment_table,
+			  offset,
+			  &segment_number,
+			  &chunk_groups_list_index,
+			  &chunk_group_data_offset,
+			  &chunk_group,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment file chunk group for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		if( result != 0 )
+		{
+			if( chunk_group == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing chunk group: %d.",
+				 function,
+				 chunk_groups_list_index );
+
+				return( -1 );
+			}
+			chunk_index            = (uint64_t) offset / media_values->chunk_size;
+			chunks_list_index      = (int) ( chunk_group_data_offset / media_values->chunk_size );
+			safe_chunk_data_offset = chunk_group_data_offset - ( (off64_t) chunks_list_index * media_values->chunk_size );
+
+			if( ( ( io_handle->access_flags & LIBEWF_ACCESS_FLAG_WRITE ) == 0 )
+			 && ( media_values->number_of_chunks > 0 ) )
+			{
+				if( chunk_table->chunk_locations == NULL )
+				{
+					if( libewf_chunk_locations_initialize(
+					     &( chunk_table->chunk_locations ),
+					     media_values->number_of_chunks,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+						 "%s: unable to create chunk locations.",
+						 function );
+
+						return( -1 );
+					}
+				}
+				first_chunk_index = (uint64_t) chunk_group->range_start_offset / media_values->chunk_size;
+
+				if( first_chunk_index < chunk_table->chunk_locations->number_of_chunks )
+				{
+					if( libewf_chunk_locations_set_locations_from_chunks_list(
+					     chunk_table->chunk_locations,
+					     first_chunk_index,
+					     chunk_group->chunks_list,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to set chunk locations of chunk group: %d in segment file: %" PRIu32 ".",
+						 function,
+						 chunk_groups_list_index,
+						 segment_number );
+
+						return( -1 );
+					}
+				}
+			}
+
+			if( libfdata_list_get_element_value_by_index(
+			     chunk_group->chunks_list,
+			     (intptr_t *) file_io_pool,
+			     (libfdata_cache_t *) chunk_data_cache,
+			     chunks_list_index,
+			     (intptr_t **) &( chunk_table->current_chunk_data ),
+			     read_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu64 " data from chunk group: %d in segment file: %" PRIu32 " for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 chunk_index,
+				 chunk_groups_list_index,
+				 segment_number,
+				 offset,
+				 offset );
+
+				return( -1 );
+			}
+			if( chunk_table->current_chunk_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing chunk data: %" PRIu64 ".",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+			chunk_table->current_chunk_data->chunk_index = chunk_index;
+
+			if( libfdata_list_get_element_mapped_range(
+			     chunk_group->chunks_list,
+			     chunks_list_index,
+			     &( chunk_table->current_chunk_data->range_start_offset ),
+			     (size64_t *) &( chunk_table->current_chunk_data->range_end_offset ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve list element: %d mapped range for chunk group: %d in segment file: %" PRIu32 ".",
+				 function,
+				 chunks_list_index,
+				 chunk_groups_list_index,
+				 segment_number );
+
+				return( -1 );
+			}
+			chunk_table->current_chunk_data->range_start_offset += chunk_table->current_chunk_group->range_start_offset;
+			chunk_table->current_chunk_data->range_end_offset   += chunk_table->current_chunk_data->range_start_offset;
+
+			if( (size64_t) chunk_table->current_chunk_data->range_end_offset > media_values->media_size )
+			{
+				chunk_table->current_chunk_data->range_end_offset = (off64_t) media_values->media_size;
+			}
+		}
+	}
+	if( result != 0 )
+	{
+		*chunk_data_offset = safe_chunk_data_offset;
+		*chunk_data        = chunk_table->current_chunk_data;
+	}
+	return( result );
+}
+
+/* Retrieves the chunk data of a chunk at a specific offset
+ * Adds a checksum error if the data is corrupted
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_table_get_chunk_data_by_offset(
+     libewf_chunk_table_t *chunk_table,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     off64_t offset,
+     off64_t *chunk_data_offset,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error )
+{
+	libewf_chunk_data_t *safe_chunk_data = NULL;
+	static char *function                = "libewf_chunk_table_get_chunk_data_by_offset";
+	off64_t safe_chunk_data_offset       = 0;
+	uint64_t chunk_index                 = 0;
+	uint64_t number_of_sectors           = 0;
+	uint64_t start_sector                = 0;
+	int result                           = 0;
 
 	if( chunk_table == NULL )
 	{
@@ -1163,3 +1789,488 @@ int libewf_chunk_table_get_chunk_data_by_offset_no_cache(
 	return( result );
 }
 
+/* Retrieves the next range that contains data at or after a specific offset
+ * Chunks that contain only 0-byte values according to libewf_chunk_group_chunk_is_empty
+ * are not considered data
+ * Returns 1 if successful, 0 if no such range or -1 on error
+ */
+int libewf_chunk_table_get_next_data_range(
+     libewf_chunk_table_t *chunk_table,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     off64_t offset,
+     off64_t *data_range_offset,
+     size64_t *data_range_size,
+     libcerror_error_t **error )
+{
+	libewf_chunk_group_t *chunk_group = NULL;
+	static char *function             = "libewf_chunk_table_get_next_data_range";
+	off64_t chunk_group_data_offset   = 0;
+	off64_t chunk_offset              = 0;
+	off64_t range_end_offset          = 0;
+	off64_t range_start_offset        = -1;
+	uint32_t segment_number           = 0;
+	int chunk_groups_list_index       = 0;
+	int chunks_list_index             = 0;
+	int result                        = 0;
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid media values - chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_range_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data range offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_range_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data range size.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_offset = offset - ( offset % media_values->chunk_size );
+
+	while( (size64_t) chunk_offset < media_values->media_size )
+	{
+		result = libewf_chunk_table_get_segment_file_chunk_group_by_offset(
+			  chunk_table,
+			  file_io_pool,
+			  segment_table,
+			  chunk_offset,
+			  &segment_number,
+			  &chunk_groups_list_index,
+			  &chunk_group_data_offset,
+			  &chunk_group,
+			  error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment file chunk group for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 chunk_offset,
+			 chunk_offset );
+
+			return( -1 );
+		}
+		chunks_list_index = (int) ( chunk_group_data_offset / media_values->chunk_size );
+
+		result = libewf_chunk_group_chunk_is_empty(
+		          chunk_group,
+		          io_handle,
+		          file_io_pool,
+		          chunks_list_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if chunk: %d of chunk group: %d in segment file: %" PRIu32 " is empty.",
+			 function,
+			 chunks_list_index,
+			 chunk_groups_list_index,
+			 segment_number );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( range_start_offset == -1 )
+			{
+				range_start_offset = chunk_offset;
+			}
+		}
+		else if( range_start_offset != -1 )
+		{
+			break;
+		}
+		chunk_offset += media_values->chunk_size;
+	}
+	if( range_start_offset == -1 )
+	{
+		return( 0 );
+	}
+	if( range_start_offset < offset )
+	{
+		range_start_offset = offset;
+	}
+	range_end_offset = chunk_offset;
+
+	if( (size64_t) range_end_offset > media_values->media_size )
+	{
+		range_end_offset = (off64_t) media_values->media_size;
+	}
+	*data_range_offset = range_start_offset;
+	*data_range_size   = (size64_t) ( range_end_offset - range_start_offset );
+
+	return( 1 );
+}
+
+/* Advises the expected access of a range of the media data
+ * Only the will need and do not need access advice are supported
+ * Do not need access advice removes the chunks in the range from the chunk data cache
+ * and the compressed chunk cache
+ * The access advice is forwarded to the operating system for the segment file ranges
+ * of the chunks in the range that have a known location
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_chunk_table_advise_range(
+     libewf_chunk_table_t *chunk_table,
+     libewf_media_values_t *media_values,
+     off64_t offset,
+     size64_t size,
+     int access_advice,
+     libcerror_error_t **error )
+{
+	libewf_chunk_data_t *chunk_data      = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libewf_chunk_table_advise_range";
+	size64_t advise_range_size           = 0;
+	size64_t chunk_data_size             = 0;
+	off64_t advise_range_offset          = 0;
+	off64_t chunk_data_offset            = 0;
+	uint64_t chunk_index                 = 0;
+	uint64_t first_chunk_index           = 0;
+	uint64_t last_chunk_index            = 0;
+	uint32_t range_flags                 = 0;
+	int advise_range_file_io_pool_entry  = -1;
+	int cache_entry_index                = 0;
+	int file_io_pool_entry               = 0;
+	int number_of_cache_entries          = 0;
+	int result                           = 0;
+
+	if( chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid media values - chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_advice != LIBEWF_ACCESS_ADVICE_WILLNEED )
+	 && ( access_advice != LIBEWF_ACCESS_ADVICE_DONTNEED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access advice.",
+		 function );
+
+		return( -1 );
+	}
+	/* A size of 0 represents the range up to the end of the media data
+	 */
+	if( ( size == 0 )
+	 || ( size > ( media_values->media_size - (size64_t) offset ) ) )
+	{
+		if( (size64_t) offset >= media_values->media_size )
+		{
+			return( 1 );
+		}
+		size = media_values->media_size - (size64_t) offset;
+	}
+	first_chunk_index = (uint64_t) offset / media_values->chunk_size;
+	last_chunk_index  = ( (uint64_t) offset + size - 1 ) / media_values->chunk_size;
+
+	if( ( access_advice == LIBEWF_ACCESS_ADVICE_DONTNEED )
+	 && ( chunk_table->chunk_data_cache != NULL ) )
+	{
+		if( libfcache_cache_get_number_of_entries(
+		     chunk_table->chunk_data_cache,
+		     &number_of_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of cache entries.",
+			 function );
+
+			return( -1 );
+		}
+		for( cache_entry_index = 0;
+		     cache_entry_index < number_of_cache_entries;
+		     cache_entry_index++ )
+		{
+			if( libfcache_cache_get_value_by_index(
+			     chunk_table->chunk_data_cache,
+			     cache_entry_index,
+			     &cache_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cache entry: %d from chunk data cache.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+			if( cache_value == NULL )
+			{
+				continue;
+			}
+			if( libfcache_cache_value_get_value(
+			     cache_value,
+			     (intptr_t **) &chunk_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk data from cache entry: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+			if( ( chunk_data == NULL )
+			 || ( chunk_data->chunk_index < first_chunk_index )
+			 || ( chunk_data->chunk_index > last_chunk_index ) )
+			{
+				continue;
+			}
+			if( chunk_data == chunk_table->current_chunk_data )
+			{
+				chunk_table->current_chunk_data = NULL;
+			}
+			if( libfcache_cache_clear_value_by_index(
+			     chunk_table->chunk_data_cache,
+			     cache_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to clear chunk data cache entry: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+		}
+	}
+	if( ( access_advice == LIBEWF_ACCESS_ADVICE_DONTNEED )
+	 && ( chunk_table->compressed_chunk_cache != NULL ) )
+	{
+		if( libewf_compressed_chunk_cache_remove_chunk_data(
+		     chunk_table->compressed_chunk_cache,
+		     first_chunk_index,
+		     last_chunk_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove chunk data from compressed chunk cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The segment file ranges are only known when the chunk locations are available
+	 */
+	if( ( chunk_table->file_descriptor_pool == NULL )
+	 || ( chunk_table->chunk_locations == NULL ) )
+	{
+		return( 1 );
+	}
+	if( last_chunk_index >= chunk_table->chunk_locations->number_of_chunks )
+	{
+		if( first_chunk_index >= chunk_table->chunk_locations->number_of_chunks )
+		{
+			return( 1 );
+		}
+		last_chunk_index = chunk_table->chunk_locations->number_of_chunks - 1;
+	}
+	for( chunk_index = first_chunk_index;
+	     chunk_index <= last_chunk_index;
+	     chunk_index++ )
+	{
+		result = libewf_chunk_locations_get_location(
+		          chunk_table->chunk_locations,
+		          chunk_index,
+		          &file_io_pool_entry,
+		          &chunk_data_offset,
+		          &chunk_data_size,
+		          &range_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve location of chunk: %" PRIu64 ".",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      || ( ( range_flags & LIBEWF_RANGE_FLAG_IS_SPARSE ) != 0 ) )
+		{
+			continue;
+		}
+		/* Contiguous chunks in the same segment file are advised as a single range
+		 */
+		if( ( advise_range_file_io_pool_entry == file_io_pool_entry )
+		 && ( ( advise_range_offset + (off64_t) advise_range_size ) == chunk_data_offset ) )
+		{
+			advise_range_size += chunk_data_size;
+
+			continue;
+		}
+		if( advise_range_file_io_pool_entry != -1 )
+		{
+			if( libewf_file_descriptor_pool_advise_range(
+			     chunk_table->file_descriptor_pool,
+			     advise_range_file_io_pool_entry,
+			     advise_range_offset,
+			     advise_range_size,
+			     access_advice,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to advise range of file IO pool entry: %d.",
+				 function,
+				 advise_range_file_io_pool_entry );
+
+				return( -1 );
+			}
+		}
+		advise_range_file_io_pool_entry = file_io_pool_entry;
+		advise_range_offset             = chunk_data_offset;
+		advise_range_size               = chunk_data_size;
+	}
+	if( advise_range_file_io_pool_entry != -1 )
+	{
+		if( libewf_file_descriptor_pool_advise_range(
+		     chunk_table->file_descriptor_pool,
+		     advise_range_file_io_pool_entry,
+		     advise_range_offset,
+		     advise_range_size,
+		     access_advice,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to advise range of file IO pool entry: %d.",
+			 function,
+			 advise_range_file_io_pool_entry );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -26,13 +26,18 @@
 #include <types.h>
 
 #include "libewf_chunk_group.h"
+#include "libewf_chunk_locations.h"
+#include "libewf_compressed_chunk_cache.h"
+#include "libewf_file_descriptor_pool.h"
 #include "libewf_io_handle.h"
 #include "libewf_libbfio.h"
 #include "libewf_libcerror.h"
 #include "libewf_libfcache.h"
 #include "libewf_libfdata.h"
+#include "libewf_persistent_cache.h"
 #include "libewf_segment_file.h"
 #include "libewf_segment_table.h"
+#include "libewf_shared_chunk_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -81,6 +86,40 @@ struct libewf_chunk_table
 	/* The single chunk data cache
 	 */
 	libfcache_cache_t *single_chunk_data_cache;
+
+	/* The chunk locations
+	 * Maps a chunk index to the location of the chunk data
+	 */
+	libewf_chunk_locations_t *chunk_locations;
+
+	/* Value to indicate the chunk locations are shared with other handles
+	 * Shared chunk locations are not managed by the chunk table
+	 */
+	uint8_t chunk_locations_is_shared;
+
+	/* The file descriptor pool
+	 * The file descriptor pool is not managed by the chunk table
+	 */
+	libewf_file_descriptor_pool_t *file_descriptor_pool;
+
+	/* The persistent cache
+	 * The persistent cache is not managed by the chunk table
+	 */
+	libewf_persistent_cache_t *persistent_cache;
+
+	/* The compressed chunk cache
+	 * The compressed chunk cache is not managed by the chunk table
+	 */
+	libewf_compressed_chunk_cache_t *compressed_chunk_cache;
+
+	/* The shared chunk cache
+	 * The shared chunk cache is not managed by the chunk table
+	 */
+	libewf_shared_chunk_cache_t *shared_chunk_cache;
+
+	/* The access advice
+	 */
+	int access_advice;
 };
 
 int libewf_chunk_table_initialize(
@@ -126,6 +165,16 @@ int libewf_chunk_table_get_segment_file_chunk_group_by_offset(
      libewf_chunk_group_t **chunk_group,
      libcerror_error_t **error );
 
+int libewf_chunk_table_get_chunk_data_by_location(
+     libewf_chunk_table_t *chunk_table,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libfcache_cache_t *chunk_data_cache,
+     libewf_media_values_t *media_values,
+     uint64_t chunk_index,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
 int libewf_chunk_table_get_segment_file_chunk_data_by_offset(
      libewf_chunk_table_t *chunk_table,
      libewf_io_handle_t *io_handle,
@@ -161,6 +210,25 @@ int libewf_chunk_table_get_chunk_data_by_offset_no_cache(
      libewf_chunk_data_t **chunk_data,
      libcerror_error_t **error );
 
+int libewf_chunk_table_get_next_data_range(
+     libewf_chunk_table_t *chunk_table,
+     libewf_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libewf_media_values_t *media_values,
+     libewf_segment_table_t *segment_table,
+     off64_t offset,
+     off64_t *data_range_offset,
+     size64_t *data_range_size,
+     libcerror_error_t **error );
+
+int libewf_chunk_table_advise_range(
+     libewf_chunk_table_t *chunk_table,
+     libewf_media_values_t *media_values,
+     off64_t offset,
+     size64_t size,
+     int access_advice,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
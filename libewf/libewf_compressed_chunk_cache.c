@@ -0,0 +1,1068 @@
+/*
+ * Compressed chunk cache functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_compressed_chunk_cache.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+
+/* Creates a compressed chunk cache
+ * Make sure the value compressed_chunk_cache is referencing, is set to NULL
+ * The number of hash buckets is determined by the maximum cache size, where
+ * the compressed chunk data is expected to be a quarter of the chunk size
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_compressed_chunk_cache_initialize(
+     libewf_compressed_chunk_cache_t **compressed_chunk_cache,
+     uint32_t chunk_size,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function               = "libewf_compressed_chunk_cache_initialize";
+	size64_t expected_number_of_entries = 0;
+
+	if( compressed_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_chunk_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressed chunk cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( (size_t) chunk_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum cache size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*compressed_chunk_cache = memory_allocate_structure(
+	                           libewf_compressed_chunk_cache_t );
+
+	if( *compressed_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed chunk cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *compressed_chunk_cache,
+	     0,
+	     sizeof( libewf_compressed_chunk_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compressed chunk cache.",
+		 function );
+
+		memory_free(
+		 *compressed_chunk_cache );
+
+		*compressed_chunk_cache = NULL;
+
+		return( -1 );
+	}
+	expected_number_of_entries = maximum_cache_size / ( ( (size64_t) chunk_size / 4 ) + 1 );
+
+	( *compressed_chunk_cache )->maximum_cache_size     = maximum_cache_size;
+	( *compressed_chunk_cache )->number_of_hash_buckets = 1;
+
+	/* The number of hash buckets is a power of 2 so that the chunk index
+	 * can be mapped onto a bucket with a mask
+	 */
+	while( ( ( *compressed_chunk_cache )->number_of_hash_buckets < LIBEWF_COMPRESSED_CHUNK_CACHE_MAXIMUM_NUMBER_OF_HASH_BUCKETS )
+	    && ( (size64_t) ( *compressed_chunk_cache )->number_of_hash_buckets < expected_number_of_entries ) )
+	{
+		( *compressed_chunk_cache )->number_of_hash_buckets <<= 1;
+	}
+	( *compressed_chunk_cache )->hash_buckets = (libewf_compressed_chunk_cache_entry_t **) memory_allocate(
+	                                                                                        sizeof( libewf_compressed_chunk_cache_entry_t * ) * ( *compressed_chunk_cache )->number_of_hash_buckets );
+
+	if( ( *compressed_chunk_cache )->hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *compressed_chunk_cache )->hash_buckets,
+	     0,
+	     sizeof( libewf_compressed_chunk_cache_entry_t * ) * ( *compressed_chunk_cache )->number_of_hash_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *compressed_chunk_cache )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *compressed_chunk_cache != NULL )
+	{
+		if( ( *compressed_chunk_cache )->hash_buckets != NULL )
+		{
+			memory_free(
+			 ( *compressed_chunk_cache )->hash_buckets );
+		}
+		memory_free(
+		 *compressed_chunk_cache );
+
+		*compressed_chunk_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a compressed chunk cache
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_compressed_chunk_cache_free(
+     libewf_compressed_chunk_cache_t **compressed_chunk_cache,
+     libcerror_error_t **error )
+{
+	libewf_compressed_chunk_cache_entry_t *entry      = NULL;
+	libewf_compressed_chunk_cache_entry_t *next_entry = NULL;
+	static char *function                             = "libewf_compressed_chunk_cache_free";
+	int result                                        = 1;
+
+	if( compressed_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_chunk_cache != NULL )
+	{
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *compressed_chunk_cache )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		entry = ( *compressed_chunk_cache )->first_entry;
+
+		while( entry != NULL )
+		{
+			next_entry = entry->next_entry;
+
+			if( entry->data != NULL )
+			{
+				memory_free(
+				 entry->data );
+			}
+			memory_free(
+			 entry );
+
+			entry = next_entry;
+		}
+		if( ( *compressed_chunk_cache )->hash_buckets != NULL )
+		{
+			memory_free(
+			 ( *compressed_chunk_cache )->hash_buckets );
+		}
+		memory_free(
+		 *compressed_chunk_cache );
+
+		*compressed_chunk_cache = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the entry of a specific chunk
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libewf_compressed_chunk_cache_get_entry(
+     libewf_compressed_chunk_cache_t *compressed_chunk_cache,
+     uint64_t chunk_index,
+     libewf_compressed_chunk_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	libewf_compressed_chunk_cache_entry_t *hash_entry = NULL;
+	static char *function                             = "libewf_compressed_chunk_cache_get_entry";
+	int hash_bucket_index                             = 0;
+
+	if( compressed_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_chunk_cache->hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressed chunk cache - missing hash buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	hash_bucket_index = (int) ( chunk_index & (uint64_t) ( compressed_chunk_cache->number_of_hash_buckets - 1 ) );
+
+	hash_entry = compressed_chunk_cache->hash_buckets[ hash_bucket_index ];
+
+	while( hash_entry != NULL )
+	{
+		if( hash_entry->chunk_index == chunk_index )
+		{
+			*entry = hash_entry;
+
+			return( 1 );
+		}
+		hash_entry = hash_entry->next_hash_entry;
+	}
+	return( 0 );
+}
+
+/* Removes an entry from the least recently used list
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_compressed_chunk_cache_unlink_entry(
+     libewf_compressed_chunk_cache_t *compressed_chunk_cache,
+     libewf_compressed_chunk_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_compressed_chunk_cache_unlink_entry";
+
+	if( compressed_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->previous_entry != NULL )
+	{
+		entry->previous_entry->next_entry = entry->next_entry;
+	}
+	else
+	{
+		compressed_chunk_cache->first_entry = entry->next_entry;
+	}
+	if( entry->next_entry != NULL )
+	{
+		entry->next_entry->previous_entry = entry->previous_entry;
+	}
+	else
+	{
+		compressed_chunk_cache->last_entry = entry->previous_entry;
+	}
+	entry->previous_entry = NULL;
+	entry->next_entry     = NULL;
+
+	return( 1 );
+}
+
+/* Adds an unlinked entry to the front (most recently used) of the least recently used list
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_compressed_chunk_cache_link_entry(
+     libewf_compressed_chunk_cache_t *compressed_chunk_cache,
+     libewf_compressed_chunk_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_compressed_chunk_cache_link_entry";
+
+	if( compressed_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	entry->previous_entry = NULL;
+	entry->next_entry     = compressed_chunk_cache->first_entry;
+
+	if( compressed_chunk_cache->first_entry != NULL )
+	{
+		compressed_chunk_cache->first_entry->previous_entry = entry;
+	}
+	compressed_chunk_cache->first_entry = entry;
+
+	if( compressed_chunk_cache->last_entry == NULL )
+	{
+		compressed_chunk_cache->last_entry = entry;
+	}
+	return( 1 );
+}
+
+/* Removes an entry from the compressed chunk cache and frees it
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_compressed_chunk_cache_remove_entry(
+     libewf_compressed_chunk_cache_t *compressed_chunk_cache,
+     libewf_compressed_chunk_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	libewf_compressed_chunk_cache_entry_t *hash_entry          = NULL;
+	libewf_compressed_chunk_cache_entry_t *previous_hash_entry = NULL;
+	static char *function                                      = "libewf_compressed_chunk_cache_remove_entry";
+	int hash_bucket_index                                      = 0;
+
+	if( compressed_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_chunk_cache->hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressed chunk cache - missing hash buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	hash_bucket_index = (int) ( entry->chunk_index & (uint64_t) ( compressed_chunk_cache->number_of_hash_buckets - 1 ) );
+
+	hash_entry = compressed_chunk_cache->hash_buckets[ hash_bucket_index ];
+
+	while( hash_entry != NULL )
+	{
+		if( hash_entry == entry )
+		{
+			if( previous_hash_entry == NULL )
+			{
+				compressed_chunk_cache->hash_buckets[ hash_bucket_index ] = hash_entry->next_hash_entry;
+			}
+			else
+			{
+				previous_hash_entry->next_hash_entry = hash_entry->next_hash_entry;
+			}
+			break;
+		}
+		previous_hash_entry = hash_entry;
+		hash_entry          = hash_entry->next_hash_entry;
+	}
+	if( libewf_compressed_chunk_cache_unlink_entry(
+	     compressed_chunk_cache,
+	     entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to unlink entry.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_chunk_cache->cache_size        -= sizeof( libewf_compressed_chunk_cache_entry_t ) + entry->data_size;
+	compressed_chunk_cache->number_of_entries -= 1;
+
+	if( entry->data != NULL )
+	{
+		memory_free(
+		 entry->data );
+	}
+	memory_free(
+	 entry );
+
+	return( 1 );
+}
+
+/* Retrieves the compressed data of a specific chunk from the compressed chunk cache
+ * Returns 1 if successful, 0 if the chunk is not in the compressed chunk cache or -1 on error
+ */
+int libewf_compressed_chunk_cache_get_chunk_data(
+     libewf_compressed_chunk_cache_t *compressed_chunk_cache,
+     uint64_t chunk_index,
+     uint8_t *data,
+     size_t data_size,
+     size_t *chunk_data_size,
+     libcerror_error_t **error )
+{
+	libewf_compressed_chunk_cache_entry_t *entry = NULL;
+	static char *function                        = "libewf_compressed_chunk_cache_get_chunk_data";
+	int result                                   = 0;
+
+	if( compressed_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     compressed_chunk_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libewf_compressed_chunk_cache_get_entry(
+	          compressed_chunk_cache,
+	          chunk_index,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry of chunk: %" PRIu64 ".",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( entry->data_size > data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     data,
+		     entry->data,
+		     entry->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chunk: %" PRIu64 " data.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( entry != compressed_chunk_cache->first_entry )
+		{
+			if( libewf_compressed_chunk_cache_unlink_entry(
+			     compressed_chunk_cache,
+			     entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to unlink entry.",
+				 function );
+
+				goto on_error;
+			}
+			if( libewf_compressed_chunk_cache_link_entry(
+			     compressed_chunk_cache,
+			     entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to link entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		*chunk_data_size = entry->data_size;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     compressed_chunk_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 compressed_chunk_cache->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Adds the compressed data of a specific chunk to the compressed chunk cache
+ * The least recently used entries are removed until the data fits the maximum cache size
+ * Returns 1 if successful, 0 if the data exceeds the maximum cache size or -1 on error
+ */
+int libewf_compressed_chunk_cache_set_chunk_data(
+     libewf_compressed_chunk_cache_t *compressed_chunk_cache,
+     uint64_t chunk_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libewf_compressed_chunk_cache_entry_t *entry = NULL;
+	static char *function                        = "libewf_compressed_chunk_cache_set_chunk_data";
+	size64_t entry_size                          = 0;
+	int hash_bucket_index                        = 0;
+	int result                                   = 0;
+
+	if( compressed_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_chunk_cache->hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compressed chunk cache - missing hash buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry_size = (size64_t) sizeof( libewf_compressed_chunk_cache_entry_t ) + data_size;
+
+	if( entry_size > compressed_chunk_cache->maximum_cache_size )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     compressed_chunk_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libewf_compressed_chunk_cache_get_entry(
+	          compressed_chunk_cache,
+	          chunk_index,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry of chunk: %" PRIu64 ".",
+		 function,
+		 chunk_index );
+
+		entry = NULL;
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libewf_compressed_chunk_cache_remove_entry(
+		     compressed_chunk_cache,
+		     entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry of chunk: %" PRIu64 ".",
+			 function,
+			 chunk_index );
+
+			entry = NULL;
+
+			goto on_error;
+		}
+	}
+	entry = NULL;
+
+	while( ( compressed_chunk_cache->last_entry != NULL )
+	    && ( ( compressed_chunk_cache->cache_size + entry_size ) > compressed_chunk_cache->maximum_cache_size ) )
+	{
+		if( libewf_compressed_chunk_cache_remove_entry(
+		     compressed_chunk_cache,
+		     compressed_chunk_cache->last_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	entry = memory_allocate_structure(
+	         libewf_compressed_chunk_cache_entry_t );
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     entry,
+	     0,
+	     sizeof( libewf_compressed_chunk_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		goto on_error;
+	}
+	entry->data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * data_size );
+
+	if( entry->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     entry->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy chunk: %" PRIu64 " data.",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	entry->chunk_index = chunk_index;
+	entry->data_size   = data_size;
+
+	if( libewf_compressed_chunk_cache_link_entry(
+	     compressed_chunk_cache,
+	     entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to link entry.",
+		 function );
+
+		goto on_error;
+	}
+	hash_bucket_index = (int) ( chunk_index & (uint64_t) ( compressed_chunk_cache->number_of_hash_buckets - 1 ) );
+
+	entry->next_hash_entry                                    = compressed_chunk_cache->hash_buckets[ hash_bucket_index ];
+	compressed_chunk_cache->hash_buckets[ hash_bucket_index ] = entry;
+
+	compressed_chunk_cache->cache_size        += entry_size;
+	compressed_chunk_cache->number_of_entries += 1;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     compressed_chunk_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( entry != NULL )
+	{
+		if( entry->data != NULL )
+		{
+			memory_free(
+			 entry->data );
+		}
+		memory_free(
+		 entry );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 compressed_chunk_cache->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Removes the compressed data of a range of chunks from the compressed chunk cache
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_compressed_chunk_cache_remove_chunk_data(
+     libewf_compressed_chunk_cache_t *compressed_chunk_cache,
+     uint64_t first_chunk_index,
+     uint64_t last_chunk_index,
+     libcerror_error_t **error )
+{
+	libewf_compressed_chunk_cache_entry_t *entry      = NULL;
+	libewf_compressed_chunk_cache_entry_t *next_entry = NULL;
+	static char *function                             = "libewf_compressed_chunk_cache_remove_chunk_data";
+
+	if( compressed_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_chunk_index > last_chunk_index )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     compressed_chunk_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	entry = compressed_chunk_cache->first_entry;
+
+	while( entry != NULL )
+	{
+		next_entry = entry->next_entry;
+
+		if( ( entry->chunk_index >= first_chunk_index )
+		 && ( entry->chunk_index <= last_chunk_index ) )
+		{
+			if( libewf_compressed_chunk_cache_remove_entry(
+			     compressed_chunk_cache,
+			     entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove entry of chunk: %" PRIu64 ".",
+				 function,
+				 entry->chunk_index );
+
+				goto on_error;
+			}
+		}
+		entry = next_entry;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     compressed_chunk_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 compressed_chunk_cache->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
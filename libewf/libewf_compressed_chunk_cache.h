@@ -0,0 +1,166 @@
+/*
+ * Compressed chunk cache functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_COMPRESSED_CHUNK_CACHE_H )
+#define _LIBEWF_COMPRESSED_CHUNK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of hash buckets in the compressed chunk cache
+ */
+#define LIBEWF_COMPRESSED_CHUNK_CACHE_MAXIMUM_NUMBER_OF_HASH_BUCKETS	1048576
+
+typedef struct libewf_compressed_chunk_cache_entry libewf_compressed_chunk_cache_entry_t;
+
+struct libewf_compressed_chunk_cache_entry
+{
+	/* The chunk index
+	 */
+	uint64_t chunk_index;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The previous (more recently used) entry
+	 */
+	libewf_compressed_chunk_cache_entry_t *previous_entry;
+
+	/* The next (less recently used) entry
+	 */
+	libewf_compressed_chunk_cache_entry_t *next_entry;
+
+	/* The next entry in the same hash bucket
+	 */
+	libewf_compressed_chunk_cache_entry_t *next_hash_entry;
+};
+
+typedef struct libewf_compressed_chunk_cache libewf_compressed_chunk_cache_t;
+
+struct libewf_compressed_chunk_cache
+{
+	/* The maximum cache size
+	 */
+	size64_t maximum_cache_size;
+
+	/* The cache size
+	 * Contains the size of the data and the entries
+	 */
+	size64_t cache_size;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of hash buckets
+	 */
+	int number_of_hash_buckets;
+
+	/* The hash buckets
+	 * Contains the first entry in each bucket or NULL if empty
+	 */
+	libewf_compressed_chunk_cache_entry_t **hash_buckets;
+
+	/* The most recently used entry
+	 */
+	libewf_compressed_chunk_cache_entry_t *first_entry;
+
+	/* The least recently used entry
+	 */
+	libewf_compressed_chunk_cache_entry_t *last_entry;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libewf_compressed_chunk_cache_initialize(
+     libewf_compressed_chunk_cache_t **compressed_chunk_cache,
+     uint32_t chunk_size,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libewf_compressed_chunk_cache_free(
+     libewf_compressed_chunk_cache_t **compressed_chunk_cache,
+     libcerror_error_t **error );
+
+int libewf_compressed_chunk_cache_get_entry(
+     libewf_compressed_chunk_cache_t *compressed_chunk_cache,
+     uint64_t chunk_index,
+     libewf_compressed_chunk_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int libewf_compressed_chunk_cache_unlink_entry(
+     libewf_compressed_chunk_cache_t *compressed_chunk_cache,
+     libewf_compressed_chunk_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libewf_compressed_chunk_cache_link_entry(
+     libewf_compressed_chunk_cache_t *compressed_chunk_cache,
+     libewf_compressed_chunk_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libewf_compressed_chunk_cache_remove_entry(
+     libewf_compressed_chunk_cache_t *compressed_chunk_cache,
+     libewf_compressed_chunk_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libewf_compressed_chunk_cache_get_chunk_data(
+     libewf_compressed_chunk_cache_t *compressed_chunk_cache,
+     uint64_t chunk_index,
+     uint8_t *data,
+     size_t data_size,
+     size_t *chunk_data_size,
+     libcerror_error_t **error );
+
+int libewf_compressed_chunk_cache_set_chunk_data(
+     libewf_compressed_chunk_cache_t *compressed_chunk_cache,
+     uint64_t chunk_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libewf_compressed_chunk_cache_remove_chunk_data(
+     libewf_compressed_chunk_cache_t *compressed_chunk_cache,
+     uint64_t first_chunk_index,
+     uint64_t last_chunk_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_COMPRESSED_CHUNK_CACHE_H ) */
+
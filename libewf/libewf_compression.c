@@ -34,6 +34,7 @@
 #include <zlib.h>
 #endif
 
+#include "libewf_bzip2.h"
 #include "libewf_compression.h"
 #include "libewf_definitions.h"
 #include "libewf_deflate.h"
@@ -388,6 +389,7 @@ int libewf_decompress_data(
 	int result                                = 0;
 
 #if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+	size_t native_uncompressed_data_size      = 0;
 	unsigned int bzip2_uncompressed_data_size = 0;
 #endif
 #if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL )
@@ -566,6 +568,24 @@ int libewf_decompress_data(
 	else if( compression_method == LIBEWF_COMPRESSION_METHOD_BZIP2 )
 	{
 #if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+		/* The native bzip2 decoder is preferred since it is faster than libbz2
+		 * on chunk sized data, see tests/ewf_bench_bzip2.c. libbz2 is used when
+		 * the native decoder fails, which provides the resize hint when the
+		 * uncompressed data buffer is too small and the libbz2 error otherwise
+		 */
+		native_uncompressed_data_size = *uncompressed_data_size;
+
+		if( libewf_bzip2_decompress(
+		     compressed_data,
+		     compressed_data_size,
+		     uncompressed_data,
+		     &native_uncompressed_data_size,
+		     NULL ) == 1 )
+		{
+			*uncompressed_data_size = native_uncompressed_data_size;
+
+			return( 1 );
+		}
 		if( compressed_data_size > (size_t) UINT_MAX )
 		{
 			libcerror_error_set(
@@ -663,14 +683,24 @@ int libewf_decompress_data(
 			result = -1;
 		}
 #else
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: missing support for bzip2 compression.",
-		 function );
+		result = libewf_bzip2_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          error );
 
-		return( -1 );
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress bzip2 compressed data.",
+			 function );
+
+			return( -1 );
+		}
 #endif /* defined( HAVE_BZLIB ) || defined( BZ_DLL ) */
 	}
 	else
@@ -194,6 +194,11 @@ int libewf_data_chunk_free(
 
 			result = -1;
 		}
+		if( internal_data_chunk->digest_data != NULL )
+		{
+			memory_free(
+			 internal_data_chunk->digest_data );
+		}
 		/* The io_handle and write_io_handle references are freed elsewhere
 		 */
 		memory_free(
@@ -266,6 +271,13 @@ int libewf_internal_data_chunk_set_chunk_data(
 			result = -1;
 		}
 	}
+	if( internal_data_chunk->digest_data != NULL )
+	{
+		memory_free(
+		 internal_data_chunk->digest_data );
+
+		internal_data_chunk->digest_data = NULL;
+	}
 	if( result != -1 )
 	{
 		internal_data_chunk->chunk_data = chunk_data;
@@ -587,6 +599,48 @@ ssize_t libewf_data_chunk_write_buffer(
 	}
 	internal_data_chunk->data_size = buffer_size;
 
+	if( internal_data_chunk->digest_data != NULL )
+	{
+		memory_free(
+		 internal_data_chunk->digest_data );
+
+		internal_data_chunk->digest_data = NULL;
+	}
+	/* Keep a copy of the unpacked data since the media digests are calculated
+	 * when the data chunk is written, after packing
+	 */
+	if( ( internal_data_chunk->write_io_handle->media_digests != NULL )
+	 && ( buffer_size > 0 ) )
+	{
+		internal_data_chunk->digest_data = (uint8_t *) memory_allocate(
+		                                                sizeof( uint8_t ) * buffer_size );
+
+		if( internal_data_chunk->digest_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create digest data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_data_chunk->digest_data,
+		     buffer,
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer to digest data.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libewf_chunk_data_pack(
 	     internal_data_chunk->chunk_data,
 	     internal_data_chunk->io_handle,
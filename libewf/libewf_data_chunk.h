@@ -57,6 +57,10 @@ struct libewf_internal_data_chunk
 	 */
 	libewf_chunk_data_t *chunk_data;
 
+	/* A copy of the unpacked data used to calculate the media digests
+	 */
+	uint8_t *digest_data;
+
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -0,0 +1,756 @@
+/*
+ * Encryption context functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_encryption_context.h"
+#include "libewf_libcaes.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+
+/* Creates an encryption context
+ * Make sure the value encryption_context is referencing, is set to NULL
+ * The key size is in bytes and should be 16, 24 or 32
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_encryption_context_initialize(
+     libewf_encryption_context_t **encryption_context,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_encryption_context_initialize";
+
+	if( encryption_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *encryption_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid encryption context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_size != 16 )
+	 && ( key_size != 24 )
+	 && ( key_size != 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported key size.",
+		 function );
+
+		return( -1 );
+	}
+	*encryption_context = memory_allocate_structure(
+	                       libewf_encryption_context_t );
+
+	if( *encryption_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create encryption context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *encryption_context,
+	     0,
+	     sizeof( libewf_encryption_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear encryption context.",
+		 function );
+
+		memory_free(
+		 *encryption_context );
+
+		*encryption_context = NULL;
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( *encryption_context )->key,
+	     key,
+	     key_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key.",
+		 function );
+
+		goto on_error;
+	}
+	( *encryption_context )->key_size = key_size;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *encryption_context )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *encryption_context != NULL )
+	{
+		memory_set(
+		 ( *encryption_context )->key,
+		 0,
+		 32 );
+
+		memory_free(
+		 *encryption_context );
+
+		*encryption_context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an encryption context
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_encryption_context_free(
+     libewf_encryption_context_t **encryption_context,
+     libcerror_error_t **error )
+{
+	static char *function    = "libewf_encryption_context_free";
+	int cipher_context_index = 0;
+	int result               = 1;
+
+	if( encryption_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *encryption_context != NULL )
+	{
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *encryption_context )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		for( cipher_context_index = 0;
+		     cipher_context_index < ( *encryption_context )->number_of_cipher_contexts;
+		     cipher_context_index++ )
+		{
+			if( libcaes_context_free(
+			     &( ( *encryption_context )->cipher_contexts[ cipher_context_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free cipher context: %d.",
+				 function,
+				 cipher_context_index );
+
+				result = -1;
+			}
+		}
+		/* Make sure the key is no longer in memory
+		 */
+		if( memory_set(
+		     ( *encryption_context )->key,
+		     0,
+		     32 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear key.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *encryption_context );
+
+		*encryption_context = NULL;
+	}
+	return( result );
+}
+
+/* Clones the encryption context
+ * The unused cipher contexts are not cloned
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_encryption_context_clone(
+     libewf_encryption_context_t **destination_encryption_context,
+     libewf_encryption_context_t *source_encryption_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_encryption_context_clone";
+
+	if( destination_encryption_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination encryption context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_encryption_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination encryption context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_encryption_context == NULL )
+	{
+		*destination_encryption_context = NULL;
+
+		return( 1 );
+	}
+	if( libewf_encryption_context_initialize(
+	     destination_encryption_context,
+	     source_encryption_context->key,
+	     source_encryption_context->key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination encryption context.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( *destination_encryption_context )->initialization_vector,
+	     source_encryption_context->initialization_vector,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy initialization vector.",
+		 function );
+
+		libewf_encryption_context_free(
+		 destination_encryption_context,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the initialization vector
+ * The initialization vector consists of 0-byte values by default
+ * This function is not multi-thread safe, set the initialization vector before decrypting data
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_encryption_context_set_initialization_vector(
+     libewf_encryption_context_t *encryption_context,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_encryption_context_set_initialization_vector";
+
+	if( encryption_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption context.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialization_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initialization vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialization_vector_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported initialization vector size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     encryption_context->initialization_vector,
+	     initialization_vector,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy initialization vector.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Grabs a cipher context
+ * An unused cipher context is reused if available otherwise a new cipher context is created
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_encryption_context_grab_cipher_context(
+     libewf_encryption_context_t *encryption_context,
+     libcaes_context_t **cipher_context,
+     libcerror_error_t **error )
+{
+	libcaes_context_t *safe_cipher_context = NULL;
+	static char *function                  = "libewf_encryption_context_grab_cipher_context";
+
+	if( encryption_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption context.",
+		 function );
+
+		return( -1 );
+	}
+	if( cipher_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     encryption_context->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( encryption_context->number_of_cipher_contexts > 0 )
+	{
+		encryption_context->number_of_cipher_contexts -= 1;
+
+		safe_cipher_context = encryption_context->cipher_contexts[ encryption_context->number_of_cipher_contexts ];
+
+		encryption_context->cipher_contexts[ encryption_context->number_of_cipher_contexts ] = NULL;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     encryption_context->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( safe_cipher_context == NULL )
+	{
+		/* The key is expanded outside of the mutex since this is relatively expensive
+		 */
+		if( libcaes_context_initialize(
+		     &safe_cipher_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create cipher context.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcaes_context_set_key(
+		     safe_cipher_context,
+		     LIBCAES_CRYPT_MODE_DECRYPT,
+		     encryption_context->key,
+		     encryption_context->key_size * 8,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set key in cipher context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*cipher_context = safe_cipher_context;
+
+	return( 1 );
+
+on_error:
+	if( safe_cipher_context != NULL )
+	{
+		libcaes_context_free(
+		 &safe_cipher_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Releases a cipher context
+ * The cipher context is kept for reuse or freed if the maximum number of unused cipher contexts was reached
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_encryption_context_release_cipher_context(
+     libewf_encryption_context_t *encryption_context,
+     libcaes_context_t **cipher_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_encryption_context_release_cipher_context";
+
+	if( encryption_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cipher_context == NULL )
+	 || ( *cipher_context == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     encryption_context->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( encryption_context->number_of_cipher_contexts < LIBEWF_ENCRYPTION_CONTEXT_MAXIMUM_NUMBER_OF_CIPHER_CONTEXTS )
+	{
+		encryption_context->cipher_contexts[ encryption_context->number_of_cipher_contexts ] = *cipher_context;
+
+		encryption_context->number_of_cipher_contexts += 1;
+
+		*cipher_context = NULL;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     encryption_context->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( *cipher_context != NULL )
+	{
+		if( libcaes_context_free(
+		     cipher_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cipher context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Decrypts data
+ * The data is encrypted using AES in cipher block chaining (CBC) mode, where the data
+ * of every section and chunk is decrypted starting with the initialization vector
+ * of the encryption context
+ * The input data size must be a multiple of 16
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_encryption_context_decrypt(
+     libewf_encryption_context_t *encryption_context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t initialization_vector[ 16 ];
+
+	libcaes_context_t *cipher_context = NULL;
+	static char *function             = "libewf_encryption_context_decrypt";
+
+	if( encryption_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption context.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_data_size == 0 )
+	 || ( input_data_size > (size_t) SSIZE_MAX )
+	 || ( ( input_data_size % 16 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data_size < input_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid output data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The initialization vector is copied so that the decryption does not depend
+	 * on how the cipher handles the initialization vector it is passed
+	 */
+	if( memory_copy(
+	     initialization_vector,
+	     encryption_context->initialization_vector,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy initialization vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_encryption_context_grab_cipher_context(
+	     encryption_context,
+	     &cipher_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab cipher context.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcaes_crypt_cbc(
+	     cipher_context,
+	     LIBCAES_CRYPT_MODE_DECRYPT,
+	     initialization_vector,
+	     16,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     input_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+		 "%s: unable to decrypt data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_encryption_context_release_cipher_context(
+	     encryption_context,
+	     &cipher_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release cipher context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( cipher_context != NULL )
+	{
+		libcaes_context_free(
+		 &cipher_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
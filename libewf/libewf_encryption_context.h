@@ -0,0 +1,119 @@
+/*
+ * Encryption context functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_ENCRYPTION_CONTEXT_H )
+#define _LIBEWF_ENCRYPTION_CONTEXT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcaes.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of unused cipher contexts that are kept for reuse
+ */
+#define LIBEWF_ENCRYPTION_CONTEXT_MAXIMUM_NUMBER_OF_CIPHER_CONTEXTS	16
+
+typedef struct libewf_encryption_context libewf_encryption_context_t;
+
+/* The encryption context provides decryption of encrypted (EWF2) section and chunk data
+ * A cipher context cannot be used by multiple threads at the same time, hence
+ * every decryption grabs its own cipher context from the unused cipher contexts
+ */
+struct libewf_encryption_context
+{
+	/* The key
+	 */
+	uint8_t key[ 32 ];
+
+	/* The key size
+	 */
+	size_t key_size;
+
+	/* The initialization vector
+	 */
+	uint8_t initialization_vector[ 16 ];
+
+	/* The unused cipher contexts
+	 */
+	libcaes_context_t *cipher_contexts[ LIBEWF_ENCRYPTION_CONTEXT_MAXIMUM_NUMBER_OF_CIPHER_CONTEXTS ];
+
+	/* The number of unused cipher contexts
+	 */
+	int number_of_cipher_contexts;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libewf_encryption_context_initialize(
+     libewf_encryption_context_t **encryption_context,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error );
+
+int libewf_encryption_context_free(
+     libewf_encryption_context_t **encryption_context,
+     libcerror_error_t **error );
+
+int libewf_encryption_context_clone(
+     libewf_encryption_context_t **destination_encryption_context,
+     libewf_encryption_context_t *source_encryption_context,
+     libcerror_error_t **error );
+
+int libewf_encryption_context_set_initialization_vector(
+     libewf_encryption_context_t *encryption_context,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     libcerror_error_t **error );
+
+int libewf_encryption_context_grab_cipher_context(
+     libewf_encryption_context_t *encryption_context,
+     libcaes_context_t **cipher_context,
+     libcerror_error_t **error );
+
+int libewf_encryption_context_release_cipher_context(
+     libewf_encryption_context_t *encryption_context,
+     libcaes_context_t **cipher_context,
+     libcerror_error_t **error );
+
+int libewf_encryption_context_decrypt(
+     libewf_encryption_context_t *encryption_context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_ENCRYPTION_CONTEXT_H ) */
+
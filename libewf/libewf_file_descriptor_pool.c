@@ -0,0 +1,1608 @@
+/*
+ * File descriptor pool functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libewf_definitions.h"
+#include "libewf_file_descriptor_pool.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+
+/* Creates a file descriptor pool
+ * Make sure the value file_descriptor_pool is referencing, is set to NULL
+ * The file descriptors are opened on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_file_descriptor_pool_initialize(
+     libewf_file_descriptor_pool_t **file_descriptor_pool,
+     char * const filenames[],
+     int number_of_filenames,
+     int maximum_number_of_open_file_descriptors,
+     libcerror_error_t **error )
+{
+	libewf_file_descriptor_pool_entry_t *entry = NULL;
+	static char *function                      = "libewf_file_descriptor_pool_initialize";
+	size_t filename_length                     = 0;
+	int entry_index                            = 0;
+	int stripe_index                           = 0;
+
+	if( file_descriptor_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_descriptor_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file descriptor pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_filenames <= 0 )
+	 || ( (size_t) number_of_filenames > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libewf_file_descriptor_pool_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of filenames value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_file_descriptors < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open file descriptors value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*file_descriptor_pool = memory_allocate_structure(
+	                         libewf_file_descriptor_pool_t );
+
+	if( *file_descriptor_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file descriptor pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_descriptor_pool,
+	     0,
+	     sizeof( libewf_file_descriptor_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file descriptor pool.",
+		 function );
+
+		memory_free(
+		 *file_descriptor_pool );
+
+		*file_descriptor_pool = NULL;
+
+		return( -1 );
+	}
+	( *file_descriptor_pool )->entries = (libewf_file_descriptor_pool_entry_t *) memory_allocate(
+	                                      sizeof( libewf_file_descriptor_pool_entry_t ) * number_of_filenames );
+
+	if( ( *file_descriptor_pool )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *file_descriptor_pool )->entries,
+	     0,
+	     sizeof( libewf_file_descriptor_pool_entry_t ) * number_of_filenames ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		memory_free(
+		 ( *file_descriptor_pool )->entries );
+
+		( *file_descriptor_pool )->entries = NULL;
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_filenames;
+	     entry_index++ )
+	{
+		entry = &( ( *file_descriptor_pool )->entries[ entry_index ] );
+
+		entry->file_descriptor      = -1;
+		entry->previous_entry_index = -1;
+		entry->next_entry_index     = -1;
+
+		( *file_descriptor_pool )->number_of_entries += 1;
+
+		if( filenames[ entry_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid filename: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		filename_length = narrow_string_length(
+		                   filenames[ entry_index ] );
+
+		entry->filename = narrow_string_allocate(
+		                   filename_length + 1 );
+
+		if( entry->filename == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filename: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( narrow_string_copy(
+		     entry->filename,
+		     filenames[ entry_index ],
+		     filename_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy filename: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		entry->filename[ filename_length ] = 0;
+	}
+	if( libewf_file_descriptor_pool_divide_maximum_number_of_open_file_descriptors(
+	     *file_descriptor_pool,
+	     maximum_number_of_open_file_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to divide maximum number of open file descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	for( stripe_index = 0;
+	     stripe_index < LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES;
+	     stripe_index++ )
+	{
+		( *file_descriptor_pool )->stripes[ stripe_index ].first_entry_index = -1;
+		( *file_descriptor_pool )->stripes[ stripe_index ].last_entry_index  = -1;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_initialize(
+		     &( ( *file_descriptor_pool )->stripes[ stripe_index ].mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create stripe: %d mutex.",
+			 function,
+			 stripe_index );
+
+			goto on_error;
+		}
+#endif
+	}
+	return( 1 );
+
+on_error:
+	if( *file_descriptor_pool != NULL )
+	{
+		libewf_file_descriptor_pool_free(
+		 file_descriptor_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a file descriptor pool
+ * Closes the open file descriptors
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_file_descriptor_pool_free(
+     libewf_file_descriptor_pool_t **file_descriptor_pool,
+     libcerror_error_t **error )
+{
+	libewf_file_descriptor_pool_entry_t *entry = NULL;
+	static char *function                      = "libewf_file_descriptor_pool_free";
+	int entry_index                            = 0;
+	int result                                 = 1;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	int stripe_index                           = 0;
+#endif
+
+	if( file_descriptor_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_descriptor_pool != NULL )
+	{
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		for( stripe_index = 0;
+		     stripe_index < LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES;
+		     stripe_index++ )
+		{
+			if( ( *file_descriptor_pool )->stripes[ stripe_index ].mutex != NULL )
+			{
+				if( libcthreads_mutex_free(
+				     &( ( *file_descriptor_pool )->stripes[ stripe_index ].mutex ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free stripe: %d mutex.",
+					 function,
+					 stripe_index );
+
+					result = -1;
+				}
+			}
+		}
+#endif
+		if( ( *file_descriptor_pool )->entries != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *file_descriptor_pool )->number_of_entries;
+			     entry_index++ )
+			{
+				entry = &( ( *file_descriptor_pool )->entries[ entry_index ] );
+
+#if defined( HAVE_LIBEWF_FILE_DESCRIPTOR_POOL )
+				if( entry->file_descriptor != -1 )
+				{
+					if( close(
+					     entry->file_descriptor ) != 0 )
+					{
+						libcerror_system_set_error(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+						 errno,
+						 "%s: unable to close file descriptor of entry: %d.",
+						 function,
+						 entry_index );
+
+						result = -1;
+					}
+					entry->file_descriptor = -1;
+				}
+#endif
+				if( entry->filename != NULL )
+				{
+					memory_free(
+					 entry->filename );
+				}
+			}
+			memory_free(
+			 ( *file_descriptor_pool )->entries );
+		}
+		memory_free(
+		 *file_descriptor_pool );
+
+		*file_descriptor_pool = NULL;
+	}
+	return( result );
+}
+
+/* Divides the maximum number of open file descriptors over the stripes
+ * A maximum less than the number of stripes uses one stripe per file descriptor
+ * so that the pool never holds more than the maximum number of open file descriptors
+ * This function is not multi-thread safe acquire the stripe mutexes before call
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_file_descriptor_pool_divide_maximum_number_of_open_file_descriptors(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int maximum_number_of_open_file_descriptors,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_file_descriptor_pool_divide_maximum_number_of_open_file_descriptors";
+	int stripe_index      = 0;
+
+	if( file_descriptor_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_file_descriptors < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open file descriptors value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_open_file_descriptors > 0 )
+	 && ( maximum_number_of_open_file_descriptors < LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES ) )
+	{
+		file_descriptor_pool->number_of_stripes = maximum_number_of_open_file_descriptors;
+	}
+	else
+	{
+		file_descriptor_pool->number_of_stripes = LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES;
+	}
+	file_descriptor_pool->maximum_number_of_open_file_descriptors = maximum_number_of_open_file_descriptors;
+
+	for( stripe_index = 0;
+	     stripe_index < LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES;
+	     stripe_index++ )
+	{
+		if( ( maximum_number_of_open_file_descriptors == 0 )
+		 || ( stripe_index >= file_descriptor_pool->number_of_stripes ) )
+		{
+			file_descriptor_pool->stripes[ stripe_index ].maximum_number_of_open_file_descriptors = 0;
+		}
+		else
+		{
+			/* The remainder is divided over the first stripes
+			 */
+			file_descriptor_pool->stripes[ stripe_index ].maximum_number_of_open_file_descriptors = maximum_number_of_open_file_descriptors / file_descriptor_pool->number_of_stripes;
+
+			if( stripe_index < ( maximum_number_of_open_file_descriptors % file_descriptor_pool->number_of_stripes ) )
+			{
+				file_descriptor_pool->stripes[ stripe_index ].maximum_number_of_open_file_descriptors += 1;
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the maximum number of open file descriptors
+ * The file descriptors that are not in use are closed and the entries that are
+ * in use are moved to the stripes of the new division
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_file_descriptor_pool_set_maximum_number_of_open_file_descriptors(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int maximum_number_of_open_file_descriptors,
+     libcerror_error_t **error )
+{
+	libewf_file_descriptor_pool_entry_t *entry   = NULL;
+	libewf_file_descriptor_pool_stripe_t *stripe = NULL;
+	static char *function                        = "libewf_file_descriptor_pool_set_maximum_number_of_open_file_descriptors";
+	int entry_index                              = 0;
+	int result                                   = 1;
+	int stripe_index                             = 0;
+
+	if( file_descriptor_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_file_descriptors < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open file descriptors value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The stripe mutexes are always grabbed in the same order
+	 */
+	for( stripe_index = 0;
+	     stripe_index < LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES;
+	     stripe_index++ )
+	{
+		if( libcthreads_mutex_grab(
+		     file_descriptor_pool->stripes[ stripe_index ].mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab stripe: %d mutex.",
+			 function,
+			 stripe_index );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( libewf_file_descriptor_pool_divide_maximum_number_of_open_file_descriptors(
+	     file_descriptor_pool,
+	     maximum_number_of_open_file_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to divide maximum number of open file descriptors.",
+		 function );
+
+		result = -1;
+	}
+	if( result == 1 )
+	{
+		for( stripe_index = 0;
+		     stripe_index < LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES;
+		     stripe_index++ )
+		{
+			file_descriptor_pool->stripes[ stripe_index ].number_of_open_file_descriptors = 0;
+			file_descriptor_pool->stripes[ stripe_index ].first_entry_index               = -1;
+			file_descriptor_pool->stripes[ stripe_index ].last_entry_index                = -1;
+		}
+		for( entry_index = 0;
+		     entry_index < file_descriptor_pool->number_of_entries;
+		     entry_index++ )
+		{
+			entry = &( file_descriptor_pool->entries[ entry_index ] );
+
+			entry->previous_entry_index = -1;
+			entry->next_entry_index     = -1;
+
+			if( entry->file_descriptor == -1 )
+			{
+				continue;
+			}
+#if defined( HAVE_LIBEWF_FILE_DESCRIPTOR_POOL )
+			if( entry->number_of_readers == 0 )
+			{
+				if( close(
+				     entry->file_descriptor ) != 0 )
+				{
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+					 errno,
+					 "%s: unable to close file descriptor of entry: %d.",
+					 function,
+					 entry_index );
+
+					result = -1;
+				}
+				entry->file_descriptor = -1;
+
+				continue;
+			}
+#endif
+			/* A file descriptor that is in use is never closed, it is closed
+			 * when it is the least recently used after it has been released
+			 */
+			stripe = &( file_descriptor_pool->stripes[ entry_index % file_descriptor_pool->number_of_stripes ] );
+
+			entry->previous_entry_index = stripe->last_entry_index;
+
+			if( stripe->last_entry_index != -1 )
+			{
+				file_descriptor_pool->entries[ stripe->last_entry_index ].next_entry_index = entry_index;
+			}
+			else
+			{
+				stripe->first_entry_index = entry_index;
+			}
+			stripe->last_entry_index = entry_index;
+
+			stripe->number_of_open_file_descriptors += 1;
+		}
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	for( stripe_index = LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES - 1;
+	     stripe_index >= 0;
+	     stripe_index-- )
+	{
+		if( libcthreads_mutex_release(
+		     file_descriptor_pool->stripes[ stripe_index ].mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release stripe: %d mutex.",
+			 function,
+			 stripe_index );
+
+			result = -1;
+		}
+	}
+#endif
+	return( result );
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+on_error:
+	while( stripe_index > 0 )
+	{
+		stripe_index--;
+
+		libcthreads_mutex_release(
+		 file_descriptor_pool->stripes[ stripe_index ].mutex,
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
+/* Retrieves the number of open file descriptors
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_file_descriptor_pool_get_number_of_open_file_descriptors(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int *number_of_open_file_descriptors,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_file_descriptor_pool_get_number_of_open_file_descriptors";
+	int stripe_index      = 0;
+
+	if( file_descriptor_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_open_file_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of open file descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_open_file_descriptors = 0;
+
+	for( stripe_index = 0;
+	     stripe_index < LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES;
+	     stripe_index++ )
+	{
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     file_descriptor_pool->stripes[ stripe_index ].mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab stripe: %d mutex.",
+			 function,
+			 stripe_index );
+
+			return( -1 );
+		}
+#endif
+		*number_of_open_file_descriptors += file_descriptor_pool->stripes[ stripe_index ].number_of_open_file_descriptors;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     file_descriptor_pool->stripes[ stripe_index ].mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release stripe: %d mutex.",
+			 function,
+			 stripe_index );
+
+			return( -1 );
+		}
+#endif
+	}
+	return( 1 );
+}
+
+/* Grabs the stripe of a specific entry
+ * The stripe of an entry changes when the maximum number of open file descriptors
+ * is set, in which case the stripe is grabbed again
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_file_descriptor_pool_grab_stripe(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int entry_index,
+     libewf_file_descriptor_pool_stripe_t **stripe,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_file_descriptor_pool_grab_stripe";
+	int number_of_stripes = 0;
+
+	if( file_descriptor_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= file_descriptor_pool->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( stripe == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stripe.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		number_of_stripes = file_descriptor_pool->number_of_stripes;
+
+		*stripe = &( file_descriptor_pool->stripes[ entry_index % number_of_stripes ] );
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     ( *stripe )->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab stripe mutex.",
+			 function );
+
+			*stripe = NULL;
+
+			return( -1 );
+		}
+		if( number_of_stripes != file_descriptor_pool->number_of_stripes )
+		{
+			if( libcthreads_mutex_release(
+			     ( *stripe )->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release stripe mutex.",
+				 function );
+
+				*stripe = NULL;
+
+				return( -1 );
+			}
+		}
+#endif
+	}
+	while( number_of_stripes != file_descriptor_pool->number_of_stripes );
+
+	return( 1 );
+}
+
+/* Grabs the file descriptor of a specific entry
+ * The file descriptor is opened if necessary and the least recently used file descriptor
+ * of the stripe is closed when the maximum number of open file descriptors is reached
+ * The file descriptor remains valid until it is released
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_file_descriptor_pool_grab_file_descriptor(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int entry_index,
+     int *file_descriptor,
+     libcerror_error_t **error )
+{
+	libewf_file_descriptor_pool_entry_t *entry       = NULL;
+	libewf_file_descriptor_pool_entry_t *lru_entry   = NULL;
+	libewf_file_descriptor_pool_stripe_t *stripe     = NULL;
+	static char *function                            = "libewf_file_descriptor_pool_grab_file_descriptor";
+	int lru_entry_index                              = 0;
+	int open_flags                                   = 0;
+
+	if( file_descriptor_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= file_descriptor_pool->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( file_descriptor_pool->entries[ entry_index ] );
+
+	if( libewf_file_descriptor_pool_grab_stripe(
+	     file_descriptor_pool,
+	     entry_index,
+	     &stripe,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab stripe of entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( entry->file_descriptor == -1 )
+	{
+#if defined( HAVE_LIBEWF_FILE_DESCRIPTOR_POOL )
+		/* Close the least recently used file descriptors that are not in use
+		 * until the stripe is below its maximum, the stripe can be above its
+		 * maximum after the maximum was lowered while file descriptors were in use
+		 */
+		while( ( stripe->maximum_number_of_open_file_descriptors > 0 )
+		    && ( stripe->number_of_open_file_descriptors >= stripe->maximum_number_of_open_file_descriptors ) )
+		{
+			lru_entry_index = stripe->last_entry_index;
+
+			while( lru_entry_index != -1 )
+			{
+				lru_entry = &( file_descriptor_pool->entries[ lru_entry_index ] );
+
+				if( lru_entry->number_of_readers == 0 )
+				{
+					break;
+				}
+				lru_entry_index = lru_entry->previous_entry_index;
+			}
+			if( lru_entry_index == -1 )
+			{
+				break;
+			}
+			else
+			{
+				if( lru_entry->previous_entry_index != -1 )
+				{
+					file_descriptor_pool->entries[ lru_entry->previous_entry_index ].next_entry_index = lru_entry->next_entry_index;
+				}
+				else
+				{
+					stripe->first_entry_index = lru_entry->next_entry_index;
+				}
+				if( lru_entry->next_entry_index != -1 )
+				{
+					file_descriptor_pool->entries[ lru_entry->next_entry_index ].previous_entry_index = lru_entry->previous_entry_index;
+				}
+				else
+				{
+					stripe->last_entry_index = lru_entry->previous_entry_index;
+				}
+				lru_entry->previous_entry_index = -1;
+				lru_entry->next_entry_index     = -1;
+
+				if( close(
+				     lru_entry->file_descriptor ) != 0 )
+				{
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+					 errno,
+					 "%s: unable to close file descriptor of entry: %d.",
+					 function,
+					 lru_entry_index );
+
+					lru_entry->file_descriptor = -1;
+
+					stripe->number_of_open_file_descriptors -= 1;
+
+					goto on_error;
+				}
+				lru_entry->file_descriptor = -1;
+
+				stripe->number_of_open_file_descriptors -= 1;
+			}
+		}
+		open_flags = O_RDONLY;
+
+#if defined( O_CLOEXEC )
+		open_flags |= O_CLOEXEC;
+#endif
+		entry->file_descriptor = open(
+		                          entry->filename,
+		                          open_flags );
+
+		if( entry->file_descriptor == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open file: %s.",
+			 function,
+			 entry->filename );
+
+			goto on_error;
+		}
+		stripe->number_of_open_file_descriptors += 1;
+
+		/* The access advice is only a hint so failure to apply it is ignored
+		 */
+		if( file_descriptor_pool->access_advice != LIBEWF_ACCESS_ADVICE_NORMAL )
+		{
+			libewf_file_descriptor_pool_apply_access_advice(
+			 entry->file_descriptor,
+			 0,
+			 0,
+			 file_descriptor_pool->access_advice,
+			 NULL );
+		}
+#else
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: file descriptor pool not supported.",
+		 function );
+
+		goto on_error;
+#endif
+	}
+	else if( stripe->first_entry_index != entry_index )
+	{
+		/* Unlink the entry so that it can be moved to the front of the stripe
+		 */
+		file_descriptor_pool->entries[ entry->previous_entry_index ].next_entry_index = entry->next_entry_index;
+
+		if( entry->next_entry_index != -1 )
+		{
+			file_descriptor_pool->entries[ entry->next_entry_index ].previous_entry_index = entry->previous_entry_index;
+		}
+		else
+		{
+			stripe->last_entry_index = entry->previous_entry_index;
+		}
+		entry->previous_entry_index = -1;
+		entry->next_entry_index     = -1;
+	}
+	if( stripe->first_entry_index != entry_index )
+	{
+		entry->next_entry_index = stripe->first_entry_index;
+
+		if( stripe->first_entry_index != -1 )
+		{
+			file_descriptor_pool->entries[ stripe->first_entry_index ].previous_entry_index = entry_index;
+		}
+		stripe->first_entry_index = entry_index;
+
+		if( stripe->last_entry_index == -1 )
+		{
+			stripe->last_entry_index = entry_index;
+		}
+	}
+	entry->number_of_readers += 1;
+
+	*file_descriptor = entry->file_descriptor;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     stripe->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release stripe mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 stripe->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Releases the file descriptor of a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_file_descriptor_pool_release_file_descriptor(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libewf_file_descriptor_pool_entry_t *entry   = NULL;
+	libewf_file_descriptor_pool_stripe_t *stripe = NULL;
+	static char *function                        = "libewf_file_descriptor_pool_release_file_descriptor";
+	int result                                   = 1;
+
+	if( file_descriptor_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= file_descriptor_pool->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( file_descriptor_pool->entries[ entry_index ] );
+
+	if( libewf_file_descriptor_pool_grab_stripe(
+	     file_descriptor_pool,
+	     entry_index,
+	     &stripe,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab stripe of entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( entry->number_of_readers <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry: %d - number of readers value out of bounds.",
+		 function,
+		 entry_index );
+
+		result = -1;
+	}
+	else
+	{
+		entry->number_of_readers -= 1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     stripe->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release stripe mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads a buffer at a specific offset from the file of a specific entry
+ * The read does not change a file offset and does not hold the stripe lock
+ * so that concurrent reads do not serialize
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libewf_file_descriptor_pool_read_buffer_at_offset(
+         libewf_file_descriptor_pool_t *file_descriptor_pool,
+         int entry_index,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libewf_file_descriptor_pool_read_buffer_at_offset";
+	size_t buffer_offset  = 0;
+	ssize_t read_count    = 0;
+	int file_descriptor   = -1;
+
+	if( file_descriptor_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_file_descriptor_pool_grab_file_descriptor(
+	     file_descriptor_pool,
+	     entry_index,
+	     &file_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file descriptor of entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_FILE_DESCRIPTOR_POOL )
+	while( buffer_offset < size )
+	{
+		read_count = pread(
+		              file_descriptor,
+		              &( buffer[ buffer_offset ] ),
+		              size - buffer_offset,
+		              (off_t) ( offset + buffer_offset ) );
+
+		if( read_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read from file descriptor of entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset += (size_t) read_count;
+	}
+#endif
+	if( libewf_file_descriptor_pool_release_file_descriptor(
+	     file_descriptor_pool,
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file descriptor of entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( (ssize_t) buffer_offset );
+
+#if defined( HAVE_LIBEWF_FILE_DESCRIPTOR_POOL )
+on_error:
+	libewf_file_descriptor_pool_release_file_descriptor(
+	 file_descriptor_pool,
+	 entry_index,
+	 NULL );
+
+	return( -1 );
+#endif
+}
+
+/* Applies access advice to a range of a file descriptor
+ * A size of 0 represents the range up to the end of the file
+ * The advice is forwarded to the operating system if supported
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_file_descriptor_pool_apply_access_advice(
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     int access_advice,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_file_descriptor_pool_apply_access_advice";
+
+#if defined( HAVE_POSIX_FADVISE )
+	int posix_advice      = POSIX_FADV_NORMAL;
+	int result            = 0;
+#endif
+
+	if( file_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file descriptor value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_advice != LIBEWF_ACCESS_ADVICE_NORMAL )
+	 && ( access_advice != LIBEWF_ACCESS_ADVICE_SEQUENTIAL )
+	 && ( access_advice != LIBEWF_ACCESS_ADVICE_RANDOM )
+	 && ( access_advice != LIBEWF_ACCESS_ADVICE_WILLNEED )
+	 && ( access_advice != LIBEWF_ACCESS_ADVICE_DONTNEED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access advice.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_POSIX_FADVISE )
+	switch( access_advice )
+	{
+		case LIBEWF_ACCESS_ADVICE_SEQUENTIAL:
+			posix_advice = POSIX_FADV_SEQUENTIAL;
+			break;
+
+		case LIBEWF_ACCESS_ADVICE_RANDOM:
+			posix_advice = POSIX_FADV_RANDOM;
+			break;
+
+		case LIBEWF_ACCESS_ADVICE_WILLNEED:
+			posix_advice = POSIX_FADV_WILLNEED;
+			break;
+
+		case LIBEWF_ACCESS_ADVICE_DONTNEED:
+			posix_advice = POSIX_FADV_DONTNEED;
+			break;
+
+		default:
+			break;
+	}
+	/* posix_fadvise returns an error number instead of setting errno
+	 */
+	result = posix_fadvise(
+	          file_descriptor,
+	          (off_t) offset,
+	          (off_t) size,
+	          posix_advice );
+
+	if( result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 result,
+		 "%s: unable to apply access advice to file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the access advice
+ * The access advice is applied to the open file descriptors and
+ * to the file descriptors that are opened afterwards
+ * Only the normal, sequential and random access advice are supported
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_file_descriptor_pool_set_access_advice(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int access_advice,
+     libcerror_error_t **error )
+{
+	libewf_file_descriptor_pool_entry_t *entry = NULL;
+	static char *function                      = "libewf_file_descriptor_pool_set_access_advice";
+	int entry_index                            = 0;
+	int stripe_index                           = 0;
+
+	if( file_descriptor_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_advice != LIBEWF_ACCESS_ADVICE_NORMAL )
+	 && ( access_advice != LIBEWF_ACCESS_ADVICE_SEQUENTIAL )
+	 && ( access_advice != LIBEWF_ACCESS_ADVICE_RANDOM ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access advice.",
+		 function );
+
+		return( -1 );
+	}
+	for( stripe_index = 0;
+	     stripe_index < LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES;
+	     stripe_index++ )
+	{
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     file_descriptor_pool->stripes[ stripe_index ].mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab stripe: %d mutex.",
+			 function,
+			 stripe_index );
+
+			return( -1 );
+		}
+#endif
+		if( stripe_index == 0 )
+		{
+			file_descriptor_pool->access_advice = access_advice;
+		}
+		for( entry_index = file_descriptor_pool->stripes[ stripe_index ].first_entry_index;
+		     entry_index != -1;
+		     entry_index = entry->next_entry_index )
+		{
+			entry = &( file_descriptor_pool->entries[ entry_index ] );
+
+			/* The access advice is only a hint so failure to apply it is ignored
+			 */
+			libewf_file_descriptor_pool_apply_access_advice(
+			 entry->file_descriptor,
+			 0,
+			 0,
+			 access_advice,
+			 NULL );
+		}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     file_descriptor_pool->stripes[ stripe_index ].mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release stripe: %d mutex.",
+			 function,
+			 stripe_index );
+
+			return( -1 );
+		}
+#endif
+	}
+	return( 1 );
+}
+
+/* Advises the operating system about the expected access of a range of the file of a specific entry
+ * Only the will need and do not need access advice are supported
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_file_descriptor_pool_advise_range(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int entry_index,
+     off64_t offset,
+     size64_t size,
+     int access_advice,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_file_descriptor_pool_advise_range";
+	int file_descriptor   = -1;
+
+	if( file_descriptor_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_advice != LIBEWF_ACCESS_ADVICE_WILLNEED )
+	 && ( access_advice != LIBEWF_ACCESS_ADVICE_DONTNEED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access advice.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_file_descriptor_pool_grab_file_descriptor(
+	     file_descriptor_pool,
+	     entry_index,
+	     &file_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file descriptor of entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( libewf_file_descriptor_pool_apply_access_advice(
+	     file_descriptor,
+	     offset,
+	     size,
+	     access_advice,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to apply access advice to file descriptor of entry: %d.",
+		 function,
+		 entry_index );
+
+		goto on_error;
+	}
+	if( libewf_file_descriptor_pool_release_file_descriptor(
+	     file_descriptor_pool,
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file descriptor of entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libewf_file_descriptor_pool_release_file_descriptor(
+	 file_descriptor_pool,
+	 entry_index,
+	 NULL );
+
+	return( -1 );
+}
+
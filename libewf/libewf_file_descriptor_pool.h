@@ -0,0 +1,206 @@
+/*
+ * File descriptor pool functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_FILE_DESCRIPTOR_POOL_H )
+#define _LIBEWF_FILE_DESCRIPTOR_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_OPEN ) && defined( HAVE_CLOSE ) && defined( HAVE_PREAD ) && !defined( WINAPI )
+#define HAVE_LIBEWF_FILE_DESCRIPTOR_POOL
+#endif
+
+/* The number of stripes the file descriptor pool entries are divided over
+ */
+#define LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES	16
+
+typedef struct libewf_file_descriptor_pool_entry libewf_file_descriptor_pool_entry_t;
+
+struct libewf_file_descriptor_pool_entry
+{
+	/* The filename
+	 */
+	char *filename;
+
+	/* The file descriptor or -1 if not open
+	 */
+	int file_descriptor;
+
+	/* The number of reads in progress that use the file descriptor
+	 */
+	int number_of_readers;
+
+	/* The index of the previous (more recently used) entry in the stripe
+	 */
+	int previous_entry_index;
+
+	/* The index of the next (less recently used) entry in the stripe
+	 */
+	int next_entry_index;
+};
+
+typedef struct libewf_file_descriptor_pool_stripe libewf_file_descriptor_pool_stripe_t;
+
+struct libewf_file_descriptor_pool_stripe
+{
+	/* The number of open file descriptors
+	 */
+	int number_of_open_file_descriptors;
+
+	/* The index of the most recently used entry
+	 */
+	int first_entry_index;
+
+	/* The index of the least recently used entry
+	 */
+	int last_entry_index;
+
+	/* The maximum number of open file descriptors
+	 * 0 represents no maximum
+	 */
+	int maximum_number_of_open_file_descriptors;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+typedef struct libewf_file_descriptor_pool libewf_file_descriptor_pool_t;
+
+/* The file descriptor pool provides positional (pread) read access to
+ * the segment files of a read-only handle. The entries are divided over
+ * lock stripes so that reads of different segment files do not contend
+ */
+struct libewf_file_descriptor_pool
+{
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The entries
+	 */
+	libewf_file_descriptor_pool_entry_t *entries;
+
+	/* The maximum number of open file descriptors
+	 * 0 represents no maximum
+	 */
+	int maximum_number_of_open_file_descriptors;
+
+	/* The number of stripes in use
+	 */
+	int number_of_stripes;
+
+	/* The access advice that is applied to newly opened file descriptors
+	 */
+	int access_advice;
+
+	/* The stripes
+	 */
+	libewf_file_descriptor_pool_stripe_t stripes[ LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES ];
+};
+
+int libewf_file_descriptor_pool_initialize(
+     libewf_file_descriptor_pool_t **file_descriptor_pool,
+     char * const filenames[],
+     int number_of_filenames,
+     int maximum_number_of_open_file_descriptors,
+     libcerror_error_t **error );
+
+int libewf_file_descriptor_pool_free(
+     libewf_file_descriptor_pool_t **file_descriptor_pool,
+     libcerror_error_t **error );
+
+int libewf_file_descriptor_pool_divide_maximum_number_of_open_file_descriptors(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int maximum_number_of_open_file_descriptors,
+     libcerror_error_t **error );
+
+int libewf_file_descriptor_pool_set_maximum_number_of_open_file_descriptors(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int maximum_number_of_open_file_descriptors,
+     libcerror_error_t **error );
+
+int libewf_file_descriptor_pool_get_number_of_open_file_descriptors(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int *number_of_open_file_descriptors,
+     libcerror_error_t **error );
+
+int libewf_file_descriptor_pool_grab_stripe(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int entry_index,
+     libewf_file_descriptor_pool_stripe_t **stripe,
+     libcerror_error_t **error );
+
+int libewf_file_descriptor_pool_grab_file_descriptor(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int entry_index,
+     int *file_descriptor,
+     libcerror_error_t **error );
+
+int libewf_file_descriptor_pool_release_file_descriptor(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int entry_index,
+     libcerror_error_t **error );
+
+ssize_t libewf_file_descriptor_pool_read_buffer_at_offset(
+         libewf_file_descriptor_pool_t *file_descriptor_pool,
+         int entry_index,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libewf_file_descriptor_pool_apply_access_advice(
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     int access_advice,
+     libcerror_error_t **error );
+
+int libewf_file_descriptor_pool_set_access_advice(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int access_advice,
+     libcerror_error_t **error );
+
+int libewf_file_descriptor_pool_advise_range(
+     libewf_file_descriptor_pool_t *file_descriptor_pool,
+     int entry_index,
+     off64_t offset,
+     size64_t size,
+     int access_advice,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_FILE_DESCRIPTOR_POOL_H ) */
+
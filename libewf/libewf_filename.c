@@ -228,6 +228,160 @@ int libewf_filename_set_extension(
 	return( 1 );
 }
 
+/* Retrieves the segment number from an extension
+ * Using the format specific naming schema
+ * The extension should not contain the leading dot
+ * Returns 1 if successful, 0 if the extension does not match the naming schema or -1 on error
+ */
+int libewf_filename_get_segment_number(
+     const char *extension,
+     size_t extension_length,
+     uint8_t segment_file_type,
+     uint8_t format,
+     uint32_t *segment_number,
+     libcerror_error_t **error )
+{
+	static char *function           = "libewf_filename_get_segment_number";
+	size_t string_index             = 0;
+	uint32_t maximum_segment_number = 0;
+	uint32_t safe_segment_number    = 0;
+	char additional_characters      = 0;
+	char first_character            = 0;
+	char variable_character         = 0;
+
+	if( extension == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment number.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format == LIBEWF_FORMAT_EWF )
+	 || ( format == LIBEWF_FORMAT_EWFX ) )
+	{
+		first_character       = 'e';
+		additional_characters = 'a';
+	}
+	else if( ( segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF1 )
+	      || ( segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF2 ) )
+	{
+		first_character       = 'E';
+		additional_characters = 'A';
+	}
+	else if( ( segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF1_LOGICAL )
+	      || ( segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF2_LOGICAL ) )
+	{
+		first_character       = 'L';
+		additional_characters = 'A';
+	}
+	else if( segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF1_SMART )
+	{
+		first_character       = 's';
+		additional_characters = 'a';
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported segment file type.",
+		 function );
+
+		return( -1 );
+	}
+	/* The character that is incremented for segment numbers of 100 and above
+	 * is the first character for EWF1 and the 'x' for EWF2
+	 */
+	if( ( segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF2 )
+	 || ( segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF2_LOGICAL ) )
+	{
+		if( extension_length != 4 )
+		{
+			return( 0 );
+		}
+		if( extension[ 0 ] != first_character )
+		{
+			return( 0 );
+		}
+		string_index           = 1;
+		variable_character     = 'x';
+		maximum_segment_number = 2;
+	}
+	else
+	{
+		if( extension_length != 3 )
+		{
+			return( 0 );
+		}
+		string_index           = 0;
+		variable_character     = first_character;
+		maximum_segment_number = 25;
+	}
+	if( ( extension[ string_index + 1 ] >= '0' )
+	 && ( extension[ string_index + 1 ] <= '9' )
+	 && ( extension[ string_index + 2 ] >= '0' )
+	 && ( extension[ string_index + 2 ] <= '9' ) )
+	{
+		if( extension[ string_index ] != variable_character )
+		{
+			return( 0 );
+		}
+		safe_segment_number = (uint32_t) ( extension[ string_index + 1 ] - '0' ) * 10
+		                    + (uint32_t) ( extension[ string_index + 2 ] - '0' );
+
+		if( safe_segment_number == 0 )
+		{
+			return( 0 );
+		}
+	}
+	else if( ( extension[ string_index + 1 ] >= additional_characters )
+	      && ( extension[ string_index + 1 ] <= ( additional_characters + 25 ) )
+	      && ( extension[ string_index + 2 ] >= additional_characters )
+	      && ( extension[ string_index + 2 ] <= ( additional_characters + 25 ) ) )
+	{
+		/* Note that libewf_filename_set_extension does not generate the characters between 'Z' and 'a'
+		 */
+		if( ( extension[ string_index ] < variable_character )
+		 || ( (uint32_t) ( extension[ string_index ] - variable_character ) > maximum_segment_number )
+		 || ( extension[ string_index ] > 'z' )
+		 || ( ( extension[ string_index ] > 'Z' )
+		  &&  ( extension[ string_index ] < 'a' ) ) )
+		{
+			return( 0 );
+		}
+		safe_segment_number = (uint32_t) ( extension[ string_index ] - variable_character );
+
+		safe_segment_number *= 26;
+		safe_segment_number += (uint32_t) ( extension[ string_index + 1 ] - additional_characters );
+		safe_segment_number *= 26;
+		safe_segment_number += (uint32_t) ( extension[ string_index + 2 ] - additional_characters );
+		safe_segment_number += 100;
+	}
+	else
+	{
+		return( 0 );
+	}
+	*segment_number = safe_segment_number;
+
+	return( 1 );
+}
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 /* Sets the extension for a certain segment file
@@ -42,6 +42,14 @@ int libewf_filename_set_extension(
      uint8_t format,
      libcerror_error_t **error );
 
+int libewf_filename_get_segment_number(
+     const char *extension,
+     size_t extension_length,
+     uint8_t segment_file_type,
+     uint8_t format,
+     uint32_t *segment_number,
+     libcerror_error_t **error );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 int libewf_filename_set_extension_wide(
@@ -26,11 +26,15 @@
 #include <wide_string.h>
 
 #include "libewf_analytical_data.h"
+#include "libewf_async_reader.h"
+#include "libewf_block_hashes.h"
 #include "libewf_case_data.h"
 #include "libewf_case_data_section.h"
 #include "libewf_chunk_data.h"
+#include "libewf_chunk_locations.h"
 #include "libewf_chunk_table.h"
 #include "libewf_codepage.h"
+#include "libewf_compressed_chunk_cache.h"
 #include "libewf_compression.h"
 #include "libewf_data_chunk.h"
 #include "libewf_debug.h"
@@ -38,13 +42,16 @@
 #include "libewf_device_information.h"
 #include "libewf_device_information_section.h"
 #include "libewf_digest_section.h"
+#include "libewf_encryption_context.h"
 #include "libewf_error2_section.h"
+#include "libewf_file_descriptor_pool.h"
 #include "libewf_file_entry.h"
 #include "libewf_handle.h"
 #include "libewf_hash_sections.h"
 #include "libewf_hash_values.h"
 #include "libewf_header_sections.h"
 #include "libewf_header_values.h"
+#include "libewf_integrity_scan.h"
 #include "libewf_io_handle.h"
 #include "libewf_lef_file_entry.h"
 #include "libewf_libbfio.h"
@@ -57,6 +64,8 @@
 #include "libewf_libfvalue.h"
 #include "libewf_ltree_section.h"
 #include "libewf_md5_hash_section.h"
+#include "libewf_media_digests.h"
+#include "libewf_persistent_cache.h"
 #include "libewf_restart_data.h"
 #include "libewf_section.h"
 #include "libewf_section_descriptor.h"
@@ -65,6 +74,8 @@
 #include "libewf_segment_file.h"
 #include "libewf_session_section.h"
 #include "libewf_sha1_hash_section.h"
+#include "libewf_shared_chunk_cache.h"
+#include "libewf_shared_metadata.h"
 #include "libewf_single_file_tree.h"
 #include "libewf_single_files.h"
 #include "libewf_types.h"
@@ -236,8 +247,9 @@ int libewf_handle_initialize(
 		goto on_error;
 	}
 #endif
-	internal_handle->date_format                    = LIBEWF_DATE_FORMAT_CTIME;
-	internal_handle->maximum_number_of_open_handles = LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES;
+	internal_handle->date_format                      = LIBEWF_DATE_FORMAT_CTIME;
+	internal_handle->maximum_number_of_open_handles   = LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES;
+	internal_handle->number_of_integrity_scan_threads = LIBEWF_INTEGRITY_SCAN_NUMBER_OF_THREADS;
 
 	*handle = (libewf_handle_t *) internal_handle;
 
@@ -425,6 +437,27 @@ int libewf_handle_free(
 
 			result = -1;
 		}
+		if( internal_handle->encryption_context != NULL )
+		{
+			if( libewf_encryption_context_free(
+			     &( internal_handle->encryption_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free encryption context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_handle->persistent_cache_directory != NULL )
+		{
+			memory_free(
+			 internal_handle->persistent_cache_directory );
+		}
 		memory_free(
 		 internal_handle );
 	}
@@ -439,9 +472,9 @@ int libewf_handle_clone(
      libewf_handle_t *source_handle,
      libcerror_error_t **error )
 {
-	libewf_internal_handle_t *internal_destination_handle = NULL;
-	libewf_internal_handle_t *internal_source_handle      = NULL;
-	static char *function                                 = "libewf_handle_clone";
+	libewf_internal_handle_t *internal_source_handle = NULL;
+	static char *function                            = "libewf_handle_clone";
+	int result                                       = 0;
 
 	if( destination_handle == NULL )
 	{
@@ -484,7 +517,7 @@ int libewf_handle_clone(
 
 		return( -1 );
 	}
-	if( ( internal_source_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_READ ) != 0 )
+	if( ( internal_source_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_WRITE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -495,153 +528,516 @@ int libewf_handle_clone(
 
 		return( -1 );
 	}
-	internal_destination_handle = memory_allocate_structure(
-			               libewf_internal_handle_t );
-
-	if( internal_destination_handle == NULL )
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_source_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create destination handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     internal_destination_handle,
-	     0,
-	     sizeof( libewf_internal_handle_t ) ) == NULL )
+#endif
+	result = libewf_internal_handle_clone(
+	          destination_handle,
+	          internal_source_handle,
+	          0,
+	          error );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear destination handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clone handle.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	if( libewf_io_handle_clone(
-	     &( internal_destination_handle->io_handle ),
-	     internal_source_handle->io_handle,
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_source_handle->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create destination IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		if( *destination_handle != NULL )
+		{
+			libewf_handle_free(
+			 destination_handle,
+			 NULL );
+		}
+		return( -1 );
 	}
-	if( libewf_media_values_clone(
-	     &( internal_destination_handle->media_values ),
-	     internal_source_handle->media_values,
-	     error ) != 1 )
+#endif
+	return( result );
+}
+
+/* Clones the handle sharing the immutable metadata with the source handle
+ * The header values, hash values, hash sections, single files and chunk locations
+ * are reference counted and shared, the clone has its own IO handle, file IO pool,
+ * segment table and chunk caches
+ * The source handle must be opened for reading only
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_clone_shared(
+     libewf_handle_t **destination_handle,
+     libewf_handle_t *source_handle,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_source_handle = NULL;
+	static char *function                            = "libewf_handle_clone_shared";
+	int result                                       = 0;
+
+	if( destination_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create destination media values.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination handle value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_array_clone(
-	     &( internal_destination_handle->sessions ),
-	     internal_source_handle->sessions,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_sector_range_free,
-	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libewf_sector_range_clone,
-	     error ) != 1 )
+	if( source_handle == NULL )
+	{
+		*destination_handle = NULL;
+
+		return( 1 );
+	}
+	internal_source_handle = (libewf_internal_handle_t *) source_handle;
+
+	if( internal_source_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create destination sessions array.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source handle - missing IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_array_clone(
-	     &( internal_destination_handle->tracks ),
-	     internal_source_handle->tracks,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_sector_range_free,
-	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libewf_sector_range_clone,
+	if( ( internal_source_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_source_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_source_handle->read_write_lock,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libewf_internal_handle_clone(
+	          destination_handle,
+	          internal_source_handle,
+	          1,
+	          error );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create destination tracks array.",
+		 "%s: unable to clone handle.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	if( libcdata_range_list_clone(
-	     &( internal_destination_handle->acquiry_errors ),
-	     internal_source_handle->acquiry_errors,
-	     NULL,
-	     NULL,
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_source_handle->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create destination acquiry errors range list.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		if( *destination_handle != NULL )
+		{
+			libewf_handle_free(
+			 destination_handle,
+			 NULL );
+		}
+		return( -1 );
 	}
-	if( internal_source_handle->file_io_pool != NULL )
+#endif
+	return( result );
+}
+
+/* Moves the immutable metadata of the handle into shared metadata
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_share_metadata(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_internal_handle_share_metadata";
+
+	if( internal_handle == NULL )
 	{
-		if( libbfio_pool_clone(
-		     &( internal_destination_handle->file_io_pool ),
-		     internal_source_handle->file_io_pool,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing chunk table.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->shared_metadata != NULL )
+	{
+		return( 1 );
+	}
+	/* Parse the hash values so that the shared hash values are not changed afterwards
+	 */
+	if( internal_handle->hash_values_parsed == 0 )
+	{
+		if( libewf_internal_handle_parse_hash_values(
+		     internal_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create destination file IO pool.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to parse hash values.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		internal_destination_handle->file_io_pool_created_in_library = 1;
+		internal_handle->hash_values_parsed = 1;
 	}
-	if( internal_source_handle->read_io_handle != NULL )
+	if( ( internal_handle->chunk_table->chunk_locations == NULL )
+	 && ( internal_handle->media_values->number_of_chunks > 0 ) )
 	{
-		if( libewf_read_io_handle_clone(
-		     &( internal_destination_handle->read_io_handle ),
-		     internal_source_handle->read_io_handle,
+		if( libewf_chunk_locations_initialize(
+		     &( internal_handle->chunk_table->chunk_locations ),
+		     internal_handle->media_values->number_of_chunks,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create destination read IO handle.",
+			 "%s: unable to create chunk locations.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( internal_source_handle->write_io_handle != NULL )
+	if( libewf_shared_metadata_initialize(
+	     &( internal_handle->shared_metadata ),
+	     error ) != 1 )
 	{
-		if( libewf_write_io_handle_clone(
-		     &( internal_destination_handle->write_io_handle ),
-		     internal_source_handle->write_io_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create shared metadata.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->shared_metadata->hash_sections        = internal_handle->hash_sections;
+	internal_handle->shared_metadata->header_values        = internal_handle->header_values;
+	internal_handle->shared_metadata->hash_values          = internal_handle->hash_values;
+	internal_handle->shared_metadata->single_files         = internal_handle->single_files;
+	internal_handle->shared_metadata->chunk_locations      = internal_handle->chunk_table->chunk_locations;
+	internal_handle->shared_metadata->file_descriptor_pool = internal_handle->file_descriptor_pool;
+
+	internal_handle->chunk_table->chunk_locations_is_shared = 1;
+
+	return( 1 );
+}
+
+/* Clones the handle
+ * If share_metadata is set the immutable metadata is shared with the source handle
+ * This function is not multi-thread safe acquire write lock on the source handle before call
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_clone(
+     libewf_handle_t **destination_handle,
+     libewf_internal_handle_t *internal_source_handle,
+     uint8_t share_metadata,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_destination_handle = NULL;
+	static char *function                                 = "libewf_internal_handle_clone";
+
+	if( destination_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_source_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_destination_handle = memory_allocate_structure(
+			               libewf_internal_handle_t );
+
+	if( internal_destination_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_destination_handle,
+	     0,
+	     sizeof( libewf_internal_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear destination handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( share_metadata != 0 )
+	{
+		if( libewf_internal_handle_share_metadata(
+		     internal_source_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to share source metadata.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libewf_io_handle_clone(
+	     &( internal_destination_handle->io_handle ),
+	     internal_source_handle->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_media_values_clone(
+	     &( internal_destination_handle->media_values ),
+	     internal_source_handle->media_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination media values.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_clone(
+	     &( internal_destination_handle->sessions ),
+	     internal_source_handle->sessions,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_sector_range_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libewf_sector_range_clone,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination sessions array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_clone(
+	     &( internal_destination_handle->tracks ),
+	     internal_source_handle->tracks,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_sector_range_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libewf_sector_range_clone,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination tracks array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_range_list_clone(
+	     &( internal_destination_handle->acquiry_errors ),
+	     internal_source_handle->acquiry_errors,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination acquiry errors range list.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_source_handle->file_io_pool != NULL )
+	{
+		if( libbfio_pool_clone(
+		     &( internal_destination_handle->file_io_pool ),
+		     internal_source_handle->file_io_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination file IO pool.",
+			 function );
+
+			goto on_error;
+		}
+		internal_destination_handle->file_io_pool_created_in_library = 1;
+	}
+	if( internal_source_handle->read_io_handle != NULL )
+	{
+		if( libewf_read_io_handle_clone(
+		     &( internal_destination_handle->read_io_handle ),
+		     internal_source_handle->read_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination read IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_source_handle->write_io_handle != NULL )
+	{
+		if( libewf_write_io_handle_clone(
+		     &( internal_destination_handle->write_io_handle ),
+		     internal_source_handle->write_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
@@ -651,6 +1047,13 @@ int libewf_handle_clone(
 			goto on_error;
 		}
 	}
+	/* The segment table is also cloned for a clone that shares the metadata.
+	 * Lookups modify its segment files cache and the chunk groups cached by
+	 * the segment files, and the chunk table keeps a reference to the current
+	 * chunk group between reads, which another handle could evict from a shared
+	 * cache. The clone only copies the segment file descriptors, the segment files
+	 * are read on demand and only when a chunk is not in the shared chunk locations
+	 */
 	if( libewf_segment_table_clone(
 	     &( internal_destination_handle->segment_table ),
 	     internal_source_handle->segment_table,
@@ -682,7 +1085,8 @@ int libewf_handle_clone(
 			goto on_error;
 		}
 	}
-	if( internal_source_handle->hash_sections != NULL )
+	if( ( share_metadata == 0 )
+	 && ( internal_source_handle->hash_sections != NULL ) )
 	{
 		if( libewf_hash_sections_clone(
 		     &( internal_destination_handle->hash_sections ),
@@ -699,7 +1103,8 @@ int libewf_handle_clone(
 			goto on_error;
 		}
 	}
-	if( internal_source_handle->header_values != NULL )
+	if( ( share_metadata == 0 )
+	 && ( internal_source_handle->header_values != NULL ) )
 	{
 		if( libfvalue_table_clone(
 		     &( internal_destination_handle->header_values ),
@@ -717,7 +1122,8 @@ int libewf_handle_clone(
 		}
 		internal_destination_handle->header_values_parsed = internal_source_handle->header_values_parsed;
 	}
-	if( internal_source_handle->hash_values != NULL )
+	if( ( share_metadata == 0 )
+	 && ( internal_source_handle->hash_values != NULL ) )
 	{
 		if( libfvalue_table_clone(
 		     &( internal_destination_handle->hash_values ),
@@ -735,37 +1141,171 @@ int libewf_handle_clone(
 		}
 		internal_destination_handle->hash_values_parsed = internal_source_handle->hash_values_parsed;
 	}
-	internal_destination_handle->maximum_number_of_open_handles = internal_source_handle->maximum_number_of_open_handles;
-	internal_destination_handle->date_format                    = internal_source_handle->date_format;
-
-	*destination_handle = (libewf_handle_t *) internal_destination_handle;
-
-	return( 1 );
-
-on_error:
-	if( internal_destination_handle != NULL )
+	if( ( internal_source_handle->block_hashes != NULL )
+	 && ( internal_source_handle->block_hashes->is_finalized != 0 ) )
 	{
-		if( internal_destination_handle->hash_values != NULL )
-		{
-			libfvalue_table_free(
-			 &( internal_destination_handle->hash_values ),
-			 NULL );
-		}
-		if( internal_destination_handle->header_values != NULL )
+		if( libewf_block_hashes_clone(
+		     &( internal_destination_handle->block_hashes ),
+		     internal_source_handle->block_hashes,
+		     error ) != 1 )
 		{
-			libfvalue_table_free(
-			 &( internal_destination_handle->header_values ),
-			 NULL );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination block hashes.",
+			 function );
+
+			goto on_error;
 		}
-		if( internal_destination_handle->hash_sections != NULL )
+	}
+	/* The IO handle clone contains the encryption context of the source handle
+	 */
+	internal_destination_handle->io_handle->encryption_context = NULL;
+
+	if( internal_source_handle->encryption_context != NULL )
+	{
+		if( libewf_encryption_context_clone(
+		     &( internal_destination_handle->encryption_context ),
+		     internal_source_handle->encryption_context,
+		     error ) != 1 )
 		{
-			libewf_hash_sections_free(
-			 &( internal_destination_handle->hash_sections ),
-			 NULL );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination encryption context.",
+			 function );
+
+			goto on_error;
 		}
-		if( internal_destination_handle->chunk_table != NULL )
-		{
-			libewf_chunk_table_free(
+		internal_destination_handle->io_handle->encryption_context = internal_destination_handle->encryption_context;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_destination_handle->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( share_metadata != 0 )
+	{
+		if( libewf_shared_metadata_grab_reference(
+		     internal_source_handle->shared_metadata,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab reference to shared metadata.",
+			 function );
+
+			goto on_error;
+		}
+		internal_destination_handle->shared_metadata      = internal_source_handle->shared_metadata;
+		internal_destination_handle->hash_sections        = internal_source_handle->shared_metadata->hash_sections;
+		internal_destination_handle->header_values        = internal_source_handle->shared_metadata->header_values;
+		internal_destination_handle->header_values_parsed = internal_source_handle->header_values_parsed;
+		internal_destination_handle->hash_values          = internal_source_handle->shared_metadata->hash_values;
+		internal_destination_handle->hash_values_parsed   = internal_source_handle->hash_values_parsed;
+		internal_destination_handle->single_files         = internal_source_handle->shared_metadata->single_files;
+		internal_destination_handle->file_descriptor_pool = internal_source_handle->shared_metadata->file_descriptor_pool;
+
+		if( internal_destination_handle->chunk_table != NULL )
+		{
+			internal_destination_handle->chunk_table->chunk_locations           = internal_source_handle->shared_metadata->chunk_locations;
+			internal_destination_handle->chunk_table->chunk_locations_is_shared = 1;
+			internal_destination_handle->chunk_table->file_descriptor_pool      = internal_source_handle->shared_metadata->file_descriptor_pool;
+		}
+	}
+	/* The shared chunk cache is keyed by the compressed chunk data and has its own lock,
+	 * so chunk data unpacked by a clone, e.g. a prefetch worker, is available to the source handle
+	 */
+	if( ( share_metadata != 0 )
+	 && ( internal_source_handle->shared_chunk_cache != NULL ) )
+	{
+		if( libewf_shared_chunk_cache_get_reference(
+		     internal_source_handle->shared_chunk_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to retrieve reference to shared chunk cache.",
+			 function );
+
+			goto on_error;
+		}
+		internal_destination_handle->shared_chunk_cache = internal_source_handle->shared_chunk_cache;
+
+		if( internal_destination_handle->chunk_table != NULL )
+		{
+			internal_destination_handle->chunk_table->shared_chunk_cache = internal_source_handle->shared_chunk_cache;
+		}
+	}
+	internal_destination_handle->maximum_number_of_open_handles   = internal_source_handle->maximum_number_of_open_handles;
+	internal_destination_handle->number_of_integrity_scan_threads = internal_source_handle->number_of_integrity_scan_threads;
+	internal_destination_handle->date_format                      = internal_source_handle->date_format;
+	internal_destination_handle->access_advice                    = internal_source_handle->access_advice;
+
+	*destination_handle = (libewf_handle_t *) internal_destination_handle;
+
+	return( 1 );
+
+on_error:
+	if( internal_destination_handle != NULL )
+	{
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( internal_destination_handle->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_destination_handle->read_write_lock ),
+			 NULL );
+		}
+#endif
+		if( internal_destination_handle->encryption_context != NULL )
+		{
+			libewf_encryption_context_free(
+			 &( internal_destination_handle->encryption_context ),
+			 NULL );
+		}
+		if( internal_destination_handle->block_hashes != NULL )
+		{
+			libewf_block_hashes_free(
+			 &( internal_destination_handle->block_hashes ),
+			 NULL );
+		}
+		if( internal_destination_handle->hash_values != NULL )
+		{
+			libfvalue_table_free(
+			 &( internal_destination_handle->hash_values ),
+			 NULL );
+		}
+		if( internal_destination_handle->header_values != NULL )
+		{
+			libfvalue_table_free(
+			 &( internal_destination_handle->header_values ),
+			 NULL );
+		}
+		if( internal_destination_handle->hash_sections != NULL )
+		{
+			libewf_hash_sections_free(
+			 &( internal_destination_handle->hash_sections ),
+			 NULL );
+		}
+		if( internal_destination_handle->chunk_table != NULL )
+		{
+			libewf_chunk_table_free(
 			 &( internal_destination_handle->chunk_table ),
 			 NULL );
 		}
@@ -833,6 +1373,7 @@ on_error:
 }
 
 /* Signals the handle to abort its current activity
+ * This also cancels the asynchronous read requests that were not started
  * Returns 1 if successful or -1 on error
  */
 int libewf_handle_signal_abort(
@@ -868,6 +1409,22 @@ int libewf_handle_signal_abort(
 	}
 	internal_handle->io_handle->abort = 1;
 
+	if( internal_handle->async_reader != NULL )
+	{
+		if( libewf_async_reader_signal_abort(
+		     internal_handle->async_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal asynchronous reader to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -883,16 +1440,20 @@ int libewf_handle_open(
      int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle          = NULL;
-	libbfio_pool_t *file_io_pool              = NULL;
-	libewf_internal_handle_t *internal_handle = NULL;
-	char *first_segment_filename              = NULL;
-	static char *function                     = "libewf_handle_open";
-	size_t filename_length                    = 0;
-	int file_io_pool_entry                    = 0;
-	int filename_index                        = 0;
-	int maximum_number_of_open_handles        = 0;
-	int result                                = 0;
+	libbfio_handle_t *file_io_handle                    = NULL;
+	libbfio_pool_t *file_io_pool                        = NULL;
+	libewf_file_descriptor_pool_t *file_descriptor_pool = NULL;
+	libewf_internal_handle_t *internal_handle           = NULL;
+	char *first_segment_filename                        = NULL;
+	static char *function                               = "libewf_handle_open";
+	size_t filename_length                              = 0;
+	int file_io_pool_entry                              = 0;
+	int filename_index                                  = 0;
+	int maximum_number_of_file_descriptors              = 0;
+	int maximum_number_of_file_io_pool_handles          = 0;
+	int maximum_number_of_open_handles                  = 0;
+	int result                                          = 0;
+	int use_file_descriptor_pool                        = 0;
 
 	if( handle == NULL )
 	{
@@ -973,11 +1534,36 @@ int libewf_handle_open(
 
 		return( -1 );
 	}
+#endif
+	maximum_number_of_file_io_pool_handles = maximum_number_of_open_handles;
+
+#if defined( HAVE_LIBEWF_FILE_DESCRIPTOR_POOL )
+	if( ( ( access_flags & LIBEWF_ACCESS_FLAG_READ ) != 0 )
+	 && ( ( access_flags & LIBEWF_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		use_file_descriptor_pool = libewf_internal_handle_divide_maximum_number_of_open_handles(
+		                            maximum_number_of_open_handles,
+		                            &maximum_number_of_file_io_pool_handles,
+		                            &maximum_number_of_file_descriptors,
+		                            error );
+
+		if( use_file_descriptor_pool == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to divide maximum number of open handles.",
+			 function );
+
+			goto on_error;
+		}
+	}
 #endif
 	if( libbfio_pool_initialize(
 	     &file_io_pool,
 	     0,
-	     maximum_number_of_open_handles,
+	     maximum_number_of_file_io_pool_handles,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1154,6 +1740,31 @@ int libewf_handle_open(
 			goto on_error;
 		}
 	}
+#if defined( HAVE_LIBEWF_FILE_DESCRIPTOR_POOL )
+	/* Read-only handles read the chunk data using positional reads
+	 * on file descriptors that can be shared between threads
+	 */
+	if( use_file_descriptor_pool != 0 )
+	{
+		if( libewf_file_descriptor_pool_initialize(
+		     &file_descriptor_pool,
+		     filenames,
+		     number_of_filenames,
+		     maximum_number_of_file_descriptors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file descriptor pool.",
+			 function );
+
+			goto on_error;
+		}
+		file_descriptor_pool->access_advice = internal_handle->access_advice;
+	}
+#endif
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
@@ -1195,6 +1806,13 @@ int libewf_handle_open(
 	{
 		internal_handle->file_io_pool                    = file_io_pool;
 		internal_handle->file_io_pool_created_in_library = 1;
+		internal_handle->file_descriptor_pool            = file_descriptor_pool;
+
+		if( internal_handle->chunk_table != NULL )
+		{
+			internal_handle->chunk_table->file_descriptor_pool = file_descriptor_pool;
+		}
+		file_descriptor_pool = NULL;
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	result = libcthreads_read_write_lock_release_for_write(
@@ -1220,6 +1838,12 @@ int libewf_handle_open(
 	return( 1 );
 
 on_error:
+	if( file_descriptor_pool != NULL )
+	{
+		libewf_file_descriptor_pool_free(
+		 &file_descriptor_pool,
+		 NULL );
+	}
 	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
@@ -3358,13 +3982,17 @@ int libewf_internal_handle_open_file_io_pool(
      libewf_segment_table_t *segment_table,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle    = NULL;
-	libewf_segment_file_t *segment_file = NULL;
-	static char *function               = "libewf_internal_handle_open_file_io_pool";
-	size64_t segment_file_size          = 0;
-	ssize_t read_count                  = 0;
-	int file_io_pool_entry              = 0;
-	int number_of_file_io_handles       = 0;
+	libbfio_handle_t *file_io_handle                        = NULL;
+	libewf_compressed_chunk_cache_t *compressed_chunk_cache = NULL;
+	libewf_persistent_cache_t *persistent_cache             = NULL;
+	libewf_segment_file_t *segment_file                     = NULL;
+	libewf_shared_chunk_cache_t *shared_chunk_cache         = NULL;
+	static char *function                                   = "libewf_internal_handle_open_file_io_pool";
+	size64_t segment_file_size                              = 0;
+	ssize_t read_count                                      = 0;
+	int file_io_pool_entry                                  = 0;
+	int number_of_file_io_handles                           = 0;
+	int result                                              = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -3456,6 +4084,8 @@ int libewf_internal_handle_open_file_io_pool(
 
 		return( -1 );
 	}
+	internal_handle->io_handle->encryption_context = internal_handle->encryption_context;
+
 	if( ( ( access_flags & LIBEWF_ACCESS_FLAG_READ ) != 0 )
 	 || ( ( access_flags & LIBEWF_ACCESS_FLAG_RESUME ) != 0 ) )
 	{
@@ -3811,12 +4441,140 @@ int libewf_internal_handle_open_file_io_pool(
 			goto on_error;
 		}
 	}
+	if( ( ( access_flags & LIBEWF_ACCESS_FLAG_READ ) != 0 )
+	 && ( ( access_flags & LIBEWF_ACCESS_FLAG_WRITE ) == 0 )
+	 && ( internal_handle->maximum_compressed_chunk_cache_size > 0 )
+	 && ( internal_handle->media_values->chunk_size > 0 ) )
+	{
+		if( libewf_compressed_chunk_cache_initialize(
+		     &compressed_chunk_cache,
+		     internal_handle->media_values->chunk_size,
+		     internal_handle->maximum_compressed_chunk_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed chunk cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( ( access_flags & LIBEWF_ACCESS_FLAG_READ ) != 0 )
+	 && ( ( access_flags & LIBEWF_ACCESS_FLAG_WRITE ) == 0 )
+	 && ( internal_handle->use_shared_chunk_cache != 0 ) )
+	{
+		if( libewf_shared_chunk_cache_get_process_cache(
+		     &shared_chunk_cache,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve shared chunk cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( ( access_flags & LIBEWF_ACCESS_FLAG_READ ) != 0 )
+	 && ( ( access_flags & LIBEWF_ACCESS_FLAG_WRITE ) == 0 )
+	 && ( internal_handle->persistent_cache_directory != NULL )
+	 && ( internal_handle->media_values->chunk_size > 0 ) )
+	{
+		if( libewf_persistent_cache_initialize(
+		     &persistent_cache,
+		     internal_handle->media_values->chunk_size,
+		     internal_handle->maximum_persistent_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create persistent cache.",
+			 function );
+
+			goto on_error;
+		}
+		result = libewf_persistent_cache_open(
+		          persistent_cache,
+		          internal_handle->persistent_cache_directory,
+		          internal_handle->media_values->set_identifier,
+		          internal_handle->media_values->media_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open persistent cache.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			/* The persistent cache is not used if the segment file set
+			 * has no identifier or if its file is in use by another handle
+			 */
+			if( libewf_persistent_cache_free(
+			     &persistent_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free persistent cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		internal_handle->persistent_cache               = persistent_cache;
+		internal_handle->chunk_table->persistent_cache = persistent_cache;
+	}
+	if( compressed_chunk_cache != NULL )
+	{
+		internal_handle->compressed_chunk_cache               = compressed_chunk_cache;
+		internal_handle->chunk_table->compressed_chunk_cache = compressed_chunk_cache;
+	}
+	if( shared_chunk_cache != NULL )
+	{
+		internal_handle->shared_chunk_cache               = shared_chunk_cache;
+		internal_handle->chunk_table->shared_chunk_cache = shared_chunk_cache;
+	}
+	internal_handle->chunk_table->access_advice = internal_handle->access_advice;
 	internal_handle->io_handle->chunk_size   = internal_handle->media_values->chunk_size;
 	internal_handle->io_handle->access_flags = access_flags;
 
 	return( 1 );
 
 on_error:
+	if( persistent_cache != NULL )
+	{
+		libewf_persistent_cache_free(
+		 &persistent_cache,
+		 NULL );
+	}
+	if( shared_chunk_cache != NULL )
+	{
+		libewf_shared_chunk_cache_release(
+		 &shared_chunk_cache,
+		 NULL );
+	}
+	if( compressed_chunk_cache != NULL )
+	{
+		libewf_compressed_chunk_cache_free(
+		 &compressed_chunk_cache,
+		 NULL );
+	}
 	if( segment_file != NULL )
 	{
 		libewf_segment_file_free(
@@ -3999,6 +4757,25 @@ int libewf_handle_close(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
+	/* The asynchronous reader is freed before the read/write lock is grabbed
+	 * since it waits for the requests in flight, which grab the lock
+	 */
+	if( internal_handle->async_reader != NULL )
+	{
+		if( libewf_async_reader_free(
+		     &( internal_handle->async_reader ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free asynchronous reader.",
+			 function );
+
+			return( -1 );
+		}
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
@@ -4158,71 +4935,175 @@ int libewf_handle_close(
 			result = -1;
 		}
 	}
-	if( internal_handle->hash_sections != NULL )
+	if( internal_handle->shared_metadata != NULL )
 	{
-		if( libewf_hash_sections_free(
-		     &( internal_handle->hash_sections ),
+		/* The shared metadata values are freed when the last reference is released
+		 */
+		internal_handle->hash_sections        = NULL;
+		internal_handle->header_values        = NULL;
+		internal_handle->hash_values          = NULL;
+		internal_handle->single_files         = NULL;
+		internal_handle->file_descriptor_pool = NULL;
+
+		if( libewf_shared_metadata_release_reference(
+		     &( internal_handle->shared_metadata ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free hash sections.",
+			 "%s: unable to release reference to shared metadata.",
 			 function );
 
 			result = -1;
 		}
 	}
-	if( internal_handle->header_values != NULL )
+	if( internal_handle->file_descriptor_pool != NULL )
 	{
-		if( libfvalue_table_free(
-		     &( internal_handle->header_values ),
+		if( libewf_file_descriptor_pool_free(
+		     &( internal_handle->file_descriptor_pool ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free header values.",
+			 "%s: unable to free file descriptor pool.",
 			 function );
 
 			result = -1;
 		}
 	}
-	if( internal_handle->hash_values != NULL )
+	if( internal_handle->persistent_cache != NULL )
 	{
-		if( libfvalue_table_free(
-		     &( internal_handle->hash_values ),
+		if( libewf_persistent_cache_free(
+		     &( internal_handle->persistent_cache ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free hash values.",
+			 "%s: unable to free persistent cache.",
 			 function );
 
 			result = -1;
 		}
 	}
-	if( internal_handle->single_files != NULL )
+	if( internal_handle->compressed_chunk_cache != NULL )
 	{
-		if( libewf_single_files_free(
-		     &( internal_handle->single_files ),
+		if( libewf_compressed_chunk_cache_free(
+		     &( internal_handle->compressed_chunk_cache ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free single files.",
+			 "%s: unable to free compressed chunk cache.",
 			 function );
 
 			result = -1;
 		}
 	}
-	if( libcdata_array_empty(
+	if( internal_handle->shared_chunk_cache != NULL )
+	{
+		if( libewf_shared_chunk_cache_release(
+		     &( internal_handle->shared_chunk_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release shared chunk cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_handle->hash_sections != NULL )
+	{
+		if( libewf_hash_sections_free(
+		     &( internal_handle->hash_sections ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hash sections.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_handle->header_values != NULL )
+	{
+		if( libfvalue_table_free(
+		     &( internal_handle->header_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free header values.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_handle->hash_values != NULL )
+	{
+		if( libfvalue_table_free(
+		     &( internal_handle->hash_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hash values.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_handle->block_hashes != NULL )
+	{
+		if( libewf_block_hashes_free(
+		     &( internal_handle->block_hashes ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block hashes.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_handle->single_files != NULL )
+	{
+		if( libewf_single_files_free(
+		     &( internal_handle->single_files ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free single files.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcdata_array_empty(
 	     internal_handle->sessions,
 	     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_sector_range_free,
 	     error ) != 1 )
@@ -4713,6 +5594,170 @@ ssize_t libewf_handle_read_buffer_at_offset(
 	return( read_count );
 }
 
+/* Reads (media) data at a specific offset asynchronously
+ * The request is read by the read threads of the handle using shared clones of the handle,
+ * hence it does not change the current offset and the handle must be opened read-only
+ * The completion callback is called exactly once for every request that was queued,
+ * from a read thread or, without multi-thread support, before this function returns
+ * The completion callback is called with the number of bytes read and a result of 1
+ * if the data was read, 0 if the request was cancelled or -1 if the data could not be read
+ * The buffer must remain valid until the completion callback is called
+ * Requests are started in the order they are queued but can complete in any order,
+ * there is no ordering between overlapping requests
+ * The number of requests in flight is bounded, a request is in flight until just before
+ * its completion callback is called
+ * libewf_handle_signal_abort cancels the requests in flight that were not started
+ * libewf_handle_close waits for the requests in flight to complete, hence the completion
+ * callback should not close the handle
+ * Returns 1 if successful, 0 if the maximum number of requests in flight was reached or -1 on error
+ */
+int libewf_handle_read_async(
+     libewf_handle_t *handle,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     void (*callback)(
+            libewf_handle_t *handle,
+            off64_t offset,
+            void *buffer,
+            ssize_t read_count,
+            int result,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_read_async";
+	int number_of_threads                     = 0;
+	int result                                = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	number_of_threads = LIBEWF_ASYNC_READER_NUMBER_OF_THREADS;
+
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		result = -1;
+	}
+	else if( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: asynchronous reads are only supported in read-only mode.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_handle->async_reader == NULL )
+	{
+		if( libewf_async_reader_initialize(
+		     &( internal_handle->async_reader ),
+		     handle,
+		     number_of_threads,
+		     LIBEWF_ASYNC_READER_MAXIMUM_NUMBER_OF_REQUESTS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create asynchronous reader.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	/* The request is pushed without holding the read/write lock since
+	 * without multi-thread support it is read before the push returns
+	 */
+	result = libewf_async_reader_push_request(
+	          internal_handle->async_reader,
+	          offset,
+	          buffer,
+	          buffer_size,
+	          callback,
+	          callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push asynchronous read request.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Writes (media) data at the current offset from a buffer using a Basic File IO (bfio) pool
  * the necessary settings of the write values must have been made
  * Will initialize write if necessary
@@ -4994,6 +6039,25 @@ ssize_t libewf_internal_handle_write_buffer_to_file_io_pool(
 		{
 			input_data_size = internal_handle->chunk_data->data_size;
 
+			if( internal_handle->write_io_handle->media_digests != NULL )
+			{
+				if( libewf_media_digests_update(
+				     internal_handle->write_io_handle->media_digests,
+				     internal_handle->chunk_data->data,
+				     input_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to update media digests with chunk: %" PRIu64 " data.",
+					 function,
+					 chunk_index );
+
+					return( -1 );
+				}
+			}
 			if( libewf_chunk_data_pack(
 			     internal_handle->chunk_data,
 			     internal_handle->io_handle,
@@ -5826,6 +6890,36 @@ ssize_t libewf_internal_handle_write_data_chunk_to_file_io_pool(
 
 		return( -1 );
 	}
+	if( internal_handle->write_io_handle->media_digests != NULL )
+	{
+		if( internal_data_chunk->digest_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid data chunk - missing digest data.",
+			 function );
+
+			return( -1 );
+		}
+		if( libewf_media_digests_update_with_managed_data(
+		     internal_handle->write_io_handle->media_digests,
+		     &( internal_data_chunk->digest_data ),
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update media digests with chunk: %" PRIu64 " data.",
+			 function,
+			 current_chunk_index );
+
+			return( -1 );
+		}
+	}
 	write_count = libewf_write_io_handle_write_new_chunk(
 	               internal_handle->write_io_handle,
 	               internal_handle->io_handle,
@@ -5945,24 +7039,28 @@ ssize_t libewf_handle_write_data_chunk(
 	return( write_count );
 }
 
-/* Finalizes the write by correcting the EWF the meta data in the segment files
- * This function is required after write from stream
- * Returns the number of bytes written or -1 on error
+/* Writes a (media) data chunk that was read from another handle at the current offset
+ * The packed chunk data, such as the compressed data and its checksum, is written
+ * as stored in the segment file of the other handle, without being unpacked and packed again
+ * Only the checksum of uncompressed chunk data is validated, chunk data that does not match
+ * its checksum or cannot be stored as-is is unpacked and packed again
+ * When media digests are calculated the chunk data is unpacked to calculate them and packed again
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes written, 0 when no longer data can be written or -1 on error
  */
-ssize_t libewf_internal_handle_write_finalize_file_io_pool(
+ssize_t libewf_internal_handle_write_packed_data_chunk_to_file_io_pool(
          libewf_internal_handle_t *internal_handle,
          libbfio_pool_t *file_io_pool,
+         libewf_internal_data_chunk_t *internal_data_chunk,
          libcerror_error_t **error )
 {
-	libewf_segment_file_t *segment_file = NULL;
-	static char *function               = "libewf_internal_handle_write_finalize_file_io_pool";
-	size64_t segment_file_size          = 0;
-	size_t input_data_size              = 0;
-	ssize_t write_count                 = 0;
-	ssize_t write_finalize_count        = 0;
-	uint64_t chunk_index                = 0;
-	uint32_t number_of_segments         = 0;
-	int file_io_pool_entry              = -1;
+	libewf_chunk_data_t *chunk_data = NULL;
+	static char *function           = "libewf_internal_handle_write_packed_data_chunk_to_file_io_pool";
+	size_t data_size                = 0;
+	ssize_t write_count             = 0;
+	uint64_t current_chunk_index    = 0;
+	uint32_t corrupted_flag         = 0;
+	int result                      = 1;
 
 	if( internal_handle == NULL )
 	{
@@ -5986,39 +7084,24 @@ ssize_t libewf_internal_handle_write_finalize_file_io_pool(
 
 		return( -1 );
 	}
-	if( internal_handle->current_offset < 0 )
+	if( internal_handle->chunk_data != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid handle - invalid IO handle - current offset value out of bounds.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - chunk data set.",
+		 function );
 
 		return( -1 );
 	}
-	if( ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_READ ) != 0 )
-	 && ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_RESUME ) == 0 ) )
-	{
-		if( internal_handle->chunk_data != NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-			 "%s: invalid handle - chunk data set.",
-			 function );
-
-			return( -1 );
-		}
-	}
-	if( internal_handle->write_io_handle == NULL )
+	if( internal_handle->current_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing write IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid handle - invalid IO handle - current offset value out of bounds.",
 		 function );
 
 		return( -1 );
@@ -6045,340 +7128,2810 @@ ssize_t libewf_internal_handle_write_finalize_file_io_pool(
 
 		return( -1 );
 	}
-	if( internal_handle->write_io_handle->write_finalized != 0 )
+	if( internal_handle->write_io_handle == NULL )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing subhandle write.",
+		 function );
+
+		return( -1 );
 	}
-	if( ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_READ ) != 0 )
-	 && ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_RESUME ) == 0 ) )
+	if( internal_data_chunk == NULL )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data chunk.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_handle->chunk_data != NULL )
+	if( internal_data_chunk->io_handle == NULL )
 	{
-		chunk_index = internal_handle->current_offset / internal_handle->media_values->chunk_size;
-
-		if( chunk_index < internal_handle->write_io_handle->number_of_chunks_written )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-			 "%s: chunk: %" PRIu64 " already exists.",
-			 function,
-			 chunk_index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data chunk - missing IO handle.",
+		 function );
 
-			return( -1 );
-		}
-		input_data_size = internal_handle->chunk_data->data_size;
+		return( -1 );
+	}
+	chunk_data = internal_data_chunk->chunk_data;
 
-		if( libewf_chunk_data_pack(
-		     internal_handle->chunk_data,
-		     internal_handle->io_handle,
-		     internal_handle->write_io_handle->compressed_zero_byte_empty_block,
-		     internal_handle->write_io_handle->compressed_zero_byte_empty_block_size,
-		     internal_handle->write_io_handle->pack_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to pack chunk: %" PRIu64 " data.",
-			 function,
-			 chunk_index );
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data chunk - missing chunk data.",
+		 function );
 
-			return( -1 );
-		}
-		write_count = libewf_write_io_handle_write_new_chunk(
-			       internal_handle->write_io_handle,
-			       internal_handle->io_handle,
-			       file_io_pool,
-			       internal_handle->media_values,
-			       internal_handle->segment_table,
-			       internal_handle->header_values,
-			       internal_handle->hash_values,
-			       internal_handle->hash_sections,
-			       internal_handle->sessions,
-			       internal_handle->tracks,
-			       internal_handle->acquiry_errors,
-			       chunk_index,
-			       internal_handle->chunk_data,
-			       input_data_size,
-			       error );
+		return( -1 );
+	}
+	if( chunk_data->chunk_size != internal_handle->media_values->chunk_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid data chunk - chunk size value does not match media values.",
+		 function );
 
-		if( write_count <= 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write new chunk.",
-			 function );
+		return( -1 );
+	}
+	if( ( chunk_data->range_end_offset < chunk_data->range_start_offset )
+	 || ( ( chunk_data->range_end_offset - chunk_data->range_start_offset ) > (off64_t) chunk_data->chunk_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data chunk - invalid chunk data - range value out of bounds.",
+		 function );
 
-			return( -1 );
-		}
-		write_finalize_count += write_count;
+		return( -1 );
+	}
+	if( ( internal_handle->media_values->media_size != 0 )
+	 && ( (size64_t) internal_handle->current_offset >= internal_handle->media_values->media_size ) )
+	{
+		return( 0 );
+	}
+	data_size = (size_t) ( chunk_data->range_end_offset - chunk_data->range_start_offset );
 
-		if( libewf_chunk_data_free(
-		     &( internal_handle->chunk_data ),
-		     error ) != 1 )
+	if( internal_handle->media_values->media_size != 0 )
+	{
+		if( (size64_t) ( internal_handle->current_offset + data_size ) > internal_handle->media_values->media_size )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free chunk data.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: last data chunk size value out of bounds.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	/* Check if all media data has been written
-	 */
-	if( ( internal_handle->media_values->media_size != 0 )
-	 && ( internal_handle->write_io_handle->input_write_count < (ssize64_t) internal_handle->media_values->media_size ) )
+	current_chunk_index = internal_handle->current_offset / internal_handle->media_values->chunk_size;
+
+	internal_handle->current_offset = (off64_t) current_chunk_index * (off64_t) internal_handle->media_values->chunk_size;
+
+	if( chunk_data->chunk_index != current_chunk_index )
 	{
-		return( write_finalize_count );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data chunk - chunk: %" PRIu64 " does not match current chunk: %" PRIu64 ".",
+		 function,
+		 chunk_data->chunk_index,
+		 current_chunk_index );
+
+		return( -1 );
 	}
-	if( libewf_segment_table_get_number_of_segments(
-	     internal_handle->segment_table,
-	     &number_of_segments,
-	     error ) != 1 )
+	if( current_chunk_index < internal_handle->write_io_handle->number_of_chunks_written )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of segments.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: chunk: %" PRIu64 " already exists.",
+		 function,
+		 current_chunk_index );
 
 		return( -1 );
 	}
-	if( number_of_segments == 0 )
+	if( internal_handle->write_io_handle->values_initialized == 0 )
 	{
-		/* No segment file needs to be created
-		 */
-/* TODO clean up this logic: when is this triggered? */
-		if( internal_handle->media_values->media_size != 0 )
-		{
-			return( write_finalize_count );
-		}
-		/* Create the segment file if required
-		 */
-		if( libewf_write_io_handle_create_segment_file(
+		if( libewf_write_io_handle_initialize_values(
+		     internal_handle->write_io_handle,
 		     internal_handle->io_handle,
-		     file_io_pool,
+		     internal_handle->media_values,
 		     internal_handle->segment_table,
-		     internal_handle->io_handle->segment_file_type,
-		     0,
-		     internal_handle->write_io_handle->maximum_number_of_segments,
-		     internal_handle->media_values->set_identifier,
-		     &file_io_pool_entry,
-		     &segment_file,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to create segment file: 0.",
-			 function );
-
-			return( -1 );
-		}
-		write_count = libewf_segment_file_write_start(
-		               segment_file,
-		               file_io_pool,
-		               file_io_pool_entry,
-		               &( internal_handle->write_io_handle->case_data ),
-		               &( internal_handle->write_io_handle->case_data_size ),
-		               &( internal_handle->write_io_handle->device_information ),
-		               &( internal_handle->write_io_handle->device_information_size ),
-		               &( internal_handle->write_io_handle->data_section ),
-		               internal_handle->media_values,
-		               internal_handle->header_values,
-		               internal_handle->write_io_handle->timestamp,
-		               error );
-
-		if( write_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write segment file: 0 start.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize write IO handle values.",
 			 function );
 
 			return( -1 );
 		}
-		write_finalize_count += write_count;
 	}
-	/* Check if the last segment file is still open for writing
-	 */
-	else if( internal_handle->write_io_handle->current_segment_file != NULL )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		if( libewf_segment_table_get_segment_by_index(
-		     internal_handle->segment_table,
-		     internal_handle->write_io_handle->current_segment_number,
-		     &file_io_pool_entry,
-		     &segment_file_size,
-		     error ) != 1 )
+		libcnotify_printf(
+		 "%s: writing packed chunk: %" PRIu64 " of size: %" PRIzd ".\n",
+		 function,
+		 current_chunk_index,
+		 data_size );
+	}
+#endif
+	if( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_PACKED ) != 0 )
+	{
+		/* The packed chunk data can only be written as-is if it is stored
+		 * in the same way in the segment files of both handles, the media
+		 * digests are calculated over the unpacked chunk data
+		 */
+		if( ( internal_handle->write_io_handle->media_digests != NULL )
+		 || ( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_ENCRYPTED ) != 0 )
+		 || ( internal_data_chunk->io_handle->segment_file_type != internal_handle->io_handle->segment_file_type )
+		 || ( internal_data_chunk->io_handle->compression_method != internal_handle->io_handle->compression_method ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve segment: %" PRIu32 " from segment table.",
-			 function,
-			 internal_handle->write_io_handle->current_segment_number );
+			result = 0;
+		}
+		else if( ( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_COMPRESSED ) == 0 )
+		      && ( ( internal_handle->write_io_handle->pack_flags & LIBEWF_PACK_FLAG_FORCE_COMPRESSION ) != 0 ) )
+		{
+			result = 0;
+		}
+		else
+		{
+			result = libewf_chunk_data_check_packed_checksum(
+			          chunk_data,
+			          error );
 
-			return( -1 );
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to check chunk: %" PRIu64 " checksum.",
+				 function,
+				 current_chunk_index );
+
+				return( -1 );
+			}
 		}
-		/* Check if chunks section needs to be corrected
-		 */
-		if( internal_handle->write_io_handle->chunks_section_offset != 0 )
+		if( result == 0 )
 		{
-			write_count = libewf_write_io_handle_write_chunks_section_end(
-			               internal_handle->write_io_handle,
-			               internal_handle->io_handle,
-				       file_io_pool,
-				       file_io_pool_entry,
-			               internal_handle->write_io_handle->current_segment_file,
-			               error );
+			if( libewf_chunk_data_unpack(
+			     chunk_data,
+			     internal_data_chunk->io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to unpack chunk: %" PRIu64 " data.",
+				 function,
+				 current_chunk_index );
 
-			if( write_count == -1 )
+				return( -1 );
+			}
+		}
+		else if( ( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_USES_PATTERN_FILL ) == 0 )
+		      && ( ( internal_handle->write_io_handle->pack_flags & LIBEWF_PACK_FLAG_ADD_ALIGNMENT_PADDING ) != 0 ) )
+		{
+			if( libewf_chunk_data_pack_add_alignment_padding(
+			     chunk_data,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write chunks section end: %" PRIu32 ".",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add chunk: %" PRIu64 " alignment padding.",
 				 function,
-				 internal_handle->write_io_handle->current_segment_number );
+				 current_chunk_index );
 
 				return( -1 );
 			}
-			write_finalize_count += write_count;
 		}
-		/* Close the segment file
-		 */
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+	}
+	if( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_PACKED ) == 0 )
+	{
+		if( internal_handle->write_io_handle->media_digests != NULL )
 		{
-			libcnotify_printf(
-			 "%s: closing last segment file: %" PRIu32 ".\n",
-			 function,
-			 internal_handle->write_io_handle->current_segment_number );
+			if( libewf_media_digests_update(
+			     internal_handle->write_io_handle->media_digests,
+			     chunk_data->data,
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update media digests with chunk: %" PRIu64 " data.",
+				 function,
+				 current_chunk_index );
+
+				return( -1 );
+			}
 		}
-#endif
-		write_count = libewf_segment_file_write_close(
-		               internal_handle->write_io_handle->current_segment_file,
-		               file_io_pool,
-		               file_io_pool_entry,
-		               internal_handle->write_io_handle->number_of_chunks_written_to_segment_file,
-		               1,
-		               internal_handle->hash_sections,
-		               internal_handle->hash_values,
-		               internal_handle->media_values,
-		               internal_handle->sessions,
-		               internal_handle->tracks,
-		               internal_handle->acquiry_errors,
-		               &( internal_handle->write_io_handle->data_section ),
-		               error );
+		/* Packing clears the range flags
+		 */
+		corrupted_flag = chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED;
 
-		if( write_count == -1 )
+		if( libewf_chunk_data_pack(
+		     chunk_data,
+		     internal_handle->io_handle,
+		     internal_handle->write_io_handle->compressed_zero_byte_empty_block,
+		     internal_handle->write_io_handle->compressed_zero_byte_empty_block_size,
+		     internal_handle->write_io_handle->pack_flags,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to close segment file: %" PRIu32 ".",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to pack chunk: %" PRIu64 " data.",
 			 function,
-			 internal_handle->write_io_handle->current_segment_number );
+			 current_chunk_index );
 
 			return( -1 );
 		}
-		write_finalize_count += write_count;
+	}
+	write_count = libewf_write_io_handle_write_new_chunk(
+	               internal_handle->write_io_handle,
+	               internal_handle->io_handle,
+	               file_io_pool,
+	               internal_handle->media_values,
+	               internal_handle->segment_table,
+	               internal_handle->header_values,
+	               internal_handle->hash_values,
+	               internal_handle->hash_sections,
+	               internal_handle->sessions,
+	               internal_handle->tracks,
+	               internal_handle->acquiry_errors,
+	               current_chunk_index,
+	               chunk_data,
+	               data_size,
+	               error );
 
-		internal_handle->write_io_handle->current_segment_file = NULL;
+	chunk_data->range_flags |= corrupted_flag;
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write chunk data.",
+		 function );
+
+		return( -1 );
 	}
-	/* Correct the media values if streamed write was used
-	 */
-	if( internal_handle->media_values->media_size == 0 )
+	internal_handle->current_offset += (off64_t) data_size;
+
+	return( write_count );
+}
+
+/* Writes a (media) data chunk that was read from another handle at the current offset
+ * The packed chunk data is written as stored in the segment file of the other handle
+ * Returns the number of bytes written, 0 when no longer data can be written or -1 on error
+ */
+ssize_t libewf_handle_write_packed_data_chunk(
+         libewf_handle_t *handle,
+         libewf_data_chunk_t *data_chunk,
+         libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_write_packed_data_chunk";
+	ssize_t write_count                       = 0;
+
+	if( handle == NULL )
 	{
-		/* Determine the media values
-		 */
-		internal_handle->media_values->number_of_chunks  = internal_handle->write_io_handle->number_of_chunks_written;
-		internal_handle->media_values->number_of_sectors = (uint64_t) ( internal_handle->write_io_handle->input_write_count / internal_handle->media_values->bytes_per_sector );
-		internal_handle->media_values->media_size        = (size64_t) internal_handle->write_io_handle->input_write_count;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-		/* Flush the section write caches
-		 */
-		if( internal_handle->write_io_handle->case_data != NULL )
-		{
-			memory_free(
-			 internal_handle->write_io_handle->case_data );
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
 
-			internal_handle->write_io_handle->case_data      = NULL;
-			internal_handle->write_io_handle->case_data_size = 0;
-		}
-		if( internal_handle->write_io_handle->device_information != NULL )
-		{
-			memory_free(
-			 internal_handle->write_io_handle->device_information );
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
 
-			internal_handle->write_io_handle->device_information      = NULL;
-			internal_handle->write_io_handle->device_information_size = 0;
-		}
-		if( internal_handle->write_io_handle->data_section != NULL )
-		{
-			memory_free(
-			 internal_handle->write_io_handle->data_section );
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	write_count = libewf_internal_handle_write_packed_data_chunk_to_file_io_pool(
+	               internal_handle,
+	               internal_handle->file_io_pool,
+	               (libewf_internal_data_chunk_t *) data_chunk,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write packed data chunk.",
+		 function );
+
+		write_count = -1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( write_count );
+}
+
+/* Finalizes the media digests and block hashes calculated during write and sets the digests in the hash sections and values
+ * Digests that were set by the caller, e.g. using libewf_handle_set_md5_hash, are left unchanged
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_set_media_digests(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	libewf_media_digests_t *media_digests = NULL;
+	static char *function                 = "libewf_internal_handle_set_media_digests";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->hash_sections == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing hash sections.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->write_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing write IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	media_digests = internal_handle->write_io_handle->media_digests;
+
+	if( media_digests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid write IO handle - missing media digests.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_digests->is_finalized != 0 )
+	{
+		return( 1 );
+	}
+	if( libewf_media_digests_finalize(
+	     media_digests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize media digests.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_digests->block_hashes != NULL )
+	{
+		media_digests->block_hashes->chunk_size = internal_handle->media_values->chunk_size;
+
+		if( memory_copy(
+		     media_digests->block_hashes->set_identifier,
+		     internal_handle->media_values->set_identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy set identifier to block hashes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( media_digests->calculate_digest_flags == 0 )
+	{
+		return( 1 );
+	}
+	if( internal_handle->hash_values == NULL )
+	{
+		if( libewf_hash_values_initialize(
+		     &( internal_handle->hash_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create hash values.",
+			 function );
+
+			return( -1 );
+		}
+		internal_handle->hash_values_parsed = 1;
+	}
+	if( ( ( media_digests->calculate_digest_flags & LIBEWF_CALCULATE_DIGEST_FLAG_MD5 ) != 0 )
+	 && ( internal_handle->hash_sections->md5_hash_set == 0 )
+	 && ( internal_handle->hash_sections->md5_digest_set == 0 ) )
+	{
+		if( memory_copy(
+		     internal_handle->hash_sections->md5_hash,
+		     media_digests->md5_hash,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to set MD5 hash.",
+			 function );
+
+			return( -1 );
+		}
+		internal_handle->hash_sections->md5_hash_set = 1;
+
+		if( memory_copy(
+		     internal_handle->hash_sections->md5_digest,
+		     media_digests->md5_hash,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to set MD5 digest.",
+			 function );
+
+			return( -1 );
+		}
+		internal_handle->hash_sections->md5_digest_set = 1;
+
+		if( libewf_hash_values_parse_md5_hash(
+		     internal_handle->hash_values,
+		     media_digests->md5_hash,
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to parse MD5 hash for its value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( ( media_digests->calculate_digest_flags & LIBEWF_CALCULATE_DIGEST_FLAG_SHA1 ) != 0 )
+	 && ( internal_handle->hash_sections->sha1_hash_set == 0 )
+	 && ( internal_handle->hash_sections->sha1_digest_set == 0 ) )
+	{
+		if( memory_copy(
+		     internal_handle->hash_sections->sha1_hash,
+		     media_digests->sha1_hash,
+		     20 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to set SHA1 hash.",
+			 function );
+
+			return( -1 );
+		}
+		internal_handle->hash_sections->sha1_hash_set = 1;
+
+		if( memory_copy(
+		     internal_handle->hash_sections->sha1_digest,
+		     media_digests->sha1_hash,
+		     20 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to set SHA1 digest.",
+			 function );
+
+			return( -1 );
+		}
+		internal_handle->hash_sections->sha1_digest_set = 1;
+
+		if( libewf_hash_values_parse_sha1_hash(
+		     internal_handle->hash_values,
+		     media_digests->sha1_hash,
+		     20,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to parse SHA1 hash for its value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The hash sections have no SHA256 digest, hence it is only stored as hash value
+	 */
+	if( ( media_digests->calculate_digest_flags & LIBEWF_CALCULATE_DIGEST_FLAG_SHA256 ) != 0 )
+	{
+		if( libewf_hash_values_parse_sha256_hash(
+		     internal_handle->hash_values,
+		     media_digests->sha256_hash,
+		     32,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to parse SHA256 hash for its value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Finalizes the write by correcting the EWF the meta data in the segment files
+ * This function is required after write from stream
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libewf_internal_handle_write_finalize_file_io_pool(
+         libewf_internal_handle_t *internal_handle,
+         libbfio_pool_t *file_io_pool,
+         libcerror_error_t **error )
+{
+	libewf_segment_file_t *segment_file = NULL;
+	static char *function               = "libewf_internal_handle_write_finalize_file_io_pool";
+	size64_t segment_file_size          = 0;
+	size_t input_data_size              = 0;
+	ssize_t write_count                 = 0;
+	ssize_t write_finalize_count        = 0;
+	uint64_t chunk_index                = 0;
+	uint32_t number_of_segments         = 0;
+	int file_io_pool_entry              = -1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid handle - invalid IO handle - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_READ ) != 0 )
+	 && ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_RESUME ) == 0 ) )
+	{
+		if( internal_handle->chunk_data != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid handle - chunk data set.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_handle->write_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing write IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid media values - missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->write_io_handle->write_finalized != 0 )
+	{
+		return( 0 );
+	}
+	if( ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_READ ) != 0 )
+	 && ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_RESUME ) == 0 ) )
+	{
+		return( 0 );
+	}
+	if( internal_handle->chunk_data != NULL )
+	{
+		chunk_index = internal_handle->current_offset / internal_handle->media_values->chunk_size;
+
+		if( chunk_index < internal_handle->write_io_handle->number_of_chunks_written )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: chunk: %" PRIu64 " already exists.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		input_data_size = internal_handle->chunk_data->data_size;
+
+		if( internal_handle->write_io_handle->media_digests != NULL )
+		{
+			if( libewf_media_digests_update(
+			     internal_handle->write_io_handle->media_digests,
+			     internal_handle->chunk_data->data,
+			     input_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update media digests with chunk: %" PRIu64 " data.",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+		}
+		if( libewf_chunk_data_pack(
+		     internal_handle->chunk_data,
+		     internal_handle->io_handle,
+		     internal_handle->write_io_handle->compressed_zero_byte_empty_block,
+		     internal_handle->write_io_handle->compressed_zero_byte_empty_block_size,
+		     internal_handle->write_io_handle->pack_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to pack chunk: %" PRIu64 " data.",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		write_count = libewf_write_io_handle_write_new_chunk(
+			       internal_handle->write_io_handle,
+			       internal_handle->io_handle,
+			       file_io_pool,
+			       internal_handle->media_values,
+			       internal_handle->segment_table,
+			       internal_handle->header_values,
+			       internal_handle->hash_values,
+			       internal_handle->hash_sections,
+			       internal_handle->sessions,
+			       internal_handle->tracks,
+			       internal_handle->acquiry_errors,
+			       chunk_index,
+			       internal_handle->chunk_data,
+			       input_data_size,
+			       error );
+
+		if( write_count <= 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write new chunk.",
+			 function );
+
+			return( -1 );
+		}
+		write_finalize_count += write_count;
+
+		if( libewf_chunk_data_free(
+		     &( internal_handle->chunk_data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Check if all media data has been written
+	 */
+	if( ( internal_handle->media_values->media_size != 0 )
+	 && ( internal_handle->write_io_handle->input_write_count < (ssize64_t) internal_handle->media_values->media_size ) )
+	{
+		return( write_finalize_count );
+	}
+	if( internal_handle->write_io_handle->media_digests != NULL )
+	{
+		if( libewf_internal_handle_set_media_digests(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set media digests.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libewf_segment_table_get_number_of_segments(
+	     internal_handle->segment_table,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments == 0 )
+	{
+		/* No segment file needs to be created
+		 */
+/* TODO clean up this logic: when is this triggered? */
+		if( internal_handle->media_values->media_size != 0 )
+		{
+			return( write_finalize_count );
+		}
+		/* Create the segment file if required
+		 */
+		if( libewf_write_io_handle_create_segment_file(
+		     internal_handle->io_handle,
+		     file_io_pool,
+		     internal_handle->segment_table,
+		     internal_handle->io_handle->segment_file_type,
+		     0,
+		     internal_handle->write_io_handle->maximum_number_of_segments,
+		     internal_handle->media_values->set_identifier,
+		     &file_io_pool_entry,
+		     &segment_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to create segment file: 0.",
+			 function );
+
+			return( -1 );
+		}
+		write_count = libewf_segment_file_write_start(
+		               segment_file,
+		               file_io_pool,
+		               file_io_pool_entry,
+		               &( internal_handle->write_io_handle->case_data ),
+		               &( internal_handle->write_io_handle->case_data_size ),
+		               &( internal_handle->write_io_handle->device_information ),
+		               &( internal_handle->write_io_handle->device_information_size ),
+		               &( internal_handle->write_io_handle->data_section ),
+		               internal_handle->media_values,
+		               internal_handle->header_values,
+		               internal_handle->write_io_handle->timestamp,
+		               error );
+
+		if( write_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write segment file: 0 start.",
+			 function );
+
+			return( -1 );
+		}
+		write_finalize_count += write_count;
+	}
+	/* Check if the last segment file is still open for writing
+	 */
+	else if( internal_handle->write_io_handle->current_segment_file != NULL )
+	{
+		if( libewf_segment_table_get_segment_by_index(
+		     internal_handle->segment_table,
+		     internal_handle->write_io_handle->current_segment_number,
+		     &file_io_pool_entry,
+		     &segment_file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment: %" PRIu32 " from segment table.",
+			 function,
+			 internal_handle->write_io_handle->current_segment_number );
+
+			return( -1 );
+		}
+		/* Check if chunks section needs to be corrected
+		 */
+		if( internal_handle->write_io_handle->chunks_section_offset != 0 )
+		{
+			write_count = libewf_write_io_handle_write_chunks_section_end(
+			               internal_handle->write_io_handle,
+			               internal_handle->io_handle,
+				       file_io_pool,
+				       file_io_pool_entry,
+			               internal_handle->write_io_handle->current_segment_file,
+			               error );
+
+			if( write_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write chunks section end: %" PRIu32 ".",
+				 function,
+				 internal_handle->write_io_handle->current_segment_number );
+
+				return( -1 );
+			}
+			write_finalize_count += write_count;
+		}
+		/* Close the segment file
+		 */
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: closing last segment file: %" PRIu32 ".\n",
+			 function,
+			 internal_handle->write_io_handle->current_segment_number );
+		}
+#endif
+		write_count = libewf_segment_file_write_close(
+		               internal_handle->write_io_handle->current_segment_file,
+		               file_io_pool,
+		               file_io_pool_entry,
+		               internal_handle->write_io_handle->number_of_chunks_written_to_segment_file,
+		               1,
+		               internal_handle->hash_sections,
+		               internal_handle->hash_values,
+		               internal_handle->media_values,
+		               internal_handle->sessions,
+		               internal_handle->tracks,
+		               internal_handle->acquiry_errors,
+		               &( internal_handle->write_io_handle->data_section ),
+		               error );
+
+		if( write_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to close segment file: %" PRIu32 ".",
+			 function,
+			 internal_handle->write_io_handle->current_segment_number );
+
+			return( -1 );
+		}
+		write_finalize_count += write_count;
+
+		internal_handle->write_io_handle->current_segment_file = NULL;
+	}
+	/* Correct the media values if streamed write was used
+	 */
+	if( internal_handle->media_values->media_size == 0 )
+	{
+		/* Determine the media values
+		 */
+		internal_handle->media_values->number_of_chunks  = internal_handle->write_io_handle->number_of_chunks_written;
+		internal_handle->media_values->number_of_sectors = (uint64_t) ( internal_handle->write_io_handle->input_write_count / internal_handle->media_values->bytes_per_sector );
+		internal_handle->media_values->media_size        = (size64_t) internal_handle->write_io_handle->input_write_count;
+
+		/* Flush the section write caches
+		 */
+		if( internal_handle->write_io_handle->case_data != NULL )
+		{
+			memory_free(
+			 internal_handle->write_io_handle->case_data );
+
+			internal_handle->write_io_handle->case_data      = NULL;
+			internal_handle->write_io_handle->case_data_size = 0;
+		}
+		if( internal_handle->write_io_handle->device_information != NULL )
+		{
+			memory_free(
+			 internal_handle->write_io_handle->device_information );
+
+			internal_handle->write_io_handle->device_information      = NULL;
+			internal_handle->write_io_handle->device_information_size = 0;
+		}
+		if( internal_handle->write_io_handle->data_section != NULL )
+		{
+			memory_free(
+			 internal_handle->write_io_handle->data_section );
+
+			internal_handle->write_io_handle->data_section = NULL;
+		}
+		/* Correct the sections in the segment files
+		 */
+		if( libewf_write_io_handle_finalize_write_sections_corrections(
+		     internal_handle->write_io_handle,
+		     file_io_pool,
+		     internal_handle->media_values,
+		     internal_handle->segment_table,
+		     internal_handle->header_values,
+		     internal_handle->hash_values,
+		     internal_handle->hash_sections,
+		     internal_handle->sessions,
+		     internal_handle->tracks,
+		     internal_handle->acquiry_errors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write sections corrections to segment files.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_handle->write_io_handle->write_finalized = 1;
+
+	return( write_finalize_count );
+}
+
+/* Finalizes the write by correcting the EWF the meta data in the segment files
+ * This function is required after write from stream
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libewf_handle_write_finalize(
+         libewf_handle_t *handle,
+         libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_write_finalize";
+	ssize_t write_count                       = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	write_count = libewf_internal_handle_write_finalize_file_io_pool(
+	               internal_handle,
+	               internal_handle->file_io_pool,
+	               error );
+
+	if( write_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to write finalize.",
+		 function );
+
+		write_count = -1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( write_count );
+}
+
+/* Seeks a certain offset of the (media) data
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libewf_internal_handle_seek_offset(
+         libewf_internal_handle_t *internal_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libewf_internal_handle_seek_offset";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->chunk_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - chunk data set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_values->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid media values - missing chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{	
+		offset += internal_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{	
+		offset += (off64_t) internal_handle->media_values->media_size;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: seeking media data offset: %" PRIi64 ".\n",
+		 function,
+		 offset );
+	}
+#endif
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Seeks a certain offset of the (media) data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libewf_handle_seek_offset(
+         libewf_handle_t *handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_seek_offset";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	offset = libewf_internal_handle_seek_offset(
+	          internal_handle,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( offset );
+}
+
+/* Retrieves the current offset of the (media) data
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_get_offset(
+     libewf_handle_t *handle,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_offset";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*offset = internal_handle->current_offset;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the next range of the (media) data that contains data at or after a specific offset
+ * Chunks that contain only 0-byte values, such as EWF2 chunks with a pattern fill of 0-byte values
+ * or small compressed empty-block chunks, are considered holes. This information is determined
+ * from the chunk table metadata where possible and cached per chunk group
+ * Returns 1 if successful, 0 if no such range or -1 on error
+ */
+int libewf_handle_get_next_data_range(
+     libewf_handle_t *handle,
+     off64_t offset,
+     off64_t *data_range_offset,
+     size64_t *data_range_size,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_next_data_range";
+	int result                                = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid handle - unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libewf_chunk_table_get_next_data_range(
+	          internal_handle->chunk_table,
+	          internal_handle->io_handle,
+	          internal_handle->file_io_pool,
+	          internal_handle->media_values,
+	          internal_handle->segment_table,
+	          offset,
+	          data_range_offset,
+	          data_range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next data range at or after offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Divides the maximum number of open handles between the file IO pool and the file descriptor pool
+ * The file descriptor pool, that is used to read the chunk data, gets the larger share
+ * A maximum of 0 represents no maximum for both pools
+ * Returns 1 if successful, 0 if the maximum is too small to use the file descriptor pool or -1 on error
+ */
+int libewf_internal_handle_divide_maximum_number_of_open_handles(
+     int maximum_number_of_open_handles,
+     int *maximum_number_of_file_io_pool_handles,
+     int *maximum_number_of_file_descriptors,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_internal_handle_divide_maximum_number_of_open_handles";
+
+	if( maximum_number_of_open_handles < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open handles value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_file_io_pool_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of file IO pool handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_file_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of file descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_handles == 1 )
+	{
+		*maximum_number_of_file_io_pool_handles = 1;
+		*maximum_number_of_file_descriptors     = 0;
+
+		return( 0 );
+	}
+	*maximum_number_of_file_io_pool_handles = maximum_number_of_open_handles / 2;
+	*maximum_number_of_file_descriptors     = maximum_number_of_open_handles - *maximum_number_of_file_io_pool_handles;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of (concurrent) open file handles
+ * For a read-only handle the maximum is divided between the file IO pool and
+ * the file descriptor pool, the file descriptor pool is shared with lightweight clones
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_set_maximum_number_of_open_handles(
+     libewf_handle_t *handle,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle  = NULL;
+	static char *function                      = "libewf_handle_set_maximum_number_of_open_handles";
+	int maximum_number_of_file_descriptors     = 0;
+	int maximum_number_of_file_io_pool_handles = 0;
+	int result                                 = 1;
+	int use_file_descriptor_pool               = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	maximum_number_of_file_io_pool_handles = maximum_number_of_open_handles;
+
+	if( internal_handle->file_descriptor_pool != NULL )
+	{
+		use_file_descriptor_pool = libewf_internal_handle_divide_maximum_number_of_open_handles(
+		                            maximum_number_of_open_handles,
+		                            &maximum_number_of_file_io_pool_handles,
+		                            &maximum_number_of_file_descriptors,
+		                            error );
+
+		if( use_file_descriptor_pool == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to divide maximum number of open handles.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( ( result == 1 )
+	 && ( internal_handle->file_io_pool != NULL ) )
+	{
+		result = libbfio_pool_set_maximum_number_of_open_handles(
+		          internal_handle->file_io_pool,
+		          maximum_number_of_file_io_pool_handles,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum number of open handles in file IO pool.",
+			 function );
+		}
+	}
+	if( ( result == 1 )
+	 && ( internal_handle->file_descriptor_pool != NULL ) )
+	{
+		/* When the file descriptor pool is no longer used a maximum of 1
+		 * closes its file descriptors that are not in use
+		 */
+		if( use_file_descriptor_pool == 0 )
+		{
+			maximum_number_of_file_descriptors = 1;
+		}
+		result = libewf_file_descriptor_pool_set_maximum_number_of_open_file_descriptors(
+		          internal_handle->file_descriptor_pool,
+		          maximum_number_of_file_descriptors,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum number of open file descriptors in file descriptor pool.",
+			 function );
+		}
+		else if( internal_handle->chunk_table != NULL )
+		{
+			if( use_file_descriptor_pool != 0 )
+			{
+				internal_handle->chunk_table->file_descriptor_pool = internal_handle->file_descriptor_pool;
+			}
+			else
+			{
+				internal_handle->chunk_table->file_descriptor_pool = NULL;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		internal_handle->maximum_number_of_open_handles = maximum_number_of_open_handles;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the directory of the persistent (on-disk) chunk cache
+ * The persistent cache stores unpacked chunk data of read-only handles, so that
+ * it can be reused by subsequent opens of the same segment file set
+ * Use a directory of NULL to disable the persistent cache
+ * This function needs to be used before one of the open functions
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_set_persistent_cache_directory(
+     libewf_handle_t *handle,
+     const char *directory,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	char *persistent_cache_directory          = NULL;
+	static char *function                     = "libewf_handle_set_persistent_cache_directory";
+	size_t directory_length                   = 0;
+	int result                                = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( directory != NULL )
+	{
+		if( maximum_cache_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+			 "%s: invalid maximum cache size value zero or less.",
+			 function );
+
+			return( -1 );
+		}
+		directory_length = narrow_string_length(
+		                    directory );
+
+		persistent_cache_directory = narrow_string_allocate(
+		                              directory_length + 1 );
+
+		if( persistent_cache_directory == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create persistent cache directory.",
+			 function );
+
+			return( -1 );
+		}
+		if( narrow_string_copy(
+		     persistent_cache_directory,
+		     directory,
+		     directory_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy persistent cache directory.",
+			 function );
+
+			memory_free(
+			 persistent_cache_directory );
+
+			return( -1 );
+		}
+		persistent_cache_directory[ directory_length ] = 0;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		if( persistent_cache_directory != NULL )
+		{
+			memory_free(
+			 persistent_cache_directory );
+		}
+		return( -1 );
+	}
+#endif
+	if( internal_handle->file_io_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: persistent cache directory cannot be changed while the handle is open.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		if( internal_handle->persistent_cache_directory != NULL )
+		{
+			memory_free(
+			 internal_handle->persistent_cache_directory );
+		}
+		internal_handle->persistent_cache_directory    = persistent_cache_directory;
+		internal_handle->maximum_persistent_cache_size = maximum_cache_size;
+
+		persistent_cache_directory = NULL;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( persistent_cache_directory != NULL )
+	{
+		memory_free(
+		 persistent_cache_directory );
+	}
+	return( result );
+}
+
+/* Sets the maximum size of the compressed chunk cache
+ * The compressed chunk cache stores the compressed chunk data of read-only handles
+ * in addition to the chunk data cache
+ * Use a maximum cache size of 0 to disable the compressed chunk cache
+ * This function needs to be used before one of the open functions
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_set_maximum_compressed_chunk_cache_size(
+     libewf_handle_t *handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_set_maximum_compressed_chunk_cache_size";
+	int result                                = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->file_io_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: maximum compressed chunk cache size cannot be changed while the handle is open.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_handle->maximum_compressed_chunk_cache_size = maximum_cache_size;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets if the process-wide shared chunk cache should be used
+ * The shared chunk cache stores the unpacked chunk data of read-only handles
+ * by its compressed data, so that identical chunks of different images are
+ * unpacked and stored once
+ * The maximum size of the shared chunk cache is set with libewf_set_maximum_shared_chunk_cache_size
+ * This function needs to be used before one of the open functions
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_set_use_shared_chunk_cache(
+     libewf_handle_t *handle,
+     uint8_t use_shared_chunk_cache,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_set_use_shared_chunk_cache";
+	int result                                = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->file_io_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: use shared chunk cache cannot be changed while the handle is open.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_handle->use_shared_chunk_cache = use_shared_chunk_cache;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the number of threads used to verify the chunk data by libewf_handle_scan_chunk_integrity
+ * A number of 0 represents that the chunk data is verified by the calling thread
+ * The number of threads is ignored if multi-threading is not supported
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_set_number_of_integrity_scan_threads(
+     libewf_handle_t *handle,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_set_number_of_integrity_scan_threads";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_handle->number_of_integrity_scan_threads = number_of_threads;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+
+/* Frees the buffer of a completed prefetch request
+ */
+void libewf_internal_handle_prefetch_callback(
+      libewf_handle_t *handle LIBEWF_ATTRIBUTE_UNUSED,
+      off64_t offset LIBEWF_ATTRIBUTE_UNUSED,
+      void *buffer,
+      ssize_t read_count LIBEWF_ATTRIBUTE_UNUSED,
+      int result LIBEWF_ATTRIBUTE_UNUSED,
+      void *callback_data LIBEWF_ATTRIBUTE_UNUSED )
+{
+	LIBEWF_UNREFERENCED_PARAMETER( handle )
+	LIBEWF_UNREFERENCED_PARAMETER( offset )
+	LIBEWF_UNREFERENCED_PARAMETER( read_count )
+	LIBEWF_UNREFERENCED_PARAMETER( result )
+	LIBEWF_UNREFERENCED_PARAMETER( callback_data )
+
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+}
+
+/* Prefetches the chunks of a range of the media data on the threads of the asynchronous reader
+ * The worker handles read and unpack the chunks, which brings the segment file data into
+ * the operating system cache and the chunk data into the shared chunk cache if used
+ * At most LIBEWF_ASYNC_READER_MAXIMUM_NUMBER_OF_PREFETCH_REQUESTS chunks are prefetched per call
+ * and prefetching stops when the maximum number of requests in flight is reached,
+ * the remainder of the range is left to the operating system read-ahead
+ * Prefetching is skipped if the handle is not opened read-only
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_prefetch_range(
+     libewf_internal_handle_t *internal_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer            = NULL;
+	static char *function      = "libewf_internal_handle_prefetch_range";
+	size64_t media_size        = 0;
+	size_t read_size           = 0;
+	off64_t chunk_offset       = 0;
+	off64_t range_end_offset   = 0;
+	uint32_t chunk_size        = 0;
+	int number_of_requests     = 0;
+	int result                 = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->io_handle != NULL )
+	 && ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_WRITE ) == 0 )
+	 && ( internal_handle->file_io_pool != NULL )
+	 && ( internal_handle->media_values != NULL )
+	 && ( internal_handle->media_values->chunk_size != 0 )
+	 && ( (size64_t) offset < internal_handle->media_values->media_size ) )
+	{
+		media_size = internal_handle->media_values->media_size;
+		chunk_size = internal_handle->media_values->chunk_size;
+		result     = 1;
+
+		if( internal_handle->async_reader == NULL )
+		{
+			if( libewf_async_reader_initialize(
+			     &( internal_handle->async_reader ),
+			     (libewf_handle_t *) internal_handle,
+			     LIBEWF_ASYNC_READER_NUMBER_OF_THREADS,
+			     LIBEWF_ASYNC_READER_MAXIMUM_NUMBER_OF_REQUESTS,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create asynchronous reader.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	range_end_offset = (off64_t) media_size;
+
+	if( ( size != 0 )
+	 && ( size < ( media_size - offset ) ) )
+	{
+		range_end_offset = offset + (off64_t) size;
+	}
+	chunk_offset = offset - ( offset % chunk_size );
+
+	while( ( chunk_offset < range_end_offset )
+	    && ( number_of_requests < LIBEWF_ASYNC_READER_MAXIMUM_NUMBER_OF_PREFETCH_REQUESTS ) )
+	{
+		read_size = (size_t) chunk_size;
+
+		if( (size64_t) read_size > ( media_size - chunk_offset ) )
+		{
+			read_size = (size_t) ( media_size - chunk_offset );
+		}
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * read_size );
+
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create prefetch buffer.",
+			 function );
+
+			return( -1 );
+		}
+		/* The buffer is owned by the request once it is pushed
+		 * and freed by the completion callback
+		 */
+		result = libewf_async_reader_push_request(
+		          internal_handle->async_reader,
+		          chunk_offset,
+		          buffer,
+		          read_size,
+		          &libewf_internal_handle_prefetch_callback,
+		          NULL,
+		          error );
+
+		if( result != 1 )
+		{
+			memory_free(
+			 buffer );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push prefetch request at offset: %" PRIi64 ".",
+				 function,
+				 chunk_offset );
+
+				return( -1 );
+			}
+			break;
+		}
+		buffer = NULL;
+
+		chunk_offset       += chunk_size;
+		number_of_requests += 1;
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
+/* Advises the expected access pattern of the media data
+ * The normal, sequential and random access advice apply to the entire media data
+ * and remain in effect until changed, where sequential access advice prevents
+ * the chunk data from being added to the persistent cache
+ * The will need and do not need access advice apply to the range of the media data
+ * defined by offset and size, where a size of 0 represents the range up to the end
+ * of the media data, and do not need access advice removes the chunk data of the range
+ * from the chunk data cache
+ * The access advice is forwarded to the operating system for the corresponding
+ * segment file ranges if supported
+ * With multi-threading support the chunks of a will need range are also prefetched
+ * on the threads of the asynchronous reader
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_advise(
+     libewf_handle_t *handle,
+     off64_t offset,
+     size64_t size,
+     int advice,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_advise";
+	int result                                = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( advice != LIBEWF_ACCESS_ADVICE_NORMAL )
+	 && ( advice != LIBEWF_ACCESS_ADVICE_SEQUENTIAL )
+	 && ( advice != LIBEWF_ACCESS_ADVICE_RANDOM )
+	 && ( advice != LIBEWF_ACCESS_ADVICE_WILLNEED )
+	 && ( advice != LIBEWF_ACCESS_ADVICE_DONTNEED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported advice.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( advice == LIBEWF_ACCESS_ADVICE_WILLNEED )
+	 || ( advice == LIBEWF_ACCESS_ADVICE_DONTNEED ) )
+	{
+		if( ( internal_handle->chunk_table != NULL )
+		 && ( internal_handle->media_values != NULL )
+		 && ( internal_handle->media_values->chunk_size != 0 ) )
+		{
+			if( libewf_chunk_table_advise_range(
+			     internal_handle->chunk_table,
+			     internal_handle->media_values,
+			     offset,
+			     size,
+			     advice,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to advise range: %" PRIi64 " of chunk table.",
+				 function,
+				 offset );
+
+				result = -1;
+			}
+		}
+	}
+	else
+	{
+		internal_handle->access_advice = advice;
+
+		if( internal_handle->chunk_table != NULL )
+		{
+			internal_handle->chunk_table->access_advice = advice;
+		}
+		if( internal_handle->file_descriptor_pool != NULL )
+		{
+			if( libewf_file_descriptor_pool_set_access_advice(
+			     internal_handle->file_descriptor_pool,
+			     advice,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set access advice of file descriptor pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The prefetch requests are pushed without holding the read/write lock
+	 * since the worker handles are cloned from the handle on demand
+	 */
+	if( ( result == 1 )
+	 && ( advice == LIBEWF_ACCESS_ADVICE_WILLNEED ) )
+	{
+		if( libewf_internal_handle_prefetch_range(
+		     internal_handle,
+		     offset,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to prefetch range: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			result = -1;
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Determine if the segment files are corrupted
+ * Returns 1 if corrupted, 0 if not or -1 on error
+ */
+int libewf_handle_segment_files_corrupted(
+     libewf_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_segment_files_corrupted";
+	int result                                = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing segment table.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = ( internal_handle->segment_table->flags & LIBEWF_SEGMENT_TABLE_FLAG_IS_CORRUPTED ) != 0;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Determine if the segment files are encrypted
+ * Returns 1 if encrypted, 0 if not or -1 on error
+ */
+int libewf_handle_segment_files_encrypted(
+     libewf_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_segment_files_encrypted";
+	int result                                = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = (int) internal_handle->io_handle->is_encrypted;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the encryption key
+ * The key is used to decrypt the sections and chunk data of encrypted segment files
+ * and should be 16, 24 or 32 bytes in size
+ * Use a key of NULL to remove the encryption key
+ * This function needs to be used before one of the open functions
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_set_encryption_key(
+     libewf_handle_t *handle,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error )
+{
+	libewf_encryption_context_t *encryption_context = NULL;
+	libewf_internal_handle_t *internal_handle       = NULL;
+	static char *function                           = "libewf_handle_set_encryption_key";
+	int result                                      = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( key != NULL )
+	{
+		if( libewf_encryption_context_initialize(
+		     &encryption_context,
+		     key,
+		     key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create encryption context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		if( encryption_context != NULL )
+		{
+			libewf_encryption_context_free(
+			 &encryption_context,
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	if( internal_handle->file_io_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: encryption key cannot be changed while the handle is open.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		if( internal_handle->encryption_context != NULL )
+		{
+			if( libewf_encryption_context_free(
+			     &( internal_handle->encryption_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free encryption context.",
+				 function );
 
-			internal_handle->write_io_handle->data_section = NULL;
+				result = -1;
+			}
 		}
-		/* Correct the sections in the segment files
-		 */
-		if( libewf_write_io_handle_finalize_write_sections_corrections(
-		     internal_handle->write_io_handle,
-		     file_io_pool,
-		     internal_handle->media_values,
-		     internal_handle->segment_table,
-		     internal_handle->header_values,
-		     internal_handle->hash_values,
-		     internal_handle->hash_sections,
-		     internal_handle->sessions,
-		     internal_handle->tracks,
-		     internal_handle->acquiry_errors,
-		     error ) != 1 )
+		if( result == 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write sections corrections to segment files.",
-			 function );
+			internal_handle->encryption_context = encryption_context;
 
-			return( -1 );
+			encryption_context = NULL;
 		}
 	}
-	internal_handle->write_io_handle->write_finalized = 1;
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-	return( write_finalize_count );
+		result = -1;
+	}
+#endif
+	if( encryption_context != NULL )
+	{
+		libewf_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	return( result );
 }
 
-/* Finalizes the write by correcting the EWF the meta data in the segment files
- * This function is required after write from stream
- * Returns the number of bytes written or -1 on error
+/* Sets the encryption initialization vector
+ * The initialization vector is used to decrypt the sections and chunk data of encrypted
+ * segment files and should be 16 bytes in size, by default it consists of 0-byte values
+ * This function needs to be used after libewf_handle_set_encryption_key and before one of the open functions
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libewf_handle_write_finalize(
-         libewf_handle_t *handle,
-         libcerror_error_t **error )
+int libewf_handle_set_encryption_initialization_vector(
+     libewf_handle_t *handle,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_write_finalize";
-	ssize_t write_count                       = 0;
+	static char *function                     = "libewf_handle_set_encryption_initialization_vector";
+	int result                                = 1;
 
 	if( handle == NULL )
 	{
@@ -6393,17 +9946,6 @@ ssize_t libewf_handle_write_finalize(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->file_io_pool == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing file IO pool.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
@@ -6419,21 +9961,42 @@ ssize_t libewf_handle_write_finalize(
 		return( -1 );
 	}
 #endif
-	write_count = libewf_internal_handle_write_finalize_file_io_pool(
-	               internal_handle,
-	               internal_handle->file_io_pool,
-	               error );
+	if( internal_handle->file_io_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: encryption initialization vector cannot be changed while the handle is open.",
+		 function );
 
-	if( write_count == -1 )
+		result = -1;
+	}
+	else if( internal_handle->encryption_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to write finalize.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing encryption key.",
 		 function );
 
-		write_count = -1;
+		result = -1;
+	}
+	else if( libewf_encryption_context_set_initialization_vector(
+	          internal_handle->encryption_context,
+	          initialization_vector,
+	          initialization_vector_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set initialization vector in encryption context.",
+		 function );
+
+		result = -1;
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -6450,22 +10013,23 @@ ssize_t libewf_handle_write_finalize(
 		return( -1 );
 	}
 #endif
-	return( write_count );
+	return( result );
 }
 
-/* Seeks a certain offset of the (media) data
- * This function is not multi-thread safe acquire write lock before call
- * Returns the offset if seek is successful or -1 on error
+/* Retrieves the segment filename size
+ * The filename size should include the end of string character
+ * Returns 1 if successful, 0 if not set or -1 on error
  */
-off64_t libewf_internal_handle_seek_offset(
-         libewf_internal_handle_t *internal_handle,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libewf_handle_get_segment_filename_size(
+     libewf_handle_t *handle,
+     size_t *filename_size,
+     libcerror_error_t **error )
 {
-	static char *function = "libewf_internal_handle_seek_offset";
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_segment_filename_size";
+	int result                                = 0;
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -6476,96 +10040,142 @@ off64_t libewf_internal_handle_seek_offset(
 
 		return( -1 );
 	}
-	if( internal_handle->chunk_data != NULL )
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle - chunk data set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->media_values == NULL )
+#endif
+	result = libewf_segment_table_get_basename_size(
+	          internal_handle->segment_table,
+	          filename_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment table basename size.",
 		 function );
-
-		return( -1 );
 	}
-	if( internal_handle->media_values->chunk_size == 0 )
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid media values - missing chunk size.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( whence != SEEK_CUR )
-	 && ( whence != SEEK_END )
-	 && ( whence != SEEK_SET ) )
+#endif
+	return( result );
+}
+
+/* Retrieves the segment filename
+ * The filename size should include the end of string character
+ * Returns 1 if successful, 0 if not set or -1 on error
+ */
+int libewf_handle_get_segment_filename(
+     libewf_handle_t *handle,
+     char *filename,
+     size_t filename_size,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_segment_filename";
+	int result                                = 0;
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported whence.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( whence == SEEK_CUR )
-	{	
-		offset += internal_handle->current_offset;
-	}
-	else if( whence == SEEK_END )
-	{	
-		offset += (off64_t) internal_handle->media_values->media_size;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "%s: seeking media data offset: %" PRIi64 ".\n",
-		 function,
-		 offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
 	}
 #endif
-	if( offset < 0 )
+	result = libewf_segment_table_get_basename(
+	          internal_handle->segment_table,
+	          filename,
+	          filename_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid offset value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment table basename.",
+		 function );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle->current_offset = offset;
-
-	return( offset );
+#endif
+	return( result );
 }
 
-/* Seeks a certain offset of the (media) data
- * Returns the offset if seek is successful or -1 on error
+/* Sets the segment file
+ * Returns 1 if successful or -1 on error
  */
-off64_t libewf_handle_seek_offset(
-         libewf_handle_t *handle,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libewf_handle_set_segment_filename(
+     libewf_handle_t *handle,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_seek_offset";
+	static char *function                     = "libewf_handle_set_segment_filename";
+	int result                                = 0;
 
 	if( handle == NULL )
 	{
@@ -6580,13 +10190,13 @@ off64_t libewf_handle_seek_offset(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->file_io_pool == NULL )
+	if( internal_handle->write_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing file IO pool.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: segment filename cannot be changed.",
 		 function );
 
 		return( -1 );
@@ -6606,19 +10216,19 @@ off64_t libewf_handle_seek_offset(
 		return( -1 );
 	}
 #endif
-	offset = libewf_internal_handle_seek_offset(
-	          internal_handle,
-	          offset,
-	          whence,
+	result = libewf_segment_table_set_basename(
+	          internal_handle->segment_table,
+	          filename,
+	          filename_length,
 	          error );
 
-	if( offset == -1 )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set segment table basename.",
 		 function );
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
@@ -6636,19 +10246,23 @@ off64_t libewf_handle_seek_offset(
 		return( -1 );
 	}
 #endif
-	return( offset );
+	return( result );
 }
 
-/* Retrieves the current offset of the (media) data
- * Returns 1 if successful or -1 on error
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Retrieves the segment filename size
+ * The filename size includes the end of string character
+ * Returns 1 if successful, 0 if not set or -1 on error
  */
-int libewf_handle_get_offset(
+int libewf_handle_get_segment_filename_size_wide(
      libewf_handle_t *handle,
-     off64_t *offset,
+     size_t *filename_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_offset";
+	static char *function                     = "libewf_handle_get_segment_filename_size_wide";
+	int result                                = 0;
 
 	if( handle == NULL )
 	{
@@ -6663,17 +10277,6 @@ int libewf_handle_get_offset(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( offset == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
@@ -6689,8 +10292,20 @@ int libewf_handle_get_offset(
 		return( -1 );
 	}
 #endif
-	*offset = internal_handle->current_offset;
+	result = libewf_segment_table_get_basename_size_wide(
+	          internal_handle->segment_table,
+	          filename_size,
+	          error );
 
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment table basename size.",
+		 function );
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
@@ -6706,20 +10321,22 @@ int libewf_handle_get_offset(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Sets the maximum number of (concurrent) open file handles
- * Returns 1 if successful or -1 on error
+/* Retrieves the segment filename
+ * The filename size should include the end of string character
+ * Returns 1 if successful, 0 if not set or -1 on error
  */
-int libewf_handle_set_maximum_number_of_open_handles(
+int libewf_handle_get_segment_filename_wide(
      libewf_handle_t *handle,
-     int maximum_number_of_open_handles,
+     wchar_t *filename,
+     size_t filename_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_maximum_number_of_open_handles";
-	int result                                = 1;
+	static char *function                     = "libewf_handle_get_segment_filename_wide";
+	int result                                = 0;
 
 	if( handle == NULL )
 	{
@@ -6735,7 +10352,7 @@ int libewf_handle_set_maximum_number_of_open_handles(
 	internal_handle = (libewf_internal_handle_t *) handle;
 
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -6743,35 +10360,29 @@ int libewf_handle_set_maximum_number_of_open_handles(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_handle->file_io_pool != NULL )
-	{
-		result = libbfio_pool_set_maximum_number_of_open_handles(
-		          internal_handle->file_io_pool,
-		          maximum_number_of_open_handles,
-		          error );
+	result = libewf_segment_table_get_basename_wide(
+	          internal_handle->segment_table,
+	          filename,
+	          filename_size,
+	          error );
 
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set maximum number of open handles in file IO pool.",
-			 function );
-		}
-	}
-	if( result == 1 )
+	if( result == -1 )
 	{
-		internal_handle->maximum_number_of_open_handles = maximum_number_of_open_handles;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment table basename.",
+		 function );
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -6779,7 +10390,7 @@ int libewf_handle_set_maximum_number_of_open_handles(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -6788,15 +10399,17 @@ int libewf_handle_set_maximum_number_of_open_handles(
 	return( result );
 }
 
-/* Determine if the segment files are corrupted
- * Returns 1 if corrupted, 0 if not or -1 on error
+/* Sets the segment file
+ * Returns 1 if successful or -1 on error
  */
-int libewf_handle_segment_files_corrupted(
+int libewf_handle_set_segment_filename_wide(
      libewf_handle_t *handle,
+     const wchar_t *filename,
+     size_t filename_length,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_segment_files_corrupted";
+	static char *function                     = "libewf_handle_set_segment_filename_wide";
 	int result                                = 0;
 
 	if( handle == NULL )
@@ -6812,19 +10425,19 @@ int libewf_handle_segment_files_corrupted(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->segment_table == NULL )
+	if( internal_handle->write_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing segment table.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: segment filename cannot be changed.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -6832,16 +10445,29 @@ int libewf_handle_segment_files_corrupted(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = ( internal_handle->segment_table->flags & LIBEWF_SEGMENT_TABLE_FLAG_IS_CORRUPTED ) != 0;
+	result = libewf_segment_table_set_basename_wide(
+	          internal_handle->segment_table,
+	          filename,
+	          filename_length,
+	          error );
 
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set segment table basename.",
+		 function );
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -6849,7 +10475,7 @@ int libewf_handle_segment_files_corrupted(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -6858,16 +10484,18 @@ int libewf_handle_segment_files_corrupted(
 	return( result );
 }
 
-/* Determine if the segment files are encrypted
- * Returns 1 if encrypted, 0 if not or -1 on error
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Retrieves the maximum segment file size
+ * Returns 1 if successful or -1 on error
  */
-int libewf_handle_segment_files_encrypted(
+int libewf_handle_get_maximum_segment_size(
      libewf_handle_t *handle,
+     size64_t *maximum_segment_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_segment_files_encrypted";
-	int result                                = 0;
+	static char *function                     = "libewf_handle_get_maximum_segment_size";
 
 	if( handle == NULL )
 	{
@@ -6882,13 +10510,24 @@ int libewf_handle_segment_files_encrypted(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
+	if( internal_handle->segment_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 "%s: invalid handle - missing segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_segment_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum segment size.",
 		 function );
 
 		return( -1 );
@@ -6908,7 +10547,7 @@ int libewf_handle_segment_files_encrypted(
 		return( -1 );
 	}
 #endif
-	result = (int) internal_handle->io_handle->is_encrypted;
+	*maximum_segment_size = internal_handle->segment_table->maximum_segment_size;
 
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -6925,21 +10564,23 @@ int libewf_handle_segment_files_encrypted(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the segment filename size
- * The filename size should include the end of string character
- * Returns 1 if successful, 0 if not set or -1 on error
+/* Sets the maximum segment file size
+ * A maximum segment file size of 0 represents the maximum possible size for the format
+ * If the maximum segment file size is smaller than the size needed to store a single chunk
+ * the size off the latter is enforced and not the maximum segment file size
+ * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_segment_filename_size(
+int libewf_handle_set_maximum_segment_size(
      libewf_handle_t *handle,
-     size_t *filename_size,
+     size64_t maximum_segment_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_segment_filename_size";
-	int result                                = 0;
+	static char *function                     = "libewf_handle_set_maximum_segment_size";
+	int result                                = 1;
 
 	if( handle == NULL )
 	{
@@ -6954,8 +10595,41 @@ int libewf_handle_get_segment_filename_size(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_segment_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum segment size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -6963,28 +10637,42 @@ int libewf_handle_get_segment_filename_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_handle->read_io_handle != NULL )
+	 || ( internal_handle->write_io_handle == NULL )
+	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: maximum segment size cannot be changed.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-#endif
-	result = libewf_segment_table_get_basename_size(
-	          internal_handle->segment_table,
-	          filename_size,
-	          error );
-
-	if( result == -1 )
+	else if( maximum_segment_size > internal_handle->write_io_handle->maximum_segment_file_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve segment table basename size.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment file size value out of bounds.",
 		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_handle->segment_table->maximum_segment_size = maximum_segment_size;
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -6992,7 +10680,7 @@ int libewf_handle_get_segment_filename_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -7001,18 +10689,18 @@ int libewf_handle_get_segment_filename_size(
 	return( result );
 }
 
-/* Retrieves the segment filename
+/* Retrieves the filename size of the segment file of the current chunk
  * The filename size should include the end of string character
- * Returns 1 if successful, 0 if not set or -1 on error
+ * Returns 1 if successful, 0 if no such filename or -1 on error
  */
-int libewf_handle_get_segment_filename(
+int libewf_handle_get_filename_size(
      libewf_handle_t *handle,
-     char *filename,
-     size_t filename_size,
+     size_t *filename_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_segment_filename";
+	libbfio_handle_t *file_io_handle          = NULL;
+	static char *function                     = "libewf_handle_get_filename_size";
 	int result                                = 0;
 
 	if( handle == NULL )
@@ -7043,10 +10731,9 @@ int libewf_handle_get_segment_filename(
 		return( -1 );
 	}
 #endif
-	result = libewf_segment_table_get_basename(
-	          internal_handle->segment_table,
-	          filename,
-	          filename_size,
+	result = libewf_internal_handle_get_file_io_handle(
+	          internal_handle,
+	          &file_io_handle,
 	          error );
 
 	if( result == -1 )
@@ -7055,9 +10742,26 @@ int libewf_handle_get_segment_filename(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve segment table basename.",
+		 "%s: unable to retrieve file IO handle for current chunk.",
 		 function );
 	}
+	else if( result != 0 )
+	{
+		result = libbfio_file_get_name_size(
+		          file_io_handle,
+		          filename_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename size.",
+			 function );
+		}
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
@@ -7076,17 +10780,19 @@ int libewf_handle_get_segment_filename(
 	return( result );
 }
 
-/* Sets the segment file
- * Returns 1 if successful or -1 on error
+/* Retrieves the filename of the segment file of the current chunk
+ * The filename size should include the end of string character
+ * Returns 1 if successful, 0 if no such filename or -1 on error
  */
-int libewf_handle_set_segment_filename(
+int libewf_handle_get_filename(
      libewf_handle_t *handle,
-     const char *filename,
-     size_t filename_length,
+     char *filename,
+     size_t filename_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_segment_filename";
+	libbfio_handle_t *file_io_handle          = NULL;
+	static char *function                     = "libewf_handle_get_filename";
 	int result                                = 0;
 
 	if( handle == NULL )
@@ -7102,19 +10808,8 @@ int libewf_handle_set_segment_filename(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->write_io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: segment filename cannot be changed.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -7122,29 +10817,46 @@ int libewf_handle_set_segment_filename(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = libewf_segment_table_set_basename(
-	          internal_handle->segment_table,
-	          filename,
-	          filename_length,
+	result = libewf_internal_handle_get_file_io_handle(
+	          internal_handle,
+	          &file_io_handle,
 	          error );
 
-	if( result != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set segment table basename.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle for current chunk.",
 		 function );
 	}
+	else if( result != 0 )
+	{
+		result = libbfio_file_get_name(
+		          file_io_handle,
+		          filename,
+		          filename_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename.",
+			 function );
+		}
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -7152,7 +10864,7 @@ int libewf_handle_set_segment_filename(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -7163,17 +10875,18 @@ int libewf_handle_set_segment_filename(
 
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
-/* Retrieves the segment filename size
+/* Retrieves the filename size of the segment file of the current chunk
  * The filename size includes the end of string character
- * Returns 1 if successful, 0 if not set or -1 on error
+ * Returns 1 if successful, 0 if no such filename or -1 on error
  */
-int libewf_handle_get_segment_filename_size_wide(
+int libewf_handle_get_filename_size_wide(
      libewf_handle_t *handle,
      size_t *filename_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_segment_filename_size_wide";
+	libbfio_handle_t *file_io_handle          = NULL;
+	static char *function                     = "libewf_handle_get_filename_size_wide";
 	int result                                = 0;
 
 	if( handle == NULL )
@@ -7204,9 +10917,9 @@ int libewf_handle_get_segment_filename_size_wide(
 		return( -1 );
 	}
 #endif
-	result = libewf_segment_table_get_basename_size_wide(
-	          internal_handle->segment_table,
-	          filename_size,
+	result = libewf_internal_handle_get_file_io_handle(
+	          internal_handle,
+	          &file_io_handle,
 	          error );
 
 	if( result == -1 )
@@ -7215,9 +10928,26 @@ int libewf_handle_get_segment_filename_size_wide(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve segment table basename size.",
+		 "%s: unable to retrieve file IO handle for current chunk.",
 		 function );
 	}
+	else if( result != 0 )
+	{
+		result = libbfio_file_get_name_size_wide(
+		          file_io_handle,
+		          filename_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename size.",
+			 function );
+		}
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
@@ -7236,18 +10966,19 @@ int libewf_handle_get_segment_filename_size_wide(
 	return( result );
 }
 
-/* Retrieves the segment filename
+/* Retrieves the filename of the segment file of the current chunk
  * The filename size should include the end of string character
- * Returns 1 if successful, 0 if not set or -1 on error
+ * Returns 1 if successful, 0 if no such filename or -1 on error
  */
-int libewf_handle_get_segment_filename_wide(
+int libewf_handle_get_filename_wide(
      libewf_handle_t *handle,
      wchar_t *filename,
      size_t filename_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_segment_filename_wide";
+	libbfio_handle_t *file_io_handle          = NULL;
+	static char *function                     = "libewf_handle_get_filename_wide";
 	int result                                = 0;
 
 	if( handle == NULL )
@@ -7278,10 +11009,9 @@ int libewf_handle_get_segment_filename_wide(
 		return( -1 );
 	}
 #endif
-	result = libewf_segment_table_get_basename_wide(
-	          internal_handle->segment_table,
-	          filename,
-	          filename_size,
+	result = libewf_internal_handle_get_file_io_handle(
+	          internal_handle,
+	          &file_io_handle,
 	          error );
 
 	if( result == -1 )
@@ -7290,9 +11020,27 @@ int libewf_handle_get_segment_filename_wide(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve segment table basename.",
+		 "%s: unable to retrieve file IO handle for current chunk.",
 		 function );
 	}
+	else if( result != 0 )
+	{
+		result = libbfio_file_get_name_wide(
+		          file_io_handle,
+		          filename,
+		          filename_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename.",
+			 function );
+		}
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
@@ -7311,20 +11059,24 @@ int libewf_handle_get_segment_filename_wide(
 	return( result );
 }
 
-/* Sets the segment file
- * Returns 1 if successful or -1 on error
+#endif
+
+/* Retrieves the file IO handle of the segment file of the current chunk
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful, 0 if no such file IO handle or -1 on error
  */
-int libewf_handle_set_segment_filename_wide(
-     libewf_handle_t *handle,
-     const wchar_t *filename,
-     size_t filename_length,
+int libewf_internal_handle_get_file_io_handle(
+     libewf_internal_handle_t *internal_handle,
+     libbfio_handle_t **file_io_handle,
      libcerror_error_t **error )
 {
-	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_segment_filename_wide";
-	int result                                = 0;
+	static char *function      = "libewf_internal_handle_get_file_io_handle";
+	size64_t segment_file_size = 0;
+	uint64_t chunk_index       = 0;
+	int file_io_pool_entry     = 0;
+	int result                 = 0;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -7335,79 +11087,110 @@ int libewf_handle_set_segment_filename_wide(
 
 		return( -1 );
 	}
-	internal_handle = (libewf_internal_handle_t *) handle;
-
-	if( internal_handle->write_io_handle == NULL )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: segment filename cannot be changed.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( internal_handle->current_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid handle - invalid IO handle - current offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = libewf_segment_table_set_basename_wide(
-	          internal_handle->segment_table,
-	          filename,
-	          filename_length,
-	          error );
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
 
-	if( result != 1 )
+		return( -1 );
+	}
+	if( internal_handle->media_values->chunk_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set segment table basename.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - invalid media values - missing chunk size.",
 		 function );
+
+		return( -1 );
 	}
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	chunk_index = internal_handle->current_offset / internal_handle->media_values->chunk_size;
+
+	result = libewf_segment_table_get_segment_at_offset(
+	          internal_handle->segment_table,
+	          internal_handle->current_offset,
+	          &file_io_pool_entry,
+	          &segment_file_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment at offset: %" PRIi64 " (0x%08" PRIx64 ") from segment table.",
+		 function,
+		 internal_handle->current_offset,
+		 internal_handle->current_offset );
 
 		return( -1 );
 	}
-#endif
+	else if( result != 0 )
+	{
+		if( file_io_pool_entry == -1 )
+		{
+			return( 0 );
+		}
+		if( libbfio_pool_get_handle(
+		     internal_handle->file_io_pool,
+		     file_io_pool_entry,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle: %d from pool (chunk: %" PRIu64 ").",
+			 function,
+			 file_io_pool_entry,
+			 chunk_index );
+
+			return( -1 );
+		}
+	}
 	return( result );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Retrieves the maximum segment file size
- * Returns 1 if successful or -1 on error
+/* Retrieves the file IO handle of the segment file of the current chunk
+ * Returns 1 if successful, 0 if no such file IO handle or -1 on error
  */
-int libewf_handle_get_maximum_segment_size(
+int libewf_handle_get_file_io_handle(
      libewf_handle_t *handle,
-     size64_t *maximum_segment_size,
+     libbfio_handle_t **file_io_handle,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_maximum_segment_size";
+	static char *function                     = "libewf_handle_get_file_io_handle";
+	int result                                = 0;
 
 	if( handle == NULL )
 	{
@@ -7422,28 +11205,6 @@ int libewf_handle_get_maximum_segment_size(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->segment_table == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing segment table.",
-		 function );
-
-		return( -1 );
-	}
-	if( maximum_segment_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid maximum segment size.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
@@ -7459,8 +11220,20 @@ int libewf_handle_get_maximum_segment_size(
 		return( -1 );
 	}
 #endif
-	*maximum_segment_size = internal_handle->segment_table->maximum_segment_size;
+	result = libewf_internal_handle_get_file_io_handle(
+	          internal_handle,
+	          file_io_handle,
+	          error );
 
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle for current chunk.",
+		 function );
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
@@ -7476,25 +11249,26 @@ int libewf_handle_get_maximum_segment_size(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Sets the maximum segment file size
- * A maximum segment file size of 0 represents the maximum possible size for the format
- * If the maximum segment file size is smaller than the size needed to store a single chunk
- * the size off the latter is enforced and not the maximum segment file size
+/* Retrieves the media values
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_set_maximum_segment_size(
-     libewf_handle_t *handle,
-     size64_t maximum_segment_size,
+int libewf_internal_handle_get_media_values(
+     libewf_internal_handle_t *internal_handle,
+     size64_t *media_size,
      libcerror_error_t **error )
 {
-	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_maximum_segment_size";
-	int result                                = 1;
+	libewf_chunk_data_t *chunk_data = NULL;
+	static char *function           = "libewf_internal_handle_get_media_values";
+	size64_t chunks_data_size       = 0;
+	size64_t sector_data_size       = 0;
+	size32_t chunk_size             = 0;
+	off64_t chunk_data_offset       = 0;
+	uint64_t chunk_index            = 0;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -7505,8 +11279,6 @@ int libewf_handle_set_maximum_segment_size(
 
 		return( -1 );
 	}
-	internal_handle = (libewf_internal_handle_t *) handle;
-
 	if( internal_handle->media_values == NULL )
 	{
 		libcerror_error_set(
@@ -7518,193 +11290,278 @@ int libewf_handle_set_maximum_segment_size(
 
 		return( -1 );
 	}
-	if( internal_handle->segment_table == NULL )
+	if( media_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing segment table.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media size.",
 		 function );
 
 		return( -1 );
 	}
-	if( maximum_segment_size > (size64_t) INT64_MAX )
+	sector_data_size = (size64_t) internal_handle->media_values->number_of_sectors * internal_handle->media_values->bytes_per_sector;
+
+	if( ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_READ ) != 0 )
+	 && ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_RESUME ) == 0 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid maximum segment size value exceeds maximum.",
-		 function );
+		chunk_size = (size32_t) internal_handle->media_values->sectors_per_chunk * internal_handle->media_values->bytes_per_sector;
 
-		return( -1 );
+		if( internal_handle->media_values->number_of_chunks > 0 )
+		{
+			internal_handle->current_offset = ( (off64_t) internal_handle->media_values->number_of_chunks - 1 ) * chunk_size;
+
+			if( libewf_chunk_table_get_chunk_data_by_offset(
+			     internal_handle->chunk_table,
+			     internal_handle->io_handle,
+			     internal_handle->file_io_pool,
+			     internal_handle->media_values,
+			     internal_handle->segment_table,
+			     internal_handle->current_offset,
+			     &chunk_data_offset,
+			     &chunk_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk data for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 internal_handle->current_offset,
+				 internal_handle->current_offset );
+
+				return( -1 );
+			}
+			if( chunk_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing chunk data for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 internal_handle->current_offset,
+				 internal_handle->current_offset );
+
+				return( -1 );
+			}
+			/* The only way to determine the size of the last compressed chunk is to unpack it
+			 */
+			if( libewf_chunk_data_unpack(
+			     chunk_data,
+			     internal_handle->io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to unpack chunk: %" PRIu64 " data.",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+			chunks_data_size = chunk_index * chunk_size;
+
+			if( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) == 0 )
+			{
+				chunks_data_size += chunk_data->data_size;
+			}
+			if( sector_data_size != chunks_data_size )
+			{
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: mismatch of media data size in volume: %" PRIu64 " and chunk table: %" PRIu64 "\n",
+					 function,
+					 sector_data_size,
+					 chunks_data_size );
+				}
+#endif
+				if( sector_data_size < chunks_data_size )
+				{
+					sector_data_size = chunks_data_size;
+				}
+			}
+		}
 	}
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	*media_size = sector_data_size;
+
+	return( 1 );
+}
+
+/* Sets the media values
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_internal_handle_set_media_values(
+     libewf_internal_handle_t *internal_handle,
+     uint32_t sectors_per_chunk,
+     uint32_t bytes_per_sector,
+     size64_t media_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "libewf_internal_handle_set_media_values";
+	size32_t chunk_size              = 0;
+	size64_t maximum_input_file_size = 0;
+	uint64_t number_of_chunks        = 0;
+	uint64_t number_of_sectors       = 0;
+
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( ( internal_handle->read_io_handle != NULL )
-	 || ( internal_handle->write_io_handle == NULL )
-	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
+	if( internal_handle->media_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: maximum segment size cannot be changed.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	else if( maximum_segment_size > internal_handle->write_io_handle->maximum_segment_file_size )
+	if( ( sectors_per_chunk == 0 )
+	 || ( sectors_per_chunk > (uint32_t) INT32_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid segment file size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sectors per chunk.",
 		 function );
 
-		result = -1;
-	}
-	else
-	{
-		internal_handle->segment_table->maximum_segment_size = maximum_segment_size;
+		return( -1 );
 	}
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( bytes_per_sector == 0 )
+	 || ( bytes_per_sector > (uint32_t) INT32_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bytes per sector.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
-}
-
-/* Retrieves the filename size of the segment file of the current chunk
- * The filename size should include the end of string character
- * Returns 1 if successful, 0 if no such filename or -1 on error
- */
-int libewf_handle_get_filename_size(
-     libewf_handle_t *handle,
-     size_t *filename_size,
-     libcerror_error_t **error )
-{
-	libewf_internal_handle_t *internal_handle = NULL;
-	libbfio_handle_t *file_io_handle          = NULL;
-	static char *function                     = "libewf_handle_get_filename_size";
-	int result                                = 0;
-
-	if( handle == NULL )
+	if( media_size > (size64_t) INT64_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid media size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libewf_internal_handle_t *) handle;
+	/* Determine the chunk size
+	 */
+	chunk_size = sectors_per_chunk * bytes_per_sector;
 
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size32_t) INT32_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = libewf_internal_handle_get_file_io_handle(
-	          internal_handle,
-	          &file_io_handle,
-	          error );
+	/* Check if the input file size does not exceed the maximum possible input file size
+	 * for the chunk size
+	 */
+	maximum_input_file_size = (size64_t) chunk_size * (size64_t) UINT32_MAX;
 
-	if( result == -1 )
+	if( media_size > maximum_input_file_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file IO handle for current chunk.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: media size cannot be larger than size: %" PRIu64 " with a chunk size of: %" PRIu32 ".",
+		 function,
+		 maximum_input_file_size,
+		 chunk_size );
+
+		return( -1 );
 	}
-	else if( result != 0 )
+	internal_handle->media_values->sectors_per_chunk = sectors_per_chunk;
+	internal_handle->media_values->bytes_per_sector  = bytes_per_sector;
+	internal_handle->media_values->chunk_size        = chunk_size;
+	internal_handle->media_values->media_size        = media_size;
+
+	/* If a media size was provided
+	 */
+	if( media_size > 0 )
 	{
-		result = libbfio_file_get_name_size(
-		          file_io_handle,
-		          filename_size,
-		          error );
+		/* Determine the number of chunks to write
+		 */
+		number_of_chunks = (uint64_t) media_size / (uint64_t) chunk_size;
 
-		if( result != 1 )
+		if( ( (uint64_t) media_size % (uint64_t) chunk_size ) != 0 )
+		{
+			number_of_chunks += 1;
+		}
+		if( number_of_chunks > (uint64_t) UINT32_MAX )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve filename size.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of chunks value exceeds maximum.",
 			 function );
+
+			return( -1 );
 		}
-	}
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		internal_handle->media_values->number_of_chunks = (uint64_t) number_of_chunks;
 
-		return( -1 );
+		/* Determine the number of sectors to write
+		 */
+		number_of_sectors = (uint64_t) media_size / (uint64_t) bytes_per_sector;
+
+		if( number_of_sectors > (uint64_t) INT64_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of sectors value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		internal_handle->media_values->number_of_sectors = number_of_sectors;
 	}
-#endif
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the filename of the segment file of the current chunk
- * The filename size should include the end of string character
- * Returns 1 if successful, 0 if no such filename or -1 on error
+/* Retrieves the root (single) file entry
+ * Returns 1 if successful, 0 if no file entries are present or -1 on error
  */
-int libewf_handle_get_filename(
+int libewf_handle_get_root_file_entry(
      libewf_handle_t *handle,
-     char *filename,
-     size_t filename_size,
+     libewf_file_entry_t **root_file_entry,
      libcerror_error_t **error )
 {
+	libcdata_tree_node_t *root_node           = NULL;
 	libewf_internal_handle_t *internal_handle = NULL;
-	libbfio_handle_t *file_io_handle          = NULL;
-	static char *function                     = "libewf_handle_get_filename";
+	static char *function                     = "libewf_handle_get_root_file_entry";
 	int result                                = 0;
 
 	if( handle == NULL )
@@ -7720,100 +11577,39 @@ int libewf_handle_get_filename(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
-
-		return( -1 );
-	}
-#endif
-	result = libewf_internal_handle_get_file_io_handle(
-	          internal_handle,
-	          &file_io_handle,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file IO handle for current chunk.",
-		 function );
-	}
-	else if( result != 0 )
-	{
-		result = libbfio_file_get_name(
-		          file_io_handle,
-		          filename,
-		          filename_size,
-		          error );
-
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve filename.",
-			 function );
-		}
-	}
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( internal_handle->single_files == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
-
-		return( -1 );
-	}
-#endif
-	return( result );
-}
-
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Retrieves the filename size of the segment file of the current chunk
- * The filename size includes the end of string character
- * Returns 1 if successful, 0 if no such filename or -1 on error
- */
-int libewf_handle_get_filename_size_wide(
-     libewf_handle_t *handle,
-     size_t *filename_size,
-     libcerror_error_t **error )
-{
-	libewf_internal_handle_t *internal_handle = NULL;
-	libbfio_handle_t *file_io_handle          = NULL;
-	static char *function                     = "libewf_handle_get_filename_size_wide";
-	int result                                = 0;
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing single files.",
+		 function );
 
-	if( handle == NULL )
+		return( -1 );
+	}
+	if( root_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid root file entry.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libewf_internal_handle_t *) handle;
+	if( *root_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: root file entry value already set.",
+		 function );
 
+		return( -1 );
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
@@ -7829,25 +11625,27 @@ int libewf_handle_get_filename_size_wide(
 		return( -1 );
 	}
 #endif
-	result = libewf_internal_handle_get_file_io_handle(
-	          internal_handle,
-	          &file_io_handle,
-	          error );
-
-	if( result == -1 )
+	if( libewf_single_files_get_file_entry_tree_root_node(
+	     internal_handle->single_files,
+	     &root_node,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file IO handle for current chunk.",
+		 "%s: unable to retrieve file entry tree root node.",
 		 function );
+
+		result = -1;
 	}
-	else if( result != 0 )
+	else if( root_node != NULL )
 	{
-		result = libbfio_file_get_name_size_wide(
-		          file_io_handle,
-		          filename_size,
+		result = libewf_file_entry_initialize(
+		          root_file_entry,
+		          handle,
+		          internal_handle->single_files,
+		          root_node,
 		          error );
 
 		if( result != 1 )
@@ -7855,9 +11653,11 @@ int libewf_handle_get_filename_size_wide(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve filename size.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create root file entry.",
 			 function );
+
+			result = -1;
 		}
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
@@ -7878,22 +11678,30 @@ int libewf_handle_get_filename_size_wide(
 	return( result );
 }
 
-/* Retrieves the filename of the segment file of the current chunk
- * The filename size should include the end of string character
- * Returns 1 if successful, 0 if no such filename or -1 on error
+/* Retrieves the (single) file entry for the specific UTF-8 encoded path
+ * The path separator is the \ character
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
-int libewf_handle_get_filename_wide(
-     libewf_handle_t *handle,
-     wchar_t *filename,
-     size_t filename_size,
+int libewf_internal_handle_get_file_entry_by_utf8_path(
+     libewf_internal_handle_t *internal_handle,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libewf_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
-	libewf_internal_handle_t *internal_handle = NULL;
-	libbfio_handle_t *file_io_handle          = NULL;
-	static char *function                     = "libewf_handle_get_filename_wide";
-	int result                                = 0;
+	libcdata_tree_node_t *node                  = NULL;
+	libcdata_tree_node_t *root_node             = NULL;
+	libcdata_tree_node_t *sub_node              = NULL;
+	libewf_lef_file_entry_t *lef_file_entry     = NULL;
+	libewf_lef_file_entry_t *sub_lef_file_entry = NULL;
+	uint8_t *utf8_string_segment                = NULL;
+	static char *function                       = "libewf_handle_get_file_entry_by_utf8_path";
+	size_t utf8_string_index                    = 0;
+	size_t utf8_string_segment_length           = 0;
+	int result                                  = 0;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -7904,187 +11712,189 @@ int libewf_handle_get_filename_wide(
 
 		return( -1 );
 	}
-	internal_handle = (libewf_internal_handle_t *) handle;
-
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( internal_handle->single_files == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing single files.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = libewf_internal_handle_get_file_io_handle(
-	          internal_handle,
-	          &file_io_handle,
-	          error );
-
-	if( result == -1 )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file IO handle for current chunk.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
 		 function );
-	}
-	else if( result != 0 )
-	{
-		result = libbfio_file_get_name_wide(
-		          file_io_handle,
-		          filename,
-		          filename_size,
-		          error );
 
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve filename.",
-			 function );
-		}
+		return( -1 );
 	}
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( utf8_string_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
-}
-
-#endif
-
-/* Retrieves the file IO handle of the segment file of the current chunk
- * This function is not multi-thread safe acquire write lock before call
- * Returns 1 if successful, 0 if no such file IO handle or -1 on error
- */
-int libewf_internal_handle_get_file_io_handle(
-     libewf_internal_handle_t *internal_handle,
-     libbfio_handle_t **file_io_handle,
-     libcerror_error_t **error )
-{
-	static char *function      = "libewf_internal_handle_get_file_io_handle";
-	size64_t segment_file_size = 0;
-	uint64_t chunk_index       = 0;
-	int file_io_pool_entry     = 0;
-	int result                 = 0;
-
-	if( internal_handle == NULL )
+	if( file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid file entry.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle == NULL )
+	if( *file_entry != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: file entry value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->current_offset < 0 )
+	if( libewf_single_files_get_file_entry_tree_root_node(
+	     internal_handle->single_files,
+	     &root_node,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid handle - invalid IO handle - current offset value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry tree root node.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( internal_handle->media_values == NULL )
+	else if( root_node == NULL )
+	{
+		return( 0 );
+	}
+	if( libcdata_tree_node_get_value(
+	     root_node,
+	     (intptr_t **) &lef_file_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from root file entry node.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->media_values->chunk_size == 0 )
+	if( lef_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - invalid media values - missing chunk size.",
+		 "%s: missing root file entry values.",
 		 function );
 
 		return( -1 );
 	}
-	chunk_index = internal_handle->current_offset / internal_handle->media_values->chunk_size;
-
-	result = libewf_segment_table_get_segment_at_offset(
-	          internal_handle->segment_table,
-	          internal_handle->current_offset,
-	          &file_io_pool_entry,
-	          &segment_file_size,
-	          error );
+	if( utf8_string_length > 0 )
+	{
+		/* Ignore a leading separator
+		 */
+		if( utf8_string[ utf8_string_index ] == (uint8_t) LIBEWF_SEPARATOR )
+		{
+			utf8_string_index++;
+		}
+	}
+	node = root_node;
 
-	if( result == -1 )
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length == 1 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve segment at offset: %" PRIi64 " (0x%08" PRIx64 ") from segment table.",
-		 function,
-		 internal_handle->current_offset,
-		 internal_handle->current_offset );
+		result = 1;
+	}
+	else while( utf8_string_index < utf8_string_length )
+	{
+		utf8_string_segment        = (uint8_t *) &( utf8_string[ utf8_string_index ] );
+		utf8_string_segment_length = 0;
+
+		while( utf8_string_index < utf8_string_length )
+		{
+			if( ( utf8_string[ utf8_string_index ] == (uint8_t) LIBEWF_SEPARATOR )
+			 || ( utf8_string[ utf8_string_index ] == (uint8_t) 0 ) )
+			{
+				utf8_string_index++;
+
+				break;
+			}
+			utf8_string_index++;
+
+			utf8_string_segment_length++;
+		}
+		if( utf8_string_segment_length == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sub file entry name.",
+			 function );
+
+			return( -1 );
+		}
+		result = libewf_single_file_tree_get_sub_node_by_utf8_name(
+			  node,
+			  utf8_string_segment,
+			  utf8_string_segment_length,
+			  &sub_node,
+			  &sub_lef_file_entry,
+			  error );
 
-		return( -1 );
-	}
-	else if( result != 0 )
-	{
-		if( file_io_pool_entry == -1 )
+		if( result == -1 )
 		{
-			return( 0 );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry sub node by name.",
+			 function );
+
+			return( -1 );
 		}
-		if( libbfio_pool_get_handle(
-		     internal_handle->file_io_pool,
-		     file_io_pool_entry,
-		     file_io_handle,
+		else if( result == 0 )
+		{
+			break;
+		}
+		node = sub_node;
+	}
+	if( result != 0 )
+	{
+		if( libewf_file_entry_initialize(
+		     file_entry,
+		     (libewf_handle_t *) internal_handle,
+		     internal_handle->single_files,
+		     node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file IO handle: %d from pool (chunk: %" PRIu64 ").",
-			 function,
-			 file_io_pool_entry,
-			 chunk_index );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
 
 			return( -1 );
 		}
@@ -8092,16 +11902,19 @@ int libewf_internal_handle_get_file_io_handle(
 	return( result );
 }
 
-/* Retrieves the file IO handle of the segment file of the current chunk
- * Returns 1 if successful, 0 if no such file IO handle or -1 on error
+/* Retrieves the (single) file entry for the specific UTF-8 encoded path
+ * The path separator is the \ character
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
-int libewf_handle_get_file_io_handle(
+int libewf_handle_get_file_entry_by_utf8_path(
      libewf_handle_t *handle,
-     libbfio_handle_t **file_io_handle,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libewf_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_file_io_handle";
+	static char *function                     = "libewf_handle_get_file_entry_by_utf8_path";
 	int result                                = 0;
 
 	if( handle == NULL )
@@ -8132,9 +11945,11 @@ int libewf_handle_get_file_io_handle(
 		return( -1 );
 	}
 #endif
-	result = libewf_internal_handle_get_file_io_handle(
+	result = libewf_internal_handle_get_file_entry_by_utf8_path(
 	          internal_handle,
-	          file_io_handle,
+	          utf8_string,
+	          utf8_string_length,
+	          file_entry,
 	          error );
 
 	if( result == -1 )
@@ -8143,7 +11958,7 @@ int libewf_handle_get_file_io_handle(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file IO handle for current chunk.",
+		 "%s: unable to retrieve file entry by UTF-8 path.",
 		 function );
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
@@ -8164,21 +11979,28 @@ int libewf_handle_get_file_io_handle(
 	return( result );
 }
 
-/* Retrieves the media values
- * Returns 1 if successful or -1 on error
+/* Retrieves the (single) file entry for the specific UTF-16 encoded path
+ * The path separator is the \ character
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
-int libewf_internal_handle_get_media_values(
+int libewf_internal_handle_get_file_entry_by_utf16_path(
      libewf_internal_handle_t *internal_handle,
-     size64_t *media_size,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libewf_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
-	libewf_chunk_data_t *chunk_data = NULL;
-	static char *function           = "libewf_internal_handle_get_media_values";
-	size64_t chunks_data_size       = 0;
-	size64_t sector_data_size       = 0;
-	size32_t chunk_size             = 0;
-	off64_t chunk_data_offset       = 0;
-	uint64_t chunk_index            = 0;
+	libcdata_tree_node_t *node                  = NULL;
+	libcdata_tree_node_t *root_node             = NULL;
+	libcdata_tree_node_t *sub_node              = NULL;
+	libewf_lef_file_entry_t *lef_file_entry     = NULL;
+	libewf_lef_file_entry_t *sub_lef_file_entry = NULL;
+	uint16_t *utf16_string_segment              = NULL;
+	static char *function                       = "libewf_handle_get_file_entry_by_utf16_path";
+	size_t utf16_string_index                   = 0;
+	size_t utf16_string_segment_length          = 0;
+	int result                                  = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -8191,289 +12013,209 @@ int libewf_internal_handle_get_media_values(
 
 		return( -1 );
 	}
-	if( internal_handle->media_values == NULL )
+	if( internal_handle->single_files == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
+		 "%s: invalid handle - missing single files.",
 		 function );
 
 		return( -1 );
 	}
-	if( media_size == NULL )
+	if( utf16_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid media size.",
+		 "%s: invalid UTF-16 string.",
 		 function );
 
 		return( -1 );
 	}
-	sector_data_size = (size64_t) internal_handle->media_values->number_of_sectors * internal_handle->media_values->bytes_per_sector;
-
-	if( ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_READ ) != 0 )
-	 && ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_RESUME ) == 0 ) )
+	if( utf16_string_length > (size_t) SSIZE_MAX )
 	{
-		chunk_size = (size32_t) internal_handle->media_values->sectors_per_chunk * internal_handle->media_values->bytes_per_sector;
-
-		if( internal_handle->media_values->number_of_chunks > 0 )
-		{
-			internal_handle->current_offset = ( (off64_t) internal_handle->media_values->number_of_chunks - 1 ) * chunk_size;
-
-			if( libewf_chunk_table_get_chunk_data_by_offset(
-			     internal_handle->chunk_table,
-			     internal_handle->io_handle,
-			     internal_handle->file_io_pool,
-			     internal_handle->media_values,
-			     internal_handle->segment_table,
-			     internal_handle->current_offset,
-			     &chunk_data_offset,
-			     &chunk_data,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve chunk data for offset: %" PRIi64 " (0x%08" PRIx64 ").",
-				 function,
-				 internal_handle->current_offset,
-				 internal_handle->current_offset );
-
-				return( -1 );
-			}
-			if( chunk_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing chunk data for offset: %" PRIi64 " (0x%08" PRIx64 ").",
-				 function,
-				 internal_handle->current_offset,
-				 internal_handle->current_offset );
-
-				return( -1 );
-			}
-			/* The only way to determine the size of the last compressed chunk is to unpack it
-			 */
-			if( libewf_chunk_data_unpack(
-			     chunk_data,
-			     internal_handle->io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to unpack chunk: %" PRIu64 " data.",
-				 function,
-				 chunk_index );
-
-				return( -1 );
-			}
-			chunks_data_size = chunk_index * chunk_size;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
 
-			if( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) == 0 )
-			{
-				chunks_data_size += chunk_data->data_size;
-			}
-			if( sector_data_size != chunks_data_size )
-			{
-#if defined( HAVE_VERBOSE_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: mismatch of media data size in volume: %" PRIu64 " and chunk table: %" PRIu64 "\n",
-					 function,
-					 sector_data_size,
-					 chunks_data_size );
-				}
-#endif
-				if( sector_data_size < chunks_data_size )
-				{
-					sector_data_size = chunks_data_size;
-				}
-			}
-		}
+		return( -1 );
 	}
-	*media_size = sector_data_size;
-
-	return( 1 );
-}
-
-/* Sets the media values
- * Returns 1 if successful or -1 on error
- */
-int libewf_internal_handle_set_media_values(
-     libewf_internal_handle_t *internal_handle,
-     uint32_t sectors_per_chunk,
-     uint32_t bytes_per_sector,
-     size64_t media_size,
-     libcerror_error_t **error )
-{
-	static char *function            = "libewf_internal_handle_set_media_values";
-	size32_t chunk_size              = 0;
-	size64_t maximum_input_file_size = 0;
-	uint64_t number_of_chunks        = 0;
-	uint64_t number_of_sectors       = 0;
-
-	if( internal_handle == NULL )
+	if( file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid file entry.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->media_values == NULL )
+	if( *file_entry != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: file entry value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( sectors_per_chunk == 0 )
-	 || ( sectors_per_chunk > (uint32_t) INT32_MAX ) )
+	if( libewf_single_files_get_file_entry_tree_root_node(
+	     internal_handle->single_files,
+	     &root_node,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sectors per chunk.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry tree root node.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( ( bytes_per_sector == 0 )
-	 || ( bytes_per_sector > (uint32_t) INT32_MAX ) )
+	else if( root_node == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid bytes per sector.",
-		 function );
-
-		return( -1 );
+		return( 0 );
 	}
-	if( media_size > (size64_t) INT64_MAX )
+	if( libcdata_tree_node_get_value(
+	     root_node,
+	     (intptr_t **) &lef_file_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid media size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from root file entry node.",
 		 function );
 
 		return( -1 );
 	}
-	/* Determine the chunk size
-	 */
-	chunk_size = sectors_per_chunk * bytes_per_sector;
-
-	if( ( chunk_size == 0 )
-	 || ( chunk_size > (size32_t) INT32_MAX ) )
+	if( lef_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid chunk size.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing root file entry values.",
 		 function );
 
 		return( -1 );
 	}
-	/* Check if the input file size does not exceed the maximum possible input file size
-	 * for the chunk size
-	 */
-	maximum_input_file_size = (size64_t) chunk_size * (size64_t) UINT32_MAX;
-
-	if( media_size > maximum_input_file_size )
+	if( utf16_string_length > 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: media size cannot be larger than size: %" PRIu64 " with a chunk size of: %" PRIu32 ".",
-		 function,
-		 maximum_input_file_size,
-		 chunk_size );
-
-		return( -1 );
+		/* Ignore a leading separator
+		 */
+		if( utf16_string[ utf16_string_index ] == (uint16_t) LIBEWF_SEPARATOR )
+		{
+			utf16_string_index++;
+		}
 	}
-	internal_handle->media_values->sectors_per_chunk = sectors_per_chunk;
-	internal_handle->media_values->bytes_per_sector  = bytes_per_sector;
-	internal_handle->media_values->chunk_size        = chunk_size;
-	internal_handle->media_values->media_size        = media_size;
+	node = root_node;
 
-	/* If a media size was provided
-	 */
-	if( media_size > 0 )
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length == 1 ) )
 	{
-		/* Determine the number of chunks to write
-		 */
-		number_of_chunks = (uint64_t) media_size / (uint64_t) chunk_size;
+		result = 1;
+	}
+	else while( utf16_string_index < utf16_string_length )
+	{
+		utf16_string_segment        = (uint16_t *) &( utf16_string[ utf16_string_index ] );
+		utf16_string_segment_length = 0;
 
-		if( ( (uint64_t) media_size % (uint64_t) chunk_size ) != 0 )
+		while( utf16_string_index < utf16_string_length )
 		{
-			number_of_chunks += 1;
+			if( ( utf16_string[ utf16_string_index ] == (uint16_t) LIBEWF_SEPARATOR )
+			 || ( utf16_string[ utf16_string_index ] == (uint16_t) 0 ) )
+			{
+				utf16_string_index++;
+
+				break;
+			}
+			utf16_string_index++;
+
+			utf16_string_segment_length++;
 		}
-		if( number_of_chunks > (uint64_t) UINT32_MAX )
+		if( utf16_string_segment_length == 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid number of chunks value exceeds maximum.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sub file entry name.",
 			 function );
 
 			return( -1 );
 		}
-		internal_handle->media_values->number_of_chunks = (uint64_t) number_of_chunks;
+		result = libewf_single_file_tree_get_sub_node_by_utf16_name(
+			  node,
+			  utf16_string_segment,
+			  utf16_string_segment_length,
+			  &sub_node,
+			  &sub_lef_file_entry,
+			  error );
 
-		/* Determine the number of sectors to write
-		 */
-		number_of_sectors = (uint64_t) media_size / (uint64_t) bytes_per_sector;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry sub node by name.",
+			 function );
 
-		if( number_of_sectors > (uint64_t) INT64_MAX )
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		node = sub_node;
+	}
+	if( result != 0 )
+	{
+		if( libewf_file_entry_initialize(
+		     file_entry,
+		     (libewf_handle_t *) internal_handle,
+		     internal_handle->single_files,
+		     node,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid number of sectors value exceeds maximum.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
 			 function );
 
 			return( -1 );
 		}
-		internal_handle->media_values->number_of_sectors = number_of_sectors;
 	}
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the root (single) file entry
- * Returns 1 if successful, 0 if no file entries are present or -1 on error
+/* Retrieves the (single) file entry for the specific UTF-16 encoded path
+ * The path separator is the \ character
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
-int libewf_handle_get_root_file_entry(
+int libewf_handle_get_file_entry_by_utf16_path(
      libewf_handle_t *handle,
-     libewf_file_entry_t **root_file_entry,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libewf_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *root_node           = NULL;
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_root_file_entry";
+	static char *function                     = "libewf_handle_get_file_entry_by_utf16_path";
 	int result                                = 0;
 
 	if( handle == NULL )
@@ -8489,35 +12231,115 @@ int libewf_handle_get_root_file_entry(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->single_files == NULL )
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing single files.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( root_file_entry == NULL )
+#endif
+	result = libewf_internal_handle_get_file_entry_by_utf16_path(
+	          internal_handle,
+	          utf16_string,
+	          utf16_string_length,
+	          file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry by UTF-16 path.",
+		 function );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the (single) file entry in the handle that corresponds with a file entry of another handle
+ * The handle must share the single files with the handle of the file entry, such as a handle
+ * created with libewf_handle_clone_shared, and the file entry data is read using the handle
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_get_file_entry_by_file_entry(
+     libewf_handle_t *handle,
+     libewf_file_entry_t *source_file_entry,
+     libewf_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libewf_internal_file_entry_t *internal_source_file_entry = NULL;
+	libewf_internal_handle_t *internal_handle                = NULL;
+	static char *function                                    = "libewf_handle_get_file_entry_by_file_entry";
+	int result                                               = 1;
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid root file entry.",
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( *root_file_entry != NULL )
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( source_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_source_file_entry = (libewf_internal_file_entry_t *) source_file_entry;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: root file entry value already set.",
+		 "%s: file entry value already set.",
 		 function );
 
 		return( -1 );
@@ -8537,40 +12359,43 @@ int libewf_handle_get_root_file_entry(
 		return( -1 );
 	}
 #endif
-	if( libewf_single_files_get_file_entry_tree_root_node(
-	     internal_handle->single_files,
-	     &root_node,
-	     error ) != 1 )
+	if( internal_handle->single_files == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry tree root node.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing single files.",
 		 function );
 
 		result = -1;
 	}
-	else if( root_node != NULL )
+	else if( internal_handle->single_files != internal_source_file_entry->single_files )
 	{
-		result = libewf_file_entry_initialize(
-		          root_file_entry,
-		          handle,
-		          internal_handle->single_files,
-		          root_node,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid source file entry - single files not shared with handle.",
+		 function );
 
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create root file entry.",
-			 function );
+		result = -1;
+	}
+	else if( libewf_file_entry_initialize(
+	          file_entry,
+	          handle,
+	          internal_handle->single_files,
+	          internal_source_file_entry->file_entry_tree_node,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
 
-			result = -1;
-		}
+		result = -1;
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -8584,36 +12409,28 @@ int libewf_handle_get_root_file_entry(
 		 "%s: unable to release read/write lock for reading.",
 		 function );
 
+		libewf_file_entry_free(
+		 file_entry,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
 	return( result );
 }
 
-/* Retrieves the (single) file entry for the specific UTF-8 encoded path
- * The path separator is the \ character
- * This function is not multi-thread safe acquire write lock before call
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves the number of sectors per chunk
+ * Returns 1 if successful or -1 on error
  */
-int libewf_internal_handle_get_file_entry_by_utf8_path(
-     libewf_internal_handle_t *internal_handle,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libewf_file_entry_t **file_entry,
+int libewf_handle_get_sectors_per_chunk(
+     libewf_handle_t *handle,
+     uint32_t *sectors_per_chunk,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *node                  = NULL;
-	libcdata_tree_node_t *root_node             = NULL;
-	libcdata_tree_node_t *sub_node              = NULL;
-	libewf_lef_file_entry_t *lef_file_entry     = NULL;
-	libewf_lef_file_entry_t *sub_lef_file_entry = NULL;
-	uint8_t *utf8_string_segment                = NULL;
-	static char *function                       = "libewf_handle_get_file_entry_by_utf8_path";
-	size_t utf8_string_index                    = 0;
-	size_t utf8_string_segment_length           = 0;
-	int result                                  = 0;
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_sectors_per_chunk";
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -8624,210 +12441,199 @@ int libewf_internal_handle_get_file_entry_by_utf8_path(
 
 		return( -1 );
 	}
-	if( internal_handle->single_files == NULL )
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->media_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing single files.",
+		 "%s: invalid handle - missing media values.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string == NULL )
+	if( sectors_per_chunk == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 "%s: invalid sectors per chunk.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_length > (size_t) SSIZE_MAX )
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_entry == NULL )
+#endif
+	if( internal_handle->media_values->sectors_per_chunk > (uint32_t) INT32_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sectors per chunk value exceeds maximum.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( *file_entry != NULL )
+	*sectors_per_chunk = internal_handle->media_values->sectors_per_chunk;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: file entry value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( libewf_single_files_get_file_entry_tree_root_node(
-	     internal_handle->single_files,
-	     &root_node,
-	     error ) != 1 )
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Sets the number of sectors per chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_set_sectors_per_chunk(
+     libewf_handle_t *handle,
+     uint32_t sectors_per_chunk,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_set_sectors_per_chunk";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry tree root node.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
-		result = -1;
-	}
-	else if( root_node == NULL )
-	{
-		return( 0 );
+		return( -1 );
 	}
-	if( libcdata_tree_node_get_value(
-	     root_node,
-	     (intptr_t **) &lef_file_entry,
-	     error ) != 1 )
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->media_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from root file entry node.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
 		 function );
 
 		return( -1 );
 	}
-	if( lef_file_entry == NULL )
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing root file entry values.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_length > 0 )
+#endif
+	if( ( internal_handle->read_io_handle != NULL )
+	 || ( internal_handle->write_io_handle == NULL )
+	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
 	{
-		/* Ignore a leading separator
-		 */
-		if( utf8_string[ utf8_string_index ] == (uint8_t) LIBEWF_SEPARATOR )
-		{
-			utf8_string_index++;
-		}
-	}
-	node = root_node;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: sectors per chunk cannot be changed.",
+		 function );
 
-	if( ( utf8_string_length == 0 )
-	 || ( utf8_string_length == 1 ) )
-	{
-		result = 1;
+		goto on_error;
 	}
-	else while( utf8_string_index < utf8_string_length )
+	if( libewf_internal_handle_set_media_values(
+	     internal_handle,
+	     sectors_per_chunk,
+	     internal_handle->media_values->bytes_per_sector,
+	     internal_handle->media_values->media_size,
+	     error ) != 1 )
 	{
-		utf8_string_segment        = (uint8_t *) &( utf8_string[ utf8_string_index ] );
-		utf8_string_segment_length = 0;
-
-		while( utf8_string_index < utf8_string_length )
-		{
-			if( ( utf8_string[ utf8_string_index ] == (uint8_t) LIBEWF_SEPARATOR )
-			 || ( utf8_string[ utf8_string_index ] == (uint8_t) 0 ) )
-			{
-				utf8_string_index++;
-
-				break;
-			}
-			utf8_string_index++;
-
-			utf8_string_segment_length++;
-		}
-		if( utf8_string_segment_length == 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing sub file entry name.",
-			 function );
-
-			return( -1 );
-		}
-		result = libewf_single_file_tree_get_sub_node_by_utf8_name(
-			  node,
-			  utf8_string_segment,
-			  utf8_string_segment_length,
-			  &sub_node,
-			  &sub_lef_file_entry,
-			  error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file entry sub node by name.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set media values.",
+		 function );
 
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			break;
-		}
-		node = sub_node;
+		goto on_error;
 	}
-	if( result != 0 )
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
-		if( libewf_file_entry_initialize(
-		     file_entry,
-		     (libewf_handle_t *) internal_handle,
-		     internal_handle->single_files,
-		     node,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	return( result );
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves the (single) file entry for the specific UTF-8 encoded path
- * The path separator is the \ character
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves the number of bytes per sector
+ * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_file_entry_by_utf8_path(
+int libewf_handle_get_bytes_per_sector(
      libewf_handle_t *handle,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libewf_file_entry_t **file_entry,
+     uint32_t *bytes_per_sector,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_file_entry_by_utf8_path";
-	int result                                = 0;
+	static char *function                     = "libewf_handle_get_bytes_per_sector";
 
 	if( handle == NULL )
 	{
@@ -8842,6 +12648,28 @@ int libewf_handle_get_file_entry_by_utf8_path(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_per_sector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
@@ -8857,22 +12685,19 @@ int libewf_handle_get_file_entry_by_utf8_path(
 		return( -1 );
 	}
 #endif
-	result = libewf_internal_handle_get_file_entry_by_utf8_path(
-	          internal_handle,
-	          utf8_string,
-	          utf8_string_length,
-	          file_entry,
-	          error );
-
-	if( result == -1 )
+	if( internal_handle->media_values->bytes_per_sector > (uint32_t) INT32_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry by UTF-8 path.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid bytes per sector value exceeds maximum.",
 		 function );
+
+		goto on_error;
 	}
+	*bytes_per_sector = internal_handle->media_values->bytes_per_sector;
+
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
@@ -8888,33 +12713,29 @@ int libewf_handle_get_file_entry_by_utf8_path(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves the (single) file entry for the specific UTF-16 encoded path
- * The path separator is the \ character
- * This function is not multi-thread safe acquire write lock before call
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Sets the number of bytes per sector
+ * Returns 1 if successful or -1 on error
  */
-int libewf_internal_handle_get_file_entry_by_utf16_path(
-     libewf_internal_handle_t *internal_handle,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libewf_file_entry_t **file_entry,
+int libewf_handle_set_bytes_per_sector(
+     libewf_handle_t *handle,
+     uint32_t bytes_per_sector,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *node                  = NULL;
-	libcdata_tree_node_t *root_node             = NULL;
-	libcdata_tree_node_t *sub_node              = NULL;
-	libewf_lef_file_entry_t *lef_file_entry     = NULL;
-	libewf_lef_file_entry_t *sub_lef_file_entry = NULL;
-	uint16_t *utf16_string_segment              = NULL;
-	static char *function                       = "libewf_handle_get_file_entry_by_utf16_path";
-	size_t utf16_string_index                   = 0;
-	size_t utf16_string_segment_length          = 0;
-	int result                                  = 0;
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_set_bytes_per_sector";
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -8925,210 +12746,199 @@ int libewf_internal_handle_get_file_entry_by_utf16_path(
 
 		return( -1 );
 	}
-	if( internal_handle->single_files == NULL )
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->media_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing single files.",
-		 function );
-
-		return( -1 );
-	}
-	if( utf16_string == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
+		 "%s: invalid handle - missing media values.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_length > (size_t) SSIZE_MAX )
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_entry == NULL )
+#endif
+	if( ( internal_handle->read_io_handle != NULL )
+	 || ( internal_handle->write_io_handle == NULL )
+	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: bytes per sector cannot be changed.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( *file_entry != NULL )
+	if( libewf_internal_handle_set_media_values(
+	     internal_handle,
+	     internal_handle->media_values->sectors_per_chunk,
+	     bytes_per_sector,
+	     internal_handle->media_values->media_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: file entry value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set media values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libewf_single_files_get_file_entry_tree_root_node(
-	     internal_handle->single_files,
-	     &root_node,
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry tree root node.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		result = -1;
-	}
-	else if( root_node == NULL )
-	{
-		return( 0 );
+		return( -1 );
 	}
-	if( libcdata_tree_node_get_value(
-	     root_node,
-	     (intptr_t **) &lef_file_entry,
-	     error ) != 1 )
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the number of sectors
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_get_number_of_sectors(
+     libewf_handle_t *handle,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_number_of_sectors";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from root file entry node.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( lef_file_entry == NULL )
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->media_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing root file entry values.",
+		 "%s: invalid handle - missing media values.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_length > 0 )
-	{
-		/* Ignore a leading separator
-		 */
-		if( utf16_string[ utf16_string_index ] == (uint16_t) LIBEWF_SEPARATOR )
-		{
-			utf16_string_index++;
-		}
-	}
-	node = root_node;
-
-	if( ( utf16_string_length == 0 )
-	 || ( utf16_string_length == 1 ) )
-	{
-		result = 1;
-	}
-	else while( utf16_string_index < utf16_string_length )
+	if( number_of_sectors == NULL )
 	{
-		utf16_string_segment        = (uint16_t *) &( utf16_string[ utf16_string_index ] );
-		utf16_string_segment_length = 0;
-
-		while( utf16_string_index < utf16_string_length )
-		{
-			if( ( utf16_string[ utf16_string_index ] == (uint16_t) LIBEWF_SEPARATOR )
-			 || ( utf16_string[ utf16_string_index ] == (uint16_t) 0 ) )
-			{
-				utf16_string_index++;
-
-				break;
-			}
-			utf16_string_index++;
-
-			utf16_string_segment_length++;
-		}
-		if( utf16_string_segment_length == 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing sub file entry name.",
-			 function );
-
-			return( -1 );
-		}
-		result = libewf_single_file_tree_get_sub_node_by_utf16_name(
-			  node,
-			  utf16_string_segment,
-			  utf16_string_segment_length,
-			  &sub_node,
-			  &sub_lef_file_entry,
-			  error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes per sector.",
+		 function );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file entry sub node by name.",
-			 function );
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			break;
-		}
-		node = sub_node;
+		return( -1 );
 	}
-	if( result != 0 )
+#endif
+	if( internal_handle->media_values->number_of_sectors > (uint64_t) INT64_MAX )
 	{
-		if( libewf_file_entry_initialize(
-		     file_entry,
-		     (libewf_handle_t *) internal_handle,
-		     internal_handle->single_files,
-		     node,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of sectors value exceeds maximum.",
+		 function );
 
-			return( -1 );
-		}
+		goto on_error;
 	}
-	return( result );
+	*number_of_sectors = internal_handle->media_values->number_of_sectors;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves the (single) file entry for the specific UTF-16 encoded path
- * The path separator is the \ character
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves the chunk size
+ * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_file_entry_by_utf16_path(
+int libewf_handle_get_chunk_size(
      libewf_handle_t *handle,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libewf_file_entry_t **file_entry,
+     size32_t *chunk_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_file_entry_by_utf16_path";
-	int result                                = 0;
+	static char *function                     = "libewf_handle_get_chunk_size";
 
 	if( handle == NULL )
 	{
@@ -9143,6 +12953,28 @@ int libewf_handle_get_file_entry_by_utf16_path(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
+	if( internal_handle->media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk size.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
@@ -9158,22 +12990,19 @@ int libewf_handle_get_file_entry_by_utf16_path(
 		return( -1 );
 	}
 #endif
-	result = libewf_internal_handle_get_file_entry_by_utf16_path(
-	          internal_handle,
-	          utf16_string,
-	          utf16_string_length,
-	          file_entry,
-	          error );
-
-	if( result == -1 )
+	if( internal_handle->media_values->chunk_size > (size32_t) INT32_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry by UTF-16 path.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk size value exceeds maximum.",
 		 function );
+
+		goto on_error;
 	}
+	*chunk_size = internal_handle->media_values->chunk_size;
+
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
@@ -9189,19 +13018,27 @@ int libewf_handle_get_file_entry_by_utf16_path(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves the number of sectors per chunk
+/* Retrieves the error granularity
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_sectors_per_chunk(
+int libewf_handle_get_error_granularity(
      libewf_handle_t *handle,
-     uint32_t *sectors_per_chunk,
+     uint32_t *error_granularity,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_sectors_per_chunk";
+	static char *function                     = "libewf_handle_get_error_granularity";
 
 	if( handle == NULL )
 	{
@@ -9227,13 +13064,13 @@ int libewf_handle_get_sectors_per_chunk(
 
 		return( -1 );
 	}
-	if( sectors_per_chunk == NULL )
+	if( error_granularity == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sectors per chunk.",
+		 "%s: invalid error granularity.",
 		 function );
 
 		return( -1 );
@@ -9253,18 +13090,18 @@ int libewf_handle_get_sectors_per_chunk(
 		return( -1 );
 	}
 #endif
-	if( internal_handle->media_values->sectors_per_chunk > (uint32_t) INT32_MAX )
+	if( internal_handle->media_values->error_granularity > (uint32_t) INT32_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid sectors per chunk value exceeds maximum.",
+		 "%s: invalid error granularity value exceeds maximum.",
 		 function );
 
 		goto on_error;
 	}
-	*sectors_per_chunk = internal_handle->media_values->sectors_per_chunk;
+	*error_granularity = internal_handle->media_values->error_granularity;
 
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -9292,16 +13129,16 @@ on_error:
 	return( -1 );
 }
 
-/* Sets the number of sectors per chunk
+/* Sets the error granularity
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_set_sectors_per_chunk(
+int libewf_handle_set_error_granularity(
      libewf_handle_t *handle,
-     uint32_t sectors_per_chunk,
+     uint32_t error_granularity,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_sectors_per_chunk";
+	static char *function                     = "libewf_handle_set_error_granularity";
 
 	if( handle == NULL )
 	{
@@ -9342,35 +13179,20 @@ int libewf_handle_set_sectors_per_chunk(
 		return( -1 );
 	}
 #endif
-	if( ( internal_handle->read_io_handle != NULL )
-	 || ( internal_handle->write_io_handle == NULL )
+	if( ( internal_handle->write_io_handle == NULL )
 	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: sectors per chunk cannot be changed.",
+		 "%s: error granularity cannot be changed.",
 		 function );
 
 		goto on_error;
 	}
-	if( libewf_internal_handle_set_media_values(
-	     internal_handle,
-	     sectors_per_chunk,
-	     internal_handle->media_values->bytes_per_sector,
-	     internal_handle->media_values->media_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set media values.",
-		 function );
+	internal_handle->media_values->error_granularity = error_granularity;
 
-		goto on_error;
-	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
@@ -9397,16 +13219,16 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the number of bytes per sector
+/* Retrieves the compression method
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_bytes_per_sector(
+int libewf_handle_get_compression_method(
      libewf_handle_t *handle,
-     uint32_t *bytes_per_sector,
+     uint16_t *compression_method,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_bytes_per_sector";
+	static char *function                     = "libewf_handle_get_compression_method";
 
 	if( handle == NULL )
 	{
@@ -9421,24 +13243,24 @@ int libewf_handle_get_bytes_per_sector(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->media_values == NULL )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( bytes_per_sector == NULL )
+	if( compression_method == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid bytes per sector.",
+		 "%s: invalid compression method.",
 		 function );
 
 		return( -1 );
@@ -9458,18 +13280,7 @@ int libewf_handle_get_bytes_per_sector(
 		return( -1 );
 	}
 #endif
-	if( internal_handle->media_values->bytes_per_sector > (uint32_t) INT32_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid bytes per sector value exceeds maximum.",
-		 function );
-
-		goto on_error;
-	}
-	*bytes_per_sector = internal_handle->media_values->bytes_per_sector;
+	*compression_method = internal_handle->io_handle->compression_method;
 
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -9487,26 +13298,18 @@ int libewf_handle_get_bytes_per_sector(
 	}
 #endif
 	return( 1 );
-
-on_error:
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_read(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
 }
 
-/* Sets the number of bytes per sector
+/* Sets the compression method
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_set_bytes_per_sector(
+int libewf_handle_set_compression_method(
      libewf_handle_t *handle,
-     uint32_t bytes_per_sector,
+     uint16_t compression_method,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_bytes_per_sector";
+	static char *function                     = "libewf_handle_set_compression_method";
 
 	if( handle == NULL )
 	{
@@ -9521,13 +13324,25 @@ int libewf_handle_set_bytes_per_sector(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->media_values == NULL )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compression_method != LIBEWF_COMPRESSION_METHOD_DEFLATE )
+	 && ( compression_method != LIBEWF_COMPRESSION_METHOD_BZIP2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression method.",
 		 function );
 
 		return( -1 );
@@ -9547,35 +13362,33 @@ int libewf_handle_set_bytes_per_sector(
 		return( -1 );
 	}
 #endif
-	if( ( internal_handle->read_io_handle != NULL )
-	 || ( internal_handle->write_io_handle == NULL )
+	if( ( internal_handle->write_io_handle == NULL )
 	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: bytes per sector cannot be changed.",
+		 "%s: compression values cannot be changed.",
 		 function );
 
 		goto on_error;
 	}
-	if( libewf_internal_handle_set_media_values(
-	     internal_handle,
-	     internal_handle->media_values->sectors_per_chunk,
-	     bytes_per_sector,
-	     internal_handle->media_values->media_size,
-	     error ) != 1 )
+	if( ( compression_method == LIBEWF_COMPRESSION_METHOD_BZIP2 )
+	 && ( internal_handle->io_handle->segment_file_type != LIBEWF_SEGMENT_FILE_TYPE_EWF2 )
+	 && ( internal_handle->io_handle->segment_file_type != LIBEWF_SEGMENT_FILE_TYPE_EWF2_LOGICAL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set media values.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: compression method not supported by format.",
 		 function );
 
 		goto on_error;
 	}
+	internal_handle->io_handle->compression_method = compression_method;
+
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
@@ -9602,16 +13415,17 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the number of sectors
+/* Retrieves the compression values
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_number_of_sectors(
+int libewf_handle_get_compression_values(
      libewf_handle_t *handle,
-     uint64_t *number_of_sectors,
+     int8_t *compression_level,
+     uint8_t *compression_flags,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_number_of_sectors";
+	static char *function                     = "libewf_handle_get_compression_values";
 
 	if( handle == NULL )
 	{
@@ -9626,24 +13440,35 @@ int libewf_handle_get_number_of_sectors(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->media_values == NULL )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_sectors == NULL )
+	if( compression_level == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid bytes per sector.",
+		 "%s: invalid compression level.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression flags.",
 		 function );
 
 		return( -1 );
@@ -9663,18 +13488,8 @@ int libewf_handle_get_number_of_sectors(
 		return( -1 );
 	}
 #endif
-	if( internal_handle->media_values->number_of_sectors > (uint64_t) INT64_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid number of sectors value exceeds maximum.",
-		 function );
-
-		goto on_error;
-	}
-	*number_of_sectors = internal_handle->media_values->number_of_sectors;
+	*compression_level = internal_handle->io_handle->compression_level;
+	*compression_flags = internal_handle->io_handle->compression_flags;
 
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -9692,26 +13507,19 @@ int libewf_handle_get_number_of_sectors(
 	}
 #endif
 	return( 1 );
-
-on_error:
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_read(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
 }
 
-/* Retrieves the chunk size
+/* Sets the compression values
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_chunk_size(
+int libewf_handle_set_compression_values(
      libewf_handle_t *handle,
-     size32_t *chunk_size,
+     int8_t compression_level,
+     uint8_t compression_flags,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_chunk_size";
+	static char *function                     = "libewf_handle_set_compression_values";
 
 	if( handle == NULL )
 	{
@@ -9726,30 +13534,43 @@ int libewf_handle_get_chunk_size(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->media_values == NULL )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( chunk_size == NULL )
+	if( ( compression_level != LIBEWF_COMPRESSION_LEVEL_NONE )
+	 && ( compression_level != LIBEWF_COMPRESSION_LEVEL_FAST )
+	 && ( compression_level != LIBEWF_COMPRESSION_LEVEL_BEST ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid chunk size.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compression_flags & ~( LIBEWF_COMPRESS_FLAG_USE_EMPTY_BLOCK_COMPRESSION ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression flags.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -9757,27 +13578,34 @@ int libewf_handle_get_chunk_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_handle->media_values->chunk_size > (size32_t) INT32_MAX )
+	if( ( internal_handle->write_io_handle == NULL )
+	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid chunk size value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: compression values cannot be changed.",
 		 function );
 
 		goto on_error;
 	}
-	*chunk_size = internal_handle->media_values->chunk_size;
+	if( ( internal_handle->io_handle->segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF2 )
+	 && ( internal_handle->io_handle->segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF2_LOGICAL ) )
+	{
+		compression_flags |= LIBEWF_COMPRESS_FLAG_USE_PATTERN_FILL_COMPRESSION;
+	}
+	internal_handle->io_handle->compression_level = compression_level;
+	internal_handle->io_handle->compression_flags = compression_flags;
 
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -9785,7 +13613,7 @@ int libewf_handle_get_chunk_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -9795,23 +13623,23 @@ int libewf_handle_get_chunk_size(
 
 on_error:
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_read(
+	libcthreads_read_write_lock_release_for_write(
 	 internal_handle->read_write_lock,
 	 NULL );
 #endif
 	return( -1 );
 }
 
-/* Retrieves the error granularity
+/* Retrieves the size of the contained media data
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_error_granularity(
+int libewf_handle_get_media_size(
      libewf_handle_t *handle,
-     uint32_t *error_granularity,
+     size64_t *media_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_error_granularity";
+	static char *function                     = "libewf_handle_get_media_size";
 
 	if( handle == NULL )
 	{
@@ -9837,13 +13665,13 @@ int libewf_handle_get_error_granularity(
 
 		return( -1 );
 	}
-	if( error_granularity == NULL )
+	if( media_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid error granularity.",
+		 "%s: invalid media size.",
 		 function );
 
 		return( -1 );
@@ -9863,18 +13691,7 @@ int libewf_handle_get_error_granularity(
 		return( -1 );
 	}
 #endif
-	if( internal_handle->media_values->error_granularity > (uint32_t) INT32_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid error granularity value exceeds maximum.",
-		 function );
-
-		goto on_error;
-	}
-	*error_granularity = internal_handle->media_values->error_granularity;
+	*media_size = internal_handle->media_values->media_size;
 
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -9892,26 +13709,18 @@ int libewf_handle_get_error_granularity(
 	}
 #endif
 	return( 1 );
-
-on_error:
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_read(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
 }
 
-/* Sets the error granularity
+/* Sets the media size
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_set_error_granularity(
+int libewf_handle_set_media_size(
      libewf_handle_t *handle,
-     uint32_t error_granularity,
+     size64_t media_size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_error_granularity";
+	static char *function                     = "libewf_handle_set_media_size";
 
 	if( handle == NULL )
 	{
@@ -9952,20 +13761,35 @@ int libewf_handle_set_error_granularity(
 		return( -1 );
 	}
 #endif
-	if( ( internal_handle->write_io_handle == NULL )
+	if( ( internal_handle->read_io_handle != NULL )
+	 || ( internal_handle->write_io_handle == NULL )
 	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: error granularity cannot be changed.",
+		 "%s: media size cannot be changed.",
 		 function );
 
 		goto on_error;
 	}
-	internal_handle->media_values->error_granularity = error_granularity;
+	if( libewf_internal_handle_set_media_values(
+	     internal_handle,
+	     internal_handle->media_values->sectors_per_chunk,
+	     internal_handle->media_values->bytes_per_sector,
+	     media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set media values.",
+		 function );
 
+		goto on_error;
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
@@ -9992,16 +13816,16 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the compression method
+/* Retrieves the media type value
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_compression_method(
+int libewf_handle_get_media_type(
      libewf_handle_t *handle,
-     uint16_t *compression_method,
+     uint8_t *media_type,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_compression_method";
+	static char *function                     = "libewf_handle_get_media_type";
 
 	if( handle == NULL )
 	{
@@ -10016,24 +13840,35 @@ int libewf_handle_get_compression_method(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
+	if( internal_handle->media_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 "%s: invalid handle - missing media values.",
 		 function );
 
 		return( -1 );
 	}
-	if( compression_method == NULL )
+	if( internal_handle->media_values->media_type > (uint8_t) INT8_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid media type value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_type == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compression method.",
+		 "%s: invalid media type.",
 		 function );
 
 		return( -1 );
@@ -10053,7 +13888,7 @@ int libewf_handle_get_compression_method(
 		return( -1 );
 	}
 #endif
-	*compression_method = internal_handle->io_handle->compression_method;
+	*media_type = internal_handle->media_values->media_type;
 
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -10073,16 +13908,16 @@ int libewf_handle_get_compression_method(
 	return( 1 );
 }
 
-/* Sets the compression method
+/* Sets the media type
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_set_compression_method(
+int libewf_handle_set_media_type(
      libewf_handle_t *handle,
-     uint16_t compression_method,
+     uint8_t media_type,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_compression_method";
+	static char *function                     = "libewf_handle_set_media_type";
 
 	if( handle == NULL )
 	{
@@ -10097,25 +13932,13 @@ int libewf_handle_set_compression_method(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
+	if( internal_handle->media_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( compression_method != LIBEWF_COMPRESSION_METHOD_DEFLATE )
-	 && ( compression_method != LIBEWF_COMPRESSION_METHOD_BZIP2 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported compression method.",
+		 "%s: invalid handle - missing media values.",
 		 function );
 
 		return( -1 );
@@ -10134,33 +13957,21 @@ int libewf_handle_set_compression_method(
 
 		return( -1 );
 	}
-#endif
-	if( ( internal_handle->write_io_handle == NULL )
-	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: compression values cannot be changed.",
-		 function );
-
-		goto on_error;
-	}
-	if( ( compression_method == LIBEWF_COMPRESSION_METHOD_BZIP2 )
-	 && ( internal_handle->io_handle->segment_file_type != LIBEWF_SEGMENT_FILE_TYPE_EWF2 )
-	 && ( internal_handle->io_handle->segment_file_type != LIBEWF_SEGMENT_FILE_TYPE_EWF2_LOGICAL ) )
+#endif
+	if( ( internal_handle->read_io_handle != NULL )
+	 || ( internal_handle->write_io_handle == NULL )
+	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: compression method not supported by format.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: media type cannot be changed.",
 		 function );
 
 		goto on_error;
 	}
-	internal_handle->io_handle->compression_method = compression_method;
+	internal_handle->media_values->media_type = media_type;
 
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -10188,17 +13999,16 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the compression values
+/* Retrieves the media flags
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_compression_values(
+int libewf_handle_get_media_flags(
      libewf_handle_t *handle,
-     int8_t *compression_level,
-     uint8_t *compression_flags,
+     uint8_t *media_flags,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_compression_values";
+	static char *function                     = "libewf_handle_get_media_flags";
 
 	if( handle == NULL )
 	{
@@ -10213,35 +14023,24 @@ int libewf_handle_get_compression_values(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
+	if( internal_handle->media_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( compression_level == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compression level.",
+		 "%s: invalid handle - missing media values.",
 		 function );
 
 		return( -1 );
 	}
-	if( compression_flags == NULL )
+	if( media_flags == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compression flags.",
+		 "%s: invalid media flags.",
 		 function );
 
 		return( -1 );
@@ -10261,8 +14060,18 @@ int libewf_handle_get_compression_values(
 		return( -1 );
 	}
 #endif
-	*compression_level = internal_handle->io_handle->compression_level;
-	*compression_flags = internal_handle->io_handle->compression_flags;
+	if( internal_handle->media_values->media_flags > (uint8_t) INT8_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid media flags value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	*media_flags = internal_handle->media_values->media_flags;
 
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -10280,19 +14089,26 @@ int libewf_handle_get_compression_values(
 	}
 #endif
 	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Sets the compression values
+/* Sets the media flags
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_set_compression_values(
+int libewf_handle_set_media_flags(
      libewf_handle_t *handle,
-     int8_t compression_level,
-     uint8_t compression_flags,
+     uint8_t media_flags,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_compression_values";
+	static char *function                     = "libewf_handle_set_media_flags";
 
 	if( handle == NULL )
 	{
@@ -10307,37 +14123,13 @@ int libewf_handle_set_compression_values(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
+	if( internal_handle->media_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( compression_level != LIBEWF_COMPRESSION_LEVEL_NONE )
-	 && ( compression_level != LIBEWF_COMPRESSION_LEVEL_FAST )
-	 && ( compression_level != LIBEWF_COMPRESSION_LEVEL_BEST ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported compression level.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( compression_flags & ~( LIBEWF_COMPRESS_FLAG_USE_EMPTY_BLOCK_COMPRESSION ) ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported compression flags.",
+		 "%s: invalid handle - missing media values.",
 		 function );
 
 		return( -1 );
@@ -10357,25 +14149,24 @@ int libewf_handle_set_compression_values(
 		return( -1 );
 	}
 #endif
-	if( ( internal_handle->write_io_handle == NULL )
+	if( ( internal_handle->read_io_handle != NULL )
+	 || ( internal_handle->write_io_handle == NULL )
 	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: compression values cannot be changed.",
+		 "%s: media flags cannot be changed.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( internal_handle->io_handle->segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF2 )
-	 && ( internal_handle->io_handle->segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF2_LOGICAL ) )
-	{
-		compression_flags |= LIBEWF_COMPRESS_FLAG_USE_PATTERN_FILL_COMPRESSION;
-	}
-	internal_handle->io_handle->compression_level = compression_level;
-	internal_handle->io_handle->compression_flags = compression_flags;
+	internal_handle->media_values->media_flags = media_flags;
+
+	/* Make sure the lowest bit is always set
+	 */
+	internal_handle->media_values->media_flags |= 0x01;
 
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -10403,16 +14194,17 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the size of the contained media data
+/* Retrieves the format type value
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_media_size(
+int libewf_handle_get_format(
      libewf_handle_t *handle,
-     size64_t *media_size,
+     uint8_t *format,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_media_size";
+	static char *function                     = "libewf_handle_get_format";
+	int result                                = 1;
 
 	if( handle == NULL )
 	{
@@ -10427,6 +14219,17 @@ int libewf_handle_get_media_size(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_handle->media_values == NULL )
 	{
 		libcerror_error_set(
@@ -10438,13 +14241,13 @@ int libewf_handle_get_media_size(
 
 		return( -1 );
 	}
-	if( media_size == NULL )
+	if( format == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid media size.",
+		 "%s: invalid format.",
 		 function );
 
 		return( -1 );
@@ -10464,8 +14267,21 @@ int libewf_handle_get_media_size(
 		return( -1 );
 	}
 #endif
-	*media_size = internal_handle->media_values->media_size;
+	if( internal_handle->io_handle->format > (uint8_t) INT8_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid format value exceeds maximum.",
+		 function );
 
+		result = -1;
+	}
+	else
+	{
+		*format = internal_handle->io_handle->format;
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
@@ -10481,19 +14297,19 @@ int libewf_handle_get_media_size(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Sets the media size
+/* Sets the output format
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_set_media_size(
+int libewf_handle_set_format(
      libewf_handle_t *handle,
-     size64_t media_size,
+     uint8_t format,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_media_size";
+	static char *function                     = "libewf_handle_set_format";
 
 	if( handle == NULL )
 	{
@@ -10508,17 +14324,49 @@ int libewf_handle_set_media_size(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->media_values == NULL )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
+	if( ( format != LIBEWF_FORMAT_ENCASE1 )
+	 && ( format != LIBEWF_FORMAT_ENCASE2 )
+	 && ( format != LIBEWF_FORMAT_ENCASE3 )
+	 && ( format != LIBEWF_FORMAT_ENCASE4 )
+	 && ( format != LIBEWF_FORMAT_ENCASE5 )
+	 && ( format != LIBEWF_FORMAT_ENCASE6 )
+	 && ( format != LIBEWF_FORMAT_ENCASE7 )
+	 && ( format != LIBEWF_FORMAT_SMART )
+	 && ( format != LIBEWF_FORMAT_FTK_IMAGER )
+	 && ( format != LIBEWF_FORMAT_LINEN5 )
+	 && ( format != LIBEWF_FORMAT_LINEN6 )
+	 && ( format != LIBEWF_FORMAT_LINEN7 )
+	 && ( format != LIBEWF_FORMAT_V2_ENCASE7 )
+/* TODO add support for: L01, Lx01:
+	 && ( format != LIBEWF_FORMAT_LOGICAL_ENCASE5 )
+	 && ( format != LIBEWF_FORMAT_LOGICAL_ENCASE6 )
+	 && ( format != LIBEWF_FORMAT_LOGICAL_ENCASE7 )
+	 && ( format != LIBEWF_FORMAT_V2_LOGICAL_ENCASE7 )
+*/
+	 && ( format != LIBEWF_FORMAT_EWF )
+	 && ( format != LIBEWF_FORMAT_EWFX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format: %d.",
+		 function,
+	         format );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
@@ -10542,26 +14390,71 @@ int libewf_handle_set_media_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: media size cannot be changed.",
+		 "%s: format cannot be changed.",
 		 function );
 
 		goto on_error;
 	}
-	if( libewf_internal_handle_set_media_values(
-	     internal_handle,
-	     internal_handle->media_values->sectors_per_chunk,
-	     internal_handle->media_values->bytes_per_sector,
-	     media_size,
-	     error ) != 1 )
+/* TODO refactor into separate function */
+	internal_handle->io_handle->format = format;
+
+	if( format == LIBEWF_FORMAT_V2_ENCASE7 )
+	{
+		internal_handle->io_handle->major_version = 2;
+		internal_handle->io_handle->minor_version = 1;
+	}
+	else
+	{
+		internal_handle->io_handle->major_version = 1;
+		internal_handle->io_handle->minor_version = 0;
+	}
+	if( ( format == LIBEWF_FORMAT_EWF )
+	 || ( format == LIBEWF_FORMAT_SMART ) )
+	{
+		/* Wraps .s01 to .s99 and then to .saa up to .zzz
+		 * ( ( ( 's' to 'z' = 8 ) * 26 * 26 ) + 99 ) = 5507
+		 */
+		internal_handle->write_io_handle->maximum_number_of_segments = (uint32_t) 5507;
+		internal_handle->io_handle->segment_file_type                = LIBEWF_SEGMENT_FILE_TYPE_EWF1_SMART;
+	}
+	else if( format == LIBEWF_FORMAT_V2_ENCASE7 )
+	{
+		/* Wraps .Ex01 to .Ex99 and then to .ExAA up to .EzZZ
+		 * ( ( ( 'x' to 'z' = 3 ) * 26 * 26 ) + 99 ) = 2127
+		 */
+		internal_handle->write_io_handle->maximum_number_of_segments = (uint32_t) 2127;
+		internal_handle->io_handle->segment_file_type                = LIBEWF_SEGMENT_FILE_TYPE_EWF2;
+	}
+	else
+	{
+		/* Wraps .E01 to .E99 and then to .EAA up to .ZZZ
+		 * ( ( ( 'E' to 'Z' or 'e' to 'z' = 22 ) * 26 * 26 ) + 99 ) = 14971
+		 */
+		internal_handle->write_io_handle->maximum_number_of_segments = (uint32_t) 14971;
+		internal_handle->io_handle->segment_file_type                = LIBEWF_SEGMENT_FILE_TYPE_EWF1;
+	}
+	/* Determine the maximum number of table entries
+	 */
+	if( ( format == LIBEWF_FORMAT_ENCASE6 )
+	 || ( format == LIBEWF_FORMAT_ENCASE7 ) )
+	{
+		internal_handle->write_io_handle->maximum_segment_file_size  = INT64_MAX;
+		internal_handle->write_io_handle->maximum_chunks_per_section = LIBEWF_MAXIMUM_TABLE_ENTRIES_ENCASE6;
+	}
+	else if( format == LIBEWF_FORMAT_V2_ENCASE7 )
+	{
+		internal_handle->write_io_handle->maximum_segment_file_size  = INT64_MAX;
+		internal_handle->write_io_handle->maximum_chunks_per_section = LIBEWF_MAXIMUM_TABLE_ENTRIES;
+	}
+	else if( format == LIBEWF_FORMAT_EWFX )
+	{
+		internal_handle->write_io_handle->maximum_segment_file_size  = INT32_MAX;
+		internal_handle->write_io_handle->maximum_chunks_per_section = LIBEWF_MAXIMUM_TABLE_ENTRIES;
+	}
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set media values.",
-		 function );
-
-		goto on_error;
+		internal_handle->write_io_handle->maximum_segment_file_size  = INT32_MAX;
+		internal_handle->write_io_handle->maximum_chunks_per_section = LIBEWF_MAXIMUM_TABLE_ENTRIES_EWF;
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -10589,16 +14482,17 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the media type value
+/* Retrieves the segment file version
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_media_type(
+int libewf_handle_get_segment_file_version(
      libewf_handle_t *handle,
-     uint8_t *media_type,
+     uint8_t *major_version,
+     uint8_t *minor_version,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_media_type";
+	static char *function                     = "libewf_handle_get_segment_file_version";
 
 	if( handle == NULL )
 	{
@@ -10613,35 +14507,35 @@ int libewf_handle_get_media_type(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->media_values == NULL )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->media_values->media_type > (uint8_t) INT8_MAX )
+	if( major_version == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid media type value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid major version.",
 		 function );
 
 		return( -1 );
 	}
-	if( media_type == NULL )
+	if( minor_version == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid media type.",
+		 "%s: invalid minor version.",
 		 function );
 
 		return( -1 );
@@ -10661,7 +14555,8 @@ int libewf_handle_get_media_type(
 		return( -1 );
 	}
 #endif
-	*media_type = internal_handle->media_values->media_type;
+	*major_version = internal_handle->io_handle->major_version;
+	*minor_version = internal_handle->io_handle->minor_version;
 
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -10681,16 +14576,18 @@ int libewf_handle_get_media_type(
 	return( 1 );
 }
 
-/* Sets the media type
+/* Retrieves the segment file set identifier
+ * The identifier is a GUID and is 16 bytes of size
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_set_media_type(
+int libewf_handle_get_segment_file_set_identifier(
      libewf_handle_t *handle,
-     uint8_t media_type,
+     uint8_t *set_identifier,
+     size_t size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_media_type";
+	static char *function                     = "libewf_handle_get_segment_file_set_identifier";
 
 	if( handle == NULL )
 	{
@@ -10716,8 +14613,30 @@ int libewf_handle_set_media_type(
 
 		return( -1 );
 	}
+	if( set_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: set identifier too small.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -10725,29 +14644,28 @@ int libewf_handle_set_media_type(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( ( internal_handle->read_io_handle != NULL )
-	 || ( internal_handle->write_io_handle == NULL )
-	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
+	if( memory_copy(
+	     set_identifier,
+	     internal_handle->media_values->set_identifier,
+	     16 ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: media type cannot be changed.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set set identifier.",
 		 function );
 
 		goto on_error;
 	}
-	internal_handle->media_values->media_type = media_type;
-
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -10755,7 +14673,7 @@ int libewf_handle_set_media_type(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -10765,23 +14683,25 @@ int libewf_handle_set_media_type(
 
 on_error:
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
+	libcthreads_read_write_lock_release_for_read(
 	 internal_handle->read_write_lock,
 	 NULL );
 #endif
 	return( -1 );
 }
 
-/* Retrieves the media flags
+/* Sets the segment file set identifier
+ * The identifier is a GUID and is 16 bytes of size
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_media_flags(
+int libewf_handle_set_segment_file_set_identifier(
      libewf_handle_t *handle,
-     uint8_t *media_flags,
+     const uint8_t *set_identifier,
+     size_t size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_media_flags";
+	static char *function                     = "libewf_handle_set_segment_file_set_identifier";
 
 	if( handle == NULL )
 	{
@@ -10807,19 +14727,30 @@ int libewf_handle_get_media_flags(
 
 		return( -1 );
 	}
-	if( media_flags == NULL )
+	if( set_identifier == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid media flags.",
+		 "%s: invalid set identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: set identifier too small.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -10827,27 +14758,41 @@ int libewf_handle_get_media_flags(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_handle->media_values->media_flags > (uint8_t) INT8_MAX )
+	if( ( internal_handle->read_io_handle != NULL )
+	 || ( internal_handle->write_io_handle == NULL )
+	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid media flags value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: set identifier cannot be changed.",
 		 function );
 
 		goto on_error;
 	}
-	*media_flags = internal_handle->media_values->media_flags;
+	if( memory_copy(
+	     internal_handle->media_values->set_identifier,
+	     set_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy set indentifier.",
+		 function );
 
+		goto on_error;
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -10855,7 +14800,7 @@ int libewf_handle_get_media_flags(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -10865,23 +14810,25 @@ int libewf_handle_get_media_flags(
 
 on_error:
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_read(
+	libcthreads_read_write_lock_release_for_write(
 	 internal_handle->read_write_lock,
 	 NULL );
 #endif
 	return( -1 );
 }
 
-/* Sets the media flags
- * Returns 1 if successful or -1 on error
+/* Retrieves the MD5 hash
+ * Returns 1 if successful, 0 if not set or -1 on error
  */
-int libewf_handle_set_media_flags(
+int libewf_handle_get_md5_hash(
      libewf_handle_t *handle,
-     uint8_t media_flags,
+     uint8_t *md5_hash,
+     size_t size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_media_flags";
+	static char *function                     = "libewf_handle_get_md5_hash";
+	int result                                = 0;
 
 	if( handle == NULL )
 	{
@@ -10896,13 +14843,35 @@ int libewf_handle_set_media_flags(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->media_values == NULL )
+	if( internal_handle->hash_sections == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
+		 "%s: invalid handle - missing hash sections.",
+		 function );
+
+		return( -1 );
+	}
+	if( md5_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: MD5 hash too small.",
 		 function );
 
 		return( -1 );
@@ -10922,25 +14891,62 @@ int libewf_handle_set_media_flags(
 		return( -1 );
 	}
 #endif
-	if( ( internal_handle->read_io_handle != NULL )
-	 || ( internal_handle->write_io_handle == NULL )
-	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
+	if( ( internal_handle->hash_sections->md5_hash_set == 0 )
+	 && ( internal_handle->hash_values != NULL ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: media flags cannot be changed.",
-		 function );
+		if( libewf_hash_values_generate_md5_hash(
+		     internal_handle->hash_values,
+		     internal_handle->hash_sections->md5_hash,
+		     16,
+		     &( internal_handle->hash_sections->md5_hash_set ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to parse MD5 hash value for its value.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_handle->hash_sections->md5_digest_set != 0 )
+	{
+		if( memory_copy(
+		     md5_hash,
+		     internal_handle->hash_sections->md5_digest,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy MD5 digest.",
+			 function );
+
+			goto on_error;
+		}
+		result = 1;
+	}
+	else if( internal_handle->hash_sections->md5_hash_set != 0 )
+	{
+		if( memory_copy(
+		     md5_hash,
+		     internal_handle->hash_sections->md5_hash,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy MD5 hash.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		result = 1;
 	}
-	internal_handle->media_values->media_flags = media_flags;
-
-	/* Make sure the lowest bit is always set
-	 */
-	internal_handle->media_values->media_flags |= 0x01;
-
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
@@ -10956,7 +14962,7 @@ int libewf_handle_set_media_flags(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 
 on_error:
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
@@ -10967,17 +14973,17 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the format type value
+/* Sets the MD5 hash
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_format(
+int libewf_handle_set_md5_hash(
      libewf_handle_t *handle,
-     uint8_t *format,
+     const uint8_t *md5_hash,
+     size_t size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_format";
-	int result                                = 1;
+	static char *function                     = "libewf_handle_set_md5_hash";
 
 	if( handle == NULL )
 	{
@@ -10992,41 +14998,41 @@ int libewf_handle_get_format(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
+	if( internal_handle->hash_sections == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 "%s: invalid handle - missing hash sections.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->media_values == NULL )
+	if( md5_hash == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MD5 hash.",
 		 function );
 
 		return( -1 );
 	}
-	if( format == NULL )
+	if( size < 16 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: MD5 hash too small.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -11034,201 +15040,89 @@ int libewf_handle_get_format(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_handle->io_handle->format > (uint8_t) INT8_MAX )
+	if( ( internal_handle->read_io_handle != NULL )
+	 || ( internal_handle->hash_sections->md5_hash_set != 0 )
+	 || ( internal_handle->hash_sections->md5_digest_set != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid format value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: MD5 hash cannot be changed.",
 		 function );
 
-		result = -1;
-	}
-	else
-	{
-		*format = internal_handle->io_handle->format;
+		goto on_error;
 	}
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( internal_handle->hash_values == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libewf_hash_values_initialize(
+		     &( internal_handle->hash_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create hash values.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
+		internal_handle->hash_values_parsed = 1;
 	}
-#endif
-	return( result );
-}
-
-/* Sets the output format
- * Returns 1 if successful or -1 on error
- */
-int libewf_handle_set_format(
-     libewf_handle_t *handle,
-     uint8_t format,
-     libcerror_error_t **error )
-{
-	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_format";
-
-	if( handle == NULL )
+	if( memory_copy(
+	     internal_handle->hash_sections->md5_hash,
+	     md5_hash,
+	     16 ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set MD5 hash.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_handle = (libewf_internal_handle_t *) handle;
+	internal_handle->hash_sections->md5_hash_set = 1;
 
-	if( internal_handle->io_handle == NULL )
+	if( memory_copy(
+	     internal_handle->hash_sections->md5_digest,
+	     md5_hash,
+	     16 ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set MD5 hash.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( ( format != LIBEWF_FORMAT_ENCASE1 )
-	 && ( format != LIBEWF_FORMAT_ENCASE2 )
-	 && ( format != LIBEWF_FORMAT_ENCASE3 )
-	 && ( format != LIBEWF_FORMAT_ENCASE4 )
-	 && ( format != LIBEWF_FORMAT_ENCASE5 )
-	 && ( format != LIBEWF_FORMAT_ENCASE6 )
-	 && ( format != LIBEWF_FORMAT_ENCASE7 )
-	 && ( format != LIBEWF_FORMAT_SMART )
-	 && ( format != LIBEWF_FORMAT_FTK_IMAGER )
-	 && ( format != LIBEWF_FORMAT_LINEN5 )
-	 && ( format != LIBEWF_FORMAT_LINEN6 )
-	 && ( format != LIBEWF_FORMAT_LINEN7 )
-	 && ( format != LIBEWF_FORMAT_V2_ENCASE7 )
-/* TODO add support for: L01, Lx01:
-	 && ( format != LIBEWF_FORMAT_LOGICAL_ENCASE5 )
-	 && ( format != LIBEWF_FORMAT_LOGICAL_ENCASE6 )
-	 && ( format != LIBEWF_FORMAT_LOGICAL_ENCASE7 )
-	 && ( format != LIBEWF_FORMAT_V2_LOGICAL_ENCASE7 )
-*/
-	 && ( format != LIBEWF_FORMAT_EWF )
-	 && ( format != LIBEWF_FORMAT_EWFX ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported format: %d.",
-		 function,
-	         format );
+	internal_handle->hash_sections->md5_digest_set = 1;
 
-		return( -1 );
-	}
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
+	if( libewf_hash_values_parse_md5_hash(
+	     internal_handle->hash_values,
+	     md5_hash,
+	     16,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
-
-		return( -1 );
-	}
-#endif
-	if( ( internal_handle->read_io_handle != NULL )
-	 || ( internal_handle->write_io_handle == NULL )
-	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: format cannot be changed.",
+		 "%s: unable to parse MD5 hash for its value.",
 		 function );
 
 		goto on_error;
 	}
-/* TODO refactor into separate function */
-	internal_handle->io_handle->format = format;
-
-	if( format == LIBEWF_FORMAT_V2_ENCASE7 )
-	{
-		internal_handle->io_handle->major_version = 2;
-		internal_handle->io_handle->minor_version = 1;
-	}
-	else
-	{
-		internal_handle->io_handle->major_version = 1;
-		internal_handle->io_handle->minor_version = 0;
-	}
-	if( ( format == LIBEWF_FORMAT_EWF )
-	 || ( format == LIBEWF_FORMAT_SMART ) )
-	{
-		/* Wraps .s01 to .s99 and then to .saa up to .zzz
-		 * ( ( ( 's' to 'z' = 8 ) * 26 * 26 ) + 99 ) = 5507
-		 */
-		internal_handle->write_io_handle->maximum_number_of_segments = (uint32_t) 5507;
-		internal_handle->io_handle->segment_file_type                = LIBEWF_SEGMENT_FILE_TYPE_EWF1_SMART;
-	}
-	else if( format == LIBEWF_FORMAT_V2_ENCASE7 )
-	{
-		/* Wraps .Ex01 to .Ex99 and then to .ExAA up to .EzZZ
-		 * ( ( ( 'x' to 'z' = 3 ) * 26 * 26 ) + 99 ) = 2127
-		 */
-		internal_handle->write_io_handle->maximum_number_of_segments = (uint32_t) 2127;
-		internal_handle->io_handle->segment_file_type                = LIBEWF_SEGMENT_FILE_TYPE_EWF2;
-	}
-	else
-	{
-		/* Wraps .E01 to .E99 and then to .EAA up to .ZZZ
-		 * ( ( ( 'E' to 'Z' or 'e' to 'z' = 22 ) * 26 * 26 ) + 99 ) = 14971
-		 */
-		internal_handle->write_io_handle->maximum_number_of_segments = (uint32_t) 14971;
-		internal_handle->io_handle->segment_file_type                = LIBEWF_SEGMENT_FILE_TYPE_EWF1;
-	}
-	/* Determine the maximum number of table entries
-	 */
-	if( ( format == LIBEWF_FORMAT_ENCASE6 )
-	 || ( format == LIBEWF_FORMAT_ENCASE7 ) )
-	{
-		internal_handle->write_io_handle->maximum_segment_file_size  = INT64_MAX;
-		internal_handle->write_io_handle->maximum_chunks_per_section = LIBEWF_MAXIMUM_TABLE_ENTRIES_ENCASE6;
-	}
-	else if( format == LIBEWF_FORMAT_V2_ENCASE7 )
-	{
-		internal_handle->write_io_handle->maximum_segment_file_size  = INT64_MAX;
-		internal_handle->write_io_handle->maximum_chunks_per_section = LIBEWF_MAXIMUM_TABLE_ENTRIES;
-	}
-	else if( format == LIBEWF_FORMAT_EWFX )
-	{
-		internal_handle->write_io_handle->maximum_segment_file_size  = INT32_MAX;
-		internal_handle->write_io_handle->maximum_chunks_per_section = LIBEWF_MAXIMUM_TABLE_ENTRIES;
-	}
-	else
-	{
-		internal_handle->write_io_handle->maximum_segment_file_size  = INT32_MAX;
-		internal_handle->write_io_handle->maximum_chunks_per_section = LIBEWF_MAXIMUM_TABLE_ENTRIES_EWF;
-	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
@@ -11255,17 +15149,18 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the segment file version
- * Returns 1 if successful or -1 on error
+/* Retrieves the SHA1 hash
+ * Returns 1 if successful, 0 if not set or -1 on error
  */
-int libewf_handle_get_segment_file_version(
+int libewf_handle_get_sha1_hash(
      libewf_handle_t *handle,
-     uint8_t *major_version,
-     uint8_t *minor_version,
+     uint8_t *sha1_hash,
+     size_t size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_segment_file_version";
+	static char *function                     = "libewf_handle_get_sha1_hash";
+	int result                                = 0;
 
 	if( handle == NULL )
 	{
@@ -11280,41 +15175,41 @@ int libewf_handle_get_segment_file_version(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
+	if( internal_handle->hash_sections == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 "%s: invalid handle - missing hash sections.",
 		 function );
 
 		return( -1 );
 	}
-	if( major_version == NULL )
+	if( sha1_hash == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid major version.",
+		 "%s: invalid SHA1 hash.",
 		 function );
 
 		return( -1 );
 	}
-	if( minor_version == NULL )
+	if( size < 20 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid minor version.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: SHA1 hash too small.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -11322,17 +15217,70 @@ int libewf_handle_get_segment_file_version(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	*major_version = internal_handle->io_handle->major_version;
-	*minor_version = internal_handle->io_handle->minor_version;
+	if( ( internal_handle->hash_sections->sha1_digest_set == 0 )
+	 && ( internal_handle->hash_values != NULL ) )
+	{
+		if( libewf_hash_values_generate_sha1_hash(
+		     internal_handle->hash_values,
+		     internal_handle->hash_sections->sha1_digest,
+		     20,
+		     &( internal_handle->hash_sections->sha1_digest_set ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to parse MD5 hash value for its value.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_handle->hash_sections->sha1_digest_set != 0 )
+	{
+		if( memory_copy(
+		     sha1_hash,
+		     internal_handle->hash_sections->sha1_digest,
+		     20 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy SHA1 digest.",
+			 function );
+
+			goto on_error;
+		}
+		result = 1;
+	}
+	else if( internal_handle->hash_sections->sha1_hash_set != 0 )
+	{
+		if( memory_copy(
+		     sha1_hash,
+		     internal_handle->hash_sections->sha1_hash,
+		     20 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy SHA1 hash.",
+			 function );
 
+			goto on_error;
+		}
+		result = 1;
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -11340,27 +15288,34 @@ int libewf_handle_get_segment_file_version(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves the segment file set identifier
- * The identifier is a GUID and is 16 bytes of size
+/* Sets the SHA1 hash
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_segment_file_set_identifier(
+int libewf_handle_set_sha1_hash(
      libewf_handle_t *handle,
-     uint8_t *set_identifier,
+     const uint8_t *sha1_hash,
      size_t size,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_segment_file_set_identifier";
+	static char *function                     = "libewf_handle_set_sha1_hash";
 
 	if( handle == NULL )
 	{
@@ -11375,41 +15330,41 @@ int libewf_handle_get_segment_file_set_identifier(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->media_values == NULL )
+	if( internal_handle->hash_sections == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
+		 "%s: invalid handle - missing hash sections.",
 		 function );
 
 		return( -1 );
 	}
-	if( set_identifier == NULL )
+	if( sha1_hash == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid set identifier.",
+		 "%s: invalid SHA1 hash.",
 		 function );
 
 		return( -1 );
 	}
-	if( size < 16 )
+	if( size < 20 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: set identifier too small.",
+		 "%s: SHA1 hash too small.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -11417,28 +15372,91 @@ int libewf_handle_get_segment_file_set_identifier(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
+	if( ( internal_handle->read_io_handle != NULL )
+	 || ( internal_handle->hash_sections->sha1_hash_set != 0 )
+	 || ( internal_handle->hash_sections->sha1_digest_set != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: SHA1 hash cannot be changed.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_handle->hash_values == NULL )
+	{
+		if( libewf_hash_values_initialize(
+		     &( internal_handle->hash_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create hash values.",
+			 function );
+
+			goto on_error;
+		}
+		internal_handle->hash_values_parsed = 1;
+	}
 	if( memory_copy(
-	     set_identifier,
-	     internal_handle->media_values->set_identifier,
-	     16 ) == NULL )
+	     internal_handle->hash_sections->sha1_hash,
+	     sha1_hash,
+	     20 ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set set identifier.",
+		 "%s: unable to set SHA1 hash.",
+		 function );
+
+		goto on_error;
+	}
+	internal_handle->hash_sections->sha1_hash_set = 1;
+
+	if( memory_copy(
+	     internal_handle->hash_sections->sha1_digest,
+	     sha1_hash,
+	     20 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set SHA1 hash.",
+		 function );
+
+		goto on_error;
+	}
+	internal_handle->hash_sections->sha1_digest_set = 1;
+
+	if( libewf_hash_values_parse_sha1_hash(
+	     internal_handle->hash_values,
+	     sha1_hash,
+	     20,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to parse SHA1 hash for its value.",
 		 function );
 
 		goto on_error;
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -11446,7 +15464,7 @@ int libewf_handle_get_segment_file_set_identifier(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -11456,25 +15474,23 @@ int libewf_handle_get_segment_file_set_identifier(
 
 on_error:
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_read(
+	libcthreads_read_write_lock_release_for_write(
 	 internal_handle->read_write_lock,
 	 NULL );
 #endif
 	return( -1 );
 }
 
-/* Sets the segment file set identifier
- * The identifier is a GUID and is 16 bytes of size
+/* Retrieves the flags of the media digests that are calculated during write
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_set_segment_file_set_identifier(
+int libewf_handle_get_calculate_digest_flags(
      libewf_handle_t *handle,
-     const uint8_t *set_identifier,
-     size_t size,
+     uint8_t *calculate_digest_flags,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_segment_file_set_identifier";
+	static char *function                     = "libewf_handle_get_calculate_digest_flags";
 
 	if( handle == NULL )
 	{
@@ -11489,83 +15505,43 @@ int libewf_handle_set_segment_file_set_identifier(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->media_values == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing media values.",
-		 function );
-
-		return( -1 );
-	}
-	if( set_identifier == NULL )
+	if( calculate_digest_flags == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid set identifier.",
-		 function );
-
-		return( -1 );
-	}
-	if( size < 16 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: set identifier too small.",
+		 "%s: invalid calculate digest flags.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
-
-		return( -1 );
-	}
-#endif
-	if( ( internal_handle->read_io_handle != NULL )
-	 || ( internal_handle->write_io_handle == NULL )
-	 || ( internal_handle->write_io_handle->values_initialized != 0 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: set identifier cannot be changed.",
-		 function );
-
-		goto on_error;
-	}
-	if( memory_copy(
-	     internal_handle->media_values->set_identifier,
-	     set_identifier,
-	     16 ) == NULL )
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy set indentifier.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+#endif
+	if( ( internal_handle->write_io_handle == NULL )
+	 || ( internal_handle->write_io_handle->media_digests == NULL ) )
+	{
+		*calculate_digest_flags = 0;
+	}
+	else
+	{
+		*calculate_digest_flags = internal_handle->write_io_handle->media_digests->calculate_digest_flags;
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -11573,35 +15549,29 @@ int libewf_handle_set_segment_file_set_identifier(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
 	return( 1 );
-
-on_error:
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
 }
 
-/* Retrieves the MD5 hash
- * Returns 1 if successful, 0 if not set or -1 on error
+/* Sets the flags of the media digests that are calculated during write
+ * The media data is digested on a separate thread, in chunk order, by libewf_handle_write_buffer
+ * and libewf_handle_write_data_chunk. At libewf_handle_write_finalize the digests are stored
+ * in the hash and digest sections, unless they were set by the caller
+ * This function needs to be used before the first write
+ * Returns 1 if successful or -1 on error
  */
-int libewf_handle_get_md5_hash(
+int libewf_handle_set_calculate_digest_flags(
      libewf_handle_t *handle,
-     uint8_t *md5_hash,
-     size_t size,
+     uint8_t calculate_digest_flags,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_md5_hash";
-	int result                                = 0;
+	static char *function                     = "libewf_handle_set_calculate_digest_flags";
 
 	if( handle == NULL )
 	{
@@ -11616,36 +15586,26 @@ int libewf_handle_get_md5_hash(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->hash_sections == NULL )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing hash sections.",
-		 function );
-
-		return( -1 );
-	}
-	if( md5_hash == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid MD5 hash.",
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( size < 16 )
+	if( ( calculate_digest_flags & ~( LIBEWF_CALCULATE_DIGEST_FLAG_MD5 | LIBEWF_CALCULATE_DIGEST_FLAG_SHA1 | LIBEWF_CALCULATE_DIGEST_FLAG_SHA256 ) ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: MD5 hash too small.",
-		 function );
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported calculate digest flags: 0x%02" PRIx8 ".",
+		 function,
+		 calculate_digest_flags );
 
 		return( -1 );
 	}
@@ -11664,61 +15624,56 @@ int libewf_handle_get_md5_hash(
 		return( -1 );
 	}
 #endif
-	if( ( internal_handle->hash_sections->md5_hash_set == 0 )
-	 && ( internal_handle->hash_values != NULL ) )
+	if( ( internal_handle->write_io_handle == NULL )
+	 || ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_RESUME ) != 0 )
+	 || ( internal_handle->write_io_handle->values_initialized != 0 )
+	 || ( internal_handle->chunk_data != NULL ) )
 	{
-		if( libewf_hash_values_generate_md5_hash(
-		     internal_handle->hash_values,
-		     internal_handle->hash_sections->md5_hash,
-		     16,
-		     &( internal_handle->hash_sections->md5_hash_set ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to parse MD5 hash value for its value.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: calculate digest flags cannot be changed.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	if( internal_handle->hash_sections->md5_digest_set != 0 )
+	if( internal_handle->write_io_handle->media_digests != NULL )
 	{
-		if( memory_copy(
-		     md5_hash,
-		     internal_handle->hash_sections->md5_digest,
-		     16 ) == NULL )
+		if( libewf_media_digests_free(
+		     &( internal_handle->write_io_handle->media_digests ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy MD5 digest.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free media digests.",
 			 function );
 
 			goto on_error;
 		}
-		result = 1;
 	}
-	else if( internal_handle->hash_sections->md5_hash_set != 0 )
+	/* The block hashes are calculated by the media digests
+	 */
+	if( ( calculate_digest_flags != 0 )
+	 || ( internal_handle->block_hashes != NULL ) )
 	{
-		if( memory_copy(
-		     md5_hash,
-		     internal_handle->hash_sections->md5_hash,
-		     16 ) == NULL )
+		if( libewf_media_digests_initialize(
+		     &( internal_handle->write_io_handle->media_digests ),
+		     calculate_digest_flags,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy MD5 hash.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create media digests.",
 			 function );
 
 			goto on_error;
 		}
-		result = 1;
+		internal_handle->write_io_handle->media_digests->block_hashes = internal_handle->block_hashes;
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -11735,7 +15690,7 @@ int libewf_handle_get_md5_hash(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
 
 on_error:
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
@@ -11746,17 +15701,17 @@ on_error:
 	return( -1 );
 }
 
-/* Sets the MD5 hash
- * Returns 1 if successful or -1 on error
+/* Retrieves the number of chunks per block hash
+ * Returns 1 if successful, 0 if not set or -1 on error
  */
-int libewf_handle_set_md5_hash(
+int libewf_handle_get_number_of_chunks_per_block_hash(
      libewf_handle_t *handle,
-     const uint8_t *md5_hash,
-     size_t size,
+     uint32_t *number_of_chunks_per_block,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_md5_hash";
+	static char *function                     = "libewf_handle_get_number_of_chunks_per_block_hash";
+	int result                                = 0;
 
 	if( handle == NULL )
 	{
@@ -11771,35 +15726,91 @@ int libewf_handle_set_md5_hash(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->hash_sections == NULL )
+	if( number_of_chunks_per_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks per block.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing hash sections.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( md5_hash == NULL )
+#endif
+	if( internal_handle->block_hashes != NULL )
+	{
+		*number_of_chunks_per_block = internal_handle->block_hashes->number_of_chunks_per_block;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the number of chunks per block hash
+ * The MD5 of every block of chunks is calculated by the media digests thread during write
+ * A value of 0 disables the block hashes
+ * This function needs to be used before the first write
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_set_number_of_chunks_per_block_hash(
+     libewf_handle_t *handle,
+     uint32_t number_of_chunks_per_block,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	libewf_write_io_handle_t *write_io_handle = NULL;
+	static char *function                     = "libewf_handle_set_number_of_chunks_per_block_hash";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid MD5 hash.",
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( size < 16 )
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: MD5 hash too small.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
@@ -11819,82 +15830,98 @@ int libewf_handle_set_md5_hash(
 		return( -1 );
 	}
 #endif
-	if( ( internal_handle->read_io_handle != NULL )
-	 || ( internal_handle->hash_sections->md5_hash_set != 0 )
-	 || ( internal_handle->hash_sections->md5_digest_set != 0 ) )
+	write_io_handle = internal_handle->write_io_handle;
+
+	if( ( write_io_handle == NULL )
+	 || ( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_RESUME ) != 0 )
+	 || ( write_io_handle->values_initialized != 0 )
+	 || ( internal_handle->chunk_data != NULL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: MD5 hash cannot be changed.",
+		 "%s: number of chunks per block hash cannot be changed.",
 		 function );
 
 		goto on_error;
 	}
-	if( internal_handle->hash_values == NULL )
+	if( write_io_handle->media_digests != NULL )
 	{
-		if( libewf_hash_values_initialize(
-		     &( internal_handle->hash_values ),
+		write_io_handle->media_digests->block_hashes = NULL;
+	}
+	if( internal_handle->block_hashes != NULL )
+	{
+		if( libewf_block_hashes_free(
+		     &( internal_handle->block_hashes ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create hash values.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block hashes.",
 			 function );
 
 			goto on_error;
 		}
-		internal_handle->hash_values_parsed = 1;
 	}
-	if( memory_copy(
-	     internal_handle->hash_sections->md5_hash,
-	     md5_hash,
-	     16 ) == NULL )
+	if( number_of_chunks_per_block == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set MD5 hash.",
-		 function );
+		if( ( write_io_handle->media_digests != NULL )
+		 && ( write_io_handle->media_digests->calculate_digest_flags == 0 ) )
+		{
+			if( libewf_media_digests_free(
+			     &( write_io_handle->media_digests ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free media digests.",
+				 function );
 
-		goto on_error;
+				goto on_error;
+			}
+		}
 	}
-	internal_handle->hash_sections->md5_hash_set = 1;
-
-	if( memory_copy(
-	     internal_handle->hash_sections->md5_digest,
-	     md5_hash,
-	     16 ) == NULL )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set MD5 hash.",
-		 function );
-
-		goto on_error;
-	}
-	internal_handle->hash_sections->md5_digest_set = 1;
+		if( libewf_block_hashes_initialize(
+		     &( internal_handle->block_hashes ),
+		     number_of_chunks_per_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block hashes.",
+			 function );
 
-	if( libewf_hash_values_parse_md5_hash(
-	     internal_handle->hash_values,
-	     md5_hash,
-	     16,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to parse MD5 hash for its value.",
-		 function );
+			goto on_error;
+		}
+		/* The block hashes are calculated by the media digests
+		 */
+		if( write_io_handle->media_digests == NULL )
+		{
+			if( libewf_media_digests_initialize(
+			     &( write_io_handle->media_digests ),
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create media digests.",
+				 function );
 
-		goto on_error;
+				goto on_error;
+			}
+		}
+		write_io_handle->media_digests->block_hashes = internal_handle->block_hashes;
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -11922,17 +15949,16 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the SHA1 hash
- * Returns 1 if successful, 0 if not set or -1 on error
+/* Retrieves the number of block hashes
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libewf_handle_get_sha1_hash(
+int libewf_handle_get_number_of_block_hashes(
      libewf_handle_t *handle,
-     uint8_t *sha1_hash,
-     size_t size,
+     uint64_t *number_of_block_hashes,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_sha1_hash";
+	static char *function                     = "libewf_handle_get_number_of_block_hashes";
 	int result                                = 0;
 
 	if( handle == NULL )
@@ -11948,41 +15974,89 @@ int libewf_handle_get_sha1_hash(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->hash_sections == NULL )
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing hash sections.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( sha1_hash == NULL )
+#endif
+	if( ( internal_handle->block_hashes != NULL )
+	 && ( internal_handle->block_hashes->is_finalized != 0 ) )
+	{
+		result = libewf_block_hashes_get_number_of_hashes(
+		          internal_handle->block_hashes,
+		          number_of_block_hashes,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of block hashes.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid SHA1 hash.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( size < 20 )
+#endif
+	return( result );
+}
+
+/* Retrieves the MD5 hash of a specific block of chunks
+ * The block index of a media offset is: offset / ( chunk size * number of chunks per block hash )
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libewf_handle_get_block_hash(
+     libewf_handle_t *handle,
+     uint64_t block_index,
+     uint8_t *md5_hash,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_block_hash";
+	int result                                = 0;
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: SHA1 hash too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -11990,70 +16064,37 @@ int libewf_handle_get_sha1_hash(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( ( internal_handle->hash_sections->sha1_digest_set == 0 )
-	 && ( internal_handle->hash_values != NULL ) )
-	{
-		if( libewf_hash_values_generate_sha1_hash(
-		     internal_handle->hash_values,
-		     internal_handle->hash_sections->sha1_digest,
-		     20,
-		     &( internal_handle->hash_sections->sha1_digest_set ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to parse MD5 hash value for its value.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	if( internal_handle->hash_sections->sha1_digest_set != 0 )
+	if( ( internal_handle->block_hashes != NULL )
+	 && ( internal_handle->block_hashes->is_finalized != 0 ) )
 	{
-		if( memory_copy(
-		     sha1_hash,
-		     internal_handle->hash_sections->sha1_digest,
-		     20 ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy SHA1 digest.",
-			 function );
+		result = libewf_block_hashes_get_hash(
+		          internal_handle->block_hashes,
+		          block_index,
+		          md5_hash,
+		          size,
+		          error );
 
-			goto on_error;
-		}
-		result = 1;
-	}
-	else if( internal_handle->hash_sections->sha1_hash_set != 0 )
-	{
-		if( memory_copy(
-		     sha1_hash,
-		     internal_handle->hash_sections->sha1_hash,
-		     20 ) == NULL )
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy SHA1 hash.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block hash: %" PRIu64 ".",
+			 function,
+			 block_index );
 
-			goto on_error;
+			result = -1;
 		}
-		result = 1;
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -12061,34 +16102,28 @@ int libewf_handle_get_sha1_hash(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
 	return( result );
-
-on_error:
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
 }
 
-/* Sets the SHA1 hash
+/* Reads the block hashes from a sidecar file using a Basic File IO (bfio) handle
+ * The block hashes must match the chunk size, media size and set identifier of the handle
  * Returns 1 if successful or -1 on error
  */
-int libewf_handle_set_sha1_hash(
+int libewf_handle_read_block_hashes_file_io_handle(
      libewf_handle_t *handle,
-     const uint8_t *sha1_hash,
-     size_t size,
+     libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
+	libewf_block_hashes_t *block_hashes       = NULL;
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_set_sha1_hash";
+	static char *function                     = "libewf_handle_read_block_hashes_file_io_handle";
+	int result                                = 0;
 
 	if( handle == NULL )
 	{
@@ -12103,39 +16138,56 @@ int libewf_handle_set_sha1_hash(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
-	if( internal_handle->hash_sections == NULL )
+	if( internal_handle->file_io_pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing hash sections.",
+		 "%s: invalid handle - missing file IO pool.",
 		 function );
 
 		return( -1 );
 	}
-	if( sha1_hash == NULL )
+	if( internal_handle->media_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid SHA1 hash.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
 		 function );
 
 		return( -1 );
 	}
-	if( size < 20 )
+	if( libewf_block_hashes_initialize(
+	     &block_hashes,
+	     0,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: SHA1 hash too small.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block hashes.",
 		 function );
 
 		return( -1 );
 	}
+	if( libewf_block_hashes_read_file_io_handle(
+	     block_hashes,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block hashes.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
@@ -12148,88 +16200,164 @@ int libewf_handle_set_sha1_hash(
 		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #endif
-	if( ( internal_handle->read_io_handle != NULL )
-	 || ( internal_handle->hash_sections->sha1_hash_set != 0 )
-	 || ( internal_handle->hash_sections->sha1_digest_set != 0 ) )
+	if( ( internal_handle->write_io_handle != NULL )
+	 && ( internal_handle->write_io_handle->media_digests != NULL )
+	 && ( internal_handle->write_io_handle->media_digests->block_hashes != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - block hashes are calculated during write.",
+		 function );
+
+		result = -1;
+	}
+	else if( ( block_hashes->chunk_size != internal_handle->media_values->chunk_size )
+	      || ( block_hashes->media_size != internal_handle->media_values->media_size )
+	      || ( memory_compare(
+	            block_hashes->set_identifier,
+	            internal_handle->media_values->set_identifier,
+	            16 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: block hashes do not match media values.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		if( internal_handle->block_hashes != NULL )
+		{
+			result = libewf_block_hashes_free(
+			          &( internal_handle->block_hashes ),
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free block hashes.",
+				 function );
+			}
+		}
+		if( internal_handle->block_hashes == NULL )
+		{
+			internal_handle->block_hashes = block_hashes;
+			block_hashes                  = NULL;
+
+			result = 1;
+		}
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( block_hashes != NULL )
+	{
+		libewf_block_hashes_free(
+		 &block_hashes,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the block hashes to a sidecar file using a Basic File IO (bfio) handle
+ * The block hashes are available after libewf_handle_write_finalize or libewf_handle_read_block_hashes_file_io_handle
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_write_block_hashes_file_io_handle(
+     libewf_handle_t *handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_write_block_hashes_file_io_handle";
+	int result                                = 1;
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: SHA1 hash cannot be changed.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( internal_handle->hash_values == NULL )
-	{
-		if( libewf_hash_values_initialize(
-		     &( internal_handle->hash_values ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create hash values.",
-			 function );
+	internal_handle = (libewf_internal_handle_t *) handle;
 
-			goto on_error;
-		}
-		internal_handle->hash_values_parsed = 1;
-	}
-	if( memory_copy(
-	     internal_handle->hash_sections->sha1_hash,
-	     sha1_hash,
-	     20 ) == NULL )
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set SHA1 hash.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_handle->hash_sections->sha1_hash_set = 1;
-
-	if( memory_copy(
-	     internal_handle->hash_sections->sha1_digest,
-	     sha1_hash,
-	     20 ) == NULL )
+#endif
+	if( ( internal_handle->block_hashes == NULL )
+	 || ( internal_handle->block_hashes->is_finalized == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set SHA1 hash.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing block hashes.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	internal_handle->hash_sections->sha1_digest_set = 1;
-
-	if( libewf_hash_values_parse_sha1_hash(
-	     internal_handle->hash_values,
-	     sha1_hash,
-	     20,
-	     error ) != 1 )
+	else if( libewf_block_hashes_write_file_io_handle(
+	          internal_handle->block_hashes,
+	          file_io_handle,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to parse SHA1 hash for its value.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block hashes.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -12237,21 +16365,13 @@ int libewf_handle_set_sha1_hash(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( 1 );
-
-on_error:
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
+	return( result );
 }
 
 /* Sets the read zero chunk on error
@@ -12732,10 +16852,180 @@ int libewf_handle_get_number_of_checksum_errors(
 			goto on_error;
 		}
 	}
-	*number_of_errors = number_of_elements;
-
+	*number_of_errors = number_of_elements;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves a checksum error
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_get_checksum_error(
+     libewf_handle_t *handle,
+     uint32_t error_index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_get_checksum_error";
+	int result                                = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+	if( internal_handle->chunk_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing chunk table.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libewf_chunk_table_get_checksum_error(
+	          internal_handle->chunk_table,
+	          error_index,
+	          start_sector,
+	          number_of_sectors,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checksum error: %" PRIu32 ".",
+		 function,
+		 error_index );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Appends a checksum error
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_handle_append_checksum_error(
+     libewf_handle_t *handle,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	libewf_internal_handle_t *internal_handle = NULL;
+	static char *function                     = "libewf_handle_append_checksum_error";
+	int result                                = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libewf_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libewf_chunk_table_append_checksum_error(
+	          internal_handle->chunk_table,
+	          start_sector,
+	          number_of_sectors,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append checksum error.",
+		 function );
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
@@ -12743,38 +17033,48 @@ int libewf_handle_get_number_of_checksum_errors(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( 1 );
-
-on_error:
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_read(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
+	return( result );
 }
 
-/* Retrieves a checksum error
- * Returns 1 if successful or -1 on error
+/* Scans the integrity of the chunks using a Basic File IO (bfio) pool
+ * Chunks that fail to verify are added to the checksum errors
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful, 0 if aborted or -1 on error
  */
-int libewf_handle_get_checksum_error(
-     libewf_handle_t *handle,
-     uint32_t error_index,
-     uint64_t *start_sector,
-     uint64_t *number_of_sectors,
+int libewf_internal_handle_scan_chunk_integrity_file_io_pool(
+     libewf_internal_handle_t *internal_handle,
+     libbfio_pool_t *file_io_pool,
+     int (*progress_callback)(
+            size64_t bytes_scanned,
+            size64_t media_size,
+            void *callback_data ),
+     void *callback_data,
      libcerror_error_t **error )
 {
-	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_get_checksum_error";
-	int result                                = 0;
+	libewf_chunk_data_t *chunk_data         = NULL;
+	libewf_chunk_group_t *chunk_group       = NULL;
+	libewf_integrity_scan_t *integrity_scan = NULL;
+	static char *function                   = "libewf_internal_handle_scan_chunk_integrity_file_io_pool";
+	size64_t bytes_scanned                  = 0;
+	size64_t chunk_data_size                = 0;
+	off64_t chunk_data_offset               = 0;
+	off64_t chunk_group_data_offset         = 0;
+	off64_t offset                          = 0;
+	uint64_t chunk_index                    = 0;
+	uint32_t chunk_data_flags               = 0;
+	uint32_t segment_number                 = 0;
+	int chunk_groups_list_index             = 0;
+	int chunks_list_index                   = 0;
+	int file_io_pool_entry                  = 0;
+	int result                              = 1;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -12785,8 +17085,28 @@ int libewf_handle_get_checksum_error(
 
 		return( -1 );
 	}
-	internal_handle = (libewf_internal_handle_t *) handle;
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->io_handle->access_flags & LIBEWF_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid handle - unsupported access flags.",
+		 function );
 
+		return( -1 );
+	}
 	if( internal_handle->chunk_table == NULL )
 	{
 		libcerror_error_set(
@@ -12798,67 +17118,267 @@ int libewf_handle_get_checksum_error(
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( internal_handle->media_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing media values.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = libewf_chunk_table_get_checksum_error(
-	          internal_handle->chunk_table,
-	          error_index,
-	          start_sector,
-	          number_of_sectors,
-	          error );
+	if( internal_handle->media_values->chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid handle - invalid media values - missing chunk size.",
+		 function );
 
-	if( result != 1 )
+		return( -1 );
+	}
+	/* The chunk data is read sequentially by this thread and verified by the integrity scan threads
+	 */
+	if( libewf_integrity_scan_initialize(
+	     &integrity_scan,
+	     internal_handle->io_handle,
+	     internal_handle->media_values,
+	     internal_handle->chunk_table->checksum_errors,
+	     internal_handle->number_of_integrity_scan_threads,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve checksum error: %" PRIu32 ".",
-		 function,
-		 error_index );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create integrity scan.",
+		 function );
+
+		goto on_error;
 	}
-#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
+	internal_handle->io_handle->abort = 0;
+
+	for( chunk_index = 0;
+	     chunk_index < internal_handle->media_values->number_of_chunks;
+	     chunk_index++ )
+	{
+		offset = (off64_t) chunk_index * internal_handle->media_values->chunk_size;
+
+		if( (size64_t) offset >= internal_handle->media_values->media_size )
+		{
+			break;
+		}
+		result = libewf_chunk_table_get_segment_file_chunk_group_by_offset(
+		          internal_handle->chunk_table,
+		          file_io_pool,
+		          internal_handle->segment_table,
+		          offset,
+		          &segment_number,
+		          &chunk_groups_list_index,
+		          &chunk_group_data_offset,
+		          &chunk_group,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment file chunk group for chunk: %" PRIu64 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( chunk_group == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing chunk group: %d.",
+			 function,
+			 chunk_groups_list_index );
+
+			goto on_error;
+		}
+		chunks_list_index = (int) ( chunk_group_data_offset / internal_handle->media_values->chunk_size );
+
+		if( libfdata_list_get_element_by_index(
+		     chunk_group->chunks_list,
+		     chunks_list_index,
+		     &file_io_pool_entry,
+		     &chunk_data_offset,
+		     &chunk_data_size,
+		     &chunk_data_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d from chunks list of chunk group: %d in segment file: %" PRIu32 ".",
+			 function,
+			 chunks_list_index,
+			 chunk_groups_list_index,
+			 segment_number );
+
+			goto on_error;
+		}
+		bytes_scanned = (size64_t) offset + internal_handle->media_values->chunk_size;
+
+		if( bytes_scanned > internal_handle->media_values->media_size )
+		{
+			bytes_scanned = internal_handle->media_values->media_size;
+		}
+		/* Sparse chunks have no stored data to verify
+		 */
+		if( ( chunk_data_flags & LIBEWF_RANGE_FLAG_IS_SPARSE ) == 0 )
+		{
+			if( libewf_chunk_data_initialize(
+			     &chunk_data,
+			     internal_handle->media_values->chunk_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create chunk: %" PRIu64 " data.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			if( libewf_chunk_data_read_from_file_io_pool(
+			     chunk_data,
+			     file_io_pool,
+			     file_io_pool_entry,
+			     chunk_data_offset,
+			     chunk_data_size,
+			     chunk_data_flags,
+			     error ) < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read chunk: %" PRIu64 " data.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			chunk_data->chunk_index        = chunk_index;
+			chunk_data->range_start_offset = offset;
+			chunk_data->range_end_offset   = (off64_t) bytes_scanned;
+
+			if( libewf_integrity_scan_push_chunk_data(
+			     integrity_scan,
+			     &chunk_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to verify chunk: %" PRIu64 " data.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		if( progress_callback != NULL )
+		{
+			if( progress_callback(
+			     bytes_scanned,
+			     internal_handle->media_values->media_size,
+			     callback_data ) != 1 )
+			{
+				result = 0;
+
+				break;
+			}
+		}
+		if( internal_handle->io_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+	}
+	internal_handle->io_handle->abort = 0;
+
+	if( libewf_integrity_scan_finalize(
+	     integrity_scan,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize integrity scan.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	if( libewf_integrity_scan_free(
+	     &integrity_scan,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free integrity scan.",
+		 function );
+
+		goto on_error;
 	}
-#endif
 	return( result );
+
+on_error:
+	if( chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &chunk_data,
+		 NULL );
+	}
+	if( integrity_scan != NULL )
+	{
+		libewf_integrity_scan_free(
+		 &integrity_scan,
+		 NULL );
+	}
+	internal_handle->io_handle->abort = 0;
+
+	return( -1 );
 }
 
-/* Appends a checksum error
- * Returns 1 if successful or -1 on error
+/* Scans the integrity of the chunks
+ * The stored chunk data is verified using its checksum or compressed data integrity
+ * without being copied into the chunk data cache. Chunks that fail to verify are
+ * added to the checksum errors. The progress callback, if set, is called after every
+ * chunk and should return 1 to continue or 0 to abort the scan
+ * Returns 1 if successful, 0 if aborted or -1 on error
  */
-int libewf_handle_append_checksum_error(
+int libewf_handle_scan_chunk_integrity(
      libewf_handle_t *handle,
-     uint64_t start_sector,
-     uint64_t number_of_sectors,
+     int (*progress_callback)(
+            size64_t bytes_scanned,
+            size64_t media_size,
+            void *callback_data ),
+     void *callback_data,
      libcerror_error_t **error )
 {
 	libewf_internal_handle_t *internal_handle = NULL;
-	static char *function                     = "libewf_handle_append_checksum_error";
+	static char *function                     = "libewf_handle_scan_chunk_integrity";
 	int result                                = 0;
 
 	if( handle == NULL )
@@ -12874,6 +17394,17 @@ int libewf_handle_append_checksum_error(
 	}
 	internal_handle = (libewf_internal_handle_t *) handle;
 
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_handle->read_write_lock,
@@ -12889,19 +17420,20 @@ int libewf_handle_append_checksum_error(
 		return( -1 );
 	}
 #endif
-	result = libewf_chunk_table_append_checksum_error(
-	          internal_handle->chunk_table,
-	          start_sector,
-	          number_of_sectors,
+	result = libewf_internal_handle_scan_chunk_integrity_file_io_pool(
+	          internal_handle,
+	          internal_handle->file_io_pool,
+	          progress_callback,
+	          callback_data,
 	          error );
 
-	if( result != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append checksum error.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan chunk integrity.",
 		 function );
 	}
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
@@ -25,11 +25,16 @@
 #include <common.h>
 #include <types.h>
 
+#include "libewf_async_reader.h"
+#include "libewf_block_hashes.h"
 #include "libewf_chunk_data.h"
 #include "libewf_chunk_group.h"
 #include "libewf_chunk_table.h"
+#include "libewf_compressed_chunk_cache.h"
 #include "libewf_data_chunk.h"
+#include "libewf_encryption_context.h"
 #include "libewf_extern.h"
+#include "libewf_file_descriptor_pool.h"
 #include "libewf_hash_sections.h"
 #include "libewf_libbfio.h"
 #include "libewf_libcdata.h"
@@ -40,8 +45,11 @@
 #include "libewf_libfvalue.h"
 #include "libewf_io_handle.h"
 #include "libewf_media_values.h"
+#include "libewf_persistent_cache.h"
 #include "libewf_read_io_handle.h"
 #include "libewf_segment_table.h"
+#include "libewf_shared_chunk_cache.h"
+#include "libewf_shared_metadata.h"
 #include "libewf_single_files.h"
 #include "libewf_types.h"
 #include "libewf_write_io_handle.h"
@@ -82,6 +90,58 @@ struct libewf_internal_handle
 	 */
 	uint8_t file_io_pool_created_in_library;
 
+	/* The file descriptor pool
+	 * Used for positional reads of the segment files of a read-only handle
+	 */
+	libewf_file_descriptor_pool_t *file_descriptor_pool;
+
+	/* The persistent cache directory
+	 */
+	char *persistent_cache_directory;
+
+	/* The maximum persistent cache size
+	 */
+	size64_t maximum_persistent_cache_size;
+
+	/* The persistent cache
+	 * Used to store unpacked chunk data of a read-only handle across opens
+	 */
+	libewf_persistent_cache_t *persistent_cache;
+
+	/* The maximum compressed chunk cache size
+	 */
+	size64_t maximum_compressed_chunk_cache_size;
+
+	/* The compressed chunk cache
+	 * Used to store compressed chunk data of a read-only handle in addition
+	 * to the unpacked chunk data in the chunk data cache
+	 */
+	libewf_compressed_chunk_cache_t *compressed_chunk_cache;
+
+	/* Value to indicate if the process-wide shared chunk cache should be used
+	 */
+	uint8_t use_shared_chunk_cache;
+
+	/* The shared chunk cache
+	 * Used to store unpacked chunk data of read-only handles by its compressed data
+	 * Contains a reference to the process-wide shared chunk cache
+	 */
+	libewf_shared_chunk_cache_t *shared_chunk_cache;
+
+	/* The asynchronous reader
+	 * Used to serve the asynchronous read requests
+	 */
+	libewf_async_reader_t *async_reader;
+
+	/* The access advice
+	 */
+	int access_advice;
+
+	/* The encryption context
+	 * Used to decrypt the sections and chunk data of encrypted segment files
+	 */
+	libewf_encryption_context_t *encryption_context;
+
 	/* The read IO handle
 	 */
 	libewf_read_io_handle_t *read_io_handle;
@@ -94,6 +154,10 @@ struct libewf_internal_handle
 	 */
 	int maximum_number_of_open_handles;
 
+	/* The number of threads used to verify the chunk data when scanning the chunk integrity
+	 */
+	int number_of_integrity_scan_threads;
+
 	/* The current (storage media) offset
 	 */
 	off64_t current_offset;
@@ -134,10 +198,19 @@ struct libewf_internal_handle
 	 */
 	uint8_t hash_values_parsed;
 
+	/* The block hashes
+	 */
+	libewf_block_hashes_t *block_hashes;
+
 	/* The single files
 	 */
 	libewf_single_files_t *single_files;
 
+	/* The shared metadata
+	 * Contains the metadata that is shared with lightweight clones
+	 */
+	libewf_shared_metadata_t *shared_metadata;
+
 #if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -161,6 +234,22 @@ int libewf_handle_clone(
      libewf_handle_t *source_handle,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_clone_shared(
+     libewf_handle_t **destination_handle,
+     libewf_handle_t *source_handle,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_share_metadata(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_clone(
+     libewf_handle_t **destination_handle,
+     libewf_internal_handle_t *internal_source_handle,
+     uint8_t share_metadata,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_handle_signal_abort(
      libewf_handle_t *handle,
@@ -247,6 +336,22 @@ ssize_t libewf_handle_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_read_async(
+     libewf_handle_t *handle,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     void (*callback)(
+            libewf_handle_t *handle,
+            off64_t offset,
+            void *buffer,
+            ssize_t read_count,
+            int result,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
 ssize_t libewf_internal_handle_write_buffer_to_file_io_pool(
          libewf_internal_handle_t *internal_handle,
          libbfio_pool_t *file_io_pool,
@@ -299,6 +404,22 @@ ssize_t libewf_handle_write_data_chunk(
          libewf_data_chunk_t *data_chunk,
          libcerror_error_t **error );
 
+ssize_t libewf_internal_handle_write_packed_data_chunk_to_file_io_pool(
+         libewf_internal_handle_t *internal_handle,
+         libbfio_pool_t *file_io_pool,
+         libewf_internal_data_chunk_t *internal_data_chunk,
+         libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+ssize_t libewf_handle_write_packed_data_chunk(
+         libewf_handle_t *handle,
+         libewf_data_chunk_t *data_chunk,
+         libcerror_error_t **error );
+
+int libewf_internal_handle_set_media_digests(
+     libewf_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
 ssize_t libewf_internal_handle_write_finalize_file_io_pool(
          libewf_internal_handle_t *internal_handle,
          libbfio_pool_t *file_io_pool,
@@ -328,12 +449,75 @@ int libewf_handle_get_offset(
      off64_t *offset,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_get_next_data_range(
+     libewf_handle_t *handle,
+     off64_t offset,
+     off64_t *data_range_offset,
+     size64_t *data_range_size,
+     libcerror_error_t **error );
+
+int libewf_internal_handle_divide_maximum_number_of_open_handles(
+     int maximum_number_of_open_handles,
+     int *maximum_number_of_file_io_pool_handles,
+     int *maximum_number_of_file_descriptors,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_handle_set_maximum_number_of_open_handles(
      libewf_handle_t *handle,
      int maximum_number_of_open_handles,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_set_persistent_cache_directory(
+     libewf_handle_t *handle,
+     const char *directory,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_maximum_compressed_chunk_cache_size(
+     libewf_handle_t *handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_use_shared_chunk_cache(
+     libewf_handle_t *handle,
+     uint8_t use_shared_chunk_cache,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_number_of_integrity_scan_threads(
+     libewf_handle_t *handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+void libewf_internal_handle_prefetch_callback(
+      libewf_handle_t *handle,
+      off64_t offset,
+      void *buffer,
+      ssize_t read_count,
+      int result,
+      void *callback_data );
+
+int libewf_internal_handle_prefetch_range(
+     libewf_internal_handle_t *internal_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+#endif
+
+LIBEWF_EXTERN \
+int libewf_handle_advise(
+     libewf_handle_t *handle,
+     off64_t offset,
+     size64_t size,
+     int advice,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_handle_segment_files_corrupted(
      libewf_handle_t *handle,
@@ -344,6 +528,20 @@ int libewf_handle_segment_files_encrypted(
      libewf_handle_t *handle,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_set_encryption_key(
+     libewf_handle_t *handle,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_encryption_initialization_vector(
+     libewf_handle_t *handle,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_handle_get_segment_filename_size(
      libewf_handle_t *handle,
@@ -489,6 +687,13 @@ int libewf_handle_get_file_entry_by_utf16_path(
      libewf_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_get_file_entry_by_file_entry(
+     libewf_handle_t *handle,
+     libewf_file_entry_t *source_file_entry,
+     libewf_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_handle_get_sectors_per_chunk(
      libewf_handle_t *handle,
@@ -660,6 +865,56 @@ int libewf_handle_set_sha1_hash(
      size_t size,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_handle_get_calculate_digest_flags(
+     libewf_handle_t *handle,
+     uint8_t *calculate_digest_flags,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_calculate_digest_flags(
+     libewf_handle_t *handle,
+     uint8_t calculate_digest_flags,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_number_of_chunks_per_block_hash(
+     libewf_handle_t *handle,
+     uint32_t *number_of_chunks_per_block,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_set_number_of_chunks_per_block_hash(
+     libewf_handle_t *handle,
+     uint32_t number_of_chunks_per_block,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_number_of_block_hashes(
+     libewf_handle_t *handle,
+     uint64_t *number_of_block_hashes,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_get_block_hash(
+     libewf_handle_t *handle,
+     uint64_t block_index,
+     uint8_t *md5_hash,
+     size_t size,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_read_block_hashes_file_io_handle(
+     libewf_handle_t *handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_write_block_hashes_file_io_handle(
+     libewf_handle_t *handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_handle_set_read_zero_chunk_on_error(
      libewf_handle_t *handle,
@@ -714,6 +969,26 @@ int libewf_handle_append_checksum_error(
      uint64_t number_of_sectors,
      libcerror_error_t **error );
 
+int libewf_internal_handle_scan_chunk_integrity_file_io_pool(
+     libewf_internal_handle_t *internal_handle,
+     libbfio_pool_t *file_io_pool,
+     int (*progress_callback)(
+            size64_t bytes_scanned,
+            size64_t media_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBEWF_EXTERN \
+int libewf_handle_scan_chunk_integrity(
+     libewf_handle_t *handle,
+     int (*progress_callback)(
+            size64_t bytes_scanned,
+            size64_t media_size,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_handle_get_number_of_sessions(
      libewf_handle_t *handle,
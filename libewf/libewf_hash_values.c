@@ -292,6 +292,127 @@ int libewf_hash_values_parse_sha1_hash(
 	return( 1 );
 }
 
+/* Parses a SHA256 hash for its value
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_hash_values_parse_sha256_hash(
+     libfvalue_table_t *hash_values,
+     const uint8_t *sha256_hash,
+     size_t sha256_hash_size,
+     libcerror_error_t **error )
+{
+	uint8_t sha256_hash_string[ 65 ];
+
+	libfvalue_value_t *hash_value   = NULL;
+	static char *function           = "libewf_hash_values_parse_sha256_hash";
+	size_t sha256_hash_index        = 0;
+	size_t sha256_hash_string_index = 0;
+	int result                      = 0;
+	uint8_t sha256_digit            = 0;
+
+	if( hash_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash values.",
+		 function );
+
+		return( -1 );
+	}
+	if( sha256_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SHA256 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sha256_hash_size < 32 )
+	 || ( sha256_hash_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid SHA256 hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvalue_table_get_value_by_identifier(
+	          hash_values,
+	          (uint8_t *) "SHA256",
+	          7,
+	          &hash_value,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve if hash value: SHA256.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		for( sha256_hash_index = 0;
+		     sha256_hash_index < 32;
+		     sha256_hash_index++ )
+		{
+			sha256_digit = sha256_hash[ sha256_hash_index ] / 16;
+
+			if( sha256_digit <= 9 )
+			{
+				sha256_hash_string[ sha256_hash_string_index++ ] = (uint8_t) '0' + sha256_digit;
+			}
+			else
+			{
+				sha256_hash_string[ sha256_hash_string_index++ ] = (uint8_t) 'a' + ( sha256_digit - 10 );
+			}
+			sha256_digit = sha256_hash[ sha256_hash_index ] % 16;
+
+			if( sha256_digit <= 9 )
+			{
+				sha256_hash_string[ sha256_hash_string_index++ ] = (uint8_t) '0' + sha256_digit;
+			}
+			else
+			{
+				sha256_hash_string[ sha256_hash_string_index++ ] = (uint8_t) 'a' + ( sha256_digit - 10 );
+			}
+		}
+		sha256_hash_string[ sha256_hash_string_index++ ] = 0;
+
+		if( libewf_value_table_set_value_by_identifier(
+		     hash_values,
+		     (uint8_t *) "SHA256",
+		     7,
+		     (uint8_t *) sha256_hash_string,
+		     65,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set hash value: SHA256.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
 /* Parses a xhash for the hash values
  * Returns 1 if successful or -1 on error
  */
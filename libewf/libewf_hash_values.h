@@ -48,6 +48,12 @@ int libewf_hash_values_parse_sha1_hash(
      size_t sha1_hash_size,
      libcerror_error_t **error );
 
+int libewf_hash_values_parse_sha256_hash(
+     libfvalue_table_t *hash_values,
+     const uint8_t *sha256_hash,
+     size_t sha256_hash_size,
+     libcerror_error_t **error );
+
 int libewf_hash_values_parse_xhash(
      libfvalue_table_t *hash_values,
      const uint8_t *xhash,
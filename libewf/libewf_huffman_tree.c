@@ -179,6 +179,44 @@ int libewf_huffman_tree_initialize(
 
 		goto on_error;
 	}
+	if( maximum_code_size < LIBEWF_HUFFMAN_TREE_MAXIMUM_LOOKUP_TABLE_BITS )
+	{
+		( *huffman_tree )->lookup_table_bits = maximum_code_size;
+	}
+	else
+	{
+		( *huffman_tree )->lookup_table_bits = LIBEWF_HUFFMAN_TREE_MAXIMUM_LOOKUP_TABLE_BITS;
+	}
+	array_size = sizeof( int ) << ( *huffman_tree )->lookup_table_bits;
+
+	( *huffman_tree )->lookup_table = (int *) memory_allocate(
+	                                           array_size );
+
+	if( ( *huffman_tree )->lookup_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create lookup table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *huffman_tree )->lookup_table,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup table.",
+		 function );
+
+		goto on_error;
+	}
 	( *huffman_tree )->maximum_code_size = maximum_code_size;
 
 	return( 1 );
@@ -186,6 +224,11 @@ int libewf_huffman_tree_initialize(
 on_error:
 	if( *huffman_tree != NULL )
 	{
+		if( ( *huffman_tree )->lookup_table != NULL )
+		{
+			memory_free(
+			 ( *huffman_tree )->lookup_table );
+		}
 		if( ( *huffman_tree )->code_size_counts != NULL )
 		{
 			memory_free(
@@ -226,6 +269,11 @@ int libewf_huffman_tree_free(
 	}
 	if( *huffman_tree != NULL )
 	{
+		if( ( *huffman_tree )->lookup_table != NULL )
+		{
+			memory_free(
+			 ( *huffman_tree )->lookup_table );
+		}
 		if( ( *huffman_tree )->code_size_counts != NULL )
 		{
 			memory_free(
@@ -253,14 +301,21 @@ int libewf_huffman_tree_build(
      int number_of_code_sizes,
      libcerror_error_t **error )
 {
-	int *symbol_offsets   = NULL;
-	static char *function = "libewf_huffman_tree_build";
-	size_t array_size     = 0;
-	uint8_t bit_index     = 0;
-	uint8_t code_size     = 0;
-	int code_offset       = 0;
-	int left_value        = 0;
-	int symbol            = 0;
+	int *symbol_offsets        = NULL;
+	static char *function      = "libewf_huffman_tree_build";
+	size_t array_size          = 0;
+	uint8_t bit_index          = 0;
+	uint8_t code_size          = 0;
+	int code_offset            = 0;
+	int code_size_count        = 0;
+	int huffman_code           = 0;
+	int left_value             = 0;
+	int lookup_code_index      = 0;
+	int lookup_table_entry     = 0;
+	int lookup_table_index     = 0;
+	int number_of_lookup_codes = 0;
+	int symbol                 = 0;
+	int symbol_index           = 0;
 
 	if( huffman_tree == NULL )
 	{
@@ -436,6 +491,52 @@ int libewf_huffman_tree_build(
 	memory_free(
 	 symbol_offsets );
 
+	symbol_offsets = NULL;
+
+	/* Fill the lookup table with the canonical Huffman codes that fit in the lookup table index
+	 */
+	array_size = sizeof( int ) << huffman_tree->lookup_table_bits;
+
+	if( memory_set(
+	     huffman_tree->lookup_table,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup table.",
+		 function );
+
+		goto on_error;
+	}
+	for( bit_index = 1;
+	     bit_index <= huffman_tree->lookup_table_bits;
+	     bit_index++ )
+	{
+		/* A code of bit_index bits occupies all the lookup table entries with the same prefix
+		 */
+		number_of_lookup_codes = 1 << ( huffman_tree->lookup_table_bits - bit_index );
+
+		for( code_size_count = huffman_tree->code_size_counts[ bit_index ];
+		     code_size_count > 0;
+		     code_size_count-- )
+		{
+			lookup_table_entry = ( huffman_tree->symbols[ symbol_index ] << 8 ) | bit_index;
+			lookup_table_index = huffman_code << ( huffman_tree->lookup_table_bits - bit_index );
+
+			for( lookup_code_index = 0;
+			     lookup_code_index < number_of_lookup_codes;
+			     lookup_code_index++ )
+			{
+				huffman_tree->lookup_table[ lookup_table_index + lookup_code_index ] = lookup_table_entry;
+			}
+			huffman_code += 1;
+			symbol_index += 1;
+		}
+		huffman_code <<= 1;
+	}
 	return( 1 );
 
 on_error:
@@ -456,16 +557,19 @@ int libewf_huffman_tree_get_symbol_from_bit_stream(
      uint32_t *symbol,
      libcerror_error_t **error )
 {
-	static char *function  = "libewf_huffman_tree_get_symbol_from_bit_stream";
-	uint32_t safe_symbol   = 0;
-	uint32_t value_32bit   = 0;
-	uint8_t bit_index      = 0;
-	uint8_t number_of_bits = 0;
-	int code_size_count    = 0;
-	int first_huffman_code = 0;
-	int first_index        = 0;
-	int huffman_code       = 0;
-	int result             = 0;
+	static char *function       = "libewf_huffman_tree_get_symbol_from_bit_stream";
+	uint32_t lookup_table_index = 0;
+	uint32_t safe_symbol        = 0;
+	uint32_t value_32bit        = 0;
+	uint8_t bit_index           = 0;
+	uint8_t code_size           = 0;
+	uint8_t number_of_bits      = 0;
+	int code_size_count         = 0;
+	int first_huffman_code      = 0;
+	int first_index             = 0;
+	int huffman_code            = 0;
+	int lookup_table_entry      = 0;
+	int result                  = 0;
 
 	if( huffman_tree == NULL )
 	{
@@ -502,14 +606,12 @@ int libewf_huffman_tree_get_symbol_from_bit_stream(
 	}
 	/* Try to fill the bit buffer with the maximum number of bits
 	 */
-	while( bit_stream->bit_buffer_size < huffman_tree->maximum_code_size )
+	if( bit_stream->bit_buffer_size < huffman_tree->maximum_code_size )
 	{
-		result = libewf_bit_stream_read(
-		          bit_stream,
-		          huffman_tree->maximum_code_size,
-		          error );
-
-		if( result == -1 )
+		if( libewf_bit_stream_read(
+		     bit_stream,
+		     huffman_tree->maximum_code_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -520,9 +622,42 @@ int libewf_huffman_tree_get_symbol_from_bit_stream(
 
 			return( -1 );
 		}
-		else if( result == 0 )
+	}
+	/* If the bits are stored front to back the next bits in the bit buffer
+	 * form the Huffman code and can be used to look up the symbol directly
+	 */
+	if( ( bit_stream->storage_type == LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
+	 && ( huffman_tree->lookup_table_bits > 0 ) )
+	{
+		if( bit_stream->bit_buffer_size >= huffman_tree->lookup_table_bits )
 		{
-			break;
+			lookup_table_index = bit_stream->bit_buffer >> ( bit_stream->bit_buffer_size - huffman_tree->lookup_table_bits );
+		}
+		else
+		{
+			lookup_table_index = bit_stream->bit_buffer << ( huffman_tree->lookup_table_bits - bit_stream->bit_buffer_size );
+		}
+		lookup_table_index &= ( (uint32_t) 1 << huffman_tree->lookup_table_bits ) - 1;
+
+		lookup_table_entry = huffman_tree->lookup_table[ lookup_table_index ];
+		code_size          = (uint8_t) ( lookup_table_entry & 0xff );
+
+		if( ( code_size > 0 )
+		 && ( code_size <= bit_stream->bit_buffer_size ) )
+		{
+			bit_stream->bit_buffer_size -= code_size;
+
+			if( bit_stream->bit_buffer_size == 0 )
+			{
+				bit_stream->bit_buffer = 0;
+			}
+			else
+			{
+				bit_stream->bit_buffer &= ~( 0xffffffffUL << bit_stream->bit_buffer_size );
+			}
+			*symbol = (uint32_t) ( lookup_table_entry >> 8 );
+
+			return( 1 );
 		}
 	}
 	if( huffman_tree->maximum_code_size < bit_stream->bit_buffer_size )
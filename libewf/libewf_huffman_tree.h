@@ -32,6 +32,10 @@
 extern "C" {
 #endif
 
+/* The maximum number of bits of the lookup table index
+ */
+#define LIBEWF_HUFFMAN_TREE_MAXIMUM_LOOKUP_TABLE_BITS	10
+
 typedef struct libewf_huffman_tree libewf_huffman_tree_t;
 
 struct libewf_huffman_tree
@@ -47,6 +51,16 @@ struct libewf_huffman_tree
 	/* The code size counts array
 	 */
 	int *code_size_counts;
+
+	/* The number of bits of the lookup table index
+	 */
+	uint8_t lookup_table_bits;
+
+	/* The lookup table
+	 * Contains the symbol and code size of the Huffman codes that are not larger
+	 * than the lookup table index, stored as: ( symbol << 8 ) | code size
+	 */
+	int *lookup_table;
 };
 
 int libewf_huffman_tree_initialize(
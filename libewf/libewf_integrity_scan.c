@@ -0,0 +1,636 @@
+/*
+ * Integrity scan functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_chunk_data.h"
+#include "libewf_definitions.h"
+#include "libewf_integrity_scan.h"
+#include "libewf_io_handle.h"
+#include "libewf_libcdata.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+#include "libewf_media_values.h"
+
+/* Creates an integrity scan
+ * Make sure the value integrity_scan is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_integrity_scan_initialize(
+     libewf_integrity_scan_t **integrity_scan,
+     libewf_io_handle_t *io_handle,
+     libewf_media_values_t *media_values,
+     libcdata_range_list_t *checksum_errors,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_integrity_scan_initialize";
+
+	if( integrity_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integrity scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *integrity_scan != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid integrity scan value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media values.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_values->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid media values - bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum_errors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum errors.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*integrity_scan = memory_allocate_structure(
+	                   libewf_integrity_scan_t );
+
+	if( *integrity_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create integrity scan.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *integrity_scan,
+	     0,
+	     sizeof( libewf_integrity_scan_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear integrity scan.",
+		 function );
+
+		memory_free(
+		 *integrity_scan );
+
+		*integrity_scan = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 0 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( ( *integrity_scan )->checksum_errors_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create checksum errors mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &( ( *integrity_scan )->thread_pool ),
+		     NULL,
+		     number_of_threads,
+		     LIBEWF_INTEGRITY_SCAN_MAXIMUM_NUMBER_OF_QUEUED_CHUNKS,
+		     (int (*)(intptr_t *, void *)) &libewf_integrity_scan_verify_callback,
+		     (void *) *integrity_scan,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	( *integrity_scan )->io_handle       = io_handle;
+	( *integrity_scan )->media_values    = media_values;
+	( *integrity_scan )->checksum_errors = checksum_errors;
+
+	return( 1 );
+
+on_error:
+	if( *integrity_scan != NULL )
+	{
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( ( *integrity_scan )->checksum_errors_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *integrity_scan )->checksum_errors_mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *integrity_scan );
+
+		*integrity_scan = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an integrity scan
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_integrity_scan_free(
+     libewf_integrity_scan_t **integrity_scan,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_integrity_scan_free";
+	int result            = 1;
+
+	if( integrity_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integrity scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *integrity_scan != NULL )
+	{
+		/* The io_handle, media_values and checksum_errors references are freed elsewhere
+		 */
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( ( *integrity_scan )->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *integrity_scan )->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *integrity_scan )->checksum_errors_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *integrity_scan )->checksum_errors_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free checksum errors mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 *integrity_scan );
+
+		*integrity_scan = NULL;
+	}
+	return( result );
+}
+
+/* Verifies the integrity of packed chunk data
+ * The chunk data is unpacked in place, the corresponding sectors are added
+ * to the checksum errors if the chunk data is corrupted
+ * Returns 1 if the chunk data is intact, 0 if corrupted or -1 on error
+ */
+int libewf_integrity_scan_verify_chunk_data(
+     libewf_integrity_scan_t *integrity_scan,
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error )
+{
+	static char *function      = "libewf_integrity_scan_verify_chunk_data";
+	uint64_t number_of_sectors = 0;
+	uint64_t start_sector      = 0;
+	int result                 = 1;
+
+	if( integrity_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integrity scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_chunk_data_unpack(
+	     chunk_data,
+	     integrity_scan->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to unpack chunk: %" PRIu64 " data.",
+		 function,
+		 chunk_data->chunk_index );
+
+		return( -1 );
+	}
+	if( ( chunk_data->range_flags & LIBEWF_RANGE_FLAG_IS_CORRUPTED ) == 0 )
+	{
+		return( 1 );
+	}
+	start_sector      = chunk_data->range_start_offset / integrity_scan->media_values->bytes_per_sector;
+	number_of_sectors = integrity_scan->media_values->sectors_per_chunk;
+
+	if( ( start_sector + number_of_sectors ) > (uint64_t) integrity_scan->media_values->number_of_sectors )
+	{
+		number_of_sectors = (uint64_t) integrity_scan->media_values->number_of_sectors - start_sector;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( integrity_scan->checksum_errors_mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     integrity_scan->checksum_errors_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab checksum errors mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( libcdata_range_list_insert_range(
+	     integrity_scan->checksum_errors,
+	     start_sector,
+	     number_of_sectors,
+	     NULL,
+	     NULL,
+	     NULL,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert checksum error in range list.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		integrity_scan->number_of_corrupted_chunks += 1;
+
+		result = 0;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( integrity_scan->checksum_errors_mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     integrity_scan->checksum_errors_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release checksum errors mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( result );
+}
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+
+/* Callback function to verify chunk data from a verification thread
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_integrity_scan_verify_callback(
+     libewf_chunk_data_t *chunk_data,
+     libewf_integrity_scan_t *integrity_scan )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libewf_integrity_scan_verify_callback";
+	int result               = 1;
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		result = -1;
+	}
+	else if( integrity_scan == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integrity scan.",
+		 function );
+
+		result = -1;
+	}
+	else if( integrity_scan->verify_failed == 0 )
+	{
+		if( libewf_integrity_scan_verify_chunk_data(
+		     integrity_scan,
+		     chunk_data,
+		     &error ) == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify chunk data.",
+			 function );
+
+			/* The failure is reported by libewf_integrity_scan_finalize
+			 */
+			integrity_scan->verify_failed = 1;
+
+			result = -1;
+		}
+	}
+	if( chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &chunk_data,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
+/* Pushes packed chunk data to be verified
+ * The integrity scan takes over ownership of the chunk data
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_integrity_scan_push_chunk_data(
+     libewf_integrity_scan_t *integrity_scan,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_integrity_scan_push_chunk_data";
+
+	if( integrity_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integrity scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing chunk data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( integrity_scan->thread_pool != NULL )
+	{
+		/* Pushing blocks when the maximum number of queued chunks is reached
+		 */
+		if( libcthreads_thread_pool_push(
+		     integrity_scan->thread_pool,
+		     (intptr_t *) *chunk_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push chunk data onto thread pool queue.",
+			 function );
+
+			return( -1 );
+		}
+		*chunk_data = NULL;
+
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
+	if( libewf_integrity_scan_verify_chunk_data(
+	     integrity_scan,
+	     *chunk_data,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_chunk_data_free(
+	     chunk_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Finalizes the integrity scan
+ * Waits for the queued chunk data to be verified
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_integrity_scan_finalize(
+     libewf_integrity_scan_t *integrity_scan,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_integrity_scan_finalize";
+
+	if( integrity_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integrity scan.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( integrity_scan->thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( integrity_scan->thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( integrity_scan->verify_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
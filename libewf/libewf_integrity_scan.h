@@ -0,0 +1,120 @@
+/*
+ * Integrity scan functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_INTEGRITY_SCAN_H )
+#define _LIBEWF_INTEGRITY_SCAN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_chunk_data.h"
+#include "libewf_io_handle.h"
+#include "libewf_libcdata.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+#include "libewf_media_values.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of threads used to verify the chunk data
+ */
+#define LIBEWF_INTEGRITY_SCAN_NUMBER_OF_THREADS			4
+
+/* The maximum number of chunks queued for the verification threads
+ */
+#define LIBEWF_INTEGRITY_SCAN_MAXIMUM_NUMBER_OF_QUEUED_CHUNKS	64
+
+typedef struct libewf_integrity_scan libewf_integrity_scan_t;
+
+struct libewf_integrity_scan
+{
+	/* The IO handle
+	 */
+	libewf_io_handle_t *io_handle;
+
+	/* The media values
+	 */
+	libewf_media_values_t *media_values;
+
+	/* The sectors with checksum errors
+	 * The range list is not managed by the integrity scan
+	 */
+	libcdata_range_list_t *checksum_errors;
+
+	/* The number of corrupted chunks
+	 */
+	uint64_t number_of_corrupted_chunks;
+
+	/* Value to indicate verifying the chunk data failed
+	 */
+	uint8_t verify_failed;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The verification thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The checksum errors mutex
+	 */
+	libcthreads_mutex_t *checksum_errors_mutex;
+#endif
+};
+
+int libewf_integrity_scan_initialize(
+     libewf_integrity_scan_t **integrity_scan,
+     libewf_io_handle_t *io_handle,
+     libewf_media_values_t *media_values,
+     libcdata_range_list_t *checksum_errors,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libewf_integrity_scan_free(
+     libewf_integrity_scan_t **integrity_scan,
+     libcerror_error_t **error );
+
+int libewf_integrity_scan_verify_chunk_data(
+     libewf_integrity_scan_t *integrity_scan,
+     libewf_chunk_data_t *chunk_data,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+int libewf_integrity_scan_verify_callback(
+     libewf_chunk_data_t *chunk_data,
+     libewf_integrity_scan_t *integrity_scan );
+#endif
+
+int libewf_integrity_scan_push_chunk_data(
+     libewf_integrity_scan_t *integrity_scan,
+     libewf_chunk_data_t **chunk_data,
+     libcerror_error_t **error );
+
+int libewf_integrity_scan_finalize(
+     libewf_integrity_scan_t *integrity_scan,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_INTEGRITY_SCAN_H ) */
+
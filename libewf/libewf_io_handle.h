@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libewf_encryption_context.h"
 #include "libewf_libcerror.h"
 
 #if defined( __cplusplus )
@@ -71,6 +72,11 @@ struct libewf_io_handle
 	 */
 	uint8_t is_encrypted;
 
+	/* The encryption context
+	 * The encryption context is not managed by the IO handle
+	 */
+	libewf_encryption_context_t *encryption_context;
+
 	/* The size of an individual chunk
 	 */
 	size32_t chunk_size;
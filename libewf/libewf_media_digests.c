@@ -0,0 +1,899 @@
+/*
+ * Media digests functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_block_hashes.h"
+#include "libewf_definitions.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+#include "libewf_libhmac.h"
+#include "libewf_media_digests.h"
+
+/* Frees a media digests buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_media_digests_buffer_free(
+     libewf_media_digests_buffer_t **buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_media_digests_buffer_free";
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer != NULL )
+	{
+		if( ( *buffer )->data != NULL )
+		{
+			memory_free(
+			 ( *buffer )->data );
+		}
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates media digests
+ * Make sure the value media_digests is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_media_digests_initialize(
+     libewf_media_digests_t **media_digests,
+     uint8_t calculate_digest_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_media_digests_initialize";
+
+	if( media_digests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media digests.",
+		 function );
+
+		return( -1 );
+	}
+	if( *media_digests != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid media digests value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( calculate_digest_flags & ~( LIBEWF_CALCULATE_DIGEST_FLAG_MD5 | LIBEWF_CALCULATE_DIGEST_FLAG_SHA1 | LIBEWF_CALCULATE_DIGEST_FLAG_SHA256 ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported calculate digest flags: 0x%02" PRIx8 ".",
+		 function,
+		 calculate_digest_flags );
+
+		return( -1 );
+	}
+	*media_digests = memory_allocate_structure(
+	                  libewf_media_digests_t );
+
+	if( *media_digests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create media digests.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *media_digests,
+	     0,
+	     sizeof( libewf_media_digests_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear media digests.",
+		 function );
+
+		memory_free(
+		 *media_digests );
+
+		*media_digests = NULL;
+
+		return( -1 );
+	}
+	if( ( calculate_digest_flags & LIBEWF_CALCULATE_DIGEST_FLAG_MD5 ) != 0 )
+	{
+		if( libhmac_md5_initialize(
+		     &( ( *media_digests )->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create MD5 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( calculate_digest_flags & LIBEWF_CALCULATE_DIGEST_FLAG_SHA1 ) != 0 )
+	{
+		if( libhmac_sha1_initialize(
+		     &( ( *media_digests )->sha1_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create SHA1 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( calculate_digest_flags & LIBEWF_CALCULATE_DIGEST_FLAG_SHA256 ) != 0 )
+	{
+		if( libhmac_sha256_initialize(
+		     &( ( *media_digests )->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create SHA256 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* A single thread is used so that the data is digested in the order it was queued
+	 */
+	if( libcthreads_thread_pool_create(
+	     &( ( *media_digests )->thread_pool ),
+	     NULL,
+	     1,
+	     LIBEWF_MEDIA_DIGESTS_MAXIMUM_NUMBER_OF_QUEUED_BUFFERS,
+	     (int (*)(intptr_t *, void *)) &libewf_media_digests_update_callback,
+	     (void *) *media_digests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *media_digests )->calculate_digest_flags = calculate_digest_flags;
+
+	return( 1 );
+
+on_error:
+	if( *media_digests != NULL )
+	{
+		if( ( *media_digests )->sha256_context != NULL )
+		{
+			libhmac_sha256_free(
+			 &( ( *media_digests )->sha256_context ),
+			 NULL );
+		}
+		if( ( *media_digests )->sha1_context != NULL )
+		{
+			libhmac_sha1_free(
+			 &( ( *media_digests )->sha1_context ),
+			 NULL );
+		}
+		if( ( *media_digests )->md5_context != NULL )
+		{
+			libhmac_md5_free(
+			 &( ( *media_digests )->md5_context ),
+			 NULL );
+		}
+		memory_free(
+		 *media_digests );
+
+		*media_digests = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees media digests
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_media_digests_free(
+     libewf_media_digests_t **media_digests,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_media_digests_free";
+	int result            = 1;
+
+	if( media_digests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media digests.",
+		 function );
+
+		return( -1 );
+	}
+	if( *media_digests != NULL )
+	{
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( ( *media_digests )->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *media_digests )->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *media_digests )->md5_context != NULL )
+		{
+			if( libhmac_md5_free(
+			     &( ( *media_digests )->md5_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free MD5 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *media_digests )->sha1_context != NULL )
+		{
+			if( libhmac_sha1_free(
+			     &( ( *media_digests )->sha1_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA1 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *media_digests )->sha256_context != NULL )
+		{
+			if( libhmac_sha256_free(
+			     &( ( *media_digests )->sha256_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA256 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *media_digests );
+
+		*media_digests = NULL;
+	}
+	return( result );
+}
+
+/* Updates the digest contexts and block hashes with the media data
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_media_digests_update_contexts(
+     libewf_media_digests_t *media_digests,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_media_digests_update_contexts";
+
+	if( media_digests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media digests.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_digests->md5_context != NULL )
+	{
+		if( libhmac_md5_update(
+		     media_digests->md5_context,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update MD5 digest hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( media_digests->sha1_context != NULL )
+	{
+		if( libhmac_sha1_update(
+		     media_digests->sha1_context,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA1 digest hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( media_digests->sha256_context != NULL )
+	{
+		if( libhmac_sha256_update(
+		     media_digests->sha256_context,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA256 digest hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( media_digests->block_hashes != NULL )
+	{
+		if( libewf_block_hashes_append_chunk(
+		     media_digests->block_hashes,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update block hashes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+
+/* Callback function to update the digest contexts from the digest thread
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_media_digests_update_callback(
+     libewf_media_digests_buffer_t *buffer,
+     libewf_media_digests_t *media_digests )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libewf_media_digests_update_callback";
+	int result               = 1;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		result = -1;
+	}
+	else if( media_digests == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media digests.",
+		 function );
+
+		result = -1;
+	}
+	else if( media_digests->update_failed == 0 )
+	{
+		if( libewf_media_digests_update_contexts(
+		     media_digests,
+		     buffer->data,
+		     buffer->data_size,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update digest contexts.",
+			 function );
+
+			/* The failure is reported by libewf_media_digests_finalize
+			 */
+			media_digests->update_failed = 1;
+
+			result = -1;
+		}
+	}
+	if( buffer != NULL )
+	{
+		libewf_media_digests_buffer_free(
+		 &buffer,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
+/* Updates the media digests with a copy of the media data
+ * The data must contain a single chunk and be provided in media order
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_media_digests_update(
+     libewf_media_digests_t *media_digests,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_media_digests_update";
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	uint8_t *data_copy    = NULL;
+#endif
+
+	if( media_digests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media digests.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( media_digests->thread_pool != NULL )
+	{
+		data_copy = (uint8_t *) memory_allocate(
+		                         sizeof( uint8_t ) * data_size );
+
+		if( data_copy == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data copy.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     data_copy,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			memory_free(
+			 data_copy );
+
+			return( -1 );
+		}
+		if( libewf_media_digests_update_with_managed_data(
+		     media_digests,
+		     &data_copy,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update media digests.",
+			 function );
+
+			if( data_copy != NULL )
+			{
+				memory_free(
+				 data_copy );
+			}
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
+	if( libewf_media_digests_update_contexts(
+	     media_digests,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest contexts.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Updates the media digests with media data that is managed by the media digests
+ * On success the media digests takes over ownership of the data and *data is set to NULL
+ * The data must contain a single chunk and be provided in media order
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_media_digests_update_with_managed_data(
+     libewf_media_digests_t *media_digests,
+     uint8_t **data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libewf_media_digests_update_with_managed_data";
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libewf_media_digests_buffer_t *buffer = NULL;
+#endif
+
+	if( media_digests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media digests.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_digests->is_finalized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid media digests - already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( media_digests->thread_pool != NULL )
+	{
+		buffer = memory_allocate_structure(
+		          libewf_media_digests_buffer_t );
+
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			return( -1 );
+		}
+		buffer->data      = *data;
+		buffer->data_size = data_size;
+
+		/* Pushing blocks when the maximum number of queued buffers is reached
+		 */
+		if( libcthreads_thread_pool_push(
+		     media_digests->thread_pool,
+		     (intptr_t *) buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push buffer onto thread pool queue.",
+			 function );
+
+			memory_free(
+			 buffer );
+
+			return( -1 );
+		}
+		*data = NULL;
+
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
+	if( libewf_media_digests_update_contexts(
+	     media_digests,
+	     *data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest contexts.",
+		 function );
+
+		return( -1 );
+	}
+	memory_free(
+	 *data );
+
+	*data = NULL;
+
+	return( 1 );
+}
+
+/* Finalizes the media digests
+ * Waits for the queued media data to be digested
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_media_digests_finalize(
+     libewf_media_digests_t *media_digests,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_media_digests_finalize";
+
+	if( media_digests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media digests.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_digests->is_finalized != 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( media_digests->thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( media_digests->thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( media_digests->update_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest contexts.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_digests->md5_context != NULL )
+	{
+		if( libhmac_md5_finalize(
+		     media_digests->md5_context,
+		     media_digests->md5_hash,
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to finalize MD5 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( media_digests->sha1_context != NULL )
+	{
+		if( libhmac_sha1_finalize(
+		     media_digests->sha1_context,
+		     media_digests->sha1_hash,
+		     20,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to finalize SHA1 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( media_digests->sha256_context != NULL )
+	{
+		if( libhmac_sha256_finalize(
+		     media_digests->sha256_context,
+		     media_digests->sha256_hash,
+		     32,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to finalize SHA256 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( media_digests->block_hashes != NULL )
+	{
+		if( libewf_block_hashes_finalize(
+		     media_digests->block_hashes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize block hashes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	media_digests->is_finalized = 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,152 @@
+/*
+ * Media digests functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_MEDIA_DIGESTS_H )
+#define _LIBEWF_MEDIA_DIGESTS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_block_hashes.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+#include "libewf_libhmac.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of media data buffers queued for the digest thread
+ */
+#define LIBEWF_MEDIA_DIGESTS_MAXIMUM_NUMBER_OF_QUEUED_BUFFERS	256
+
+typedef struct libewf_media_digests_buffer libewf_media_digests_buffer_t;
+
+struct libewf_media_digests_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+typedef struct libewf_media_digests libewf_media_digests_t;
+
+struct libewf_media_digests
+{
+	/* The calculate digest flags
+	 */
+	uint8_t calculate_digest_flags;
+
+	/* The MD5 context
+	 */
+	libhmac_md5_context_t *md5_context;
+
+	/* The SHA1 context
+	 */
+	libhmac_sha1_context_t *sha1_context;
+
+	/* The SHA256 context
+	 */
+	libhmac_sha256_context_t *sha256_context;
+
+	/* The MD5 hash
+	 */
+	uint8_t md5_hash[ 16 ];
+
+	/* The SHA1 hash
+	 */
+	uint8_t sha1_hash[ 20 ];
+
+	/* The SHA256 hash
+	 */
+	uint8_t sha256_hash[ 32 ];
+
+	/* The block hashes
+	 * The block hashes are not managed by the media digests
+	 */
+	libewf_block_hashes_t *block_hashes;
+
+	/* Value to indicate the digests were finalized
+	 */
+	uint8_t is_finalized;
+
+	/* Value to indicate updating the digests failed
+	 */
+	uint8_t update_failed;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The digest thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+#endif
+};
+
+int libewf_media_digests_buffer_free(
+     libewf_media_digests_buffer_t **buffer,
+     libcerror_error_t **error );
+
+int libewf_media_digests_initialize(
+     libewf_media_digests_t **media_digests,
+     uint8_t calculate_digest_flags,
+     libcerror_error_t **error );
+
+int libewf_media_digests_free(
+     libewf_media_digests_t **media_digests,
+     libcerror_error_t **error );
+
+int libewf_media_digests_update_contexts(
+     libewf_media_digests_t *media_digests,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+int libewf_media_digests_update_callback(
+     libewf_media_digests_buffer_t *buffer,
+     libewf_media_digests_t *media_digests );
+#endif
+
+int libewf_media_digests_update(
+     libewf_media_digests_t *media_digests,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libewf_media_digests_update_with_managed_data(
+     libewf_media_digests_t *media_digests,
+     uint8_t **data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libewf_media_digests_finalize(
+     libewf_media_digests_t *media_digests,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_MEDIA_DIGESTS_H ) */
+
@@ -0,0 +1,2577 @@
+/*
+ * Persistent (on-disk) chunk cache functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libewf_checksum.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+#include "libewf_persistent_cache.h"
+
+const uint8_t libewf_persistent_cache_file_signature[ 8 ] = {
+	'e', 'w', 'f', 'c', 'a', 'c', 'h', 'e' };
+
+const char libewf_persistent_cache_hexadecimal_digits[ 16 ] = {
+	'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+typedef struct libewf_persistent_cache_slot_order libewf_persistent_cache_slot_order_t;
+
+struct libewf_persistent_cache_slot_order
+{
+	/* The value of the access counter when the slot was last used
+	 */
+	uint64_t last_access;
+
+	/* The slot index
+	 */
+	int slot_index;
+};
+
+/* Compares the slot order of two slots, the most recently used slot first
+ * Returns -1, 0 or 1 as expected by qsort
+ */
+static int libewf_persistent_cache_compare_slot_order(
+            const void *first_value,
+            const void *second_value )
+{
+	const libewf_persistent_cache_slot_order_t *first_slot_order  = (const libewf_persistent_cache_slot_order_t *) first_value;
+	const libewf_persistent_cache_slot_order_t *second_slot_order = (const libewf_persistent_cache_slot_order_t *) second_value;
+
+	if( first_slot_order->last_access > second_slot_order->last_access )
+	{
+		return( -1 );
+	}
+	else if( first_slot_order->last_access < second_slot_order->last_access )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Creates a persistent cache
+ * Make sure the value persistent_cache is referencing, is set to NULL
+ * The number of slots is determined by the maximum cache size, where every slot
+ * requires the chunk size and the size of a slot descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_persistent_cache_initialize(
+     libewf_persistent_cache_t **persistent_cache,
+     uint32_t chunk_size,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libewf_persistent_cache_initialize";
+	size64_t number_of_slots = 0;
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *persistent_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid persistent cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( (size_t) chunk_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_slots = maximum_cache_size / ( (size64_t) chunk_size + LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE );
+
+	if( number_of_slots == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid maximum cache size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots > (size64_t) LIBEWF_PERSISTENT_CACHE_MAXIMUM_NUMBER_OF_SLOTS )
+	{
+		number_of_slots = (size64_t) LIBEWF_PERSISTENT_CACHE_MAXIMUM_NUMBER_OF_SLOTS;
+	}
+	*persistent_cache = memory_allocate_structure(
+	                     libewf_persistent_cache_t );
+
+	if( *persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create persistent cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *persistent_cache,
+	     0,
+	     sizeof( libewf_persistent_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear persistent cache.",
+		 function );
+
+		memory_free(
+		 *persistent_cache );
+
+		*persistent_cache = NULL;
+
+		return( -1 );
+	}
+	( *persistent_cache )->file_descriptor        = -1;
+	( *persistent_cache )->chunk_size             = chunk_size;
+	( *persistent_cache )->number_of_slots        = (int) number_of_slots;
+	( *persistent_cache )->number_of_hash_buckets = 1;
+
+	/* The number of hash buckets is a power of 2 so that the chunk index
+	 * can be mapped onto a bucket with a mask
+	 */
+	while( ( *persistent_cache )->number_of_hash_buckets < ( *persistent_cache )->number_of_slots )
+	{
+		( *persistent_cache )->number_of_hash_buckets <<= 1;
+	}
+	( *persistent_cache )->slots = (libewf_persistent_cache_slot_t *) memory_allocate(
+	                                                                   sizeof( libewf_persistent_cache_slot_t ) * ( *persistent_cache )->number_of_slots );
+
+	if( ( *persistent_cache )->slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		goto on_error;
+	}
+	( *persistent_cache )->hash_buckets = (int *) memory_allocate(
+	                                               sizeof( int ) * ( *persistent_cache )->number_of_hash_buckets );
+
+	if( ( *persistent_cache )->hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_persistent_cache_clear_slots(
+	     *persistent_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *persistent_cache )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *persistent_cache != NULL )
+	{
+		if( ( *persistent_cache )->hash_buckets != NULL )
+		{
+			memory_free(
+			 ( *persistent_cache )->hash_buckets );
+		}
+		if( ( *persistent_cache )->slots != NULL )
+		{
+			memory_free(
+			 ( *persistent_cache )->slots );
+		}
+		memory_free(
+		 *persistent_cache );
+
+		*persistent_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a persistent cache
+ * The persistent cache file is closed if still open
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_persistent_cache_free(
+     libewf_persistent_cache_t **persistent_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_persistent_cache_free";
+	int result            = 1;
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *persistent_cache != NULL )
+	{
+		if( ( *persistent_cache )->file_descriptor != -1 )
+		{
+			if( libewf_persistent_cache_close(
+			     *persistent_cache,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close persistent cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *persistent_cache )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 ( *persistent_cache )->hash_buckets );
+
+		memory_free(
+		 ( *persistent_cache )->slots );
+
+		memory_free(
+		 *persistent_cache );
+
+		*persistent_cache = NULL;
+	}
+	return( result );
+}
+
+/* Marks all the slots as unused
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_persistent_cache_clear_slots(
+     libewf_persistent_cache_t *persistent_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_persistent_cache_clear_slots";
+	int bucket_index      = 0;
+	int slot_index        = 0;
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( slot_index = 0;
+	     slot_index < persistent_cache->number_of_slots;
+	     slot_index++ )
+	{
+		persistent_cache->slots[ slot_index ].chunk_index          = 0;
+		persistent_cache->slots[ slot_index ].data_size            = 0;
+		persistent_cache->slots[ slot_index ].checksum             = 0;
+		persistent_cache->slots[ slot_index ].last_access          = 0;
+		persistent_cache->slots[ slot_index ].is_used              = 0;
+		persistent_cache->slots[ slot_index ].previous_slot_index  = slot_index - 1;
+		persistent_cache->slots[ slot_index ].next_slot_index      = slot_index + 1;
+		persistent_cache->slots[ slot_index ].next_hash_slot_index = -1;
+	}
+	persistent_cache->slots[ persistent_cache->number_of_slots - 1 ].next_slot_index = -1;
+
+	for( bucket_index = 0;
+	     bucket_index < persistent_cache->number_of_hash_buckets;
+	     bucket_index++ )
+	{
+		persistent_cache->hash_buckets[ bucket_index ] = -1;
+	}
+	persistent_cache->first_slot_index = 0;
+	persistent_cache->last_slot_index  = persistent_cache->number_of_slots - 1;
+	persistent_cache->access_counter   = 0;
+
+	return( 1 );
+}
+
+/* Removes a slot from the least recently used list
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_persistent_cache_unlink_slot(
+     libewf_persistent_cache_t *persistent_cache,
+     int slot_index,
+     libcerror_error_t **error )
+{
+	libewf_persistent_cache_slot_t *slot = NULL;
+	static char *function                = "libewf_persistent_cache_unlink_slot";
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= persistent_cache->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slot = &( persistent_cache->slots[ slot_index ] );
+
+	if( slot->previous_slot_index != -1 )
+	{
+		persistent_cache->slots[ slot->previous_slot_index ].next_slot_index = slot->next_slot_index;
+	}
+	else
+	{
+		persistent_cache->first_slot_index = slot->next_slot_index;
+	}
+	if( slot->next_slot_index != -1 )
+	{
+		persistent_cache->slots[ slot->next_slot_index ].previous_slot_index = slot->previous_slot_index;
+	}
+	else
+	{
+		persistent_cache->last_slot_index = slot->previous_slot_index;
+	}
+	slot->previous_slot_index = -1;
+	slot->next_slot_index     = -1;
+
+	return( 1 );
+}
+
+/* Adds an unlinked slot to the front (most recently used) or back (least recently used)
+ * of the least recently used list
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_persistent_cache_link_slot(
+     libewf_persistent_cache_t *persistent_cache,
+     int slot_index,
+     uint8_t at_front,
+     libcerror_error_t **error )
+{
+	libewf_persistent_cache_slot_t *slot = NULL;
+	static char *function                = "libewf_persistent_cache_link_slot";
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= persistent_cache->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slot = &( persistent_cache->slots[ slot_index ] );
+
+	if( at_front != 0 )
+	{
+		slot->previous_slot_index = -1;
+		slot->next_slot_index     = persistent_cache->first_slot_index;
+
+		if( persistent_cache->first_slot_index != -1 )
+		{
+			persistent_cache->slots[ persistent_cache->first_slot_index ].previous_slot_index = slot_index;
+		}
+		else
+		{
+			persistent_cache->last_slot_index = slot_index;
+		}
+		persistent_cache->first_slot_index = slot_index;
+	}
+	else
+	{
+		slot->previous_slot_index = persistent_cache->last_slot_index;
+		slot->next_slot_index     = -1;
+
+		if( persistent_cache->last_slot_index != -1 )
+		{
+			persistent_cache->slots[ persistent_cache->last_slot_index ].next_slot_index = slot_index;
+		}
+		else
+		{
+			persistent_cache->first_slot_index = slot_index;
+		}
+		persistent_cache->last_slot_index = slot_index;
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of the slot that contains a specific chunk
+ * Returns 1 if successful, 0 if no such slot or -1 on error
+ */
+int libewf_persistent_cache_get_slot_index(
+     libewf_persistent_cache_t *persistent_cache,
+     uint64_t chunk_index,
+     int *slot_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_persistent_cache_get_slot_index";
+	int safe_slot_index   = 0;
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_slot_index = persistent_cache->hash_buckets[ chunk_index & (uint64_t) ( persistent_cache->number_of_hash_buckets - 1 ) ];
+
+	while( safe_slot_index != -1 )
+	{
+		if( persistent_cache->slots[ safe_slot_index ].chunk_index == chunk_index )
+		{
+			*slot_index = safe_slot_index;
+
+			return( 1 );
+		}
+		safe_slot_index = persistent_cache->slots[ safe_slot_index ].next_hash_slot_index;
+	}
+	return( 0 );
+}
+
+/* Inserts a slot in the hash bucket of its chunk index
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_persistent_cache_insert_slot_in_hash(
+     libewf_persistent_cache_t *persistent_cache,
+     int slot_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_persistent_cache_insert_slot_in_hash";
+	int bucket_index      = 0;
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= persistent_cache->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( persistent_cache->slots[ slot_index ].chunk_index & (uint64_t) ( persistent_cache->number_of_hash_buckets - 1 ) );
+
+	persistent_cache->slots[ slot_index ].next_hash_slot_index = persistent_cache->hash_buckets[ bucket_index ];
+	persistent_cache->hash_buckets[ bucket_index ]              = slot_index;
+
+	return( 1 );
+}
+
+/* Removes a slot from the hash bucket of its chunk index
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_persistent_cache_remove_slot_from_hash(
+     libewf_persistent_cache_t *persistent_cache,
+     int slot_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_persistent_cache_remove_slot_from_hash";
+	int *hash_slot_index  = NULL;
+	int bucket_index      = 0;
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= persistent_cache->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index    = (int) ( persistent_cache->slots[ slot_index ].chunk_index & (uint64_t) ( persistent_cache->number_of_hash_buckets - 1 ) );
+	hash_slot_index = &( persistent_cache->hash_buckets[ bucket_index ] );
+
+	while( *hash_slot_index != -1 )
+	{
+		if( *hash_slot_index == slot_index )
+		{
+			*hash_slot_index = persistent_cache->slots[ slot_index ].next_hash_slot_index;
+
+			break;
+		}
+		hash_slot_index = &( persistent_cache->slots[ *hash_slot_index ].next_hash_slot_index );
+	}
+	persistent_cache->slots[ slot_index ].next_hash_slot_index = -1;
+
+	return( 1 );
+}
+
+/* Reads a buffer at a specific offset from the persistent cache file
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libewf_persistent_cache_read_at_offset(
+         libewf_persistent_cache_t *persistent_cache,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libewf_persistent_cache_read_at_offset";
+	size_t buffer_offset  = 0;
+	ssize_t read_count    = 0;
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_PERSISTENT_CACHE )
+	while( buffer_offset < size )
+	{
+		read_count = pread(
+		              persistent_cache->file_descriptor,
+		              &( buffer[ buffer_offset ] ),
+		              size - buffer_offset,
+		              (off_t) ( offset + buffer_offset ) );
+
+		if( read_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read from persistent cache file at offset: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset += (size_t) read_count;
+	}
+	return( (ssize_t) buffer_offset );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: persistent cache not supported.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+/* Writes a buffer at a specific offset to the persistent cache file
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libewf_persistent_cache_write_at_offset(
+         libewf_persistent_cache_t *persistent_cache,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libewf_persistent_cache_write_at_offset";
+	size_t buffer_offset  = 0;
+	ssize_t write_count   = 0;
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_PERSISTENT_CACHE )
+	while( buffer_offset < size )
+	{
+		write_count = pwrite(
+		               persistent_cache->file_descriptor,
+		               &( buffer[ buffer_offset ] ),
+		               size - buffer_offset,
+		               (off_t) ( offset + buffer_offset ) );
+
+		if( write_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 errno,
+			 "%s: unable to write to persistent cache file at offset: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+		buffer_offset += (size_t) write_count;
+	}
+	return( (ssize_t) buffer_offset );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: persistent cache not supported.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+/* Writes the descriptor of a specific slot to the persistent cache file
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_persistent_cache_write_slot_descriptor(
+     libewf_persistent_cache_t *persistent_cache,
+     int slot_index,
+     libcerror_error_t **error )
+{
+	uint8_t slot_descriptor_data[ LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE ];
+
+	libewf_persistent_cache_slot_t *slot = NULL;
+	static char *function                = "libewf_persistent_cache_write_slot_descriptor";
+	ssize_t write_count                  = 0;
+	off64_t slot_descriptor_offset       = 0;
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= persistent_cache->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slot = &( persistent_cache->slots[ slot_index ] );
+
+	if( memory_set(
+	     slot_descriptor_data,
+	     0,
+	     LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slot descriptor data.",
+		 function );
+
+		return( -1 );
+	}
+	/* An unused slot is stored with a chunk index value of 0
+	 */
+	if( slot->is_used != 0 )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( slot_descriptor_data[ 0 ] ),
+		 slot->chunk_index + 1 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( slot_descriptor_data[ 8 ] ),
+		 slot->data_size );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( slot_descriptor_data[ 12 ] ),
+		 slot->checksum );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( slot_descriptor_data[ 16 ] ),
+		 slot->last_access );
+	}
+	slot_descriptor_offset = LIBEWF_PERSISTENT_CACHE_FILE_HEADER_SIZE
+	                       + ( (off64_t) slot_index * LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE );
+
+	write_count = libewf_persistent_cache_write_at_offset(
+	               persistent_cache,
+	               slot_descriptor_data,
+	               LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE,
+	               slot_descriptor_offset,
+	               error );
+
+	if( write_count != (ssize_t) LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write slot: %d descriptor.",
+		 function,
+		 slot_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the slot descriptors from the persistent cache file
+ * The slots are ordered by their last access, slots that are not in use are
+ * placed at the back of the least recently used list
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_persistent_cache_read_slot_descriptors(
+     libewf_persistent_cache_t *persistent_cache,
+     libcerror_error_t **error )
+{
+	libewf_persistent_cache_slot_order_t *slot_order = NULL;
+	libewf_persistent_cache_slot_t *slot             = NULL;
+	uint8_t *slot_descriptors_data                   = NULL;
+	static char *function                            = "libewf_persistent_cache_read_slot_descriptors";
+	size_t slot_descriptor_data_offset               = 0;
+	size_t slot_descriptors_data_size                = 0;
+	ssize_t read_count                               = 0;
+	uint64_t chunk_index                             = 0;
+	int block_slot_index                             = 0;
+	int number_of_block_slots                        = 0;
+	int number_of_used_slots                         = 0;
+	int order_index                                  = 0;
+	int slot_index                                   = 0;
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_persistent_cache_clear_slots(
+	     persistent_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		goto on_error;
+	}
+	slot_descriptors_data_size = LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTORS_PER_BLOCK * LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE;
+
+	slot_descriptors_data = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * slot_descriptors_data_size );
+
+	if( slot_descriptors_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slot descriptors data.",
+		 function );
+
+		goto on_error;
+	}
+	slot_order = (libewf_persistent_cache_slot_order_t *) memory_allocate(
+	                                                       sizeof( libewf_persistent_cache_slot_order_t ) * persistent_cache->number_of_slots );
+
+	if( slot_order == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slot order.",
+		 function );
+
+		goto on_error;
+	}
+	while( slot_index < persistent_cache->number_of_slots )
+	{
+		number_of_block_slots = persistent_cache->number_of_slots - slot_index;
+
+		if( number_of_block_slots > LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTORS_PER_BLOCK )
+		{
+			number_of_block_slots = LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTORS_PER_BLOCK;
+		}
+		read_count = libewf_persistent_cache_read_at_offset(
+		              persistent_cache,
+		              slot_descriptors_data,
+		              (size_t) number_of_block_slots * LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE,
+		              LIBEWF_PERSISTENT_CACHE_FILE_HEADER_SIZE + ( (off64_t) slot_index * LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE ),
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read slot descriptors.",
+			 function );
+
+			goto on_error;
+		}
+		/* Slot descriptors beyond the end of the file are not in use
+		 */
+		number_of_block_slots = (int) ( read_count / LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE );
+
+		if( number_of_block_slots == 0 )
+		{
+			break;
+		}
+		slot_descriptor_data_offset = 0;
+
+		for( block_slot_index = 0;
+		     block_slot_index < number_of_block_slots;
+		     block_slot_index++ )
+		{
+			slot = &( persistent_cache->slots[ slot_index ] );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( slot_descriptors_data[ slot_descriptor_data_offset ] ),
+			 chunk_index );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( slot_descriptors_data[ slot_descriptor_data_offset + 8 ] ),
+			 slot->data_size );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( slot_descriptors_data[ slot_descriptor_data_offset + 12 ] ),
+			 slot->checksum );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( slot_descriptors_data[ slot_descriptor_data_offset + 16 ] ),
+			 slot->last_access );
+
+			if( ( chunk_index != 0 )
+			 && ( slot->data_size != 0 )
+			 && ( slot->data_size <= persistent_cache->chunk_size ) )
+			{
+				slot->chunk_index = chunk_index - 1;
+				slot->is_used     = 1;
+
+				if( libewf_persistent_cache_insert_slot_in_hash(
+				     persistent_cache,
+				     slot_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to insert slot: %d in hash.",
+					 function,
+					 slot_index );
+
+					goto on_error;
+				}
+				if( slot->last_access > persistent_cache->access_counter )
+				{
+					persistent_cache->access_counter = slot->last_access;
+				}
+				slot_order[ number_of_used_slots ].last_access = slot->last_access;
+				slot_order[ number_of_used_slots ].slot_index  = slot_index;
+
+				number_of_used_slots++;
+			}
+			else
+			{
+				slot->data_size   = 0;
+				slot->checksum    = 0;
+				slot->last_access = 0;
+			}
+			slot_descriptor_data_offset += LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE;
+
+			slot_index++;
+		}
+		if( number_of_block_slots < LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTORS_PER_BLOCK )
+		{
+			break;
+		}
+	}
+	if( number_of_used_slots > 0 )
+	{
+		qsort(
+		 slot_order,
+		 (size_t) number_of_used_slots,
+		 sizeof( libewf_persistent_cache_slot_order_t ),
+		 &libewf_persistent_cache_compare_slot_order );
+
+		/* Move the used slots to the front of the least recently used list
+		 * in reverse order so that the most recently used slot ends up first
+		 */
+		for( order_index = number_of_used_slots - 1;
+		     order_index >= 0;
+		     order_index-- )
+		{
+			if( libewf_persistent_cache_unlink_slot(
+			     persistent_cache,
+			     slot_order[ order_index ].slot_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to unlink slot: %d.",
+				 function,
+				 slot_order[ order_index ].slot_index );
+
+				goto on_error;
+			}
+			if( libewf_persistent_cache_link_slot(
+			     persistent_cache,
+			     slot_order[ order_index ].slot_index,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to link slot: %d.",
+				 function,
+				 slot_order[ order_index ].slot_index );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 slot_order );
+
+	memory_free(
+	 slot_descriptors_data );
+
+	return( 1 );
+
+on_error:
+	if( slot_order != NULL )
+	{
+		memory_free(
+		 slot_order );
+	}
+	if( slot_descriptors_data != NULL )
+	{
+		memory_free(
+		 slot_descriptors_data );
+	}
+	libewf_persistent_cache_clear_slots(
+	 persistent_cache,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Writes the slot descriptors to the persistent cache file
+ * This stores the last access of the slots so that the least recently used
+ * order is retained across runs
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_persistent_cache_write_slot_descriptors(
+     libewf_persistent_cache_t *persistent_cache,
+     libcerror_error_t **error )
+{
+	libewf_persistent_cache_slot_t *slot = NULL;
+	uint8_t *slot_descriptors_data       = NULL;
+	static char *function                = "libewf_persistent_cache_write_slot_descriptors";
+	size_t slot_descriptor_data_offset   = 0;
+	size_t slot_descriptors_data_size    = 0;
+	ssize_t write_count                  = 0;
+	int block_slot_index                 = 0;
+	int number_of_block_slots            = 0;
+	int slot_index                       = 0;
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	slot_descriptors_data_size = LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTORS_PER_BLOCK * LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE;
+
+	slot_descriptors_data = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * slot_descriptors_data_size );
+
+	if( slot_descriptors_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slot descriptors data.",
+		 function );
+
+		goto on_error;
+	}
+	while( slot_index < persistent_cache->number_of_slots )
+	{
+		number_of_block_slots = persistent_cache->number_of_slots - slot_index;
+
+		if( number_of_block_slots > LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTORS_PER_BLOCK )
+		{
+			number_of_block_slots = LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTORS_PER_BLOCK;
+		}
+		if( memory_set(
+		     slot_descriptors_data,
+		     0,
+		     slot_descriptors_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear slot descriptors data.",
+			 function );
+
+			goto on_error;
+		}
+		slot_descriptor_data_offset = 0;
+
+		for( block_slot_index = 0;
+		     block_slot_index < number_of_block_slots;
+		     block_slot_index++ )
+		{
+			slot = &( persistent_cache->slots[ slot_index + block_slot_index ] );
+
+			if( slot->is_used != 0 )
+			{
+				byte_stream_copy_from_uint64_little_endian(
+				 &( slot_descriptors_data[ slot_descriptor_data_offset ] ),
+				 slot->chunk_index + 1 );
+
+				byte_stream_copy_from_uint32_little_endian(
+				 &( slot_descriptors_data[ slot_descriptor_data_offset + 8 ] ),
+				 slot->data_size );
+
+				byte_stream_copy_from_uint32_little_endian(
+				 &( slot_descriptors_data[ slot_descriptor_data_offset + 12 ] ),
+				 slot->checksum );
+
+				byte_stream_copy_from_uint64_little_endian(
+				 &( slot_descriptors_data[ slot_descriptor_data_offset + 16 ] ),
+				 slot->last_access );
+			}
+			slot_descriptor_data_offset += LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE;
+		}
+		write_count = libewf_persistent_cache_write_at_offset(
+		               persistent_cache,
+		               slot_descriptors_data,
+		               slot_descriptor_data_offset,
+		               LIBEWF_PERSISTENT_CACHE_FILE_HEADER_SIZE + ( (off64_t) slot_index * LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE ),
+		               error );
+
+		if( write_count != (ssize_t) slot_descriptor_data_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write slot descriptors.",
+			 function );
+
+			goto on_error;
+		}
+		slot_index += number_of_block_slots;
+	}
+	memory_free(
+	 slot_descriptors_data );
+
+	return( 1 );
+
+on_error:
+	if( slot_descriptors_data != NULL )
+	{
+		memory_free(
+		 slot_descriptors_data );
+	}
+	return( -1 );
+}
+
+/* Marks a specific slot as unused and moves it to the back of the least recently used list
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_persistent_cache_invalidate_slot(
+     libewf_persistent_cache_t *persistent_cache,
+     int slot_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_persistent_cache_invalidate_slot";
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= persistent_cache->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( persistent_cache->slots[ slot_index ].is_used == 0 )
+	{
+		return( 1 );
+	}
+	if( libewf_persistent_cache_remove_slot_from_hash(
+	     persistent_cache,
+	     slot_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove slot: %d from hash.",
+		 function,
+		 slot_index );
+
+		return( -1 );
+	}
+	persistent_cache->slots[ slot_index ].is_used     = 0;
+	persistent_cache->slots[ slot_index ].data_size   = 0;
+	persistent_cache->slots[ slot_index ].checksum    = 0;
+	persistent_cache->slots[ slot_index ].last_access = 0;
+
+	if( libewf_persistent_cache_unlink_slot(
+	     persistent_cache,
+	     slot_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to unlink slot: %d.",
+		 function,
+		 slot_index );
+
+		return( -1 );
+	}
+	if( libewf_persistent_cache_link_slot(
+	     persistent_cache,
+	     slot_index,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to link slot: %d.",
+		 function,
+		 slot_index );
+
+		return( -1 );
+	}
+	if( libewf_persistent_cache_write_slot_descriptor(
+	     persistent_cache,
+	     slot_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write slot: %d descriptor.",
+		 function,
+		 slot_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the persistent cache file of a specific segment file set in a directory
+ * The persistent cache file is named after the segment file set identifier
+ * If the persistent cache file was created for other media values it is reset
+ * Returns 1 if successful, 0 if the persistent cache cannot be used or -1 on error
+ */
+int libewf_persistent_cache_open(
+     libewf_persistent_cache_t *persistent_cache,
+     const char *directory,
+     const uint8_t *set_identifier,
+     size64_t media_size,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ LIBEWF_PERSISTENT_CACHE_FILE_HEADER_SIZE ];
+
+#if defined( HAVE_LIBEWF_PERSISTENT_CACHE ) && defined( F_SETLK )
+	struct flock file_lock;
+#endif
+
+	char *filename              = NULL;
+	static char *function       = "libewf_persistent_cache_open";
+	size_t directory_length     = 0;
+	size_t filename_index       = 0;
+	size_t filename_size        = 0;
+	ssize_t read_count          = 0;
+	ssize_t write_count         = 0;
+	uint64_t access_counter     = 0;
+	uint64_t stored_media_size  = 0;
+	uint32_t format_version     = 0;
+	uint32_t number_of_slots    = 0;
+	uint32_t stored_chunk_size  = 0;
+	uint8_t byte_index          = 0;
+	uint8_t is_empty            = 1;
+	uint8_t is_valid            = 0;
+	int file_descriptor         = -1;
+	int open_flags              = 0;
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( persistent_cache->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid persistent cache - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( set_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set identifier.",
+		 function );
+
+		return( -1 );
+	}
+	/* Without a set identifier the chunks of different images cannot be distinguished
+	 */
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index++ )
+	{
+		if( set_identifier[ byte_index ] != 0 )
+		{
+			is_empty = 0;
+
+			break;
+		}
+	}
+	if( is_empty != 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBEWF_PERSISTENT_CACHE )
+	directory_length = narrow_string_length(
+	                    directory );
+
+	/* The filename consists of: directory/<set identifier>.ewfcache
+	 */
+	filename_size = directory_length + 1 + 32 + 9 + 1;
+
+	filename = narrow_string_allocate(
+	            filename_size );
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( directory_length > 0 )
+	{
+		if( narrow_string_copy(
+		     filename,
+		     directory,
+		     directory_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy directory to filename.",
+			 function );
+
+			goto on_error;
+		}
+		filename_index = directory_length;
+
+		if( filename[ filename_index - 1 ] != '/' )
+		{
+			filename[ filename_index++ ] = '/';
+		}
+	}
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index++ )
+	{
+		filename[ filename_index++ ] = libewf_persistent_cache_hexadecimal_digits[ set_identifier[ byte_index ] >> 4 ];
+		filename[ filename_index++ ] = libewf_persistent_cache_hexadecimal_digits[ set_identifier[ byte_index ] & 0x0f ];
+	}
+	if( narrow_string_copy(
+	     &( filename[ filename_index ] ),
+	     ".ewfcache",
+	     9 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy extension to filename.",
+		 function );
+
+		goto on_error;
+	}
+	filename_index += 9;
+
+	filename[ filename_index ] = 0;
+
+	open_flags = O_RDWR | O_CREAT;
+
+#if defined( O_CLOEXEC )
+	open_flags |= O_CLOEXEC;
+#endif
+	file_descriptor = open(
+	                   filename,
+	                   open_flags,
+	                   0600 );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+#if defined( F_SETLK )
+	/* The persistent cache file can only be used by one handle at a time
+	 */
+	if( memory_set(
+	     &file_lock,
+	     0,
+	     sizeof( struct flock ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file lock.",
+		 function );
+
+		goto on_error;
+	}
+	file_lock.l_type   = F_WRLCK;
+	file_lock.l_whence = SEEK_SET;
+
+	if( fcntl(
+	     file_descriptor,
+	     F_SETLK,
+	     &file_lock ) == -1 )
+	{
+		if( ( errno == EACCES )
+		 || ( errno == EAGAIN ) )
+		{
+			close(
+			 file_descriptor );
+
+			memory_free(
+			 filename );
+
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to lock file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+#endif /* defined( F_SETLK ) */
+
+	memory_free(
+	 filename );
+
+	filename = NULL;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     persistent_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	persistent_cache->file_descriptor  = file_descriptor;
+	persistent_cache->slot_data_offset = LIBEWF_PERSISTENT_CACHE_FILE_HEADER_SIZE
+	                                   + ( (off64_t) persistent_cache->number_of_slots * LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE );
+
+	persistent_cache->slot_data_offset = ( ( persistent_cache->slot_data_offset + LIBEWF_PERSISTENT_CACHE_SLOT_DATA_ALIGNMENT - 1 )
+	                                   / LIBEWF_PERSISTENT_CACHE_SLOT_DATA_ALIGNMENT ) * LIBEWF_PERSISTENT_CACHE_SLOT_DATA_ALIGNMENT;
+
+	read_count = libewf_persistent_cache_read_at_offset(
+	              persistent_cache,
+	              file_header_data,
+	              LIBEWF_PERSISTENT_CACHE_FILE_HEADER_SIZE,
+	              0,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error_with_lock;
+	}
+	if( read_count == (ssize_t) LIBEWF_PERSISTENT_CACHE_FILE_HEADER_SIZE )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( file_header_data[ 8 ] ),
+		 format_version );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( file_header_data[ 12 ] ),
+		 stored_chunk_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( file_header_data[ 16 ] ),
+		 number_of_slots );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( file_header_data[ 24 ] ),
+		 stored_media_size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( file_header_data[ 48 ] ),
+		 access_counter );
+
+		if( ( memory_compare(
+		       file_header_data,
+		       libewf_persistent_cache_file_signature,
+		       8 ) == 0 )
+		 && ( format_version == 1 )
+		 && ( stored_chunk_size == persistent_cache->chunk_size )
+		 && ( number_of_slots == (uint32_t) persistent_cache->number_of_slots )
+		 && ( stored_media_size == (uint64_t) media_size )
+		 && ( memory_compare(
+		       &( file_header_data[ 32 ] ),
+		       set_identifier,
+		       16 ) == 0 ) )
+		{
+			is_valid = 1;
+		}
+	}
+	if( is_valid != 0 )
+	{
+		if( libewf_persistent_cache_read_slot_descriptors(
+		     persistent_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read slot descriptors.",
+			 function );
+
+			goto on_error_with_lock;
+		}
+		if( access_counter > persistent_cache->access_counter )
+		{
+			persistent_cache->access_counter = access_counter;
+		}
+	}
+	else
+	{
+		/* Discard the content of a persistent cache file that was created
+		 * for other media values or with another maximum cache size
+		 */
+		if( libewf_persistent_cache_clear_slots(
+		     persistent_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to clear slots.",
+			 function );
+
+			goto on_error_with_lock;
+		}
+#if defined( HAVE_FTRUNCATE )
+		if( ftruncate(
+		     file_descriptor,
+		     0 ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_RESIZE_FAILED,
+			 errno,
+			 "%s: unable to truncate file.",
+			 function );
+
+			goto on_error_with_lock;
+		}
+#else
+		if( libewf_persistent_cache_write_slot_descriptors(
+		     persistent_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write slot descriptors.",
+			 function );
+
+			goto on_error_with_lock;
+		}
+#endif /* defined( HAVE_FTRUNCATE ) */
+
+		if( memory_set(
+		     file_header_data,
+		     0,
+		     LIBEWF_PERSISTENT_CACHE_FILE_HEADER_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear file header data.",
+			 function );
+
+			goto on_error_with_lock;
+		}
+		if( memory_copy(
+		     file_header_data,
+		     libewf_persistent_cache_file_signature,
+		     8 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy file signature.",
+			 function );
+
+			goto on_error_with_lock;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( file_header_data[ 8 ] ),
+		 1 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( file_header_data[ 12 ] ),
+		 persistent_cache->chunk_size );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( file_header_data[ 16 ] ),
+		 (uint32_t) persistent_cache->number_of_slots );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( file_header_data[ 24 ] ),
+		 (uint64_t) media_size );
+
+		if( memory_copy(
+		     &( file_header_data[ 32 ] ),
+		     set_identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy set identifier.",
+			 function );
+
+			goto on_error_with_lock;
+		}
+		write_count = libewf_persistent_cache_write_at_offset(
+		               persistent_cache,
+		               file_header_data,
+		               LIBEWF_PERSISTENT_CACHE_FILE_HEADER_SIZE,
+		               0,
+		               error );
+
+		if( write_count != (ssize_t) LIBEWF_PERSISTENT_CACHE_FILE_HEADER_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write file header.",
+			 function );
+
+			goto on_error_with_lock;
+		}
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     persistent_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		persistent_cache->file_descriptor = -1;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error_with_lock:
+	persistent_cache->file_descriptor = -1;
+
+	libewf_persistent_cache_clear_slots(
+	 persistent_cache,
+	 NULL );
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 persistent_cache->mutex,
+	 NULL );
+#endif
+on_error:
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: persistent cache not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBEWF_PERSISTENT_CACHE ) */
+}
+
+/* Closes the persistent cache file
+ * Stores the slot descriptors and access counter so that the cached chunks
+ * and their least recently used order can be reused by a next open
+ * Returns 0 if successful or -1 on error
+ */
+int libewf_persistent_cache_close(
+     libewf_persistent_cache_t *persistent_cache,
+     libcerror_error_t **error )
+{
+	uint8_t access_counter_data[ 8 ];
+
+	static char *function = "libewf_persistent_cache_close";
+	ssize_t write_count   = 0;
+	int result            = 0;
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( persistent_cache->file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     persistent_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libewf_persistent_cache_write_slot_descriptors(
+	     persistent_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write slot descriptors.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 access_counter_data,
+		 persistent_cache->access_counter );
+
+		write_count = libewf_persistent_cache_write_at_offset(
+		               persistent_cache,
+		               access_counter_data,
+		               8,
+		               48,
+		               error );
+
+		if( write_count != 8 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write access counter.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBEWF_PERSISTENT_CACHE )
+	if( close(
+	     persistent_cache->file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file descriptor.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	persistent_cache->file_descriptor = -1;
+
+	if( libewf_persistent_cache_clear_slots(
+	     persistent_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     persistent_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the data of a specific chunk from the persistent cache
+ * The data is validated with the checksum stored when the chunk was added,
+ * a slot that fails validation is discarded
+ * Returns 1 if successful, 0 if the chunk is not cached or -1 on error
+ */
+int libewf_persistent_cache_get_chunk_data(
+     libewf_persistent_cache_t *persistent_cache,
+     uint64_t chunk_index,
+     uint8_t *data,
+     size_t data_size,
+     size_t *chunk_data_size,
+     libcerror_error_t **error )
+{
+	libewf_persistent_cache_slot_t *slot = NULL;
+	static char *function                = "libewf_persistent_cache_get_chunk_data";
+	ssize_t read_count                   = 0;
+	uint32_t calculated_checksum         = 0;
+	int result                           = 0;
+	int slot_index                       = 0;
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( persistent_cache->file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     persistent_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libewf_persistent_cache_get_slot_index(
+	          persistent_cache,
+	          chunk_index,
+	          &slot_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve slot index of chunk: %" PRIu64 ".",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		slot = &( persistent_cache->slots[ slot_index ] );
+
+		if( (size_t) slot->data_size > data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libewf_persistent_cache_read_at_offset(
+		              persistent_cache,
+		              data,
+		              (size_t) slot->data_size,
+		              persistent_cache->slot_data_offset + ( (off64_t) slot_index * persistent_cache->chunk_size ),
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read slot: %d data.",
+			 function,
+			 slot_index );
+
+			goto on_error;
+		}
+		if( read_count == (ssize_t) slot->data_size )
+		{
+			if( libewf_checksum_calculate_adler32(
+			     &calculated_checksum,
+			     data,
+			     (size_t) slot->data_size,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to calculate checksum.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( read_count != (ssize_t) slot->data_size )
+		 || ( calculated_checksum != slot->checksum ) )
+		{
+			if( libewf_persistent_cache_invalidate_slot(
+			     persistent_cache,
+			     slot_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to invalidate slot: %d.",
+				 function,
+				 slot_index );
+
+				goto on_error;
+			}
+			result = 0;
+		}
+		else
+		{
+			if( libewf_persistent_cache_unlink_slot(
+			     persistent_cache,
+			     slot_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to unlink slot: %d.",
+				 function,
+				 slot_index );
+
+				goto on_error;
+			}
+			if( libewf_persistent_cache_link_slot(
+			     persistent_cache,
+			     slot_index,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to link slot: %d.",
+				 function,
+				 slot_index );
+
+				goto on_error;
+			}
+			persistent_cache->access_counter += 1;
+
+			slot->last_access = persistent_cache->access_counter;
+
+			*chunk_data_size = (size_t) slot->data_size;
+		}
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     persistent_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 persistent_cache->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Adds the data of a specific chunk to the persistent cache
+ * The least recently used slot is reused if the persistent cache is full
+ * Returns 1 if successful, 0 if the persistent cache is not open or -1 on error
+ */
+int libewf_persistent_cache_set_chunk_data(
+     libewf_persistent_cache_t *persistent_cache,
+     uint64_t chunk_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libewf_persistent_cache_slot_t *slot = NULL;
+	static char *function                = "libewf_persistent_cache_set_chunk_data";
+	ssize_t write_count                  = 0;
+	uint32_t checksum                    = 0;
+	int result                           = 0;
+	int slot_index                       = 0;
+
+	if( persistent_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid persistent cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) persistent_cache->chunk_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( persistent_cache->file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( libewf_checksum_calculate_adler32(
+	     &checksum,
+	     data,
+	     data_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     persistent_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libewf_persistent_cache_get_slot_index(
+	          persistent_cache,
+	          chunk_index,
+	          &slot_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve slot index of chunk: %" PRIu64 ".",
+		 function,
+		 chunk_index );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		slot_index = persistent_cache->last_slot_index;
+	}
+	/* Mark the slot as unused in the file before its data is overwritten
+	 * so that an interrupted write cannot leave a slot with mismatching data
+	 */
+	if( libewf_persistent_cache_invalidate_slot(
+	     persistent_cache,
+	     slot_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to invalidate slot: %d.",
+		 function,
+		 slot_index );
+
+		goto on_error;
+	}
+	write_count = libewf_persistent_cache_write_at_offset(
+	               persistent_cache,
+	               data,
+	               data_size,
+	               persistent_cache->slot_data_offset + ( (off64_t) slot_index * persistent_cache->chunk_size ),
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write slot: %d data.",
+		 function,
+		 slot_index );
+
+		goto on_error;
+	}
+	persistent_cache->access_counter += 1;
+
+	slot = &( persistent_cache->slots[ slot_index ] );
+
+	slot->chunk_index = chunk_index;
+	slot->data_size   = (uint32_t) data_size;
+	slot->checksum    = checksum;
+	slot->last_access = persistent_cache->access_counter;
+	slot->is_used     = 1;
+
+	if( libewf_persistent_cache_insert_slot_in_hash(
+	     persistent_cache,
+	     slot_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert slot: %d in hash.",
+		 function,
+		 slot_index );
+
+		goto on_error;
+	}
+	if( libewf_persistent_cache_unlink_slot(
+	     persistent_cache,
+	     slot_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to unlink slot: %d.",
+		 function,
+		 slot_index );
+
+		goto on_error;
+	}
+	if( libewf_persistent_cache_link_slot(
+	     persistent_cache,
+	     slot_index,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to link slot: %d.",
+		 function,
+		 slot_index );
+
+		goto on_error;
+	}
+	if( libewf_persistent_cache_write_slot_descriptor(
+	     persistent_cache,
+	     slot_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write slot: %d descriptor.",
+		 function,
+		 slot_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     persistent_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 persistent_cache->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
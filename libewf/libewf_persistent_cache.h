@@ -0,0 +1,252 @@
+/*
+ * Persistent (on-disk) chunk cache functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_PERSISTENT_CACHE_H )
+#define _LIBEWF_PERSISTENT_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_OPEN ) && defined( HAVE_CLOSE ) && defined( HAVE_PREAD ) && defined( HAVE_PWRITE ) && !defined( WINAPI )
+#define HAVE_LIBEWF_PERSISTENT_CACHE
+#endif
+
+/* The size of the persistent cache file header
+ */
+#define LIBEWF_PERSISTENT_CACHE_FILE_HEADER_SIZE	64
+
+/* The size of a persistent cache slot descriptor
+ */
+#define LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTOR_SIZE	32
+
+/* The alignment of the slot data in the persistent cache file
+ */
+#define LIBEWF_PERSISTENT_CACHE_SLOT_DATA_ALIGNMENT	4096
+
+/* The maximum number of slots in the persistent cache
+ */
+#define LIBEWF_PERSISTENT_CACHE_MAXIMUM_NUMBER_OF_SLOTS	16777216
+
+/* The number of slot descriptors read or written at once
+ */
+#define LIBEWF_PERSISTENT_CACHE_SLOT_DESCRIPTORS_PER_BLOCK	1024
+
+typedef struct libewf_persistent_cache_slot libewf_persistent_cache_slot_t;
+
+struct libewf_persistent_cache_slot
+{
+	/* The chunk index
+	 */
+	uint64_t chunk_index;
+
+	/* The data size
+	 */
+	uint32_t data_size;
+
+	/* The Adler-32 checksum of the data
+	 */
+	uint32_t checksum;
+
+	/* The value of the access counter when the slot was last used
+	 */
+	uint64_t last_access;
+
+	/* Value to indicate the slot is in use
+	 */
+	uint8_t is_used;
+
+	/* The index of the previous (more recently used) slot
+	 */
+	int previous_slot_index;
+
+	/* The index of the next (less recently used) slot
+	 */
+	int next_slot_index;
+
+	/* The index of the next slot in the same hash bucket
+	 */
+	int next_hash_slot_index;
+};
+
+typedef struct libewf_persistent_cache libewf_persistent_cache_t;
+
+struct libewf_persistent_cache
+{
+	/* The file descriptor or -1 if not open
+	 */
+	int file_descriptor;
+
+	/* The chunk size
+	 */
+	uint32_t chunk_size;
+
+	/* The number of slots
+	 */
+	int number_of_slots;
+
+	/* The slots
+	 */
+	libewf_persistent_cache_slot_t *slots;
+
+	/* The number of hash buckets
+	 */
+	int number_of_hash_buckets;
+
+	/* The hash buckets
+	 * Contains the index of the first slot in each bucket or -1 if empty
+	 */
+	int *hash_buckets;
+
+	/* The index of the most recently used slot
+	 */
+	int first_slot_index;
+
+	/* The index of the least recently used slot
+	 */
+	int last_slot_index;
+
+	/* The access counter
+	 */
+	uint64_t access_counter;
+
+	/* The offset of the slot data in the file
+	 */
+	off64_t slot_data_offset;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libewf_persistent_cache_initialize(
+     libewf_persistent_cache_t **persistent_cache,
+     uint32_t chunk_size,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libewf_persistent_cache_free(
+     libewf_persistent_cache_t **persistent_cache,
+     libcerror_error_t **error );
+
+int libewf_persistent_cache_clear_slots(
+     libewf_persistent_cache_t *persistent_cache,
+     libcerror_error_t **error );
+
+int libewf_persistent_cache_unlink_slot(
+     libewf_persistent_cache_t *persistent_cache,
+     int slot_index,
+     libcerror_error_t **error );
+
+int libewf_persistent_cache_link_slot(
+     libewf_persistent_cache_t *persistent_cache,
+     int slot_index,
+     uint8_t at_front,
+     libcerror_error_t **error );
+
+int libewf_persistent_cache_get_slot_index(
+     libewf_persistent_cache_t *persistent_cache,
+     uint64_t chunk_index,
+     int *slot_index,
+     libcerror_error_t **error );
+
+int libewf_persistent_cache_insert_slot_in_hash(
+     libewf_persistent_cache_t *persistent_cache,
+     int slot_index,
+     libcerror_error_t **error );
+
+int libewf_persistent_cache_remove_slot_from_hash(
+     libewf_persistent_cache_t *persistent_cache,
+     int slot_index,
+     libcerror_error_t **error );
+
+ssize_t libewf_persistent_cache_read_at_offset(
+         libewf_persistent_cache_t *persistent_cache,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libewf_persistent_cache_write_at_offset(
+         libewf_persistent_cache_t *persistent_cache,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libewf_persistent_cache_write_slot_descriptor(
+     libewf_persistent_cache_t *persistent_cache,
+     int slot_index,
+     libcerror_error_t **error );
+
+int libewf_persistent_cache_read_slot_descriptors(
+     libewf_persistent_cache_t *persistent_cache,
+     libcerror_error_t **error );
+
+int libewf_persistent_cache_write_slot_descriptors(
+     libewf_persistent_cache_t *persistent_cache,
+     libcerror_error_t **error );
+
+int libewf_persistent_cache_invalidate_slot(
+     libewf_persistent_cache_t *persistent_cache,
+     int slot_index,
+     libcerror_error_t **error );
+
+int libewf_persistent_cache_open(
+     libewf_persistent_cache_t *persistent_cache,
+     const char *directory,
+     const uint8_t *set_identifier,
+     size64_t media_size,
+     libcerror_error_t **error );
+
+int libewf_persistent_cache_close(
+     libewf_persistent_cache_t *persistent_cache,
+     libcerror_error_t **error );
+
+int libewf_persistent_cache_get_chunk_data(
+     libewf_persistent_cache_t *persistent_cache,
+     uint64_t chunk_index,
+     uint8_t *data,
+     size_t data_size,
+     size_t *chunk_data_size,
+     libcerror_error_t **error );
+
+int libewf_persistent_cache_set_chunk_data(
+     libewf_persistent_cache_t *persistent_cache,
+     uint64_t chunk_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_PERSISTENT_CACHE_H ) */
+
@@ -29,6 +29,7 @@
 #include "libewf_compression.h"
 #include "libewf_debug.h"
 #include "libewf_definitions.h"
+#include "libewf_encryption_context.h"
 #include "libewf_hash_sections.h"
 #include "libewf_header_values.h"
 #include "libewf_header_sections.h"
@@ -155,9 +156,10 @@ ssize_t libewf_section_read_data(
 {
 	uint8_t calculated_md5_hash[ 16 ];
 
-	uint8_t *safe_section_data = NULL;
-	static char *function      = "libewf_section_read_data";
-	ssize_t read_count         = 0;
+	uint8_t *decrypted_section_data = NULL;
+	uint8_t *safe_section_data      = NULL;
+	static char *function           = "libewf_section_read_data";
+	ssize_t read_count              = 0;
 
 	if( section_descriptor == NULL )
 	{
@@ -317,11 +319,51 @@ ssize_t libewf_section_read_data(
 			 0 );
 		}
 #endif
-/* TODO decrypt */
+		/* Without an encryption key the section data cannot be read
+		 */
+		if( io_handle->encryption_context == NULL )
+		{
+			memory_free(
+			 safe_section_data );
+
+			return( 0 );
+		}
+		decrypted_section_data = (uint8_t *) memory_allocate(
+		                                      sizeof( uint8_t ) * section_descriptor->data_size );
+
+		if( decrypted_section_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create decrypted section data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libewf_encryption_context_decrypt(
+		     io_handle->encryption_context,
+		     safe_section_data,
+		     (size_t) section_descriptor->data_size,
+		     decrypted_section_data,
+		     (size_t) section_descriptor->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt section data.",
+			 function );
+
+			goto on_error;
+		}
 		memory_free(
 		 safe_section_data );
 
-		return( 0 );
+		safe_section_data      = decrypted_section_data;
+		decrypted_section_data = NULL;
 	}
 	*section_data      = safe_section_data;
 	*section_data_size = (size_t) section_descriptor->data_size;
@@ -329,6 +371,11 @@ ssize_t libewf_section_read_data(
 	return( read_count );
 
 on_error:
+	if( decrypted_section_data != NULL )
+	{
+		memory_free(
+		 decrypted_section_data );
+	}
 	if( safe_section_data != NULL )
 	{
 		memory_free(
@@ -0,0 +1,1383 @@
+/*
+ * Shared chunk cache functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_checksum.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+#include "libewf_shared_chunk_cache.h"
+
+/* The process-wide shared chunk cache
+ */
+static libewf_shared_chunk_cache_t *libewf_shared_chunk_cache_process_cache = NULL;
+
+/* Creates a shared chunk cache
+ * Make sure the value shared_chunk_cache is referencing, is set to NULL
+ * The shared chunk cache is created with a single reference
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_shared_chunk_cache_initialize(
+     libewf_shared_chunk_cache_t **shared_chunk_cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function               = "libewf_shared_chunk_cache_initialize";
+	size64_t expected_number_of_entries = 0;
+
+	if( shared_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *shared_chunk_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid shared chunk cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum cache size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*shared_chunk_cache = memory_allocate_structure(
+	                       libewf_shared_chunk_cache_t );
+
+	if( *shared_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shared chunk cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *shared_chunk_cache,
+	     0,
+	     sizeof( libewf_shared_chunk_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shared chunk cache.",
+		 function );
+
+		memory_free(
+		 *shared_chunk_cache );
+
+		*shared_chunk_cache = NULL;
+
+		return( -1 );
+	}
+	/* An entry is expected to contain the unpacked data of a chunk
+	 * and compressed data of a quarter of the chunk size
+	 */
+	expected_number_of_entries = maximum_cache_size / ( LIBEWF_SHARED_CHUNK_CACHE_EXPECTED_CHUNK_SIZE + ( LIBEWF_SHARED_CHUNK_CACHE_EXPECTED_CHUNK_SIZE / 4 ) );
+
+	( *shared_chunk_cache )->maximum_cache_size     = maximum_cache_size;
+	( *shared_chunk_cache )->number_of_hash_buckets = 1;
+	( *shared_chunk_cache )->number_of_references   = 1;
+
+	/* The number of hash buckets is a power of 2 so that the hash
+	 * can be mapped onto a bucket with a mask
+	 */
+	while( ( ( *shared_chunk_cache )->number_of_hash_buckets < LIBEWF_SHARED_CHUNK_CACHE_MAXIMUM_NUMBER_OF_HASH_BUCKETS )
+	    && ( (size64_t) ( *shared_chunk_cache )->number_of_hash_buckets < expected_number_of_entries ) )
+	{
+		( *shared_chunk_cache )->number_of_hash_buckets <<= 1;
+	}
+	( *shared_chunk_cache )->hash_buckets = (libewf_shared_chunk_cache_entry_t **) memory_allocate(
+	                                                                                sizeof( libewf_shared_chunk_cache_entry_t * ) * ( *shared_chunk_cache )->number_of_hash_buckets );
+
+	if( ( *shared_chunk_cache )->hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *shared_chunk_cache )->hash_buckets,
+	     0,
+	     sizeof( libewf_shared_chunk_cache_entry_t * ) * ( *shared_chunk_cache )->number_of_hash_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *shared_chunk_cache )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *shared_chunk_cache != NULL )
+	{
+		if( ( *shared_chunk_cache )->hash_buckets != NULL )
+		{
+			memory_free(
+			 ( *shared_chunk_cache )->hash_buckets );
+		}
+		memory_free(
+		 *shared_chunk_cache );
+
+		*shared_chunk_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a shared chunk cache
+ * This function ignores the number of references, use libewf_shared_chunk_cache_release instead
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_shared_chunk_cache_free(
+     libewf_shared_chunk_cache_t **shared_chunk_cache,
+     libcerror_error_t **error )
+{
+	libewf_shared_chunk_cache_entry_t *entry      = NULL;
+	libewf_shared_chunk_cache_entry_t *next_entry = NULL;
+	static char *function                         = "libewf_shared_chunk_cache_free";
+	int result                                    = 1;
+
+	if( shared_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *shared_chunk_cache != NULL )
+	{
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *shared_chunk_cache )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		entry = ( *shared_chunk_cache )->first_entry;
+
+		while( entry != NULL )
+		{
+			next_entry = entry->next_entry;
+
+			if( entry->data != NULL )
+			{
+				memory_free(
+				 entry->data );
+			}
+			if( entry->compressed_data != NULL )
+			{
+				memory_free(
+				 entry->compressed_data );
+			}
+			memory_free(
+			 entry );
+
+			entry = next_entry;
+		}
+		if( ( *shared_chunk_cache )->hash_buckets != NULL )
+		{
+			memory_free(
+			 ( *shared_chunk_cache )->hash_buckets );
+		}
+		memory_free(
+		 *shared_chunk_cache );
+
+		*shared_chunk_cache = NULL;
+	}
+	return( result );
+}
+
+/* Adds a reference to the shared chunk cache
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_shared_chunk_cache_get_reference(
+     libewf_shared_chunk_cache_t *shared_chunk_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_shared_chunk_cache_get_reference";
+
+	if( shared_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shared_chunk_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	shared_chunk_cache->number_of_references += 1;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shared_chunk_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Removes a reference from the shared chunk cache
+ * The shared chunk cache is freed when the last reference is removed
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_shared_chunk_cache_release(
+     libewf_shared_chunk_cache_t **shared_chunk_cache,
+     libcerror_error_t **error )
+{
+	static char *function    = "libewf_shared_chunk_cache_release";
+	int number_of_references = 0;
+
+	if( shared_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *shared_chunk_cache == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     ( *shared_chunk_cache )->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	( *shared_chunk_cache )->number_of_references -= 1;
+
+	number_of_references = ( *shared_chunk_cache )->number_of_references;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     ( *shared_chunk_cache )->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( number_of_references > 0 )
+	{
+		*shared_chunk_cache = NULL;
+
+		return( 1 );
+	}
+	if( libewf_shared_chunk_cache_free(
+	     shared_chunk_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free shared chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a reference to the process-wide shared chunk cache
+ * The reference must be removed with libewf_shared_chunk_cache_release
+ * Returns 1 if successful, 0 if the process-wide shared chunk cache is disabled or -1 on error
+ */
+int libewf_shared_chunk_cache_get_process_cache(
+     libewf_shared_chunk_cache_t **shared_chunk_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_shared_chunk_cache_get_process_cache";
+
+	if( shared_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_shared_chunk_cache_process_cache == NULL )
+	{
+		return( 0 );
+	}
+	if( libewf_shared_chunk_cache_get_reference(
+	     libewf_shared_chunk_cache_process_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve reference to process shared chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	*shared_chunk_cache = libewf_shared_chunk_cache_process_cache;
+
+	return( 1 );
+}
+
+/* Sets the maximum size of the process-wide shared chunk cache
+ * A value of 0 disables the process-wide shared chunk cache
+ * The current process-wide shared chunk cache is released, handles that
+ * reference it keep using it until they are closed
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_shared_chunk_cache_set_process_maximum_cache_size(
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libewf_shared_chunk_cache_t *shared_chunk_cache = NULL;
+	static char *function                           = "libewf_shared_chunk_cache_set_process_maximum_cache_size";
+
+	if( maximum_cache_size > 0 )
+	{
+		if( libewf_shared_chunk_cache_initialize(
+		     &shared_chunk_cache,
+		     maximum_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shared chunk cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libewf_shared_chunk_cache_release(
+	     &libewf_shared_chunk_cache_process_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release process shared chunk cache.",
+		 function );
+
+		goto on_error;
+	}
+	libewf_shared_chunk_cache_process_cache = shared_chunk_cache;
+
+	return( 1 );
+
+on_error:
+	if( shared_chunk_cache != NULL )
+	{
+		libewf_shared_chunk_cache_free(
+		 &shared_chunk_cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the entry of specific compressed data
+ * The entry matches if the compression method and compressed data are identical
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libewf_shared_chunk_cache_get_entry(
+     libewf_shared_chunk_cache_t *shared_chunk_cache,
+     uint32_t hash,
+     uint16_t compression_method,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libewf_shared_chunk_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	libewf_shared_chunk_cache_entry_t *hash_entry = NULL;
+	static char *function                         = "libewf_shared_chunk_cache_get_entry";
+	int hash_bucket_index                         = 0;
+
+	if( shared_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( shared_chunk_cache->hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid shared chunk cache - missing hash buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	hash_bucket_index = (int) ( ( hash ^ (uint32_t) compressed_data_size ) & (uint32_t) ( shared_chunk_cache->number_of_hash_buckets - 1 ) );
+
+	hash_entry = shared_chunk_cache->hash_buckets[ hash_bucket_index ];
+
+	while( hash_entry != NULL )
+	{
+		if( ( hash_entry->hash == hash )
+		 && ( hash_entry->compression_method == compression_method )
+		 && ( hash_entry->compressed_data_size == compressed_data_size ) )
+		{
+			/* The hash only selects the candidate, the compressed data
+			 * is compared to rule out a hash collision
+			 */
+			if( memory_compare(
+			     hash_entry->compressed_data,
+			     compressed_data,
+			     compressed_data_size ) == 0 )
+			{
+				*entry = hash_entry;
+
+				return( 1 );
+			}
+		}
+		hash_entry = hash_entry->next_hash_entry;
+	}
+	return( 0 );
+}
+
+/* Removes an entry from the least recently used list
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_shared_chunk_cache_unlink_entry(
+     libewf_shared_chunk_cache_t *shared_chunk_cache,
+     libewf_shared_chunk_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_shared_chunk_cache_unlink_entry";
+
+	if( shared_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->previous_entry != NULL )
+	{
+		entry->previous_entry->next_entry = entry->next_entry;
+	}
+	else
+	{
+		shared_chunk_cache->first_entry = entry->next_entry;
+	}
+	if( entry->next_entry != NULL )
+	{
+		entry->next_entry->previous_entry = entry->previous_entry;
+	}
+	else
+	{
+		shared_chunk_cache->last_entry = entry->previous_entry;
+	}
+	entry->previous_entry = NULL;
+	entry->next_entry     = NULL;
+
+	return( 1 );
+}
+
+/* Adds an unlinked entry to the front (most recently used) of the least recently used list
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_shared_chunk_cache_link_entry(
+     libewf_shared_chunk_cache_t *shared_chunk_cache,
+     libewf_shared_chunk_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_shared_chunk_cache_link_entry";
+
+	if( shared_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	entry->previous_entry = NULL;
+	entry->next_entry     = shared_chunk_cache->first_entry;
+
+	if( shared_chunk_cache->first_entry != NULL )
+	{
+		shared_chunk_cache->first_entry->previous_entry = entry;
+	}
+	shared_chunk_cache->first_entry = entry;
+
+	if( shared_chunk_cache->last_entry == NULL )
+	{
+		shared_chunk_cache->last_entry = entry;
+	}
+	return( 1 );
+}
+
+/* Removes an entry from the shared chunk cache and frees it
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_shared_chunk_cache_remove_entry(
+     libewf_shared_chunk_cache_t *shared_chunk_cache,
+     libewf_shared_chunk_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	libewf_shared_chunk_cache_entry_t *hash_entry          = NULL;
+	libewf_shared_chunk_cache_entry_t *previous_hash_entry = NULL;
+	static char *function                                  = "libewf_shared_chunk_cache_remove_entry";
+	int hash_bucket_index                                  = 0;
+
+	if( shared_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( shared_chunk_cache->hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid shared chunk cache - missing hash buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	hash_bucket_index = (int) ( ( entry->hash ^ (uint32_t) entry->compressed_data_size ) & (uint32_t) ( shared_chunk_cache->number_of_hash_buckets - 1 ) );
+
+	hash_entry = shared_chunk_cache->hash_buckets[ hash_bucket_index ];
+
+	while( hash_entry != NULL )
+	{
+		if( hash_entry == entry )
+		{
+			if( previous_hash_entry == NULL )
+			{
+				shared_chunk_cache->hash_buckets[ hash_bucket_index ] = hash_entry->next_hash_entry;
+			}
+			else
+			{
+				previous_hash_entry->next_hash_entry = hash_entry->next_hash_entry;
+			}
+			break;
+		}
+		previous_hash_entry = hash_entry;
+		hash_entry          = hash_entry->next_hash_entry;
+	}
+	if( libewf_shared_chunk_cache_unlink_entry(
+	     shared_chunk_cache,
+	     entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to unlink entry.",
+		 function );
+
+		return( -1 );
+	}
+	shared_chunk_cache->cache_size        -= sizeof( libewf_shared_chunk_cache_entry_t ) + entry->compressed_data_size + entry->data_size;
+	shared_chunk_cache->number_of_entries -= 1;
+
+	if( entry->data != NULL )
+	{
+		memory_free(
+		 entry->data );
+	}
+	if( entry->compressed_data != NULL )
+	{
+		memory_free(
+		 entry->compressed_data );
+	}
+	memory_free(
+	 entry );
+
+	return( 1 );
+}
+
+/* Retrieves the unpacked data of specific compressed data from the shared chunk cache
+ * The data buffer can be the same buffer as the compressed data, since the
+ * compressed data is no longer needed once the unpacked data is copied
+ * Returns 1 if successful, 0 if the compressed data is not in the shared chunk cache
+ * or its unpacked data does not fit the data or -1 on error
+ */
+int libewf_shared_chunk_cache_get_chunk_data(
+     libewf_shared_chunk_cache_t *shared_chunk_cache,
+     uint16_t compression_method,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *data,
+     size_t data_size,
+     size_t *chunk_data_size,
+     libcerror_error_t **error )
+{
+	libewf_shared_chunk_cache_entry_t *entry = NULL;
+	static char *function                    = "libewf_shared_chunk_cache_get_chunk_data";
+	uint32_t hash                            = 0;
+	int result                               = 0;
+
+	if( shared_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size == 0 )
+	 || ( compressed_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libewf_checksum_calculate_adler32(
+	     &hash,
+	     compressed_data,
+	     compressed_data_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate hash.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shared_chunk_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libewf_shared_chunk_cache_get_entry(
+	          shared_chunk_cache,
+	          hash,
+	          compression_method,
+	          compressed_data,
+	          compressed_data_size,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( entry->data_size > data_size ) )
+	{
+		/* The unpacked data of an entry added by an image with a larger
+		 * chunk size does not fit the data and is handled as a cache miss
+		 */
+		result = 0;
+	}
+	else if( result != 0 )
+	{
+		if( memory_copy(
+		     data,
+		     entry->data,
+		     entry->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			goto on_error;
+		}
+		if( entry != shared_chunk_cache->first_entry )
+		{
+			if( libewf_shared_chunk_cache_unlink_entry(
+			     shared_chunk_cache,
+			     entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to unlink entry.",
+				 function );
+
+				goto on_error;
+			}
+			if( libewf_shared_chunk_cache_link_entry(
+			     shared_chunk_cache,
+			     entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to link entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		*chunk_data_size = entry->data_size;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shared_chunk_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 shared_chunk_cache->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Adds the unpacked data of specific compressed data to the shared chunk cache
+ * If the compressed data is already in the shared chunk cache only its entry is marked as most recently used
+ * The least recently used entries are removed until the data fits the maximum cache size
+ * Returns 1 if successful, 0 if the data exceeds the maximum cache size or -1 on error
+ */
+int libewf_shared_chunk_cache_set_chunk_data(
+     libewf_shared_chunk_cache_t *shared_chunk_cache,
+     uint16_t compression_method,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libewf_shared_chunk_cache_entry_t *entry = NULL;
+	static char *function                    = "libewf_shared_chunk_cache_set_chunk_data";
+	size64_t entry_size                      = 0;
+	uint32_t hash                            = 0;
+	int hash_bucket_index                    = 0;
+	int result                               = 0;
+
+	if( shared_chunk_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared chunk cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( shared_chunk_cache->hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid shared chunk cache - missing hash buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size == 0 )
+	 || ( compressed_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry_size = (size64_t) sizeof( libewf_shared_chunk_cache_entry_t ) + compressed_data_size + data_size;
+
+	if( entry_size > shared_chunk_cache->maximum_cache_size )
+	{
+		return( 0 );
+	}
+	if( libewf_checksum_calculate_adler32(
+	     &hash,
+	     compressed_data,
+	     compressed_data_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate hash.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shared_chunk_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libewf_shared_chunk_cache_get_entry(
+	          shared_chunk_cache,
+	          hash,
+	          compression_method,
+	          compressed_data,
+	          compressed_data_size,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry.",
+		 function );
+
+		entry = NULL;
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* Identical compressed data unpacks to identical data
+		 * so the existing entry can be reused
+		 */
+		if( entry != shared_chunk_cache->first_entry )
+		{
+			if( libewf_shared_chunk_cache_unlink_entry(
+			     shared_chunk_cache,
+			     entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to unlink entry.",
+				 function );
+
+				entry = NULL;
+
+				goto on_error;
+			}
+			if( libewf_shared_chunk_cache_link_entry(
+			     shared_chunk_cache,
+			     entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to link entry.",
+				 function );
+
+				entry = NULL;
+
+				goto on_error;
+			}
+		}
+		entry = NULL;
+	}
+	else
+	{
+		while( ( shared_chunk_cache->last_entry != NULL )
+		    && ( ( shared_chunk_cache->cache_size + entry_size ) > shared_chunk_cache->maximum_cache_size ) )
+		{
+			if( libewf_shared_chunk_cache_remove_entry(
+			     shared_chunk_cache,
+			     shared_chunk_cache->last_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove least recently used entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		entry = memory_allocate_structure(
+		         libewf_shared_chunk_cache_entry_t );
+
+		if( entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     entry,
+		     0,
+		     sizeof( libewf_shared_chunk_cache_entry_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entry.",
+			 function );
+
+			memory_free(
+			 entry );
+
+			entry = NULL;
+
+			goto on_error;
+		}
+		entry->compressed_data = (uint8_t *) memory_allocate(
+		                                      sizeof( uint8_t ) * compressed_data_size );
+
+		if( entry->compressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry compressed data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     entry->compressed_data,
+		     compressed_data,
+		     compressed_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy compressed data.",
+			 function );
+
+			goto on_error;
+		}
+		entry->data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * data_size );
+
+		if( entry->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     entry->data,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			goto on_error;
+		}
+		entry->hash                 = hash;
+		entry->compression_method   = compression_method;
+		entry->compressed_data_size = compressed_data_size;
+		entry->data_size            = data_size;
+
+		if( libewf_shared_chunk_cache_link_entry(
+		     shared_chunk_cache,
+		     entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to link entry.",
+			 function );
+
+			goto on_error;
+		}
+		hash_bucket_index = (int) ( ( hash ^ (uint32_t) compressed_data_size ) & (uint32_t) ( shared_chunk_cache->number_of_hash_buckets - 1 ) );
+
+		entry->next_hash_entry                                = shared_chunk_cache->hash_buckets[ hash_bucket_index ];
+		shared_chunk_cache->hash_buckets[ hash_bucket_index ] = entry;
+
+		shared_chunk_cache->cache_size        += entry_size;
+		shared_chunk_cache->number_of_entries += 1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shared_chunk_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( entry != NULL )
+	{
+		if( entry->data != NULL )
+		{
+			memory_free(
+			 entry->data );
+		}
+		if( entry->compressed_data != NULL )
+		{
+			memory_free(
+			 entry->compressed_data );
+		}
+		memory_free(
+		 entry );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 shared_chunk_cache->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,202 @@
+/*
+ * Shared chunk cache functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_SHARED_CHUNK_CACHE_H )
+#define _LIBEWF_SHARED_CHUNK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The chunk size used to determine the number of hash buckets in the shared chunk cache
+ */
+#define LIBEWF_SHARED_CHUNK_CACHE_EXPECTED_CHUNK_SIZE			32768
+
+/* The maximum number of hash buckets in the shared chunk cache
+ */
+#define LIBEWF_SHARED_CHUNK_CACHE_MAXIMUM_NUMBER_OF_HASH_BUCKETS	1048576
+
+typedef struct libewf_shared_chunk_cache_entry libewf_shared_chunk_cache_entry_t;
+
+struct libewf_shared_chunk_cache_entry
+{
+	/* The hash of the compressed data
+	 */
+	uint32_t hash;
+
+	/* The compression method
+	 */
+	uint16_t compression_method;
+
+	/* The compressed data
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The (unpacked) data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The previous (more recently used) entry
+	 */
+	libewf_shared_chunk_cache_entry_t *previous_entry;
+
+	/* The next (less recently used) entry
+	 */
+	libewf_shared_chunk_cache_entry_t *next_entry;
+
+	/* The next entry in the same hash bucket
+	 */
+	libewf_shared_chunk_cache_entry_t *next_hash_entry;
+};
+
+typedef struct libewf_shared_chunk_cache libewf_shared_chunk_cache_t;
+
+struct libewf_shared_chunk_cache
+{
+	/* The maximum cache size
+	 */
+	size64_t maximum_cache_size;
+
+	/* The cache size
+	 * Contains the size of the compressed and unpacked data and the entries
+	 */
+	size64_t cache_size;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of hash buckets
+	 */
+	int number_of_hash_buckets;
+
+	/* The hash buckets
+	 * Contains the first entry in each bucket or NULL if empty
+	 */
+	libewf_shared_chunk_cache_entry_t **hash_buckets;
+
+	/* The most recently used entry
+	 */
+	libewf_shared_chunk_cache_entry_t *first_entry;
+
+	/* The least recently used entry
+	 */
+	libewf_shared_chunk_cache_entry_t *last_entry;
+
+	/* The number of references
+	 */
+	int number_of_references;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libewf_shared_chunk_cache_initialize(
+     libewf_shared_chunk_cache_t **shared_chunk_cache,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libewf_shared_chunk_cache_free(
+     libewf_shared_chunk_cache_t **shared_chunk_cache,
+     libcerror_error_t **error );
+
+int libewf_shared_chunk_cache_get_reference(
+     libewf_shared_chunk_cache_t *shared_chunk_cache,
+     libcerror_error_t **error );
+
+int libewf_shared_chunk_cache_release(
+     libewf_shared_chunk_cache_t **shared_chunk_cache,
+     libcerror_error_t **error );
+
+int libewf_shared_chunk_cache_get_process_cache(
+     libewf_shared_chunk_cache_t **shared_chunk_cache,
+     libcerror_error_t **error );
+
+int libewf_shared_chunk_cache_set_process_maximum_cache_size(
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libewf_shared_chunk_cache_get_entry(
+     libewf_shared_chunk_cache_t *shared_chunk_cache,
+     uint32_t hash,
+     uint16_t compression_method,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libewf_shared_chunk_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int libewf_shared_chunk_cache_unlink_entry(
+     libewf_shared_chunk_cache_t *shared_chunk_cache,
+     libewf_shared_chunk_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libewf_shared_chunk_cache_link_entry(
+     libewf_shared_chunk_cache_t *shared_chunk_cache,
+     libewf_shared_chunk_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libewf_shared_chunk_cache_remove_entry(
+     libewf_shared_chunk_cache_t *shared_chunk_cache,
+     libewf_shared_chunk_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libewf_shared_chunk_cache_get_chunk_data(
+     libewf_shared_chunk_cache_t *shared_chunk_cache,
+     uint16_t compression_method,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *data,
+     size_t data_size,
+     size_t *chunk_data_size,
+     libcerror_error_t **error );
+
+int libewf_shared_chunk_cache_set_chunk_data(
+     libewf_shared_chunk_cache_t *shared_chunk_cache,
+     uint16_t compression_method,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_SHARED_CHUNK_CACHE_H ) */
+
@@ -0,0 +1,431 @@
+/*
+ * Shared metadata functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libewf_chunk_locations.h"
+#include "libewf_file_descriptor_pool.h"
+#include "libewf_hash_sections.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+#include "libewf_libfvalue.h"
+#include "libewf_shared_metadata.h"
+#include "libewf_single_files.h"
+
+/* Creates shared metadata
+ * Make sure the value shared_metadata is referencing, is set to NULL
+ * The shared metadata is created with a single reference
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_shared_metadata_initialize(
+     libewf_shared_metadata_t **shared_metadata,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_shared_metadata_initialize";
+
+	if( shared_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( *shared_metadata != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid shared metadata value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*shared_metadata = memory_allocate_structure(
+	                    libewf_shared_metadata_t );
+
+	if( *shared_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shared metadata.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *shared_metadata,
+	     0,
+	     sizeof( libewf_shared_metadata_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shared metadata.",
+		 function );
+
+		memory_free(
+		 *shared_metadata );
+
+		*shared_metadata = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *shared_metadata )->references_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create references mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *shared_metadata )->number_of_references = 1;
+
+	return( 1 );
+
+on_error:
+	if( *shared_metadata != NULL )
+	{
+		memory_free(
+		 *shared_metadata );
+
+		*shared_metadata = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees shared metadata including the metadata values
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_shared_metadata_free(
+     libewf_shared_metadata_t **shared_metadata,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_shared_metadata_free";
+	int result            = 1;
+
+	if( shared_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( *shared_metadata != NULL )
+	{
+		if( ( *shared_metadata )->hash_sections != NULL )
+		{
+			if( libewf_hash_sections_free(
+			     &( ( *shared_metadata )->hash_sections ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free hash sections.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_metadata )->header_values != NULL )
+		{
+			if( libfvalue_table_free(
+			     &( ( *shared_metadata )->header_values ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free header values.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_metadata )->hash_values != NULL )
+		{
+			if( libfvalue_table_free(
+			     &( ( *shared_metadata )->hash_values ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free hash values.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_metadata )->single_files != NULL )
+		{
+			if( libewf_single_files_free(
+			     &( ( *shared_metadata )->single_files ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free single files.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_metadata )->chunk_locations != NULL )
+		{
+			if( libewf_chunk_locations_free(
+			     &( ( *shared_metadata )->chunk_locations ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk locations.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_metadata )->file_descriptor_pool != NULL )
+		{
+			if( libewf_file_descriptor_pool_free(
+			     &( ( *shared_metadata )->file_descriptor_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file descriptor pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *shared_metadata )->references_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free references mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *shared_metadata );
+
+		*shared_metadata = NULL;
+	}
+	return( result );
+}
+
+/* Grabs a reference to the shared metadata
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_shared_metadata_grab_reference(
+     libewf_shared_metadata_t *shared_metadata,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_shared_metadata_grab_reference";
+	int result            = 1;
+
+	if( shared_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared metadata.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shared_metadata->references_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab references mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( shared_metadata->number_of_references <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shared metadata - number of references value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		shared_metadata->number_of_references += 1;
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shared_metadata->references_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release references mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases a reference to the shared metadata
+ * The shared metadata is freed when the last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_shared_metadata_release_reference(
+     libewf_shared_metadata_t **shared_metadata,
+     libcerror_error_t **error )
+{
+	static char *function    = "libewf_shared_metadata_release_reference";
+	int number_of_references = 0;
+
+	if( shared_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( *shared_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing shared metadata.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     ( *shared_metadata )->references_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab references mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( *shared_metadata )->number_of_references > 0 )
+	{
+		( *shared_metadata )->number_of_references -= 1;
+	}
+	number_of_references = ( *shared_metadata )->number_of_references;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     ( *shared_metadata )->references_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release references mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( number_of_references == 0 )
+	{
+		if( libewf_shared_metadata_free(
+		     shared_metadata,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free shared metadata.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*shared_metadata = NULL;
+
+	return( 1 );
+}
+
@@ -0,0 +1,105 @@
+/*
+ * Shared metadata functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEWF_SHARED_METADATA_H )
+#define _LIBEWF_SHARED_METADATA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libewf_chunk_locations.h"
+#include "libewf_file_descriptor_pool.h"
+#include "libewf_hash_sections.h"
+#include "libewf_libcerror.h"
+#include "libewf_libcthreads.h"
+#include "libewf_libfvalue.h"
+#include "libewf_single_files.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libewf_shared_metadata libewf_shared_metadata_t;
+
+/* The shared metadata contains the immutable metadata of an opened (read-only)
+ * image that is shared by a handle and its lightweight clones
+ * The segment table is not part of the shared metadata since its caches are
+ * modified by lookups, see libewf_internal_handle_clone
+ */
+struct libewf_shared_metadata
+{
+	/* The hash sections
+	 */
+	libewf_hash_sections_t *hash_sections;
+
+	/* The header values
+	 */
+	libfvalue_table_t *header_values;
+
+	/* The hash values
+	 */
+	libfvalue_table_t *hash_values;
+
+	/* The single files
+	 */
+	libewf_single_files_t *single_files;
+
+	/* The chunk locations
+	 */
+	libewf_chunk_locations_t *chunk_locations;
+
+	/* The file descriptor pool
+	 */
+	libewf_file_descriptor_pool_t *file_descriptor_pool;
+
+	/* The number of references
+	 */
+	int number_of_references;
+
+#if defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+	/* The references mutex
+	 */
+	libcthreads_mutex_t *references_mutex;
+#endif
+};
+
+int libewf_shared_metadata_initialize(
+     libewf_shared_metadata_t **shared_metadata,
+     libcerror_error_t **error );
+
+int libewf_shared_metadata_free(
+     libewf_shared_metadata_t **shared_metadata,
+     libcerror_error_t **error );
+
+int libewf_shared_metadata_grab_reference(
+     libewf_shared_metadata_t *shared_metadata,
+     libcerror_error_t **error );
+
+int libewf_shared_metadata_release_reference(
+     libewf_shared_metadata_t **shared_metadata,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEWF_SHARED_METADATA_H ) */
+
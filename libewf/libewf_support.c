@@ -25,6 +25,14 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
 #include "libewf_definitions.h"
 #include "libewf_filename.h"
 #include "libewf_error.h"
@@ -33,6 +41,7 @@
 #include "libewf_libclocale.h"
 #include "libewf_libcnotify.h"
 #include "libewf_segment_file.h"
+#include "libewf_shared_chunk_cache.h"
 #include "libewf_support.h"
 
 #if !defined( HAVE_LOCAL_LIBEWF )
@@ -131,6 +140,35 @@ int libewf_set_codepage(
 
 #endif /* !defined( HAVE_LOCAL_LIBEWF ) */
 
+/* Sets the maximum size of the process-wide shared chunk cache
+ * The shared chunk cache is used by handles that enable it with libewf_handle_set_use_shared_chunk_cache
+ * A value of 0 disables the shared chunk cache
+ * Handles that are open keep using the previous shared chunk cache until they are closed
+ * This function is not thread-safe with respect to handles being opened
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_set_maximum_shared_chunk_cache_size(
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_set_maximum_shared_chunk_cache_size";
+
+	if( libewf_shared_chunk_cache_set_process_maximum_cache_size(
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum shared chunk cache size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Determines if a file contains an EWF file signature
  * Returns 1 if true, 0 if not or -1 on error
  */
@@ -1088,19 +1126,45 @@ int libewf_glob_free(
 	return( 1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Determines the format based on the filename
+/* Globs the segment files according to the EWF naming schema using a single directory scan
+ * Make sure the value filenames is referencing, is set to NULL
+ *
+ * Unlike libewf_glob, that tests if every successive segment filename exists, this function
+ * reads the directory that contains the segment files once and matches the names in memory
+ *
+ * If the format is known the filename should contain the base of the filename
+ * otherwise the function will try to determine the format based on the extension
  * Returns 1 if successful or -1 on error
  */
-int libewf_glob_wide_determine_format(
-     const wchar_t *filename,
+int libewf_glob_scan_directory(
+     const char *filename,
      size_t filename_length,
-     uint8_t *format,
+     uint8_t format,
+     char **filenames[],
+     int *number_of_filenames,
      libcerror_error_t **error )
 {
-	static char *function = "libewf_glob_wide_determine_format";
-	uint8_t safe_format   = 0;
+#if defined( HAVE_OPENDIR ) && defined( HAVE_READDIR ) && defined( HAVE_CLOSEDIR )
+	struct dirent *directory_entry  = NULL;
+	DIR *directory                  = NULL;
+	static char *function           = "libewf_glob_scan_directory";
+	char **safe_filenames           = NULL;
+	char *directory_name            = NULL;
+	char *segment_filename          = NULL;
+	const char *entry_name          = NULL;
+	const char *segment_basename    = NULL;
+	uint8_t *segment_number_flags   = NULL;
+	size_t directory_name_length    = 0;
+	size_t entry_name_length        = 0;
+	size_t segment_basename_length  = 0;
+	size_t segment_extension_index  = 0;
+	size_t segment_extension_length = 0;
+	size_t string_index             = 0;
+	uint32_t last_segment_number    = 0;
+	uint32_t segment_number         = 0;
+	uint8_t segment_file_type       = 0;
+	int result                      = 0;
+	int safe_number_of_filenames    = 0;
 
 	if( filename == NULL )
 	{
@@ -1113,238 +1177,1097 @@ int libewf_glob_wide_determine_format(
 
 		return( -1 );
 	}
-	if( format == NULL )
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( filename_length > 4 )
-	 && ( filename[ filename_length - 4 ] == '.' ) )
-	{
-		switch( filename[ filename_length - 3 ] )
-		{
-			case (wchar_t) 'E':
-				safe_format = LIBEWF_FORMAT_ENCASE5;
-				break;
-
-			case (wchar_t) 'L':
-				safe_format = LIBEWF_FORMAT_LOGICAL_ENCASE5;
-				break;
-
-			case (wchar_t) 'e':
-				safe_format = LIBEWF_FORMAT_EWF;
-				break;
-
-			case (wchar_t) 's':
-				safe_format = LIBEWF_FORMAT_SMART;
-				break;
-
-			default:
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-				 "%s: invalid filename - unsupported extension: %s.",
-				 function,
-				 &( filename[ filename_length - 4 ] ) );
-
-				return( -1 );
-		}
-	}
-	else if( ( filename_length > 5 )
-	      && ( filename[ filename_length - 5 ] == '.' ) )
-	{
-		switch( filename[ filename_length - 4 ] )
-		{
-			case (wchar_t) 'E':
-				safe_format = LIBEWF_FORMAT_V2_ENCASE7;
-				break;
-
-			case (wchar_t) 'L':
-				safe_format = LIBEWF_FORMAT_V2_LOGICAL_ENCASE7;
-				break;
-
-			default:
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-				 "%s: invalid filename - unsupported extension: %s.",
-				 function,
-				 &( filename[ filename_length - 5 ] ) );
-
-				return( -1 );
-		}
-		if( filename[ filename_length - 3 ] != 'x' )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-			 "%s: invalid filename - unsupported extension: %s.",
-			 function,
-			 &( filename[ filename_length - 5 ] ) );
-
-			return( -1 );
-		}
-	}
-	else
+	if( ( format != LIBEWF_FORMAT_UNKNOWN )
+	 && ( format != LIBEWF_FORMAT_ENCASE1 )
+	 && ( format != LIBEWF_FORMAT_ENCASE2 )
+	 && ( format != LIBEWF_FORMAT_ENCASE3 )
+	 && ( format != LIBEWF_FORMAT_ENCASE4 )
+	 && ( format != LIBEWF_FORMAT_ENCASE5 )
+	 && ( format != LIBEWF_FORMAT_ENCASE6 )
+	 && ( format != LIBEWF_FORMAT_LINEN5 )
+	 && ( format != LIBEWF_FORMAT_LINEN6 )
+	 && ( format != LIBEWF_FORMAT_SMART )
+	 && ( format != LIBEWF_FORMAT_FTK_IMAGER )
+	 && ( format != LIBEWF_FORMAT_LOGICAL_ENCASE5 )
+	 && ( format != LIBEWF_FORMAT_LOGICAL_ENCASE6 )
+	 && ( format != LIBEWF_FORMAT_LOGICAL_ENCASE7 )
+	 && ( format != LIBEWF_FORMAT_V2_ENCASE7 )
+	 && ( format != LIBEWF_FORMAT_V2_LOGICAL_ENCASE7 )
+	 && ( format != LIBEWF_FORMAT_EWF )
+	 && ( format != LIBEWF_FORMAT_EWFX ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid filename - missing extension.",
+		 "%s: unsupported format.",
 		 function );
 
 		return( -1 );
 	}
-	*format = safe_format;
-
-	return( 1 );
-}
-
-/* Retrieves a segment filename
- * Returns 1 if successful or -1 on error
- */
-int libewf_glob_wide_get_segment_filename(
-     const wchar_t *filename,
-     size_t filename_length,
-     size_t extension_index,
-     uint8_t segment_file_type,
-     uint32_t segment_number,
-     uint8_t format,
-     wchar_t **segment_filename,
-     libcerror_error_t **error )
-{
-	static char *function         = "libewf_glob_wide_get_segment_filename";
-	size_t segment_filename_index = 0;
-
-	if( filename == NULL )
+	if( filenames == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid filenames.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( filename_length == 0 )
-	 || ( filename_length > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( wchar_t ) ) - 1 ) ) )
+	if( *filenames != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid filename length value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filenames value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( segment_filename == NULL )
+	if( number_of_filenames == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid segment filename.",
+		 "%s: invalid number of filenames.",
 		 function );
 
 		return( -1 );
 	}
-	if( *segment_filename != NULL )
+	if( format != LIBEWF_FORMAT_UNKNOWN )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid segment filename value already set.",
-		 function );
+		segment_extension_index = filename_length;
+	}
+	else
+	{
+		if( libewf_glob_determine_format(
+		     filename,
+		     filename_length,
+		     &format,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine format based on filename.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
+		if( ( format == LIBEWF_FORMAT_V2_ENCASE7 )
+		 || ( format == LIBEWF_FORMAT_V2_LOGICAL_ENCASE7 ) )
+		{
+			segment_extension_index = filename_length - 5;
+		}
+		else
+		{
+			segment_extension_index = filename_length - 4;
+		}
 	}
-	segment_filename_index = extension_index;
+	switch( format )
+	{
+		case LIBEWF_FORMAT_LOGICAL_ENCASE5:
+		case LIBEWF_FORMAT_LOGICAL_ENCASE6:
+		case LIBEWF_FORMAT_LOGICAL_ENCASE7:
+			segment_file_type = LIBEWF_SEGMENT_FILE_TYPE_EWF1_LOGICAL;
+			break;
 
-	*segment_filename = (wchar_t *) memory_allocate(
-	                                 sizeof( wchar_t ) * ( filename_length + 1 ) );
+		case LIBEWF_FORMAT_SMART:
+			segment_file_type = LIBEWF_SEGMENT_FILE_TYPE_EWF1_SMART;
+			break;
 
-	if( *segment_filename == NULL )
+		case LIBEWF_FORMAT_V2_ENCASE7:
+			segment_file_type = LIBEWF_SEGMENT_FILE_TYPE_EWF2;
+			break;
+
+		case LIBEWF_FORMAT_V2_LOGICAL_ENCASE7:
+			segment_file_type = LIBEWF_SEGMENT_FILE_TYPE_EWF2_LOGICAL;
+			break;
+
+		default:
+			segment_file_type = LIBEWF_SEGMENT_FILE_TYPE_EWF1;
+			break;
+	}
+	if( ( segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF2 )
+	 || ( segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF2_LOGICAL ) )
+	{
+		segment_extension_length = 4;
+	}
+	else
+	{
+		segment_extension_length = 3;
+	}
+	/* Split the filename into the directory name and the segment basename
+	 */
+	segment_basename        = filename;
+	segment_basename_length = segment_extension_index;
+
+	for( string_index = segment_extension_index;
+	     string_index > 0;
+	     string_index-- )
+	{
+		if( filename[ string_index - 1 ] == '/' )
+		{
+			segment_basename        = &( filename[ string_index ] );
+			segment_basename_length = segment_extension_index - string_index;
+			directory_name_length   = string_index - 1;
+
+			break;
+		}
+	}
+	/* Use "." if the filename has no directory and "/" for the root directory
+	 */
+	if( ( segment_basename == filename )
+	 || ( directory_name_length == 0 ) )
+	{
+		directory_name_length = 1;
+	}
+	directory_name = narrow_string_allocate(
+	                  directory_name_length + 1 );
+
+	if( directory_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create segment filename.",
+		 "%s: unable to create directory name.",
 		 function );
 
 		goto on_error;
 	}
-	if( wide_string_copy(
-	     *segment_filename,
-	     filename,
-	     filename_length ) == NULL )
+	if( segment_basename == filename )
 	{
-		libcerror_error_set(
+		directory_name[ 0 ] = '.';
+	}
+	else if( narrow_string_copy(
+	          directory_name,
+	          filename,
+	          directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy filename.",
+		 "%s: unable to copy directory name.",
 		 function );
 
 		goto on_error;
 	}
-	( *segment_filename )[ segment_filename_index++ ] = (wchar_t) '.';
+	directory_name[ directory_name_length ] = 0;
 
-	/* Note that libewf_filename_set_extension also sets the end-of-string character
+	segment_number_flags = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * UINT16_MAX );
+
+	if( segment_number_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment number flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     segment_number_flags,
+	     0,
+	     sizeof( uint8_t ) * UINT16_MAX ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segment number flags.",
+		 function );
+
+		goto on_error;
+	}
+	directory = opendir(
+	             directory_name );
+
+	if( directory == NULL )
+	{
+		/* A missing directory is handled as if no segment files were found
+		 */
+		if( ( errno != ENOENT )
+		 && ( errno != ENOTDIR ) )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open directory: %s.",
+			 function,
+			 directory_name );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		/* Determine the segment numbers of the directory entries that match
+		 * the segment basename and the naming schema of the format
+		 */
+		do
+		{
+			errno = 0;
+
+			directory_entry = readdir(
+			                   directory );
+
+			if( directory_entry == NULL )
+			{
+				if( errno != 0 )
+				{
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 errno,
+					 "%s: unable to read directory: %s.",
+					 function,
+					 directory_name );
+
+					goto on_error;
+				}
+				break;
+			}
+			entry_name        = directory_entry->d_name;
+			entry_name_length = narrow_string_length(
+			                     entry_name );
+
+			if( entry_name_length != ( segment_basename_length + 1 + segment_extension_length ) )
+			{
+				continue;
+			}
+			if( ( segment_basename_length > 0 )
+			 && ( narrow_string_compare(
+			       entry_name,
+			       segment_basename,
+			       segment_basename_length ) != 0 ) )
+			{
+				continue;
+			}
+			if( entry_name[ segment_basename_length ] != '.' )
+			{
+				continue;
+			}
+			result = libewf_filename_get_segment_number(
+			          &( entry_name[ segment_basename_length + 1 ] ),
+			          segment_extension_length,
+			          segment_file_type,
+			          format,
+			          &segment_number,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment number from directory entry: %s.",
+				 function,
+				 entry_name );
+
+				goto on_error;
+			}
+			else if( ( result != 0 )
+			      && ( segment_number < (uint32_t) UINT16_MAX ) )
+			{
+				segment_number_flags[ segment_number ] = 1;
+
+				if( segment_number > last_segment_number )
+				{
+					last_segment_number = segment_number;
+				}
+			}
+		}
+		while( directory_entry != NULL );
+
+		if( closedir(
+		     directory ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close directory: %s.",
+			 function,
+			 directory_name );
+
+			directory = NULL;
+
+			goto on_error;
+		}
+		directory = NULL;
+	}
+	/* The segment files must be consecutive, like libewf_glob a missing first segment file
+	 * results in no segment files, while a gap after the first segment file is an error
 	 */
-	if( libewf_filename_set_extension_wide(
-	     *segment_filename,
-	     filename_length + 1,
-	     &segment_filename_index,
-	     segment_number,
-	     (uint32_t) UINT16_MAX,
-	     segment_file_type,
-	     format,
-	     error ) != 1 )
+	if( ( last_segment_number > 0 )
+	 && ( segment_number_flags[ 1 ] != 0 ) )
+	{
+		for( segment_number = 1;
+		     segment_number <= last_segment_number;
+		     segment_number++ )
+		{
+			if( segment_number_flags[ segment_number ] == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing segment file: %" PRIu32 " of: %" PRIu32 ".",
+				 function,
+				 segment_number,
+				 last_segment_number );
+
+				goto on_error;
+			}
+		}
+		if( (size_t) last_segment_number > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( char * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid last segment number value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		safe_filenames = (char **) memory_allocate(
+		                            sizeof( char * ) * last_segment_number );
+
+		if( safe_filenames == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filenames.",
+			 function );
+
+			goto on_error;
+		}
+		for( segment_number = 1;
+		     segment_number <= last_segment_number;
+		     segment_number++ )
+		{
+			if( libewf_glob_get_segment_filename(
+			     filename,
+			     filename_length,
+			     segment_extension_index,
+			     segment_file_type,
+			     segment_number,
+			     format,
+			     &segment_filename,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment filename: %" PRIu32 ".",
+				 function,
+				 segment_number );
+
+				goto on_error;
+			}
+			safe_filenames[ safe_number_of_filenames++ ] = segment_filename;
+
+			segment_filename = NULL;
+		}
+	}
+	memory_free(
+	 segment_number_flags );
+
+	memory_free(
+	 directory_name );
+
+	*filenames           = safe_filenames;
+	*number_of_filenames = safe_number_of_filenames;
+
+	return( 1 );
+
+on_error:
+	if( directory != NULL )
+	{
+		closedir(
+		 directory );
+	}
+	if( safe_filenames != NULL )
+	{
+		libewf_glob_free(
+		 safe_filenames,
+		 safe_number_of_filenames,
+		 NULL );
+	}
+	if( segment_number_flags != NULL )
+	{
+		memory_free(
+		 segment_number_flags );
+	}
+	if( directory_name != NULL )
+	{
+		memory_free(
+		 directory_name );
+	}
+	return( -1 );
+#else
+	/* Fall back to testing if every successive segment filename exists
+	 */
+	return( libewf_glob(
+	         filename,
+	         filename_length,
+	         format,
+	         filenames,
+	         number_of_filenames,
+	         error ) );
+#endif /* defined( HAVE_OPENDIR ) && defined( HAVE_READDIR ) && defined( HAVE_CLOSEDIR ) */
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Determines the format based on the filename
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_glob_wide_determine_format(
+     const wchar_t *filename,
+     size_t filename_length,
+     uint8_t *format,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_glob_wide_determine_format";
+	uint8_t safe_format   = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( format == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length > 4 )
+	 && ( filename[ filename_length - 4 ] == '.' ) )
+	{
+		switch( filename[ filename_length - 3 ] )
+		{
+			case (wchar_t) 'E':
+				safe_format = LIBEWF_FORMAT_ENCASE5;
+				break;
+
+			case (wchar_t) 'L':
+				safe_format = LIBEWF_FORMAT_LOGICAL_ENCASE5;
+				break;
+
+			case (wchar_t) 'e':
+				safe_format = LIBEWF_FORMAT_EWF;
+				break;
+
+			case (wchar_t) 's':
+				safe_format = LIBEWF_FORMAT_SMART;
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid filename - unsupported extension: %s.",
+				 function,
+				 &( filename[ filename_length - 4 ] ) );
+
+				return( -1 );
+		}
+	}
+	else if( ( filename_length > 5 )
+	      && ( filename[ filename_length - 5 ] == '.' ) )
+	{
+		switch( filename[ filename_length - 4 ] )
+		{
+			case (wchar_t) 'E':
+				safe_format = LIBEWF_FORMAT_V2_ENCASE7;
+				break;
+
+			case (wchar_t) 'L':
+				safe_format = LIBEWF_FORMAT_V2_LOGICAL_ENCASE7;
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid filename - unsupported extension: %s.",
+				 function,
+				 &( filename[ filename_length - 5 ] ) );
+
+				return( -1 );
+		}
+		if( filename[ filename_length - 3 ] != 'x' )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid filename - unsupported extension: %s.",
+			 function,
+			 &( filename[ filename_length - 5 ] ) );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid filename - missing extension.",
+		 function );
+
+		return( -1 );
+	}
+	*format = safe_format;
+
+	return( 1 );
+}
+
+/* Retrieves a segment filename
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_glob_wide_get_segment_filename(
+     const wchar_t *filename,
+     size_t filename_length,
+     size_t extension_index,
+     uint8_t segment_file_type,
+     uint32_t segment_number,
+     uint8_t format,
+     wchar_t **segment_filename,
+     libcerror_error_t **error )
+{
+	static char *function         = "libewf_glob_wide_get_segment_filename";
+	size_t segment_filename_index = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( wchar_t ) ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	segment_filename_index = extension_index;
+
+	*segment_filename = (wchar_t *) memory_allocate(
+	                                 sizeof( wchar_t ) * ( filename_length + 1 ) );
+
+	if( *segment_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( wide_string_copy(
+	     *segment_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	( *segment_filename )[ segment_filename_index++ ] = (wchar_t) '.';
+
+	/* Note that libewf_filename_set_extension also sets the end-of-string character
+	 */
+	if( libewf_filename_set_extension_wide(
+	     *segment_filename,
+	     filename_length + 1,
+	     &segment_filename_index,
+	     segment_number,
+	     (uint32_t) UINT16_MAX,
+	     segment_file_type,
+	     format,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set extension in segment filename.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *segment_filename != NULL )
+	{
+		memory_free(
+		 *segment_filename );
+
+		*segment_filename = NULL;
+	}
+	return( -1 );
+}
+
+/* Globs the segment files according to the EWF naming schema
+ * Make sure the value filenames is referencing, is set to NULL
+ *
+ * If the format is known the filename should contain the base of the filename
+ * otherwise the function will try to determine the format based on the extension
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_glob_wide(
+     const wchar_t *filename,
+     size_t filename_length,
+     uint8_t format,
+     wchar_t **filenames[],
+     int *number_of_filenames,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	wchar_t **safe_filenames         = NULL;
+	wchar_t *segment_filename        = NULL;
+	static char *function            = "libewf_glob_wide";
+	void *reallocation               = NULL;
+	size_t additional_length         = 0;
+	size_t segment_extension_index   = 0;
+	size_t segment_extension_length  = 0;
+	size_t segment_filename_length   = 0;
+	uint8_t segment_file_type        = 0;
+	int result                       = 0;
+	int safe_number_of_filenames     = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format != LIBEWF_FORMAT_UNKNOWN )
+	 && ( format != LIBEWF_FORMAT_ENCASE1 )
+	 && ( format != LIBEWF_FORMAT_ENCASE2 )
+	 && ( format != LIBEWF_FORMAT_ENCASE3 )
+	 && ( format != LIBEWF_FORMAT_ENCASE4 )
+	 && ( format != LIBEWF_FORMAT_ENCASE5 )
+	 && ( format != LIBEWF_FORMAT_ENCASE6 )
+	 && ( format != LIBEWF_FORMAT_LINEN5 )
+	 && ( format != LIBEWF_FORMAT_LINEN6 )
+	 && ( format != LIBEWF_FORMAT_SMART )
+	 && ( format != LIBEWF_FORMAT_FTK_IMAGER )
+	 && ( format != LIBEWF_FORMAT_LOGICAL_ENCASE5 )
+	 && ( format != LIBEWF_FORMAT_LOGICAL_ENCASE6 )
+	 && ( format != LIBEWF_FORMAT_LOGICAL_ENCASE7 )
+	 && ( format != LIBEWF_FORMAT_V2_ENCASE7 )
+	 && ( format != LIBEWF_FORMAT_V2_LOGICAL_ENCASE7 )
+	 && ( format != LIBEWF_FORMAT_EWF )
+	 && ( format != LIBEWF_FORMAT_EWFX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format.",
+		 function );
+
+		return( -1 );
+	}
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filenames != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filenames value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( format != LIBEWF_FORMAT_UNKNOWN )
+	{
+		additional_length = 4;
+	}
+	else
+	{
+		if( libewf_glob_wide_determine_format(
+		     filename,
+		     filename_length,
+		     &format,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine format based on filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( format == LIBEWF_FORMAT_V2_ENCASE7 )
+		 || ( format == LIBEWF_FORMAT_V2_LOGICAL_ENCASE7 ) )
+		{
+			segment_extension_length = 5;
+		}
+		else
+		{
+			segment_extension_length = 4;
+		}
+	}
+	switch( format )
+	{
+		case LIBEWF_FORMAT_LOGICAL_ENCASE5:
+		case LIBEWF_FORMAT_LOGICAL_ENCASE6:
+		case LIBEWF_FORMAT_LOGICAL_ENCASE7:
+			segment_file_type = LIBEWF_SEGMENT_FILE_TYPE_EWF1_LOGICAL;
+			break;
+
+		case LIBEWF_FORMAT_SMART:
+			segment_file_type = LIBEWF_SEGMENT_FILE_TYPE_EWF1_SMART;
+			break;
+
+		case LIBEWF_FORMAT_V2_ENCASE7:
+			segment_file_type = LIBEWF_SEGMENT_FILE_TYPE_EWF2;
+			break;
+
+		case LIBEWF_FORMAT_V2_LOGICAL_ENCASE7:
+			segment_file_type = LIBEWF_SEGMENT_FILE_TYPE_EWF2_LOGICAL;
+			break;
+
+		default:
+			segment_file_type = LIBEWF_SEGMENT_FILE_TYPE_EWF1;
+			break;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	segment_filename_length = filename_length + additional_length;
+
+	if( additional_length == 0 )
+	{
+		segment_extension_index = segment_filename_length - segment_extension_length;
+	}
+	else
+	{
+		segment_extension_index = filename_length;
+	}
+	while( safe_number_of_filenames < (int) UINT16_MAX )
+	{
+		if( libewf_glob_wide_get_segment_filename(
+		     filename,
+		     filename_length,
+		     segment_extension_index,
+		     segment_file_type,
+		     (uint32_t) ( safe_number_of_filenames + 1 ),
+		     format,
+		     &segment_filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_file_set_name_wide(
+		     file_io_handle,
+		     segment_filename,
+		     segment_filename_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		result = libbfio_handle_exists(
+		          file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to test if file exists.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			memory_free(
+			 segment_filename );
+
+			break;
+		}
+		safe_number_of_filenames += 1;
+
+		reallocation = memory_reallocate(
+		                safe_filenames,
+		                sizeof( wchar_t * ) * safe_number_of_filenames );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize filenames.",
+			 function );
+
+			goto on_error;
+		}
+		safe_filenames = (wchar_t **) reallocation;
+
+		safe_filenames[ safe_number_of_filenames - 1 ] = segment_filename;
+
+		segment_filename = NULL;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	*filenames           = safe_filenames;
+	*number_of_filenames = safe_number_of_filenames;
+
+	return( 1 );
+
+on_error:
+	if( segment_filename != NULL )
+	{
+		memory_free(
+		 segment_filename );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( safe_filenames != NULL )
+	{
+		libewf_glob_wide_free(
+		 safe_filenames,
+		 safe_number_of_filenames,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees globbed wide filenames
+ * Returns 1 if successful or -1 on error
+ */
+int libewf_glob_wide_free(
+     wchar_t *filenames[],
+     int number_of_filenames,
+     libcerror_error_t **error )
+{
+	static char *function = "libewf_glob_wide_free";
+	int filename_iterator = 0;
+
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filenames < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set extension in segment filename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of filenames value less than zero.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
-
-on_error:
-	if( *segment_filename != NULL )
+	for( filename_iterator = 0;
+	     filename_iterator < number_of_filenames;
+	     filename_iterator++ )
 	{
 		memory_free(
-		 *segment_filename );
-
-		*segment_filename = NULL;
+		 filenames[ filename_iterator ] );
 	}
-	return( -1 );
+	memory_free(
+	 filenames );
+
+	return( 1 );
 }
 
-/* Globs the segment files according to the EWF naming schema
+
+/* Globs the segment files according to the EWF naming schema using a single directory scan
  * Make sure the value filenames is referencing, is set to NULL
  *
+ * Unlike libewf_glob_wide, that tests if every successive segment filename exists, this function
+ * reads the directory that contains the segment files once and matches the names in memory
+ * On systems other than Windows this function falls back to libewf_glob_wide
+ *
  * If the format is known the filename should contain the base of the filename
  * otherwise the function will try to determine the format based on the extension
  * Returns 1 if successful or -1 on error
  */
-int libewf_glob_wide(
+int libewf_glob_scan_directory_wide(
      const wchar_t *filename,
      size_t filename_length,
      uint8_t format,
@@ -1352,18 +2275,30 @@ int libewf_glob_wide(
      int *number_of_filenames,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	wchar_t **safe_filenames         = NULL;
-	wchar_t *segment_filename        = NULL;
-	static char *function            = "libewf_glob_wide";
-	void *reallocation               = NULL;
-	size_t additional_length         = 0;
-	size_t segment_extension_index   = 0;
-	size_t segment_extension_length  = 0;
-	size_t segment_filename_length   = 0;
-	uint8_t segment_file_type        = 0;
-	int result                       = 0;
-	int safe_number_of_filenames     = 0;
+#if defined( WINAPI )
+	char segment_extension[ 5 ];
+
+	WIN32_FIND_DATAW find_data;
+
+	HANDLE find_handle              = INVALID_HANDLE_VALUE;
+	static char *function           = "libewf_glob_scan_directory_wide";
+	wchar_t **safe_filenames        = NULL;
+	wchar_t *search_pattern         = NULL;
+	wchar_t *segment_filename       = NULL;
+	const wchar_t *entry_name       = NULL;
+	const wchar_t *segment_basename = NULL;
+	uint8_t *segment_number_flags   = NULL;
+	size_t entry_name_length        = 0;
+	size_t segment_basename_length  = 0;
+	size_t segment_extension_index  = 0;
+	size_t segment_extension_length = 0;
+	size_t string_index             = 0;
+	uint32_t last_segment_number    = 0;
+	uint32_t segment_number         = 0;
+	DWORD error_code                = 0;
+	uint8_t segment_file_type       = 0;
+	int result                      = 0;
+	int safe_number_of_filenames    = 0;
 
 	if( filename == NULL )
 	{
@@ -1377,7 +2312,7 @@ int libewf_glob_wide(
 		return( -1 );
 	}
 	if( ( filename_length == 0 )
-	 || ( filename_length > (size_t) SSIZE_MAX ) )
+	 || ( filename_length > (size_t) ( SSIZE_MAX - 3 ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1451,7 +2386,7 @@ int libewf_glob_wide(
 	}
 	if( format != LIBEWF_FORMAT_UNKNOWN )
 	{
-		additional_length = 4;
+		segment_extension_index = filename_length;
 	}
 	else
 	{
@@ -1473,11 +2408,11 @@ int libewf_glob_wide(
 		if( ( format == LIBEWF_FORMAT_V2_ENCASE7 )
 		 || ( format == LIBEWF_FORMAT_V2_LOGICAL_ENCASE7 ) )
 		{
-			segment_extension_length = 5;
+			segment_extension_index = filename_length - 5;
 		}
 		else
 		{
-			segment_extension_length = 4;
+			segment_extension_index = filename_length - 4;
 		}
 	}
 	switch( format )
@@ -1504,139 +2439,329 @@ int libewf_glob_wide(
 			segment_file_type = LIBEWF_SEGMENT_FILE_TYPE_EWF1;
 			break;
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	if( ( segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF2 )
+	 || ( segment_file_type == LIBEWF_SEGMENT_FILE_TYPE_EWF2_LOGICAL ) )
+	{
+		segment_extension_length = 4;
+	}
+	else
+	{
+		segment_extension_length = 3;
+	}
+	/* Determine the segment basename, Windows accepts both \ and / as path separator
+	 */
+	segment_basename        = filename;
+	segment_basename_length = segment_extension_index;
+
+	for( string_index = segment_extension_index;
+	     string_index > 0;
+	     string_index-- )
+	{
+		if( ( filename[ string_index - 1 ] == (wchar_t) '\\' )
+		 || ( filename[ string_index - 1 ] == (wchar_t) '/' )
+		 || ( filename[ string_index - 1 ] == (wchar_t) ':' ) )
+		{
+			segment_basename        = &( filename[ string_index ] );
+			segment_basename_length = segment_extension_index - string_index;
+
+			break;
+		}
+	}
+	/* The search pattern consists of the directory name, the segment basename and ".*"
+	 */
+	search_pattern = wide_string_allocate(
+	                  segment_extension_index + 3 );
+
+	if( search_pattern == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create search pattern.",
 		 function );
 
 		goto on_error;
 	}
-	segment_filename_length = filename_length + additional_length;
+	if( wide_string_copy(
+	     search_pattern,
+	     filename,
+	     segment_extension_index ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy search pattern.",
+		 function );
 
-	if( additional_length == 0 )
+		goto on_error;
+	}
+	search_pattern[ segment_extension_index ]     = (wchar_t) '.';
+	search_pattern[ segment_extension_index + 1 ] = (wchar_t) '*';
+	search_pattern[ segment_extension_index + 2 ] = 0;
+
+	segment_number_flags = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * UINT16_MAX );
+
+	if( segment_number_flags == NULL )
 	{
-		segment_extension_index = segment_filename_length - segment_extension_length;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment number flags.",
+		 function );
+
+		goto on_error;
 	}
-	else
+	if( memory_set(
+	     segment_number_flags,
+	     0,
+	     sizeof( uint8_t ) * UINT16_MAX ) == NULL )
 	{
-		segment_extension_index = filename_length;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segment number flags.",
+		 function );
+
+		goto on_error;
 	}
-	while( safe_number_of_filenames < (int) UINT16_MAX )
+	find_handle = FindFirstFileW(
+	               search_pattern,
+	               &find_data );
+
+	if( find_handle == INVALID_HANDLE_VALUE )
 	{
-		if( libewf_glob_wide_get_segment_filename(
-		     filename,
-		     filename_length,
-		     segment_extension_index,
-		     segment_file_type,
-		     (uint32_t) ( safe_number_of_filenames + 1 ),
-		     format,
-		     &segment_filename,
-		     error ) != 1 )
+		/* A missing directory or no matching entries is handled as if no segment files were found
+		 */
+		error_code = GetLastError();
+
+		if( ( error_code != ERROR_FILE_NOT_FOUND )
+		 && ( error_code != ERROR_PATH_NOT_FOUND ) )
 		{
-			libcerror_error_set(
+			libcerror_system_set_error(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve segment filename.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 error_code,
+			 "%s: unable to find first file: %ls.",
+			 function,
+			 search_pattern );
 
 			goto on_error;
 		}
-		if( libbfio_file_set_name_wide(
-		     file_io_handle,
-		     segment_filename,
-		     segment_filename_length,
-		     error ) != 1 )
+	}
+	else
+	{
+		/* Determine the segment numbers of the directory entries that match
+		 * the segment basename and the naming schema of the format
+		 */
+		do
 		{
-			libcerror_error_set(
+			entry_name        = find_data.cFileName;
+			entry_name_length = wide_string_length(
+			                     entry_name );
+
+			if( entry_name_length != ( segment_basename_length + 1 + segment_extension_length ) )
+			{
+				continue;
+			}
+			/* Windows file systems are case insensitive
+			 */
+			if( ( segment_basename_length > 0 )
+			 && ( wide_string_compare_no_case(
+			       entry_name,
+			       segment_basename,
+			       segment_basename_length ) != 0 ) )
+			{
+				continue;
+			}
+			if( entry_name[ segment_basename_length ] != (wchar_t) '.' )
+			{
+				continue;
+			}
+			/* The naming schema only consists of ASCII characters
+			 */
+			for( string_index = 0;
+			     string_index < segment_extension_length;
+			     string_index++ )
+			{
+				if( entry_name[ segment_basename_length + 1 + string_index ] > (wchar_t) 0x7f )
+				{
+					break;
+				}
+				segment_extension[ string_index ] = (char) entry_name[ segment_basename_length + 1 + string_index ];
+			}
+			if( string_index < segment_extension_length )
+			{
+				continue;
+			}
+			segment_extension[ segment_extension_length ] = 0;
+
+			result = libewf_filename_get_segment_number(
+			          segment_extension,
+			          segment_extension_length,
+			          segment_file_type,
+			          format,
+			          &segment_number,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment number from directory entry: %ls.",
+				 function,
+				 entry_name );
+
+				goto on_error;
+			}
+			else if( ( result != 0 )
+			      && ( segment_number < (uint32_t) UINT16_MAX ) )
+			{
+				segment_number_flags[ segment_number ] = 1;
+
+				if( segment_number > last_segment_number )
+				{
+					last_segment_number = segment_number;
+				}
+			}
+		}
+		while( FindNextFileW(
+		        find_handle,
+		        &find_data ) != 0 );
+
+		error_code = GetLastError();
+
+		if( error_code != ERROR_NO_MORE_FILES )
+		{
+			libcerror_system_set_error(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set name in file IO handle.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 error_code,
+			 "%s: unable to find next file: %ls.",
+			 function,
+			 search_pattern );
 
 			goto on_error;
 		}
-		result = libbfio_handle_exists(
-		          file_io_handle,
-		          error );
-
-		if( result == -1 )
+		if( FindClose(
+		     find_handle ) == 0 )
 		{
-			libcerror_error_set(
+			libcerror_system_set_error(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_GENERIC,
-			 "%s: unable to test if file exists.",
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 GetLastError(),
+			 "%s: unable to close find handle.",
 			 function );
 
+			find_handle = INVALID_HANDLE_VALUE;
+
 			goto on_error;
 		}
-		else if( result == 0 )
+		find_handle = INVALID_HANDLE_VALUE;
+	}
+	/* The segment files must be consecutive, like libewf_glob_wide a missing first segment file
+	 * results in no segment files, while a gap after the first segment file is an error
+	 */
+	if( ( last_segment_number > 0 )
+	 && ( segment_number_flags[ 1 ] != 0 ) )
+	{
+		for( segment_number = 1;
+		     segment_number <= last_segment_number;
+		     segment_number++ )
 		{
-			memory_free(
-			 segment_filename );
+			if( segment_number_flags[ segment_number ] == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing segment file: %" PRIu32 " of: %" PRIu32 ".",
+				 function,
+				 segment_number,
+				 last_segment_number );
 
-			break;
+				goto on_error;
+			}
 		}
-		safe_number_of_filenames += 1;
+		if( (size_t) last_segment_number > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( wchar_t * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid last segment number value exceeds maximum.",
+			 function );
 
-		reallocation = memory_reallocate(
-		                safe_filenames,
-		                sizeof( wchar_t * ) * safe_number_of_filenames );
+			goto on_error;
+		}
+		safe_filenames = (wchar_t **) memory_allocate(
+		                               sizeof( wchar_t * ) * last_segment_number );
 
-		if( reallocation == NULL )
+		if( safe_filenames == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
 			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to resize filenames.",
+			 "%s: unable to create filenames.",
 			 function );
 
 			goto on_error;
 		}
-		safe_filenames = (wchar_t **) reallocation;
+		for( segment_number = 1;
+		     segment_number <= last_segment_number;
+		     segment_number++ )
+		{
+			if( libewf_glob_wide_get_segment_filename(
+			     filename,
+			     filename_length,
+			     segment_extension_index,
+			     segment_file_type,
+			     segment_number,
+			     format,
+			     &segment_filename,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment filename: %" PRIu32 ".",
+				 function,
+				 segment_number );
 
-		safe_filenames[ safe_number_of_filenames - 1 ] = segment_filename;
+				goto on_error;
+			}
+			safe_filenames[ safe_number_of_filenames++ ] = segment_filename;
 
-		segment_filename = NULL;
+			segment_filename = NULL;
+		}
 	}
-	if( libbfio_handle_free(
-	     &file_io_handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file IO handle.",
-		 function );
+	memory_free(
+	 segment_number_flags );
+
+	memory_free(
+	 search_pattern );
 
-		goto on_error;
-	}
 	*filenames           = safe_filenames;
 	*number_of_filenames = safe_number_of_filenames;
 
 	return( 1 );
 
 on_error:
-	if( segment_filename != NULL )
-	{
-		memory_free(
-		 segment_filename );
-	}
-	if( file_io_handle != NULL )
+	if( find_handle != INVALID_HANDLE_VALUE )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
+		FindClose(
+		 find_handle );
 	}
 	if( safe_filenames != NULL )
 	{
@@ -1645,53 +2770,28 @@ on_error:
 		 safe_number_of_filenames,
 		 NULL );
 	}
-	return( -1 );
-}
-
-/* Frees globbed wide filenames
- * Returns 1 if successful or -1 on error
- */
-int libewf_glob_wide_free(
-     wchar_t *filenames[],
-     int number_of_filenames,
-     libcerror_error_t **error )
-{
-	static char *function = "libewf_glob_wide_free";
-	int filename_iterator = 0;
-
-	if( filenames == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filenames.",
-		 function );
-
-		return( -1 );
-	}
-	if( number_of_filenames < 0 )
+	if( segment_number_flags != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
-		 "%s: invalid number of filenames value less than zero.",
-		 function );
-
-		return( -1 );
+		memory_free(
+		 segment_number_flags );
 	}
-	for( filename_iterator = 0;
-	     filename_iterator < number_of_filenames;
-	     filename_iterator++ )
+	if( search_pattern != NULL )
 	{
 		memory_free(
-		 filenames[ filename_iterator ] );
+		 search_pattern );
 	}
-	memory_free(
-	 filenames );
-
-	return( 1 );
+	return( -1 );
+#else
+	/* Fall back to testing if every successive segment filename exists
+	 */
+	return( libewf_glob_wide(
+	         filename,
+	         filename_length,
+	         format,
+	         filenames,
+	         number_of_filenames,
+	         error ) );
+#endif /* defined( WINAPI ) */
 }
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
@@ -67,6 +67,11 @@ int libewf_set_codepage(
 
 #endif /* !defined( HAVE_LOCAL_LIBEWF ) */
 
+LIBEWF_EXTERN \
+int libewf_set_maximum_shared_chunk_cache_size(
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
 LIBEWF_EXTERN \
 int libewf_check_file_signature(
      const char *filename,
@@ -117,6 +122,15 @@ int libewf_glob_free(
      int number_of_filenames,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_glob_scan_directory(
+     const char *filename,
+     size_t length,
+     uint8_t format,
+     char **filenames[],
+     int *number_of_filenames,
+     libcerror_error_t **error );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 int libewf_glob_wide_determine_format(
@@ -150,6 +164,15 @@ int libewf_glob_wide_free(
      int number_of_filenames,
      libcerror_error_t **error );
 
+LIBEWF_EXTERN \
+int libewf_glob_scan_directory_wide(
+     const wchar_t *filename,
+     size_t length,
+     uint8_t format,
+     wchar_t **filenames[],
+     int *number_of_filenames,
+     libcerror_error_t **error );
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 #if defined( __cplusplus )
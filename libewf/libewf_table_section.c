@@ -25,6 +25,7 @@
 
 #include "libewf_checksum.h"
 #include "libewf_definitions.h"
+#include "libewf_encryption_context.h"
 #include "libewf_libbfio.h"
 #include "libewf_libcerror.h"
 #include "libewf_libcnotify.h"
@@ -569,14 +570,15 @@ ssize_t libewf_table_section_read_file_io_pool(
          uint32_t section_data_flags,
          libcerror_error_t **error )
 {
-	static char *function         = "libewf_table_section_read_file_io_pool";
-	size_t data_offset            = 0;
-	size_t table_entry_data_size  = 0;
-	size_t table_footer_data_size = 0;
-	size_t table_header_data_size = 0;
-	ssize_t read_count            = 0;
-	uint32_t calculated_checksum  = 0;
-	uint32_t stored_checksum      = 0;
+	uint8_t *decrypted_section_data = NULL;
+	static char *function           = "libewf_table_section_read_file_io_pool";
+	size_t data_offset              = 0;
+	size_t table_entry_data_size    = 0;
+	size_t table_footer_data_size   = 0;
+	size_t table_header_data_size   = 0;
+	ssize_t read_count              = 0;
+	uint32_t calculated_checksum    = 0;
+	uint32_t stored_checksum        = 0;
 
 	if( table_section == NULL )
 	{
@@ -711,14 +713,56 @@ ssize_t libewf_table_section_read_file_io_pool(
 			 0 );
 		}
 #endif
-/* TODO decrypt */
+		/* Without an encryption key the table section cannot be read
+		 */
+		if( io_handle->encryption_context == NULL )
+		{
+			memory_free(
+			 table_section->section_data );
+
+			table_section->section_data      = NULL;
+			table_section->section_data_size = 0;
+
+			return( 0 );
+		}
+		decrypted_section_data = (uint8_t *) memory_allocate(
+		                                      sizeof( uint8_t ) * table_section->section_data_size );
+
+		if( decrypted_section_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create decrypted section data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libewf_encryption_context_decrypt(
+		     io_handle->encryption_context,
+		     table_section->section_data,
+		     table_section->section_data_size,
+		     decrypted_section_data,
+		     table_section->section_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt section data.",
+			 function );
+
+			memory_free(
+			 decrypted_section_data );
+
+			goto on_error;
+		}
 		memory_free(
 		 table_section->section_data );
 
-		table_section->section_data      = NULL;
-		table_section->section_data_size = 0;
-
-		return( 0 );
+		table_section->section_data = decrypted_section_data;
 	}
 	if( libewf_table_section_read_header_data(
 	     table_section,
@@ -50,6 +50,7 @@
 #include "libewf_libfcache.h"
 #include "libewf_libfdata.h"
 #include "libewf_libfvalue.h"
+#include "libewf_media_digests.h"
 #include "libewf_media_values.h"
 #include "libewf_read_io_handle.h"
 #include "libewf_section.h"
@@ -224,6 +225,22 @@ int libewf_write_io_handle_free(
 			memory_free(
 			 ( *write_io_handle )->compressed_zero_byte_empty_block );
 		}
+		if( ( *write_io_handle )->media_digests != NULL )
+		{
+			if( libewf_media_digests_free(
+			     &( ( *write_io_handle )->media_digests ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free media digests.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcdata_array_free(
 		     &( ( *write_io_handle )->chunks_section ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libewf_chunk_descriptor_free,
@@ -325,6 +342,25 @@ int libewf_write_io_handle_clone(
 	( *destination_write_io_handle )->chunks_section             = NULL;
 	( *destination_write_io_handle )->current_file_io_pool_entry = -1;
 	( *destination_write_io_handle )->current_segment_file       = NULL;
+	( *destination_write_io_handle )->media_digests              = NULL;
+
+	if( source_write_io_handle->media_digests != NULL )
+	{
+		if( libewf_media_digests_initialize(
+		     &( ( *destination_write_io_handle )->media_digests ),
+		     source_write_io_handle->media_digests->calculate_digest_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination media digests.",
+			 function );
+
+			goto on_error;
+		}
+	}
 
 	if( source_write_io_handle->case_data != NULL )
 	{
@@ -477,6 +513,12 @@ int libewf_write_io_handle_clone(
 on_error:
 	if( *destination_write_io_handle != NULL )
 	{
+		if( ( *destination_write_io_handle )->media_digests != NULL )
+		{
+			libewf_media_digests_free(
+			 &( ( *destination_write_io_handle )->media_digests ),
+			 NULL );
+		}
 		if( ( *destination_write_io_handle )->table_section_data != NULL )
 		{
 			memory_free(
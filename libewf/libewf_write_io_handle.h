@@ -44,6 +44,7 @@
 #include "libewf_libfdata.h"
 #include "libewf_libfvalue.h"
 #include "libewf_io_handle.h"
+#include "libewf_media_digests.h"
 #include "libewf_media_values.h"
 #include "libewf_read_io_handle.h"
 #include "libewf_segment_file.h"
@@ -219,6 +220,10 @@ struct libewf_write_io_handle
 	/* The size of the compressed zero byte empty block
 	 */
 	size_t compressed_zero_byte_empty_block_size;
+
+	/* The media digests calculated during write
+	 */
+	libewf_media_digests_t *media_digests;
 };
 
 int libewf_write_io_handle_initialize(
@@ -0,0 +1,556 @@
+/*
+ * bzip2 decompression benchmark program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+#include <bzlib.h>
+#endif
+
+#include "ewf_bench_timer.h"
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_bzip2.h"
+#include "../libewf/libewf_compression.h"
+#include "../libewf/libewf_definitions.h"
+
+/* The chunk size, which is the default chunk size of EnCase
+ */
+#define EWF_BENCH_BZIP2_CHUNK_SIZE		32768
+
+/* The maximum size of the media data read from the source
+ */
+#define EWF_BENCH_BZIP2_MAXIMUM_DATA_SIZE	( 64 * 1024 * 1024 )
+
+/* The number of times the chunks are decompressed
+ */
+#define EWF_BENCH_BZIP2_NUMBER_OF_ITERATIONS	3
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* The bzip2 compressed chunks
+ */
+typedef struct ewf_bench_bzip2_chunks ewf_bench_bzip2_chunks_t;
+
+struct ewf_bench_bzip2_chunks
+{
+	/* The uncompressed data
+	 */
+	uint8_t *data;
+
+	/* The uncompressed data size
+	 */
+	size_t data_size;
+
+	/* The compressed data of all the chunks
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data offset of every chunk
+	 */
+	size_t *compressed_data_offsets;
+
+	/* The compressed data size of every chunk
+	 */
+	size_t *compressed_data_sizes;
+
+	/* The number of chunks
+	 */
+	size_t number_of_chunks;
+};
+
+/* Fills the data with a mix of text-like, zero and pseudo random runs
+ * when no source is provided
+ */
+void ewf_bench_bzip2_generate_data(
+      uint8_t *data,
+      size_t data_size )
+{
+	size_t data_offset = 0;
+	uint32_t value     = 0x12345678UL;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		value = ( value * 1103515245UL ) + 12345UL;
+
+		switch( ( data_offset / 4096 ) % 4 )
+		{
+			case 0:
+				data[ data_offset ] = (uint8_t) "libewf bzip2 benchmark "[ data_offset % 23 ];
+				break;
+
+			case 1:
+				data[ data_offset ] = 0;
+				break;
+
+			case 2:
+				data[ data_offset ] = (uint8_t) ( 'a' + ( ( value >> 16 ) % 8 ) );
+				break;
+
+			default:
+				data[ data_offset ] = (uint8_t) ( value >> 16 );
+				break;
+		}
+	}
+}
+
+/* Reads the source and compresses it into chunks the same way Ex01 chunks are written
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_bench_bzip2_chunks_initialize(
+     ewf_bench_bzip2_chunks_t *chunks,
+     const char *source,
+     libcerror_error_t **error )
+{
+	FILE *file_stream           = NULL;
+	static char *function       = "ewf_bench_bzip2_chunks_initialize";
+	size_t chunk_index          = 0;
+	size_t chunk_size           = 0;
+	size_t compressed_data_size = 0;
+	size_t compressed_offset    = 0;
+	size_t maximum_size         = 0;
+	int result                  = 0;
+
+	chunks->data_size = EWF_BENCH_BZIP2_MAXIMUM_DATA_SIZE;
+
+	chunks->data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * chunks->data_size );
+
+	if( chunks->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		return( -1 );
+	}
+	if( source != NULL )
+	{
+		file_stream = file_stream_open(
+		               source,
+		               "rb" );
+
+		if( file_stream == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open source: %s.",
+			 function,
+			 source );
+
+			return( -1 );
+		}
+		chunks->data_size = file_stream_read(
+		                     file_stream,
+		                     chunks->data,
+		                     chunks->data_size );
+
+		file_stream_close(
+		 file_stream );
+
+		if( chunks->data_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read source: %s.",
+			 function,
+			 source );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		ewf_bench_bzip2_generate_data(
+		 chunks->data,
+		 chunks->data_size );
+	}
+	chunks->number_of_chunks = ( chunks->data_size + EWF_BENCH_BZIP2_CHUNK_SIZE - 1 ) / EWF_BENCH_BZIP2_CHUNK_SIZE;
+
+	/* bzip2 can enlarge incompressible data slightly
+	 */
+	maximum_size = chunks->data_size + ( chunks->number_of_chunks * 1024 );
+
+	chunks->compressed_data = (uint8_t *) memory_allocate(
+	                                       sizeof( uint8_t ) * maximum_size );
+
+	chunks->compressed_data_offsets = (size_t *) memory_allocate(
+	                                              sizeof( size_t ) * chunks->number_of_chunks );
+
+	chunks->compressed_data_sizes = (size_t *) memory_allocate(
+	                                            sizeof( size_t ) * chunks->number_of_chunks );
+
+	if( ( chunks->compressed_data == NULL )
+	 || ( chunks->compressed_data_offsets == NULL )
+	 || ( chunks->compressed_data_sizes == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < chunks->number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_size = chunks->data_size - ( chunk_index * EWF_BENCH_BZIP2_CHUNK_SIZE );
+
+		if( chunk_size > EWF_BENCH_BZIP2_CHUNK_SIZE )
+		{
+			chunk_size = EWF_BENCH_BZIP2_CHUNK_SIZE;
+		}
+		compressed_data_size = maximum_size - compressed_offset;
+
+		result = libewf_compress_data(
+		          &( chunks->compressed_data[ compressed_offset ] ),
+		          &compressed_data_size,
+		          LIBEWF_COMPRESSION_METHOD_BZIP2,
+		          LIBEWF_COMPRESSION_LEVEL_DEFAULT,
+		          &( chunks->data[ chunk_index * EWF_BENCH_BZIP2_CHUNK_SIZE ] ),
+		          chunk_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress chunk: %" PRIzd ".",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+		chunks->compressed_data_offsets[ chunk_index ] = compressed_offset;
+		chunks->compressed_data_sizes[ chunk_index ]   = compressed_data_size;
+
+		compressed_offset += compressed_data_size;
+	}
+	fprintf(
+	 stdout,
+	 "Chunks\t\t\t: %" PRIzd " of %d bytes, %" PRIzd " bytes compressed to %" PRIzd " bytes\n\n",
+	 chunks->number_of_chunks,
+	 EWF_BENCH_BZIP2_CHUNK_SIZE,
+	 chunks->data_size,
+	 compressed_offset );
+
+	return( 1 );
+}
+
+/* Frees the chunks
+ */
+void ewf_bench_bzip2_chunks_free(
+      ewf_bench_bzip2_chunks_t *chunks )
+{
+	if( chunks->compressed_data_sizes != NULL )
+	{
+		memory_free(
+		 chunks->compressed_data_sizes );
+	}
+	if( chunks->compressed_data_offsets != NULL )
+	{
+		memory_free(
+		 chunks->compressed_data_offsets );
+	}
+	if( chunks->compressed_data != NULL )
+	{
+		memory_free(
+		 chunks->compressed_data );
+	}
+	if( chunks->data != NULL )
+	{
+		memory_free(
+		 chunks->data );
+	}
+}
+
+/* Decompresses a chunk with the native bzip2 decoder
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_bench_bzip2_decompress_native(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	return( libewf_bzip2_decompress(
+	         compressed_data,
+	         compressed_data_size,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+
+/* Decompresses a chunk with libbz2
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_bench_bzip2_decompress_libbz2(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                     = "ewf_bench_bzip2_decompress_libbz2";
+	unsigned int bzip2_uncompressed_data_size = (unsigned int) *uncompressed_data_size;
+	int result                                = 0;
+
+	result = BZ2_bzBuffToBuffDecompress(
+	          (char *) uncompressed_data,
+	          &bzip2_uncompressed_data_size,
+	          (char *) compressed_data,
+	          (unsigned int) compressed_data_size,
+	          0,
+	          0 );
+
+	if( result != BZ_OK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: libbz2 returned error: %d.",
+		 function,
+		 result );
+
+		return( -1 );
+	}
+	*uncompressed_data_size = (size_t) bzip2_uncompressed_data_size;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_BZLIB ) || defined( BZ_DLL ) */
+
+/* Decompresses all the chunks, checks the uncompressed data and prints the throughput
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_bench_bzip2_run(
+     ewf_bench_bzip2_chunks_t *chunks,
+     const char *name,
+     int (*decompress_function)(
+            const uint8_t *compressed_data,
+            size_t compressed_data_size,
+            uint8_t *uncompressed_data,
+            size_t *uncompressed_data_size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	uint8_t uncompressed_data[ EWF_BENCH_BZIP2_CHUNK_SIZE ];
+
+	static char *function         = "ewf_bench_bzip2_run";
+	size_t chunk_index            = 0;
+	size_t expected_data_size     = 0;
+	size_t uncompressed_data_size = 0;
+	double best_time              = 0.0;
+	double start_time             = 0.0;
+	double run_time               = 0.0;
+	int iteration                 = 0;
+
+	for( iteration = 0;
+	     iteration < EWF_BENCH_BZIP2_NUMBER_OF_ITERATIONS;
+	     iteration++ )
+	{
+		start_time = ewf_bench_timer_get_seconds();
+
+		for( chunk_index = 0;
+		     chunk_index < chunks->number_of_chunks;
+		     chunk_index++ )
+		{
+			uncompressed_data_size = EWF_BENCH_BZIP2_CHUNK_SIZE;
+
+			if( decompress_function(
+			     &( chunks->compressed_data[ chunks->compressed_data_offsets[ chunk_index ] ] ),
+			     chunks->compressed_data_sizes[ chunk_index ],
+			     uncompressed_data,
+			     &uncompressed_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: %s unable to decompress chunk: %" PRIzd ".",
+				 function,
+				 name,
+				 chunk_index );
+
+				return( -1 );
+			}
+			/* The data is only compared in the first iteration to keep it out of the timing
+			 */
+			if( iteration == 0 )
+			{
+				expected_data_size = chunks->data_size - ( chunk_index * EWF_BENCH_BZIP2_CHUNK_SIZE );
+
+				if( expected_data_size > EWF_BENCH_BZIP2_CHUNK_SIZE )
+				{
+					expected_data_size = EWF_BENCH_BZIP2_CHUNK_SIZE;
+				}
+				if( ( uncompressed_data_size != expected_data_size )
+				 || ( memory_compare(
+				       uncompressed_data,
+				       &( chunks->data[ chunk_index * EWF_BENCH_BZIP2_CHUNK_SIZE ] ),
+				       expected_data_size ) != 0 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_INPUT,
+					 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+					 "%s: %s mismatch in uncompressed data of chunk: %" PRIzd ".",
+					 function,
+					 name,
+					 chunk_index );
+
+					return( -1 );
+				}
+			}
+		}
+		run_time = ewf_bench_timer_get_seconds() - start_time;
+
+		if( ( iteration == 0 )
+		 || ( run_time < best_time ) )
+		{
+			best_time = run_time;
+		}
+	}
+	if( best_time > 0.0 )
+	{
+		fprintf(
+		 stdout,
+		 "%-24s: %.3f s (%.1f MiB/s)\n",
+		 name,
+		 best_time,
+		 (double) chunks->data_size / ( best_time * 1024.0 * 1024.0 ) );
+	}
+	return( 1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ * If a source is provided its data, for example the media data exported from an Ex01 image,
+ * is compressed into bzip2 chunks, otherwise generated data is used
+ */
+int main(
+     int argc,
+     char * const argv[] )
+{
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+	ewf_bench_bzip2_chunks_t chunks;
+
+	libcerror_error_t *error = NULL;
+	const char *source       = NULL;
+
+	if( argc > 1 )
+	{
+		source = argv[ 1 ];
+	}
+	if( memory_set(
+	     &chunks,
+	     0,
+	     sizeof( ewf_bench_bzip2_chunks_t ) ) == NULL )
+	{
+		return( EXIT_FAILURE );
+	}
+	if( ewf_bench_bzip2_chunks_initialize(
+	     &chunks,
+	     source,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ewf_bench_bzip2_run(
+	     &chunks,
+	     "libewf_bzip2_decompress",
+	     &ewf_bench_bzip2_decompress_native,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+#if defined( HAVE_BZLIB ) || defined( BZ_DLL )
+	if( ewf_bench_bzip2_run(
+	     &chunks,
+	     "libbz2",
+	     &ewf_bench_bzip2_decompress_libbz2,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+#endif
+	ewf_bench_bzip2_chunks_free(
+	 &chunks );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	ewf_bench_bzip2_chunks_free(
+	 &chunks );
+
+	return( EXIT_FAILURE );
+
+#else
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	return( EXIT_SUCCESS );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+}
+
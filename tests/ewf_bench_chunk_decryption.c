@@ -0,0 +1,575 @@
+/*
+ * Chunk decryption benchmark program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "ewf_bench_timer.h"
+#include "ewf_test_getopt.h"
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_encryption_context.h"
+
+/* The chunk size used when no source is provided
+ */
+#define EWF_BENCH_CHUNK_DECRYPTION_CHUNK_SIZE	32768
+
+/* The size of the data decrypted when no source is provided
+ */
+#define EWF_BENCH_CHUNK_DECRYPTION_DATA_SIZE	( 256 * 1024 * 1024 )
+
+/* The maximum decryption time relative to the read time
+ */
+#define EWF_BENCH_CHUNK_DECRYPTION_MAXIMUM_RATIO	0.10
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* AES-256 key used for the benchmark, the decrypted data is not checked
+ */
+uint8_t ewf_bench_chunk_decryption_key[ 32 ] = {
+	0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe, 0x2b, 0x73, 0xae, 0xf0, 0x85, 0x7d, 0x77, 0x81,
+	0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61, 0x08, 0xd7, 0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4 };
+
+/* Reads all the media data of the source and determines the read time
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_bench_chunk_decryption_read_source(
+     const system_character_t *source,
+     size64_t *media_size,
+     size32_t *chunk_size,
+     double *read_time,
+     libcerror_error_t **error )
+{
+	libewf_handle_t *handle        = NULL;
+	system_character_t **filenames = NULL;
+	uint8_t *buffer                = NULL;
+	static char *function          = "ewf_bench_chunk_decryption_read_source";
+	double start_time              = 0.0;
+	ssize_t read_count             = 0;
+	int number_of_filenames        = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libewf_glob_wide(
+	     source,
+	     system_string_length(
+	      source ),
+	     LIBEWF_FORMAT_UNKNOWN,
+	     &filenames,
+	     &number_of_filenames,
+	     error ) != 1 )
+#else
+	if( libewf_glob(
+	     source,
+	     system_string_length(
+	      source ),
+	     LIBEWF_FORMAT_UNKNOWN,
+	     &filenames,
+	     &number_of_filenames,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to glob source.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_initialize(
+	     &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libewf_handle_open_wide(
+	     handle,
+	     filenames,
+	     number_of_filenames,
+	     LIBEWF_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libewf_handle_open(
+	     handle,
+	     filenames,
+	     number_of_filenames,
+	     LIBEWF_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_get_media_size(
+	     handle,
+	     media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_get_chunk_size(
+	     handle,
+	     chunk_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk size.",
+		 function );
+
+		goto on_error;
+	}
+	if( *chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * *chunk_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	start_time = ewf_bench_timer_get_seconds();
+
+	do
+	{
+		read_count = libewf_handle_read_buffer(
+		              handle,
+		              buffer,
+		              (size_t) *chunk_size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( read_count > 0 );
+
+	*read_time = ewf_bench_timer_get_seconds() - start_time;
+
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( libewf_handle_close(
+	     handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_free(
+	     &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libewf_glob_wide_free(
+	     filenames,
+	     number_of_filenames,
+	     error ) != 1 )
+#else
+	if( libewf_glob_free(
+	     filenames,
+	     number_of_filenames,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free filenames.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( handle != NULL )
+	{
+		libewf_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( filenames != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		libewf_glob_wide_free(
+		 filenames,
+		 number_of_filenames,
+		 NULL );
+#else
+		libewf_glob_free(
+		 filenames,
+		 number_of_filenames,
+		 NULL );
+#endif
+	}
+	return( -1 );
+}
+
+/* Decrypts data chunk by chunk with AES-256-CBC and determines the decryption time
+ * Every chunk is decrypted with the same initialization vector, as is done by libewf_chunk_data_decrypt
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_bench_chunk_decryption_decrypt(
+     size64_t data_size,
+     size32_t chunk_size,
+     double *decryption_time,
+     libcerror_error_t **error )
+{
+	libewf_encryption_context_t *encryption_context = NULL;
+	uint8_t *input_data                             = NULL;
+	uint8_t *output_data                            = NULL;
+	static char *function                           = "ewf_bench_chunk_decryption_decrypt";
+	size64_t data_offset                            = 0;
+	double start_time                               = 0.0;
+	size_t data_index                               = 0;
+	size_t decrypt_size                             = 0;
+
+	if( libewf_encryption_context_initialize(
+	     &encryption_context,
+	     ewf_bench_chunk_decryption_key,
+	     32,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create encryption context.",
+		 function );
+
+		goto on_error;
+	}
+	input_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * chunk_size );
+
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input data.",
+		 function );
+
+		goto on_error;
+	}
+	output_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * chunk_size );
+
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output data.",
+		 function );
+
+		goto on_error;
+	}
+	for( data_index = 0;
+	     data_index < (size_t) chunk_size;
+	     data_index++ )
+	{
+		input_data[ data_index ] = (uint8_t) ( data_index * 7 );
+	}
+	start_time = ewf_bench_timer_get_seconds();
+
+	while( data_offset < data_size )
+	{
+		decrypt_size = (size_t) chunk_size;
+
+		if( (size64_t) decrypt_size > ( data_size - data_offset ) )
+		{
+			decrypt_size = (size_t) ( data_size - data_offset );
+		}
+		/* Encrypted chunk data is padded to the AES block size
+		 */
+		decrypt_size = ( decrypt_size + 15 ) & ~( (size_t) 15 );
+
+		if( libewf_encryption_context_decrypt(
+		     encryption_context,
+		     input_data,
+		     decrypt_size,
+		     output_data,
+		     (size_t) chunk_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt data at offset: %" PRIu64 ".",
+			 function,
+			 data_offset );
+
+			goto on_error;
+		}
+		data_offset += chunk_size;
+	}
+	*decryption_time = ewf_bench_timer_get_seconds() - start_time;
+
+	memory_free(
+	 output_data );
+
+	output_data = NULL;
+
+	memory_free(
+	 input_data );
+
+	input_data = NULL;
+
+	if( libewf_encryption_context_free(
+	     &encryption_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free encryption context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( output_data != NULL )
+	{
+		memory_free(
+		 output_data );
+	}
+	if( input_data != NULL )
+	{
+		memory_free(
+		 input_data );
+	}
+	if( encryption_context != NULL )
+	{
+		libewf_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ * If a source is provided the decryption time of its media data is compared with its read time
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+	libcerror_error_t *error   = NULL;
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+	size64_t media_size        = EWF_BENCH_CHUNK_DECRYPTION_DATA_SIZE;
+	double decryption_time     = 0.0;
+	double read_time           = 0.0;
+	size32_t chunk_size        = EWF_BENCH_CHUNK_DECRYPTION_CHUNK_SIZE;
+
+	while( ( option = ewf_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	if( source != NULL )
+	{
+		if( ewf_bench_chunk_decryption_read_source(
+		     source,
+		     &media_size,
+		     &chunk_size,
+		     &read_time,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( ewf_bench_chunk_decryption_decrypt(
+	     media_size,
+	     chunk_size,
+	     &decryption_time,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Data size\t\t: %" PRIu64 " bytes in chunks of %" PRIu32 " bytes\n",
+	 media_size,
+	 chunk_size );
+
+	if( decryption_time > 0.0 )
+	{
+		fprintf(
+		 stdout,
+		 "AES-256-CBC decryption\t: %.3f s (%.1f MiB/s)\n",
+		 decryption_time,
+		 (double) media_size / ( decryption_time * 1024.0 * 1024.0 ) );
+	}
+	if( ( source != NULL )
+	 && ( read_time > 0.0 ) )
+	{
+		fprintf(
+		 stdout,
+		 "Read\t\t\t: %.3f s (%.1f MiB/s)\n",
+		 read_time,
+		 (double) media_size / ( read_time * 1024.0 * 1024.0 ) );
+
+		fprintf(
+		 stdout,
+		 "Decryption / read time\t: %.1f%% (target: < %.0f%%)\n",
+		 ( decryption_time * 100.0 ) / read_time,
+		 EWF_BENCH_CHUNK_DECRYPTION_MAXIMUM_RATIO * 100.0 );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+
+#else
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	return( EXIT_SUCCESS );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+}
+
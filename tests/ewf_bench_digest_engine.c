@@ -0,0 +1,318 @@
+/*
+ * Digest engine benchmark program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_unused.h"
+
+#include "../ewftools/digest_engine.h"
+#include "../ewftools/ewftools_libhmac.h"
+
+/* The size of the buffer passed to every update
+ */
+#define EWF_BENCH_DIGEST_ENGINE_BUFFER_SIZE	( 64 * 1024 )
+
+/* The number of updates per digest hash
+ */
+#define EWF_BENCH_DIGEST_ENGINE_NUMBER_OF_UPDATES	4096
+
+/* Creates a MD5 context with exportable state, which uses the portable block function
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_bench_digest_engine_md5_initialize_exportable(
+     digest_engine_md5_context_t **context,
+     libcerror_error_t **error )
+{
+	return( digest_engine_md5_initialize_with_flags(
+	         context,
+	         DIGEST_ENGINE_FLAG_EXPORTABLE_STATE,
+	         error ) );
+}
+
+/* Calculates a digest hash over the buffer and prints the throughput
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_bench_digest_engine_run(
+     const char *name,
+     int (*initialize_function)(
+            intptr_t **context,
+            libcerror_error_t **error ),
+     int (*update_function)(
+            intptr_t *context,
+            const uint8_t *buffer,
+            size_t size,
+            libcerror_error_t **error ),
+     int (*finalize_function)(
+            intptr_t *context,
+            uint8_t *hash,
+            size_t hash_size,
+            libcerror_error_t **error ),
+     int (*free_function)(
+            intptr_t **context,
+            libcerror_error_t **error ),
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	uint8_t hash[ 32 ];
+
+	intptr_t *context  = NULL;
+	clock_t end_time   = 0;
+	clock_t start_time = 0;
+	double seconds     = 0.0;
+	int update_index   = 0;
+
+	start_time = clock();
+
+	if( initialize_function(
+	     &context,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( update_index = 0;
+	     update_index < EWF_BENCH_DIGEST_ENGINE_NUMBER_OF_UPDATES;
+	     update_index++ )
+	{
+		if( update_function(
+		     context,
+		     buffer,
+		     buffer_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( finalize_function(
+	     context,
+	     hash,
+	     32,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( free_function(
+	     &context,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	end_time = clock();
+
+	seconds = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	if( seconds <= 0.0 )
+	{
+		seconds = 1.0 / CLOCKS_PER_SEC;
+	}
+	fprintf(
+	 stdout,
+	 "%-32s %8.1f MiB/s\n",
+	 name,
+	 ( (double) buffer_size * EWF_BENCH_DIGEST_ENGINE_NUMBER_OF_UPDATES ) / ( seconds * 1024.0 * 1024.0 ) );
+
+	return( 1 );
+
+on_error:
+	if( context != NULL )
+	{
+		free_function(
+		 &context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *buffer          = NULL;
+	size_t buffer_index      = 0;
+	uint8_t hardware_flags   = 0;
+
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * EWF_BENCH_DIGEST_ENGINE_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffer.\n" );
+
+		goto on_error;
+	}
+	for( buffer_index = 0;
+	     buffer_index < EWF_BENCH_DIGEST_ENGINE_BUFFER_SIZE;
+	     buffer_index++ )
+	{
+		buffer[ buffer_index ] = (uint8_t) ( ( buffer_index * 131 ) + 7 );
+	}
+	if( digest_engine_get_hardware_flags(
+	     &hardware_flags,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve hardware flags.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Hardware SHA1\t\t: %s\n",
+	 ( hardware_flags & DIGEST_ENGINE_HARDWARE_FLAG_SHA1 ) != 0 ? "yes" : "no" );
+
+	fprintf(
+	 stdout,
+	 "Hardware SHA256\t\t: %s\n\n",
+	 ( hardware_flags & DIGEST_ENGINE_HARDWARE_FLAG_SHA256 ) != 0 ? "yes" : "no" );
+
+	if( ewf_bench_digest_engine_run(
+	     "libhmac MD5",
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libhmac_md5_initialize,
+	     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_md5_update,
+	     (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libhmac_md5_finalize,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libhmac_md5_free,
+	     buffer,
+	     EWF_BENCH_DIGEST_ENGINE_BUFFER_SIZE,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ewf_bench_digest_engine_run(
+	     "digest engine MD5",
+	     (int (*)(intptr_t **, libcerror_error_t **)) &digest_engine_md5_initialize,
+	     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_engine_md5_update,
+	     (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &digest_engine_md5_finalize,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &digest_engine_md5_free,
+	     buffer,
+	     EWF_BENCH_DIGEST_ENGINE_BUFFER_SIZE,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ewf_bench_digest_engine_run(
+	     "digest engine MD5 (exportable)",
+	     (int (*)(intptr_t **, libcerror_error_t **)) &ewf_bench_digest_engine_md5_initialize_exportable,
+	     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_engine_md5_update,
+	     (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &digest_engine_md5_finalize,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &digest_engine_md5_free,
+	     buffer,
+	     EWF_BENCH_DIGEST_ENGINE_BUFFER_SIZE,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ewf_bench_digest_engine_run(
+	     "libhmac SHA1",
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libhmac_sha1_initialize,
+	     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_sha1_update,
+	     (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libhmac_sha1_finalize,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libhmac_sha1_free,
+	     buffer,
+	     EWF_BENCH_DIGEST_ENGINE_BUFFER_SIZE,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ewf_bench_digest_engine_run(
+	     "digest engine SHA1",
+	     (int (*)(intptr_t **, libcerror_error_t **)) &digest_engine_sha1_initialize,
+	     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_engine_sha1_update,
+	     (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &digest_engine_sha1_finalize,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &digest_engine_sha1_free,
+	     buffer,
+	     EWF_BENCH_DIGEST_ENGINE_BUFFER_SIZE,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ewf_bench_digest_engine_run(
+	     "libhmac SHA256",
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libhmac_sha256_initialize,
+	     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_sha256_update,
+	     (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libhmac_sha256_finalize,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libhmac_sha256_free,
+	     buffer,
+	     EWF_BENCH_DIGEST_ENGINE_BUFFER_SIZE,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ewf_bench_digest_engine_run(
+	     "digest engine SHA256",
+	     (int (*)(intptr_t **, libcerror_error_t **)) &digest_engine_sha256_initialize,
+	     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_engine_sha256_update,
+	     (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &digest_engine_sha256_finalize,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &digest_engine_sha256_free,
+	     buffer,
+	     EWF_BENCH_DIGEST_ENGINE_BUFFER_SIZE,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	memory_free(
+	 buffer );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,358 @@
+/*
+ * Segment file glob benchmark program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "ewf_bench_timer.h"
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_unused.h"
+
+/* The synthetic segment files are created in the current working directory
+ * so the benchmark can be run on a network share by changing into it
+ */
+#define EWF_BENCH_GLOB_BASENAME			"ewf_bench_glob"
+
+/* The number of synthetic segment files
+ */
+#define EWF_BENCH_GLOB_NUMBER_OF_SEGMENT_FILES	5000
+
+/* The number of times each glob function is run
+ */
+#define EWF_BENCH_GLOB_NUMBER_OF_ITERATIONS	5
+
+/* The segment number of the segment file that is removed to create a gap
+ */
+#define EWF_BENCH_GLOB_GAP_SEGMENT_NUMBER	2500
+
+/* Sets the filename of a synthetic segment file, e.g. ewf_bench_glob.E01 or ewf_bench_glob.EAA
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_bench_glob_get_segment_filename(
+     uint32_t segment_number,
+     char *filename,
+     size_t filename_size )
+{
+	char extension[ 4 ];
+
+	int print_count = 0;
+
+	if( ( segment_number == 0 )
+	 || ( segment_number > EWF_BENCH_GLOB_NUMBER_OF_SEGMENT_FILES ) )
+	{
+		return( -1 );
+	}
+	/* Matches the segment file extension schema of EnCase 1 to 6 (E01 - E99, EAA - ZZZ)
+	 */
+	if( segment_number <= 99 )
+	{
+		extension[ 0 ] = 'E';
+		extension[ 1 ] = '0' + (char) ( segment_number / 10 );
+		extension[ 2 ] = '0' + (char) ( segment_number % 10 );
+	}
+	else
+	{
+		segment_number -= 100;
+		extension[ 2 ]  = 'A' + (char) ( segment_number % 26 );
+		segment_number /= 26;
+		extension[ 1 ]  = 'A' + (char) ( segment_number % 26 );
+		segment_number /= 26;
+		extension[ 0 ]  = 'E' + (char) segment_number;
+	}
+	extension[ 3 ] = 0;
+
+	print_count = narrow_string_snprintf(
+	               filename,
+	               filename_size,
+	               "%s.%s",
+	               EWF_BENCH_GLOB_BASENAME,
+	               extension );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= filename_size ) )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates or removes the synthetic segment files
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_bench_glob_create_segment_files(
+     uint8_t remove_files )
+{
+	char filename[ 32 ];
+
+	FILE *file_stream       = NULL;
+	uint32_t segment_number = 0;
+
+	for( segment_number = 1;
+	     segment_number <= EWF_BENCH_GLOB_NUMBER_OF_SEGMENT_FILES;
+	     segment_number++ )
+	{
+		if( ewf_bench_glob_get_segment_filename(
+		     segment_number,
+		     filename,
+		     32 ) != 1 )
+		{
+			return( -1 );
+		}
+		if( remove_files != 0 )
+		{
+			/* The gap segment file might already have been removed
+			 */
+			remove(
+			 filename );
+
+			continue;
+		}
+		file_stream = file_stream_open(
+		               filename,
+		               "wb" );
+
+		if( file_stream == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create segment file: %s.\n",
+			 filename );
+
+			return( -1 );
+		}
+		file_stream_close(
+		 file_stream );
+	}
+	return( 1 );
+}
+
+/* Globs the synthetic segment files and prints the average time
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_bench_glob_run(
+     const char *name,
+     int (*glob_function)(
+            const char *filename,
+            size_t filename_length,
+            uint8_t format,
+            char ***filenames,
+            int *number_of_filenames,
+            libcerror_error_t **error ),
+     int expected_number_of_filenames,
+     libcerror_error_t **error )
+{
+	char **filenames        = NULL;
+	double end_time         = 0.0;
+	double start_time       = 0.0;
+	int iteration           = 0;
+	int number_of_filenames = 0;
+
+	start_time = ewf_bench_timer_get_seconds();
+
+	for( iteration = 0;
+	     iteration < EWF_BENCH_GLOB_NUMBER_OF_ITERATIONS;
+	     iteration++ )
+	{
+		if( glob_function(
+		     EWF_BENCH_GLOB_BASENAME ".E01",
+		     narrow_string_length(
+		      EWF_BENCH_GLOB_BASENAME ".E01" ),
+		     LIBEWF_FORMAT_UNKNOWN,
+		     &filenames,
+		     &number_of_filenames,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libewf_glob_free(
+		     filenames,
+		     number_of_filenames,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		filenames = NULL;
+
+		if( number_of_filenames != expected_number_of_filenames )
+		{
+			fprintf(
+			 stderr,
+			 "%s: found %d segment files, expected %d.\n",
+			 name,
+			 number_of_filenames,
+			 expected_number_of_filenames );
+
+			return( -1 );
+		}
+	}
+	end_time = ewf_bench_timer_get_seconds();
+
+	fprintf(
+	 stdout,
+	 "%-28s %10.3f ms\n",
+	 name,
+	 ( ( end_time - start_time ) * 1000.0 ) / EWF_BENCH_GLOB_NUMBER_OF_ITERATIONS );
+
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	char filename[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	char **filenames         = NULL;
+	int number_of_filenames  = 0;
+	int result               = 0;
+
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	if( ewf_bench_glob_create_segment_files(
+	     0 ) != 1 )
+	{
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Number of segment files\t: %d\n\n",
+	 EWF_BENCH_GLOB_NUMBER_OF_SEGMENT_FILES );
+
+	if( ewf_bench_glob_run(
+	     "libewf_glob",
+	     (int (*)(const char *, size_t, uint8_t, char ***, int *, libcerror_error_t **)) &libewf_glob,
+	     EWF_BENCH_GLOB_NUMBER_OF_SEGMENT_FILES,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ewf_bench_glob_run(
+	     "libewf_glob_scan_directory",
+	     (int (*)(const char *, size_t, uint8_t, char ***, int *, libcerror_error_t **)) &libewf_glob_scan_directory,
+	     EWF_BENCH_GLOB_NUMBER_OF_SEGMENT_FILES,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Remove a segment file in the middle of the set, libewf_glob stops at the gap
+	 * while libewf_glob_scan_directory reports it
+	 */
+	if( ewf_bench_glob_get_segment_filename(
+	     EWF_BENCH_GLOB_GAP_SEGMENT_NUMBER,
+	     filename,
+	     32 ) != 1 )
+	{
+		goto on_error;
+	}
+	if( remove(
+	     filename ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to remove segment file: %s.\n",
+		 filename );
+
+		goto on_error;
+	}
+	if( ewf_bench_glob_run(
+	     "libewf_glob (gap)",
+	     (int (*)(const char *, size_t, uint8_t, char ***, int *, libcerror_error_t **)) &libewf_glob,
+	     EWF_BENCH_GLOB_GAP_SEGMENT_NUMBER - 1,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	result = libewf_glob_scan_directory(
+	          EWF_BENCH_GLOB_BASENAME ".E01",
+	          narrow_string_length(
+	           EWF_BENCH_GLOB_BASENAME ".E01" ),
+	          LIBEWF_FORMAT_UNKNOWN,
+	          &filenames,
+	          &number_of_filenames,
+	          &error );
+
+	if( result != -1 )
+	{
+		fprintf(
+		 stderr,
+		 "libewf_glob_scan_directory did not report the gap at segment file: %s.\n",
+		 filename );
+
+		if( result == 1 )
+		{
+			libewf_glob_free(
+			 filenames,
+			 number_of_filenames,
+			 NULL );
+		}
+		goto on_error;
+	}
+	libcerror_error_free(
+	 &error );
+
+	fprintf(
+	 stdout,
+	 "\nGap at %s\t: reported by libewf_glob_scan_directory\n",
+	 filename );
+
+	if( ewf_bench_glob_create_segment_files(
+	     1 ) != 1 )
+	{
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	ewf_bench_glob_create_segment_files(
+	 1 );
+
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,377 @@
+/*
+ * Raw output positional write scaling benchmark program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "ewf_bench_timer.h"
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libcthreads.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_unused.h"
+
+#include "../ewftools/export_handle.h"
+#include "../ewftools/storage_media_buffer.h"
+
+/* The raw output is created in the current working directory
+ * so the benchmark can be run on a different file system by changing into it
+ */
+#define EWF_BENCH_RAW_OUTPUT_BASENAME			"ewf_bench_raw_output"
+
+/* The size of a storage media buffer
+ */
+#define EWF_BENCH_RAW_OUTPUT_BUFFER_SIZE		( 1024 * 1024 )
+
+/* The number of storage media buffers written per run
+ */
+#define EWF_BENCH_RAW_OUTPUT_NUMBER_OF_BUFFERS		256
+
+/* The maximum number of writer threads
+ */
+#define EWF_BENCH_RAW_OUTPUT_MAXIMUM_NUMBER_OF_THREADS	8
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Value to indicate a write of a writer thread failed
+ */
+static int ewf_bench_raw_output_write_failed = 0;
+
+/* Writes a storage media buffer at its offset from a writer thread
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_bench_raw_output_write_callback(
+     storage_media_buffer_t *storage_media_buffer,
+     export_handle_t *export_handle )
+{
+	ssize_t write_count = 0;
+
+	write_count = export_handle_write_storage_media_buffer_at_offset(
+	               export_handle,
+	               storage_media_buffer,
+	               NULL );
+
+	if( write_count != (ssize_t) storage_media_buffer->processed_size )
+	{
+		ewf_bench_raw_output_write_failed = 1;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the storage media buffers out of order with a specific number of writer threads
+ * and prints the throughput if requested
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_bench_raw_output_run(
+     storage_media_buffer_t **storage_media_buffers,
+     int number_of_threads,
+     int print_throughput,
+     double *single_thread_seconds,
+     libcerror_error_t **error )
+{
+	export_handle_t *export_handle         = NULL;
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	const char *write_method               = NULL;
+	double end_time                        = 0.0;
+	double seconds                         = 0.0;
+	double start_time                      = 0.0;
+	int buffer_index                       = 0;
+
+	if( export_handle_initialize(
+	     &export_handle,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	export_handle->export_size = (size64_t) EWF_BENCH_RAW_OUTPUT_NUMBER_OF_BUFFERS * EWF_BENCH_RAW_OUTPUT_BUFFER_SIZE;
+
+	if( export_handle_open_output(
+	     export_handle,
+	     _SYSTEM_STRING( EWF_BENCH_RAW_OUTPUT_BASENAME ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( export_handle->raw_output_file_descriptor != -1 )
+	{
+		write_method = "pwrite";
+	}
+	else
+	{
+		write_method = "libsmraw";
+	}
+	ewf_bench_raw_output_write_failed = 0;
+
+	start_time = ewf_bench_timer_get_seconds();
+
+	if( libcthreads_thread_pool_create(
+	     &thread_pool,
+	     NULL,
+	     number_of_threads,
+	     EWF_BENCH_RAW_OUTPUT_NUMBER_OF_BUFFERS,
+	     (int (*)(intptr_t *, void *)) &ewf_bench_raw_output_write_callback,
+	     (void *) export_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( buffer_index = 0;
+	     buffer_index < EWF_BENCH_RAW_OUTPUT_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( libcthreads_thread_pool_push(
+		     thread_pool,
+		     (intptr_t *) storage_media_buffers[ buffer_index ],
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libcthreads_thread_pool_join(
+	     &thread_pool,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	end_time = ewf_bench_timer_get_seconds();
+
+	if( ewf_bench_raw_output_write_failed != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write storage media buffer.\n" );
+
+		goto on_error;
+	}
+	/* The input handle is not opened, hence the raw output is closed when freeing the export handle
+	 */
+	if( export_handle_free(
+	     &export_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	seconds = end_time - start_time;
+
+	if( seconds <= 0.0 )
+	{
+		seconds = 0.000001;
+	}
+	if( print_throughput == 0 )
+	{
+		return( 1 );
+	}
+	if( number_of_threads == 1 )
+	{
+		*single_thread_seconds = seconds;
+	}
+	fprintf(
+	 stdout,
+	 "%-8s %2d thread(s) %10.1f MiB/s %6.2fx\n",
+	 write_method,
+	 number_of_threads,
+	 ( (double) EWF_BENCH_RAW_OUTPUT_NUMBER_OF_BUFFERS * EWF_BENCH_RAW_OUTPUT_BUFFER_SIZE ) / ( seconds * 1024.0 * 1024.0 ),
+	 *single_thread_seconds / seconds );
+
+	return( 1 );
+
+on_error:
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( export_handle != NULL )
+	{
+		export_handle_free(
+		 &export_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	storage_media_buffer_t *storage_media_buffers[ EWF_BENCH_RAW_OUTPUT_NUMBER_OF_BUFFERS ];
+
+	libcerror_error_t *error     = NULL;
+	double single_thread_seconds = 0.0;
+	int buffer_index             = 0;
+	int number_of_threads        = 0;
+#endif
+
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( memory_set(
+	     storage_media_buffers,
+	     0,
+	     sizeof( storage_media_buffer_t * ) * EWF_BENCH_RAW_OUTPUT_NUMBER_OF_BUFFERS ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear storage media buffers.\n" );
+
+		goto on_error;
+	}
+	/* The storage media buffers are written in reverse order to make the writes out of order
+	 */
+	for( buffer_index = 0;
+	     buffer_index < EWF_BENCH_RAW_OUTPUT_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( storage_media_buffer_initialize(
+		     &( storage_media_buffers[ buffer_index ] ),
+		     NULL,
+		     STORAGE_MEDIA_BUFFER_MODE_BUFFERED,
+		     EWF_BENCH_RAW_OUTPUT_BUFFER_SIZE,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( memory_set(
+		     storage_media_buffers[ buffer_index ]->raw_buffer,
+		     1 + ( buffer_index % 255 ),
+		     EWF_BENCH_RAW_OUTPUT_BUFFER_SIZE ) == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set storage media buffer data.\n" );
+
+			goto on_error;
+		}
+		storage_media_buffers[ buffer_index ]->storage_media_offset = (off64_t) ( EWF_BENCH_RAW_OUTPUT_NUMBER_OF_BUFFERS - 1 - buffer_index ) * EWF_BENCH_RAW_OUTPUT_BUFFER_SIZE;
+		storage_media_buffers[ buffer_index ]->raw_buffer_data_size = EWF_BENCH_RAW_OUTPUT_BUFFER_SIZE;
+		storage_media_buffers[ buffer_index ]->processed_size       = EWF_BENCH_RAW_OUTPUT_BUFFER_SIZE;
+	}
+	fprintf(
+	 stdout,
+	 "Raw output size\t: %d MiB\n\n",
+	 ( EWF_BENCH_RAW_OUTPUT_NUMBER_OF_BUFFERS * EWF_BENCH_RAW_OUTPUT_BUFFER_SIZE ) / ( 1024 * 1024 ) );
+
+	/* Do a warm-up run that is not reported so the single thread run
+	 * does not include allocating the raw output in the file system
+	 */
+	if( ewf_bench_raw_output_run(
+	     storage_media_buffers,
+	     1,
+	     0,
+	     &single_thread_seconds,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( number_of_threads = 1;
+	     number_of_threads <= EWF_BENCH_RAW_OUTPUT_MAXIMUM_NUMBER_OF_THREADS;
+	     number_of_threads *= 2 )
+	{
+		if( ewf_bench_raw_output_run(
+		     storage_media_buffers,
+		     number_of_threads,
+		     1,
+		     &single_thread_seconds,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	for( buffer_index = 0;
+	     buffer_index < EWF_BENCH_RAW_OUTPUT_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( storage_media_buffer_free(
+		     &( storage_media_buffers[ buffer_index ] ),
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	remove(
+	 EWF_BENCH_RAW_OUTPUT_BASENAME ".raw" );
+	remove(
+	 EWF_BENCH_RAW_OUTPUT_BASENAME ".raw.info" );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	for( buffer_index = 0;
+	     buffer_index < EWF_BENCH_RAW_OUTPUT_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( storage_media_buffers[ buffer_index ] != NULL )
+		{
+			storage_media_buffer_free(
+			 &( storage_media_buffers[ buffer_index ] ),
+			 NULL );
+		}
+	}
+	remove(
+	 EWF_BENCH_RAW_OUTPUT_BASENAME ".raw" );
+	remove(
+	 EWF_BENCH_RAW_OUTPUT_BASENAME ".raw.info" );
+
+	return( EXIT_FAILURE );
+#else
+	fprintf(
+	 stdout,
+	 "Multi-threading not supported.\n" );
+
+	return( EXIT_SUCCESS );
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+}
+
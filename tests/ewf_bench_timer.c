@@ -0,0 +1,63 @@
+/*
+ * Benchmark timer functions
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+#endif
+
+#include <time.h>
+
+#include "ewf_bench_timer.h"
+
+/* Retrieves the elapsed (wall clock) time in seconds
+ * The value is only meaningful relative to another value returned by this function
+ * Falls back to the processor time if no monotonic clock is available
+ */
+double ewf_bench_timer_get_seconds(
+        void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) != 0 )
+	 && ( QueryPerformanceCounter(
+	       &counter ) != 0 ) )
+	{
+		return( (double) counter.QuadPart / (double) frequency.QuadPart );
+	}
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_structure;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_structure ) == 0 )
+	{
+		return( (double) time_structure.tv_sec + ( (double) time_structure.tv_nsec / 1000000000.0 ) );
+	}
+#endif
+	return( (double) clock() / CLOCKS_PER_SEC );
+}
+
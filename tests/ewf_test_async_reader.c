@@ -0,0 +1,730 @@
+/*
+ * Library async_reader type test program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_async_reader.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* Completion callback that is not expected to be called
+ */
+void ewf_test_async_reader_callback(
+      libewf_handle_t *handle EWF_TEST_ATTRIBUTE_UNUSED,
+      off64_t offset EWF_TEST_ATTRIBUTE_UNUSED,
+      void *buffer EWF_TEST_ATTRIBUTE_UNUSED,
+      ssize_t read_count EWF_TEST_ATTRIBUTE_UNUSED,
+      int result EWF_TEST_ATTRIBUTE_UNUSED,
+      void *callback_data )
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( handle )
+	EWF_TEST_UNREFERENCED_PARAMETER( offset )
+	EWF_TEST_UNREFERENCED_PARAMETER( buffer )
+	EWF_TEST_UNREFERENCED_PARAMETER( read_count )
+	EWF_TEST_UNREFERENCED_PARAMETER( result )
+
+	if( callback_data != NULL )
+	{
+		*( (int *) callback_data ) += 1;
+	}
+}
+
+/* Tests the libewf_async_reader_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_async_reader_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libewf_async_reader_t *async_reader     = NULL;
+	libewf_handle_t *handle                 = (libewf_handle_t *) 0x12345678UL;
+	int result                              = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 3;
+	int number_of_memset_fail_tests         = 2;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libewf_async_reader_initialize(
+	          &async_reader,
+	          handle,
+	          0,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "async_reader",
+	 async_reader );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_async_reader_free(
+	          &async_reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "async_reader",
+	 async_reader );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_async_reader_initialize(
+	          NULL,
+	          handle,
+	          0,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	async_reader = (libewf_async_reader_t *) 0x12345678UL;
+
+	result = libewf_async_reader_initialize(
+	          &async_reader,
+	          handle,
+	          0,
+	          4,
+	          &error );
+
+	async_reader = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_async_reader_initialize(
+	          &async_reader,
+	          NULL,
+	          0,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_async_reader_initialize(
+	          &async_reader,
+	          handle,
+	          -1,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_async_reader_initialize(
+	          &async_reader,
+	          handle,
+	          0,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_async_reader_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = libewf_async_reader_initialize(
+		          &async_reader,
+		          handle,
+		          0,
+		          4,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( async_reader != NULL )
+			{
+				libewf_async_reader_free(
+				 &async_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "async_reader",
+			 async_reader );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_async_reader_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = libewf_async_reader_initialize(
+		          &async_reader,
+		          handle,
+		          0,
+		          4,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( async_reader != NULL )
+			{
+				libewf_async_reader_free(
+				 &async_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "async_reader",
+			 async_reader );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( async_reader != NULL )
+	{
+		libewf_async_reader_free(
+		 &async_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_async_reader_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_async_reader_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_async_reader_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_async_reader_push_request function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_async_reader_push_request(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error                = NULL;
+	libewf_async_reader_t *async_reader     = NULL;
+	libewf_handle_t *handle                 = (libewf_handle_t *) 0x12345678UL;
+	int result                              = 0;
+	int number_of_callbacks                 = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_async_reader_initialize(
+	          &async_reader,
+	          handle,
+	          0,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "async_reader",
+	 async_reader );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test push with the maximum number of requests in flight
+	 */
+	async_reader->number_of_requests = async_reader->maximum_number_of_requests;
+
+	result = libewf_async_reader_push_request(
+	          async_reader,
+	          0,
+	          buffer,
+	          16,
+	          &ewf_test_async_reader_callback,
+	          &number_of_callbacks,
+	          &error );
+
+	async_reader->number_of_requests = 0;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_callbacks",
+	 number_of_callbacks,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_async_reader_push_request(
+	          NULL,
+	          0,
+	          buffer,
+	          16,
+	          &ewf_test_async_reader_callback,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_async_reader_push_request(
+	          async_reader,
+	          -1,
+	          buffer,
+	          16,
+	          &ewf_test_async_reader_callback,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_async_reader_push_request(
+	          async_reader,
+	          0,
+	          NULL,
+	          16,
+	          &ewf_test_async_reader_callback,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_async_reader_push_request(
+	          async_reader,
+	          0,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          &ewf_test_async_reader_callback,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_async_reader_push_request(
+	          async_reader,
+	          0,
+	          buffer,
+	          16,
+	          NULL,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_async_reader_free(
+	          &async_reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "async_reader",
+	 async_reader );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( async_reader != NULL )
+	{
+		libewf_async_reader_free(
+		 &async_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_async_reader_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_async_reader_signal_abort(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libewf_async_reader_t *async_reader     = NULL;
+	libewf_handle_t *handle                 = (libewf_handle_t *) 0x12345678UL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_async_reader_initialize(
+	          &async_reader,
+	          handle,
+	          0,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "async_reader",
+	 async_reader );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_async_reader_signal_abort(
+	          async_reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "abort_generation",
+	 async_reader->abort_generation,
+	 (uint32_t) 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_async_reader_signal_abort(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_async_reader_free(
+	          &async_reader,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "async_reader",
+	 async_reader );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( async_reader != NULL )
+	{
+		libewf_async_reader_free(
+		 &async_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_async_reader_initialize",
+	 ewf_test_async_reader_initialize );
+
+	EWF_TEST_RUN(
+	 "libewf_async_reader_free",
+	 ewf_test_async_reader_free );
+
+	EWF_TEST_RUN(
+	 "libewf_async_reader_push_request",
+	 ewf_test_async_reader_push_request );
+
+	EWF_TEST_RUN(
+	 "libewf_async_reader_signal_abort",
+	 ewf_test_async_reader_signal_abort );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+}
+
@@ -61,6 +61,7 @@ int ewf_test_bit_stream_initialize(
 	          &bit_stream,
 	          ewf_test_bit_stream_data1,
 	          16,
+	          LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -99,6 +100,7 @@ int ewf_test_bit_stream_initialize(
 	          NULL,
 	          ewf_test_bit_stream_data1,
 	          16,
+	          LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -119,6 +121,7 @@ int ewf_test_bit_stream_initialize(
 	          &bit_stream,
 	          ewf_test_bit_stream_data1,
 	          16,
+	          LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	bit_stream = NULL;
@@ -139,6 +142,7 @@ int ewf_test_bit_stream_initialize(
 	          &bit_stream,
 	          NULL,
 	          16,
+	          LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -157,6 +161,26 @@ int ewf_test_bit_stream_initialize(
 	          &bit_stream,
 	          ewf_test_bit_stream_data1,
 	          (size_t) SSIZE_MAX + 1,
+	          LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_bit_stream_initialize(
+	          &bit_stream,
+	          ewf_test_bit_stream_data1,
+	          16,
+	          0xff,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -181,6 +205,7 @@ int ewf_test_bit_stream_initialize(
 	          &bit_stream,
 	          ewf_test_bit_stream_data1,
 	          16,
+	          LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	if( ewf_test_malloc_attempts_before_fail != -1 )
@@ -220,6 +245,7 @@ int ewf_test_bit_stream_initialize(
 	          &bit_stream,
 	          ewf_test_bit_stream_data1,
 	          16,
+	          LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	if( ewf_test_memset_attempts_before_fail != -1 )
@@ -324,6 +350,7 @@ int ewf_test_bit_stream_read(
 	          &bit_stream,
 	          ewf_test_bit_stream_data1,
 	          16,
+	          LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -711,6 +738,133 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_bit_stream_get_value function with a front to back storage type
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_bit_stream_get_value_front_to_back(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libewf_bit_stream_t *bit_stream = NULL;
+	uint32_t value_32bit            = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_bit_stream_initialize(
+	          &bit_stream,
+	          ewf_test_bit_stream_data1,
+	          16,
+	          LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_bit_stream_get_value(
+	          bit_stream,
+	          4,
+	          &value_32bit,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x00000007UL );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_bit_stream_get_value(
+	          bit_stream,
+	          12,
+	          &value_32bit,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x000008daUL );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_bit_stream_get_value(
+	          bit_stream,
+	          32,
+	          &value_32bit,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0xbd596d8fUL );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libewf_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream != NULL )
+	{
+		libewf_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
 
 /* The main program
@@ -758,6 +912,10 @@ int main(
 	 "libewf_bit_stream_read",
 	 ewf_test_bit_stream_read );
 
+	EWF_TEST_RUN(
+	 "libewf_bit_stream_get_value_front_to_back",
+	 ewf_test_bit_stream_get_value_front_to_back );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize bit_stream for tests
@@ -766,6 +924,7 @@ int main(
 	          &bit_stream,
 	          ewf_test_bit_stream_data1,
 	          16,
+	          LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -0,0 +1,1060 @@
+/*
+ * Library block_hashes type test program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_functions.h"
+#include "ewf_test_libbfio.h"
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_block_hashes.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+uint8_t ewf_test_block_hashes_data[ 5 ] = {
+	'a', 'b', 'c', 'd', 'e' };
+
+uint8_t ewf_test_block_hashes_md5_hash1[ 16 ] = {
+	0xe2, 0xfc, 0x71, 0x4c, 0x47, 0x27, 0xee, 0x93, 0x95, 0xf3, 0x24, 0xcd, 0x2e, 0x7f, 0x33, 0x1f };
+
+uint8_t ewf_test_block_hashes_md5_hash2[ 16 ] = {
+	0xe1, 0x67, 0x17, 0x97, 0xc5, 0x2e, 0x15, 0xf7, 0x63, 0x38, 0x0b, 0x45, 0xe8, 0x41, 0xec, 0x32 };
+
+/* Creates block hashes of the test data using 1-byte chunks and 4 chunks per block
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_block_hashes_create(
+     libewf_block_hashes_t **block_hashes,
+     libcerror_error_t **error )
+{
+	int chunk_index = 0;
+
+	if( libewf_block_hashes_initialize(
+	     block_hashes,
+	     4,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < 5;
+	     chunk_index++ )
+	{
+		if( libewf_block_hashes_append_chunk(
+		     *block_hashes,
+		     &( ewf_test_block_hashes_data[ chunk_index ] ),
+		     1,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libewf_block_hashes_finalize(
+	     *block_hashes,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( *block_hashes )->chunk_size = 1;
+
+	return( 1 );
+
+on_error:
+	libewf_block_hashes_free(
+	 block_hashes,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libewf_block_hashes_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_block_hashes_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libewf_block_hashes_t *block_hashes = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 1;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libewf_block_hashes_initialize(
+	          &block_hashes,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "block_hashes",
+	 block_hashes );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_block_hashes_free(
+	          &block_hashes,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "block_hashes",
+	 block_hashes );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_block_hashes_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_hashes = (libewf_block_hashes_t *) 0x12345678UL;
+
+	result = libewf_block_hashes_initialize(
+	          &block_hashes,
+	          16,
+	          &error );
+
+	block_hashes = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_block_hashes_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = libewf_block_hashes_initialize(
+		          &block_hashes,
+		          16,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( block_hashes != NULL )
+			{
+				libewf_block_hashes_free(
+				 &block_hashes,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "block_hashes",
+			 block_hashes );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_block_hashes_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = libewf_block_hashes_initialize(
+		          &block_hashes,
+		          16,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( block_hashes != NULL )
+			{
+				libewf_block_hashes_free(
+				 &block_hashes,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "block_hashes",
+			 block_hashes );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_hashes != NULL )
+	{
+		libewf_block_hashes_free(
+		 &block_hashes,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_block_hashes_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_block_hashes_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_block_hashes_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_block_hashes_append_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_block_hashes_append_chunk(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libewf_block_hashes_t *block_hashes = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_block_hashes_initialize(
+	          &block_hashes,
+	          4,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "block_hashes",
+	 block_hashes );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_block_hashes_append_chunk(
+	          block_hashes,
+	          ewf_test_block_hashes_data,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_block_hashes_append_chunk(
+	          NULL,
+	          ewf_test_block_hashes_data,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_block_hashes_append_chunk(
+	          block_hashes,
+	          NULL,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_block_hashes_append_chunk(
+	          block_hashes,
+	          ewf_test_block_hashes_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_block_hashes_free(
+	          &block_hashes,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "block_hashes",
+	 block_hashes );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_hashes != NULL )
+	{
+		libewf_block_hashes_free(
+		 &block_hashes,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_block_hashes_get_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_block_hashes_get_hash(
+     void )
+{
+	uint8_t hash[ 16 ];
+
+	libcerror_error_t *error            = NULL;
+	libewf_block_hashes_t *block_hashes = NULL;
+	uint64_t number_of_hashes           = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = ewf_test_block_hashes_create(
+	          &block_hashes,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "block_hashes",
+	 block_hashes );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_block_hashes_get_number_of_hashes(
+	          block_hashes,
+	          &number_of_hashes,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hashes",
+	 number_of_hashes,
+	 (uint64_t) 2 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_block_hashes_get_hash(
+	          block_hashes,
+	          0,
+	          hash,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_block_hashes_md5_hash1,
+	          16 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libewf_block_hashes_get_hash(
+	          block_hashes,
+	          1,
+	          hash,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_block_hashes_md5_hash2,
+	          16 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_block_hashes_get_hash(
+	          NULL,
+	          0,
+	          hash,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_block_hashes_get_hash(
+	          block_hashes,
+	          2,
+	          hash,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_block_hashes_get_hash(
+	          block_hashes,
+	          0,
+	          NULL,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_block_hashes_get_hash(
+	          block_hashes,
+	          0,
+	          hash,
+	          8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_block_hashes_free(
+	          &block_hashes,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "block_hashes",
+	 block_hashes );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_hashes != NULL )
+	{
+		libewf_block_hashes_free(
+		 &block_hashes,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_block_hashes_write_file_io_handle and libewf_block_hashes_read_file_io_handle functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_block_hashes_write_read_file_io_handle(
+     void )
+{
+	uint8_t file_data[ 100 ];
+	uint8_t hash[ 16 ];
+
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libewf_block_hashes_t *block_hashes      = NULL;
+	libewf_block_hashes_t *read_block_hashes = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = ewf_test_block_hashes_create(
+	          &block_hashes,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "block_hashes",
+	 block_hashes );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          100,
+	          LIBBFIO_OPEN_WRITE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_block_hashes_write_file_io_handle(
+	          block_hashes,
+	          file_io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          100,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_block_hashes_initialize(
+	          &read_block_hashes,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_block_hashes",
+	 read_block_hashes );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_block_hashes_read_file_io_handle(
+	          read_block_hashes,
+	          file_io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "read_block_hashes->number_of_chunks_per_block",
+	 read_block_hashes->number_of_chunks_per_block,
+	 (uint32_t) 4 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "read_block_hashes->media_size",
+	 (uint64_t) read_block_hashes->media_size,
+	 (uint64_t) 5 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "read_block_hashes->number_of_hashes",
+	 read_block_hashes->number_of_hashes,
+	 (uint64_t) 2 );
+
+	result = libewf_block_hashes_get_hash(
+	          read_block_hashes,
+	          1,
+	          hash,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_block_hashes_md5_hash2,
+	          16 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_block_hashes_read_file_io_handle(
+	          read_block_hashes,
+	          file_io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_block_hashes_free(
+	          &read_block_hashes,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read with a corrupted hash
+	 */
+	file_data[ 64 ] ^= 0xff;
+
+	result = libewf_block_hashes_initialize(
+	          &read_block_hashes,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_block_hashes_read_file_io_handle(
+	          read_block_hashes,
+	          file_io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_block_hashes_free(
+	          &read_block_hashes,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_block_hashes_free(
+	          &block_hashes,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_block_hashes != NULL )
+	{
+		libewf_block_hashes_free(
+		 &read_block_hashes,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( block_hashes != NULL )
+	{
+		libewf_block_hashes_free(
+		 &block_hashes,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_block_hashes_initialize",
+	 ewf_test_block_hashes_initialize );
+
+	EWF_TEST_RUN(
+	 "libewf_block_hashes_free",
+	 ewf_test_block_hashes_free );
+
+	/* TODO: add tests for libewf_block_hashes_clone */
+
+	EWF_TEST_RUN(
+	 "libewf_block_hashes_append_chunk",
+	 ewf_test_block_hashes_append_chunk );
+
+	EWF_TEST_RUN(
+	 "libewf_block_hashes_get_hash",
+	 ewf_test_block_hashes_get_hash );
+
+	EWF_TEST_RUN(
+	 "libewf_block_hashes_write_file_io_handle",
+	 ewf_test_block_hashes_write_read_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+}
+
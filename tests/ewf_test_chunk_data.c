@@ -40,6 +40,7 @@
 
 #include "../libewf/libewf_chunk_data.h"
 #include "../libewf/libewf_definitions.h"
+#include "../libewf/libewf_encryption_context.h"
 #include "../libewf/libewf_io_handle.h"
 
 uint8_t ewf_test_chunk_data_deflate_compressed_data1[ 52 ] = {
@@ -58,6 +59,17 @@ uint8_t ewf_test_chunk_data_deflate_uncompressed_data1[ 68 ] = {
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x01, 0x00, 0x40, 0x00 };
 
+/* AES-128 test vector from FIPS-197 appendix C.1
+ */
+uint8_t ewf_test_chunk_data_encryption_key[ 16 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+uint8_t ewf_test_chunk_data_encrypted_data1[ 16 ] = {
+	0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a };
+
+uint8_t ewf_test_chunk_data_decrypted_data1[ 16 ] = {
+	0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff };
+
 #if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
 
 /* Tests the libewf_chunk_data_initialize function
@@ -2024,6 +2036,173 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_chunk_data_pack_add_alignment_padding function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_data_pack_add_alignment_padding(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libewf_chunk_data_t *chunk_data = NULL;
+	uint8_t *data                   = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_chunk_data_initialize(
+	          &chunk_data,
+	          512,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_data",
+	 chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	chunk_data->data_size = 68;
+
+	result = libewf_chunk_data_pack_add_alignment_padding(
+	          chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_data->padding_size",
+	 chunk_data->padding_size,
+	 (size_t) 12 );
+
+	chunk_data->data_size = 64;
+
+	result = libewf_chunk_data_pack_add_alignment_padding(
+	          chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_data->padding_size",
+	 chunk_data->padding_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_chunk_data_pack_add_alignment_padding(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data             = chunk_data->data;
+	chunk_data->data = NULL;
+
+	result = libewf_chunk_data_pack_add_alignment_padding(
+	          chunk_data,
+	          &error );
+
+	chunk_data->data = data;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_data->data_size = chunk_data->allocated_data_size + 1;
+
+	result = libewf_chunk_data_pack_add_alignment_padding(
+	          chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_chunk_data_free(
+	          &chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "chunk_data",
+	 chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &chunk_data,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libewf_chunk_data_pack function
  * Returns 1 if successful or 0 if not
  */
@@ -2707,24 +2886,26 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libewf_chunk_data_unpack function
+/* Tests the libewf_chunk_data_decrypt function
  * Returns 1 if successful or 0 if not
  */
-int ewf_test_chunk_data_unpack(
+int ewf_test_chunk_data_decrypt(
      void )
 {
-	libcerror_error_t *error        = NULL;
-	libewf_chunk_data_t *chunk_data = NULL;
-	libewf_io_handle_t *io_handle   = NULL;
-	uint8_t *data                   = NULL;
-	void *memcpy_result             = NULL;
-	uint32_t expected_range_flags   = 0;
-	int result                      = 0;
+	libcerror_error_t *error                        = NULL;
+	libewf_chunk_data_t *chunk_data                 = NULL;
+	libewf_encryption_context_t *encryption_context = NULL;
+	libewf_io_handle_t *io_handle                   = NULL;
+	void *memcpy_result                             = NULL;
+	uint32_t expected_range_flags                   = 0;
+	int result                                      = 0;
 
 	/* Initialize test
 	 */
-	result = libewf_io_handle_initialize(
-	          &io_handle,
+	result = libewf_encryption_context_initialize(
+	          &encryption_context,
+	          ewf_test_chunk_data_encryption_key,
+	          16,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2733,15 +2914,13 @@ int ewf_test_chunk_data_unpack(
 	 1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "io_handle",
-	 io_handle );
+	 "encryption_context",
+	 encryption_context );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	io_handle->zero_on_error = 1;
-
 	result = libewf_chunk_data_initialize(
 	          &chunk_data,
 	          512,
@@ -2761,15 +2940,23 @@ int ewf_test_chunk_data_unpack(
 	 "error",
 	 error );
 
-	chunk_data->data_size = 512;
-
 	/* Test regular cases
 	 */
-	chunk_data->range_flags = 0;
+	memcpy_result = memory_copy(
+	                 chunk_data->data,
+	                 ewf_test_chunk_data_encrypted_data1,
+	                 16 );
 
-	result = libewf_chunk_data_unpack(
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	chunk_data->data_size   = 16;
+	chunk_data->range_flags = LIBEWF_RANGE_FLAG_IS_PACKED | LIBEWF_RANGE_FLAG_IS_ENCRYPTED;
+
+	result = libewf_chunk_data_decrypt(
 	          chunk_data,
-	          io_handle,
+	          encryption_context,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -2781,104 +2968,387 @@ int ewf_test_chunk_data_unpack(
 	 "error",
 	 error );
 
-	expected_range_flags = 0;
+	expected_range_flags = LIBEWF_RANGE_FLAG_IS_PACKED;
 
 	EWF_TEST_ASSERT_EQUAL_UINT32(
 	 "chunk_data->range_flags",
 	 chunk_data->range_flags,
 	 expected_range_flags );
 
-	EWF_TEST_ASSERT_EQUAL_SIZE(
-	 "chunk_data->data_size",
-	 chunk_data->data_size,
-	 (size_t) 512 );
-
-	memcpy_result = memory_copy(
-	                 chunk_data->data,
-	                 ewf_test_chunk_data_deflate_uncompressed_data1,
-	                 68 );
+	result = memory_compare(
+	          chunk_data->data,
+	          ewf_test_chunk_data_decrypted_data1,
+	          16 );
 
-	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "memcpy_result",
-	 memcpy_result );
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	chunk_data->data_size   = 68;
-	chunk_data->range_flags = LIBEWF_RANGE_FLAG_IS_PACKED | LIBEWF_RANGE_FLAG_HAS_CHECKSUM;
+	/* Test chunk data with a size that is not a multiple of 16
+	 */
+	chunk_data->data_size   = 20;
+	chunk_data->range_flags = LIBEWF_RANGE_FLAG_IS_PACKED | LIBEWF_RANGE_FLAG_IS_ENCRYPTED;
 
-	result = libewf_chunk_data_unpack(
+	result = libewf_chunk_data_decrypt(
 	          chunk_data,
-	          io_handle,
+	          encryption_context,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	expected_range_flags = LIBEWF_RANGE_FLAG_HAS_CHECKSUM;
-
-	EWF_TEST_ASSERT_EQUAL_UINT32(
-	 "chunk_data->range_flags",
-	 chunk_data->range_flags,
-	 expected_range_flags );
-
-	EWF_TEST_ASSERT_EQUAL_SIZE(
-	 "chunk_data->data_size",
-	 chunk_data->data_size,
-	 (size_t) 64 );
-
-	/* Clean up
+	/* Test error cases
 	 */
-	result = libewf_chunk_data_free(
-	          &chunk_data,
+	result = libewf_chunk_data_decrypt(
+	          NULL,
+	          encryption_context,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	EWF_TEST_ASSERT_IS_NULL(
-	 "chunk_data",
-	 chunk_data );
+	 -1 );
 
-	EWF_TEST_ASSERT_IS_NULL(
+	EWF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Initialize test
-	 */
-	result = libewf_chunk_data_initialize(
-	          &chunk_data,
-	          512,
-	          1,
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_chunk_data_decrypt(
+	          chunk_data,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "chunk_data",
-	 chunk_data );
-
-	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	chunk_data->data_size = 512;
+	libcerror_error_free(
+	 &error );
 
-	/* Test regular case where checksum is invalid
+	/* Test unpack of chunk data that cannot be decrypted
 	 */
-	memcpy_result = memory_copy(
-	                 chunk_data->data,
-	                 ewf_test_chunk_data_deflate_uncompressed_data1,
-	                 68 );
+	result = libewf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->encryption_context = encryption_context;
+	io_handle->zero_on_error      = 1;
+
+	chunk_data->data_size   = 20;
+	chunk_data->range_flags = LIBEWF_RANGE_FLAG_IS_PACKED | LIBEWF_RANGE_FLAG_HAS_CHECKSUM | LIBEWF_RANGE_FLAG_IS_ENCRYPTED;
+
+	result = libewf_chunk_data_unpack(
+	          chunk_data,
+	          io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_range_flags = LIBEWF_RANGE_FLAG_HAS_CHECKSUM | LIBEWF_RANGE_FLAG_IS_ENCRYPTED | LIBEWF_RANGE_FLAG_IS_CORRUPTED;
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_data->range_flags",
+	 chunk_data->range_flags,
+	 expected_range_flags );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_data->data_size",
+	 chunk_data->data_size,
+	 (size_t) 512 );
+
+	/* Clean up
+	 */
+	io_handle->encryption_context = NULL;
+
+	result = libewf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_chunk_data_free(
+	          &chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "chunk_data",
+	 chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		io_handle->encryption_context = NULL;
+
+		libewf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &chunk_data,
+		 NULL );
+	}
+	if( encryption_context != NULL )
+	{
+		libewf_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_chunk_data_unpack function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_data_unpack(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libewf_chunk_data_t *chunk_data = NULL;
+	libewf_io_handle_t *io_handle   = NULL;
+	uint8_t *data                   = NULL;
+	void *memcpy_result             = NULL;
+	uint32_t expected_range_flags   = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->zero_on_error = 1;
+
+	result = libewf_chunk_data_initialize(
+	          &chunk_data,
+	          512,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_data",
+	 chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	chunk_data->data_size = 512;
+
+	/* Test regular cases
+	 */
+	chunk_data->range_flags = 0;
+
+	result = libewf_chunk_data_unpack(
+	          chunk_data,
+	          io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_range_flags = 0;
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_data->range_flags",
+	 chunk_data->range_flags,
+	 expected_range_flags );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_data->data_size",
+	 chunk_data->data_size,
+	 (size_t) 512 );
+
+	memcpy_result = memory_copy(
+	                 chunk_data->data,
+	                 ewf_test_chunk_data_deflate_uncompressed_data1,
+	                 68 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	chunk_data->data_size   = 68;
+	chunk_data->range_flags = LIBEWF_RANGE_FLAG_IS_PACKED | LIBEWF_RANGE_FLAG_HAS_CHECKSUM;
+
+	result = libewf_chunk_data_unpack(
+	          chunk_data,
+	          io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_range_flags = LIBEWF_RANGE_FLAG_HAS_CHECKSUM;
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_data->range_flags",
+	 chunk_data->range_flags,
+	 expected_range_flags );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_data->data_size",
+	 chunk_data->data_size,
+	 (size_t) 64 );
+
+	/* Clean up
+	 */
+	result = libewf_chunk_data_free(
+	          &chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "chunk_data",
+	 chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libewf_chunk_data_initialize(
+	          &chunk_data,
+	          512,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_data",
+	 chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	chunk_data->data_size = 512;
+
+	/* Test regular case where checksum is invalid
+	 */
+	memcpy_result = memory_copy(
+	                 chunk_data->data,
+	                 ewf_test_chunk_data_deflate_uncompressed_data1,
+	                 68 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
 	 "memcpy_result",
@@ -4434,6 +4904,197 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_chunk_data_check_packed_checksum function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_chunk_data_check_packed_checksum(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libewf_chunk_data_t *chunk_data = NULL;
+	uint8_t *data                   = NULL;
+	void *memcpy_result             = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_chunk_data_initialize(
+	          &chunk_data,
+	          512,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_data",
+	 chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memcpy_result = memory_copy(
+	                 chunk_data->data,
+	                 ewf_test_chunk_data_deflate_uncompressed_data1,
+	                 68 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	chunk_data->data_size = 68;
+
+	/* Test regular cases
+	 */
+	chunk_data->range_flags = LIBEWF_RANGE_FLAG_HAS_CHECKSUM | LIBEWF_RANGE_FLAG_IS_PACKED;
+
+	result = libewf_chunk_data_check_packed_checksum(
+	          chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	chunk_data->data[ 0 ] = 0xff;
+
+	result = libewf_chunk_data_check_packed_checksum(
+	          chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The checksum of compressed chunk data is not checked
+	 */
+	chunk_data->range_flags = LIBEWF_RANGE_FLAG_IS_COMPRESSED | LIBEWF_RANGE_FLAG_IS_PACKED;
+
+	result = libewf_chunk_data_check_packed_checksum(
+	          chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	chunk_data->data[ 0 ] = 0x00;
+
+	/* Test error cases
+	 */
+	result = libewf_chunk_data_check_packed_checksum(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data             = chunk_data->data;
+	chunk_data->data = NULL;
+
+	result = libewf_chunk_data_check_packed_checksum(
+	          chunk_data,
+	          &error );
+
+	chunk_data->data = data;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_data->range_flags = LIBEWF_RANGE_FLAG_HAS_CHECKSUM | LIBEWF_RANGE_FLAG_IS_PACKED;
+	chunk_data->data_size   = 2;
+
+	result = libewf_chunk_data_check_packed_checksum(
+	          chunk_data,
+	          &error );
+
+	chunk_data->data_size = 68;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_chunk_data_free(
+	          &chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "chunk_data",
+	 chunk_data );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &chunk_data,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libewf_chunk_data_read_from_file_io_pool function
  * Returns 1 if successful or 0 if not
  */
@@ -4983,12 +5644,20 @@ int main(
 	 "libewf_chunk_data_pack_with_compression",
 	 ewf_test_chunk_data_pack_with_compression );
 
+	EWF_TEST_RUN(
+	 "libewf_chunk_data_pack_add_alignment_padding",
+	 ewf_test_chunk_data_pack_add_alignment_padding );
+
 	EWF_TEST_RUN(
 	 "libewf_chunk_data_pack",
 	 ewf_test_chunk_data_pack );
 
 #endif /* defined( HAVE_WRITE_SUPPORT ) */
 
+	EWF_TEST_RUN(
+	 "libewf_chunk_data_decrypt",
+	 ewf_test_chunk_data_decrypt );
+
 	EWF_TEST_RUN(
 	 "libewf_chunk_data_unpack",
 	 ewf_test_chunk_data_unpack );
@@ -5013,6 +5682,10 @@ int main(
 	 "libewf_chunk_data_get_checksum",
 	 ewf_test_chunk_data_get_checksum );
 
+	EWF_TEST_RUN(
+	 "libewf_chunk_data_check_packed_checksum",
+	 ewf_test_chunk_data_check_packed_checksum );
+
 	EWF_TEST_RUN(
 	 "libewf_chunk_data_read_from_file_io_pool",
 	 ewf_test_chunk_data_read_from_file_io_pool );
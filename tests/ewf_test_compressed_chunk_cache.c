@@ -0,0 +1,1009 @@
+/*
+ * Library compressed_chunk_cache type test program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_compressed_chunk_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* The maximum cache size used by the tests, which fits 3 entries of 1024 bytes
+ */
+#define EWF_TEST_COMPRESSED_CHUNK_CACHE_MAXIMUM_CACHE_SIZE \
+	( 3 * ( 1024 + sizeof( libewf_compressed_chunk_cache_entry_t ) ) )
+
+/* Tests the libewf_compressed_chunk_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_compressed_chunk_cache_initialize(
+     void )
+{
+	libewf_compressed_chunk_cache_t *compressed_chunk_cache = NULL;
+	libcerror_error_t *error                                = NULL;
+	int result                                              = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_compressed_chunk_cache_initialize(
+	          &compressed_chunk_cache,
+	          32768,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_chunk_cache",
+	 compressed_chunk_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* 1 MiB is expected to fit 127 chunks of 8 KiB compressed data
+	 */
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "compressed_chunk_cache->number_of_hash_buckets",
+	 compressed_chunk_cache->number_of_hash_buckets,
+	 128 );
+
+	result = libewf_compressed_chunk_cache_free(
+	          &compressed_chunk_cache,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "compressed_chunk_cache",
+	 compressed_chunk_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_compressed_chunk_cache_initialize(
+	          NULL,
+	          32768,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_chunk_cache = (libewf_compressed_chunk_cache_t *) 0x12345678UL;
+
+	result = libewf_compressed_chunk_cache_initialize(
+	          &compressed_chunk_cache,
+	          32768,
+	          1024 * 1024,
+	          &error );
+
+	compressed_chunk_cache = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_compressed_chunk_cache_initialize(
+	          &compressed_chunk_cache,
+	          0,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_compressed_chunk_cache_initialize(
+	          &compressed_chunk_cache,
+	          32768,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	/* Test libewf_compressed_chunk_cache_initialize with malloc failing
+	 */
+	ewf_test_malloc_attempts_before_fail = 0;
+
+	result = libewf_compressed_chunk_cache_initialize(
+	          &compressed_chunk_cache,
+	          32768,
+	          1024 * 1024,
+	          &error );
+
+	if( ewf_test_malloc_attempts_before_fail != -1 )
+	{
+		ewf_test_malloc_attempts_before_fail = -1;
+
+		if( compressed_chunk_cache != NULL )
+		{
+			libewf_compressed_chunk_cache_free(
+			 &compressed_chunk_cache,
+			 NULL );
+		}
+	}
+	else
+	{
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "compressed_chunk_cache",
+		 compressed_chunk_cache );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_chunk_cache != NULL )
+	{
+		libewf_compressed_chunk_cache_free(
+		 &compressed_chunk_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_compressed_chunk_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_compressed_chunk_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_compressed_chunk_cache_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_compressed_chunk_cache_get_chunk_data function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_compressed_chunk_cache_get_chunk_data(
+     void )
+{
+	uint8_t data[ 1024 ];
+	uint8_t chunk_data[ 1024 ];
+
+	libewf_compressed_chunk_cache_t *compressed_chunk_cache = NULL;
+	libcerror_error_t *error                                = NULL;
+	size_t chunk_data_size                                  = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_compressed_chunk_cache_initialize(
+	          &compressed_chunk_cache,
+	          32768,
+	          EWF_TEST_COMPRESSED_CHUNK_CACHE_MAXIMUM_CACHE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_chunk_cache",
+	 compressed_chunk_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          data,
+	          0x5a,
+	          1024 ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libewf_compressed_chunk_cache_set_chunk_data(
+	          compressed_chunk_cache,
+	          5,
+	          data,
+	          1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_compressed_chunk_cache_get_chunk_data(
+	          compressed_chunk_cache,
+	          5,
+	          chunk_data,
+	          1024,
+	          &chunk_data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_data_size",
+	 chunk_data_size,
+	 (size_t) 1024 );
+
+	result = memory_compare(
+	          chunk_data,
+	          data,
+	          1024 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libewf_compressed_chunk_cache_get_chunk_data(
+	          compressed_chunk_cache,
+	          6,
+	          chunk_data,
+	          1024,
+	          &chunk_data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_compressed_chunk_cache_get_chunk_data(
+	          NULL,
+	          5,
+	          chunk_data,
+	          1024,
+	          &chunk_data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_compressed_chunk_cache_get_chunk_data(
+	          compressed_chunk_cache,
+	          5,
+	          NULL,
+	          1024,
+	          &chunk_data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_compressed_chunk_cache_get_chunk_data(
+	          compressed_chunk_cache,
+	          5,
+	          chunk_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &chunk_data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_compressed_chunk_cache_get_chunk_data(
+	          compressed_chunk_cache,
+	          5,
+	          chunk_data,
+	          1024,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a data size that is too small
+	 */
+	result = libewf_compressed_chunk_cache_get_chunk_data(
+	          compressed_chunk_cache,
+	          5,
+	          chunk_data,
+	          512,
+	          &chunk_data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_compressed_chunk_cache_free(
+	          &compressed_chunk_cache,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "compressed_chunk_cache",
+	 compressed_chunk_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_chunk_cache != NULL )
+	{
+		libewf_compressed_chunk_cache_free(
+		 &compressed_chunk_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_compressed_chunk_cache_set_chunk_data function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_compressed_chunk_cache_set_chunk_data(
+     void )
+{
+	uint8_t data[ 4096 ];
+	uint8_t chunk_data[ 1024 ];
+
+	libewf_compressed_chunk_cache_t *compressed_chunk_cache = NULL;
+	libcerror_error_t *error                                = NULL;
+	size_t chunk_data_size                                  = 0;
+	uint64_t chunk_index                                    = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_compressed_chunk_cache_initialize(
+	          &compressed_chunk_cache,
+	          32768,
+	          EWF_TEST_COMPRESSED_CHUNK_CACHE_MAXIMUM_CACHE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_chunk_cache",
+	 compressed_chunk_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          data,
+	          0x5a,
+	          4096 ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	for( chunk_index = 0;
+	     chunk_index < 3;
+	     chunk_index++ )
+	{
+		result = libewf_compressed_chunk_cache_set_chunk_data(
+		          compressed_chunk_cache,
+		          chunk_index,
+		          data,
+		          1024,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "compressed_chunk_cache->number_of_entries",
+	 compressed_chunk_cache->number_of_entries,
+	 3 );
+
+	/* Make chunk 0 the most recently used so that chunk 1 is removed
+	 */
+	result = libewf_compressed_chunk_cache_get_chunk_data(
+	          compressed_chunk_cache,
+	          0,
+	          chunk_data,
+	          1024,
+	          &chunk_data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_compressed_chunk_cache_set_chunk_data(
+	          compressed_chunk_cache,
+	          3,
+	          data,
+	          1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "compressed_chunk_cache->number_of_entries",
+	 compressed_chunk_cache->number_of_entries,
+	 3 );
+
+	result = libewf_compressed_chunk_cache_get_chunk_data(
+	          compressed_chunk_cache,
+	          1,
+	          chunk_data,
+	          1024,
+	          &chunk_data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_compressed_chunk_cache_get_chunk_data(
+	          compressed_chunk_cache,
+	          0,
+	          chunk_data,
+	          1024,
+	          &chunk_data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with data that exceeds the maximum cache size
+	 */
+	result = libewf_compressed_chunk_cache_set_chunk_data(
+	          compressed_chunk_cache,
+	          4,
+	          data,
+	          4096,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "compressed_chunk_cache->number_of_entries",
+	 compressed_chunk_cache->number_of_entries,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libewf_compressed_chunk_cache_set_chunk_data(
+	          NULL,
+	          0,
+	          data,
+	          1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_compressed_chunk_cache_set_chunk_data(
+	          compressed_chunk_cache,
+	          0,
+	          NULL,
+	          1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_compressed_chunk_cache_set_chunk_data(
+	          compressed_chunk_cache,
+	          0,
+	          data,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_compressed_chunk_cache_free(
+	          &compressed_chunk_cache,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "compressed_chunk_cache",
+	 compressed_chunk_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_chunk_cache != NULL )
+	{
+		libewf_compressed_chunk_cache_free(
+		 &compressed_chunk_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_compressed_chunk_cache_remove_chunk_data function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_compressed_chunk_cache_remove_chunk_data(
+     void )
+{
+	uint8_t data[ 1024 ];
+
+	libewf_compressed_chunk_cache_t *compressed_chunk_cache = NULL;
+	libcerror_error_t *error                                = NULL;
+	uint64_t chunk_index                                    = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_compressed_chunk_cache_initialize(
+	          &compressed_chunk_cache,
+	          32768,
+	          EWF_TEST_COMPRESSED_CHUNK_CACHE_MAXIMUM_CACHE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_chunk_cache",
+	 compressed_chunk_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          data,
+	          0x5a,
+	          1024 ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( chunk_index = 0;
+	     chunk_index < 3;
+	     chunk_index++ )
+	{
+		result = libewf_compressed_chunk_cache_set_chunk_data(
+		          compressed_chunk_cache,
+		          chunk_index,
+		          data,
+		          1024,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libewf_compressed_chunk_cache_remove_chunk_data(
+	          compressed_chunk_cache,
+	          1,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "compressed_chunk_cache->number_of_entries",
+	 compressed_chunk_cache->number_of_entries,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "compressed_chunk_cache->first_entry->chunk_index",
+	 compressed_chunk_cache->first_entry->chunk_index,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_compressed_chunk_cache_remove_chunk_data(
+	          NULL,
+	          1,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_compressed_chunk_cache_remove_chunk_data(
+	          compressed_chunk_cache,
+	          2,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_compressed_chunk_cache_free(
+	          &compressed_chunk_cache,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "compressed_chunk_cache",
+	 compressed_chunk_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compressed_chunk_cache != NULL )
+	{
+		libewf_compressed_chunk_cache_free(
+		 &compressed_chunk_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_compressed_chunk_cache_initialize",
+	 ewf_test_compressed_chunk_cache_initialize );
+
+	EWF_TEST_RUN(
+	 "libewf_compressed_chunk_cache_free",
+	 ewf_test_compressed_chunk_cache_free );
+
+	EWF_TEST_RUN(
+	 "libewf_compressed_chunk_cache_get_chunk_data",
+	 ewf_test_compressed_chunk_cache_get_chunk_data );
+
+	EWF_TEST_RUN(
+	 "libewf_compressed_chunk_cache_set_chunk_data",
+	 ewf_test_compressed_chunk_cache_set_chunk_data );
+
+	EWF_TEST_RUN(
+	 "libewf_compressed_chunk_cache_remove_chunk_data",
+	 ewf_test_compressed_chunk_cache_remove_chunk_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,935 @@
+/*
+ * Library encryption_context type test program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_encryption_context.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* AES-128 test vector from FIPS-197 appendix C.1
+ */
+uint8_t ewf_test_encryption_context_key[ 16 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+uint8_t ewf_test_encryption_context_encrypted_data[ 16 ] = {
+	0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a };
+
+uint8_t ewf_test_encryption_context_decrypted_data[ 16 ] = {
+	0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff };
+
+/* CBC-AES128 test vector from NIST SP 800-38A appendix F.2.2
+ */
+uint8_t ewf_test_encryption_context_cbc_key[ 16 ] = {
+	0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c };
+
+uint8_t ewf_test_encryption_context_cbc_initialization_vector[ 16 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+uint8_t ewf_test_encryption_context_cbc_encrypted_data[ 64 ] = {
+	0x76, 0x49, 0xab, 0xac, 0x81, 0x19, 0xb2, 0x46, 0xce, 0xe9, 0x8e, 0x9b, 0x12, 0xe9, 0x19, 0x7d,
+	0x50, 0x86, 0xcb, 0x9b, 0x50, 0x72, 0x19, 0xee, 0x95, 0xdb, 0x11, 0x3a, 0x91, 0x76, 0x78, 0xb2,
+	0x73, 0xbe, 0xd6, 0xb8, 0xe3, 0xc1, 0x74, 0x3b, 0x71, 0x16, 0xe6, 0x9e, 0x22, 0x22, 0x95, 0x16,
+	0x3f, 0xf1, 0xca, 0xa1, 0x68, 0x1f, 0xac, 0x09, 0x12, 0x0e, 0xca, 0x30, 0x75, 0x86, 0xe1, 0xa7 };
+
+uint8_t ewf_test_encryption_context_cbc_decrypted_data[ 64 ] = {
+	0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+	0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+	0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+	0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10 };
+
+/* Tests the libewf_encryption_context_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_encryption_context_initialize(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libewf_encryption_context_t *encryption_context = NULL;
+	int result                                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_encryption_context_initialize(
+	          &encryption_context,
+	          ewf_test_encryption_context_key,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_encryption_context_initialize(
+	          NULL,
+	          ewf_test_encryption_context_key,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	encryption_context = (libewf_encryption_context_t *) 0x12345678UL;
+
+	result = libewf_encryption_context_initialize(
+	          &encryption_context,
+	          ewf_test_encryption_context_key,
+	          16,
+	          &error );
+
+	encryption_context = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_encryption_context_initialize(
+	          &encryption_context,
+	          NULL,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_encryption_context_initialize(
+	          &encryption_context,
+	          ewf_test_encryption_context_key,
+	          8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	/* Test libewf_encryption_context_initialize with malloc failing
+	 */
+	ewf_test_malloc_attempts_before_fail = 0;
+
+	result = libewf_encryption_context_initialize(
+	          &encryption_context,
+	          ewf_test_encryption_context_key,
+	          16,
+	          &error );
+
+	if( ewf_test_malloc_attempts_before_fail != -1 )
+	{
+		ewf_test_malloc_attempts_before_fail = -1;
+
+		if( encryption_context != NULL )
+		{
+			libewf_encryption_context_free(
+			 &encryption_context,
+			 NULL );
+		}
+	}
+	else
+	{
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "encryption_context",
+		 encryption_context );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encryption_context != NULL )
+	{
+		libewf_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_encryption_context_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_encryption_context_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_encryption_context_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_encryption_context_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_encryption_context_clone(
+     void )
+{
+	libcerror_error_t *error                                    = NULL;
+	libewf_encryption_context_t *destination_encryption_context = NULL;
+	libewf_encryption_context_t *source_encryption_context      = NULL;
+	int result                                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_encryption_context_initialize(
+	          &source_encryption_context,
+	          ewf_test_encryption_context_key,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "source_encryption_context",
+	 source_encryption_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_encryption_context_clone(
+	          &destination_encryption_context,
+	          source_encryption_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_encryption_context",
+	 destination_encryption_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_encryption_context_free(
+	          &destination_encryption_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "destination_encryption_context",
+	 destination_encryption_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_encryption_context_clone(
+	          &destination_encryption_context,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "destination_encryption_context",
+	 destination_encryption_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_encryption_context_clone(
+	          NULL,
+	          source_encryption_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_encryption_context_free(
+	          &source_encryption_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "source_encryption_context",
+	 source_encryption_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_encryption_context != NULL )
+	{
+		libewf_encryption_context_free(
+		 &destination_encryption_context,
+		 NULL );
+	}
+	if( source_encryption_context != NULL )
+	{
+		libewf_encryption_context_free(
+		 &source_encryption_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_encryption_context_set_initialization_vector function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_encryption_context_set_initialization_vector(
+     void )
+{
+	uint8_t data[ 64 ];
+
+	libcerror_error_t *error                        = NULL;
+	libewf_encryption_context_t *encryption_context = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_encryption_context_initialize(
+	          &encryption_context,
+	          ewf_test_encryption_context_cbc_key,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test decrypt with the default initialization vector of 0-byte values
+	 * only the first block is expected to differ
+	 */
+	result = libewf_encryption_context_decrypt(
+	          encryption_context,
+	          ewf_test_encryption_context_cbc_encrypted_data,
+	          64,
+	          data,
+	          64,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          ewf_test_encryption_context_cbc_decrypted_data,
+	          16 );
+
+	EWF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( data[ 16 ] ),
+	          &( ewf_test_encryption_context_cbc_decrypted_data[ 16 ] ),
+	          48 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test regular cases
+	 */
+	result = libewf_encryption_context_set_initialization_vector(
+	          encryption_context,
+	          ewf_test_encryption_context_cbc_initialization_vector,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_encryption_context_decrypt(
+	          encryption_context,
+	          ewf_test_encryption_context_cbc_encrypted_data,
+	          64,
+	          data,
+	          64,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          ewf_test_encryption_context_cbc_decrypted_data,
+	          64 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the initialization vector is not changed by a decrypt
+	 */
+	result = libewf_encryption_context_decrypt(
+	          encryption_context,
+	          ewf_test_encryption_context_cbc_encrypted_data,
+	          64,
+	          data,
+	          64,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          ewf_test_encryption_context_cbc_decrypted_data,
+	          64 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_encryption_context_set_initialization_vector(
+	          NULL,
+	          ewf_test_encryption_context_cbc_initialization_vector,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_encryption_context_set_initialization_vector(
+	          encryption_context,
+	          NULL,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_encryption_context_set_initialization_vector(
+	          encryption_context,
+	          ewf_test_encryption_context_cbc_initialization_vector,
+	          8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encryption_context != NULL )
+	{
+		libewf_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_encryption_context_decrypt function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_encryption_context_decrypt(
+     void )
+{
+	uint8_t data[ 32 ];
+
+	libcerror_error_t *error                        = NULL;
+	libewf_encryption_context_t *encryption_context = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_encryption_context_initialize(
+	          &encryption_context,
+	          ewf_test_encryption_context_key,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_encryption_context_decrypt(
+	          encryption_context,
+	          ewf_test_encryption_context_encrypted_data,
+	          16,
+	          data,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          ewf_test_encryption_context_decrypted_data,
+	          16 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libewf_encryption_context_decrypt(
+	          NULL,
+	          ewf_test_encryption_context_encrypted_data,
+	          16,
+	          data,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_encryption_context_decrypt(
+	          encryption_context,
+	          NULL,
+	          16,
+	          data,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_encryption_context_decrypt(
+	          encryption_context,
+	          ewf_test_encryption_context_encrypted_data,
+	          15,
+	          data,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_encryption_context_decrypt(
+	          encryption_context,
+	          ewf_test_encryption_context_encrypted_data,
+	          16,
+	          NULL,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_encryption_context_decrypt(
+	          encryption_context,
+	          ewf_test_encryption_context_encrypted_data,
+	          16,
+	          data,
+	          8,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encryption_context != NULL )
+	{
+		libewf_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_encryption_context_initialize",
+	 ewf_test_encryption_context_initialize );
+
+	EWF_TEST_RUN(
+	 "libewf_encryption_context_free",
+	 ewf_test_encryption_context_free );
+
+	EWF_TEST_RUN(
+	 "libewf_encryption_context_clone",
+	 ewf_test_encryption_context_clone );
+
+	EWF_TEST_RUN(
+	 "libewf_encryption_context_set_initialization_vector",
+	 ewf_test_encryption_context_set_initialization_vector );
+
+	/* TODO: add tests for libewf_encryption_context_grab_cipher_context */
+
+	/* TODO: add tests for libewf_encryption_context_release_cipher_context */
+
+	EWF_TEST_RUN(
+	 "libewf_encryption_context_decrypt",
+	 ewf_test_encryption_context_decrypt );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+}
+
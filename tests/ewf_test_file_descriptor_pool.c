@@ -0,0 +1,1429 @@
+/*
+ * Library file_descriptor_pool type test program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_file_descriptor_pool.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* Tests the libewf_file_descriptor_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_file_descriptor_pool_initialize(
+     void )
+{
+	char *filenames[ 2 ]                                = { "test.E01", "test.E02" };
+	libcerror_error_t *error                            = NULL;
+	libewf_file_descriptor_pool_t *file_descriptor_pool = NULL;
+	int result                                          = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_file_descriptor_pool_initialize(
+	          &file_descriptor_pool,
+	          filenames,
+	          2,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_descriptor_pool",
+	 file_descriptor_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_file_descriptor_pool_free(
+	          &file_descriptor_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "file_descriptor_pool",
+	 file_descriptor_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_file_descriptor_pool_initialize(
+	          NULL,
+	          filenames,
+	          2,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_descriptor_pool = (libewf_file_descriptor_pool_t *) 0x12345678UL;
+
+	result = libewf_file_descriptor_pool_initialize(
+	          &file_descriptor_pool,
+	          filenames,
+	          2,
+	          0,
+	          &error );
+
+	file_descriptor_pool = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_file_descriptor_pool_initialize(
+	          &file_descriptor_pool,
+	          NULL,
+	          2,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_file_descriptor_pool_initialize(
+	          &file_descriptor_pool,
+	          filenames,
+	          0,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_file_descriptor_pool_initialize(
+	          &file_descriptor_pool,
+	          filenames,
+	          2,
+	          -1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_descriptor_pool != NULL )
+	{
+		libewf_file_descriptor_pool_free(
+		 &file_descriptor_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_file_descriptor_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_file_descriptor_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_file_descriptor_pool_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_file_descriptor_pool_divide_maximum_number_of_open_file_descriptors function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_file_descriptor_pool_divide_maximum_number_of_open_file_descriptors(
+     void )
+{
+	char *filenames[ 2 ]                                = { "test.E01", "test.E02" };
+	libcerror_error_t *error                            = NULL;
+	libewf_file_descriptor_pool_t *file_descriptor_pool = NULL;
+	int maximum_number_of_open_file_descriptors         = 0;
+	int result                                          = 0;
+	int stripe_index                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_file_descriptor_pool_initialize(
+	          &file_descriptor_pool,
+	          filenames,
+	          2,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_descriptor_pool",
+	 file_descriptor_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_file_descriptor_pool_divide_maximum_number_of_open_file_descriptors(
+	          file_descriptor_pool,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "file_descriptor_pool->number_of_stripes",
+	 file_descriptor_pool->number_of_stripes,
+	 LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "file_descriptor_pool->stripes[ 0 ].maximum_number_of_open_file_descriptors",
+	 file_descriptor_pool->stripes[ 0 ].maximum_number_of_open_file_descriptors,
+	 0 );
+
+	/* Test a maximum that is less than the number of stripes
+	 */
+	result = libewf_file_descriptor_pool_divide_maximum_number_of_open_file_descriptors(
+	          file_descriptor_pool,
+	          3,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "file_descriptor_pool->number_of_stripes",
+	 file_descriptor_pool->number_of_stripes,
+	 3 );
+
+	maximum_number_of_open_file_descriptors = 0;
+
+	for( stripe_index = 0;
+	     stripe_index < LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES;
+	     stripe_index++ )
+	{
+		maximum_number_of_open_file_descriptors += file_descriptor_pool->stripes[ stripe_index ].maximum_number_of_open_file_descriptors;
+	}
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_open_file_descriptors",
+	 maximum_number_of_open_file_descriptors,
+	 3 );
+
+	/* Test a maximum that is not a multitude of the number of stripes
+	 */
+	result = libewf_file_descriptor_pool_divide_maximum_number_of_open_file_descriptors(
+	          file_descriptor_pool,
+	          LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES + 3,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "file_descriptor_pool->number_of_stripes",
+	 file_descriptor_pool->number_of_stripes,
+	 LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES );
+
+	maximum_number_of_open_file_descriptors = 0;
+
+	for( stripe_index = 0;
+	     stripe_index < LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES;
+	     stripe_index++ )
+	{
+		maximum_number_of_open_file_descriptors += file_descriptor_pool->stripes[ stripe_index ].maximum_number_of_open_file_descriptors;
+	}
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_open_file_descriptors",
+	 maximum_number_of_open_file_descriptors,
+	 LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES + 3 );
+
+	/* Test error cases
+	 */
+	result = libewf_file_descriptor_pool_divide_maximum_number_of_open_file_descriptors(
+	          NULL,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_file_descriptor_pool_divide_maximum_number_of_open_file_descriptors(
+	          file_descriptor_pool,
+	          -1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_file_descriptor_pool_free(
+	          &file_descriptor_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "file_descriptor_pool",
+	 file_descriptor_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_descriptor_pool != NULL )
+	{
+		libewf_file_descriptor_pool_free(
+		 &file_descriptor_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_file_descriptor_pool_set_maximum_number_of_open_file_descriptors function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_file_descriptor_pool_set_maximum_number_of_open_file_descriptors(
+     void )
+{
+	char *filenames[ 2 ]                                = { "test.E01", "test.E02" };
+	libcerror_error_t *error                            = NULL;
+	libewf_file_descriptor_pool_t *file_descriptor_pool = NULL;
+	int number_of_open_file_descriptors                 = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_file_descriptor_pool_initialize(
+	          &file_descriptor_pool,
+	          filenames,
+	          2,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_descriptor_pool",
+	 file_descriptor_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_file_descriptor_pool_set_maximum_number_of_open_file_descriptors(
+	          file_descriptor_pool,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "file_descriptor_pool->maximum_number_of_open_file_descriptors",
+	 file_descriptor_pool->maximum_number_of_open_file_descriptors,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "file_descriptor_pool->number_of_stripes",
+	 file_descriptor_pool->number_of_stripes,
+	 1 );
+
+	result = libewf_file_descriptor_pool_get_number_of_open_file_descriptors(
+	          file_descriptor_pool,
+	          &number_of_open_file_descriptors,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_file_descriptors",
+	 number_of_open_file_descriptors,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_file_descriptor_pool_set_maximum_number_of_open_file_descriptors(
+	          file_descriptor_pool,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "file_descriptor_pool->number_of_stripes",
+	 file_descriptor_pool->number_of_stripes,
+	 LIBEWF_FILE_DESCRIPTOR_POOL_NUMBER_OF_STRIPES );
+
+	/* Test error cases
+	 */
+	result = libewf_file_descriptor_pool_set_maximum_number_of_open_file_descriptors(
+	          NULL,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_file_descriptor_pool_set_maximum_number_of_open_file_descriptors(
+	          file_descriptor_pool,
+	          -1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_file_descriptor_pool_free(
+	          &file_descriptor_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "file_descriptor_pool",
+	 file_descriptor_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_descriptor_pool != NULL )
+	{
+		libewf_file_descriptor_pool_free(
+		 &file_descriptor_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_file_descriptor_pool_get_number_of_open_file_descriptors function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_file_descriptor_pool_get_number_of_open_file_descriptors(
+     void )
+{
+	char *filenames[ 2 ]                                = { "test.E01", "test.E02" };
+	libcerror_error_t *error                            = NULL;
+	libewf_file_descriptor_pool_t *file_descriptor_pool = NULL;
+	int number_of_open_file_descriptors                 = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_file_descriptor_pool_initialize(
+	          &file_descriptor_pool,
+	          filenames,
+	          2,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_descriptor_pool",
+	 file_descriptor_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_file_descriptor_pool_get_number_of_open_file_descriptors(
+	          file_descriptor_pool,
+	          &number_of_open_file_descriptors,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_file_descriptors",
+	 number_of_open_file_descriptors,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_file_descriptor_pool_get_number_of_open_file_descriptors(
+	          NULL,
+	          &number_of_open_file_descriptors,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_file_descriptor_pool_get_number_of_open_file_descriptors(
+	          file_descriptor_pool,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_file_descriptor_pool_free(
+	          &file_descriptor_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "file_descriptor_pool",
+	 file_descriptor_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_descriptor_pool != NULL )
+	{
+		libewf_file_descriptor_pool_free(
+		 &file_descriptor_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_file_descriptor_pool_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_file_descriptor_pool_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	char *filenames[ 2 ]                                = { "test.E01", "test.E02" };
+	libcerror_error_t *error                            = NULL;
+	libewf_file_descriptor_pool_t *file_descriptor_pool = NULL;
+	ssize_t read_count                                  = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_file_descriptor_pool_initialize(
+	          &file_descriptor_pool,
+	          filenames,
+	          2,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_descriptor_pool",
+	 file_descriptor_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libewf_file_descriptor_pool_read_buffer_at_offset(
+	              NULL,
+	              0,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libewf_file_descriptor_pool_read_buffer_at_offset(
+	              file_descriptor_pool,
+	              -1,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libewf_file_descriptor_pool_read_buffer_at_offset(
+	              file_descriptor_pool,
+	              2,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libewf_file_descriptor_pool_read_buffer_at_offset(
+	              file_descriptor_pool,
+	              0,
+	              NULL,
+	              16,
+	              0,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libewf_file_descriptor_pool_read_buffer_at_offset(
+	              file_descriptor_pool,
+	              0,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libewf_file_descriptor_pool_read_buffer_at_offset(
+	              file_descriptor_pool,
+	              0,
+	              buffer,
+	              16,
+	              -1,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the file does not exist
+	 */
+	read_count = libewf_file_descriptor_pool_read_buffer_at_offset(
+	              file_descriptor_pool,
+	              0,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_file_descriptor_pool_free(
+	          &file_descriptor_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "file_descriptor_pool",
+	 file_descriptor_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_descriptor_pool != NULL )
+	{
+		libewf_file_descriptor_pool_free(
+		 &file_descriptor_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_file_descriptor_pool_apply_access_advice function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_file_descriptor_pool_apply_access_advice(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_file_descriptor_pool_apply_access_advice(
+	          -1,
+	          0,
+	          0,
+	          LIBEWF_ACCESS_ADVICE_SEQUENTIAL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_file_descriptor_pool_apply_access_advice(
+	          0,
+	          -1,
+	          0,
+	          LIBEWF_ACCESS_ADVICE_SEQUENTIAL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_file_descriptor_pool_apply_access_advice(
+	          0,
+	          0,
+	          (size64_t) INT64_MAX + 1,
+	          LIBEWF_ACCESS_ADVICE_SEQUENTIAL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_file_descriptor_pool_apply_access_advice(
+	          0,
+	          0,
+	          0,
+	          -1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_file_descriptor_pool_set_access_advice function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_file_descriptor_pool_set_access_advice(
+     void )
+{
+	char *filenames[ 2 ]                                = { "test.E01", "test.E02" };
+	libcerror_error_t *error                            = NULL;
+	libewf_file_descriptor_pool_t *file_descriptor_pool = NULL;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_file_descriptor_pool_initialize(
+	          &file_descriptor_pool,
+	          filenames,
+	          2,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_descriptor_pool",
+	 file_descriptor_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_file_descriptor_pool_set_access_advice(
+	          file_descriptor_pool,
+	          LIBEWF_ACCESS_ADVICE_SEQUENTIAL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "file_descriptor_pool->access_advice",
+	 file_descriptor_pool->access_advice,
+	 LIBEWF_ACCESS_ADVICE_SEQUENTIAL );
+
+	/* Test error cases
+	 */
+	result = libewf_file_descriptor_pool_set_access_advice(
+	          NULL,
+	          LIBEWF_ACCESS_ADVICE_SEQUENTIAL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_file_descriptor_pool_set_access_advice(
+	          file_descriptor_pool,
+	          LIBEWF_ACCESS_ADVICE_WILLNEED,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_file_descriptor_pool_free(
+	          &file_descriptor_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "file_descriptor_pool",
+	 file_descriptor_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_descriptor_pool != NULL )
+	{
+		libewf_file_descriptor_pool_free(
+		 &file_descriptor_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_file_descriptor_pool_advise_range function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_file_descriptor_pool_advise_range(
+     void )
+{
+	char *filenames[ 2 ]                                = { "test.E01", "test.E02" };
+	libcerror_error_t *error                            = NULL;
+	libewf_file_descriptor_pool_t *file_descriptor_pool = NULL;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_file_descriptor_pool_initialize(
+	          &file_descriptor_pool,
+	          filenames,
+	          2,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_descriptor_pool",
+	 file_descriptor_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_file_descriptor_pool_advise_range(
+	          NULL,
+	          0,
+	          0,
+	          16,
+	          LIBEWF_ACCESS_ADVICE_WILLNEED,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_file_descriptor_pool_advise_range(
+	          file_descriptor_pool,
+	          2,
+	          0,
+	          16,
+	          LIBEWF_ACCESS_ADVICE_WILLNEED,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_file_descriptor_pool_advise_range(
+	          file_descriptor_pool,
+	          0,
+	          -1,
+	          16,
+	          LIBEWF_ACCESS_ADVICE_WILLNEED,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_file_descriptor_pool_advise_range(
+	          file_descriptor_pool,
+	          0,
+	          0,
+	          16,
+	          LIBEWF_ACCESS_ADVICE_SEQUENTIAL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the file does not exist
+	 */
+	result = libewf_file_descriptor_pool_advise_range(
+	          file_descriptor_pool,
+	          0,
+	          0,
+	          16,
+	          LIBEWF_ACCESS_ADVICE_WILLNEED,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_file_descriptor_pool_free(
+	          &file_descriptor_pool,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "file_descriptor_pool",
+	 file_descriptor_pool );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_descriptor_pool != NULL )
+	{
+		libewf_file_descriptor_pool_free(
+		 &file_descriptor_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_file_descriptor_pool_initialize",
+	 ewf_test_file_descriptor_pool_initialize );
+
+	EWF_TEST_RUN(
+	 "libewf_file_descriptor_pool_free",
+	 ewf_test_file_descriptor_pool_free );
+
+	EWF_TEST_RUN(
+	 "libewf_file_descriptor_pool_divide_maximum_number_of_open_file_descriptors",
+	 ewf_test_file_descriptor_pool_divide_maximum_number_of_open_file_descriptors );
+
+	EWF_TEST_RUN(
+	 "libewf_file_descriptor_pool_set_maximum_number_of_open_file_descriptors",
+	 ewf_test_file_descriptor_pool_set_maximum_number_of_open_file_descriptors );
+
+	EWF_TEST_RUN(
+	 "libewf_file_descriptor_pool_get_number_of_open_file_descriptors",
+	 ewf_test_file_descriptor_pool_get_number_of_open_file_descriptors );
+
+	/* TODO: add tests for libewf_file_descriptor_pool_grab_stripe */
+
+	/* TODO: add tests for libewf_file_descriptor_pool_grab_file_descriptor */
+
+	/* TODO: add tests for libewf_file_descriptor_pool_release_file_descriptor */
+
+	EWF_TEST_RUN(
+	 "libewf_file_descriptor_pool_read_buffer_at_offset",
+	 ewf_test_file_descriptor_pool_read_buffer_at_offset );
+
+	EWF_TEST_RUN(
+	 "libewf_file_descriptor_pool_apply_access_advice",
+	 ewf_test_file_descriptor_pool_apply_access_advice );
+
+	EWF_TEST_RUN(
+	 "libewf_file_descriptor_pool_set_access_advice",
+	 ewf_test_file_descriptor_pool_set_access_advice );
+
+	EWF_TEST_RUN(
+	 "libewf_file_descriptor_pool_advise_range",
+	 ewf_test_file_descriptor_pool_advise_range );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+}
+
@@ -530,6 +530,393 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_filename_get_segment_number function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_filename_get_segment_number(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t segment_number  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_filename_get_segment_number(
+	          "E01",
+	          3,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
+	          LIBEWF_FORMAT_ENCASE6,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "segment_number",
+	 segment_number,
+	 (uint32_t) 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_filename_get_segment_number(
+	          "E99",
+	          3,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
+	          LIBEWF_FORMAT_ENCASE6,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "segment_number",
+	 segment_number,
+	 (uint32_t) 99 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_filename_get_segment_number(
+	          "EAA",
+	          3,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
+	          LIBEWF_FORMAT_ENCASE6,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "segment_number",
+	 segment_number,
+	 (uint32_t) 100 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_filename_get_segment_number(
+	          "FAA",
+	          3,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
+	          LIBEWF_FORMAT_ENCASE6,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "segment_number",
+	 segment_number,
+	 (uint32_t) 776 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_filename_get_segment_number(
+	          "Ex01",
+	          4,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF2,
+	          LIBEWF_FORMAT_V2_ENCASE7,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "segment_number",
+	 segment_number,
+	 (uint32_t) 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_filename_get_segment_number(
+	          "ExAB",
+	          4,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF2,
+	          LIBEWF_FORMAT_V2_ENCASE7,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "segment_number",
+	 segment_number,
+	 (uint32_t) 101 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_filename_get_segment_number(
+	          "L01",
+	          3,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1_LOGICAL,
+	          LIBEWF_FORMAT_LOGICAL_ENCASE6,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "segment_number",
+	 segment_number,
+	 (uint32_t) 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_filename_get_segment_number(
+	          "s05",
+	          3,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1_SMART,
+	          LIBEWF_FORMAT_SMART,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "segment_number",
+	 segment_number,
+	 (uint32_t) 5 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_filename_get_segment_number(
+	          "e01",
+	          3,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
+	          LIBEWF_FORMAT_EWF,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "segment_number",
+	 segment_number,
+	 (uint32_t) 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test extensions that do not match the naming schema
+	 */
+	result = libewf_filename_get_segment_number(
+	          "E00",
+	          3,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
+	          LIBEWF_FORMAT_ENCASE6,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_filename_get_segment_number(
+	          "X01",
+	          3,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
+	          LIBEWF_FORMAT_ENCASE6,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_filename_get_segment_number(
+	          "E0A",
+	          3,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
+	          LIBEWF_FORMAT_ENCASE6,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_filename_get_segment_number(
+	          "E01",
+	          2,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
+	          LIBEWF_FORMAT_ENCASE6,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_filename_get_segment_number(
+	          "E01",
+	          3,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF2,
+	          LIBEWF_FORMAT_V2_ENCASE7,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_filename_get_segment_number(
+	          "Ex01",
+	          4,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
+	          LIBEWF_FORMAT_ENCASE6,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_filename_get_segment_number(
+	          NULL,
+	          3,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
+	          LIBEWF_FORMAT_ENCASE6,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_filename_get_segment_number(
+	          "E01",
+	          3,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
+	          LIBEWF_FORMAT_ENCASE6,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_filename_get_segment_number(
+	          "E01",
+	          3,
+	          0xff,
+	          LIBEWF_FORMAT_ENCASE6,
+	          &segment_number,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 /* Tests the libewf_filename_set_extension_wide function
@@ -1338,6 +1725,10 @@ int main(
 	 "libewf_filename_set_extension",
 	 ewf_test_filename_set_extension );
 
+	EWF_TEST_RUN(
+	 "libewf_filename_get_segment_number",
+	 ewf_test_filename_get_segment_number );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 	EWF_TEST_RUN(
@@ -697,6 +697,161 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_handle_clone_shared function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_clone_shared(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libewf_handle_t *destination_handle = NULL;
+	libewf_handle_t *source_handle      = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_handle_initialize(
+	          &source_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "source_handle",
+	 source_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_handle_clone_shared(
+	          &destination_handle,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "destination_handle",
+	 destination_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_handle_clone_shared(
+	          NULL,
+	          source_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_handle = (libewf_handle_t *) 0x12345678UL;
+
+	result = libewf_handle_clone_shared(
+	          &destination_handle,
+	          source_handle,
+	          &error );
+
+	destination_handle = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the source handle is not open
+	 */
+	result = libewf_handle_clone_shared(
+	          &destination_handle,
+	          source_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "destination_handle",
+	 destination_handle );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_handle_free(
+	          &source_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "source_handle",
+	 source_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_handle != NULL )
+	{
+		libewf_handle_free(
+		 &destination_handle,
+		 NULL );
+	}
+	if( source_handle != NULL )
+	{
+		libewf_handle_free(
+		 &source_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libewf_handle_open function
  * Returns 1 if successful or 0 if not
  */
@@ -2506,6 +2661,128 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_handle_write_packed_data_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_write_packed_data_chunk(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error        = NULL;
+	libewf_data_chunk_t *data_chunk = NULL;
+	ssize_t write_count             = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_handle_get_data_chunk(
+	          handle,
+	          &data_chunk,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "data_chunk",
+	 data_chunk );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	write_count = libewf_handle_write_packed_data_chunk(
+	               NULL,
+	               data_chunk,
+	               &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libewf_handle_write_packed_data_chunk(
+	               handle,
+	               NULL,
+	               &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test write packed data chunk on a handle opened for reading
+	 */
+	write_count = libewf_handle_write_packed_data_chunk(
+	               handle,
+	               data_chunk,
+	               &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_data_chunk_free(
+	          &data_chunk,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "data_chunk",
+	 data_chunk );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_chunk != NULL )
+	{
+		libewf_data_chunk_free(
+		 &data_chunk,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libewf_handle_seek_offset function
  * Returns 1 if successful or 0 if not
  */
@@ -2812,6 +3089,247 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libewf_handle_advise function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_handle_advise(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_handle_advise(
+	          handle,
+	          0,
+	          0,
+	          LIBEWF_ACCESS_ADVICE_SEQUENTIAL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_advise(
+	          handle,
+	          0,
+	          0,
+	          LIBEWF_ACCESS_ADVICE_WILLNEED,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_advise(
+	          handle,
+	          0,
+	          0,
+	          LIBEWF_ACCESS_ADVICE_DONTNEED,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_advise(
+	          handle,
+	          0,
+	          0,
+	          LIBEWF_ACCESS_ADVICE_NORMAL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_handle_advise(
+	          NULL,
+	          0,
+	          0,
+	          LIBEWF_ACCESS_ADVICE_NORMAL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_advise(
+	          handle,
+	          -1,
+	          0,
+	          LIBEWF_ACCESS_ADVICE_NORMAL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_handle_advise(
+	          handle,
+	          0,
+	          0,
+	          -1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+
+/* Tests the libewf_internal_handle_prefetch_range function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_internal_handle_prefetch_range(
+     libewf_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_internal_handle_prefetch_range(
+	          (libewf_internal_handle_t *) handle,
+	          0,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a range beyond the end of the media data
+	 */
+	result = libewf_internal_handle_prefetch_range(
+	          (libewf_internal_handle_t *) handle,
+	          (off64_t) INT64_MAX,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_internal_handle_prefetch_range(
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_internal_handle_prefetch_range(
+	          (libewf_internal_handle_t *) handle,
+	          -1,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
 /* Tests the libewf_handle_get_segment_filename_size function
  * Returns 1 if successful or 0 if not
  */
@@ -4703,6 +5221,10 @@ int main(
 	 "libewf_handle_clone",
 	 ewf_test_handle_clone );
 
+	EWF_TEST_RUN(
+	 "libewf_handle_clone_shared",
+	 ewf_test_handle_clone_shared );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -4934,6 +5456,17 @@ int main(
 
 		/* TODO: add tests for libewf_handle_write_data_chunk */
 
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+		/* TODO: add tests for libewf_internal_handle_write_packed_data_chunk_to_file_io_pool */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_write_packed_data_chunk",
+		 ewf_test_handle_write_packed_data_chunk,
+		 handle );
+
 #if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
 
 		/* TODO: add tests for libewf_internal_handle_write_finalize_file_io_pool */
@@ -4958,8 +5491,28 @@ int main(
 		 ewf_test_handle_get_offset,
 		 handle );
 
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+		/* TODO: add tests for libewf_internal_handle_divide_maximum_number_of_open_handles */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
 		/* TODO: add tests for libewf_handle_set_maximum_number_of_open_handles */
 
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_handle_advise",
+		 ewf_test_handle_advise,
+		 handle );
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT )
+
+		EWF_TEST_RUN_WITH_ARGS(
+		 "libewf_internal_handle_prefetch_range",
+		 ewf_test_internal_handle_prefetch_range,
+		 handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) && defined( HAVE_LIBEWF_MULTI_THREAD_SUPPORT ) */
+
 		/* TODO: add tests for libewf_handle_segment_files_corrupted */
 
 		/* TODO: add tests for libewf_handle_segment_files_encrypted */
@@ -5051,6 +5604,8 @@ int main(
 
 		/* TODO: add tests for libewf_handle_get_file_entry_by_utf16_path */
 
+		/* TODO: add tests for libewf_handle_get_file_entry_by_file_entry */
+
 		EWF_TEST_RUN_WITH_ARGS(
 		 "libewf_handle_get_sectors_per_chunk",
 		 ewf_test_handle_get_sectors_per_chunk,
@@ -613,6 +613,7 @@ int ewf_test_huffman_tree_get_symbol_from_bit_stream(
 	          &bit_stream,
 	          &( ewf_test_huffman_tree_data1[ 256 ] ),
 	          277 - 256,
+	          LIBEWF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
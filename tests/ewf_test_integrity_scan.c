@@ -0,0 +1,940 @@
+/*
+ * Library integrity_scan type test program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcdata.h"
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_chunk_data.h"
+#include "../libewf/libewf_definitions.h"
+#include "../libewf/libewf_integrity_scan.h"
+#include "../libewf/libewf_io_handle.h"
+#include "../libewf/libewf_media_values.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* Creates packed chunk data of 512 bytes of 0-byte values with a checksum
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_integrity_scan_create_chunk_data(
+     libewf_chunk_data_t **chunk_data,
+     uint64_t chunk_index,
+     uint8_t corrupt,
+     libcerror_error_t **error )
+{
+	uint32_t checksum = 0x02000001UL;
+
+	if( libewf_chunk_data_initialize(
+	     chunk_data,
+	     512,
+	     1,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( corrupt != 0 )
+	{
+		checksum ^= 0xffffffffUL;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( ( ( *chunk_data )->data )[ 512 ] ),
+	 checksum );
+
+	( *chunk_data )->data_size          = 512 + 4;
+	( *chunk_data )->range_flags        = LIBEWF_RANGE_FLAG_HAS_CHECKSUM | LIBEWF_RANGE_FLAG_IS_PACKED;
+	( *chunk_data )->chunk_index        = chunk_index;
+	( *chunk_data )->range_start_offset = (off64_t) ( chunk_index * 512 );
+	( *chunk_data )->range_end_offset   = (off64_t) ( ( chunk_index + 1 ) * 512 );
+
+	return( 1 );
+}
+
+/* Tests the libewf_integrity_scan_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_integrity_scan_initialize(
+     void )
+{
+	libcdata_range_list_t *checksum_errors  = NULL;
+	libcerror_error_t *error                = NULL;
+	libewf_integrity_scan_t *integrity_scan = NULL;
+	libewf_io_handle_t *io_handle           = NULL;
+	libewf_media_values_t *media_values     = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libewf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_media_values_initialize(
+	          &media_values,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "media_values",
+	 media_values );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_range_list_initialize(
+	          &checksum_errors,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "checksum_errors",
+	 checksum_errors );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_integrity_scan_initialize(
+	          &integrity_scan,
+	          io_handle,
+	          media_values,
+	          checksum_errors,
+	          2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "integrity_scan",
+	 integrity_scan );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_integrity_scan_free(
+	          &integrity_scan,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "integrity_scan",
+	 integrity_scan );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_integrity_scan_initialize(
+	          NULL,
+	          io_handle,
+	          media_values,
+	          checksum_errors,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	integrity_scan = (libewf_integrity_scan_t *) 0x12345678UL;
+
+	result = libewf_integrity_scan_initialize(
+	          &integrity_scan,
+	          io_handle,
+	          media_values,
+	          checksum_errors,
+	          0,
+	          &error );
+
+	integrity_scan = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_integrity_scan_initialize(
+	          &integrity_scan,
+	          NULL,
+	          media_values,
+	          checksum_errors,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "integrity_scan",
+	 integrity_scan );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_integrity_scan_initialize(
+	          &integrity_scan,
+	          io_handle,
+	          NULL,
+	          checksum_errors,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "integrity_scan",
+	 integrity_scan );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_integrity_scan_initialize(
+	          &integrity_scan,
+	          io_handle,
+	          media_values,
+	          NULL,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "integrity_scan",
+	 integrity_scan );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_integrity_scan_initialize(
+	          &integrity_scan,
+	          io_handle,
+	          media_values,
+	          checksum_errors,
+	          -1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "integrity_scan",
+	 integrity_scan );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_integrity_scan_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = libewf_integrity_scan_initialize(
+		          &integrity_scan,
+		          io_handle,
+		          media_values,
+		          checksum_errors,
+		          0,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( integrity_scan != NULL )
+			{
+				libewf_integrity_scan_free(
+				 &integrity_scan,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "integrity_scan",
+			 integrity_scan );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libewf_integrity_scan_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = libewf_integrity_scan_initialize(
+		          &integrity_scan,
+		          io_handle,
+		          media_values,
+		          checksum_errors,
+		          0,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( integrity_scan != NULL )
+			{
+				libewf_integrity_scan_free(
+				 &integrity_scan,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "integrity_scan",
+			 integrity_scan );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libcdata_range_list_free(
+	          &checksum_errors,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_media_values_free(
+	          &media_values,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( integrity_scan != NULL )
+	{
+		libewf_integrity_scan_free(
+		 &integrity_scan,
+		 NULL );
+	}
+	if( checksum_errors != NULL )
+	{
+		libcdata_range_list_free(
+		 &checksum_errors,
+		 NULL,
+		 NULL );
+	}
+	if( media_values != NULL )
+	{
+		libewf_media_values_free(
+		 &media_values,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libewf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_integrity_scan_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_integrity_scan_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_integrity_scan_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_integrity_scan_push_chunk_data and libewf_integrity_scan_finalize functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_integrity_scan_push_chunk_data(
+     void )
+{
+	libcdata_range_list_t *checksum_errors  = NULL;
+	libcerror_error_t *error                = NULL;
+	libewf_chunk_data_t *chunk_data         = NULL;
+	libewf_integrity_scan_t *integrity_scan = NULL;
+	libewf_io_handle_t *io_handle           = NULL;
+	libewf_media_values_t *media_values     = NULL;
+	intptr_t *value                         = NULL;
+	uint64_t chunk_index                    = 0;
+	uint64_t number_of_sectors              = 0;
+	uint64_t start_sector                   = 0;
+	int number_of_elements                  = 0;
+	int number_of_threads                   = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_media_values_initialize(
+	          &media_values,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	media_values->chunk_size        = 512;
+	media_values->sectors_per_chunk = 1;
+	media_values->number_of_sectors = 8;
+
+	/* Test regular cases with and without verification threads
+	 */
+	for( number_of_threads = 0;
+	     number_of_threads <= 2;
+	     number_of_threads += 2 )
+	{
+		result = libcdata_range_list_initialize(
+		          &checksum_errors,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libewf_integrity_scan_initialize(
+		          &integrity_scan,
+		          io_handle,
+		          media_values,
+		          checksum_errors,
+		          number_of_threads,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( chunk_index = 0;
+		     chunk_index < 8;
+		     chunk_index++ )
+		{
+			result = ewf_test_integrity_scan_create_chunk_data(
+			          &chunk_data,
+			          chunk_index,
+			          (uint8_t) ( chunk_index == 5 ),
+			          &error );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libewf_integrity_scan_push_chunk_data(
+			          integrity_scan,
+			          &chunk_data,
+			          &error );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "chunk_data",
+			 chunk_data );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libewf_integrity_scan_finalize(
+		          integrity_scan,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EWF_TEST_ASSERT_EQUAL_UINT64(
+		 "integrity_scan->number_of_corrupted_chunks",
+		 integrity_scan->number_of_corrupted_chunks,
+		 (uint64_t) 1 );
+
+		result = libcdata_range_list_get_number_of_elements(
+		          checksum_errors,
+		          &number_of_elements,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "number_of_elements",
+		 number_of_elements,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_range_list_get_range_by_index(
+		          checksum_errors,
+		          0,
+		          &start_sector,
+		          &number_of_sectors,
+		          &value,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_EQUAL_UINT64(
+		 "start_sector",
+		 start_sector,
+		 (uint64_t) 5 );
+
+		EWF_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_sectors",
+		 number_of_sectors,
+		 (uint64_t) 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libewf_integrity_scan_free(
+		          &integrity_scan,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_range_list_free(
+		          &checksum_errors,
+		          NULL,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = ewf_test_integrity_scan_create_chunk_data(
+	          &chunk_data,
+	          0,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_integrity_scan_push_chunk_data(
+	          NULL,
+	          &chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_integrity_scan_finalize(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_chunk_data_free(
+	          &chunk_data,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_media_values_free(
+	          &media_values,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_data != NULL )
+	{
+		libewf_chunk_data_free(
+		 &chunk_data,
+		 NULL );
+	}
+	if( integrity_scan != NULL )
+	{
+		libewf_integrity_scan_free(
+		 &integrity_scan,
+		 NULL );
+	}
+	if( checksum_errors != NULL )
+	{
+		libcdata_range_list_free(
+		 &checksum_errors,
+		 NULL,
+		 NULL );
+	}
+	if( media_values != NULL )
+	{
+		libewf_media_values_free(
+		 &media_values,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libewf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_integrity_scan_initialize",
+	 ewf_test_integrity_scan_initialize );
+
+	EWF_TEST_RUN(
+	 "libewf_integrity_scan_free",
+	 ewf_test_integrity_scan_free );
+
+	EWF_TEST_RUN(
+	 "libewf_integrity_scan_push_chunk_data",
+	 ewf_test_integrity_scan_push_chunk_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1187 @@
+/*
+ * Library persistent_cache type test program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../libewf/libewf_persistent_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* Tests the libewf_persistent_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_persistent_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libewf_persistent_cache_t *persistent_cache  = NULL;
+	int result                                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_persistent_cache_initialize(
+	          &persistent_cache,
+	          32768,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "persistent_cache",
+	 persistent_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* 1 MiB fits 31 slots of 32 KiB with their slot descriptor
+	 */
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "persistent_cache->number_of_slots",
+	 persistent_cache->number_of_slots,
+	 31 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "persistent_cache->number_of_hash_buckets",
+	 persistent_cache->number_of_hash_buckets,
+	 32 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "persistent_cache->file_descriptor",
+	 persistent_cache->file_descriptor,
+	 -1 );
+
+	result = libewf_persistent_cache_free(
+	          &persistent_cache,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "persistent_cache",
+	 persistent_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_persistent_cache_initialize(
+	          NULL,
+	          32768,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	persistent_cache = (libewf_persistent_cache_t *) 0x12345678UL;
+
+	result = libewf_persistent_cache_initialize(
+	          &persistent_cache,
+	          32768,
+	          1024 * 1024,
+	          &error );
+
+	persistent_cache = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_persistent_cache_initialize(
+	          &persistent_cache,
+	          0,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_persistent_cache_initialize(
+	          &persistent_cache,
+	          32768,
+	          1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( persistent_cache != NULL )
+	{
+		libewf_persistent_cache_free(
+		 &persistent_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_persistent_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_persistent_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_persistent_cache_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_persistent_cache_link_slot and libewf_persistent_cache_unlink_slot functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_persistent_cache_link_slot(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libewf_persistent_cache_t *persistent_cache  = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_persistent_cache_initialize(
+	          &persistent_cache,
+	          32768,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "persistent_cache",
+	 persistent_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "persistent_cache->first_slot_index",
+	 persistent_cache->first_slot_index,
+	 0 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "persistent_cache->last_slot_index",
+	 persistent_cache->last_slot_index,
+	 30 );
+
+	result = libewf_persistent_cache_unlink_slot(
+	          persistent_cache,
+	          30,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "persistent_cache->last_slot_index",
+	 persistent_cache->last_slot_index,
+	 29 );
+
+	result = libewf_persistent_cache_link_slot(
+	          persistent_cache,
+	          30,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "persistent_cache->first_slot_index",
+	 persistent_cache->first_slot_index,
+	 30 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "persistent_cache->slots[ 30 ].next_slot_index",
+	 persistent_cache->slots[ 30 ].next_slot_index,
+	 0 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "persistent_cache->slots[ 0 ].previous_slot_index",
+	 persistent_cache->slots[ 0 ].previous_slot_index,
+	 30 );
+
+	/* Test error cases
+	 */
+	result = libewf_persistent_cache_unlink_slot(
+	          NULL,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_persistent_cache_unlink_slot(
+	          persistent_cache,
+	          31,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_persistent_cache_link_slot(
+	          NULL,
+	          0,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_persistent_cache_link_slot(
+	          persistent_cache,
+	          -1,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_persistent_cache_free(
+	          &persistent_cache,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "persistent_cache",
+	 persistent_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( persistent_cache != NULL )
+	{
+		libewf_persistent_cache_free(
+		 &persistent_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_persistent_cache_get_slot_index function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_persistent_cache_get_slot_index(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libewf_persistent_cache_t *persistent_cache  = NULL;
+	int result                                   = 0;
+	int slot_index                               = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_persistent_cache_initialize(
+	          &persistent_cache,
+	          32768,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "persistent_cache",
+	 persistent_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_persistent_cache_get_slot_index(
+	          persistent_cache,
+	          5,
+	          &slot_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	persistent_cache->slots[ 3 ].chunk_index = 37;
+	persistent_cache->slots[ 3 ].is_used     = 1;
+
+	result = libewf_persistent_cache_insert_slot_in_hash(
+	          persistent_cache,
+	          3,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Chunk 5 maps onto the same hash bucket as chunk 37
+	 */
+	result = libewf_persistent_cache_get_slot_index(
+	          persistent_cache,
+	          5,
+	          &slot_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_persistent_cache_get_slot_index(
+	          persistent_cache,
+	          37,
+	          &slot_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "slot_index",
+	 slot_index,
+	 3 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_persistent_cache_remove_slot_from_hash(
+	          persistent_cache,
+	          3,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_persistent_cache_get_slot_index(
+	          persistent_cache,
+	          37,
+	          &slot_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_persistent_cache_get_slot_index(
+	          NULL,
+	          37,
+	          &slot_index,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_persistent_cache_get_slot_index(
+	          persistent_cache,
+	          37,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_persistent_cache_free(
+	          &persistent_cache,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "persistent_cache",
+	 persistent_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( persistent_cache != NULL )
+	{
+		libewf_persistent_cache_free(
+		 &persistent_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_persistent_cache_open function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_persistent_cache_open(
+     void )
+{
+	uint8_t empty_set_identifier[ 16 ] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+	libcerror_error_t *error                     = NULL;
+	libewf_persistent_cache_t *persistent_cache  = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_persistent_cache_initialize(
+	          &persistent_cache,
+	          32768,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "persistent_cache",
+	 persistent_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_persistent_cache_open(
+	          persistent_cache,
+	          ".",
+	          empty_set_identifier,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_persistent_cache_open(
+	          NULL,
+	          ".",
+	          empty_set_identifier,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_persistent_cache_open(
+	          persistent_cache,
+	          NULL,
+	          empty_set_identifier,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_persistent_cache_open(
+	          persistent_cache,
+	          ".",
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_persistent_cache_free(
+	          &persistent_cache,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "persistent_cache",
+	 persistent_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( persistent_cache != NULL )
+	{
+		libewf_persistent_cache_free(
+		 &persistent_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_persistent_cache_get_chunk_data function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_persistent_cache_get_chunk_data(
+     void )
+{
+	uint8_t data[ 32768 ];
+
+	libcerror_error_t *error                     = NULL;
+	libewf_persistent_cache_t *persistent_cache  = NULL;
+	size_t chunk_data_size                       = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_persistent_cache_initialize(
+	          &persistent_cache,
+	          32768,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "persistent_cache",
+	 persistent_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_persistent_cache_get_chunk_data(
+	          persistent_cache,
+	          0,
+	          data,
+	          32768,
+	          &chunk_data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_persistent_cache_get_chunk_data(
+	          NULL,
+	          0,
+	          data,
+	          32768,
+	          &chunk_data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_persistent_cache_get_chunk_data(
+	          persistent_cache,
+	          0,
+	          NULL,
+	          32768,
+	          &chunk_data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_persistent_cache_get_chunk_data(
+	          persistent_cache,
+	          0,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &chunk_data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_persistent_cache_get_chunk_data(
+	          persistent_cache,
+	          0,
+	          data,
+	          32768,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_persistent_cache_free(
+	          &persistent_cache,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "persistent_cache",
+	 persistent_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( persistent_cache != NULL )
+	{
+		libewf_persistent_cache_free(
+		 &persistent_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_persistent_cache_set_chunk_data function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_persistent_cache_set_chunk_data(
+     void )
+{
+	uint8_t data[ 32768 ];
+
+	libcerror_error_t *error                     = NULL;
+	libewf_persistent_cache_t *persistent_cache  = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libewf_persistent_cache_initialize(
+	          &persistent_cache,
+	          32768,
+	          1024 * 1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "persistent_cache",
+	 persistent_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libewf_persistent_cache_set_chunk_data(
+	          persistent_cache,
+	          0,
+	          data,
+	          32768,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_persistent_cache_set_chunk_data(
+	          NULL,
+	          0,
+	          data,
+	          32768,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_persistent_cache_set_chunk_data(
+	          persistent_cache,
+	          0,
+	          NULL,
+	          32768,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_persistent_cache_set_chunk_data(
+	          persistent_cache,
+	          0,
+	          data,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_persistent_cache_set_chunk_data(
+	          persistent_cache,
+	          0,
+	          data,
+	          32769,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libewf_persistent_cache_free(
+	          &persistent_cache,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "persistent_cache",
+	 persistent_cache );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( persistent_cache != NULL )
+	{
+		libewf_persistent_cache_free(
+		 &persistent_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+	EWF_TEST_RUN(
+	 "libewf_persistent_cache_initialize",
+	 ewf_test_persistent_cache_initialize );
+
+	EWF_TEST_RUN(
+	 "libewf_persistent_cache_free",
+	 ewf_test_persistent_cache_free );
+
+	EWF_TEST_RUN(
+	 "libewf_persistent_cache_link_slot",
+	 ewf_test_persistent_cache_link_slot );
+
+	EWF_TEST_RUN(
+	 "libewf_persistent_cache_get_slot_index",
+	 ewf_test_persistent_cache_get_slot_index );
+
+	EWF_TEST_RUN(
+	 "libewf_persistent_cache_open",
+	 ewf_test_persistent_cache_open );
+
+	/* TODO: add tests for libewf_persistent_cache_close */
+
+	EWF_TEST_RUN(
+	 "libewf_persistent_cache_get_chunk_data",
+	 ewf_test_persistent_cache_get_chunk_data );
+
+	EWF_TEST_RUN(
+	 "libewf_persistent_cache_set_chunk_data",
+	 ewf_test_persistent_cache_set_chunk_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+}
+
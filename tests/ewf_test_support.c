@@ -1572,148 +1572,202 @@ on_error:
 	return( 0 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
-
-/* Tests the libewf_glob_wide_determine_format function
+/* Tests the libewf_glob_scan_directory function
  * Returns 1 if successful or 0 if not
  */
-int ewf_test_glob_wide_determine_format(
-     void )
+int ewf_test_glob_scan_directory(
+     const system_character_t *source )
 {
-	libcerror_error_t *error = NULL;
-	uint8_t format           = 0;
-	int result               = 0;
+	char narrow_source[ 256 ];
 
-	/* Test regular cases
-	 */
-	result = libewf_glob_wide_determine_format(
-	          L"test.E01",
-	          8,
-	          &format,
-	          &error );
+	libcerror_error_t *error          = NULL;
+	char **expected_filenames         = NULL;
+	char **filenames                  = NULL;
+	size_t narrow_source_length       = 0;
+	int expected_number_of_filenames  = 0;
+	int filename_index                = 0;
+	int number_of_filenames           = 0;
+	int result                        = 0;
 
-	EWF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	if( source != NULL )
+	{
+		/* Initialize test
+		 */
+		result = ewf_test_get_narrow_source(
+		          source,
+		          narrow_source,
+		          256,
+		          &error );
 
-	EWF_TEST_ASSERT_EQUAL_UINT8(
-	 "format",
-	 format,
-	 LIBEWF_FORMAT_ENCASE5 );
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	EWF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	result = libewf_glob_wide_determine_format(
-	          L"test.L01",
-	          8,
-	          &format,
-	          &error );
+		narrow_source_length = narrow_string_length(
+		                        narrow_source );
 
-	EWF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		result = libewf_glob(
+		          narrow_source,
+		          narrow_source_length,
+		          LIBEWF_FORMAT_UNKNOWN,
+		          &expected_filenames,
+		          &expected_number_of_filenames,
+		          &error );
 
-	EWF_TEST_ASSERT_EQUAL_UINT8(
-	 "format",
-	 format,
-	 LIBEWF_FORMAT_LOGICAL_ENCASE5 );
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	EWF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	result = libewf_glob_wide_determine_format(
-	          L"test.e01",
-	          8,
-	          &format,
-	          &error );
+		/* Test regular cases
+		 */
+		result = libewf_glob_scan_directory(
+		          narrow_source,
+		          narrow_source_length,
+		          LIBEWF_FORMAT_UNKNOWN,
+		          &filenames,
+		          &number_of_filenames,
+		          &error );
 
-	EWF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	EWF_TEST_ASSERT_EQUAL_UINT8(
-	 "format",
-	 format,
-	 LIBEWF_FORMAT_EWF );
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "number_of_filenames",
+		 number_of_filenames,
+		 expected_number_of_filenames );
 
-	EWF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	result = libewf_glob_wide_determine_format(
-	          L"test.s01",
-	          8,
-	          &format,
+		for( filename_index = 0;
+		     filename_index < number_of_filenames;
+		     filename_index++ )
+		{
+			result = narrow_string_compare(
+			          filenames[ filename_index ],
+			          expected_filenames[ filename_index ],
+			          narrow_string_length( expected_filenames[ filename_index ] ) + 1 );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		result = libewf_glob_free(
+		          filenames,
+		          number_of_filenames,
+		          &error );
+
+		filenames           = NULL;
+		number_of_filenames = 0;
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libewf_glob_free(
+		          expected_filenames,
+		          expected_number_of_filenames,
+		          &error );
+
+		expected_filenames           = NULL;
+		expected_number_of_filenames = 0;
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libewf_glob_scan_directory(
+	          NULL,
+	          narrow_source_length,
+	          LIBEWF_FORMAT_UNKNOWN,
+	          &filenames,
+	          &number_of_filenames,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	EWF_TEST_ASSERT_EQUAL_UINT8(
-	 "format",
-	 format,
-	 LIBEWF_FORMAT_SMART );
+	 -1 );
 
-	EWF_TEST_ASSERT_IS_NULL(
+	EWF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libewf_glob_wide_determine_format(
-	          L"test.Ex01",
-	          9,
-	          &format,
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_glob_scan_directory(
+	          narrow_source,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBEWF_FORMAT_UNKNOWN,
+	          &filenames,
+	          &number_of_filenames,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	EWF_TEST_ASSERT_EQUAL_UINT8(
-	 "format",
-	 format,
-	 LIBEWF_FORMAT_V2_ENCASE7 );
+	 -1 );
 
-	EWF_TEST_ASSERT_IS_NULL(
+	EWF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libewf_glob_wide_determine_format(
-	          L"test.Lx01",
-	          9,
-	          &format,
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_glob_scan_directory(
+	          narrow_source,
+	          0,
+	          LIBEWF_FORMAT_UNKNOWN,
+	          &filenames,
+	          &number_of_filenames,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	EWF_TEST_ASSERT_EQUAL_UINT8(
-	 "format",
-	 format,
-	 LIBEWF_FORMAT_V2_LOGICAL_ENCASE7 );
+	 -1 );
 
-	EWF_TEST_ASSERT_IS_NULL(
+	EWF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libewf_glob_wide_determine_format(
-	          NULL,
-	          8,
-	          &format,
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_glob_scan_directory(
+	          narrow_source,
+	          narrow_source_length,
+	          0xff,
+	          &filenames,
+	          &number_of_filenames,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1728,10 +1782,12 @@ int ewf_test_glob_wide_determine_format(
 	libcerror_error_free(
 	 &error );
 
-	result = libewf_glob_wide_determine_format(
-	          L"test.x01",
-	          8,
-	          &format,
+	result = libewf_glob_scan_directory(
+	          narrow_source,
+	          narrow_source_length,
+	          LIBEWF_FORMAT_UNKNOWN,
+	          NULL,
+	          &number_of_filenames,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1746,12 +1802,18 @@ int ewf_test_glob_wide_determine_format(
 	libcerror_error_free(
 	 &error );
 
-	result = libewf_glob_wide_determine_format(
-	          L"test.E01",
-	          8,
-	          NULL,
+	filenames = (char **) 0x12345678UL;
+
+	result = libewf_glob_scan_directory(
+	          narrow_source,
+	          narrow_source_length,
+	          LIBEWF_FORMAT_UNKNOWN,
+	          &filenames,
+	          &number_of_filenames,
 	          &error );
 
+	filenames = NULL;
+
 	EWF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1764,10 +1826,12 @@ int ewf_test_glob_wide_determine_format(
 	libcerror_error_free(
 	 &error );
 
-	result = libewf_glob_wide_determine_format(
-	          L"test",
-	          4,
-	          &format,
+	result = libewf_glob_scan_directory(
+	          narrow_source,
+	          narrow_source_length,
+	          LIBEWF_FORMAT_UNKNOWN,
+	          &filenames,
+	          NULL,
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
@@ -1790,10 +1854,245 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	return( 0 );
-}
-
-/* Tests the libewf_glob_wide_get_segment_filename function
+	if( filenames != NULL )
+	{
+		libewf_glob_free(
+		 filenames,
+		 number_of_filenames,
+		 NULL );
+	}
+	if( expected_filenames != NULL )
+	{
+		libewf_glob_free(
+		 expected_filenames,
+		 expected_number_of_filenames,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+#if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
+
+/* Tests the libewf_glob_wide_determine_format function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_glob_wide_determine_format(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t format           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libewf_glob_wide_determine_format(
+	          L"test.E01",
+	          8,
+	          &format,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "format",
+	 format,
+	 LIBEWF_FORMAT_ENCASE5 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_glob_wide_determine_format(
+	          L"test.L01",
+	          8,
+	          &format,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "format",
+	 format,
+	 LIBEWF_FORMAT_LOGICAL_ENCASE5 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_glob_wide_determine_format(
+	          L"test.e01",
+	          8,
+	          &format,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "format",
+	 format,
+	 LIBEWF_FORMAT_EWF );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_glob_wide_determine_format(
+	          L"test.s01",
+	          8,
+	          &format,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "format",
+	 format,
+	 LIBEWF_FORMAT_SMART );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_glob_wide_determine_format(
+	          L"test.Ex01",
+	          9,
+	          &format,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "format",
+	 format,
+	 LIBEWF_FORMAT_V2_ENCASE7 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_glob_wide_determine_format(
+	          L"test.Lx01",
+	          9,
+	          &format,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "format",
+	 format,
+	 LIBEWF_FORMAT_V2_LOGICAL_ENCASE7 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libewf_glob_wide_determine_format(
+	          NULL,
+	          8,
+	          &format,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_glob_wide_determine_format(
+	          L"test.x01",
+	          8,
+	          &format,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_glob_wide_determine_format(
+	          L"test.E01",
+	          8,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_glob_wide_determine_format(
+	          L"test",
+	          4,
+	          &format,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_glob_wide_get_segment_filename function
  * Returns 1 if successful or 0 if not
  */
 int ewf_test_glob_wide_get_segment_filename(
@@ -1914,19 +2213,433 @@ int ewf_test_glob_wide_get_segment_filename(
 	libcerror_error_free(
 	 &error );
 
-	segment_filename = (char *) 0x12345678UL;
+	segment_filename = (char *) 0x12345678UL;
+
+	result = libewf_glob_wide_get_segment_filename(
+	          L"test.E01",
+	          8,
+	          4,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
+	          2,
+	          LIBEWF_FORMAT_LOGICAL_ENCASE5,
+	          &segment_filename,
+	          &error );
+
+	segment_filename = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	/* Test libewf_glob_wide_get_segment_filename with malloc failing
+	 */
+	ewf_test_malloc_attempts_before_fail = 0;
+
+	result = libewf_glob_wide_get_segment_filename(
+	          L"test.E01",
+	          8,
+	          4,
+	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
+	          2,
+	          LIBEWF_FORMAT_LOGICAL_ENCASE5,
+	          &segment_filename,
+	          &error );
+
+	if( ewf_test_malloc_attempts_before_fail != -1 )
+	{
+		ewf_test_malloc_attempts_before_fail = -1;
+
+		if( segment_filename != NULL )
+		{
+			memory_free(
+			 segment_filename );
+
+			segment_filename = NULL;
+		}
+	}
+	else
+	{
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "segment_filename",
+		 segment_filename );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_filename != NULL )
+	{
+		memory_free(
+		 segment_filename );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
+
+/* Tests the libewf_glob_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_glob_wide(
+     const system_character_t *source )
+{
+	wchar_t wide_source[ 256 ];
+
+	libcerror_error_t *error        = NULL;
+	wchar_t **filenames             = NULL;
+	size_t wide_source_length       = 0;
+	int number_of_filenames         = 0;
+	int result                      = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 3;
+	int test_number                 = 0;
+#endif
+
+	if( source != NULL )
+	{
+		/* Initialize test
+		 */
+		result = ewf_test_get_wide_source(
+		          source,
+		          wide_source,
+		          256,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		wide_source_length = wide_string_length(
+		                      wide_source );
+
+		/* Test regular cases
+		 */
+		result = libewf_glob_wide(
+		          wide_source,
+		          wide_source_length,
+		          LIBEWF_FORMAT_UNKNOWN,
+		          &filenames,
+		          &number_of_filenames,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libewf_glob_wide_free(
+		          filenames,
+		          number_of_filenames,
+		          &error );
+
+		filenames           = NULL;
+		number_of_filenames = 0;
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libewf_glob_wide(
+	          NULL,
+	          wide_source_length,
+	          LIBEWF_FORMAT_UNKNOWN,
+	          &filenames,
+	          &number_of_filenames,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_glob_wide(
+	          wide_source,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBEWF_FORMAT_UNKNOWN,
+	          &filenames,
+	          &number_of_filenames,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_glob_wide(
+	          wide_source,
+	          0,
+	          LIBEWF_FORMAT_UNKNOWN,
+	          &filenames,
+	          &number_of_filenames,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_glob_wide(
+	          wide_source,
+	          wide_source_length,
+	          0xff,
+	          &filenames,
+	          &number_of_filenames,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_glob_wide(
+	          wide_source,
+	          wide_source_length,
+	          LIBEWF_FORMAT_UNKNOWN,
+	          NULL,
+	          &number_of_filenames,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	filenames = (char **) 0x12345678UL;
+
+	result = libewf_glob_wide(
+	          wide_source,
+	          wide_source_length,
+	          LIBEWF_FORMAT_UNKNOWN,
+	          &filenames,
+	          &number_of_filenames,
+	          &error );
+
+	filenames = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libewf_glob_wide(
+	          wide_source,
+	          wide_source_length,
+	          LIBEWF_FORMAT_UNKNOWN,
+	          &filenames,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	if( source != NULL )
+	{
+		for( test_number = 0;
+		     test_number < number_of_malloc_fail_tests;
+		     test_number++ )
+		{
+			/* Test libewf_glob_wide with malloc failing
+			 */
+			ewf_test_malloc_attempts_before_fail = test_number;
+
+			result = libewf_glob_wide(
+			          wide_source,
+			          wide_source_length,
+			          LIBEWF_FORMAT_UNKNOWN,
+			          &filenames,
+			          &number_of_filenames,
+			          &error );
+
+			if( ewf_test_malloc_attempts_before_fail != -1 )
+			{
+				ewf_test_malloc_attempts_before_fail = -1;
+
+				if( filenames != NULL )
+				{
+					result = libewf_glob_wide_free(
+						  filenames,
+						  number_of_filenames,
+						  &error );
+
+					filenames           = NULL;
+					number_of_filenames = 0;
+				}
+			}
+			else
+			{
+				EWF_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 -1 );
+
+				EWF_TEST_ASSERT_IS_NULL(
+				 "filenames",
+				 filenames );
+
+				EWF_TEST_ASSERT_IS_NOT_NULL(
+				 "error",
+				 error );
+
+				libcerror_error_free(
+				 &error );
+			}
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filenames != NULL )
+	{
+		libewf_glob_wide_free(
+		 filenames,
+		 number_of_filenames,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libewf_glob_wide_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_glob_wide_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	wchar_t **filenames      = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libewf_glob_wide_free(
+	          NULL,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	filenames = (wchar_t **) 0x12345678UL;
 
-	result = libewf_glob_wide_get_segment_filename(
-	          L"test.E01",
-	          8,
-	          4,
-	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
-	          2,
-	          LIBEWF_FORMAT_LOGICAL_ENCASE5,
-	          &segment_filename,
+	result = libewf_glob_wide_free(
+	          filenames,
+	          -1,
 	          &error );
 
-	segment_filename = NULL;
+	filenames = NULL;
 
 	EWF_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1940,54 +2653,6 @@ int ewf_test_glob_wide_get_segment_filename(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_EWF_TEST_MEMORY )
-
-	/* Test libewf_glob_wide_get_segment_filename with malloc failing
-	 */
-	ewf_test_malloc_attempts_before_fail = 0;
-
-	result = libewf_glob_wide_get_segment_filename(
-	          L"test.E01",
-	          8,
-	          4,
-	          LIBEWF_SEGMENT_FILE_TYPE_EWF1,
-	          2,
-	          LIBEWF_FORMAT_LOGICAL_ENCASE5,
-	          &segment_filename,
-	          &error );
-
-	if( ewf_test_malloc_attempts_before_fail != -1 )
-	{
-		ewf_test_malloc_attempts_before_fail = -1;
-
-		if( segment_filename != NULL )
-		{
-			memory_free(
-			 segment_filename );
-
-			segment_filename = NULL;
-		}
-	}
-	else
-	{
-		EWF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EWF_TEST_ASSERT_IS_NULL(
-		 "segment_filename",
-		 segment_filename );
-
-		EWF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
-
 	return( 1 );
 
 on_error:
@@ -1996,34 +2661,25 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( segment_filename != NULL )
-	{
-		memory_free(
-		 segment_filename );
-	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT ) */
-
-/* Tests the libewf_glob_wide function
+/* Tests the libewf_glob_scan_directory_wide function
  * Returns 1 if successful or 0 if not
  */
-int ewf_test_glob_wide(
+int ewf_test_glob_scan_directory_wide(
      const system_character_t *source )
 {
 	wchar_t wide_source[ 256 ];
 
-	libcerror_error_t *error        = NULL;
-	wchar_t **filenames             = NULL;
-	size_t wide_source_length       = 0;
-	int number_of_filenames         = 0;
-	int result                      = 0;
-
-#if defined( HAVE_EWF_TEST_MEMORY )
-	int number_of_malloc_fail_tests = 3;
-	int test_number                 = 0;
-#endif
+	libcerror_error_t *error          = NULL;
+	wchar_t **expected_filenames      = NULL;
+	wchar_t **filenames               = NULL;
+	size_t wide_source_length         = 0;
+	int expected_number_of_filenames  = 0;
+	int filename_index                = 0;
+	int number_of_filenames           = 0;
+	int result                        = 0;
 
 	if( source != NULL )
 	{
@@ -2047,9 +2703,26 @@ int ewf_test_glob_wide(
 		wide_source_length = wide_string_length(
 		                      wide_source );
 
+		result = libewf_glob_wide(
+		          wide_source,
+		          wide_source_length,
+		          LIBEWF_FORMAT_UNKNOWN,
+		          &expected_filenames,
+		          &expected_number_of_filenames,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
 		/* Test regular cases
 		 */
-		result = libewf_glob_wide(
+		result = libewf_glob_scan_directory_wide(
 		          wide_source,
 		          wide_source_length,
 		          LIBEWF_FORMAT_UNKNOWN,
@@ -2062,10 +2735,29 @@ int ewf_test_glob_wide(
 		 result,
 		 1 );
 
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "number_of_filenames",
+		 number_of_filenames,
+		 expected_number_of_filenames );
+
 		EWF_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
+		for( filename_index = 0;
+		     filename_index < number_of_filenames;
+		     filename_index++ )
+		{
+			result = wide_string_compare(
+			          filenames[ filename_index ],
+			          expected_filenames[ filename_index ],
+			          wide_string_length( expected_filenames[ filename_index ] ) + 1 );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
 		result = libewf_glob_wide_free(
 		          filenames,
 		          number_of_filenames,
@@ -2074,6 +2766,23 @@ int ewf_test_glob_wide(
 		filenames           = NULL;
 		number_of_filenames = 0;
 
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libewf_glob_wide_free(
+		          expected_filenames,
+		          expected_number_of_filenames,
+		          &error );
+
+		expected_filenames           = NULL;
+		expected_number_of_filenames = 0;
+
 		EWF_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
@@ -2085,7 +2794,7 @@ int ewf_test_glob_wide(
 	}
 	/* Test error cases
 	 */
-	result = libewf_glob_wide(
+	result = libewf_glob_scan_directory_wide(
 	          NULL,
 	          wide_source_length,
 	          LIBEWF_FORMAT_UNKNOWN,
@@ -2105,7 +2814,7 @@ int ewf_test_glob_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libewf_glob_wide(
+	result = libewf_glob_scan_directory_wide(
 	          wide_source,
 	          (size_t) SSIZE_MAX + 1,
 	          LIBEWF_FORMAT_UNKNOWN,
@@ -2125,7 +2834,7 @@ int ewf_test_glob_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libewf_glob_wide(
+	result = libewf_glob_scan_directory_wide(
 	          wide_source,
 	          0,
 	          LIBEWF_FORMAT_UNKNOWN,
@@ -2145,7 +2854,7 @@ int ewf_test_glob_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libewf_glob_wide(
+	result = libewf_glob_scan_directory_wide(
 	          wide_source,
 	          wide_source_length,
 	          0xff,
@@ -2165,7 +2874,7 @@ int ewf_test_glob_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libewf_glob_wide(
+	result = libewf_glob_scan_directory_wide(
 	          wide_source,
 	          wide_source_length,
 	          LIBEWF_FORMAT_UNKNOWN,
@@ -2185,9 +2894,9 @@ int ewf_test_glob_wide(
 	libcerror_error_free(
 	 &error );
 
-	filenames = (char **) 0x12345678UL;
+	filenames = (wchar_t **) 0x12345678UL;
 
-	result = libewf_glob_wide(
+	result = libewf_glob_scan_directory_wide(
 	          wide_source,
 	          wide_source_length,
 	          LIBEWF_FORMAT_UNKNOWN,
@@ -2209,7 +2918,7 @@ int ewf_test_glob_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libewf_glob_wide(
+	result = libewf_glob_scan_directory_wide(
 	          wide_source,
 	          wide_source_length,
 	          LIBEWF_FORMAT_UNKNOWN,
@@ -2229,63 +2938,6 @@ int ewf_test_glob_wide(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_EWF_TEST_MEMORY )
-
-	if( source != NULL )
-	{
-		for( test_number = 0;
-		     test_number < number_of_malloc_fail_tests;
-		     test_number++ )
-		{
-			/* Test libewf_glob_wide with malloc failing
-			 */
-			ewf_test_malloc_attempts_before_fail = test_number;
-
-			result = libewf_glob_wide(
-			          wide_source,
-			          wide_source_length,
-			          LIBEWF_FORMAT_UNKNOWN,
-			          &filenames,
-			          &number_of_filenames,
-			          &error );
-
-			if( ewf_test_malloc_attempts_before_fail != -1 )
-			{
-				ewf_test_malloc_attempts_before_fail = -1;
-
-				if( filenames != NULL )
-				{
-					result = libewf_glob_wide_free(
-						  filenames,
-						  number_of_filenames,
-						  &error );
-
-					filenames           = NULL;
-					number_of_filenames = 0;
-				}
-			}
-			else
-			{
-				EWF_TEST_ASSERT_EQUAL_INT(
-				 "result",
-				 result,
-				 -1 );
-
-				EWF_TEST_ASSERT_IS_NULL(
-				 "filenames",
-				 filenames );
-
-				EWF_TEST_ASSERT_IS_NOT_NULL(
-				 "error",
-				 error );
-
-				libcerror_error_free(
-				 &error );
-			}
-		}
-	}
-#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
-
 	return( 1 );
 
 on_error:
@@ -2301,66 +2953,12 @@ on_error:
 		 number_of_filenames,
 		 NULL );
 	}
-	return( 0 );
-}
-
-/* Tests the libewf_glob_wide_free function
- * Returns 1 if successful or 0 if not
- */
-int ewf_test_glob_wide_free(
-     void )
-{
-	libcerror_error_t *error = NULL;
-	wchar_t **filenames      = NULL;
-	int result               = 0;
-
-	/* Test error cases
-	 */
-	result = libewf_glob_wide_free(
-	          NULL,
-	          0,
-	          &error );
-
-	EWF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	filenames = (wchar_t **) 0x12345678UL;
-
-	result = libewf_glob_wide_free(
-	          filenames,
-	          -1,
-	          &error );
-
-	filenames = NULL;
-
-	EWF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
+	if( expected_filenames != NULL )
 	{
-		libcerror_error_free(
-		 &error );
+		libewf_glob_wide_free(
+		 expected_filenames,
+		 expected_number_of_filenames,
+		 NULL );
 	}
 	return( 0 );
 }
@@ -2473,6 +3071,11 @@ int main(
 	 "libewf_glob_free",
 	 ewf_test_glob_free );
 
+	EWF_TEST_RUN_WITH_ARGS(
+	 "libewf_glob_scan_directory",
+	 ewf_test_glob_scan_directory,
+	 source );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 #if defined( __GNUC__ ) && !defined( LIBEWF_DLL_IMPORT )
 
@@ -2495,6 +3098,11 @@ int main(
 	 "libewf_glob_wide_free",
 	 ewf_test_glob_wide_free );
 
+	EWF_TEST_RUN_WITH_ARGS(
+	 "libewf_glob_scan_directory_wide",
+	 ewf_test_glob_scan_directory_wide,
+	 source );
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 #endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
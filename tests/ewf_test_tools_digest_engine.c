@@ -0,0 +1,4722 @@
+/*
+ * Tools digest_engine type test program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../ewftools/digest_engine.h"
+
+/* The test vectors from FIPS 180-2, the MD5 test vectors are calculated over the same data
+ */
+uint8_t ewf_test_tools_digest_engine_data_abc[ 3 ] = {
+	'a', 'b', 'c' };
+
+uint8_t ewf_test_tools_digest_engine_data_448bit[ 56 ] = {
+	'a', 'b', 'c', 'd', 'b', 'c', 'd', 'e', 'c', 'd', 'e', 'f', 'd', 'e', 'f', 'g',
+	'e', 'f', 'g', 'h', 'f', 'g', 'h', 'i', 'g', 'h', 'i', 'j', 'h', 'i', 'j', 'k',
+	'i', 'j', 'k', 'l', 'j', 'k', 'l', 'm', 'k', 'l', 'm', 'n', 'l', 'm', 'n', 'o',
+	'm', 'n', 'o', 'p', 'n', 'o', 'p', 'q' };
+
+uint8_t ewf_test_tools_digest_engine_md5_empty[ 16 ] = {
+	0xd4, 0x1d, 0x8c, 0xd9, 0x8f, 0x00, 0xb2, 0x04, 0xe9, 0x80, 0x09, 0x98, 0xec, 0xf8, 0x42, 0x7e };
+
+uint8_t ewf_test_tools_digest_engine_md5_abc[ 16 ] = {
+	0x90, 0x01, 0x50, 0x98, 0x3c, 0xd2, 0x4f, 0xb0, 0xd6, 0x96, 0x3f, 0x7d, 0x28, 0xe1, 0x7f, 0x72 };
+
+uint8_t ewf_test_tools_digest_engine_md5_448bit[ 16 ] = {
+	0x82, 0x15, 0xef, 0x07, 0x96, 0xa2, 0x0b, 0xca, 0xaa, 0xe1, 0x16, 0xd3, 0x87, 0x6c, 0x66, 0x4a };
+
+uint8_t ewf_test_tools_digest_engine_md5_million_a[ 16 ] = {
+	0x77, 0x07, 0xd6, 0xae, 0x4e, 0x02, 0x7c, 0x70, 0xee, 0xa2, 0xa9, 0x35, 0xc2, 0x29, 0x6f, 0x21 };
+
+uint8_t ewf_test_tools_digest_engine_sha1_empty[ 20 ] = {
+	0xda, 0x39, 0xa3, 0xee, 0x5e, 0x6b, 0x4b, 0x0d, 0x32, 0x55, 0xbf, 0xef, 0x95, 0x60, 0x18, 0x90,
+	0xaf, 0xd8, 0x07, 0x09 };
+
+uint8_t ewf_test_tools_digest_engine_sha1_abc[ 20 ] = {
+	0xa9, 0x99, 0x3e, 0x36, 0x47, 0x06, 0x81, 0x6a, 0xba, 0x3e, 0x25, 0x71, 0x78, 0x50, 0xc2, 0x6c,
+	0x9c, 0xd0, 0xd8, 0x9d };
+
+uint8_t ewf_test_tools_digest_engine_sha1_448bit[ 20 ] = {
+	0x84, 0x98, 0x3e, 0x44, 0x1c, 0x3b, 0xd2, 0x6e, 0xba, 0xae, 0x4a, 0xa1, 0xf9, 0x51, 0x29, 0xe5,
+	0xe5, 0x46, 0x70, 0xf1 };
+
+uint8_t ewf_test_tools_digest_engine_sha1_million_a[ 20 ] = {
+	0x34, 0xaa, 0x97, 0x3c, 0xd4, 0xc4, 0xda, 0xa4, 0xf6, 0x1e, 0xeb, 0x2b, 0xdb, 0xad, 0x27, 0x31,
+	0x65, 0x34, 0x01, 0x6f };
+
+uint8_t ewf_test_tools_digest_engine_sha256_empty[ 32 ] = {
+	0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14, 0x9a, 0xfb, 0xf4, 0xc8, 0x99, 0x6f, 0xb9, 0x24,
+	0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b, 0x93, 0x4c, 0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55 };
+
+uint8_t ewf_test_tools_digest_engine_sha256_abc[ 32 ] = {
+	0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+	0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad };
+
+uint8_t ewf_test_tools_digest_engine_sha256_448bit[ 32 ] = {
+	0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8, 0xe5, 0xc0, 0x26, 0x93, 0x0c, 0x3e, 0x60, 0x39,
+	0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67, 0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1 };
+
+uint8_t ewf_test_tools_digest_engine_sha256_million_a[ 32 ] = {
+	0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92, 0x81, 0xa1, 0xc7, 0xe2, 0x84, 0xd7, 0x3e, 0x67,
+	0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97, 0x20, 0x0e, 0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0 };
+
+/* The BLAKE3 test vectors
+ * The 1025, 8193 and 17408 vectors are calculated over the repeating byte sequence 0, 1, ..., 250
+ * as used by the BLAKE3 reference test vectors
+ */
+uint8_t ewf_test_tools_digest_engine_blake3_empty[ 32 ] = {
+	0xaf, 0x13, 0x49, 0xb9, 0xf5, 0xf9, 0xa1, 0xa6, 0xa0, 0x40, 0x4d, 0xea, 0x36, 0xdc, 0xc9, 0x49,
+	0x9b, 0xcb, 0x25, 0xc9, 0xad, 0xc1, 0x12, 0xb7, 0xcc, 0x9a, 0x93, 0xca, 0xe4, 0x1f, 0x32, 0x62 };
+
+uint8_t ewf_test_tools_digest_engine_blake3_abc[ 32 ] = {
+	0x64, 0x37, 0xb3, 0xac, 0x38, 0x46, 0x51, 0x33, 0xff, 0xb6, 0x3b, 0x75, 0x27, 0x3a, 0x8d, 0xb5,
+	0x48, 0xc5, 0x58, 0x46, 0x5d, 0x79, 0xdb, 0x03, 0xfd, 0x35, 0x9c, 0x6c, 0xd5, 0xbd, 0x9d, 0x85 };
+
+uint8_t ewf_test_tools_digest_engine_blake3_1025[ 32 ] = {
+	0xd0, 0x02, 0x78, 0xae, 0x47, 0xeb, 0x27, 0xb3, 0x4f, 0xae, 0xcf, 0x67, 0xb4, 0xfe, 0x26, 0x3f,
+	0x82, 0xd5, 0x41, 0x29, 0x16, 0xc1, 0xff, 0xd9, 0x7c, 0x8c, 0xb7, 0xfb, 0x81, 0x4b, 0x84, 0x44 };
+
+uint8_t ewf_test_tools_digest_engine_blake3_8193[ 32 ] = {
+	0xba, 0xb6, 0xc0, 0x9c, 0xb8, 0xce, 0x8c, 0xf4, 0x59, 0x26, 0x13, 0x98, 0xd2, 0xe7, 0xae, 0xf3,
+	0x57, 0x00, 0xbf, 0x48, 0x81, 0x16, 0xce, 0xb9, 0x4a, 0x36, 0xd0, 0xf5, 0xf1, 0xb7, 0xbc, 0x3b };
+
+uint8_t ewf_test_tools_digest_engine_blake3_17408[ 32 ] = {
+	0x99, 0x39, 0x24, 0xff, 0x3d, 0xcb, 0xd8, 0x68, 0xbe, 0x9c, 0xf3, 0xfe, 0xd9, 0x8d, 0x45, 0x38,
+	0xfe, 0x57, 0x9f, 0xfc, 0xcf, 0x39, 0x0a, 0x5a, 0xa1, 0xdd, 0xba, 0x0f, 0x6a, 0x20, 0xbf, 0xed };
+
+uint8_t ewf_test_tools_digest_engine_blake3_million_a[ 32 ] = {
+	0x61, 0x6f, 0x57, 0x5a, 0x1b, 0x58, 0xd4, 0xc9, 0x79, 0x7d, 0x42, 0x17, 0xb9, 0x73, 0x0a, 0xe5,
+	0xe6, 0xeb, 0x31, 0x9d, 0x76, 0xed, 0xef, 0x65, 0x49, 0xb4, 0x6f, 0x4e, 0xfe, 0x31, 0xff, 0x8b };
+
+/* Tests the digest_engine_get_hardware_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_get_hardware_flags(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t hardware_flags   = 0xff;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = digest_engine_get_hardware_flags(
+	          &hardware_flags,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT8(
+	 "hardware_flags",
+	 (uint8_t) ( hardware_flags & ~( DIGEST_ENGINE_HARDWARE_FLAG_SHA1 | DIGEST_ENGINE_HARDWARE_FLAG_SHA256 ) ),
+	 (uint8_t) 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_engine_get_hardware_flags(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_engine_md5_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_md5_initialize(
+     void )
+{
+	digest_engine_md5_context_t *context  = NULL;
+	libcerror_error_t *error              = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = digest_engine_md5_initialize(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_md5_free(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_engine_md5_initialize(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	context = (digest_engine_md5_context_t *) 0x12345678UL;
+
+	result = digest_engine_md5_initialize(
+	          &context,
+	          &error );
+
+	context = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_md5_initialize_with_flags(
+	          &context,
+	          0xff,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test digest_engine_md5_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = digest_engine_md5_initialize(
+		          &context,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( context != NULL )
+			{
+				digest_engine_md5_free(
+				 &context,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "context",
+			 context );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test digest_engine_md5_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = digest_engine_md5_initialize(
+		          &context,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( context != NULL )
+			{
+				digest_engine_md5_free(
+				 &context,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "context",
+			 context );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		digest_engine_md5_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_engine_md5_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_md5_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = digest_engine_md5_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Calculates a MD5 with the digest engine using updates of varying sizes
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_digest_engine_md5_calculate(
+     const uint8_t *buffer,
+     size_t size,
+     size_t number_of_repeats,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	digest_engine_md5_context_t *context  = NULL;
+	size_t buffer_offset                  = 0;
+	size_t update_size                    = 0;
+
+	if( digest_engine_md5_initialize(
+	     &context,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	while( number_of_repeats > 0 )
+	{
+		buffer_offset = 0;
+
+		while( buffer_offset < size )
+		{
+			/* Use update sizes that are not a multiple of the block size
+			 */
+			update_size = ( ( buffer_offset + number_of_repeats ) % 97 ) + 1;
+
+			if( update_size > ( size - buffer_offset ) )
+			{
+				update_size = size - buffer_offset;
+			}
+			if( digest_engine_md5_update(
+			     context,
+			     &( buffer[ buffer_offset ] ),
+			     update_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			buffer_offset += update_size;
+		}
+		number_of_repeats--;
+	}
+	if( digest_engine_md5_finalize(
+	     context,
+	     hash,
+	     hash_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( digest_engine_md5_free(
+	     &context,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( context != NULL )
+	{
+		digest_engine_md5_free(
+		 &context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the digest_engine_md5_update and digest_engine_md5_finalize functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_md5_update(
+     void )
+{
+	uint8_t buffer[ 1000 ];
+	uint8_t hash[ 16 ];
+
+	digest_engine_md5_context_t *context  = NULL;
+	libcerror_error_t *error              = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          buffer,
+	          'a',
+	          1000 ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = ewf_test_tools_digest_engine_md5_calculate(
+	          buffer,
+	          0,
+	          1,
+	          hash,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_md5_empty,
+	          16 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = ewf_test_tools_digest_engine_md5_calculate(
+	          ewf_test_tools_digest_engine_data_abc,
+	          3,
+	          1,
+	          hash,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_md5_abc,
+	          16 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = ewf_test_tools_digest_engine_md5_calculate(
+	          ewf_test_tools_digest_engine_data_448bit,
+	          56,
+	          1,
+	          hash,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_md5_448bit,
+	          16 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = ewf_test_tools_digest_engine_md5_calculate(
+	          buffer,
+	          1000,
+	          1000,
+	          hash,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_md5_million_a,
+	          16 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Initialize test
+	 */
+	result = digest_engine_md5_initialize(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_engine_md5_update(
+	          NULL,
+	          buffer,
+	          1000,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_md5_update(
+	          context,
+	          NULL,
+	          1000,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_md5_update(
+	          context,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_md5_finalize(
+	          NULL,
+	          hash,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_md5_finalize(
+	          context,
+	          NULL,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_md5_finalize(
+	          context,
+	          hash,
+	          16 - 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_engine_md5_free(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		digest_engine_md5_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_engine_md5_export_state and digest_engine_md5_import_state functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_md5_export_state(
+     void )
+{
+	uint8_t buffer[ 1000 ];
+	uint8_t hash[ 16 ];
+	uint8_t state[ DIGEST_ENGINE_MD5_STATE_SIZE ];
+
+	digest_engine_md5_context_t *context          = NULL;
+	digest_engine_md5_context_t *imported_context = NULL;
+	libcerror_error_t *error                      = NULL;
+	int repeat_index                              = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          buffer,
+	          'a',
+	          1000 ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = digest_engine_md5_initialize_with_flags(
+	          &context,
+	          DIGEST_ENGINE_FLAG_EXPORTABLE_STATE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_md5_initialize_with_flags(
+	          &imported_context,
+	          DIGEST_ENGINE_FLAG_EXPORTABLE_STATE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "imported_context",
+	 imported_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The state is exported in the middle of a block and the hashing is continued
+	 * in the imported context, which should result in the hash of the full data
+	 */
+	for( repeat_index = 0;
+	     repeat_index < 500;
+	     repeat_index++ )
+	{
+		result = digest_engine_md5_update(
+		          context,
+		          buffer,
+		          1000,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = digest_engine_md5_update(
+	          context,
+	          buffer,
+	          37,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = digest_engine_md5_export_state(
+	          context,
+	          state,
+	          DIGEST_ENGINE_MD5_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_md5_import_state(
+	          imported_context,
+	          state,
+	          DIGEST_ENGINE_MD5_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_md5_update(
+	          imported_context,
+	          buffer,
+	          1000 - 37,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( repeat_index = 0;
+	     repeat_index < 499;
+	     repeat_index++ )
+	{
+		result = digest_engine_md5_update(
+		          imported_context,
+		          buffer,
+		          1000,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = digest_engine_md5_finalize(
+	          imported_context,
+	          hash,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_md5_million_a,
+	          16 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = digest_engine_md5_export_state(
+	          NULL,
+	          state,
+	          DIGEST_ENGINE_MD5_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_md5_export_state(
+	          context,
+	          NULL,
+	          DIGEST_ENGINE_MD5_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_md5_export_state(
+	          context,
+	          state,
+	          DIGEST_ENGINE_MD5_STATE_SIZE - 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_md5_import_state(
+	          NULL,
+	          state,
+	          DIGEST_ENGINE_MD5_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_md5_import_state(
+	          context,
+	          NULL,
+	          DIGEST_ENGINE_MD5_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_md5_import_state(
+	          context,
+	          state,
+	          DIGEST_ENGINE_MD5_STATE_SIZE - 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that the state of a context without exportable state cannot be exported or imported
+	 */
+	result = digest_engine_md5_free(
+	          &imported_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = digest_engine_md5_initialize(
+	          &imported_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = digest_engine_md5_export_state(
+	          imported_context,
+	          state,
+	          DIGEST_ENGINE_MD5_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_md5_import_state(
+	          imported_context,
+	          state,
+	          DIGEST_ENGINE_MD5_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_engine_md5_free(
+	          &imported_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "imported_context",
+	 imported_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_md5_free(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( imported_context != NULL )
+	{
+		digest_engine_md5_free(
+		 &imported_context,
+		 NULL );
+	}
+	if( context != NULL )
+	{
+		digest_engine_md5_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_engine_sha1_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_sha1_initialize(
+     void )
+{
+	digest_engine_sha1_context_t *context = NULL;
+	libcerror_error_t *error              = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = digest_engine_sha1_initialize(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_sha1_free(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_engine_sha1_initialize(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	context = (digest_engine_sha1_context_t *) 0x12345678UL;
+
+	result = digest_engine_sha1_initialize(
+	          &context,
+	          &error );
+
+	context = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha1_initialize_with_flags(
+	          &context,
+	          0xff,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test digest_engine_sha1_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = digest_engine_sha1_initialize(
+		          &context,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( context != NULL )
+			{
+				digest_engine_sha1_free(
+				 &context,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "context",
+			 context );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test digest_engine_sha1_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = digest_engine_sha1_initialize(
+		          &context,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( context != NULL )
+			{
+				digest_engine_sha1_free(
+				 &context,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "context",
+			 context );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		digest_engine_sha1_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_engine_sha1_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_sha1_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = digest_engine_sha1_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Calculates a SHA1 with the digest engine using updates of varying sizes
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_digest_engine_sha1_calculate(
+     const uint8_t *buffer,
+     size_t size,
+     size_t number_of_repeats,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	digest_engine_sha1_context_t *context = NULL;
+	size_t buffer_offset                  = 0;
+	size_t update_size                    = 0;
+
+	if( digest_engine_sha1_initialize(
+	     &context,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	while( number_of_repeats > 0 )
+	{
+		buffer_offset = 0;
+
+		while( buffer_offset < size )
+		{
+			/* Use update sizes that are not a multiple of the block size
+			 */
+			update_size = ( ( buffer_offset + number_of_repeats ) % 97 ) + 1;
+
+			if( update_size > ( size - buffer_offset ) )
+			{
+				update_size = size - buffer_offset;
+			}
+			if( digest_engine_sha1_update(
+			     context,
+			     &( buffer[ buffer_offset ] ),
+			     update_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			buffer_offset += update_size;
+		}
+		number_of_repeats--;
+	}
+	if( digest_engine_sha1_finalize(
+	     context,
+	     hash,
+	     hash_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( digest_engine_sha1_free(
+	     &context,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( context != NULL )
+	{
+		digest_engine_sha1_free(
+		 &context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the digest_engine_sha1_update and digest_engine_sha1_finalize functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_sha1_update(
+     void )
+{
+	uint8_t buffer[ 1000 ];
+	uint8_t hash[ 20 ];
+
+	digest_engine_sha1_context_t *context = NULL;
+	libcerror_error_t *error              = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          buffer,
+	          'a',
+	          1000 ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = ewf_test_tools_digest_engine_sha1_calculate(
+	          buffer,
+	          0,
+	          1,
+	          hash,
+	          20,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_sha1_empty,
+	          20 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = ewf_test_tools_digest_engine_sha1_calculate(
+	          ewf_test_tools_digest_engine_data_abc,
+	          3,
+	          1,
+	          hash,
+	          20,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_sha1_abc,
+	          20 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = ewf_test_tools_digest_engine_sha1_calculate(
+	          ewf_test_tools_digest_engine_data_448bit,
+	          56,
+	          1,
+	          hash,
+	          20,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_sha1_448bit,
+	          20 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = ewf_test_tools_digest_engine_sha1_calculate(
+	          buffer,
+	          1000,
+	          1000,
+	          hash,
+	          20,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_sha1_million_a,
+	          20 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Initialize test
+	 */
+	result = digest_engine_sha1_initialize(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_engine_sha1_update(
+	          NULL,
+	          buffer,
+	          1000,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha1_update(
+	          context,
+	          NULL,
+	          1000,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha1_update(
+	          context,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha1_finalize(
+	          NULL,
+	          hash,
+	          20,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha1_finalize(
+	          context,
+	          NULL,
+	          20,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha1_finalize(
+	          context,
+	          hash,
+	          20 - 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_engine_sha1_free(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		digest_engine_sha1_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_engine_sha1_export_state and digest_engine_sha1_import_state functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_sha1_export_state(
+     void )
+{
+	uint8_t buffer[ 1000 ];
+	uint8_t hash[ 20 ];
+	uint8_t state[ DIGEST_ENGINE_SHA1_STATE_SIZE ];
+
+	digest_engine_sha1_context_t *context          = NULL;
+	digest_engine_sha1_context_t *imported_context = NULL;
+	libcerror_error_t *error                       = NULL;
+	int repeat_index                               = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          buffer,
+	          'a',
+	          1000 ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = digest_engine_sha1_initialize_with_flags(
+	          &context,
+	          DIGEST_ENGINE_FLAG_EXPORTABLE_STATE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_sha1_initialize_with_flags(
+	          &imported_context,
+	          DIGEST_ENGINE_FLAG_EXPORTABLE_STATE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "imported_context",
+	 imported_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The state is exported in the middle of a block and the hashing is continued
+	 * in the imported context, which should result in the hash of the full data
+	 */
+	for( repeat_index = 0;
+	     repeat_index < 500;
+	     repeat_index++ )
+	{
+		result = digest_engine_sha1_update(
+		          context,
+		          buffer,
+		          1000,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = digest_engine_sha1_update(
+	          context,
+	          buffer,
+	          37,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = digest_engine_sha1_export_state(
+	          context,
+	          state,
+	          DIGEST_ENGINE_SHA1_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_sha1_import_state(
+	          imported_context,
+	          state,
+	          DIGEST_ENGINE_SHA1_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_sha1_update(
+	          imported_context,
+	          buffer,
+	          1000 - 37,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( repeat_index = 0;
+	     repeat_index < 499;
+	     repeat_index++ )
+	{
+		result = digest_engine_sha1_update(
+		          imported_context,
+		          buffer,
+		          1000,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = digest_engine_sha1_finalize(
+	          imported_context,
+	          hash,
+	          20,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_sha1_million_a,
+	          20 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = digest_engine_sha1_export_state(
+	          NULL,
+	          state,
+	          DIGEST_ENGINE_SHA1_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha1_export_state(
+	          context,
+	          NULL,
+	          DIGEST_ENGINE_SHA1_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha1_export_state(
+	          context,
+	          state,
+	          DIGEST_ENGINE_SHA1_STATE_SIZE - 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha1_import_state(
+	          NULL,
+	          state,
+	          DIGEST_ENGINE_SHA1_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha1_import_state(
+	          context,
+	          NULL,
+	          DIGEST_ENGINE_SHA1_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha1_import_state(
+	          context,
+	          state,
+	          DIGEST_ENGINE_SHA1_STATE_SIZE - 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_engine_sha1_free(
+	          &imported_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "imported_context",
+	 imported_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_sha1_free(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( imported_context != NULL )
+	{
+		digest_engine_sha1_free(
+		 &imported_context,
+		 NULL );
+	}
+	if( context != NULL )
+	{
+		digest_engine_sha1_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_engine_sha256_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_sha256_initialize(
+     void )
+{
+	digest_engine_sha256_context_t *context = NULL;
+	libcerror_error_t *error                = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = digest_engine_sha256_initialize(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_sha256_free(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_engine_sha256_initialize(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	context = (digest_engine_sha256_context_t *) 0x12345678UL;
+
+	result = digest_engine_sha256_initialize(
+	          &context,
+	          &error );
+
+	context = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha256_initialize_with_flags(
+	          &context,
+	          0xff,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test digest_engine_sha256_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = digest_engine_sha256_initialize(
+		          &context,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( context != NULL )
+			{
+				digest_engine_sha256_free(
+				 &context,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "context",
+			 context );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test digest_engine_sha256_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = digest_engine_sha256_initialize(
+		          &context,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( context != NULL )
+			{
+				digest_engine_sha256_free(
+				 &context,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "context",
+			 context );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		digest_engine_sha256_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_engine_sha256_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_sha256_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = digest_engine_sha256_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Calculates a SHA256 with the digest engine using updates of varying sizes
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_digest_engine_sha256_calculate(
+     const uint8_t *buffer,
+     size_t size,
+     size_t number_of_repeats,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	digest_engine_sha256_context_t *context = NULL;
+	size_t buffer_offset                    = 0;
+	size_t update_size                      = 0;
+
+	if( digest_engine_sha256_initialize(
+	     &context,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	while( number_of_repeats > 0 )
+	{
+		buffer_offset = 0;
+
+		while( buffer_offset < size )
+		{
+			/* Use update sizes that are not a multiple of the block size
+			 */
+			update_size = ( ( buffer_offset + number_of_repeats ) % 97 ) + 1;
+
+			if( update_size > ( size - buffer_offset ) )
+			{
+				update_size = size - buffer_offset;
+			}
+			if( digest_engine_sha256_update(
+			     context,
+			     &( buffer[ buffer_offset ] ),
+			     update_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			buffer_offset += update_size;
+		}
+		number_of_repeats--;
+	}
+	if( digest_engine_sha256_finalize(
+	     context,
+	     hash,
+	     hash_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( digest_engine_sha256_free(
+	     &context,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( context != NULL )
+	{
+		digest_engine_sha256_free(
+		 &context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the digest_engine_sha256_update and digest_engine_sha256_finalize functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_sha256_update(
+     void )
+{
+	uint8_t buffer[ 1000 ];
+	uint8_t hash[ 32 ];
+
+	digest_engine_sha256_context_t *context = NULL;
+	libcerror_error_t *error                = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          buffer,
+	          'a',
+	          1000 ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = ewf_test_tools_digest_engine_sha256_calculate(
+	          buffer,
+	          0,
+	          1,
+	          hash,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_sha256_empty,
+	          32 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = ewf_test_tools_digest_engine_sha256_calculate(
+	          ewf_test_tools_digest_engine_data_abc,
+	          3,
+	          1,
+	          hash,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_sha256_abc,
+	          32 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = ewf_test_tools_digest_engine_sha256_calculate(
+	          ewf_test_tools_digest_engine_data_448bit,
+	          56,
+	          1,
+	          hash,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_sha256_448bit,
+	          32 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = ewf_test_tools_digest_engine_sha256_calculate(
+	          buffer,
+	          1000,
+	          1000,
+	          hash,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_sha256_million_a,
+	          32 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Initialize test
+	 */
+	result = digest_engine_sha256_initialize(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_engine_sha256_update(
+	          NULL,
+	          buffer,
+	          1000,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha256_update(
+	          context,
+	          NULL,
+	          1000,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha256_update(
+	          context,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha256_finalize(
+	          NULL,
+	          hash,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha256_finalize(
+	          context,
+	          NULL,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha256_finalize(
+	          context,
+	          hash,
+	          32 - 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_engine_sha256_free(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		digest_engine_sha256_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_engine_sha256_export_state and digest_engine_sha256_import_state functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_sha256_export_state(
+     void )
+{
+	uint8_t buffer[ 1000 ];
+	uint8_t hash[ 32 ];
+	uint8_t state[ DIGEST_ENGINE_SHA256_STATE_SIZE ];
+
+	digest_engine_sha256_context_t *context          = NULL;
+	digest_engine_sha256_context_t *imported_context = NULL;
+	libcerror_error_t *error                         = NULL;
+	int repeat_index                                 = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          buffer,
+	          'a',
+	          1000 ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = digest_engine_sha256_initialize_with_flags(
+	          &context,
+	          DIGEST_ENGINE_FLAG_EXPORTABLE_STATE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_sha256_initialize_with_flags(
+	          &imported_context,
+	          DIGEST_ENGINE_FLAG_EXPORTABLE_STATE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "imported_context",
+	 imported_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The state is exported in the middle of a block and the hashing is continued
+	 * in the imported context, which should result in the hash of the full data
+	 */
+	for( repeat_index = 0;
+	     repeat_index < 500;
+	     repeat_index++ )
+	{
+		result = digest_engine_sha256_update(
+		          context,
+		          buffer,
+		          1000,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = digest_engine_sha256_update(
+	          context,
+	          buffer,
+	          37,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = digest_engine_sha256_export_state(
+	          context,
+	          state,
+	          DIGEST_ENGINE_SHA256_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_sha256_import_state(
+	          imported_context,
+	          state,
+	          DIGEST_ENGINE_SHA256_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_sha256_update(
+	          imported_context,
+	          buffer,
+	          1000 - 37,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( repeat_index = 0;
+	     repeat_index < 499;
+	     repeat_index++ )
+	{
+		result = digest_engine_sha256_update(
+		          imported_context,
+		          buffer,
+		          1000,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = digest_engine_sha256_finalize(
+	          imported_context,
+	          hash,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_sha256_million_a,
+	          32 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = digest_engine_sha256_export_state(
+	          NULL,
+	          state,
+	          DIGEST_ENGINE_SHA256_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha256_export_state(
+	          context,
+	          NULL,
+	          DIGEST_ENGINE_SHA256_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha256_export_state(
+	          context,
+	          state,
+	          DIGEST_ENGINE_SHA256_STATE_SIZE - 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha256_import_state(
+	          NULL,
+	          state,
+	          DIGEST_ENGINE_SHA256_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha256_import_state(
+	          context,
+	          NULL,
+	          DIGEST_ENGINE_SHA256_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_sha256_import_state(
+	          context,
+	          state,
+	          DIGEST_ENGINE_SHA256_STATE_SIZE - 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_engine_sha256_free(
+	          &imported_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "imported_context",
+	 imported_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_sha256_free(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( imported_context != NULL )
+	{
+		digest_engine_sha256_free(
+		 &imported_context,
+		 NULL );
+	}
+	if( context != NULL )
+	{
+		digest_engine_sha256_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_engine_blake3_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_blake3_initialize(
+     void )
+{
+	digest_engine_blake3_context_t *context = NULL;
+	libcerror_error_t *error                = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = digest_engine_blake3_initialize(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_blake3_free(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_engine_blake3_initialize(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	context = (digest_engine_blake3_context_t *) 0x12345678UL;
+
+	result = digest_engine_blake3_initialize(
+	          &context,
+	          &error );
+
+	context = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test digest_engine_blake3_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = digest_engine_blake3_initialize(
+		          &context,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( context != NULL )
+			{
+				digest_engine_blake3_free(
+				 &context,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "context",
+			 context );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test digest_engine_blake3_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = digest_engine_blake3_initialize(
+		          &context,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( context != NULL )
+			{
+				digest_engine_blake3_free(
+				 &context,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "context",
+			 context );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		digest_engine_blake3_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_engine_blake3_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_blake3_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = digest_engine_blake3_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Calculates a BLAKE3 with the digest engine using updates of varying sizes
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_digest_engine_blake3_calculate(
+     const uint8_t *buffer,
+     size_t size,
+     size_t number_of_repeats,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	digest_engine_blake3_context_t *context = NULL;
+	size_t buffer_offset                    = 0;
+	size_t update_size                      = 0;
+
+	if( digest_engine_blake3_initialize(
+	     &context,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	while( number_of_repeats > 0 )
+	{
+		buffer_offset = 0;
+
+		while( buffer_offset < size )
+		{
+			/* Use update sizes that are not a multiple of the block size
+			 */
+			update_size = ( ( buffer_offset + number_of_repeats ) % 97 ) + 1;
+
+			if( update_size > ( size - buffer_offset ) )
+			{
+				update_size = size - buffer_offset;
+			}
+			if( digest_engine_blake3_update(
+			     context,
+			     &( buffer[ buffer_offset ] ),
+			     update_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			buffer_offset += update_size;
+		}
+		number_of_repeats--;
+	}
+	if( digest_engine_blake3_finalize(
+	     context,
+	     hash,
+	     hash_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( digest_engine_blake3_free(
+	     &context,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( context != NULL )
+	{
+		digest_engine_blake3_free(
+		 &context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the digest_engine_blake3_update and digest_engine_blake3_finalize functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_blake3_update(
+     void )
+{
+	uint8_t buffer[ 1000 ];
+	uint8_t data[ 8193 ];
+	uint8_t hash[ 32 ];
+
+	digest_engine_blake3_context_t *context = NULL;
+	libcerror_error_t *error                = NULL;
+	size_t data_offset                      = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          buffer,
+	          'a',
+	          1000 ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( data_offset = 0;
+	     data_offset < 8193;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+
+	/* Test regular cases
+	 */
+	result = ewf_test_tools_digest_engine_blake3_calculate(
+	          buffer,
+	          0,
+	          1,
+	          hash,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_blake3_empty,
+	          32 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = ewf_test_tools_digest_engine_blake3_calculate(
+	          ewf_test_tools_digest_engine_data_abc,
+	          3,
+	          1,
+	          hash,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_blake3_abc,
+	          32 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = ewf_test_tools_digest_engine_blake3_calculate(
+	          data,
+	          1025,
+	          1,
+	          hash,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_blake3_1025,
+	          32 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = ewf_test_tools_digest_engine_blake3_calculate(
+	          data,
+	          8193,
+	          1,
+	          hash,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_blake3_8193,
+	          32 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = ewf_test_tools_digest_engine_blake3_calculate(
+	          buffer,
+	          1000,
+	          1000,
+	          hash,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_blake3_million_a,
+	          32 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Initialize test
+	 */
+	result = digest_engine_blake3_initialize(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_engine_blake3_update(
+	          NULL,
+	          buffer,
+	          1000,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_update(
+	          context,
+	          NULL,
+	          1000,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_update(
+	          context,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_finalize(
+	          NULL,
+	          hash,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_finalize(
+	          context,
+	          NULL,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_finalize(
+	          context,
+	          hash,
+	          32 - 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_engine_blake3_free(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		digest_engine_blake3_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_engine_blake3_update_subtree and digest_engine_blake3_calculate_subtree_chaining_value functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_blake3_update_subtree(
+     void )
+{
+	uint8_t chaining_value[ 32 ];
+	uint8_t data[ 17408 ];
+	uint8_t hash[ 32 ];
+
+	digest_engine_blake3_context_t *context = NULL;
+	libcerror_error_t *error                = NULL;
+	size_t data_offset                      = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 17408;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	result = digest_engine_blake3_initialize(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	/* Test regular cases
+	 * The subtrees of 4096 and 8192 bytes are combined with sequentially hashed data
+	 */
+	result = digest_engine_blake3_update(
+	          context,
+	          data,
+	          4096,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_blake3_calculate_subtree_chaining_value(
+	          &( data[ 4096 ] ),
+	          4096,
+	          4096,
+	          chaining_value,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_blake3_update_subtree(
+	          context,
+	          chaining_value,
+	          32,
+	          4096,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_blake3_calculate_subtree_chaining_value(
+	          &( data[ 8192 ] ),
+	          8192,
+	          8192,
+	          chaining_value,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_blake3_update_subtree(
+	          context,
+	          chaining_value,
+	          32,
+	          8192,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_blake3_update(
+	          context,
+	          &( data[ 16384 ] ),
+	          1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_blake3_finalize(
+	          context,
+	          hash,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_blake3_17408,
+	          32 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test subtrees that could be the root or are not aligned
+	 */
+	result = digest_engine_blake3_calculate_subtree_chaining_value(
+	          data,
+	          4096,
+	          0,
+	          chaining_value,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_blake3_calculate_subtree_chaining_value(
+	          data,
+	          3072,
+	          3072,
+	          chaining_value,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_blake3_calculate_subtree_chaining_value(
+	          data,
+	          4096,
+	          2048,
+	          chaining_value,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = digest_engine_blake3_free(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_engine_blake3_calculate_subtree_chaining_value(
+	          NULL,
+	          4096,
+	          4096,
+	          chaining_value,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_calculate_subtree_chaining_value(
+	          data,
+	          4096,
+	          4096,
+	          NULL,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_calculate_subtree_chaining_value(
+	          data,
+	          4096,
+	          4096,
+	          chaining_value,
+	          32 - 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_initialize(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_blake3_update_subtree(
+	          NULL,
+	          chaining_value,
+	          32,
+	          4096,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_update_subtree(
+	          context,
+	          NULL,
+	          32,
+	          4096,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_update_subtree(
+	          context,
+	          chaining_value,
+	          32 - 1,
+	          4096,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A subtree cannot be the first subtree since it could be the root
+	 */
+	result = digest_engine_blake3_update_subtree(
+	          context,
+	          chaining_value,
+	          32,
+	          4096,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_update(
+	          context,
+	          data,
+	          1024,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A subtree must be aligned to its size
+	 */
+	result = digest_engine_blake3_update_subtree(
+	          context,
+	          chaining_value,
+	          32,
+	          2048,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_update_subtree(
+	          context,
+	          chaining_value,
+	          32,
+	          3072,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_engine_blake3_free(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		digest_engine_blake3_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_engine_blake3_export_state and digest_engine_blake3_import_state functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_engine_blake3_export_state(
+     void )
+{
+	uint8_t buffer[ 1000 ];
+	uint8_t hash[ 32 ];
+	uint8_t state[ DIGEST_ENGINE_BLAKE3_STATE_SIZE ];
+
+	digest_engine_blake3_context_t *context          = NULL;
+	digest_engine_blake3_context_t *imported_context = NULL;
+	libcerror_error_t *error                         = NULL;
+	int repeat_index                                 = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          buffer,
+	          'a',
+	          1000 ) != NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = digest_engine_blake3_initialize(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_blake3_initialize(
+	          &imported_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "imported_context",
+	 imported_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The state is exported in the middle of a block and the hashing is continued
+	 * in the imported context, which should result in the hash of the full data
+	 */
+	for( repeat_index = 0;
+	     repeat_index < 500;
+	     repeat_index++ )
+	{
+		result = digest_engine_blake3_update(
+		          context,
+		          buffer,
+		          1000,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = digest_engine_blake3_update(
+	          context,
+	          buffer,
+	          37,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = digest_engine_blake3_export_state(
+	          context,
+	          state,
+	          DIGEST_ENGINE_BLAKE3_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_blake3_import_state(
+	          imported_context,
+	          state,
+	          DIGEST_ENGINE_BLAKE3_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_blake3_update(
+	          imported_context,
+	          buffer,
+	          1000 - 37,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( repeat_index = 0;
+	     repeat_index < 499;
+	     repeat_index++ )
+	{
+		result = digest_engine_blake3_update(
+		          imported_context,
+		          buffer,
+		          1000,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = digest_engine_blake3_finalize(
+	          imported_context,
+	          hash,
+	          32,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          ewf_test_tools_digest_engine_blake3_million_a,
+	          32 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = digest_engine_blake3_export_state(
+	          NULL,
+	          state,
+	          DIGEST_ENGINE_BLAKE3_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_export_state(
+	          context,
+	          NULL,
+	          DIGEST_ENGINE_BLAKE3_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_export_state(
+	          context,
+	          state,
+	          DIGEST_ENGINE_BLAKE3_STATE_SIZE - 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_import_state(
+	          NULL,
+	          state,
+	          DIGEST_ENGINE_BLAKE3_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_import_state(
+	          context,
+	          NULL,
+	          DIGEST_ENGINE_BLAKE3_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_engine_blake3_import_state(
+	          context,
+	          state,
+	          DIGEST_ENGINE_BLAKE3_STATE_SIZE - 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test import with an invalid stack depth
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( state[ 120 ] ),
+	 DIGEST_ENGINE_BLAKE3_MAXIMUM_STACK_DEPTH + 1 );
+
+	result = digest_engine_blake3_import_state(
+	          context,
+	          state,
+	          DIGEST_ENGINE_BLAKE3_STATE_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_engine_blake3_free(
+	          &imported_context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "imported_context",
+	 imported_context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_engine_blake3_free(
+	          &context,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( imported_context != NULL )
+	{
+		digest_engine_blake3_free(
+		 &imported_context,
+		 NULL );
+	}
+	if( context != NULL )
+	{
+		digest_engine_blake3_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EWF_TEST_RUN(
+	 "digest_engine_get_hardware_flags",
+	 ewf_test_tools_digest_engine_get_hardware_flags );
+
+	EWF_TEST_RUN(
+	 "digest_engine_md5_initialize",
+	 ewf_test_tools_digest_engine_md5_initialize );
+
+	EWF_TEST_RUN(
+	 "digest_engine_md5_free",
+	 ewf_test_tools_digest_engine_md5_free );
+
+	EWF_TEST_RUN(
+	 "digest_engine_md5_update",
+	 ewf_test_tools_digest_engine_md5_update );
+
+	EWF_TEST_RUN(
+	 "digest_engine_md5_export_state",
+	 ewf_test_tools_digest_engine_md5_export_state );
+
+	EWF_TEST_RUN(
+	 "digest_engine_sha1_initialize",
+	 ewf_test_tools_digest_engine_sha1_initialize );
+
+	EWF_TEST_RUN(
+	 "digest_engine_sha1_free",
+	 ewf_test_tools_digest_engine_sha1_free );
+
+	EWF_TEST_RUN(
+	 "digest_engine_sha1_update",
+	 ewf_test_tools_digest_engine_sha1_update );
+
+	EWF_TEST_RUN(
+	 "digest_engine_sha1_export_state",
+	 ewf_test_tools_digest_engine_sha1_export_state );
+
+	EWF_TEST_RUN(
+	 "digest_engine_sha256_initialize",
+	 ewf_test_tools_digest_engine_sha256_initialize );
+
+	EWF_TEST_RUN(
+	 "digest_engine_sha256_free",
+	 ewf_test_tools_digest_engine_sha256_free );
+
+	EWF_TEST_RUN(
+	 "digest_engine_sha256_update",
+	 ewf_test_tools_digest_engine_sha256_update );
+
+	EWF_TEST_RUN(
+	 "digest_engine_sha256_export_state",
+	 ewf_test_tools_digest_engine_sha256_export_state );
+
+	EWF_TEST_RUN(
+	 "digest_engine_blake3_initialize",
+	 ewf_test_tools_digest_engine_blake3_initialize );
+
+	EWF_TEST_RUN(
+	 "digest_engine_blake3_free",
+	 ewf_test_tools_digest_engine_blake3_free );
+
+	EWF_TEST_RUN(
+	 "digest_engine_blake3_update",
+	 ewf_test_tools_digest_engine_blake3_update );
+
+	EWF_TEST_RUN(
+	 "digest_engine_blake3_update_subtree",
+	 ewf_test_tools_digest_engine_blake3_update_subtree );
+
+	EWF_TEST_RUN(
+	 "digest_engine_blake3_export_state",
+	 ewf_test_tools_digest_engine_blake3_export_state );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1296 @@
+/*
+ * Tools digest_pipeline type test program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../ewftools/digest_pipeline.h"
+
+/* Test stage update function that sums the byte values in the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_digest_pipeline_sum_update(
+     uint64_t *sum,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error EWF_TEST_ATTRIBUTE_UNUSED )
+{
+	size_t buffer_index = 0;
+
+	EWF_TEST_UNREFERENCED_PARAMETER( error )
+
+	for( buffer_index = 0;
+	     buffer_index < size;
+	     buffer_index++ )
+	{
+		*sum += buffer[ buffer_index ];
+	}
+	return( 1 );
+}
+
+/* Test stage update function that fails
+ * Returns -1
+ */
+int ewf_test_tools_digest_pipeline_failing_update(
+     uint64_t *sum EWF_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *buffer EWF_TEST_ATTRIBUTE_UNUSED,
+     size_t size EWF_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	static char *function = "ewf_test_tools_digest_pipeline_failing_update";
+
+	EWF_TEST_UNREFERENCED_PARAMETER( sum )
+	EWF_TEST_UNREFERENCED_PARAMETER( buffer )
+	EWF_TEST_UNREFERENCED_PARAMETER( size )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: failing update.",
+	 function );
+
+	return( -1 );
+}
+
+/* Test release function that marks the value as released
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_digest_pipeline_release(
+     intptr_t *context EWF_TEST_ATTRIBUTE_UNUSED,
+     uint8_t *is_released,
+     libcerror_error_t **error EWF_TEST_ATTRIBUTE_UNUSED )
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( context )
+	EWF_TEST_UNREFERENCED_PARAMETER( error )
+
+	*is_released += 1;
+
+	return( 1 );
+}
+
+/* Tests the digest_pipeline_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_pipeline_initialize(
+     void )
+{
+	digest_pipeline_t *digest_pipeline = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 1;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = digest_pipeline_initialize(
+	          &digest_pipeline,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "digest_pipeline",
+	 digest_pipeline );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_pipeline_free(
+	          &digest_pipeline,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "digest_pipeline",
+	 digest_pipeline );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_pipeline_initialize(
+	          NULL,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	digest_pipeline = (digest_pipeline_t *) 0x12345678UL;
+
+	result = digest_pipeline_initialize(
+	          &digest_pipeline,
+	          1,
+	          &error );
+
+	digest_pipeline = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test digest_pipeline_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = digest_pipeline_initialize(
+		          &digest_pipeline,
+		          1,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( digest_pipeline != NULL )
+			{
+				digest_pipeline_free(
+				 &digest_pipeline,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "digest_pipeline",
+			 digest_pipeline );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test digest_pipeline_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = digest_pipeline_initialize(
+		          &digest_pipeline,
+		          1,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( digest_pipeline != NULL )
+			{
+				digest_pipeline_free(
+				 &digest_pipeline,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "digest_pipeline",
+			 digest_pipeline );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_pipeline != NULL )
+	{
+		digest_pipeline_free(
+		 &digest_pipeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_pipeline_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_pipeline_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = digest_pipeline_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_pipeline_append_stage function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_pipeline_append_stage(
+     void )
+{
+	digest_pipeline_t *digest_pipeline = NULL;
+	libcerror_error_t *error           = NULL;
+	uint64_t sum                       = 0;
+	int result                         = 0;
+	int stage_index                    = 0;
+
+	/* Initialize test
+	 */
+	result = digest_pipeline_initialize(
+	          &digest_pipeline,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "digest_pipeline",
+	 digest_pipeline );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( stage_index = 0;
+	     stage_index < DIGEST_PIPELINE_MAXIMUM_NUMBER_OF_STAGES;
+	     stage_index++ )
+	{
+		result = digest_pipeline_append_stage(
+		          digest_pipeline,
+		          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &ewf_test_tools_digest_pipeline_sum_update,
+		          (intptr_t *) &sum,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "digest_pipeline->number_of_stages",
+	 digest_pipeline->number_of_stages,
+	 DIGEST_PIPELINE_MAXIMUM_NUMBER_OF_STAGES );
+
+	/* Test error cases
+	 */
+	result = digest_pipeline_append_stage(
+	          NULL,
+	          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &ewf_test_tools_digest_pipeline_sum_update,
+	          (intptr_t *) &sum,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the maximum number of stages was reached
+	 */
+	result = digest_pipeline_append_stage(
+	          digest_pipeline,
+	          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &ewf_test_tools_digest_pipeline_sum_update,
+	          (intptr_t *) &sum,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	digest_pipeline->number_of_stages = 0;
+
+	result = digest_pipeline_append_stage(
+	          digest_pipeline,
+	          NULL,
+	          (intptr_t *) &sum,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_pipeline_append_stage(
+	          digest_pipeline,
+	          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &ewf_test_tools_digest_pipeline_sum_update,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_pipeline_free(
+	          &digest_pipeline,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "digest_pipeline",
+	 digest_pipeline );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_pipeline != NULL )
+	{
+		digest_pipeline_free(
+		 &digest_pipeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_pipeline_update function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_pipeline_update(
+     void )
+{
+	uint8_t buffer[ 256 ];
+	uint8_t update_buffer[ 256 ];
+
+	digest_pipeline_t *digest_pipeline = NULL;
+	libcerror_error_t *error           = NULL;
+	uint64_t sums[ 3 ]                 = { 0, 0, 0 };
+	size_t buffer_index                = 0;
+	int iteration                      = 0;
+	int result                         = 0;
+	int stage_index                    = 0;
+	uint8_t use_threads                = 0;
+
+	for( buffer_index = 0;
+	     buffer_index < 256;
+	     buffer_index++ )
+	{
+		buffer[ buffer_index ] = (uint8_t) buffer_index;
+	}
+	for( use_threads = 0;
+	     use_threads < 2;
+	     use_threads++ )
+	{
+		sums[ 0 ] = 0;
+		sums[ 1 ] = 0;
+		sums[ 2 ] = 0;
+
+		/* Initialize test
+		 */
+		result = digest_pipeline_initialize(
+		          &digest_pipeline,
+		          use_threads,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "digest_pipeline",
+		 digest_pipeline );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( stage_index = 0;
+		     stage_index < 3;
+		     stage_index++ )
+		{
+			result = digest_pipeline_append_stage(
+			          digest_pipeline,
+			          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &ewf_test_tools_digest_pipeline_sum_update,
+			          (intptr_t *) &( sums[ stage_index ] ),
+			          &error );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = digest_pipeline_start(
+		          digest_pipeline,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		for( iteration = 0;
+		     iteration < 64;
+		     iteration++ )
+		{
+			for( buffer_index = 0;
+			     buffer_index < 256;
+			     buffer_index++ )
+			{
+				update_buffer[ buffer_index ] = buffer[ buffer_index ];
+			}
+			result = digest_pipeline_update(
+			          digest_pipeline,
+			          update_buffer,
+			          256,
+			          &error );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			/* The buffer can be reused after the update returned
+			 */
+			for( buffer_index = 0;
+			     buffer_index < 256;
+			     buffer_index++ )
+			{
+				update_buffer[ buffer_index ] = 0xff;
+			}
+		}
+		result = digest_pipeline_flush(
+		          digest_pipeline,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Every stage digested every buffer before the flush returned
+		 */
+		for( stage_index = 0;
+		     stage_index < 3;
+		     stage_index++ )
+		{
+			EWF_TEST_ASSERT_EQUAL_UINT64(
+			 "sums[ stage_index ]",
+			 sums[ stage_index ],
+			 (uint64_t) 64 * 32640 );
+		}
+		/* Test error cases
+		 */
+		result = digest_pipeline_update(
+		          NULL,
+		          buffer,
+		          256,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = digest_pipeline_update(
+		          digest_pipeline,
+		          NULL,
+		          256,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = digest_pipeline_update(
+		          digest_pipeline,
+		          buffer,
+		          (size_t) SSIZE_MAX + 1,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Test error case where a stage fails
+		 */
+		digest_pipeline->stages[ 2 ].update = (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &ewf_test_tools_digest_pipeline_failing_update;
+
+		result = digest_pipeline_update(
+		          digest_pipeline,
+		          buffer,
+		          256,
+		          &error );
+
+		/* A stage that runs on its own thread fails after the update returned
+		 */
+		if( result == 1 )
+		{
+			result = digest_pipeline_flush(
+			          digest_pipeline,
+			          &error );
+		}
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Clean up
+		 */
+		result = digest_pipeline_free(
+		          &digest_pipeline,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "digest_pipeline",
+		 digest_pipeline );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_pipeline != NULL )
+	{
+		digest_pipeline_free(
+		 &digest_pipeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_pipeline_update_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_pipeline_update_reference(
+     void )
+{
+	uint8_t buffers[ 64 ][ 256 ];
+	uint8_t is_released[ 64 ];
+
+	digest_pipeline_t *digest_pipeline = NULL;
+	libcerror_error_t *error           = NULL;
+	uint64_t sums[ 3 ]                 = { 0, 0, 0 };
+	size_t buffer_index                = 0;
+	int iteration                      = 0;
+	int result                         = 0;
+	int stage_index                    = 0;
+	uint8_t use_threads                = 0;
+
+	for( iteration = 0;
+	     iteration < 64;
+	     iteration++ )
+	{
+		for( buffer_index = 0;
+		     buffer_index < 256;
+		     buffer_index++ )
+		{
+			buffers[ iteration ][ buffer_index ] = (uint8_t) buffer_index;
+		}
+	}
+	for( use_threads = 0;
+	     use_threads < 2;
+	     use_threads++ )
+	{
+		sums[ 0 ] = 0;
+		sums[ 1 ] = 0;
+		sums[ 2 ] = 0;
+
+		for( iteration = 0;
+		     iteration < 64;
+		     iteration++ )
+		{
+			is_released[ iteration ] = 0;
+		}
+		/* Initialize test
+		 */
+		result = digest_pipeline_initialize(
+		          &digest_pipeline,
+		          use_threads,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "digest_pipeline",
+		 digest_pipeline );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( stage_index = 0;
+		     stage_index < 3;
+		     stage_index++ )
+		{
+			result = digest_pipeline_append_stage(
+			          digest_pipeline,
+			          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &ewf_test_tools_digest_pipeline_sum_update,
+			          (intptr_t *) &( sums[ stage_index ] ),
+			          &error );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = digest_pipeline_start(
+		          digest_pipeline,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error case where the release function is missing
+		 */
+		result = digest_pipeline_update_reference(
+		          digest_pipeline,
+		          buffers[ 0 ],
+		          256,
+		          (intptr_t *) &( is_released[ 0 ] ),
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = digest_pipeline_set_release_function(
+		          digest_pipeline,
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &ewf_test_tools_digest_pipeline_release,
+		          NULL,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		for( iteration = 0;
+		     iteration < 64;
+		     iteration++ )
+		{
+			result = digest_pipeline_update_reference(
+			          digest_pipeline,
+			          buffers[ iteration ],
+			          256,
+			          (intptr_t *) &( is_released[ iteration ] ),
+			          &error );
+
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = digest_pipeline_flush(
+		          digest_pipeline,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Every stage digested every buffer and every value was released once
+		 * before the flush returned
+		 */
+		for( stage_index = 0;
+		     stage_index < 3;
+		     stage_index++ )
+		{
+			EWF_TEST_ASSERT_EQUAL_UINT64(
+			 "sums[ stage_index ]",
+			 sums[ stage_index ],
+			 (uint64_t) 64 * 32640 );
+		}
+		for( iteration = 0;
+		     iteration < 64;
+		     iteration++ )
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "is_released[ iteration ]",
+			 (int) is_released[ iteration ],
+			 1 );
+		}
+		/* Test error cases
+		 */
+		result = digest_pipeline_update_reference(
+		          NULL,
+		          buffers[ 0 ],
+		          256,
+		          (intptr_t *) &( is_released[ 0 ] ),
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = digest_pipeline_update_reference(
+		          digest_pipeline,
+		          buffers[ 0 ],
+		          256,
+		          NULL,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Test error case where the value is released when the update fails
+		 */
+		is_released[ 0 ] = 0;
+
+		result = digest_pipeline_update_reference(
+		          digest_pipeline,
+		          NULL,
+		          256,
+		          (intptr_t *) &( is_released[ 0 ] ),
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "is_released[ 0 ]",
+		 (int) is_released[ 0 ],
+		 1 );
+
+		/* Test error case where a stage fails
+		 */
+		is_released[ 0 ] = 0;
+
+		digest_pipeline->stages[ 2 ].update = (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &ewf_test_tools_digest_pipeline_failing_update;
+
+		result = digest_pipeline_update_reference(
+		          digest_pipeline,
+		          buffers[ 0 ],
+		          256,
+		          (intptr_t *) &( is_released[ 0 ] ),
+		          &error );
+
+		/* A stage that runs on its own thread fails after the update returned
+		 */
+		if( result == 1 )
+		{
+			result = digest_pipeline_flush(
+			          digest_pipeline,
+			          &error );
+		}
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EWF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "is_released[ 0 ]",
+		 (int) is_released[ 0 ],
+		 1 );
+
+		/* Clean up
+		 */
+		result = digest_pipeline_free(
+		          &digest_pipeline,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "digest_pipeline",
+		 digest_pipeline );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_pipeline != NULL )
+	{
+		digest_pipeline_free(
+		 &digest_pipeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_pipeline_flush function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_digest_pipeline_flush(
+     void )
+{
+	digest_pipeline_t *digest_pipeline = NULL;
+	libcerror_error_t *error           = NULL;
+	uint64_t sums[ 2 ]                 = { 0, 0 };
+	int result                         = 0;
+	int stage_index                    = 0;
+
+	/* Initialize test
+	 */
+	result = digest_pipeline_initialize(
+	          &digest_pipeline,
+	          1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "digest_pipeline",
+	 digest_pipeline );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( stage_index = 0;
+	     stage_index < 2;
+	     stage_index++ )
+	{
+		result = digest_pipeline_append_stage(
+		          digest_pipeline,
+		          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &ewf_test_tools_digest_pipeline_sum_update,
+		          (intptr_t *) &( sums[ stage_index ] ),
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = digest_pipeline_flush(
+	          digest_pipeline,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_pipeline_start(
+	          digest_pipeline,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_pipeline_flush(
+	          digest_pipeline,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_pipeline_flush(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_pipeline_free(
+	          &digest_pipeline,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "digest_pipeline",
+	 digest_pipeline );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_pipeline != NULL )
+	{
+		digest_pipeline_free(
+		 &digest_pipeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EWF_TEST_RUN(
+	 "digest_pipeline_initialize",
+	 ewf_test_tools_digest_pipeline_initialize );
+
+	EWF_TEST_RUN(
+	 "digest_pipeline_free",
+	 ewf_test_tools_digest_pipeline_free );
+
+	EWF_TEST_RUN(
+	 "digest_pipeline_append_stage",
+	 ewf_test_tools_digest_pipeline_append_stage );
+
+	EWF_TEST_RUN(
+	 "digest_pipeline_update",
+	 ewf_test_tools_digest_pipeline_update );
+
+	EWF_TEST_RUN(
+	 "digest_pipeline_update_reference",
+	 ewf_test_tools_digest_pipeline_update_reference );
+
+	EWF_TEST_RUN(
+	 "digest_pipeline_flush",
+	 ewf_test_tools_digest_pipeline_flush );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
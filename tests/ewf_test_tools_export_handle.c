@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -35,6 +36,17 @@
 #include "ewf_test_unused.h"
 
 #include "../ewftools/export_handle.h"
+#include "../ewftools/storage_media_buffer.h"
+
+/* The size of the storage media buffers written by the positional write test
+ */
+#define EWF_TEST_EXPORT_HANDLE_BUFFER_SIZE	4096
+
+/* The chunk size and number of chunks of the source image of the chunk passthrough test
+ * The chunks that cannot be compressed exceed the minimum segment file size
+ */
+#define EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE	( 64 * 512 )
+#define EWF_TEST_EXPORT_HANDLE_NUMBER_OF_CHUNKS	96
 
 /* Tests the export_handle_initialize function
  * Returns 1 if successful or 0 if not
@@ -391,140 +403,1539 @@ on_error:
 	return( 0 );
 }
 
-/* The main program
+/* Tests the export_handle_open_raw_output_file_descriptor function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc EWF_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc EWF_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
-#endif
+int ewf_test_tools_export_handle_open_raw_output_file_descriptor(
+     export_handle_t *handle )
 {
-	export_handle_t *export_handle = NULL;
-	libcerror_error_t *error       = NULL;
-	int result                     = 0;
-
-	EWF_TEST_UNREFERENCED_PARAMETER( argc )
-	EWF_TEST_UNREFERENCED_PARAMETER( argv )
-
-	EWF_TEST_RUN(
-	 "export_handle_initialize",
-	 ewf_test_tools_export_handle_initialize );
-
-	EWF_TEST_RUN(
-	 "export_handle_free",
-	 ewf_test_tools_export_handle_free );
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
-#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
-	/* Initialize info handle for tests
+	/* Test error cases
 	 */
-	result = export_handle_initialize(
-	          &export_handle,
-	          1,
-	          0,
+	result = export_handle_open_raw_output_file_descriptor(
+	          NULL,
+	          _SYSTEM_STRING( "ewf_test_export_raw" ),
 	          &error );
 
 	EWF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	EWF_TEST_ASSERT_IS_NOT_NULL(
-	 "export_handle",
-	 export_handle );
-
-	EWF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	EWF_TEST_RUN_WITH_ARGS(
-	 "export_handle_signal_abort",
-	 ewf_test_tools_export_handle_signal_abort,
-	 export_handle );
-
-	EWF_TEST_RUN_WITH_ARGS(
-	 "export_handle_set_maximum_number_of_open_handles",
-	 ewf_test_tools_export_handle_set_maximum_number_of_open_handles,
-	 export_handle );
+	libcerror_error_free(
+	 &error );
 
-	/* TODO add tests for export_handle_check_write_access */
+	result = export_handle_open_raw_output_file_descriptor(
+	          handle,
+	          NULL,
+	          &error );
 
-	/* TODO add tests for export_handle_open_input */
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	/* TODO add tests for export_handle_open_output */
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* TODO add tests for export_handle_close */
+	libcerror_error_free(
+	 &error );
 
-	/* TODO add tests for export_handle_read_storage_media_buffer */
+	return( 1 );
 
-	/* TODO add tests for export_handle_prepare_write_storage_media_buffer */
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-	/* TODO add tests for export_handle_write_storage_media_buffer */
+/* Calculates the Adler-32 checksum of a buffer
+ * Returns the checksum
+ */
+uint32_t ewf_test_tools_export_handle_calculate_adler32(
+          const uint8_t *buffer,
+          size_t size )
+{
+	uint32_t lower_word = 1;
+	uint32_t upper_word = 0;
+	size_t buffer_index = 0;
 
-	/* TODO add tests for export_handle_seek_offset */
+	for( buffer_index = 0;
+	     buffer_index < size;
+	     buffer_index++ )
+	{
+		lower_word = ( lower_word + buffer[ buffer_index ] ) % 65521;
+		upper_word = ( upper_word + lower_word ) % 65521;
+	}
+	return( ( upper_word << 16 ) | lower_word );
+}
 
-	/* TODO add tests for export_handle_swap_byte_pairs */
+/* Writes the source image of the chunk passthrough test
+ * The even chunks can be compressed, the odd chunks are pseudo random data
+ * that is stored uncompressed, hence both types of chunk are passed through
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_export_handle_write_passthrough_source(
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libewf_handle_t *handle = NULL;
+	uint8_t *chunk_buffer   = NULL;
+	static char *function   = "ewf_test_tools_export_handle_write_passthrough_source";
+	size_t buffer_index     = 0;
+	ssize_t write_count     = 0;
+	uint32_t random_value   = 0x12345678UL;
+	int chunk_index         = 0;
+
+	if( libewf_handle_initialize(
+	     &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libewf_handle_open_wide(
+	     handle,
+	     (wchar_t * const *) &filename,
+	     1,
+	     LIBEWF_OPEN_WRITE,
+	     error ) != 1 )
+#else
+	if( libewf_handle_open(
+	     handle,
+	     (char * const *) &filename,
+	     1,
+	     LIBEWF_OPEN_WRITE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_set_format(
+	     handle,
+	     LIBEWF_FORMAT_ENCASE6,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable set format.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_set_media_size(
+	     handle,
+	     (size64_t) EWF_TEST_EXPORT_HANDLE_NUMBER_OF_CHUNKS * EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable set media size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_set_sectors_per_chunk(
+	     handle,
+	     EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE / 512,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable set sectors per chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_set_compression_values(
+	     handle,
+	     LIBEWF_COMPRESSION_LEVEL_FAST,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable set compression values.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_set_calculate_digest_flags(
+	     handle,
+	     LIBEWF_CALCULATE_DIGEST_FLAG_MD5,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable set calculate digest flags.",
+		 function );
+
+		goto on_error;
+	}
+	chunk_buffer = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE );
 
-	/* TODO add tests for export_handle_initialize_integrity_hash */
+	if( chunk_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk buffer.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < EWF_TEST_EXPORT_HANDLE_NUMBER_OF_CHUNKS;
+	     chunk_index++ )
+	{
+		if( ( chunk_index % 2 ) == 0 )
+		{
+			if( memory_set(
+			     chunk_buffer,
+			     (int) 'A' + ( chunk_index % 26 ),
+			     EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable set value in chunk buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			for( buffer_index = 0;
+			     buffer_index < EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE;
+			     buffer_index++ )
+			{
+				random_value = ( random_value * 1103515245UL ) + 12345;
 
-	/* TODO add tests for export_handle_update_integrity_hash */
+				chunk_buffer[ buffer_index ] = (uint8_t) ( random_value >> 16 );
+			}
+		}
+		write_count = libewf_handle_write_buffer(
+		               handle,
+		               chunk_buffer,
+		               EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE,
+		               error );
 
-	/* TODO add tests for export_handle_finalize_integrity_hash */
+		if( write_count != (ssize_t) EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable write chunk: %d to handle.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 chunk_buffer );
 
-	/* TODO add tests for export_handle_input_is_corrupted */
+	chunk_buffer = NULL;
 
-	/* TODO add tests for export_handle_get_output_chunk_size */
+	if( libewf_handle_close(
+	     handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_free(
+	     &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
 
-	/* TODO add tests for export_handle_prompt_for_string */
+on_error:
+	if( chunk_buffer != NULL )
+	{
+		memory_free(
+		 chunk_buffer );
+	}
+	if( handle != NULL )
+	{
+		libewf_handle_close(
+		 handle,
+		 NULL );
+		libewf_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( -1 );
+}
 
-	/* TODO add tests for export_handle_prompt_for_compression_method */
+/* Opens the segment files of an image for reading
+ * Returns 1 if successful or -1 on error
+ */
+int ewf_test_tools_export_handle_open_read(
+     libewf_handle_t **handle,
+     const system_character_t *filename,
+     int *number_of_segment_files,
+     libcerror_error_t **error )
+{
+	system_character_t **filenames = NULL;
+	static char *function          = "ewf_test_tools_export_handle_open_read";
+	size_t filename_length         = 0;
+	int number_of_filenames        = 0;
 
-	/* TODO add tests for export_handle_prompt_for_compression_level */
+	filename_length = system_string_length(
+	                   filename );
 
-	/* TODO add tests for export_handle_prompt_for_output_format */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libewf_glob_wide(
+	     filename,
+	     filename_length,
+	     LIBEWF_FORMAT_UNKNOWN,
+	     &filenames,
+	     &number_of_filenames,
+	     error ) != 1 )
+#else
+	if( libewf_glob(
+	     filename,
+	     filename_length,
+	     LIBEWF_FORMAT_UNKNOWN,
+	     &filenames,
+	     &number_of_filenames,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to glob filenames.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_initialize(
+	     handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libewf_handle_open_wide(
+	     *handle,
+	     filenames,
+	     number_of_filenames,
+	     LIBEWF_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libewf_handle_open(
+	     *handle,
+	     filenames,
+	     number_of_filenames,
+	     LIBEWF_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libewf_glob_wide_free(
+	     filenames,
+	     number_of_filenames,
+	     error ) != 1 )
+#else
+	if( libewf_glob_free(
+	     filenames,
+	     number_of_filenames,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free globbed filenames.",
+		 function );
 
-	/* TODO add tests for export_handle_prompt_for_sectors_per_chunk */
+		filenames = NULL;
 
-	/* TODO add tests for export_handle_prompt_for_maximum_segment_size */
+		goto on_error;
+	}
+	*number_of_segment_files = number_of_filenames;
 
-	/* TODO add tests for export_handle_prompt_for_export_offset */
+	return( 1 );
 
-	/* TODO add tests for export_handle_prompt_for_export_size */
+on_error:
+	if( *handle != NULL )
+	{
+		libewf_handle_close(
+		 *handle,
+		 NULL );
+		libewf_handle_free(
+		 handle,
+		 NULL );
+	}
+	if( filenames != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		libewf_glob_wide_free(
+		 filenames,
+		 number_of_filenames,
+		 NULL );
+#else
+		libewf_glob_free(
+		 filenames,
+		 number_of_filenames,
+		 NULL );
+#endif
+	}
+	return( -1 );
+}
 
-	/* TODO add tests for export_handle_set_string */
+/* Removes the segment files of the chunk passthrough test
+ */
+void ewf_test_tools_export_handle_remove_passthrough_files(
+      void )
+{
+	remove(
+	 "ewf_test_passthrough_source.E01" );
+	remove(
+	 "ewf_test_passthrough_destination.E01" );
+	remove(
+	 "ewf_test_passthrough_destination.E02" );
+	remove(
+	 "ewf_test_passthrough_destination.E03" );
+	remove(
+	 "ewf_test_passthrough_destination.E04" );
+}
 
-	/* TODO add tests for export_handle_set_compression_values */
+/* Tests the export_handle_supports_chunk_passthrough function
+ * The source image is re-segmented with chunk passthrough and the MD5 and
+ * the checksums of the chunks of the output are compared with the source
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_export_handle_supports_chunk_passthrough(
+     void )
+{
+	uint8_t destination_md5_hash[ 16 ];
+	uint8_t source_md5_hash[ 16 ];
+
+	system_character_t *source_filenames[ 1 ]   = { _SYSTEM_STRING( "ewf_test_passthrough_source.E01" ) };
+	export_handle_t *export_handle              = NULL;
+	libcerror_error_t *error                    = NULL;
+	libewf_data_chunk_t *destination_data_chunk = NULL;
+	libewf_data_chunk_t *source_data_chunk      = NULL;
+	libewf_handle_t *destination_handle         = NULL;
+	libewf_handle_t *source_handle              = NULL;
+	uint8_t *destination_chunk_buffer           = NULL;
+	uint8_t *source_chunk_buffer                = NULL;
+	ssize_t read_count                          = 0;
+	uint32_t destination_checksum               = 0;
+	uint32_t source_checksum                    = 0;
+	int chunk_index                             = 0;
+	int number_of_segment_files                 = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = ewf_test_tools_export_handle_write_passthrough_source(
+	          _SYSTEM_STRING( "ewf_test_passthrough_source" ),
+	          &error );
 
-	/* TODO add tests for export_handle_set_output_format */
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO add tests for export_handle_set_sectors_per_chunk */
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO add tests for export_handle_set_maximum_segment_size */
+	result = export_handle_initialize(
+	          &export_handle,
+	          0,
+	          0,
+	          &error );
 
-	/* TODO add tests for export_handle_set_export_offset */
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO add tests for export_handle_set_export_size */
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "export_handle",
+	 export_handle );
 
-	/* TODO add tests for export_handle_set_header_codepage */
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO add tests for export_handle_set_process_buffer_size */
+	/* Test that chunk passthrough is not supported for the raw output format
+	 */
+	result = export_handle_supports_chunk_passthrough(
+	          export_handle,
+	          &error );
 
-	/* TODO add tests for export_handle_set_number_of_threads */
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	/* TODO add tests for export_handle_set_additional_digest_types */
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO add tests for export_handle_set_output_values */
+	/* Test regular cases
+	 */
+	result = export_handle_open_input(
+	          export_handle,
+	          source_filenames,
+	          1,
+	          &error );
 
-	/* TODO add tests for export_handle_set_hash_value */
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO add tests for export_handle_append_read_error */
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO add tests for export_handle_write */
+	result = export_handle_set_output_format(
+	          export_handle,
+	          _SYSTEM_STRING( "encase6" ),
+	          &error );
 
-	/* TODO add tests for export_handle_finalize */
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_handle_set_compression_values(
+	          export_handle,
+	          _SYSTEM_STRING( "deflate:fast" ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Use the minimum segment file size so the output consists of multiple segment files
+	 */
+	result = export_handle_set_maximum_segment_size(
+	          export_handle,
+	          _SYSTEM_STRING( "1 MiB" ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	export_handle->export_size       = export_handle->input_media_size;
+	export_handle->number_of_threads = 0;
+
+	result = export_handle_open_output(
+	          export_handle,
+	          _SYSTEM_STRING( "ewf_test_passthrough_destination" ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_handle_set_output_values(
+	          export_handle,
+	          _SYSTEM_STRING( "ewf_test" ),
+	          _SYSTEM_STRING( "ewf_test_tools_export_handle" ),
+	          _SYSTEM_STRING( "1" ),
+	          0,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_handle_supports_chunk_passthrough(
+	          export_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	export_handle->use_chunk_passthrough = 1;
+
+	result = export_handle_export_input(
+	          export_handle,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = export_handle_supports_chunk_passthrough(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up export handle
+	 */
+	result = export_handle_close(
+	          export_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_handle_free(
+	          &export_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the output was re-segmented and matches the source
+	 */
+	result = ewf_test_tools_export_handle_open_read(
+	          &source_handle,
+	          _SYSTEM_STRING( "ewf_test_passthrough_source.E01" ),
+	          &number_of_segment_files,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ewf_test_tools_export_handle_open_read(
+	          &destination_handle,
+	          _SYSTEM_STRING( "ewf_test_passthrough_destination.E01" ),
+	          &number_of_segment_files,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_segment_files",
+	 number_of_segment_files,
+	 1 );
+
+	/* The MD5 of the source is copied to the output since the chunks are not unpacked
+	 */
+	result = libewf_handle_get_md5_hash(
+	          source_handle,
+	          source_md5_hash,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_get_md5_hash(
+	          destination_handle,
+	          destination_md5_hash,
+	          16,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          destination_md5_hash,
+	          source_md5_hash,
+	          16 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Reading a chunk validates its stored checksum, hence a chunk that is not
+	 * corrupted and has the same Adler-32 as the source chunk has the same checksum
+	 */
+	result = libewf_handle_get_data_chunk(
+	          source_handle,
+	          &source_data_chunk,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_get_data_chunk(
+	          destination_handle,
+	          &destination_data_chunk,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_chunk_buffer = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "source_chunk_buffer",
+	 source_chunk_buffer );
+
+	destination_chunk_buffer = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_chunk_buffer",
+	 destination_chunk_buffer );
+
+	for( chunk_index = 0;
+	     chunk_index < EWF_TEST_EXPORT_HANDLE_NUMBER_OF_CHUNKS;
+	     chunk_index++ )
+	{
+		read_count = libewf_handle_read_data_chunk(
+		              source_handle,
+		              source_data_chunk,
+		              &error );
+
+		EWF_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libewf_data_chunk_read_buffer(
+		              source_data_chunk,
+		              source_chunk_buffer,
+		              EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE,
+		              &error );
+
+		EWF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libewf_handle_read_data_chunk(
+		              destination_handle,
+		              destination_data_chunk,
+		              &error );
+
+		EWF_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libewf_data_chunk_read_buffer(
+		              destination_data_chunk,
+		              destination_chunk_buffer,
+		              EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE,
+		              &error );
+
+		EWF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libewf_data_chunk_is_corrupted(
+		          destination_data_chunk,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		source_checksum = ewf_test_tools_export_handle_calculate_adler32(
+		                   source_chunk_buffer,
+		                   EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE );
+
+		destination_checksum = ewf_test_tools_export_handle_calculate_adler32(
+		                        destination_chunk_buffer,
+		                        EWF_TEST_EXPORT_HANDLE_CHUNK_SIZE );
+
+		EWF_TEST_ASSERT_EQUAL_UINT32(
+		 "destination_checksum",
+		 destination_checksum,
+		 source_checksum );
+	}
+	/* Clean up
+	 */
+	memory_free(
+	 destination_chunk_buffer );
+
+	destination_chunk_buffer = NULL;
+
+	memory_free(
+	 source_chunk_buffer );
+
+	source_chunk_buffer = NULL;
+
+	result = libewf_data_chunk_free(
+	          &destination_data_chunk,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_data_chunk_free(
+	          &source_data_chunk,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_close(
+	          destination_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_free(
+	          &destination_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_close(
+	          source_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libewf_handle_free(
+	          &source_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ewf_test_tools_export_handle_remove_passthrough_files();
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_chunk_buffer != NULL )
+	{
+		memory_free(
+		 destination_chunk_buffer );
+	}
+	if( source_chunk_buffer != NULL )
+	{
+		memory_free(
+		 source_chunk_buffer );
+	}
+	if( destination_data_chunk != NULL )
+	{
+		libewf_data_chunk_free(
+		 &destination_data_chunk,
+		 NULL );
+	}
+	if( source_data_chunk != NULL )
+	{
+		libewf_data_chunk_free(
+		 &source_data_chunk,
+		 NULL );
+	}
+	if( destination_handle != NULL )
+	{
+		libewf_handle_close(
+		 destination_handle,
+		 NULL );
+		libewf_handle_free(
+		 &destination_handle,
+		 NULL );
+	}
+	if( source_handle != NULL )
+	{
+		libewf_handle_close(
+		 source_handle,
+		 NULL );
+		libewf_handle_free(
+		 &source_handle,
+		 NULL );
+	}
+	if( export_handle != NULL )
+	{
+		export_handle_free(
+		 &export_handle,
+		 NULL );
+	}
+	ewf_test_tools_export_handle_remove_passthrough_files();
+
+	return( 0 );
+}
+
+/* Tests the export_handle_write_storage_media_buffer_at_offset function
+ * The storage media buffers are written out of order to a raw output
+ * that consists of a single segment file
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_export_handle_write_storage_media_buffer_at_offset(
+     void )
+{
+	uint8_t read_buffer[ EWF_TEST_EXPORT_HANDLE_BUFFER_SIZE ];
+
+	storage_media_buffer_t *storage_media_buffers[ 3 ] = { NULL, NULL, NULL };
+	export_handle_t *export_handle                     = NULL;
+	libcerror_error_t *error                           = NULL;
+	FILE *file_stream                                  = NULL;
+	size_t read_count                                  = 0;
+	ssize_t write_count                                = 0;
+	int buffer_index                                   = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = export_handle_initialize(
+	          &export_handle,
+	          0,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "export_handle",
+	 export_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	export_handle->export_size = 3 * EWF_TEST_EXPORT_HANDLE_BUFFER_SIZE;
+
+	result = export_handle_open_output(
+	          export_handle,
+	          _SYSTEM_STRING( "ewf_test_export_raw" ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_index = 0;
+	     buffer_index < 3;
+	     buffer_index++ )
+	{
+		result = storage_media_buffer_initialize(
+		          &( storage_media_buffers[ buffer_index ] ),
+		          NULL,
+		          STORAGE_MEDIA_BUFFER_MODE_BUFFERED,
+		          EWF_TEST_EXPORT_HANDLE_BUFFER_SIZE,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = memory_set(
+		          storage_media_buffers[ buffer_index ]->raw_buffer,
+		          'A' + buffer_index,
+		          EWF_TEST_EXPORT_HANDLE_BUFFER_SIZE ) != NULL;
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		storage_media_buffers[ buffer_index ]->storage_media_offset = (off64_t) buffer_index * EWF_TEST_EXPORT_HANDLE_BUFFER_SIZE;
+		storage_media_buffers[ buffer_index ]->raw_buffer_data_size = EWF_TEST_EXPORT_HANDLE_BUFFER_SIZE;
+		storage_media_buffers[ buffer_index ]->processed_size       = EWF_TEST_EXPORT_HANDLE_BUFFER_SIZE;
+	}
+	/* Test regular cases
+	 */
+	write_count = export_handle_write_storage_media_buffer_at_offset(
+	               export_handle,
+	               storage_media_buffers[ 2 ],
+	               &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) EWF_TEST_EXPORT_HANDLE_BUFFER_SIZE );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	write_count = export_handle_write_storage_media_buffer_at_offset(
+	               export_handle,
+	               storage_media_buffers[ 0 ],
+	               &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) EWF_TEST_EXPORT_HANDLE_BUFFER_SIZE );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	write_count = export_handle_write_storage_media_buffer_at_offset(
+	               export_handle,
+	               storage_media_buffers[ 1 ],
+	               &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) EWF_TEST_EXPORT_HANDLE_BUFFER_SIZE );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	write_count = export_handle_write_storage_media_buffer_at_offset(
+	               NULL,
+	               storage_media_buffers[ 0 ],
+	               &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = export_handle_write_storage_media_buffer_at_offset(
+	               export_handle,
+	               NULL,
+	               &error );
+
+	EWF_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The input handle is not opened, hence the raw output is closed when freeing the export handle
+	 */
+	result = export_handle_free(
+	          &export_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "export_handle",
+	 export_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the storage media buffers are stored at their offsets
+	 */
+	file_stream = file_stream_open(
+	               "ewf_test_export_raw.raw",
+	               "rb" );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	for( buffer_index = 0;
+	     buffer_index < 3;
+	     buffer_index++ )
+	{
+		read_count = file_stream_read(
+		              file_stream,
+		              read_buffer,
+		              EWF_TEST_EXPORT_HANDLE_BUFFER_SIZE );
+
+		EWF_TEST_ASSERT_EQUAL_SIZE(
+		 "read_count",
+		 read_count,
+		 (size_t) EWF_TEST_EXPORT_HANDLE_BUFFER_SIZE );
+
+		result = memory_compare(
+		          read_buffer,
+		          storage_media_buffers[ buffer_index ]->raw_buffer,
+		          EWF_TEST_EXPORT_HANDLE_BUFFER_SIZE );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	read_count = file_stream_read(
+	              file_stream,
+	              read_buffer,
+	              1 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 (size_t) 0 );
+
+	file_stream_close(
+	 file_stream );
+
+	file_stream = NULL;
+
+	/* Clean up
+	 */
+	for( buffer_index = 0;
+	     buffer_index < 3;
+	     buffer_index++ )
+	{
+		result = storage_media_buffer_free(
+		          &( storage_media_buffers[ buffer_index ] ),
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	remove(
+	 "ewf_test_export_raw.raw" );
+	remove(
+	 "ewf_test_export_raw.raw.info" );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	for( buffer_index = 0;
+	     buffer_index < 3;
+	     buffer_index++ )
+	{
+		if( storage_media_buffers[ buffer_index ] != NULL )
+		{
+			storage_media_buffer_free(
+			 &( storage_media_buffers[ buffer_index ] ),
+			 NULL );
+		}
+	}
+	if( export_handle != NULL )
+	{
+		export_handle_free(
+		 &export_handle,
+		 NULL );
+	}
+	remove(
+	 "ewf_test_export_raw.raw" );
+	remove(
+	 "ewf_test_export_raw.raw.info" );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	export_handle_t *export_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EWF_TEST_RUN(
+	 "export_handle_initialize",
+	 ewf_test_tools_export_handle_initialize );
+
+	EWF_TEST_RUN(
+	 "export_handle_free",
+	 ewf_test_tools_export_handle_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	/* Initialize info handle for tests
+	 */
+	result = export_handle_initialize(
+	          &export_handle,
+	          1,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "export_handle",
+	 export_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_RUN_WITH_ARGS(
+	 "export_handle_signal_abort",
+	 ewf_test_tools_export_handle_signal_abort,
+	 export_handle );
+
+	EWF_TEST_RUN_WITH_ARGS(
+	 "export_handle_set_maximum_number_of_open_handles",
+	 ewf_test_tools_export_handle_set_maximum_number_of_open_handles,
+	 export_handle );
+
+	/* TODO add tests for export_handle_check_write_access */
+
+	/* TODO add tests for export_handle_open_input */
+
+	/* TODO add tests for export_handle_open_output */
+
+	EWF_TEST_RUN_WITH_ARGS(
+	 "export_handle_open_raw_output_file_descriptor",
+	 ewf_test_tools_export_handle_open_raw_output_file_descriptor,
+	 export_handle );
+
+	/* TODO add tests for export_handle_close */
+
+	/* TODO add tests for export_handle_read_storage_media_buffer */
+
+	/* TODO add tests for export_handle_prepare_write_storage_media_buffer */
+
+	/* TODO add tests for export_handle_write_storage_media_buffer */
+
+	/* TODO add tests for export_handle_has_single_raw_output */
+
+	EWF_TEST_RUN(
+	 "export_handle_supports_chunk_passthrough",
+	 ewf_test_tools_export_handle_supports_chunk_passthrough );
+
+	/* TODO add tests for export_handle_write_packed_storage_media_buffer */
+
+	EWF_TEST_RUN(
+	 "export_handle_write_storage_media_buffer_at_offset",
+	 ewf_test_tools_export_handle_write_storage_media_buffer_at_offset );
+
+	/* TODO add tests for export_handle_seek_offset */
+
+	/* TODO add tests for export_handle_get_sparse_size */
+
+	/* TODO add tests for export_handle_swap_byte_pairs */
+
+	/* TODO add tests for export_handle_initialize_integrity_hash */
+
+	/* TODO add tests for export_handle_update_integrity_hash */
+
+	/* TODO add tests for export_handle_update_integrity_hash_with_zeros */
+
+	/* TODO add tests for export_handle_finalize_integrity_hash */
+
+	/* TODO add tests for export_handle_input_is_corrupted */
+
+	/* TODO add tests for export_handle_get_output_chunk_size */
+
+	/* TODO add tests for export_handle_prompt_for_string */
+
+	/* TODO add tests for export_handle_prompt_for_compression_method */
+
+	/* TODO add tests for export_handle_prompt_for_compression_level */
+
+	/* TODO add tests for export_handle_prompt_for_output_format */
+
+	/* TODO add tests for export_handle_prompt_for_sectors_per_chunk */
+
+	/* TODO add tests for export_handle_prompt_for_maximum_segment_size */
+
+	/* TODO add tests for export_handle_prompt_for_export_offset */
+
+	/* TODO add tests for export_handle_prompt_for_export_size */
+
+	/* TODO add tests for export_handle_set_string */
+
+	/* TODO add tests for export_handle_set_compression_values */
+
+	/* TODO add tests for export_handle_set_output_format */
+
+	/* TODO add tests for export_handle_set_sectors_per_chunk */
+
+	/* TODO add tests for export_handle_set_maximum_segment_size */
+
+	/* TODO add tests for export_handle_set_export_offset */
+
+	/* TODO add tests for export_handle_set_export_size */
+
+	/* TODO add tests for export_handle_set_header_codepage */
+
+	/* TODO add tests for export_handle_set_process_buffer_size */
+
+	/* TODO add tests for export_handle_set_number_of_threads */
+
+	/* TODO add tests for export_handle_set_additional_digest_types */
+
+	/* TODO add tests for export_handle_set_output_values */
+
+	/* TODO add tests for export_handle_set_hash_value */
+
+	/* TODO add tests for export_handle_append_read_error */
+
+	/* TODO add tests for export_handle_write */
+
+	/* TODO add tests for export_handle_copy_input_hashes */
+
+	/* TODO add tests for export_handle_finalize */
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT )
 
@@ -544,10 +1955,24 @@ int main(
 
 	/* TODO add tests for export_handle_export_file_entry_data */
 
+	/* TODO add tests for export_handle_verify_file_entry_md5_hash */
+
 	/* TODO add tests for export_handle_export_file_entry_sub_file_entries */
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	/* TODO add tests for export_handle_single_file_free */
+
+	/* TODO add tests for export_handle_push_single_file */
+
+	/* TODO add tests for export_handle_export_single_file_callback */
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 	/* TODO add tests for export_handle_hash_values_fprint */
 
+	/* TODO add tests for export_handle_input_hash_values_fprint */
+
 	/* TODO add tests for export_handle_checksum_errors_fprint */
 
 	/* Clean up
@@ -0,0 +1,1201 @@
+/*
+ * Tools verification_batch type test program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_libewf.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../ewftools/verification_batch.h"
+#include "../ewftools/verification_handle.h"
+
+/* Tests the verification_batch_get_job_status_string function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_batch_get_job_status_string(
+     void )
+{
+	const char *status_string = NULL;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	status_string = verification_batch_get_job_status_string(
+	                 VERIFICATION_BATCH_JOB_STATUS_SUCCESS );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "status_string",
+	 status_string );
+
+	result = narrow_string_compare(
+	          status_string,
+	          "SUCCESS",
+	          8 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	status_string = verification_batch_get_job_status_string(
+	                 VERIFICATION_BATCH_JOB_STATUS_FAILURE );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "status_string",
+	 status_string );
+
+	result = narrow_string_compare(
+	          status_string,
+	          "FAILURE",
+	          8 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	status_string = verification_batch_get_job_status_string(
+	                 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "status_string",
+	 status_string );
+
+	result = narrow_string_compare(
+	          status_string,
+	          "ERROR",
+	          6 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the verification_batch_job_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_batch_job_initialize(
+     verification_batch_t *batch )
+{
+	libcerror_error_t *error      = NULL;
+	verification_batch_job_t *job = NULL;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = verification_batch_job_initialize(
+	          &job,
+	          batch,
+	          _SYSTEM_STRING( "image.E01" ),
+	          9,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "job",
+	 job );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "job->status",
+	 job->status,
+	 VERIFICATION_BATCH_JOB_STATUS_PENDING );
+
+	result = system_string_compare(
+	          job->filename,
+	          _SYSTEM_STRING( "image.E01" ),
+	          10 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = verification_batch_job_free(
+	          &job,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "job",
+	 job );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = verification_batch_job_initialize(
+	          NULL,
+	          batch,
+	          _SYSTEM_STRING( "image.E01" ),
+	          9,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	job = (verification_batch_job_t *) 0x12345678UL;
+
+	result = verification_batch_job_initialize(
+	          &job,
+	          batch,
+	          _SYSTEM_STRING( "image.E01" ),
+	          9,
+	          &error );
+
+	job = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verification_batch_job_initialize(
+	          &job,
+	          NULL,
+	          _SYSTEM_STRING( "image.E01" ),
+	          9,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verification_batch_job_initialize(
+	          &job,
+	          batch,
+	          NULL,
+	          9,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verification_batch_job_initialize(
+	          &job,
+	          batch,
+	          _SYSTEM_STRING( "image.E01" ),
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( job != NULL )
+	{
+		verification_batch_job_free(
+		 &job,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the verification_batch_job_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_batch_job_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = verification_batch_job_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the verification_batch_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_batch_initialize(
+     verification_handle_t *verification_handle )
+{
+	libcerror_error_t *error    = NULL;
+	verification_batch_t *batch = NULL;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = verification_batch_initialize(
+	          &batch,
+	          verification_handle,
+	          NULL,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "batch",
+	 batch );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "batch->maximum_number_of_jobs_per_device",
+	 batch->maximum_number_of_jobs_per_device,
+	 1 );
+
+	result = verification_batch_free(
+	          &batch,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "batch",
+	 batch );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = verification_batch_initialize(
+	          NULL,
+	          verification_handle,
+	          NULL,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	batch = (verification_batch_t *) 0x12345678UL;
+
+	result = verification_batch_initialize(
+	          &batch,
+	          verification_handle,
+	          NULL,
+	          0,
+	          &error );
+
+	batch = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verification_batch_initialize(
+	          &batch,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		verification_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the verification_batch_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_batch_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = verification_batch_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the verification_batch_set_maximum_number_of_jobs_per_device function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_batch_set_maximum_number_of_jobs_per_device(
+     verification_batch_t *batch )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = verification_batch_set_maximum_number_of_jobs_per_device(
+	          batch,
+	          _SYSTEM_STRING( "2" ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "batch->maximum_number_of_jobs_per_device",
+	 batch->maximum_number_of_jobs_per_device,
+	 2 );
+
+	result = verification_batch_set_maximum_number_of_jobs_per_device(
+	          batch,
+	          _SYSTEM_STRING( "0" ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "batch->maximum_number_of_jobs_per_device",
+	 batch->maximum_number_of_jobs_per_device,
+	 2 );
+
+	result = verification_batch_set_maximum_number_of_jobs_per_device(
+	          batch,
+	          _SYSTEM_STRING( "1" ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = verification_batch_set_maximum_number_of_jobs_per_device(
+	          NULL,
+	          _SYSTEM_STRING( "1" ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verification_batch_set_maximum_number_of_jobs_per_device(
+	          batch,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the verification_batch_append_image function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_batch_append_image(
+     verification_batch_t *batch )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_images     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = verification_batch_append_image(
+	          batch,
+	          _SYSTEM_STRING( "first.E01" ),
+	          9,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verification_batch_append_image(
+	          batch,
+	          _SYSTEM_STRING( "second.E01" ),
+	          10,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verification_batch_get_number_of_images(
+	          batch,
+	          &number_of_images,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_images",
+	 number_of_images,
+	 2 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = verification_batch_append_image(
+	          NULL,
+	          _SYSTEM_STRING( "first.E01" ),
+	          9,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verification_batch_append_image(
+	          batch,
+	          NULL,
+	          9,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the verification_batch_get_next_job function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_batch_get_next_job(
+     verification_batch_t *batch )
+{
+	libcerror_error_t *error       = NULL;
+	verification_batch_job_t *job  = NULL;
+	verification_batch_job_t *job2 = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = verification_batch_get_next_job(
+	          batch,
+	          &job,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "job",
+	 job );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The images do not exist hence they are considered to be stored on the same device
+	 */
+	job->is_active = 1;
+
+	batch->number_of_active_jobs            += 1;
+	batch->maximum_number_of_concurrent_jobs = 2;
+
+	result = verification_batch_get_next_job(
+	          batch,
+	          &job2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "job2",
+	 job2 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	batch->maximum_number_of_jobs_per_device = 2;
+
+	result = verification_batch_get_next_job(
+	          batch,
+	          &job2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "job2",
+	 job2 );
+
+	EWF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "job2",
+	 (int) ( job2 == job ),
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	batch->maximum_number_of_concurrent_jobs = 1;
+
+	result = verification_batch_get_next_job(
+	          batch,
+	          &job2,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	job->is_active = 0;
+
+	batch->number_of_active_jobs            -= 1;
+	batch->maximum_number_of_jobs_per_device = 1;
+
+	/* Test error cases
+	 */
+	result = verification_batch_get_next_job(
+	          NULL,
+	          &job,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verification_batch_get_next_job(
+	          batch,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the verification_batch_read_manifest function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_batch_read_manifest(
+     verification_batch_t *batch )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = verification_batch_read_manifest(
+	          NULL,
+	          _SYSTEM_STRING( "manifest.txt" ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verification_batch_read_manifest(
+	          batch,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verification_batch_read_manifest(
+	          batch,
+	          _SYSTEM_STRING( "/nonexistent/manifest.txt" ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the verification_batch_results_fprint function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_batch_results_fprint(
+     verification_batch_t *batch )
+{
+	libcerror_error_t *error = NULL;
+	FILE *stream             = NULL;
+	int result               = 0;
+
+	stream = tmpfile();
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	/* Test regular cases
+	 */
+	result = verification_batch_results_fprint(
+	          batch,
+	          stream,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = verification_batch_results_fprint(
+	          NULL,
+	          stream,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verification_batch_results_fprint(
+	          batch,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_stream_close(
+	 stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error                   = NULL;
+	verification_batch_t *batch                = NULL;
+	verification_handle_t *verification_handle = NULL;
+	int result                                 = 0;
+
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EWF_TEST_RUN(
+	 "verification_batch_get_job_status_string",
+	 ewf_test_tools_verification_batch_get_job_status_string );
+
+	EWF_TEST_RUN(
+	 "verification_batch_job_free",
+	 ewf_test_tools_verification_batch_job_free );
+
+	EWF_TEST_RUN(
+	 "verification_batch_free",
+	 ewf_test_tools_verification_batch_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	/* Initialize verification handle and batch for tests
+	 */
+	result = verification_handle_initialize(
+	          &verification_handle,
+	          1,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "verification_handle",
+	 verification_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_RUN_WITH_ARGS(
+	 "verification_batch_initialize",
+	 ewf_test_tools_verification_batch_initialize,
+	 verification_handle );
+
+	result = verification_batch_initialize(
+	          &batch,
+	          verification_handle,
+	          NULL,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "batch",
+	 batch );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_RUN_WITH_ARGS(
+	 "verification_batch_job_initialize",
+	 ewf_test_tools_verification_batch_job_initialize,
+	 batch );
+
+	EWF_TEST_RUN_WITH_ARGS(
+	 "verification_batch_set_maximum_number_of_jobs_per_device",
+	 ewf_test_tools_verification_batch_set_maximum_number_of_jobs_per_device,
+	 batch );
+
+	EWF_TEST_RUN_WITH_ARGS(
+	 "verification_batch_append_image",
+	 ewf_test_tools_verification_batch_append_image,
+	 batch );
+
+	EWF_TEST_RUN_WITH_ARGS(
+	 "verification_batch_get_next_job",
+	 ewf_test_tools_verification_batch_get_next_job,
+	 batch );
+
+	EWF_TEST_RUN_WITH_ARGS(
+	 "verification_batch_read_manifest",
+	 ewf_test_tools_verification_batch_read_manifest,
+	 batch );
+
+	EWF_TEST_RUN_WITH_ARGS(
+	 "verification_batch_results_fprint",
+	 ewf_test_tools_verification_batch_results_fprint,
+	 batch );
+
+	/* Clean up
+	 */
+	result = verification_batch_free(
+	          &batch,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "batch",
+	 batch );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verification_handle_free(
+	          &verification_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "verification_handle",
+	 verification_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		verification_batch_free(
+		 &batch,
+		 NULL );
+	}
+	if( verification_handle != NULL )
+	{
+		verification_handle_free(
+		 &verification_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
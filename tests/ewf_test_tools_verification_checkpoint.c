@@ -0,0 +1,947 @@
+/*
+ * Tools verification_checkpoint functions test program
+ *
+ * Copyright (C) 2006-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <system_string.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "ewf_test_libcerror.h"
+#include "ewf_test_macros.h"
+#include "ewf_test_memory.h"
+#include "ewf_test_unused.h"
+
+#include "../ewftools/verification_checkpoint.h"
+
+/* Tests the verification_checkpoint_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_checkpoint_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	verification_checkpoint_t *checkpoint = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = verification_checkpoint_initialize(
+	          &checkpoint,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "checkpoint",
+	 checkpoint );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verification_checkpoint_free(
+	          &checkpoint,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "checkpoint",
+	 checkpoint );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = verification_checkpoint_initialize(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	checkpoint = (verification_checkpoint_t *) 0x12345678UL;
+
+	result = verification_checkpoint_initialize(
+	          &checkpoint,
+	          &error );
+
+	checkpoint = NULL;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EWF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test verification_checkpoint_initialize with malloc failing
+		 */
+		ewf_test_malloc_attempts_before_fail = test_number;
+
+		result = verification_checkpoint_initialize(
+		          &checkpoint,
+		          &error );
+
+		if( ewf_test_malloc_attempts_before_fail != -1 )
+		{
+			ewf_test_malloc_attempts_before_fail = -1;
+
+			if( checkpoint != NULL )
+			{
+				verification_checkpoint_free(
+				 &checkpoint,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "checkpoint",
+			 checkpoint );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test verification_checkpoint_initialize with memset failing
+		 */
+		ewf_test_memset_attempts_before_fail = test_number;
+
+		result = verification_checkpoint_initialize(
+		          &checkpoint,
+		          &error );
+
+		if( ewf_test_memset_attempts_before_fail != -1 )
+		{
+			ewf_test_memset_attempts_before_fail = -1;
+
+			if( checkpoint != NULL )
+			{
+				verification_checkpoint_free(
+				 &checkpoint,
+				 NULL );
+			}
+		}
+		else
+		{
+			EWF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EWF_TEST_ASSERT_IS_NULL(
+			 "checkpoint",
+			 checkpoint );
+
+			EWF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EWF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( checkpoint != NULL )
+	{
+		verification_checkpoint_free(
+		 &checkpoint,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the verification_checkpoint_free function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_checkpoint_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = verification_checkpoint_free(
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the verification_checkpoint_append_checksum_error and verification_checkpoint_get_checksum_error functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_checkpoint_checksum_errors(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	verification_checkpoint_t *checkpoint = NULL;
+	uint64_t number_of_sectors            = 0;
+	uint64_t start_sector                 = 0;
+	int checksum_error_index              = 0;
+	int number_of_checksum_errors         = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = verification_checkpoint_initialize(
+	          &checkpoint,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "checkpoint",
+	 checkpoint );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( checksum_error_index = 0;
+	     checksum_error_index < 100;
+	     checksum_error_index++ )
+	{
+		result = verification_checkpoint_append_checksum_error(
+		          checkpoint,
+		          (uint64_t) checksum_error_index * 64,
+		          64,
+		          &error );
+
+		EWF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EWF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = verification_checkpoint_get_number_of_checksum_errors(
+	          checkpoint,
+	          &number_of_checksum_errors,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_checksum_errors",
+	 number_of_checksum_errors,
+	 100 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verification_checkpoint_get_checksum_error(
+	          checkpoint,
+	          99,
+	          &start_sector,
+	          &number_of_sectors,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 6336 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 64 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = verification_checkpoint_append_checksum_error(
+	          NULL,
+	          0,
+	          64,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verification_checkpoint_get_number_of_checksum_errors(
+	          checkpoint,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verification_checkpoint_get_checksum_error(
+	          checkpoint,
+	          100,
+	          &start_sector,
+	          &number_of_sectors,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verification_checkpoint_get_checksum_error(
+	          checkpoint,
+	          -1,
+	          &start_sector,
+	          &number_of_sectors,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = verification_checkpoint_free(
+	          &checkpoint,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "checkpoint",
+	 checkpoint );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( checkpoint != NULL )
+	{
+		verification_checkpoint_free(
+		 &checkpoint,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the verification_checkpoint_write_data and verification_checkpoint_read_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_checkpoint_read_write_data(
+     void )
+{
+	uint8_t data[ VERIFICATION_CHECKPOINT_HEADER_SIZE + ( 2 * VERIFICATION_CHECKPOINT_CHECKSUM_ERROR_SIZE ) + VERIFICATION_CHECKPOINT_FOOTER_SIZE ];
+
+	libcerror_error_t *error                   = NULL;
+	verification_checkpoint_t *checkpoint      = NULL;
+	verification_checkpoint_t *read_checkpoint = NULL;
+	size_t data_size                           = 0;
+	uint64_t number_of_sectors                 = 0;
+	uint64_t start_sector                      = 0;
+	int number_of_checksum_errors              = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = verification_checkpoint_initialize(
+	          &checkpoint,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "checkpoint",
+	 checkpoint );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	checkpoint->digest_flags = VERIFICATION_CHECKPOINT_DIGEST_FLAG_MD5 | VERIFICATION_CHECKPOINT_DIGEST_FLAG_SHA256;
+	checkpoint->media_size   = 1474560;
+	checkpoint->chunk_size   = 32768;
+	checkpoint->offset       = 655360;
+
+	checkpoint->md5_state[ 0 ]                                       = 0xa5;
+	checkpoint->sha256_state[ DIGEST_ENGINE_SHA256_STATE_SIZE - 1 ] = 0x5a;
+
+	result = verification_checkpoint_append_checksum_error(
+	          checkpoint,
+	          64,
+	          64,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verification_checkpoint_append_checksum_error(
+	          checkpoint,
+	          1024,
+	          3,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verification_checkpoint_get_data_size(
+	          checkpoint,
+	          &data_size,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 sizeof( data ) );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = verification_checkpoint_write_data(
+	          checkpoint,
+	          data,
+	          sizeof( data ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verification_checkpoint_initialize(
+	          &read_checkpoint,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_checkpoint",
+	 read_checkpoint );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verification_checkpoint_read_data(
+	          read_checkpoint,
+	          data,
+	          sizeof( data ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "read_checkpoint->digest_flags",
+	 read_checkpoint->digest_flags,
+	 (uint32_t) ( VERIFICATION_CHECKPOINT_DIGEST_FLAG_MD5 | VERIFICATION_CHECKPOINT_DIGEST_FLAG_SHA256 ) );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "read_checkpoint->media_size",
+	 read_checkpoint->media_size,
+	 (uint64_t) 1474560 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT32(
+	 "read_checkpoint->chunk_size",
+	 read_checkpoint->chunk_size,
+	 (uint32_t) 32768 );
+
+	EWF_TEST_ASSERT_EQUAL_INT64(
+	 "read_checkpoint->offset",
+	 read_checkpoint->offset,
+	 (int64_t) 655360 );
+
+	result = memory_compare(
+	          read_checkpoint->md5_state,
+	          checkpoint->md5_state,
+	          DIGEST_ENGINE_MD5_STATE_SIZE );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          read_checkpoint->sha256_state,
+	          checkpoint->sha256_state,
+	          DIGEST_ENGINE_SHA256_STATE_SIZE );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = verification_checkpoint_get_number_of_checksum_errors(
+	          read_checkpoint,
+	          &number_of_checksum_errors,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_checksum_errors",
+	 number_of_checksum_errors,
+	 2 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verification_checkpoint_get_checksum_error(
+	          read_checkpoint,
+	          1,
+	          &start_sector,
+	          &number_of_sectors,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 1024 );
+
+	EWF_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 3 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verification_checkpoint_free(
+	          &read_checkpoint,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = verification_checkpoint_write_data(
+	          checkpoint,
+	          data,
+	          sizeof( data ) - 1,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verification_checkpoint_write_data(
+	          checkpoint,
+	          data,
+	          sizeof( data ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verification_checkpoint_initialize(
+	          &read_checkpoint,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verification_checkpoint_read_data(
+	          read_checkpoint,
+	          data,
+	          sizeof( data ) - VERIFICATION_CHECKPOINT_CHECKSUM_ERROR_SIZE,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read data with a corrupted checkpoint
+	 */
+	data[ VERIFICATION_CHECKPOINT_HEADER_SIZE - 1 ] ^= 0xff;
+
+	result = verification_checkpoint_read_data(
+	          read_checkpoint,
+	          data,
+	          sizeof( data ),
+	          &error );
+
+	data[ VERIFICATION_CHECKPOINT_HEADER_SIZE - 1 ] ^= 0xff;
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read data with an unsupported signature
+	 */
+	data[ 0 ] = 'x';
+
+	result = verification_checkpoint_read_data(
+	          read_checkpoint,
+	          data,
+	          sizeof( data ),
+	          &error );
+
+	data[ 0 ] = 'e';
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = verification_checkpoint_read_data(
+	          read_checkpoint,
+	          NULL,
+	          sizeof( data ),
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = verification_checkpoint_free(
+	          &read_checkpoint,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verification_checkpoint_free(
+	          &checkpoint,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_checkpoint != NULL )
+	{
+		verification_checkpoint_free(
+		 &read_checkpoint,
+		 NULL );
+	}
+	if( checkpoint != NULL )
+	{
+		verification_checkpoint_free(
+		 &checkpoint,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EWF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EWF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EWF_TEST_UNREFERENCED_PARAMETER( argc )
+	EWF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EWF_TEST_RUN(
+	 "verification_checkpoint_initialize",
+	 ewf_test_tools_verification_checkpoint_initialize );
+
+	EWF_TEST_RUN(
+	 "verification_checkpoint_free",
+	 ewf_test_tools_verification_checkpoint_free );
+
+	EWF_TEST_RUN(
+	 "verification_checkpoint_checksum_errors",
+	 ewf_test_tools_verification_checkpoint_checksum_errors );
+
+	EWF_TEST_RUN(
+	 "verification_checkpoint_read_write_data",
+	 ewf_test_tools_verification_checkpoint_read_write_data );
+
+	/* TODO: add tests for verification_checkpoint_read_file */
+
+	/* TODO: add tests for verification_checkpoint_write_file */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -332,6 +332,151 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the verification_handle_scan_chunk_integrity_progress_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_handle_scan_chunk_integrity_progress_callback(
+     verification_handle_t *handle )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	handle->abort = 1;
+
+	result = verification_handle_scan_chunk_integrity_progress_callback(
+	          0,
+	          1024,
+	          (void *) handle );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = verification_handle_scan_chunk_integrity_progress_callback(
+	          0,
+	          1024,
+	          NULL );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the verification_handle_verify_chunk_integrity function
+ * Returns 1 if successful or 0 if not
+ */
+int ewf_test_tools_verification_handle_verify_chunk_integrity(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	verification_handle_t *verification_handle = NULL;
+	int result                                 = 0;
+
+	/* Test error cases
+	 */
+	result = verification_handle_verify_chunk_integrity(
+	          NULL,
+	          0,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where digest hashes are calculated
+	 */
+	result = verification_handle_initialize(
+	          &verification_handle,
+	          1,
+	          0,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "verification_handle",
+	 verification_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = verification_handle_verify_chunk_integrity(
+	          verification_handle,
+	          0,
+	          NULL,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EWF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = verification_handle_free(
+	          &verification_handle,
+	          &error );
+
+	EWF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "verification_handle",
+	 verification_handle );
+
+	EWF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( verification_handle != NULL )
+	{
+		verification_handle_free(
+		 &verification_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -359,6 +504,10 @@ int main(
 	 "verification_handle_free",
 	 ewf_test_tools_verification_handle_free );
 
+	EWF_TEST_RUN(
+	 "verification_handle_verify_chunk_integrity",
+	 ewf_test_tools_verification_handle_verify_chunk_integrity );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	/* Initialize info handle for tests
 	 */
@@ -386,6 +535,11 @@ int main(
 	 ewf_test_tools_verification_handle_signal_abort,
 	 verification_handle );
 
+	EWF_TEST_RUN_WITH_ARGS(
+	 "verification_handle_scan_chunk_integrity_progress_callback",
+	 ewf_test_tools_verification_handle_scan_chunk_integrity_progress_callback,
+	 verification_handle );
+
 	/* Clean up
 	 */
 	result = verification_handle_free(
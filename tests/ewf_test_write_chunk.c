@@ -255,6 +255,20 @@ int ewf_test_write_chunk(
 
 		goto on_error;
 	}
+	if( libewf_handle_set_calculate_digest_flags(
+	     handle,
+	     LIBEWF_CALCULATE_DIGEST_FLAG_MD5,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable set calculate digest flags.",
+		 function );
+
+		goto on_error;
+	}
 	sectors_per_chunk = 64;
 
 	if( libewf_handle_set_sectors_per_chunk(
@@ -434,6 +448,595 @@ on_error:
 	return( -1 );
 }
 
+/* Opens EWF file(s) for reading
+ * Return 1 if successful or -1 on error
+ */
+int ewf_test_write_chunk_open_read(
+     libewf_handle_t **handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t **filenames = NULL;
+	static char *function          = "ewf_test_write_chunk_open_read";
+	size_t filename_length         = 0;
+	int number_of_filenames        = 0;
+
+	filename_length = system_string_length(
+	                   filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libewf_glob_wide(
+	     filename,
+	     filename_length,
+	     LIBEWF_FORMAT_UNKNOWN,
+	     &filenames,
+	     &number_of_filenames,
+	     error ) != 1 )
+#else
+	if( libewf_glob(
+	     filename,
+	     filename_length,
+	     LIBEWF_FORMAT_UNKNOWN,
+	     &filenames,
+	     &number_of_filenames,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to glob filenames.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_initialize(
+	     handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libewf_handle_open_wide(
+	     *handle,
+	     filenames,
+	     number_of_filenames,
+	     LIBEWF_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libewf_handle_open(
+	     *handle,
+	     filenames,
+	     number_of_filenames,
+	     LIBEWF_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libewf_glob_wide_free(
+	     filenames,
+	     number_of_filenames,
+	     error ) != 1 )
+#else
+	if( libewf_glob_free(
+	     filenames,
+	     number_of_filenames,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free globbed filenames.",
+		 function );
+
+		filenames = NULL;
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *handle != NULL )
+	{
+		libewf_handle_free(
+		 handle,
+		 NULL );
+	}
+	if( filenames != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		libewf_glob_wide_free(
+		 filenames,
+		 number_of_filenames,
+		 NULL );
+#else
+		libewf_glob_free(
+		 filenames,
+		 number_of_filenames,
+		 NULL );
+#endif
+	}
+	return( -1 );
+}
+
+/* Tests writing the packed data chunks read from EWF file(s) to other EWF file(s)
+ * and reading back the data and the MD5 hash
+ * Return 1 if successful, 0 if not or -1 on error
+ */
+int ewf_test_write_packed_chunk(
+     const system_character_t *source_filename,
+     const system_character_t *destination_filename,
+     libcerror_error_t **error )
+{
+	uint8_t destination_buffer[ 4096 ];
+	uint8_t destination_md5_hash[ 16 ];
+	uint8_t source_buffer[ 4096 ];
+	uint8_t source_md5_hash[ 16 ];
+
+	libewf_data_chunk_t *data_chunk     = NULL;
+	libewf_handle_t *destination_handle = NULL;
+	libewf_handle_t *source_handle      = NULL;
+	static char *function               = "ewf_test_write_packed_chunk";
+	ssize_t destination_read_count      = 0;
+	ssize_t read_count                  = 0;
+	ssize_t source_read_count           = 0;
+	ssize_t write_count                 = 0;
+	uint8_t compression_flags           = 0;
+	int8_t compression_level            = 0;
+	int result                          = 1;
+
+	if( ewf_test_write_chunk_open_read(
+	     &source_handle,
+	     source_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open source handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_initialize(
+	     &destination_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libewf_handle_open_wide(
+	     destination_handle,
+	     (wchar_t * const *) &destination_filename,
+	     1,
+	     LIBEWF_OPEN_WRITE,
+	     error ) != 1 )
+#else
+	if( libewf_handle_open(
+	     destination_handle,
+	     (char * const *) &destination_filename,
+	     1,
+	     LIBEWF_OPEN_WRITE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open destination handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_copy_media_values(
+	     destination_handle,
+	     source_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy media values.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_get_compression_values(
+	     source_handle,
+	     &compression_level,
+	     &compression_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compression values.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_set_compression_values(
+	     destination_handle,
+	     compression_level,
+	     compression_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable set compression values.",
+		 function );
+
+		goto on_error;
+	}
+	/* Calculating the MD5 hash requires the packed data chunks to be unpacked
+	 */
+	if( libewf_handle_set_calculate_digest_flags(
+	     destination_handle,
+	     LIBEWF_CALCULATE_DIGEST_FLAG_MD5,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable set calculate digest flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_get_data_chunk(
+	     source_handle,
+	     &data_chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to retrieve data chunk.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		read_count = libewf_handle_read_data_chunk(
+		              source_handle,
+		              data_chunk,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable read data chunk from source handle.",
+			 function );
+
+			goto on_error;
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		write_count = libewf_handle_write_packed_data_chunk(
+		               destination_handle,
+		               data_chunk,
+		               error );
+
+		if( write_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable write packed data chunk to destination handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( write_count > 0 );
+
+	if( libewf_data_chunk_free(
+	     &data_chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free data chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_write_finalize(
+	     destination_handle,
+	     error ) < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to finalize destination handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_close(
+	     destination_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close destination handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_free(
+	     &destination_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free destination handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* Read back the data written to the destination and compare it with the source
+	 */
+	if( ewf_test_write_chunk_open_read(
+	     &destination_handle,
+	     destination_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open destination handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_seek_offset(
+	     source_handle,
+	     0,
+	     SEEK_SET,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in source handle.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		source_read_count = libewf_handle_read_buffer(
+		                     source_handle,
+		                     source_buffer,
+		                     4096,
+		                     error );
+
+		if( source_read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable read buffer from source handle.",
+			 function );
+
+			goto on_error;
+		}
+		destination_read_count = libewf_handle_read_buffer(
+		                          destination_handle,
+		                          destination_buffer,
+		                          4096,
+		                          error );
+
+		if( destination_read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable read buffer from destination handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( destination_read_count != source_read_count )
+		{
+			result = 0;
+		}
+		else if( memory_compare(
+		          destination_buffer,
+		          source_buffer,
+		          (size_t) source_read_count ) != 0 )
+		{
+			result = 0;
+		}
+	}
+	while( ( result == 1 )
+	    && ( source_read_count > 0 ) );
+
+	if( result == 1 )
+	{
+		result = libewf_handle_get_md5_hash(
+		          destination_handle,
+		          destination_md5_hash,
+		          16,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve destination MD5 hash.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 1 )
+	{
+		result = libewf_handle_get_md5_hash(
+		          source_handle,
+		          source_md5_hash,
+		          16,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source MD5 hash.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 1 )
+	{
+		if( memory_compare(
+		     destination_md5_hash,
+		     source_md5_hash,
+		     16 ) != 0 )
+		{
+			result = 0;
+		}
+	}
+	if( libewf_handle_close(
+	     destination_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close destination handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_free(
+	     &destination_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free destination handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_close(
+	     source_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close source handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libewf_handle_free(
+	     &source_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free source handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( data_chunk != NULL )
+	{
+		libewf_data_chunk_free(
+		 &data_chunk,
+		 NULL );
+	}
+	if( destination_handle != NULL )
+	{
+		libewf_handle_close(
+		 destination_handle,
+		 NULL );
+		libewf_handle_free(
+		 &destination_handle,
+		 NULL );
+	}
+	if( source_handle != NULL )
+	{
+		libewf_handle_close(
+		 source_handle,
+		 NULL );
+		libewf_handle_free(
+		 &source_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -444,6 +1047,7 @@ int main( int argc, char * const argv[] )
 {
 	libcerror_error_t *error                        = NULL;
 	system_character_t *option_chunk_size           = NULL;
+	system_character_t *packed_filename             = NULL;
 	system_character_t *option_compression_level    = NULL;
 	system_character_t *option_maximum_segment_size = NULL;
 	system_character_t *option_media_size           = NULL;
@@ -454,6 +1058,7 @@ int main( int argc, char * const argv[] )
 	size_t string_length                            = 0;
 	uint8_t compression_flags                       = 0;
 	int8_t compression_level                        = LIBEWF_COMPRESSION_NONE;
+	int result                                      = 0;
 
 	while( ( option = ewf_test_getopt(
 	                   argc,
@@ -610,9 +1215,76 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	string_length = system_string_length(
+	                 argv[ optind ] );
+
+	packed_filename = system_string_allocate(
+	                   string_length + 8 );
+
+	if( packed_filename == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create packed filename.\n" );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     packed_filename,
+	     argv[ optind ],
+	     string_length ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy packed filename.\n" );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     &( packed_filename[ string_length ] ),
+	     _SYSTEM_STRING( "_packed" ),
+	     7 ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to copy packed filename.\n" );
+
+		goto on_error;
+	}
+	packed_filename[ string_length + 7 ] = 0;
+
+	result = ewf_test_write_packed_chunk(
+	          argv[ optind ],
+	          packed_filename,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to test write packed chunk.\n" );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Packed chunk data or MD5 hash does not match.\n" );
+
+		goto on_error;
+	}
+	memory_free(
+	 packed_filename );
+
 	return( EXIT_SUCCESS );
 
 on_error:
+	if( packed_filename != NULL )
+	{
+		memory_free(
+		 packed_filename );
+	}
 	if( error != NULL )
 	{
 		libewf_error_backtrace_fprint(